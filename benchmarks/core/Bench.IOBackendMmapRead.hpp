@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Intrinsic::Bench::Core
+{
+    inline constexpr const char* kIOBackendMmapReadBenchmarkId = "core.io_backend.mmap_read";
+    inline constexpr const char* kIOBackendMmapReadMethod      = "core.io_backend.mmap_view";
+    inline constexpr const char* kIOBackendMmapReadDataset     = "builtin.io.sequential_pattern_128mib_v1";
+
+    // Whole-file reads of one large file through FileIOBackend (owned copy)
+    // and MmapIOBackend (mapped view). Every read touches one byte per page
+    // so the mapped path pays for its page faults. Cold reads drop the page
+    // cache first with posix_fadvise(DONTNEED), which is best effort.
+    struct IOBackendMmapReadMetrics
+    {
+        double      RuntimeMilliseconds{0.0};
+        double      ThroughputItemsPerSecond{0.0};
+        double      QualityErrorL2{0.0};
+        std::size_t FileBytes{0};
+        double      FileColdMilliseconds{0.0};
+        double      MmapColdMilliseconds{0.0};
+        double      FileWarmMedianMilliseconds{0.0};
+        double      MmapWarmMedianMilliseconds{0.0};
+        double      WarmSpeedup{0.0};
+        bool        Succeeded{false};
+    };
+
+    [[nodiscard]] IOBackendMmapReadMetrics RunIOBackendMmapRead();
+} // namespace Intrinsic::Bench::Core
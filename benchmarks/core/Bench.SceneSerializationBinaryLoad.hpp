@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Intrinsic::Bench::Core
+{
+    inline constexpr const char* kSceneSerializationBinaryLoadBenchmarkId = "runtime.scene_serialization.binary_load";
+    inline constexpr const char* kSceneSerializationBinaryLoadMethod      = "runtime.scene_serialization.blob_container";
+    inline constexpr const char* kSceneSerializationBinaryLoadDataset     = "builtin.scene.grid_mesh_point_cloud_v1";
+
+    // Medians of a full load (backend read + decode + registry rebuild) from
+    // FileIOBackend for the same scene saved as a JSON document and as a
+    // binary container.
+    struct SceneSerializationBinaryLoadMetrics
+    {
+        double      RuntimeMilliseconds{0.0};
+        double      ThroughputItemsPerSecond{0.0};
+        double      QualityErrorL2{0.0};
+        std::size_t MeshVertexCount{0};
+        std::size_t MeshFaceCount{0};
+        std::size_t CloudPointCount{0};
+        std::size_t JsonBytes{0};
+        std::size_t BinaryBytes{0};
+        double      JsonSaveMilliseconds{0.0};
+        double      BinarySaveMilliseconds{0.0};
+        double      JsonLoadMedianMilliseconds{0.0};
+        double      BinaryLoadMedianMilliseconds{0.0};
+        double      LoadSpeedup{0.0};
+        bool        Succeeded{false};
+    };
+
+    [[nodiscard]] SceneSerializationBinaryLoadMetrics RunSceneSerializationBinaryLoad();
+} // namespace Intrinsic::Bench::Core
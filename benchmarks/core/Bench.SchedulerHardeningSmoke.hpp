@@ -3,6 +3,8 @@
 // Measures deterministic synthetic scheduler work through public Core APIs.
 // The priority probe is intentionally capable of emitting a schema-valid
 // failed result so the pre-priority implementation remains a useful baseline.
+// The micro-task fan-out probe runs 1M empty tasks through the scheduler and
+// compares a mutex+std::deque worker lane replica with the Chase-Lev deque.
 #pragma once
 
 #include <cstdint>
@@ -27,6 +29,11 @@ namespace Intrinsic::Bench::Core
         double WaitRegistrySingleThreadThroughputItemsPerSecond{0.0};
         double WaitRegistryContendedThroughputItemsPerSecond{0.0};
         double WaitRegistryContendedScalingEfficiency{0.0};
+        double FanOutSchedulerMedianMilliseconds{0.0};
+        double FanOutSchedulerThroughputItemsPerSecond{0.0};
+        double FanOutMutexDequeMedianMilliseconds{0.0};
+        double FanOutChaseLevMedianMilliseconds{0.0};
+        double FanOutChaseLevSpeedup{0.0};
         std::uint32_t WarmupIterations{0u};
         std::uint32_t MeasuredIterations{0u};
         std::uint32_t DispatchWorkerRequest{0u};
@@ -38,9 +45,14 @@ namespace Intrinsic::Bench::Core
         std::uint32_t PriorityLowInHighWindow{0u};
         std::uint32_t WaitRegistryThreadCount{0u};
         std::uint32_t WaitRegistryOperationsPerThread{0u};
+        std::uint32_t FanOutTaskCount{0u};
+        std::uint32_t FanOutWorkerRequest{0u};
+        std::uint32_t FanOutQueueThiefCount{0u};
+        std::uint32_t FanOutMeasuredIterations{0u};
         bool DispatchSucceeded{false};
         bool PriorityContractSatisfied{false};
         bool WaitRegistrySucceeded{false};
+        bool FanOutSucceeded{false};
         bool Succeeded{false};
     };
 
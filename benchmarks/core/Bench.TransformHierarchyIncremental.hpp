@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Intrinsic::Bench::Core
+{
+    inline constexpr const char* kTransformHierarchyIncrementalBenchmarkId = "ecs.transform_hierarchy.incremental_scaling";
+    inline constexpr const char* kTransformHierarchyIncrementalMethod      = "ecs.transform_hierarchy.flat_order_dirty_ranges";
+    inline constexpr const char* kTransformHierarchyIncrementalDataset     = "builtin.ecs_hierarchy.quad_tree_forest_v1";
+
+    // Medians of one OnUpdate after the dirty set is stamped (stamping and
+    // WorldUpdatedTag clearing are outside the timed window). The Recursive*
+    // columns replay the pre-cache recursive root walk on the same registry.
+    struct TransformHierarchyIncrementalTier
+    {
+        std::size_t EntityCount{0};
+        std::size_t SparseDirtyCount{0};
+        double      FlatOrderBuildMilliseconds{0.0};
+        double      CleanMedianMilliseconds{0.0};
+        double      SparseMedianMilliseconds{0.0};
+        double      FullMedianMilliseconds{0.0};
+        double      RecursiveCleanMedianMilliseconds{0.0};
+        double      RecursiveSparseMedianMilliseconds{0.0};
+        double      RecursiveFullMedianMilliseconds{0.0};
+        double      FullEntitiesPerSecond{0.0};
+        std::size_t SparseUpdatedEntities{0};
+        std::size_t FlatOrderRebuilds{0};
+    };
+
+    struct TransformHierarchyIncrementalMetrics
+    {
+        double                            RuntimeMilliseconds{0.0};
+        double                            ThroughputItemsPerSecond{0.0};
+        double                            QualityErrorL2{0.0};
+        TransformHierarchyIncrementalTier Small{};
+        TransformHierarchyIncrementalTier Medium{};
+        TransformHierarchyIncrementalTier Large{};
+        std::size_t                       ParityMismatches{0};
+        bool                              Succeeded{false};
+    };
+
+    [[nodiscard]] TransformHierarchyIncrementalMetrics RunTransformHierarchyIncremental();
+} // namespace Intrinsic::Bench::Core
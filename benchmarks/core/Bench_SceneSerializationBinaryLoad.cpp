@@ -0,0 +1,171 @@
+#include "Bench.SceneSerializationBinaryLoad.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <entt/entity/registry.hpp>
+#include <glm/glm.hpp>
+
+import Extrinsic.Core.IOBackend;
+import Extrinsic.ECS.Components.GeometrySourcesPopulate;
+import Extrinsic.ECS.Scene.Bootstrap;
+import Extrinsic.ECS.Scene.Handle;
+import Extrinsic.ECS.Scene.Registry;
+import Extrinsic.Runtime.SceneSerialization;
+import Geometry.HalfedgeMesh;
+import Geometry.PointCloud;
+
+namespace Intrinsic::Bench::Core
+{
+    namespace
+    {
+        namespace GS = Extrinsic::ECS::Components::GeometrySources;
+        namespace Runtime = Extrinsic::Runtime;
+        using Extrinsic::ECS::Scene::Registry;
+
+        constexpr int kWarmupIterations = 1;
+        constexpr int kMeasuredIterations = 3;
+        constexpr std::size_t kGridSideVertexCount = 129u;
+        constexpr std::size_t kCloudPointCount = 200'000u;
+
+        [[nodiscard]] double ElapsedMilliseconds(const std::chrono::steady_clock::time_point t0,
+                                                 const std::chrono::steady_clock::time_point t1)
+        {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) *
+                1.0e-6;
+        }
+
+        // One triangulated height-field grid plus one point cloud with
+        // normals; every channel kind the container stores (uint32, vec2,
+        // vec3) is populated.
+        void BuildScene(Registry& scene)
+        {
+            ::Geometry::HalfedgeMesh::Mesh mesh;
+            std::vector<::Geometry::VertexHandle> vertices(kGridSideVertexCount * kGridSideVertexCount);
+            for (std::size_t row = 0u; row < kGridSideVertexCount; ++row)
+            {
+                for (std::size_t column = 0u; column < kGridSideVertexCount; ++column)
+                {
+                    const float x = static_cast<float>(column) / static_cast<float>(kGridSideVertexCount - 1u);
+                    const float y = static_cast<float>(row) / static_cast<float>(kGridSideVertexCount - 1u);
+                    vertices[row * kGridSideVertexCount + column] =
+                        mesh.AddVertex(glm::vec3{x, y, 0.25f * x * (1.0f - y)});
+                }
+            }
+            for (std::size_t row = 0u; row + 1u < kGridSideVertexCount; ++row)
+            {
+                for (std::size_t column = 0u; column + 1u < kGridSideVertexCount; ++column)
+                {
+                    const std::size_t base = row * kGridSideVertexCount + column;
+                    (void)mesh.AddTriangle(vertices[base], vertices[base + 1u],
+                                           vertices[base + kGridSideVertexCount + 1u]);
+                    (void)mesh.AddTriangle(vertices[base], vertices[base + kGridSideVertexCount + 1u],
+                                           vertices[base + kGridSideVertexCount]);
+                }
+            }
+            const auto meshEntity = Extrinsic::ECS::Scene::CreateDefault(scene, "Grid Mesh");
+            GS::PopulateFromMesh(scene.Raw(), meshEntity, mesh);
+
+            ::Geometry::PointCloud::Cloud cloud;
+            cloud.Reserve(kCloudPointCount);
+            cloud.EnableNormals();
+            for (std::size_t i = 0u; i < kCloudPointCount; ++i)
+            {
+                const float t = static_cast<float>(i) * 1.0e-4f;
+                const auto point = cloud.AddPoint(glm::vec3{t, 0.5f * t, 1.0f - t});
+                cloud.Normal(point) = glm::vec3{0.0f, static_cast<float>(i % 2u), static_cast<float>((i + 1u) % 2u)};
+            }
+            const auto cloudEntity = Extrinsic::ECS::Scene::CreateDefault(scene, "Point Cloud");
+            GS::PopulateFromCloud(scene.Raw(), cloudEntity, cloud);
+        }
+
+        template <typename Load>
+        [[nodiscard]] double MedianLoadMilliseconds(Load&& load, bool& ok)
+        {
+            for (int i = 0; i < kWarmupIterations; ++i)
+            {
+                Registry scene;
+                ok = load(scene) && ok;
+            }
+
+            std::array<double, kMeasuredIterations> samples{};
+            for (int i = 0; i < kMeasuredIterations; ++i)
+            {
+                Registry scene;
+                const auto t0 = std::chrono::steady_clock::now();
+                ok = load(scene) && ok;
+                const auto t1 = std::chrono::steady_clock::now();
+                samples[static_cast<std::size_t>(i)] = ElapsedMilliseconds(t0, t1);
+            }
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2u];
+        }
+    } // namespace
+
+    SceneSerializationBinaryLoadMetrics RunSceneSerializationBinaryLoad()
+    {
+        SceneSerializationBinaryLoadMetrics metrics{};
+        metrics.MeshVertexCount = kGridSideVertexCount * kGridSideVertexCount;
+        metrics.MeshFaceCount = 2u * (kGridSideVertexCount - 1u) * (kGridSideVertexCount - 1u);
+        metrics.CloudPointCount = kCloudPointCount;
+
+        Registry source;
+        BuildScene(source);
+
+        std::error_code ec;
+        const std::filesystem::path directory =
+            std::filesystem::temp_directory_path(ec) / "intrinsic_scene_serialization_bench";
+        std::filesystem::create_directories(directory, ec);
+        const std::string jsonPath = (directory / "scene.json").string();
+        const std::string binaryPath = (directory / "scene.iscene").string();
+        Extrinsic::Core::IO::FileIOBackend backend;
+
+        auto t0 = std::chrono::steady_clock::now();
+        const auto savedJson = Runtime::SaveSceneDocument(source, jsonPath, backend);
+        auto t1 = std::chrono::steady_clock::now();
+        metrics.JsonSaveMilliseconds = ElapsedMilliseconds(t0, t1);
+
+        t0 = std::chrono::steady_clock::now();
+        const auto savedBinary = Runtime::SaveSceneBinary(source, binaryPath, backend);
+        t1 = std::chrono::steady_clock::now();
+        metrics.BinarySaveMilliseconds = ElapsedMilliseconds(t0, t1);
+
+        bool ok = savedJson.has_value() && savedBinary.has_value();
+        metrics.JsonBytes = static_cast<std::size_t>(std::filesystem::file_size(jsonPath, ec));
+        metrics.BinaryBytes = static_cast<std::size_t>(std::filesystem::file_size(binaryPath, ec));
+
+        metrics.JsonLoadMedianMilliseconds = MedianLoadMilliseconds(
+            [&](Registry& scene) { return Runtime::LoadSceneDocument(scene, jsonPath, backend).has_value(); }, ok);
+        metrics.BinaryLoadMedianMilliseconds = MedianLoadMilliseconds(
+            [&](Registry& scene) { return Runtime::LoadSceneBinary(scene, binaryPath, backend).has_value(); }, ok);
+
+        // Parity: both loaded scenes must re-serialize to the same document.
+        Registry fromJson;
+        Registry fromBinary;
+        ok = Runtime::LoadSceneDocument(fromJson, jsonPath, backend).has_value() && ok;
+        ok = Runtime::LoadSceneBinary(fromBinary, binaryPath, backend).has_value() && ok;
+        const auto jsonDocument = Runtime::SerializeSceneDocument(fromJson);
+        const auto binaryDocument = Runtime::SerializeSceneDocument(fromBinary);
+        const bool parity = jsonDocument.has_value() && binaryDocument.has_value() && *jsonDocument == *binaryDocument;
+        metrics.QualityErrorL2 = parity ? 0.0 : 1.0;
+
+        std::filesystem::remove_all(directory, ec);
+
+        metrics.RuntimeMilliseconds = metrics.BinaryLoadMedianMilliseconds;
+        const double loadedElements = static_cast<double>(metrics.MeshVertexCount + metrics.CloudPointCount);
+        metrics.ThroughputItemsPerSecond = metrics.BinaryLoadMedianMilliseconds > 0.0
+            ? loadedElements / (metrics.BinaryLoadMedianMilliseconds * 1.0e-3)
+            : 0.0;
+        metrics.LoadSpeedup = metrics.BinaryLoadMedianMilliseconds > 0.0
+            ? metrics.JsonLoadMedianMilliseconds / metrics.BinaryLoadMedianMilliseconds
+            : 0.0;
+        metrics.Succeeded = ok && parity;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Core
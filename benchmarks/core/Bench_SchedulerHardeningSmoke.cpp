@@ -8,6 +8,8 @@
 #include <barrier>
 #include <chrono>
 #include <cstdint>
+#include <deque>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -16,6 +18,7 @@
 import Extrinsic.Core.Dag.TaskGraph;
 import Extrinsic.Core.Dag.Scheduler;
 import Extrinsic.Core.Tasks;
+import Extrinsic.Core.WorkStealingDeque;
 
 namespace Intrinsic::Bench::Core
 {
@@ -34,6 +37,10 @@ namespace Intrinsic::Bench::Core
             kPriorityLowTaskCount + kPriorityHighTaskCount;
         constexpr std::uint32_t kWaitRegistryThreadCount = 8u;
         constexpr std::uint32_t kWaitRegistryOperationsPerThread = 4'096u;
+        constexpr std::uint32_t kFanOutTaskCount = 1'000'000u;
+        constexpr std::uint32_t kFanOutWorkerRequest = 4u;
+        constexpr std::uint32_t kFanOutQueueThiefCount = 3u;
+        constexpr std::uint32_t kFanOutMeasuredIterations = 3u;
 
         class SchedulerScope
         {
@@ -89,6 +96,73 @@ namespace Intrinsic::Bench::Core
             bool Succeeded{false};
         };
 
+        struct FanOutProbeMetrics
+        {
+            double SchedulerMedianMilliseconds{0.0};
+            double SchedulerThroughputItemsPerSecond{0.0};
+            double MutexDequeMedianMilliseconds{0.0};
+            double ChaseLevMedianMilliseconds{0.0};
+            bool Succeeded{false};
+        };
+
+        using EmptyTaskFn = void (*)();
+
+        void EmptyTask()
+        {
+        }
+
+        // Replica of the pre-Chase-Lev worker lane: the owner pushes and pops
+        // the back under the lock, thieves try-lock and pop the front.
+        class MutexDequeLane
+        {
+        public:
+            void Push(const EmptyTaskFn task)
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Tasks.push_back(task);
+            }
+
+            [[nodiscard]] bool Pop(EmptyTaskFn& outTask)
+            {
+                std::lock_guard lock(m_Mutex);
+                if (m_Tasks.empty())
+                    return false;
+                outTask = m_Tasks.back();
+                m_Tasks.pop_back();
+                return true;
+            }
+
+            [[nodiscard]] bool TrySteal(EmptyTaskFn& outTask)
+            {
+                std::unique_lock lock(m_Mutex, std::try_to_lock);
+                if (!lock.owns_lock() || m_Tasks.empty())
+                    return false;
+                outTask = m_Tasks.front();
+                m_Tasks.pop_front();
+                return true;
+            }
+
+        private:
+            std::mutex m_Mutex{};
+            std::deque<EmptyTaskFn> m_Tasks{};
+        };
+
+        class ChaseLevLane
+        {
+        public:
+            void Push(const EmptyTaskFn task) { m_Deque.Push(task); }
+            [[nodiscard]] bool Pop(EmptyTaskFn& outTask) { return m_Deque.Pop(outTask); }
+
+            [[nodiscard]] bool TrySteal(EmptyTaskFn& outTask)
+            {
+                return m_Deque.Steal(outTask) ==
+                       Extrinsic::Core::StealResult::Success;
+            }
+
+        private:
+            Extrinsic::Core::WorkStealingDeque<EmptyTaskFn> m_Deque{256u};
+        };
+
         template <typename T>
         void Publish(std::atomic<T>& value, const T published)
         {
@@ -404,6 +478,167 @@ namespace Intrinsic::Bench::Core
                 metrics.ContendedThroughputItemsPerSecond > 0.0;
             return metrics;
         }
+        // Each task splits off half of its remaining range until one leaf is
+        // left, so kFanOutTaskCount tasks run in total and worker deques stay
+        // O(log n) deep instead of holding the whole fan-out at once.
+        void SpawnFanOut(std::atomic<std::uint32_t>* leaves, std::uint32_t count)
+        {
+            while (count > 1u)
+            {
+                const std::uint32_t half = count / 2u;
+                Tasks::Scheduler::Dispatch(
+                    [leaves, half]()
+                    {
+                        SpawnFanOut(leaves, half);
+                    });
+                count -= half;
+            }
+            leaves->fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        // One owner pushes every task and pops every other one while
+        // kFanOutQueueThiefCount thieves steal. Returns 0 on a lost or
+        // duplicated task.
+        template <typename Lane>
+        [[nodiscard]] double MeasureQueueFanOutOnce()
+        {
+            Lane lane{};
+            std::barrier startRun{kFanOutQueueThiefCount + 1u};
+            std::atomic<bool> ownerDrained{false};
+            std::array<std::uint32_t, kFanOutQueueThiefCount> stolen{};
+            std::vector<std::thread> thieves;
+            thieves.reserve(kFanOutQueueThiefCount);
+            for (std::uint32_t thief = 0u; thief < kFanOutQueueThiefCount; ++thief)
+            {
+                thieves.emplace_back(
+                    [&, thief]()
+                    {
+                        startRun.arrive_and_wait();
+                        std::uint32_t executed = 0u;
+                        EmptyTaskFn task = nullptr;
+                        for (;;)
+                        {
+                            if (lane.TrySteal(task))
+                            {
+                                task();
+                                ++executed;
+                            }
+                            else if (ownerDrained.load(std::memory_order_acquire))
+                            {
+                                break;
+                            }
+                            else
+                            {
+                                std::this_thread::yield();
+                            }
+                        }
+                        stolen[thief] = executed;
+                    });
+            }
+
+            startRun.arrive_and_wait();
+            const auto startedAt = std::chrono::steady_clock::now();
+            std::uint32_t executed = 0u;
+            EmptyTaskFn task = nullptr;
+            for (std::uint32_t i = 0u; i < kFanOutTaskCount; ++i)
+            {
+                lane.Push(&EmptyTask);
+                if ((i & 1u) == 0u && lane.Pop(task))
+                {
+                    task();
+                    ++executed;
+                }
+            }
+            while (lane.Pop(task))
+            {
+                task();
+                ++executed;
+            }
+            ownerDrained.store(true, std::memory_order_release);
+            for (auto& thief : thieves)
+            {
+                thief.join();
+            }
+            const auto finishedAt = std::chrono::steady_clock::now();
+
+            for (const std::uint32_t count : stolen)
+            {
+                executed += count;
+            }
+            if (executed != kFanOutTaskCount)
+            {
+                return 0.0;
+            }
+            return static_cast<double>(
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           finishedAt - startedAt)
+                           .count()) *
+                   1.0e-6;
+        }
+
+        [[nodiscard]] FanOutProbeMetrics MeasureMicroTaskFanOut()
+        {
+            FanOutProbeMetrics metrics{};
+            {
+                SchedulerScope scheduler{kFanOutWorkerRequest};
+                const auto run = []() -> double
+                {
+                    std::atomic<std::uint32_t> leaves{0u};
+                    const auto startedAt = std::chrono::steady_clock::now();
+                    Tasks::Scheduler::Dispatch(
+                        [&leaves]()
+                        {
+                            SpawnFanOut(&leaves, kFanOutTaskCount);
+                        });
+                    Tasks::Scheduler::WaitForAll();
+                    const auto finishedAt = std::chrono::steady_clock::now();
+                    if (leaves.load(std::memory_order_relaxed) != kFanOutTaskCount)
+                    {
+                        return 0.0;
+                    }
+                    return static_cast<double>(
+                               std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   finishedAt - startedAt)
+                                   .count()) *
+                           1.0e-6;
+                };
+
+                (void)run();
+                std::array<double, kFanOutMeasuredIterations> samples{};
+                for (double& sample : samples)
+                {
+                    sample = run();
+                }
+                metrics.SchedulerMedianMilliseconds = Median(samples);
+            }
+
+            std::array<double, kFanOutMeasuredIterations> mutexSamples{};
+            std::array<double, kFanOutMeasuredIterations> chaseLevSamples{};
+            for (std::uint32_t iteration = 0u;
+                 iteration < kFanOutMeasuredIterations;
+                 ++iteration)
+            {
+                mutexSamples[iteration] = MeasureQueueFanOutOnce<MutexDequeLane>();
+                chaseLevSamples[iteration] = MeasureQueueFanOutOnce<ChaseLevLane>();
+            }
+            metrics.MutexDequeMedianMilliseconds = Median(mutexSamples);
+            metrics.ChaseLevMedianMilliseconds = Median(chaseLevSamples);
+
+            metrics.SchedulerThroughputItemsPerSecond =
+                metrics.SchedulerMedianMilliseconds > 0.0
+                    ? static_cast<double>(kFanOutTaskCount) /
+                          (metrics.SchedulerMedianMilliseconds * 1.0e-3)
+                    : 0.0;
+            const auto allPositive = [](const auto& samples)
+            {
+                return std::all_of(samples.begin(), samples.end(),
+                                   [](const double sample) { return sample > 0.0; });
+            };
+            metrics.Succeeded = metrics.SchedulerMedianMilliseconds > 0.0 &&
+                                allPositive(mutexSamples) &&
+                                allPositive(chaseLevSamples);
+            return metrics;
+        }
     } // namespace
 
     SchedulerHardeningSmokeMetrics RunSchedulerHardeningSmoke()
@@ -412,6 +647,7 @@ namespace Intrinsic::Bench::Core
         const PriorityProbeMetrics priority = MeasurePriorityInversion();
         const WaitRegistryProbeMetrics waitRegistry =
             MeasureWaitRegistryContention();
+        const FanOutProbeMetrics fanOut = MeasureMicroTaskFanOut();
 
         SchedulerHardeningSmokeMetrics metrics{};
         metrics.RuntimeMilliseconds = dispatch.MedianMilliseconds;
@@ -431,6 +667,19 @@ namespace Intrinsic::Bench::Core
             waitRegistry.ContendedThroughputItemsPerSecond;
         metrics.WaitRegistryContendedScalingEfficiency =
             waitRegistry.ContendedScalingEfficiency;
+        metrics.FanOutSchedulerMedianMilliseconds =
+            fanOut.SchedulerMedianMilliseconds;
+        metrics.FanOutSchedulerThroughputItemsPerSecond =
+            fanOut.SchedulerThroughputItemsPerSecond;
+        metrics.FanOutMutexDequeMedianMilliseconds =
+            fanOut.MutexDequeMedianMilliseconds;
+        metrics.FanOutChaseLevMedianMilliseconds =
+            fanOut.ChaseLevMedianMilliseconds;
+        metrics.FanOutChaseLevSpeedup =
+            fanOut.ChaseLevMedianMilliseconds > 0.0
+                ? fanOut.MutexDequeMedianMilliseconds /
+                      fanOut.ChaseLevMedianMilliseconds
+                : 0.0;
         metrics.WarmupIterations = kWarmupIterations;
         metrics.MeasuredIterations = kMeasuredIterations;
         metrics.DispatchWorkerRequest = kDispatchWorkerRequest;
@@ -444,12 +693,18 @@ namespace Intrinsic::Bench::Core
         metrics.WaitRegistryThreadCount = kWaitRegistryThreadCount;
         metrics.WaitRegistryOperationsPerThread =
             kWaitRegistryOperationsPerThread;
+        metrics.FanOutTaskCount = kFanOutTaskCount;
+        metrics.FanOutWorkerRequest = kFanOutWorkerRequest;
+        metrics.FanOutQueueThiefCount = kFanOutQueueThiefCount;
+        metrics.FanOutMeasuredIterations = kFanOutMeasuredIterations;
         metrics.DispatchSucceeded = dispatch.Succeeded;
         metrics.PriorityContractSatisfied = priority.Succeeded;
         metrics.WaitRegistrySucceeded = waitRegistry.Succeeded;
+        metrics.FanOutSucceeded = fanOut.Succeeded;
         metrics.Succeeded = metrics.DispatchSucceeded &&
                             metrics.PriorityContractSatisfied &&
-                            metrics.WaitRegistrySucceeded;
+                            metrics.WaitRegistrySucceeded &&
+                            metrics.FanOutSucceeded;
         return metrics;
     }
 } // namespace Intrinsic::Bench::Core
@@ -0,0 +1,277 @@
+#include "Bench.TransformHierarchyIncremental.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <entt/entity/registry.hpp>
+#include <glm/glm.hpp>
+
+import Extrinsic.Core.Tasks;
+import Extrinsic.ECS.Scene.Handle;
+import Extrinsic.ECS.Component.Hierarchy;
+import Extrinsic.ECS.Component.Transform;
+import Extrinsic.ECS.Component.Transform.WorldMatrix;
+import Extrinsic.ECS.Hierarchy.Mutation;
+import Extrinsic.ECS.System.TransformHierarchy;
+
+namespace Intrinsic::Bench::Core
+{
+    namespace
+    {
+        namespace Components = Extrinsic::ECS::Components;
+        namespace TransformSystem = Extrinsic::ECS::Systems::TransformHierarchy;
+        using Extrinsic::ECS::EntityHandle;
+        using Extrinsic::ECS::InvalidEntityHandle;
+
+        constexpr int kWarmupIterations = 1;
+        constexpr int kMeasuredIterations = 5;
+        // Complete 4-ary trees of depth 6 (1 + 4 + ... + 1024 nodes).
+        constexpr std::size_t kTreeBranching = 4u;
+        constexpr std::size_t kTreeSize = 1365u;
+        constexpr std::size_t kSparseDirtyStride = 100u;
+        constexpr std::size_t kParityEntityCount = 10'000u;
+
+        struct Forest
+        {
+            entt::registry Registry{};
+            std::vector<EntityHandle> Entities{};
+            std::vector<EntityHandle> SparseDirty{};
+        };
+
+        // Entity g sits at slot g % kTreeSize of tree g / kTreeSize, with the
+        // heap-order parent (slot - 1) / kTreeBranching. 1% of entities,
+        // picked by hash, form the sparse dirty set.
+        void BuildForest(Forest& forest, const std::size_t entityCount)
+        {
+            auto& registry = forest.Registry;
+            forest.Entities.reserve(entityCount);
+            for (std::size_t g = 0; g < entityCount; ++g)
+            {
+                const EntityHandle entity = registry.create();
+                registry.emplace<Components::Transform::Component>(entity);
+                registry.emplace<Components::Transform::WorldMatrix>(entity);
+                registry.emplace<Components::Hierarchy::Component>(entity);
+                forest.Entities.push_back(entity);
+
+                const std::size_t slot = g % kTreeSize;
+                if (slot != 0u)
+                {
+                    const std::size_t parent = g - slot + (slot - 1u) / kTreeBranching;
+                    Extrinsic::ECS::Hierarchy::Attach(registry, entity, forest.Entities[parent]);
+                }
+
+                // After Attach, which rebases the local transform onto the parent.
+                auto& local = registry.get<Components::Transform::Component>(entity);
+                local.Position = glm::vec3{static_cast<float>(g % 7u), static_cast<float>(g % 5u), 0.25f};
+                local.Scale = glm::vec3{1.0f + 0.01f * static_cast<float>(g % 3u)};
+
+                const std::uint32_t hash = static_cast<std::uint32_t>(g) * 2654435761u;
+                if ((hash >> 8u) % kSparseDirtyStride == 0u)
+                {
+                    forest.SparseDirty.push_back(entity);
+                }
+            }
+            // Attach marks every child dirty; start from a clean frame.
+            registry.clear<Components::Transform::IsDirtyTag>();
+        }
+
+        // Replica of the recursive root walk the flat order replaced.
+        void RecursiveUpdateNode(entt::registry& registry,
+                                 const EntityHandle entity,
+                                 const glm::mat4& parentMatrix,
+                                 const bool parentDirty)
+        {
+            auto* local = registry.try_get<Components::Transform::Component>(entity);
+            auto* world = registry.try_get<Components::Transform::WorldMatrix>(entity);
+            const auto* hierarchy = registry.try_get<Components::Hierarchy::Component>(entity);
+            if (local == nullptr || world == nullptr)
+            {
+                return;
+            }
+
+            const bool isDirty = parentDirty || registry.all_of<Components::Transform::IsDirtyTag>(entity);
+            if (isDirty)
+            {
+                world->Matrix = parentMatrix * Components::Transform::GetMatrix(*local);
+                registry.emplace_or_replace<Components::Transform::WorldUpdatedTag>(entity);
+                registry.remove<Components::Transform::IsDirtyTag>(entity);
+            }
+
+            if (hierarchy == nullptr)
+            {
+                return;
+            }
+            EntityHandle child = hierarchy->FirstChild;
+            while (child != InvalidEntityHandle)
+            {
+                const EntityHandle next = registry.get<Components::Hierarchy::Component>(child).NextSibling;
+                RecursiveUpdateNode(registry, child, world->Matrix, isDirty);
+                child = next;
+            }
+        }
+
+        void RecursiveUpdate(entt::registry& registry)
+        {
+            const auto roots = registry.view<Components::Transform::Component, Components::Hierarchy::Component>();
+            for (auto [entity, transform, hierarchy] : roots.each())
+            {
+                (void)transform;
+                if (hierarchy.Parent == InvalidEntityHandle)
+                {
+                    RecursiveUpdateNode(registry, entity, glm::mat4(1.0f), false);
+                }
+            }
+        }
+
+        void StampDirty(entt::registry& registry, const std::vector<EntityHandle>& dirty)
+        {
+            registry.clear<Components::Transform::WorldUpdatedTag>();
+            for (const EntityHandle entity : dirty)
+            {
+                registry.emplace_or_replace<Components::Transform::IsDirtyTag>(entity);
+            }
+        }
+
+        template <typename Prepare, typename Run>
+        [[nodiscard]] double MedianMilliseconds(Prepare&& prepare, Run&& run)
+        {
+            for (int i = 0; i < kWarmupIterations; ++i)
+            {
+                prepare();
+                run();
+            }
+
+            std::array<double, kMeasuredIterations> samples{};
+            for (int i = 0; i < kMeasuredIterations; ++i)
+            {
+                prepare();
+                const auto t0 = std::chrono::steady_clock::now();
+                run();
+                const auto t1 = std::chrono::steady_clock::now();
+                samples[static_cast<std::size_t>(i)] =
+                    static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) * 1.0e-6;
+            }
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2u];
+        }
+
+        [[nodiscard]] TransformHierarchyIncrementalTier RunTier(const std::size_t entityCount)
+        {
+            Forest forest{};
+            BuildForest(forest, entityCount);
+            auto& registry = forest.Registry;
+            const std::vector<EntityHandle> noneDirty{};
+
+            TransformHierarchyIncrementalTier tier{};
+            tier.EntityCount = entityCount;
+            tier.SparseDirtyCount = forest.SparseDirty.size();
+
+            const auto t0 = std::chrono::steady_clock::now();
+            (void)TransformSystem::GetFlatOrder(registry);
+            const auto t1 = std::chrono::steady_clock::now();
+            tier.FlatOrderBuildMilliseconds =
+                static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) * 1.0e-6;
+
+            const auto flatUpdate = [&registry] { TransformSystem::OnUpdate(registry); };
+            const auto recursiveUpdate = [&registry] { RecursiveUpdate(registry); };
+            tier.CleanMedianMilliseconds =
+                MedianMilliseconds([&] { StampDirty(registry, noneDirty); }, flatUpdate);
+            tier.SparseMedianMilliseconds =
+                MedianMilliseconds([&] { StampDirty(registry, forest.SparseDirty); }, flatUpdate);
+            tier.SparseUpdatedEntities = registry.view<Components::Transform::WorldUpdatedTag>().size();
+            tier.FullMedianMilliseconds =
+                MedianMilliseconds([&] { StampDirty(registry, forest.Entities); }, flatUpdate);
+            tier.FlatOrderRebuilds = static_cast<std::size_t>(TransformSystem::GetFlatOrderRebuildCount(registry));
+
+            tier.RecursiveCleanMedianMilliseconds =
+                MedianMilliseconds([&] { StampDirty(registry, noneDirty); }, recursiveUpdate);
+            tier.RecursiveSparseMedianMilliseconds =
+                MedianMilliseconds([&] { StampDirty(registry, forest.SparseDirty); }, recursiveUpdate);
+            tier.RecursiveFullMedianMilliseconds =
+                MedianMilliseconds([&] { StampDirty(registry, forest.Entities); }, recursiveUpdate);
+
+            tier.FullEntitiesPerSecond = tier.FullMedianMilliseconds > 0.0
+                ? static_cast<double>(entityCount) / (tier.FullMedianMilliseconds * 1.0e-3)
+                : 0.0;
+            return tier;
+        }
+
+        // Two identical forests updated by the flat system and by the
+        // recursive replica must end with bitwise-equal world matrices and
+        // the same WorldUpdatedTag set, for the full and then the sparse dirty set.
+        [[nodiscard]] std::size_t CountParityMismatches()
+        {
+            Forest flat{};
+            Forest recursive{};
+            BuildForest(flat, kParityEntityCount);
+            BuildForest(recursive, kParityEntityCount);
+
+            std::size_t mismatches = 0u;
+            for (const bool full : {true, false})
+            {
+                StampDirty(flat.Registry, full ? flat.Entities : flat.SparseDirty);
+                StampDirty(recursive.Registry, full ? recursive.Entities : recursive.SparseDirty);
+                TransformSystem::OnUpdate(flat.Registry);
+                RecursiveUpdate(recursive.Registry);
+
+                for (std::size_t i = 0; i < flat.Entities.size(); ++i)
+                {
+                    const glm::mat4& a = flat.Registry.get<Components::Transform::WorldMatrix>(flat.Entities[i]).Matrix;
+                    const glm::mat4& b =
+                        recursive.Registry.get<Components::Transform::WorldMatrix>(recursive.Entities[i]).Matrix;
+                    const bool flatUpdated =
+                        flat.Registry.all_of<Components::Transform::WorldUpdatedTag>(flat.Entities[i]);
+                    const bool recursiveUpdated =
+                        recursive.Registry.all_of<Components::Transform::WorldUpdatedTag>(recursive.Entities[i]);
+                    if (std::memcmp(&a, &b, sizeof(glm::mat4)) != 0 || flatUpdated != recursiveUpdated)
+                    {
+                        ++mismatches;
+                    }
+                }
+            }
+            return mismatches;
+        }
+    } // namespace
+
+    TransformHierarchyIncrementalMetrics RunTransformHierarchyIncremental()
+    {
+        namespace Tasks = Extrinsic::Core::Tasks;
+
+        TransformHierarchyIncrementalMetrics metrics{};
+        const bool ownsScheduler = !Tasks::Scheduler::IsInitialized();
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Initialize();
+        }
+
+        metrics.Small = RunTier(10'000u);
+        metrics.Medium = RunTier(100'000u);
+        metrics.Large = RunTier(1'000'000u);
+        metrics.ParityMismatches = CountParityMismatches();
+
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Shutdown();
+        }
+
+        metrics.RuntimeMilliseconds = metrics.Large.SparseMedianMilliseconds;
+        metrics.ThroughputItemsPerSecond = metrics.Large.FullEntitiesPerSecond;
+        metrics.QualityErrorL2 = std::sqrt(static_cast<double>(metrics.ParityMismatches));
+
+        // The cached order is built once per tier and every dirty entity's
+        // whole subtree is rewritten.
+        bool valid = metrics.ParityMismatches == 0u;
+        for (const TransformHierarchyIncrementalTier* tier : {&metrics.Small, &metrics.Medium, &metrics.Large})
+        {
+            valid = valid && tier->FlatOrderRebuilds == 1u &&
+                    tier->SparseUpdatedEntities >= tier->SparseDirtyCount && tier->SparseDirtyCount > 0u;
+        }
+        metrics.Succeeded = valid;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Core
@@ -1,4 +1,9 @@
 // METHOD-023 — deterministic Boundary First Flattening reference smoke.
+//
+// Alongside the 3x3 correctness fixture, the interior Dirichlet cotan
+// Laplacian of a 129x129 curved disk is solved with Jacobi- and
+// AMG-preconditioned CG; iteration counts and wall times are reported as
+// diagnostics. BFF itself keeps its direct LDLT solves.
 #pragma once
 
 #include <cstddef>
@@ -20,6 +25,12 @@ namespace Intrinsic::Bench::Geometry
         kBoundaryFirstFlatteningReferenceSmokeRuntimeMillisecondsMax = 250.0;
     inline constexpr double
         kBoundaryFirstFlatteningReferenceSmokeQualityErrorL2Max = 0.5;
+    inline constexpr const char* kBoundaryFirstFlatteningSolverComparisonDataset =
+        "builtin.curved_grid_disk_n129";
+    inline constexpr std::size_t
+        kBoundaryFirstFlatteningSolverComparisonSideVertexCount = 129u;
+    inline constexpr std::size_t
+        kBoundaryFirstFlatteningSolverComparisonMaxIterations = 20000u;
 
     struct BoundaryFirstFlatteningReferenceSmokeMetrics
     {
@@ -34,6 +45,17 @@ namespace Intrinsic::Bench::Geometry
         std::size_t EvaluatedFaceCount{0u};
         std::size_t FlippedElementCount{0u};
         std::size_t FailedMeasuredIterationCount{0u};
+
+        // CG preconditioner comparison on the Dirichlet Laplacian.
+        std::size_t SolverComparisonUnknownCount{0u};
+        std::size_t CGJacobiIterations{0u};
+        std::size_t CGAMGIterations{0u};
+        std::size_t AMGLevelCount{0u};
+        double CGJacobiMilliseconds{0.0};
+        double AMGSetupMilliseconds{0.0};
+        double CGAMGMilliseconds{0.0};
+        bool SolverComparisonConverged{false};
+
         std::string_view FailureReason{"not_run"};
         bool Succeeded{false};
     };
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Intrinsic::Bench::Geometry
+{
+    inline constexpr const char* kKMeansCpuBenchmarkId = "geometry.kmeans.cpu_bounded";
+    inline constexpr const char* kKMeansCpuMethod      = "geometry.kmeans.cpu_hamerly";
+    inline constexpr const char* kKMeansCpuDataset     = "builtin.kmeans.gaussian_blobs_500k_v1";
+
+    // Gaussian blobs clustered for a fixed iteration count (tolerance 0).
+    // The exact CPU backend is compared against a serial brute-force Lloyd
+    // loop from the same seeds; MiniBatch runs on the same input and reports
+    // its inertia relative to the exact result. The CPU backend runs on the
+    // task scheduler (initialized here when the caller has not).
+    struct KMeansCpuMetrics
+    {
+        double        RuntimeMilliseconds{0.0};
+        double        ThroughputItemsPerSecond{0.0};
+        double        QualityErrorL2{0.0};
+        std::size_t   PointCount{0};
+        std::uint32_t ClusterCount{0};
+        std::uint32_t Iterations{0};
+        double        BruteForceMilliseconds{0.0};
+        double        ExactMedianMilliseconds{0.0};
+        double        MiniBatchMedianMilliseconds{0.0};
+        double        ExactSpeedup{0.0};
+        // Distance evaluations of the exact backend over n * k * iterations.
+        double        DistanceEvaluationFraction{0.0};
+        std::size_t   LabelMismatches{0};
+        double        MiniBatchInertiaRatio{0.0};
+        bool          Succeeded{false};
+    };
+
+    [[nodiscard]] KMeansCpuMetrics RunKMeansCpuSmoke();
+} // namespace Intrinsic::Bench::Geometry
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Intrinsic::Bench::Geometry
+{
+    inline constexpr const char* kMeshImportBenchmarkId = "geometry.mesh_io.import";
+    inline constexpr const char* kMeshImportMethod      = "geometry.mesh_io.parallel_parse_bulk_halfedge";
+    inline constexpr const char* kMeshImportDataset     = "builtin.mesh.grid_1m_triangles_v1";
+
+    // Writes a ~1M-triangle height-field grid as OBJ, binary PLY and binary
+    // STL. Each file is loaded once without a scheduler (the serial
+    // fallback) and then on the task scheduler (initialized here when the
+    // caller has not); STL loads weld vertices. The OBJ load is then turned
+    // into a halfedge mesh with per-face AddFace and with BuildFromPolygons.
+    // runtime_ms is the parallel OBJ load plus the bulk build; throughput is
+    // triangles per second for that import; quality_error_l2 sums the L2
+    // position gaps between the serial and parallel loads of each format.
+    struct MeshImportMetrics
+    {
+        double      RuntimeMilliseconds{0.0};
+        double      ThroughputItemsPerSecond{0.0};
+        double      QualityErrorL2{0.0};
+        std::size_t VertexCount{0};
+        std::size_t TriangleCount{0};
+        std::size_t ObjFileBytes{0};
+        std::size_t PlyFileBytes{0};
+        std::size_t StlFileBytes{0};
+        double      ObjSerialMilliseconds{0.0};
+        double      ObjParallelMilliseconds{0.0};
+        double      PlySerialMilliseconds{0.0};
+        double      PlyParallelMilliseconds{0.0};
+        double      StlSerialMilliseconds{0.0};
+        double      StlParallelMilliseconds{0.0};
+        double      AddFaceBuildMilliseconds{0.0};
+        double      BulkBuildMilliseconds{0.0};
+        double      Speedup{0.0};
+        bool        Succeeded{false};
+    };
+
+    [[nodiscard]] MeshImportMetrics RunMeshImport();
+} // namespace Intrinsic::Bench::Geometry
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Intrinsic::Bench::Geometry
+{
+    inline constexpr const char* kPointCloudAsciiLoadBenchmarkId = "geometry.point_cloud_io.ascii_load";
+    inline constexpr const char* kPointCloudAsciiLoadMethod      = "geometry.point_cloud_io.chunked_ascii";
+    inline constexpr const char* kPointCloudAsciiLoadDataset     = "builtin.point_cloud.xyzrgb_csv_1m_v1";
+
+    // Loads a 1M-point XYZRGB file three ways: a copy of the pre-chunking
+    // XYZ reader (ostringstream read, token and value vectors per line),
+    // LoadXYZ(path), and LoadXYZ through MmapIOBackend with the default
+    // 8 MiB chunks. A 1M-point CSV with normals is loaded through
+    // MmapIOBackend to cover the strict readers. MB/s counts file bytes over
+    // the median load time. runtime_ms is the mapped XYZ median; throughput
+    // is points per second for that load; quality_error_l2 is the L2 gap of
+    // positions and colors between the reference and the mapped load. The
+    // task scheduler is initialized here when the caller has not.
+    struct PointCloudAsciiLoadMetrics
+    {
+        double      RuntimeMilliseconds{0.0};
+        double      ThroughputItemsPerSecond{0.0};
+        double      QualityErrorL2{0.0};
+        std::size_t PointCount{0};
+        std::size_t XyzFileBytes{0};
+        std::size_t CsvFileBytes{0};
+        std::size_t ChunkCount{0};
+        double      ReferenceMBPerSecond{0.0};
+        double      PathMBPerSecond{0.0};
+        double      MmapMBPerSecond{0.0};
+        double      CsvMmapMBPerSecond{0.0};
+        double      Speedup{0.0};
+        bool        Succeeded{false};
+    };
+
+    [[nodiscard]] PointCloudAsciiLoadMetrics RunPointCloudAsciiLoad();
+} // namespace Intrinsic::Bench::Geometry
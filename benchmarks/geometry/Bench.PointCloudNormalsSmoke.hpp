@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace Intrinsic::Bench::Geometry
+{
+    inline constexpr const char* kPointCloudNormalsBenchmarkId = "geometry.pointcloud.normals_parallel";
+    inline constexpr const char* kPointCloudNormalsMethod      = "geometry.pointcloud.normals_pca_boruvka_mst";
+    inline constexpr const char* kPointCloudNormalsDataset     = "builtin.noisy_sphere_points_1m_v1";
+
+    // One Normals::Estimate run with MinimumSpanningTree orientation. The
+    // 10M tier is opt-in (see kRunLargeTier in the translation unit); a
+    // skipped tier reports PointCount 0.
+    struct PointCloudNormalsTier
+    {
+        std::size_t PointCount{0};
+        double      SerialMilliseconds{0.0};
+        double      ParallelMedianMilliseconds{0.0};
+        std::size_t OrientationCellCount{0};
+        std::size_t OrientationMergeRoundCount{0};
+        std::size_t InwardNormalCount{0};
+        std::size_t NormalMismatchCount{0};
+    };
+
+    // Points on the unit sphere with small radial noise. Each tier runs once
+    // without a scheduler (the serial fallback) and then on the task
+    // scheduler (initialized here when the caller has not); the two must
+    // produce identical normals. Quality is the fraction of normals that
+    // point into the sphere after orientation.
+    struct PointCloudNormalsMetrics
+    {
+        double                               RuntimeMilliseconds{0.0};
+        double                               ThroughputItemsPerSecond{0.0};
+        double                               QualityErrorL2{0.0};
+        double                               ParallelSpeedup{0.0};
+        std::array<PointCloudNormalsTier, 2> Tiers{};
+        bool                                 Succeeded{false};
+    };
+
+    [[nodiscard]] PointCloudNormalsMetrics RunPointCloudNormalsSmoke();
+} // namespace Intrinsic::Bench::Geometry
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Intrinsic::Bench::Geometry
+{
+    inline constexpr const char* kPointKDTreeKnnBenchmarkId = "geometry.point_kdtree.knn_batch";
+    inline constexpr const char* kPointKDTreeKnnMethod      = "geometry.point_kdtree.batched_knn";
+    inline constexpr const char* kPointKDTreeKnnDataset     = "builtin.uniform_cube_points_1m_v1";
+
+    // Per-k comparison of KDTree::QueryKNN called once per query against one
+    // PointKDTree::QueryKNNBatch call over the same query set.
+    struct PointKDTreeKnnTier
+    {
+        std::uint32_t K{0};
+        double        KDTreeMedianMilliseconds{0.0};
+        double        PointKDTreeMedianMilliseconds{0.0};
+        double        Speedup{0.0};
+        std::size_t   Mismatches{0};
+    };
+
+    // Uniform points in the unit cube with uniform queries over the same
+    // cube. Both trees use their default leaf sizes; the batch query runs on
+    // the task scheduler (initialized here when the caller has not).
+    struct PointKDTreeKnnMetrics
+    {
+        double                            RuntimeMilliseconds{0.0};
+        double                            ThroughputItemsPerSecond{0.0};
+        double                            QualityErrorL2{0.0};
+        std::size_t                       PointCount{0};
+        std::size_t                       QueryCount{0};
+        double                            KDTreeBuildMilliseconds{0.0};
+        double                            PointKDTreeBuildMilliseconds{0.0};
+        std::array<PointKDTreeKnnTier, 3> Tiers{};
+        bool                              Succeeded{false};
+    };
+
+    [[nodiscard]] PointKDTreeKnnMetrics RunPointKDTreeKnnSmoke();
+} // namespace Intrinsic::Bench::Geometry
@@ -4,6 +4,10 @@
 // deterministic flat-grid workload with an oriented square source curve. The
 // companion manifest lives at
 // benchmarks/geometry/manifests/signed_heat_reference_smoke.yaml.
+//
+// It also solves the method's Poisson operator (L + eps*M) on a larger flat
+// grid with Jacobi- and AMG-preconditioned CG and reports both iteration
+// counts and wall times. The method itself keeps its direct LDLT solve.
 #pragma once
 
 #include <cstdint>
@@ -13,6 +17,7 @@ namespace Intrinsic::Bench::Geometry
     inline constexpr const char* kSignedHeatReferenceSmokeBenchmarkId = "geometry.signed_heat.smoke";
     inline constexpr const char* kSignedHeatReferenceSmokeMethod      = "geometry.signed_heat";
     inline constexpr const char* kSignedHeatReferenceSmokeDataset     = "builtin.flat_grid.square_boundary.8";
+    inline constexpr const char* kSignedHeatSolverComparisonDataset   = "builtin.flat_grid.128";
 
     struct SignedHeatReferenceSmokeMetrics
     {
@@ -22,6 +27,17 @@ namespace Intrinsic::Bench::Geometry
         double        MeanBoundaryOffset{0.0};
         std::uint32_t SourceVertexCount{0};
         std::uint32_t DegenerateBoundaryVertexCount{0};
+
+        // CG preconditioner comparison on the Poisson operator.
+        std::uint32_t SolverComparisonVertexCount{0};
+        std::uint32_t CGJacobiIterations{0};
+        std::uint32_t CGAMGIterations{0};
+        std::uint32_t AMGLevelCount{0};
+        double        CGJacobiMilliseconds{0.0};
+        double        AMGSetupMilliseconds{0.0};
+        double        CGAMGMilliseconds{0.0}; // solve only; setup is reported separately
+        bool          SolverComparisonConverged{false};
+
         bool          Succeeded{false};
     };
 
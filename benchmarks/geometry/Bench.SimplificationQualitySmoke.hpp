@@ -13,6 +13,8 @@ namespace Intrinsic::Bench::Geometry
         "builtin.tessellated_cube_n4";
     inline constexpr double kSimplificationQualitySmokeRuntimeMillisecondsMax =
         5000.0;
+    inline constexpr const char* kSimplificationScheduleSpeedDataset =
+        "builtin.tessellated_cube_n48";
 
     struct SimplificationQualitySmokeMetrics
     {
@@ -31,6 +33,30 @@ namespace Intrinsic::Bench::Geometry
         std::size_t FeatureAwarePinnedCornerCount{0u};
         std::size_t FeatureAwareQualityRejectionCount{0u};
         std::size_t FailedMeasuredIterationCount{0u};
+
+        // CollapseSchedule::IndependentSets with FA_QEM on the same fixture.
+        // The regression is the positive excess of its sampled RMS distance
+        // over the greedy FA_QEM result; it is reported, not gated.
+        double IndependentSetRmsDistance{0.0};
+        double IndependentSetMaxDistance{0.0};
+        double IndependentSetQualityRegressionL2{0.0};
+        std::size_t IndependentSetFinalFaceCount{0u};
+        std::size_t IndependentSetRoundCount{0u};
+
+        // Schedule comparison on a denser cube
+        // (kSimplificationScheduleSpeedDataset), run once outside the gated
+        // runtime: greedy without a scheduler against IndependentSets on the
+        // task scheduler (initialized here when the caller has not).
+        double GreedyScheduleMilliseconds{0.0};
+        double IndependentSetScheduleMilliseconds{0.0};
+        double IndependentSetSpeedup{0.0};
+        double GreedyScheduleRmsDistance{0.0};
+        double IndependentSetScheduleRmsDistance{0.0};
+        std::size_t ScheduleInputFaceCount{0u};
+        std::size_t ScheduleTargetFaceCount{0u};
+        std::size_t GreedyScheduleFinalFaceCount{0u};
+        std::size_t IndependentSetScheduleFinalFaceCount{0u};
+        std::size_t IndependentSetScheduleRoundCount{0u};
         bool Succeeded{false};
     };
 
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Intrinsic::Bench::Geometry
+{
+    inline constexpr const char* kSparseSpMVMethod = "geometry.sparse.spmv";
+
+    // One problem size. The 100k cohort runs in IntrinsicBenchmarkSmoke; the
+    // 1M and 10M cohorts run in the opt-in IntrinsicSparseSpMVProfile.
+    struct SparseSpMVCohort
+    {
+        const char* BenchmarkId{nullptr};
+        const char* Dataset{nullptr};
+        std::size_t GridSide{0};
+        int WarmupIterations{1};
+        int MeasuredIterations{1};
+    };
+
+    inline constexpr SparseSpMVCohort kSparseSpMVSmokeCohort{
+        "geometry.sparse.spmv.100k", "builtin.sparse.shuffled_grid_laplacian_100k_v1", 317u, 2, 20};
+    inline constexpr SparseSpMVCohort kSparseSpMV1MCohort{
+        "geometry.sparse.spmv.1m", "builtin.sparse.shuffled_grid_laplacian_1m_v1", 1000u, 1, 10};
+    inline constexpr SparseSpMVCohort kSparseSpMV10MCohort{
+        "geometry.sparse.spmv.10m", "builtin.sparse.shuffled_grid_laplacian_10m_v1", 3163u, 1, 5};
+
+    // Graph Laplacian of a triangulated GridSide x GridSide mesh (7 non-zeros
+    // per interior row) with its vertices shuffled, as a stand-in for a mesh
+    // whose vertex order has no locality. Times y = A x for
+    //   - SparseMatrix (64-bit indices) in the shuffled order,
+    //   - SparseMatrix after reverse Cuthill-McKee reordering,
+    //   - CompactSparseMatrix<double> and <float> in the RCM order,
+    //   - CompactSparseMatrix<double>::MultiplyTranspose with a cached
+    //     transposed copy.
+    // Bandwidth is the compulsory traffic (CSR arrays plus one read of x and
+    // one write of y) over the median time. runtime_ms is the compact double
+    // median; throughput counts non-zeros per second. The task scheduler is
+    // initialized here when the caller has not.
+    struct SparseSpMVMetrics
+    {
+        double      RuntimeMilliseconds{0.0};
+        double      ThroughputItemsPerSecond{0.0};
+        // Largest relative L2 gap of a double-precision variant (mapped back
+        // to the shuffled order) from the shuffled SparseMatrix product.
+        double      QualityErrorL2{0.0};
+        std::size_t RowCount{0};
+        std::size_t NonZeroCount{0};
+        std::size_t ShuffledBandwidth{0};
+        std::size_t RcmBandwidth{0};
+        double      RcmMilliseconds{0.0};
+        double      TransposeBuildMilliseconds{0.0};
+        double      BaselineShuffledGBPerSecond{0.0};
+        double      BaselineRcmGBPerSecond{0.0};
+        double      CompactDoubleGBPerSecond{0.0};
+        double      CompactFloatGBPerSecond{0.0};
+        double      CompactTransposeGBPerSecond{0.0};
+        double      FloatRelativeErrorL2{0.0};
+        bool        Succeeded{false};
+    };
+
+    [[nodiscard]] SparseSpMVMetrics RunSparseSpMV(const SparseSpMVCohort& cohort);
+} // namespace Intrinsic::Bench::Geometry
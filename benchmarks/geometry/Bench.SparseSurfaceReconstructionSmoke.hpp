@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace Intrinsic::Bench::Geometry
+{
+    inline constexpr const char* kSparseSurfaceReconstructionBenchmarkId = "geometry.surface_reconstruction.sparse_band";
+    inline constexpr const char* kSparseSurfaceReconstructionMethod      = "geometry.surface_reconstruction.sparse_narrow_band";
+    inline constexpr const char* kSparseSurfaceReconstructionDataset     = "builtin.fibonacci_sphere_points_100k_v1";
+
+    // One SparseNarrowBand reconstruction at a fixed resolution. Field bytes
+    // are the float scalar storage of the grid (allocated vertex slots for
+    // the sparse grid, (R + 1)^3 for the dense grid it replaces); the block
+    // hash table is not included.
+    struct SparseSurfaceReconstructionTier
+    {
+        std::size_t Resolution{0};
+        double      MedianMilliseconds{0.0};
+        std::size_t AllocatedBlockCount{0};
+        std::size_t EvaluatedVertexCount{0};
+        std::size_t SparseFieldBytes{0};
+        std::size_t DenseFieldBytes{0};
+        std::size_t OutputFaceCount{0};
+    };
+
+    // Fibonacci points on the unit sphere with exact normals, reconstructed
+    // with nearest-point distances. A dense reconstruction at
+    // ParityResolution checks that both modes mesh the same surface. The
+    // narrow-band evaluation runs on the task scheduler (initialized here
+    // when the caller has not).
+    struct SparseSurfaceReconstructionMetrics
+    {
+        double                                         RuntimeMilliseconds{0.0};
+        double                                         ThroughputItemsPerSecond{0.0};
+        double                                         QualityErrorL2{0.0};
+        std::size_t                                    PointCount{0};
+        std::size_t                                    NarrowBandCells{0};
+        std::size_t                                    ParityResolution{0};
+        double                                         DenseParityMilliseconds{0.0};
+        double                                         SparseParityMilliseconds{0.0};
+        std::array<SparseSurfaceReconstructionTier, 2> Tiers{};
+        bool                                           Succeeded{false};
+    };
+
+    [[nodiscard]] SparseSurfaceReconstructionMetrics RunSparseSurfaceReconstructionSmoke();
+} // namespace Intrinsic::Bench::Geometry
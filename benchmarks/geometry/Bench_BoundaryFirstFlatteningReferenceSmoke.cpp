@@ -1,20 +1,25 @@
 // METHOD-023 — manifest-backed Boundary First Flattening reference smoke.
+//
+// Also compares Jacobi- and AMG-preconditioned CG on the interior Dirichlet
+// Laplacian of a larger curved disk; see the header.
 
 #include "Bench.BoundaryFirstFlatteningReferenceSmoke.hpp"
 
 #include <algorithm>
-#include <array>
 #include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <limits>
 #include <string_view>
+#include <vector>
 
 #include <glm/glm.hpp>
 
+import Geometry.DEC;
 import Geometry.HalfedgeMesh;
 import Geometry.Parameterization.Bff;
 import Geometry.Properties;
+import Geometry.Sparse;
 
 namespace Intrinsic::Bench::Geometry
 {
@@ -26,38 +31,42 @@ namespace Intrinsic::Bench::Geometry
         constexpr std::size_t kExpectedFaceCount =
             2u * (kGridSideVertexCount - 1u) * (kGridSideVertexCount - 1u);
 
-        [[nodiscard]] ::Geometry::HalfedgeMesh::Mesh MakeCurvedGridDisk()
+        // Curved (side x side)-vertex grid over [-1, 1]^2; side 3 is the
+        // smoke fixture, larger sides feed the solver comparison.
+        [[nodiscard]] ::Geometry::HalfedgeMesh::Mesh MakeCurvedGridDisk(
+            const std::size_t side = kGridSideVertexCount)
         {
             using ::Geometry::VertexHandle;
 
             ::Geometry::HalfedgeMesh::Mesh mesh;
-            std::array<VertexHandle, kExpectedVertexCount> vertices{};
-            for (std::size_t row = 0u; row < kGridSideVertexCount; ++row)
+            std::vector<VertexHandle> vertices(side * side);
+            const float step = 2.0f / static_cast<float>(side - 1u);
+            for (std::size_t row = 0u; row < side; ++row)
             {
                 for (std::size_t column = 0u;
-                     column < kGridSideVertexCount;
+                     column < side;
                      ++column)
                 {
-                    const float x = -1.0f + static_cast<float>(column);
-                    const float y = -1.0f + static_cast<float>(row);
+                    const float x = -1.0f + step * static_cast<float>(column);
+                    const float y = -1.0f + step * static_cast<float>(row);
                     const float z = 0.35f * (1.0f - x * x) * (1.0f - y * y);
-                    vertices[row * kGridSideVertexCount + column] =
+                    vertices[row * side + column] =
                         mesh.AddVertex(glm::vec3{x, y, z});
                 }
             }
 
             const auto vertexAt =
-                [&vertices](const std::size_t row,
-                            const std::size_t column) -> VertexHandle
+                [&vertices, side](const std::size_t row,
+                                  const std::size_t column) -> VertexHandle
                 {
-                    return vertices[row * kGridSideVertexCount + column];
+                    return vertices[row * side + column];
                 };
             for (std::size_t row = 0u;
-                 row + 1u < kGridSideVertexCount;
+                 row + 1u < side;
                  ++row)
             {
                 for (std::size_t column = 0u;
-                     column + 1u < kGridSideVertexCount;
+                     column + 1u < side;
                      ++column)
                 {
                     const VertexHandle v00 = vertexAt(row, column);
@@ -154,6 +163,98 @@ namespace Intrinsic::Bench::Geometry
                 : std::string_view{"quality_contract_failed"};
             return tick;
         }
+
+        [[nodiscard]] double ElapsedMilliseconds(
+            const std::chrono::steady_clock::time_point t0,
+            const std::chrono::steady_clock::time_point t1)
+        {
+            return static_cast<double>(
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           t1 - t0)
+                           .count())
+                * 1.0e-6;
+        }
+
+        // Solves the interior Dirichlet cotan Laplacian of the larger curved
+        // disk (the operator BFF factors) for a smooth known solution with
+        // Jacobi- and AMG-preconditioned CG.
+        void CompareCGPreconditioners(
+            BoundaryFirstFlatteningReferenceSmokeMetrics& metrics)
+        {
+            namespace Sparse = ::Geometry::Sparse;
+
+            const ::Geometry::HalfedgeMesh::Mesh mesh = MakeCurvedGridDisk(
+                kBoundaryFirstFlatteningSolverComparisonSideVertexCount);
+            const ::Geometry::DEC::DECOperators ops =
+                ::Geometry::DEC::BuildOperators(mesh);
+
+            constexpr std::size_t kBoundary =
+                std::numeric_limits<std::size_t>::max();
+            std::vector<std::size_t> interiorIndex(mesh.VerticesSize(), kBoundary);
+            std::size_t interiorCount = 0u;
+            for (std::size_t vi = 0u; vi < mesh.VerticesSize(); ++vi)
+            {
+                const ::Geometry::VertexHandle v{
+                    static_cast<::Geometry::PropertyIndex>(vi)};
+                if (!mesh.IsBoundary(v))
+                    interiorIndex[vi] = interiorCount++;
+            }
+
+            Sparse::SparseBuilder builder(interiorCount, interiorCount);
+            std::vector<double> expected(interiorCount);
+            for (std::size_t vi = 0u; vi < mesh.VerticesSize(); ++vi)
+            {
+                const std::size_t row = interiorIndex[vi];
+                if (row == kBoundary)
+                    continue;
+                const glm::vec3 p = mesh.Position(::Geometry::VertexHandle{
+                    static_cast<::Geometry::PropertyIndex>(vi)});
+                expected[row] = std::sin(2.0 * static_cast<double>(p.x))
+                    * std::cos(3.0 * static_cast<double>(p.y));
+                for (std::size_t k = ops.Laplacian.RowOffsets[vi];
+                     k < ops.Laplacian.RowOffsets[vi + 1u];
+                     ++k)
+                {
+                    const std::size_t col =
+                        interiorIndex[ops.Laplacian.ColIndices[k]];
+                    if (col != kBoundary)
+                        builder.Add(row, col, ops.Laplacian.Values[k]);
+                }
+            }
+            const Sparse::SparseMatrix dirichlet = builder.Build().Matrix;
+            std::vector<double> rhs(interiorCount);
+            dirichlet.Multiply(expected, rhs);
+
+            Sparse::CGParams params;
+            params.MaxIterations =
+                kBoundaryFirstFlatteningSolverComparisonMaxIterations;
+            std::vector<double> x(interiorCount, 0.0);
+            const auto t0 = std::chrono::steady_clock::now();
+            const Sparse::CGResult jacobi =
+                Sparse::SolveCG(dirichlet, rhs, x, params);
+            const auto t1 = std::chrono::steady_clock::now();
+            Sparse::AMGHierarchy hierarchy;
+            const Sparse::AMGDiagnostics amgDiagnostics =
+                hierarchy.build(dirichlet);
+            const auto t2 = std::chrono::steady_clock::now();
+            params.Preconditioner = Sparse::SparsePreconditioner::AMG;
+            params.Hierarchy = &hierarchy;
+            std::fill(x.begin(), x.end(), 0.0);
+            const Sparse::CGResult amg =
+                Sparse::SolveCG(dirichlet, rhs, x, params);
+            const auto t3 = std::chrono::steady_clock::now();
+
+            metrics.SolverComparisonUnknownCount = interiorCount;
+            metrics.CGJacobiIterations = jacobi.Iterations;
+            metrics.CGAMGIterations = amg.Iterations;
+            metrics.AMGLevelCount = amgDiagnostics.LevelCount;
+            metrics.CGJacobiMilliseconds = ElapsedMilliseconds(t0, t1);
+            metrics.AMGSetupMilliseconds = ElapsedMilliseconds(t1, t2);
+            metrics.CGAMGMilliseconds = ElapsedMilliseconds(t2, t3);
+            metrics.SolverComparisonConverged = jacobi.Converged
+                && amgDiagnostics.Succeeded()
+                && amg.Converged;
+        }
     }
 
     BoundaryFirstFlatteningReferenceSmokeMetrics
@@ -250,6 +351,11 @@ namespace Intrinsic::Bench::Geometry
         metrics.EvaluatedFaceCount = minimumEvaluatedFaceCount;
         metrics.FlippedElementCount = maximumFlippedElementCount;
         metrics.FailedMeasuredIterationCount = failedMeasuredIterationCount;
+
+        // Outside the timed loop, so runtime_ms is unaffected.
+        CompareCGPreconditioners(metrics);
+        if (firstFailureReason == "none" && !metrics.SolverComparisonConverged)
+            firstFailureReason = "solver_comparison_not_converged";
         metrics.FailureReason = firstFailureReason;
         metrics.Succeeded = allMeasuredIterationsSucceeded
             && failedMeasuredIterationCount == 0u
@@ -258,7 +364,8 @@ namespace Intrinsic::Bench::Geometry
                 <= kBoundaryFirstFlatteningReferenceSmokeRuntimeMillisecondsMax
             && std::isfinite(worstQualityErrorL2)
             && worstQualityErrorL2
-                <= kBoundaryFirstFlatteningReferenceSmokeQualityErrorL2Max;
+                <= kBoundaryFirstFlatteningReferenceSmokeQualityErrorL2Max
+            && metrics.SolverComparisonConverged;
         return metrics;
     }
 }
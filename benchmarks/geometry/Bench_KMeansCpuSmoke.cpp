@@ -0,0 +1,194 @@
+#include "Bench.KMeansCpuSmoke.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+import Geometry;
+import Extrinsic.Core.Tasks;
+
+namespace Intrinsic::Bench::Geometry
+{
+    namespace
+    {
+        namespace GK = ::Geometry::KMeans;
+
+        constexpr int kWarmupIterations = 1;
+        constexpr int kMeasuredIterations = 3;
+        // The brute-force reference is serial, so the input is sized to keep
+        // it near one second of the smoke budget.
+        constexpr std::size_t kPointCount = 500'000u;
+        constexpr std::size_t kBlobCount = 24u;
+        constexpr std::uint32_t kClusterCount = 32u;
+        constexpr std::uint32_t kIterations = 15u;
+        constexpr std::uint32_t kMiniBatchSize = 4096u;
+        // Centroid sums are accumulated in a different order than the
+        // reference, so a handful of points on a bisector may flip.
+        constexpr double kMaxMismatchFraction = 1.0e-4;
+
+        [[nodiscard]] double ElapsedMilliseconds(const std::chrono::steady_clock::time_point t0,
+                                                 const std::chrono::steady_clock::time_point t1)
+        {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) *
+                1.0e-6;
+        }
+
+        [[nodiscard]] std::vector<glm::vec3> GaussianBlobs(const std::uint32_t seed)
+        {
+            std::mt19937 rng{seed};
+            std::uniform_real_distribution<float> centre{-10.0f, 10.0f};
+            std::normal_distribution<float> noise{0.0f, 1.0f};
+
+            std::vector<glm::vec3> centres(kBlobCount);
+            for (glm::vec3& c : centres)
+                c = glm::vec3{centre(rng), centre(rng), centre(rng)};
+
+            std::vector<glm::vec3> points(kPointCount);
+            for (std::size_t i = 0; i < kPointCount; ++i)
+                points[i] = centres[i % kBlobCount] + glm::vec3{noise(rng), noise(rng), noise(rng)};
+            return points;
+        }
+
+        // Serial Lloyd loop with a scalar full scan per point.
+        [[nodiscard]] std::vector<std::uint32_t> BruteForceLabels(const std::vector<glm::vec3>& points,
+                                                                  std::vector<glm::vec3> centroids)
+        {
+            std::vector<std::uint32_t> labels(points.size(), 0u);
+            std::vector<glm::vec3> sums(centroids.size());
+            std::vector<std::uint32_t> counts(centroids.size());
+            for (std::uint32_t iter = 0; iter < kIterations; ++iter)
+            {
+                std::fill(sums.begin(), sums.end(), glm::vec3(0.0f));
+                std::fill(counts.begin(), counts.end(), 0u);
+                for (std::size_t i = 0; i < points.size(); ++i)
+                {
+                    float best = std::numeric_limits<float>::infinity();
+                    for (std::uint32_t c = 0; c < static_cast<std::uint32_t>(centroids.size()); ++c)
+                    {
+                        const glm::vec3 d = points[i] - centroids[c];
+                        if (const float d2 = glm::dot(d, d); d2 < best)
+                        {
+                            best = d2;
+                            labels[i] = c;
+                        }
+                    }
+                    sums[labels[i]] += points[i];
+                    ++counts[labels[i]];
+                }
+                if (iter + 1u == kIterations)
+                    break;
+                for (std::size_t c = 0; c < centroids.size(); ++c)
+                {
+                    if (counts[c] > 0u)
+                        centroids[c] = sums[c] / static_cast<float>(counts[c]);
+                }
+            }
+            return labels;
+        }
+
+        template <typename Fn>
+        [[nodiscard]] double MedianMilliseconds(Fn&& fn)
+        {
+            for (int i = 0; i < kWarmupIterations; ++i)
+                fn();
+
+            std::array<double, kMeasuredIterations> samples{};
+            for (int i = 0; i < kMeasuredIterations; ++i)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                fn();
+                const auto t1 = std::chrono::steady_clock::now();
+                samples[static_cast<std::size_t>(i)] = ElapsedMilliseconds(t0, t1);
+            }
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2u];
+        }
+    } // namespace
+
+    KMeansCpuMetrics RunKMeansCpuSmoke()
+    {
+        namespace Tasks = Extrinsic::Core::Tasks;
+
+        KMeansCpuMetrics metrics{};
+        metrics.PointCount = kPointCount;
+        metrics.ClusterCount = kClusterCount;
+
+        const bool ownsScheduler = !Tasks::Scheduler::IsInitialized();
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Initialize();
+        }
+
+        const std::vector<glm::vec3> points = GaussianBlobs(0x5EEDu);
+        GK::KMeansParams params{};
+        params.ClusterCount = kClusterCount;
+        params.MaxIterations = kIterations;
+        params.ConvergenceTolerance = 0.0f;
+        params.Init = GK::Initialization::KMeansPlusPlus;
+        params.MiniBatchSize = kMiniBatchSize;
+
+        const std::vector<glm::vec3> seeds = GK::BuildInitialCentroids(points, {}, params, kClusterCount);
+        const auto t0 = std::chrono::steady_clock::now();
+        const std::vector<std::uint32_t> reference = BruteForceLabels(points, seeds);
+        const auto t1 = std::chrono::steady_clock::now();
+        metrics.BruteForceMilliseconds = ElapsedMilliseconds(t0, t1);
+
+        bool ok = true;
+        std::optional<GK::KMeansResult> exact;
+        metrics.ExactMedianMilliseconds = MedianMilliseconds([&]
+        {
+            exact = GK::Cluster(points, params);
+            ok = exact.has_value() && ok;
+        });
+
+        std::optional<GK::KMeansResult> miniBatch;
+        params.Update = GK::UpdateMode::MiniBatch;
+        metrics.MiniBatchMedianMilliseconds = MedianMilliseconds([&]
+        {
+            miniBatch = GK::Cluster(points, params);
+            ok = miniBatch.has_value() && ok;
+        });
+
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Shutdown();
+        }
+
+        if (exact.has_value())
+        {
+            metrics.Iterations = exact->Iterations;
+            ok = exact->Iterations == kIterations && exact->Labels.size() == reference.size() && ok;
+            for (std::size_t i = 0; i < std::min(exact->Labels.size(), reference.size()); ++i)
+            {
+                if (exact->Labels[i] != reference[i])
+                    ++metrics.LabelMismatches;
+            }
+            metrics.DistanceEvaluationFraction = static_cast<double>(exact->DistanceEvaluations) /
+                (static_cast<double>(kPointCount) * kClusterCount * kIterations);
+            if (miniBatch.has_value() && exact->Inertia > 0.0f)
+                metrics.MiniBatchInertiaRatio = static_cast<double>(miniBatch->Inertia / exact->Inertia);
+        }
+
+        const double mismatchFraction =
+            static_cast<double>(metrics.LabelMismatches) / static_cast<double>(kPointCount);
+        metrics.RuntimeMilliseconds = metrics.ExactMedianMilliseconds;
+        metrics.ThroughputItemsPerSecond = metrics.ExactMedianMilliseconds > 0.0
+            ? static_cast<double>(kPointCount) * kIterations / (metrics.ExactMedianMilliseconds * 1.0e-3)
+            : 0.0;
+        metrics.ExactSpeedup = metrics.ExactMedianMilliseconds > 0.0
+            ? metrics.BruteForceMilliseconds / metrics.ExactMedianMilliseconds
+            : 0.0;
+        metrics.QualityErrorL2 = mismatchFraction;
+        metrics.Succeeded = ok && mismatchFraction <= kMaxMismatchFraction;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Geometry
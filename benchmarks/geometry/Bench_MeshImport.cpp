@@ -0,0 +1,340 @@
+#include "Bench.MeshImport.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+import Geometry;
+import Extrinsic.Core.Tasks;
+
+namespace Intrinsic::Bench::Geometry
+{
+    namespace
+    {
+        namespace MeshIO = ::Geometry::MeshIO;
+
+        constexpr int kWarmupIterations = 1;
+        constexpr int kMeasuredIterations = 3;
+        // 2 * 707^2 = 999,698 triangles on 501,264 vertices.
+        constexpr std::uint32_t kGridSide = 708u;
+        constexpr std::size_t kVertexCount = std::size_t{kGridSide} * kGridSide;
+        constexpr std::size_t kTriangleCount = std::size_t{2} * (kGridSide - 1u) * (kGridSide - 1u);
+
+        [[nodiscard]] double ElapsedMilliseconds(const std::chrono::steady_clock::time_point t0,
+                                                 const std::chrono::steady_clock::time_point t1)
+        {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) *
+                1.0e-6;
+        }
+
+        template <typename Fn>
+        [[nodiscard]] double Milliseconds(Fn&& fn)
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+            fn();
+            const auto t1 = std::chrono::steady_clock::now();
+            return ElapsedMilliseconds(t0, t1);
+        }
+
+        template <typename Fn>
+        [[nodiscard]] double MedianMilliseconds(Fn&& fn)
+        {
+            for (int i = 0; i < kWarmupIterations; ++i)
+                fn();
+
+            std::array<double, kMeasuredIterations> samples{};
+            for (double& sample : samples)
+                sample = Milliseconds(fn);
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2u];
+        }
+
+        [[nodiscard]] glm::vec3 GridPosition(const std::uint32_t x, const std::uint32_t y)
+        {
+            const float fx = static_cast<float>(x) * 0.01f;
+            const float fy = static_cast<float>(y) * 0.01f;
+            return {fx, fy, 0.1f * std::sin(3.0f * fx) * std::cos(2.0f * fy)};
+        }
+
+        // Quads split along the same diagonal, wound counter-clockwise.
+        template <typename Fn>
+        void ForEachGridTriangle(Fn&& fn)
+        {
+            for (std::uint32_t y = 0; y + 1u < kGridSide; ++y)
+            {
+                for (std::uint32_t x = 0; x + 1u < kGridSide; ++x)
+                {
+                    const std::uint32_t v0 = y * kGridSide + x;
+                    fn(v0, v0 + 1u, v0 + kGridSide + 1u);
+                    fn(v0, v0 + kGridSide + 1u, v0 + kGridSide);
+                }
+            }
+        }
+
+        template <typename T>
+        void WritePod(std::ofstream& out, const T& value)
+        {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        [[nodiscard]] bool WriteMeshFiles(const std::string& objPath,
+                                          const std::string& plyPath,
+                                          const std::string& stlPath)
+        {
+            std::vector<glm::vec3> positions;
+            positions.reserve(kVertexCount);
+            for (std::uint32_t y = 0; y < kGridSide; ++y)
+                for (std::uint32_t x = 0; x < kGridSide; ++x)
+                    positions.push_back(GridPosition(x, y));
+
+            std::ofstream obj(objPath, std::ios::binary | std::ios::trunc);
+            std::array<char, 96> line{};
+            for (const glm::vec3& p : positions)
+            {
+                const int length = std::snprintf(line.data(), line.size(), "v %.6f %.6f %.6f\n", p.x, p.y, p.z);
+                obj.write(line.data(), length);
+            }
+            ForEachGridTriangle([&](const std::uint32_t a, const std::uint32_t b, const std::uint32_t c)
+            {
+                const int length = std::snprintf(line.data(), line.size(), "f %u %u %u\n", a + 1u, b + 1u, c + 1u);
+                obj.write(line.data(), length);
+            });
+
+            std::ofstream ply(plyPath, std::ios::binary | std::ios::trunc);
+            ply << "ply\nformat binary_little_endian 1.0\nelement vertex " << kVertexCount
+                << "\nproperty float x\nproperty float y\nproperty float z\nelement face " << kTriangleCount
+                << "\nproperty list uchar int vertex_indices\nend_header\n";
+            for (const glm::vec3& p : positions)
+            {
+                WritePod(ply, p.x);
+                WritePod(ply, p.y);
+                WritePod(ply, p.z);
+            }
+            ForEachGridTriangle([&](const std::uint32_t a, const std::uint32_t b, const std::uint32_t c)
+            {
+                WritePod(ply, std::uint8_t{3});
+                for (const std::uint32_t v : {a, b, c})
+                    WritePod(ply, static_cast<std::int32_t>(v));
+            });
+
+            std::ofstream stl(stlPath, std::ios::binary | std::ios::trunc);
+            const std::array<char, 80> header{};
+            stl.write(header.data(), static_cast<std::streamsize>(header.size()));
+            WritePod(stl, static_cast<std::uint32_t>(kTriangleCount));
+            ForEachGridTriangle([&](const std::uint32_t a, const std::uint32_t b, const std::uint32_t c)
+            {
+                for (int i = 0; i < 3; ++i)
+                    WritePod(stl, 0.0f);
+                for (const std::uint32_t v : {a, b, c})
+                {
+                    WritePod(stl, positions[v].x);
+                    WritePod(stl, positions[v].y);
+                    WritePod(stl, positions[v].z);
+                }
+                WritePod(stl, std::uint16_t{0});
+            });
+
+            return obj.good() && ply.good() && stl.good();
+        }
+
+        // L2 position gap between two loads of the same file; topology must
+        // match exactly.
+        [[nodiscard]] double LoadErrorL2(const MeshIO::MeshIOResult& value, const MeshIO::MeshIOResult& reference)
+        {
+            const auto positions = value.Vertices.Get<glm::vec3>("v:point");
+            const auto referencePositions = reference.Vertices.Get<glm::vec3>("v:point");
+            const auto faces = value.Faces.Get<std::vector<std::uint32_t>>("f:vertices");
+            const auto referenceFaces = reference.Faces.Get<std::vector<std::uint32_t>>("f:vertices");
+            if (!positions.IsValid() || !referencePositions.IsValid() || !faces.IsValid() ||
+                !referenceFaces.IsValid() || positions.Vector().size() != referencePositions.Vector().size() ||
+                faces.Vector() != referenceFaces.Vector())
+                return 1.0e30;
+
+            double sum = 0.0;
+            for (std::size_t i = 0; i < positions.Vector().size(); ++i)
+            {
+                const glm::vec3 d = positions.Vector()[i] - referencePositions.Vector()[i];
+                sum += static_cast<double>(d.x) * d.x + static_cast<double>(d.y) * d.y + static_cast<double>(d.z) * d.z;
+            }
+            return std::sqrt(sum);
+        }
+
+        [[nodiscard]] bool BuildIncrementally(const MeshIO::MeshIOResult& load, ::Geometry::HalfedgeMesh::Mesh& mesh)
+        {
+            mesh.Clear();
+            for (const glm::vec3& p : load.Vertices.Get<glm::vec3>("v:point").Vector())
+                (void)mesh.AddVertex(p);
+            std::vector<::Geometry::VertexHandle> corners;
+            for (const auto& face : load.Faces.Get<std::vector<std::uint32_t>>("f:vertices").Vector())
+            {
+                corners.clear();
+                for (const std::uint32_t v : face)
+                    corners.push_back(::Geometry::VertexHandle{v});
+                if (!mesh.AddFace(corners))
+                    return false;
+            }
+            return true;
+        }
+
+        [[nodiscard]] bool BuildInBulk(const MeshIO::MeshIOResult& load, ::Geometry::HalfedgeMesh::Mesh& mesh)
+        {
+            const auto& faces = load.Faces.Get<std::vector<std::uint32_t>>("f:vertices").Vector();
+            std::vector<std::size_t> offsets;
+            offsets.reserve(faces.size() + 1u);
+            offsets.push_back(0u);
+            std::vector<std::uint32_t> indices;
+            indices.reserve(faces.size() * 3u);
+            for (const auto& face : faces)
+            {
+                indices.insert(indices.end(), face.begin(), face.end());
+                offsets.push_back(indices.size());
+            }
+            return mesh.BuildFromPolygons(load.Vertices.Get<glm::vec3>("v:point").Vector(), offsets, indices);
+        }
+
+        // Both builders number halfedges, edges and faces the same way.
+        [[nodiscard]] bool SameConnectivity(const ::Geometry::HalfedgeMesh::Mesh& value,
+                                            const ::Geometry::HalfedgeMesh::Mesh& reference)
+        {
+            if (value.VertexCount() != reference.VertexCount() || value.EdgeCount() != reference.EdgeCount() ||
+                value.FaceCount() != reference.FaceCount())
+                return false;
+            for (std::uint32_t h = 0; h < value.HalfedgesSize(); ++h)
+            {
+                const ::Geometry::HalfedgeHandle he{h};
+                if (value.ToVertex(he) != reference.ToVertex(he) || value.Face(he) != reference.Face(he))
+                    return false;
+            }
+            return true;
+        }
+
+        struct FormatTiming
+        {
+            double SerialMilliseconds{0.0};
+            double ParallelMilliseconds{0.0};
+            double ErrorL2{1.0e30};
+            std::optional<MeshIO::MeshIOResult> Parallel{};
+        };
+    } // namespace
+
+    MeshImportMetrics RunMeshImport()
+    {
+        namespace Tasks = Extrinsic::Core::Tasks;
+
+        MeshImportMetrics metrics{};
+        metrics.VertexCount = kVertexCount;
+        metrics.TriangleCount = kTriangleCount;
+
+        std::error_code ec;
+        const std::filesystem::path directory =
+            std::filesystem::temp_directory_path(ec) / "intrinsic_mesh_import_bench";
+        std::filesystem::create_directories(directory, ec);
+        const std::string objPath = (directory / "grid.obj").string();
+        const std::string plyPath = (directory / "grid.ply").string();
+        const std::string stlPath = (directory / "grid.stl").string();
+        bool ok = WriteMeshFiles(objPath, plyPath, stlPath);
+        metrics.ObjFileBytes = static_cast<std::size_t>(std::filesystem::file_size(objPath, ec));
+        metrics.PlyFileBytes = static_cast<std::size_t>(std::filesystem::file_size(plyPath, ec));
+        metrics.StlFileBytes = static_cast<std::size_t>(std::filesystem::file_size(stlPath, ec));
+
+        const MeshIO::MeshLoadOptions stlOptions{.WeldSTLVertices = true};
+        const auto loadObj = [&] { return MeshIO::LoadOBJ(objPath); };
+        const auto loadPly = [&] { return MeshIO::LoadPLY(plyPath); };
+        const auto loadStl = [&] { return MeshIO::LoadSTL(stlPath, stlOptions); };
+
+        // The serial loads and the AddFace build run before this benchmark
+        // initializes the scheduler, so they are serial unless the caller
+        // already owns one.
+        const auto serialLoad = [&](auto&& load)
+        {
+            std::optional<MeshIO::MeshIOResult> result;
+            const double ms = Milliseconds([&]
+            {
+                if (auto loaded = load())
+                    result = std::move(*loaded);
+            });
+            return std::pair{std::move(result), ms};
+        };
+        auto [objSerial, objSerialMs] = serialLoad(loadObj);
+        auto [plySerial, plySerialMs] = serialLoad(loadPly);
+        auto [stlSerial, stlSerialMs] = serialLoad(loadStl);
+        ok = objSerial.has_value() && plySerial.has_value() && stlSerial.has_value() && ok;
+        ok = stlSerial.has_value() && stlSerial->Vertices.Size() == kVertexCount && ok;
+
+        ::Geometry::HalfedgeMesh::Mesh incremental;
+        if (objSerial.has_value())
+        {
+            metrics.AddFaceBuildMilliseconds = Milliseconds([&] { ok = BuildIncrementally(*objSerial, incremental) && ok; });
+        }
+
+        const bool ownsScheduler = !Tasks::Scheduler::IsInitialized();
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Initialize();
+        }
+
+        const auto parallelLoad = [&](auto&& load, const std::optional<MeshIO::MeshIOResult>& serial)
+        {
+            FormatTiming timing{};
+            timing.ParallelMilliseconds = MedianMilliseconds([&]
+            {
+                timing.Parallel.reset();
+                if (auto loaded = load())
+                    timing.Parallel = std::move(*loaded);
+            });
+            if (serial.has_value() && timing.Parallel.has_value())
+                timing.ErrorL2 = LoadErrorL2(*timing.Parallel, *serial);
+            return timing;
+        };
+        const FormatTiming obj = parallelLoad(loadObj, objSerial);
+        const FormatTiming ply = parallelLoad(loadPly, plySerial);
+        const FormatTiming stl = parallelLoad(loadStl, stlSerial);
+
+        ::Geometry::HalfedgeMesh::Mesh bulk;
+        if (obj.Parallel.has_value())
+        {
+            metrics.BulkBuildMilliseconds = MedianMilliseconds([&] { ok = BuildInBulk(*obj.Parallel, bulk) && ok; });
+            ok = SameConnectivity(bulk, incremental) && ok;
+        }
+        else
+        {
+            ok = false;
+        }
+
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Shutdown();
+        }
+        std::filesystem::remove_all(directory, ec);
+
+        metrics.ObjSerialMilliseconds = objSerialMs;
+        metrics.ObjParallelMilliseconds = obj.ParallelMilliseconds;
+        metrics.PlySerialMilliseconds = plySerialMs;
+        metrics.PlyParallelMilliseconds = ply.ParallelMilliseconds;
+        metrics.StlSerialMilliseconds = stlSerialMs;
+        metrics.StlParallelMilliseconds = stl.ParallelMilliseconds;
+        metrics.QualityErrorL2 = obj.ErrorL2 + ply.ErrorL2 + stl.ErrorL2;
+        metrics.RuntimeMilliseconds = metrics.ObjParallelMilliseconds + metrics.BulkBuildMilliseconds;
+        metrics.Speedup = metrics.RuntimeMilliseconds > 0.0
+            ? (metrics.ObjSerialMilliseconds + metrics.AddFaceBuildMilliseconds) / metrics.RuntimeMilliseconds
+            : 0.0;
+        metrics.ThroughputItemsPerSecond = metrics.RuntimeMilliseconds > 0.0
+            ? static_cast<double>(kTriangleCount) / (metrics.RuntimeMilliseconds * 1.0e-3)
+            : 0.0;
+        metrics.Succeeded = ok && metrics.QualityErrorL2 == 0.0;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Geometry
@@ -0,0 +1,312 @@
+#include "Bench.PointCloudAsciiLoad.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+import Geometry;
+import Extrinsic.Core.IOBackend;
+import Extrinsic.Core.Tasks;
+
+namespace Intrinsic::Bench::Geometry
+{
+    namespace
+    {
+        namespace IO = Extrinsic::Core::IO;
+        namespace PointCloudIO = ::Geometry::PointCloudIO;
+
+        constexpr int kWarmupIterations = 1;
+        constexpr int kMeasuredIterations = 3;
+        // Scans of interest run to hundreds of millions of lines; 1M keeps
+        // the per-line reference inside the smoke runner's budget.
+        constexpr std::size_t kPointCount = 1'000'000u;
+        constexpr std::uint32_t kSeed = 0xA5C11u;
+
+        [[nodiscard]] double ElapsedMilliseconds(const std::chrono::steady_clock::time_point t0,
+                                                 const std::chrono::steady_clock::time_point t1)
+        {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) *
+                1.0e-6;
+        }
+
+        template <typename Fn>
+        [[nodiscard]] double MedianMilliseconds(Fn&& fn)
+        {
+            for (int i = 0; i < kWarmupIterations; ++i)
+                fn();
+
+            std::array<double, kMeasuredIterations> samples{};
+            for (double& sample : samples)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                fn();
+                const auto t1 = std::chrono::steady_clock::now();
+                sample = ElapsedMilliseconds(t0, t1);
+            }
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2u];
+        }
+
+        [[nodiscard]] double MBPerSecond(const std::size_t bytes, const double milliseconds)
+        {
+            return milliseconds > 0.0 ? static_cast<double>(bytes) / (milliseconds * 1.0e3) : 0.0;
+        }
+
+        // Points on a noisy 200 m terrain patch with 8-bit colors, as a
+        // terrestrial scanner exports them.
+        [[nodiscard]] bool WriteScanFiles(const std::string& xyzPath, const std::string& csvPath)
+        {
+            std::mt19937 rng{kSeed};
+            std::uniform_real_distribution<float> planar(-100.0f, 100.0f);
+            std::normal_distribution<float> noise(0.0f, 0.05f);
+            std::uniform_int_distribution<int> channel(0, 255);
+
+            std::ofstream xyz(xyzPath, std::ios::binary | std::ios::trunc);
+            std::ofstream csv(csvPath, std::ios::binary | std::ios::trunc);
+            std::array<char, 160> line{};
+            for (std::size_t i = 0; i < kPointCount; ++i)
+            {
+                const float x = planar(rng);
+                const float y = planar(rng);
+                const float z = 0.1f * std::sin(0.05f * x) * std::cos(0.05f * y) + noise(rng);
+                int length = std::snprintf(line.data(), line.size(), "%.6f %.6f %.6f %d %d %d\n",
+                                           x, y, z, channel(rng), channel(rng), channel(rng));
+                xyz.write(line.data(), length);
+                length = std::snprintf(line.data(), line.size(), "%.6f,%.6f,%.6f,%.6f,%.6f,%.6f\n",
+                                       x, y, z, 0.0f, 0.0f, 1.0f);
+                csv.write(line.data(), length);
+            }
+            return xyz.good() && csv.good();
+        }
+
+        // The XYZ reader as it stood before chunked parsing; the MB/s
+        // reference.
+        namespace Reference
+        {
+            [[nodiscard]] std::string_view Trim(std::string_view text)
+            {
+                while (!text.empty() && (text.front() == ' ' || text.front() == '\t' || text.front() == '\r' ||
+                                         text.front() == '\n'))
+                    text.remove_prefix(1);
+                while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r' ||
+                                         text.back() == '\n'))
+                    text.remove_suffix(1);
+                return text;
+            }
+
+            [[nodiscard]] std::vector<std::string_view> SplitWhitespace(std::string_view line)
+            {
+                std::vector<std::string_view> tokens;
+                std::size_t cursor = 0;
+                while (cursor < line.size())
+                {
+                    while (cursor < line.size() && (line[cursor] == ' ' || line[cursor] == '\t' || line[cursor] == '\r'))
+                        ++cursor;
+                    const std::size_t start = cursor;
+                    while (cursor < line.size() && line[cursor] != ' ' && line[cursor] != '\t' && line[cursor] != '\r')
+                        ++cursor;
+                    if (start < cursor)
+                        tokens.emplace_back(line.substr(start, cursor - start));
+                }
+                return tokens;
+            }
+
+            [[nodiscard]] std::optional<float> ParseFloat(const std::string_view token)
+            {
+                float value{};
+                const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+                if (ec != std::errc{} || ptr != token.data() + token.size())
+                    return std::nullopt;
+                return value;
+            }
+
+            [[nodiscard]] float NormalizeChannel(const float value)
+            {
+                return value > 1.0f ? std::clamp(value / 255.0f, 0.0f, 1.0f) : std::clamp(value, 0.0f, 1.0f);
+            }
+
+            [[nodiscard]] std::optional<glm::vec4> ParseRgb(std::span<const std::string_view> tokens,
+                                                            const std::size_t offset)
+            {
+                const auto r = ParseFloat(tokens[offset]);
+                const auto g = ParseFloat(tokens[offset + 1]);
+                const auto b = ParseFloat(tokens[offset + 2]);
+                if (!r || !g || !b || !std::isfinite(*r) || !std::isfinite(*g) || !std::isfinite(*b))
+                    return std::nullopt;
+                return glm::vec4(NormalizeChannel(*r), NormalizeChannel(*g), NormalizeChannel(*b), 1.0f);
+            }
+
+            [[nodiscard]] std::optional<::Geometry::PointCloud::Cloud> LoadXYZ(const std::string& path)
+            {
+                std::ifstream file(path, std::ios::binary);
+                std::ostringstream buffer;
+                buffer << file.rdbuf();
+                const std::string text = buffer.str();
+
+                ::Geometry::PointCloud::Cloud cloud;
+                std::size_t cursor = 0;
+                while (cursor < text.size())
+                {
+                    const std::size_t end = std::min(text.find('\n', cursor), text.size());
+                    std::string_view line = Trim(std::string_view(text).substr(cursor, end - cursor));
+                    cursor = end + 1u;
+                    if (const auto comment = line.find('#'); comment != std::string_view::npos)
+                        line = Trim(line.substr(0, comment));
+
+                    const auto tokens = SplitWhitespace(line);
+                    if (tokens.size() < 3)
+                        continue;
+                    const auto x = ParseFloat(tokens[0]);
+                    const auto y = ParseFloat(tokens[1]);
+                    const auto z = ParseFloat(tokens[2]);
+                    if (!x || !y || !z)
+                        continue;
+                    const glm::vec3 position(*x, *y, *z);
+                    if (!std::isfinite(position.x) || !std::isfinite(position.y) || !std::isfinite(position.z))
+                        return std::nullopt;
+                    for (std::size_t i = 3; i < tokens.size(); ++i)
+                    {
+                        if (const auto attribute = ParseFloat(tokens[i]); attribute && !std::isfinite(*attribute))
+                            return std::nullopt;
+                    }
+
+                    std::optional<glm::vec4> color;
+                    if (tokens.size() >= 7)
+                        color = ParseRgb(tokens, tokens.size() - 3);
+                    if (!color && tokens.size() >= 6)
+                        color = ParseRgb(tokens, 3);
+                    if (color && !cloud.HasColors())
+                        cloud.EnableColors(glm::vec4(1.0f));
+                    const auto point = cloud.AddPoint(position);
+                    if (color)
+                        cloud.Color(point) = *color;
+                }
+                if (cloud.IsEmpty())
+                    return std::nullopt;
+                return cloud;
+            }
+        } // namespace Reference
+
+        [[nodiscard]] double CloudErrorL2(const ::Geometry::PointCloud::Cloud& value,
+                                          const ::Geometry::PointCloud::Cloud& reference)
+        {
+            if (value.VerticesSize() != reference.VerticesSize() || value.HasColors() != reference.HasColors())
+                return 1.0e30;
+            const auto positions = value.Positions();
+            const auto referencePositions = reference.Positions();
+            double sum = 0.0;
+            for (std::size_t i = 0; i < positions.size(); ++i)
+            {
+                const glm::vec3 d = positions[i] - referencePositions[i];
+                sum += static_cast<double>(d.x) * d.x + static_cast<double>(d.y) * d.y + static_cast<double>(d.z) * d.z;
+            }
+            if (value.HasColors())
+            {
+                const auto colors = value.Colors();
+                const auto referenceColors = reference.Colors();
+                for (std::size_t i = 0; i < colors.size(); ++i)
+                {
+                    const glm::vec4 d = colors[i] - referenceColors[i];
+                    sum += static_cast<double>(d.r) * d.r + static_cast<double>(d.g) * d.g +
+                        static_cast<double>(d.b) * d.b + static_cast<double>(d.a) * d.a;
+                }
+            }
+            return std::sqrt(sum);
+        }
+    } // namespace
+
+    PointCloudAsciiLoadMetrics RunPointCloudAsciiLoad()
+    {
+        namespace Tasks = Extrinsic::Core::Tasks;
+
+        PointCloudAsciiLoadMetrics metrics{};
+        metrics.PointCount = kPointCount;
+
+        const bool ownsScheduler = !Tasks::Scheduler::IsInitialized();
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Initialize();
+        }
+
+        std::error_code ec;
+        const std::filesystem::path directory =
+            std::filesystem::temp_directory_path(ec) / "intrinsic_point_cloud_ascii_load_bench";
+        std::filesystem::create_directories(directory, ec);
+        const std::string xyzPath = (directory / "scan.xyz").string();
+        const std::string csvPath = (directory / "scan.csv").string();
+        bool ok = WriteScanFiles(xyzPath, csvPath);
+        metrics.XyzFileBytes = static_cast<std::size_t>(std::filesystem::file_size(xyzPath, ec));
+        metrics.CsvFileBytes = static_cast<std::size_t>(std::filesystem::file_size(csvPath, ec));
+
+        std::optional<::Geometry::PointCloud::Cloud> reference;
+        const double referenceMs = MedianMilliseconds([&] { reference = Reference::LoadXYZ(xyzPath); });
+        ok = reference.has_value() && reference->VerticesSize() == kPointCount && ok;
+
+        bool pathOk = true;
+        const double pathMs = MedianMilliseconds([&]
+        {
+            const auto result = PointCloudIO::LoadXYZ(xyzPath);
+            pathOk = result.has_value() && result->Cloud.VerticesSize() == kPointCount && pathOk;
+        });
+
+        IO::MmapIOBackend backend;
+        PointCloudIO::AsciiLoadDiagnostics diagnostics;
+        std::optional<::Geometry::PointCloud::Cloud> mapped;
+        const double mmapMs = MedianMilliseconds([&]
+        {
+            auto result = PointCloudIO::LoadXYZ(xyzPath, backend, {}, &diagnostics);
+            mapped.reset();
+            if (result.has_value())
+                mapped = std::move(result->Cloud);
+        });
+        ok = mapped.has_value() && pathOk && ok;
+        metrics.ChunkCount = diagnostics.ChunkCount;
+
+        bool csvOk = true;
+        const double csvMs = MedianMilliseconds([&]
+        {
+            const auto result = PointCloudIO::LoadCSV(csvPath, backend);
+            csvOk = result.has_value() && result->Cloud.VerticesSize() == kPointCount && result->Cloud.HasNormals() &&
+                csvOk;
+        });
+        ok = csvOk && ok;
+
+        metrics.QualityErrorL2 = reference.has_value() && mapped.has_value()
+            ? CloudErrorL2(*mapped, *reference)
+            : 1.0e30;
+
+        std::filesystem::remove_all(directory, ec);
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Shutdown();
+        }
+
+        metrics.ReferenceMBPerSecond = MBPerSecond(metrics.XyzFileBytes, referenceMs);
+        metrics.PathMBPerSecond = MBPerSecond(metrics.XyzFileBytes, pathMs);
+        metrics.MmapMBPerSecond = MBPerSecond(metrics.XyzFileBytes, mmapMs);
+        metrics.CsvMmapMBPerSecond = MBPerSecond(metrics.CsvFileBytes, csvMs);
+        metrics.Speedup = mmapMs > 0.0 ? referenceMs / mmapMs : 0.0;
+        metrics.RuntimeMilliseconds = mmapMs;
+        metrics.ThroughputItemsPerSecond = mmapMs > 0.0 ? static_cast<double>(kPointCount) / (mmapMs * 1.0e-3) : 0.0;
+        metrics.Succeeded = ok && metrics.QualityErrorL2 == 0.0;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Geometry
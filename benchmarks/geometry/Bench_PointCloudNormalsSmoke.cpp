@@ -0,0 +1,157 @@
+#include "Bench.PointCloudNormalsSmoke.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+import Geometry;
+import Extrinsic.Core.Tasks;
+
+namespace Intrinsic::Bench::Geometry
+{
+    namespace
+    {
+        namespace PointNormals = ::Geometry::PointCloud::Normals;
+
+        constexpr int kWarmupIterations = 1;
+        constexpr int kMeasuredIterations = 3;
+        constexpr std::array<std::size_t, 2> kTierPointCounts{1'000'000u, 10'000'000u};
+        // The smoke runner shares a two-minute budget and the serial
+        // reference alone takes tens of seconds at 10M points, so the large
+        // tier is off by default; enable it to reproduce scan-sized runs.
+        constexpr bool kRunLargeTier = false;
+        constexpr std::size_t kNeighborCount = 12u;
+        constexpr float kRadialNoise = 0.002f;
+        constexpr double kMaxInwardFraction = 0.01;
+
+        [[nodiscard]] double ElapsedMilliseconds(const std::chrono::steady_clock::time_point t0,
+                                                 const std::chrono::steady_clock::time_point t1)
+        {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) *
+                1.0e-6;
+        }
+
+        [[nodiscard]] std::vector<glm::vec3> NoisySphere(const std::size_t count, const std::uint32_t seed)
+        {
+            std::mt19937 rng{seed};
+            std::normal_distribution<float> dist{0.0f, 1.0f};
+            std::vector<glm::vec3> points(count);
+            for (glm::vec3& p : points)
+            {
+                glm::vec3 d{dist(rng), dist(rng), dist(rng)};
+                while (glm::dot(d, d) < 1.0e-6f)
+                    d = glm::vec3{dist(rng), dist(rng), dist(rng)};
+                p = glm::normalize(d) * (1.0f + kRadialNoise * dist(rng));
+            }
+            return points;
+        }
+
+        [[nodiscard]] PointNormals::Params BenchParams()
+        {
+            PointNormals::Params params{};
+            params.KNeighbors = kNeighborCount;
+            params.Orientation = PointNormals::OrientationMode::MinimumSpanningTree;
+            return params;
+        }
+
+        template <typename Fn>
+        [[nodiscard]] double MedianMilliseconds(Fn&& fn)
+        {
+            for (int i = 0; i < kWarmupIterations; ++i)
+                fn();
+
+            std::array<double, kMeasuredIterations> samples{};
+            for (int i = 0; i < kMeasuredIterations; ++i)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                fn();
+                const auto t1 = std::chrono::steady_clock::now();
+                samples[static_cast<std::size_t>(i)] = ElapsedMilliseconds(t0, t1);
+            }
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2u];
+        }
+    } // namespace
+
+    PointCloudNormalsMetrics RunPointCloudNormalsSmoke()
+    {
+        namespace Tasks = Extrinsic::Core::Tasks;
+
+        PointCloudNormalsMetrics metrics{};
+        const PointNormals::Params params = BenchParams();
+        const bool ownsScheduler = !Tasks::Scheduler::IsInitialized();
+
+        bool ok = true;
+        for (std::size_t t = 0; t < kTierPointCounts.size(); ++t)
+        {
+            if (t > 0u && !kRunLargeTier)
+                break;
+
+            PointCloudNormalsTier& tier = metrics.Tiers[t];
+            tier.PointCount = kTierPointCounts[t];
+            const std::vector<glm::vec3> points = NoisySphere(tier.PointCount, 0x5EEDu + static_cast<std::uint32_t>(t));
+
+            // The reference runs before this benchmark initializes the
+            // scheduler, so it is serial unless the caller already owns one.
+            const auto t0 = std::chrono::steady_clock::now();
+            const auto serial = PointNormals::Estimate(points, params);
+            const auto t1 = std::chrono::steady_clock::now();
+            tier.SerialMilliseconds = ElapsedMilliseconds(t0, t1);
+
+            if (ownsScheduler)
+                Tasks::Scheduler::Initialize();
+
+            std::optional<PointNormals::EstimateResult> parallel;
+            tier.ParallelMedianMilliseconds = MedianMilliseconds([&]
+            {
+                parallel = PointNormals::Estimate(points, params);
+                ok = parallel.has_value() && ok;
+            });
+
+            if (ownsScheduler)
+                Tasks::Scheduler::Shutdown();
+
+            ok = serial.has_value() && ok;
+            if (!serial.has_value() || !parallel.has_value())
+                continue;
+
+            tier.OrientationCellCount = parallel->Diagnostics.OrientationCellCount;
+            tier.OrientationMergeRoundCount = parallel->Diagnostics.OrientationMergeRoundCount;
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                if (glm::dot(points[i], parallel->Normals[i]) <= 0.0f)
+                    ++tier.InwardNormalCount;
+                if (parallel->Normals[i] != serial->Normals[i])
+                    ++tier.NormalMismatchCount;
+            }
+            ok = tier.NormalMismatchCount == 0u && parallel->Diagnostics.OrientationComponentCount == 1u && ok;
+        }
+
+        const PointCloudNormalsTier& primary = metrics.Tiers[0];
+        metrics.RuntimeMilliseconds = primary.ParallelMedianMilliseconds;
+        metrics.ThroughputItemsPerSecond = primary.ParallelMedianMilliseconds > 0.0
+            ? static_cast<double>(primary.PointCount) / (primary.ParallelMedianMilliseconds * 1.0e-3)
+            : 0.0;
+        metrics.ParallelSpeedup = primary.ParallelMedianMilliseconds > 0.0
+            ? primary.SerialMilliseconds / primary.ParallelMedianMilliseconds
+            : 0.0;
+
+        double worstInward = 0.0;
+        for (const PointCloudNormalsTier& tier : metrics.Tiers)
+        {
+            if (tier.PointCount > 0u)
+                worstInward = std::max(worstInward,
+                                       static_cast<double>(tier.InwardNormalCount) / static_cast<double>(tier.PointCount));
+        }
+        metrics.QualityErrorL2 = worstInward;
+        metrics.Succeeded = ok && worstInward <= kMaxInwardFraction;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Geometry
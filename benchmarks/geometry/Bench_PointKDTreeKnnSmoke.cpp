@@ -0,0 +1,156 @@
+#include "Bench.PointKDTreeKnnSmoke.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+import Geometry;
+import Extrinsic.Core.Tasks;
+
+namespace Intrinsic::Bench::Geometry
+{
+    namespace
+    {
+        constexpr int kWarmupIterations = 1;
+        constexpr int kMeasuredIterations = 3;
+        // The smoke runner shares a two-minute budget, so the cloud is sized
+        // at 1M points; raise this to 10'000'000 to reproduce the larger
+        // comparison.
+        constexpr std::size_t kPointCount = 1'000'000u;
+        constexpr std::size_t kQueryCount = 16'384u;
+        constexpr std::array<std::uint32_t, 3> kNeighbourCounts{8u, 16u, 32u};
+
+        [[nodiscard]] double ElapsedMilliseconds(const std::chrono::steady_clock::time_point t0,
+                                                 const std::chrono::steady_clock::time_point t1)
+        {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) *
+                1.0e-6;
+        }
+
+        [[nodiscard]] std::vector<glm::vec3> UniformPoints(const std::size_t count, const std::uint32_t seed)
+        {
+            std::mt19937 rng{seed};
+            std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+            std::vector<glm::vec3> points(count);
+            for (glm::vec3& p : points)
+                p = glm::vec3{dist(rng), dist(rng), dist(rng)};
+            return points;
+        }
+
+        template <typename Fn>
+        [[nodiscard]] double MedianMilliseconds(Fn&& fn)
+        {
+            for (int i = 0; i < kWarmupIterations; ++i)
+                fn();
+
+            std::array<double, kMeasuredIterations> samples{};
+            for (int i = 0; i < kMeasuredIterations; ++i)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                fn();
+                const auto t1 = std::chrono::steady_clock::now();
+                samples[static_cast<std::size_t>(i)] = ElapsedMilliseconds(t0, t1);
+            }
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2u];
+        }
+
+        [[nodiscard]] PointKDTreeKnnTier RunTier(const ::Geometry::KDTree& reference,
+                                                 const ::Geometry::PointKDTree& tree,
+                                                 const std::vector<glm::vec3>& queries,
+                                                 const std::uint32_t k,
+                                                 bool& ok)
+        {
+            PointKDTreeKnnTier tier{};
+            tier.K = k;
+
+            std::vector<::Geometry::KDTree::ElementIndex> referenceRows(queries.size() * k);
+            std::vector<::Geometry::KDTree::ElementIndex> single;
+            tier.KDTreeMedianMilliseconds = MedianMilliseconds([&]
+            {
+                for (std::size_t q = 0; q < queries.size(); ++q)
+                {
+                    ok = reference.QueryKNN(queries[q], k, single).has_value() && single.size() == k && ok;
+                    std::copy(single.begin(), single.end(),
+                              referenceRows.begin() + static_cast<std::ptrdiff_t>(q * k));
+                }
+            });
+
+            std::vector<::Geometry::PointKDTree::ElementIndex> rows;
+            tier.PointKDTreeMedianMilliseconds = MedianMilliseconds([&]
+            {
+                ok = tree.QueryKNNBatch(queries, k, rows).has_value() && ok;
+            });
+
+            ok = rows.size() == referenceRows.size() && ok;
+            for (std::size_t i = 0; i < std::min(rows.size(), referenceRows.size()); ++i)
+            {
+                if (rows[i] != referenceRows[i])
+                    ++tier.Mismatches;
+            }
+            tier.Speedup = tier.PointKDTreeMedianMilliseconds > 0.0
+                ? tier.KDTreeMedianMilliseconds / tier.PointKDTreeMedianMilliseconds
+                : 0.0;
+            return tier;
+        }
+    } // namespace
+
+    PointKDTreeKnnMetrics RunPointKDTreeKnnSmoke()
+    {
+        namespace Tasks = Extrinsic::Core::Tasks;
+
+        PointKDTreeKnnMetrics metrics{};
+        metrics.PointCount = kPointCount;
+        metrics.QueryCount = kQueryCount;
+
+        const bool ownsScheduler = !Tasks::Scheduler::IsInitialized();
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Initialize();
+        }
+
+        const std::vector<glm::vec3> points = UniformPoints(kPointCount, 0x5EEDu);
+        const std::vector<glm::vec3> queries = UniformPoints(kQueryCount, 0xC0FFEEu);
+
+        bool ok = true;
+        ::Geometry::KDTree reference;
+        auto t0 = std::chrono::steady_clock::now();
+        ok = reference.BuildFromPoints(points).has_value() && ok;
+        auto t1 = std::chrono::steady_clock::now();
+        metrics.KDTreeBuildMilliseconds = ElapsedMilliseconds(t0, t1);
+
+        ::Geometry::PointKDTree tree;
+        t0 = std::chrono::steady_clock::now();
+        ok = tree.Build(points).has_value() && ok;
+        t1 = std::chrono::steady_clock::now();
+        metrics.PointKDTreeBuildMilliseconds = ElapsedMilliseconds(t0, t1);
+
+        std::size_t mismatches = 0u;
+        for (std::size_t i = 0; i < kNeighbourCounts.size(); ++i)
+        {
+            metrics.Tiers[i] = RunTier(reference, tree, queries, kNeighbourCounts[i], ok);
+            mismatches += metrics.Tiers[i].Mismatches;
+        }
+
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Shutdown();
+        }
+
+        const PointKDTreeKnnTier& largest = metrics.Tiers.back();
+        metrics.RuntimeMilliseconds = largest.PointKDTreeMedianMilliseconds;
+        metrics.ThroughputItemsPerSecond = largest.PointKDTreeMedianMilliseconds > 0.0
+            ? static_cast<double>(kQueryCount) / (largest.PointKDTreeMedianMilliseconds * 1.0e-3)
+            : 0.0;
+        metrics.QualityErrorL2 = std::sqrt(static_cast<double>(mismatches));
+        metrics.Succeeded = ok && mismatches == 0u;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Geometry
@@ -1,4 +1,5 @@
-// GEOM-014 — manifest-backed FA-QEM adaptation quality smoke.
+// GEOM-014 — manifest-backed FA-QEM adaptation quality smoke, plus the
+// greedy vs independent-set collapse schedule comparison.
 
 #include "Bench.SimplificationQualitySmoke.hpp"
 
@@ -8,6 +9,7 @@
 #include <cmath>
 #include <cstddef>
 #include <map>
+#include <optional>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -16,6 +18,7 @@ import Geometry.HalfedgeMesh;
 import Geometry.MeshClosestFace;
 import Geometry.Properties;
 import Geometry.Simplification;
+import Extrinsic.Core.Tasks;
 
 namespace Intrinsic::Bench::Geometry
 {
@@ -27,6 +30,8 @@ namespace Intrinsic::Bench::Geometry
         constexpr std::size_t kTargetFaceCount = 24u;
         constexpr std::size_t kExpectedPinnedCornerCount = 8u;
         constexpr double kQualityRegressionTolerance = 1.0e-6;
+        constexpr int kScheduleCubeSubdivisions = 48;
+        constexpr std::size_t kScheduleTargetFaceCount = 2'764u; // ~10% of 27'648
 
         [[nodiscard]] ::Geometry::HalfedgeMesh::Mesh MakeTessellatedCube(
             const int subdivisions,
@@ -181,6 +186,9 @@ namespace Intrinsic::Bench::Geometry
             std::size_t ClassicalFinalFaceCount{0u};
             std::size_t FeatureAwarePinnedCornerCount{0u};
             std::size_t FeatureAwareQualityRejectionCount{0u};
+            SurfaceDistanceSummary IndependentSetDistance{};
+            std::size_t IndependentSetFinalFaceCount{0u};
+            std::size_t IndependentSetRoundCount{0u};
             double QualityErrorL2{0.0};
             double QualityErrorLinf{0.0};
             bool Succeeded{false};
@@ -203,16 +211,29 @@ namespace Intrinsic::Bench::Geometry
             const auto classicalResult =
                 ::Geometry::Simplification::Simplify(classicalMesh, classicalParams);
 
+            auto independentSetMesh = MakeTessellatedCube(4);
+            ::Geometry::Simplification::Params independentSetParams = featureAwareParams;
+            independentSetParams.Schedule =
+                ::Geometry::Simplification::CollapseSchedule::IndependentSets;
+            const auto independentSetResult =
+                ::Geometry::Simplification::Simplify(independentSetMesh, independentSetParams);
+
             TickResult tick{};
-            if (!featureAwareResult.has_value() || !classicalResult.has_value())
+            if (!featureAwareResult.has_value() || !classicalResult.has_value()
+                || !independentSetResult.has_value())
                 return tick;
 
             featureAwareMesh.GarbageCollection();
             classicalMesh.GarbageCollection();
+            independentSetMesh.GarbageCollection();
             tick.FeatureAwareDistance =
                 SampleReferenceToResultSurfaceDistance(reference, featureAwareMesh);
             tick.ClassicalDistance =
                 SampleReferenceToResultSurfaceDistance(reference, classicalMesh);
+            tick.IndependentSetDistance =
+                SampleReferenceToResultSurfaceDistance(reference, independentSetMesh);
+            tick.IndependentSetFinalFaceCount = independentSetResult->FinalFaceCount;
+            tick.IndependentSetRoundCount = independentSetResult->IndependentSetRounds;
 
             auto translatedControl = MakeTessellatedCube(4);
             for (std::size_t vertexIndex = 0u;
@@ -245,6 +266,8 @@ namespace Intrinsic::Bench::Geometry
             tick.Succeeded = tick.FeatureAwareDistance.Succeeded
                 && tick.ClassicalDistance.Succeeded
                 && tick.SensitivityControlDistance.Succeeded
+                && tick.IndependentSetDistance.Succeeded
+                && tick.IndependentSetRoundCount > 0u
                 && tick.FeatureAwareDistance.SampleCount
                     == tick.ClassicalDistance.SampleCount
                 && tick.FeatureAwareFinalFaceCount == kTargetFaceCount
@@ -258,6 +281,42 @@ namespace Intrinsic::Bench::Geometry
                 && tick.QualityErrorLinf <= kQualityRegressionTolerance;
             return tick;
         }
+
+        struct ScheduleRun
+        {
+            double Milliseconds{0.0};
+            SurfaceDistanceSummary Distance{};
+            std::size_t FinalFaceCount{0u};
+            std::size_t RoundCount{0u};
+            bool Succeeded{false};
+        };
+
+        [[nodiscard]] ScheduleRun RunSchedule(
+            const ::Geometry::HalfedgeMesh::Mesh& reference,
+            const ::Geometry::Simplification::CollapseSchedule schedule)
+        {
+            auto mesh = MakeTessellatedCube(kScheduleCubeSubdivisions);
+            ::Geometry::Simplification::Params params;
+            params.TargetFaces = kScheduleTargetFaceCount;
+            params.Schedule = schedule;
+
+            const auto start = std::chrono::steady_clock::now();
+            const auto result = ::Geometry::Simplification::Simplify(mesh, params);
+            const auto end = std::chrono::steady_clock::now();
+
+            ScheduleRun run{};
+            run.Milliseconds = static_cast<double>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) * 1.0e-6;
+            if (!result.has_value())
+                return run;
+
+            mesh.GarbageCollection();
+            run.Distance = SampleReferenceToResultSurfaceDistance(reference, mesh);
+            run.FinalFaceCount = result->FinalFaceCount;
+            run.RoundCount = result->IndependentSetRounds;
+            run.Succeeded = run.Distance.Succeeded && run.FinalFaceCount <= kScheduleTargetFaceCount;
+            return run;
+        }
     }
 
     SimplificationQualitySmokeMetrics RunSimplificationQualitySmoke()
@@ -285,6 +344,21 @@ namespace Intrinsic::Bench::Geometry
         }
         const auto end = std::chrono::steady_clock::now();
 
+        // Schedule comparison. Greedy runs before this benchmark initializes
+        // the scheduler, so its evaluation is serial unless the caller
+        // already owns one.
+        namespace Tasks = Extrinsic::Core::Tasks;
+        const auto scheduleReference = MakeTessellatedCube(kScheduleCubeSubdivisions);
+        const ScheduleRun greedy = RunSchedule(
+            scheduleReference, ::Geometry::Simplification::CollapseSchedule::Greedy);
+        const bool ownsScheduler = !Tasks::Scheduler::IsInitialized();
+        if (ownsScheduler)
+            Tasks::Scheduler::Initialize();
+        const ScheduleRun independentSets = RunSchedule(
+            scheduleReference, ::Geometry::Simplification::CollapseSchedule::IndependentSets);
+        if (ownsScheduler)
+            Tasks::Scheduler::Shutdown();
+
         const auto totalNanoseconds =
             std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
         const double meanMilliseconds =
@@ -311,7 +385,31 @@ namespace Intrinsic::Bench::Geometry
         metrics.FeatureAwareQualityRejectionCount =
             last.FeatureAwareQualityRejectionCount;
         metrics.FailedMeasuredIterationCount = failedMeasuredIterationCount;
+
+        metrics.IndependentSetRmsDistance = last.IndependentSetDistance.RmsDistance;
+        metrics.IndependentSetMaxDistance = last.IndependentSetDistance.MaxDistance;
+        metrics.IndependentSetQualityRegressionL2 = std::max(
+            0.0,
+            last.IndependentSetDistance.RmsDistance - last.FeatureAwareDistance.RmsDistance);
+        metrics.IndependentSetFinalFaceCount = last.IndependentSetFinalFaceCount;
+        metrics.IndependentSetRoundCount = last.IndependentSetRoundCount;
+
+        metrics.GreedyScheduleMilliseconds = greedy.Milliseconds;
+        metrics.IndependentSetScheduleMilliseconds = independentSets.Milliseconds;
+        metrics.IndependentSetSpeedup = independentSets.Milliseconds > 0.0
+            ? greedy.Milliseconds / independentSets.Milliseconds
+            : 0.0;
+        metrics.GreedyScheduleRmsDistance = greedy.Distance.RmsDistance;
+        metrics.IndependentSetScheduleRmsDistance = independentSets.Distance.RmsDistance;
+        metrics.ScheduleInputFaceCount = scheduleReference.FaceCount();
+        metrics.ScheduleTargetFaceCount = kScheduleTargetFaceCount;
+        metrics.GreedyScheduleFinalFaceCount = greedy.FinalFaceCount;
+        metrics.IndependentSetScheduleFinalFaceCount = independentSets.FinalFaceCount;
+        metrics.IndependentSetScheduleRoundCount = independentSets.RoundCount;
+
         metrics.Succeeded = allMeasuredIterationsSucceeded
+            && greedy.Succeeded
+            && independentSets.Succeeded
             && std::isfinite(meanMilliseconds)
             && meanMilliseconds
                 <= kSimplificationQualitySmokeRuntimeMillisecondsMax;
@@ -0,0 +1,243 @@
+#include "Bench.SparseSpMV.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+import Geometry.Sparse;
+import Extrinsic.Core.Tasks;
+
+namespace Intrinsic::Bench::Geometry
+{
+    namespace
+    {
+        namespace Sparse = ::Geometry::Sparse;
+
+        constexpr std::uint64_t kShuffleSeed = 0x5BA55EEDu;
+        constexpr double kMaxDoubleRelativeError = 1.0e-12;
+        // Float storage of a unit-weight Laplacian is exact; only the float
+        // input vector and output rounding remain.
+        constexpr double kMaxFloatRelativeError = 1.0e-6;
+
+        [[nodiscard]] double ElapsedMilliseconds(const std::chrono::steady_clock::time_point t0,
+                                                 const std::chrono::steady_clock::time_point t1)
+        {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) *
+                1.0e-6;
+        }
+
+        template <typename Fn>
+        [[nodiscard]] double MedianMilliseconds(const SparseSpMVCohort& cohort, Fn&& fn)
+        {
+            for (int i = 0; i < cohort.WarmupIterations; ++i)
+                fn();
+
+            std::vector<double> samples(static_cast<std::size_t>(std::max(cohort.MeasuredIterations, 1)));
+            for (double& sample : samples)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                fn();
+                const auto t1 = std::chrono::steady_clock::now();
+                sample = ElapsedMilliseconds(t0, t1);
+            }
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2u];
+        }
+
+        [[nodiscard]] double GBPerSecond(const std::size_t bytes, const double milliseconds)
+        {
+            return milliseconds > 0.0 ? static_cast<double>(bytes) / (milliseconds * 1.0e6) : 0.0;
+        }
+
+        // Compulsory traffic of one SpMV: the CSR arrays, x once, y once.
+        [[nodiscard]] std::size_t TrafficBytes(const Sparse::SparseMatrix& matrix)
+        {
+            return matrix.RowOffsets.size() * sizeof(std::size_t) +
+                matrix.NonZeros() * (sizeof(std::size_t) + sizeof(double)) +
+                (matrix.Rows + matrix.Cols) * sizeof(double);
+        }
+
+        template <typename TValue>
+        [[nodiscard]] std::size_t TrafficBytes(const Sparse::CompactSparseMatrix<TValue>& matrix)
+        {
+            return matrix.StorageBytes() + (matrix.Rows() + matrix.Cols()) * sizeof(TValue);
+        }
+
+        // Graph Laplacian of a triangulated side x side grid, rows in grid
+        // order; each row's columns come out ascending.
+        [[nodiscard]] Sparse::SparseMatrix MakeGridLaplacian(const std::size_t side)
+        {
+            Sparse::SparseMatrix matrix;
+            matrix.Rows = side * side;
+            matrix.Cols = side * side;
+            matrix.RowOffsets.reserve(matrix.Rows + 1u);
+            matrix.ColIndices.reserve(matrix.Rows * 7u);
+            matrix.Values.reserve(matrix.Rows * 7u);
+            matrix.RowOffsets.push_back(0u);
+
+            const auto inGrid = [side](const std::ptrdiff_t i, const std::ptrdiff_t j)
+            {
+                return i >= 0 && j >= 0 && i < static_cast<std::ptrdiff_t>(side) &&
+                    j < static_cast<std::ptrdiff_t>(side);
+            };
+            // Ascending column order for a row-major grid.
+            constexpr std::ptrdiff_t kStencil[7][2]{{-1, -1}, {-1, 0}, {0, -1}, {0, 0}, {0, 1}, {1, 0}, {1, 1}};
+            for (std::size_t i = 0; i < side; ++i)
+            {
+                for (std::size_t j = 0; j < side; ++j)
+                {
+                    const std::size_t row = i * side + j;
+                    std::size_t diagonalSlot = 0u;
+                    double degree = 0.0;
+                    for (const auto& [di, dj] : kStencil)
+                    {
+                        const std::ptrdiff_t ni = static_cast<std::ptrdiff_t>(i) + di;
+                        const std::ptrdiff_t nj = static_cast<std::ptrdiff_t>(j) + dj;
+                        if (!inGrid(ni, nj))
+                            continue;
+                        const std::size_t col = static_cast<std::size_t>(ni) * side + static_cast<std::size_t>(nj);
+                        if (col == row)
+                        {
+                            diagonalSlot = matrix.Values.size();
+                            matrix.ColIndices.push_back(col);
+                            matrix.Values.push_back(0.0);
+                            continue;
+                        }
+                        matrix.ColIndices.push_back(col);
+                        matrix.Values.push_back(-1.0);
+                        degree += 1.0;
+                    }
+                    matrix.Values[diagonalSlot] = degree;
+                    matrix.RowOffsets.push_back(matrix.Values.size());
+                }
+            }
+            return matrix;
+        }
+
+        [[nodiscard]] double RelativeErrorL2(std::span<const double> value, std::span<const double> reference)
+        {
+            double diff = 0.0;
+            double norm = 0.0;
+            for (std::size_t i = 0; i < reference.size(); ++i)
+            {
+                const double d = value[i] - reference[i];
+                diff += d * d;
+                norm += reference[i] * reference[i];
+            }
+            return norm > 0.0 ? std::sqrt(diff / norm) : std::sqrt(diff);
+        }
+    } // namespace
+
+    SparseSpMVMetrics RunSparseSpMV(const SparseSpMVCohort& cohort)
+    {
+        namespace Tasks = Extrinsic::Core::Tasks;
+
+        SparseSpMVMetrics metrics{};
+
+        const bool ownsScheduler = !Tasks::Scheduler::IsInitialized();
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Initialize();
+        }
+
+        bool ok = true;
+        Sparse::SparseMatrix shuffled;
+        {
+            const Sparse::SparseMatrix grid = MakeGridLaplacian(cohort.GridSide);
+            std::vector<std::size_t> shuffle(grid.Rows);
+            std::iota(shuffle.begin(), shuffle.end(), std::size_t{0});
+            std::mt19937_64 rng{kShuffleSeed};
+            std::shuffle(shuffle.begin(), shuffle.end(), rng);
+            Sparse::SparseBuildResult permuted = Sparse::PermuteSymmetric(grid, shuffle);
+            ok = permuted.Valid && ok;
+            shuffled = std::move(permuted.Matrix);
+        }
+        const std::size_t n = shuffled.Rows;
+        metrics.RowCount = n;
+        metrics.NonZeroCount = shuffled.NonZeros();
+        metrics.ShuffledBandwidth = Sparse::ComputeBandwidth(shuffled);
+
+        std::vector<double> x(n);
+        for (std::size_t i = 0; i < n; ++i)
+            x[i] = std::sin(0.001 * static_cast<double>(i)) + 0.5;
+
+        std::vector<double> reference(n);
+        const double baselineShuffledMs = MedianMilliseconds(cohort, [&] { shuffled.Multiply(x, reference); });
+        metrics.BaselineShuffledGBPerSecond = GBPerSecond(TrafficBytes(shuffled), baselineShuffledMs);
+
+        auto t0 = std::chrono::steady_clock::now();
+        const std::vector<std::size_t> rcm = Sparse::ComputeReverseCuthillMcKee(shuffled);
+        auto t1 = std::chrono::steady_clock::now();
+        metrics.RcmMilliseconds = ElapsedMilliseconds(t0, t1);
+        ok = rcm.size() == n && ok;
+
+        Sparse::SparseBuildResult reordered = Sparse::PermuteSymmetric(shuffled, rcm);
+        ok = reordered.Valid && ok;
+        shuffled = {};
+        const Sparse::SparseMatrix& ordered = reordered.Matrix;
+        metrics.RcmBandwidth = Sparse::ComputeBandwidth(ordered);
+
+        std::vector<double> xr(n);
+        std::vector<double> yr(n);
+        std::vector<double> y(n);
+        Sparse::PermuteVector(rcm, x, xr);
+
+        const double baselineRcmMs = MedianMilliseconds(cohort, [&] { ordered.Multiply(xr, yr); });
+        metrics.BaselineRcmGBPerSecond = GBPerSecond(TrafficBytes(ordered), baselineRcmMs);
+        Sparse::InversePermuteVector(rcm, yr, y);
+        double worstError = RelativeErrorL2(y, reference);
+
+        Sparse::CompactSparseBuildResult<double> compactDouble = Sparse::MakeCompact<double>(ordered);
+        const Sparse::CompactSparseBuildResult<float> compactFloat = Sparse::MakeCompact<float>(ordered);
+        ok = compactDouble.Valid && compactFloat.Valid && ok;
+        reordered = {};
+
+        const double compactDoubleMs = MedianMilliseconds(cohort, [&] { compactDouble.Matrix.Multiply(xr, yr); });
+        metrics.CompactDoubleGBPerSecond = GBPerSecond(TrafficBytes(compactDouble.Matrix), compactDoubleMs);
+        Sparse::InversePermuteVector(rcm, yr, y);
+        worstError = std::max(worstError, RelativeErrorL2(y, reference));
+
+        std::vector<float> xf(xr.begin(), xr.end());
+        std::vector<float> yf(n);
+        const double compactFloatMs = MedianMilliseconds(cohort, [&] { compactFloat.Matrix.Multiply(xf, yf); });
+        metrics.CompactFloatGBPerSecond = GBPerSecond(TrafficBytes(compactFloat.Matrix), compactFloatMs);
+        const std::vector<double> yfr(yf.begin(), yf.end());
+        Sparse::InversePermuteVector(rcm, yfr, y);
+        metrics.FloatRelativeErrorL2 = RelativeErrorL2(y, reference);
+
+        t0 = std::chrono::steady_clock::now();
+        compactDouble.Matrix.BuildTranspose();
+        t1 = std::chrono::steady_clock::now();
+        metrics.TransposeBuildMilliseconds = ElapsedMilliseconds(t0, t1);
+        ok = compactDouble.Matrix.HasTranspose() && ok;
+
+        // The Laplacian is symmetric, so A^T x is compared against A x.
+        const double transposeMs =
+            MedianMilliseconds(cohort, [&] { compactDouble.Matrix.MultiplyTranspose(xr, yr); });
+        metrics.CompactTransposeGBPerSecond = GBPerSecond(TrafficBytes(compactDouble.Matrix), transposeMs);
+        Sparse::InversePermuteVector(rcm, yr, y);
+        worstError = std::max(worstError, RelativeErrorL2(y, reference));
+
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Shutdown();
+        }
+
+        metrics.RuntimeMilliseconds = compactDoubleMs;
+        metrics.ThroughputItemsPerSecond = compactDoubleMs > 0.0
+            ? static_cast<double>(metrics.NonZeroCount) / (compactDoubleMs * 1.0e-3)
+            : 0.0;
+        metrics.QualityErrorL2 = worstError;
+        metrics.Succeeded = ok && worstError <= kMaxDoubleRelativeError &&
+            metrics.FloatRelativeErrorL2 <= kMaxFloatRelativeError &&
+            metrics.RcmBandwidth < metrics.ShuffledBandwidth;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Geometry
@@ -0,0 +1,164 @@
+#include "Bench.SparseSurfaceReconstructionSmoke.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <optional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+import Geometry;
+import Extrinsic.Core.Tasks;
+
+namespace Intrinsic::Bench::Geometry
+{
+    namespace
+    {
+        namespace Recon = ::Geometry::SurfaceReconstruction;
+
+        constexpr int kMeasuredIterations = 3;
+        constexpr std::size_t kPointCount = 100'000u;
+        constexpr std::size_t kNarrowBandCells = 3u;
+        constexpr std::size_t kParityResolution = 128u;
+        // The smoke runner shares a two-minute budget, so the largest tier
+        // is 512. A 1024 tier needs about 400k points to keep the point
+        // spacing inside the band and takes roughly 10 s per run on one
+        // core; add it here (and to Tiers) for one-off comparisons.
+        constexpr std::array<std::size_t, 2> kResolutions{256u, 512u};
+
+        [[nodiscard]] double ElapsedMilliseconds(const std::chrono::steady_clock::time_point t0,
+                                                 const std::chrono::steady_clock::time_point t1)
+        {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) *
+                1.0e-6;
+        }
+
+        [[nodiscard]] std::vector<glm::vec3> FibonacciSphere(const std::size_t count)
+        {
+            const float goldenAngle = std::numbers::pi_v<float> * (3.0f - std::sqrt(5.0f));
+            std::vector<glm::vec3> points;
+            points.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const float y = 1.0f - 2.0f * static_cast<float>(i) / static_cast<float>(count - 1u);
+                const float r = std::sqrt(std::max(0.0f, 1.0f - y * y));
+                const float theta = goldenAngle * static_cast<float>(i);
+                points.emplace_back(std::cos(theta) * r, y, std::sin(theta) * r);
+            }
+            return points;
+        }
+
+        [[nodiscard]] Recon::ReconstructionParams MakeParams(const std::size_t resolution, const Recon::GridMode mode)
+        {
+            Recon::ReconstructionParams params;
+            params.Resolution = resolution;
+            params.EstimateNormals = false;
+            params.KNeighbors = 1;
+            params.Grid = mode;
+            params.NarrowBandCells = kNarrowBandCells;
+            return params;
+        }
+
+        // Median wall time over `iterations` runs; `last` keeps the final
+        // result. Runs are long enough that no warmup is needed.
+        [[nodiscard]] double MedianMilliseconds(const std::vector<glm::vec3>& points,
+                                                const std::vector<glm::vec3>& normals,
+                                                const Recon::ReconstructionParams& params,
+                                                const int iterations,
+                                                std::optional<Recon::ReconstructionResult>& last)
+        {
+            std::vector<double> samples(static_cast<std::size_t>(iterations));
+            for (double& sample : samples)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                last = Recon::Reconstruct(points, normals, params);
+                const auto t1 = std::chrono::steady_clock::now();
+                sample = ElapsedMilliseconds(t0, t1);
+            }
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2u];
+        }
+    } // namespace
+
+    SparseSurfaceReconstructionMetrics RunSparseSurfaceReconstructionSmoke()
+    {
+        namespace Tasks = Extrinsic::Core::Tasks;
+
+        SparseSurfaceReconstructionMetrics metrics{};
+        metrics.PointCount = kPointCount;
+        metrics.NarrowBandCells = kNarrowBandCells;
+        metrics.ParityResolution = kParityResolution;
+
+        const bool ownsScheduler = !Tasks::Scheduler::IsInitialized();
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Initialize();
+        }
+
+        const std::vector<glm::vec3> points = FibonacciSphere(kPointCount);
+        const std::vector<glm::vec3>& normals = points;
+
+        bool ok = true;
+
+        // Parity: inside the band both modes sample the same field, so they
+        // must extract the same mesh. Each mode runs once.
+        std::optional<Recon::ReconstructionResult> dense;
+        std::optional<Recon::ReconstructionResult> sparse;
+        metrics.DenseParityMilliseconds =
+            MedianMilliseconds(points, normals, MakeParams(kParityResolution, Recon::GridMode::Dense), 1, dense);
+        metrics.SparseParityMilliseconds = MedianMilliseconds(
+            points, normals, MakeParams(kParityResolution, Recon::GridMode::SparseNarrowBand), 1, sparse);
+        ok = dense.has_value() && sparse.has_value() && ok;
+        if (dense.has_value() && sparse.has_value())
+        {
+            const double faceDelta = static_cast<double>(sparse->OutputFaceCount) -
+                static_cast<double>(dense->OutputFaceCount);
+            const double vertexDelta = static_cast<double>(sparse->OutputVertexCount) -
+                static_cast<double>(dense->OutputVertexCount);
+            metrics.QualityErrorL2 = std::sqrt(faceDelta * faceDelta + vertexDelta * vertexDelta);
+        }
+        else
+        {
+            metrics.QualityErrorL2 = 1.0;
+        }
+
+        for (std::size_t i = 0; i < kResolutions.size(); ++i)
+        {
+            SparseSurfaceReconstructionTier& tier = metrics.Tiers[i];
+            tier.Resolution = kResolutions[i];
+
+            std::optional<Recon::ReconstructionResult> result;
+            tier.MedianMilliseconds = MedianMilliseconds(
+                points, normals, MakeParams(tier.Resolution, Recon::GridMode::SparseNarrowBand),
+                kMeasuredIterations, result);
+            ok = result.has_value() && ok;
+            if (!result.has_value())
+                continue;
+
+            const std::size_t denseVertices = (result->GridNX + 1u) * (result->GridNY + 1u) * (result->GridNZ + 1u);
+            tier.AllocatedBlockCount = result->AllocatedBlockCount;
+            tier.EvaluatedVertexCount = result->EvaluatedVertexCount;
+            tier.SparseFieldBytes = result->AllocatedVertexCount * sizeof(float);
+            tier.DenseFieldBytes = denseVertices * sizeof(float);
+            tier.OutputFaceCount = result->OutputFaceCount;
+            ok = tier.SparseFieldBytes < tier.DenseFieldBytes && ok;
+        }
+
+        if (ownsScheduler)
+        {
+            Tasks::Scheduler::Shutdown();
+        }
+
+        const SparseSurfaceReconstructionTier& largest = metrics.Tiers.back();
+        metrics.RuntimeMilliseconds = largest.MedianMilliseconds;
+        metrics.ThroughputItemsPerSecond = largest.MedianMilliseconds > 0.0
+            ? static_cast<double>(largest.EvaluatedVertexCount) / (largest.MedianMilliseconds * 1.0e-3)
+            : 0.0;
+        metrics.Succeeded = ok && metrics.QualityErrorL2 == 0.0;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Geometry
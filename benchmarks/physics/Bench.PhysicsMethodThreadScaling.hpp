@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace Intrinsic::Bench::Physics
+{
+    inline constexpr const char* kPhysicsMethodThreadScalingBenchmarkId = "physics.method_thread_scaling";
+    inline constexpr const char* kPhysicsMethodThreadScalingMethod      = "physics.sph_fluid_and_xpbd_cloth.chunked_parallel_step";
+    inline constexpr const char* kPhysicsMethodThreadScalingDataset     = "builtin.physics_methods.sph_slab_and_pinned_cloth_sheet_v1";
+
+    inline constexpr std::array<unsigned, 5> kPhysicsMethodThreadCounts{1u, 2u, 4u, 8u, 16u};
+
+    // One point of the thread-scaling curve. Worker* timings use plain
+    // std::thread workers; Scheduler* timings use Core::Tasks::Scheduler
+    // initialized with the same thread count (0 when the scheduler was
+    // already owned by someone else and could not be resized).
+    struct PhysicsMethodThreadScalingPoint
+    {
+        unsigned ThreadCount{0};
+        double   SphWorkerMedianMilliseconds{0.0};
+        double   ClothWorkerMedianMilliseconds{0.0};
+        double   SphSchedulerMedianMilliseconds{0.0};
+        double   ClothSchedulerMedianMilliseconds{0.0};
+    };
+
+    struct PhysicsMethodThreadScalingMetrics
+    {
+        double      RuntimeMilliseconds{0.0};      // 1-thread worker SPH + cloth step medians
+        double      ThroughputItemsPerSecond{0.0}; // particles per second at the fastest point
+        double      QualityErrorL2{0.0};           // parity mismatches against the inline step
+        std::size_t SphParticleCount{0};
+        std::size_t ClothParticleCount{0};
+        std::size_t ClothConstraintCount{0};
+        std::size_t ClothColorCount{0};
+        unsigned    HardwareThreads{0};
+        bool        SchedulerMeasured{false};
+        std::array<PhysicsMethodThreadScalingPoint, kPhysicsMethodThreadCounts.size()> Points{};
+        std::size_t ParityMismatches{0};
+        bool        Succeeded{false};
+    };
+
+    [[nodiscard]] PhysicsMethodThreadScalingMetrics RunPhysicsMethodThreadScaling();
+} // namespace Intrinsic::Bench::Physics
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Intrinsic::Bench::Physics
+{
+    inline constexpr const char* kPhysicsWorldBroadphaseScalingBenchmarkId = "physics.world_broadphase.scaling";
+    inline constexpr const char* kPhysicsWorldBroadphaseScalingMethod      = "physics.world.sweep_and_prune_broadphase";
+    inline constexpr const char* kPhysicsWorldBroadphaseScalingDataset     = "builtin.physics_world.jittered_sphere_lattice_v1";
+
+    struct PhysicsWorldBroadphaseScalingMetrics
+    {
+        double      RuntimeMilliseconds{0.0};
+        double      ThroughputItemsPerSecond{0.0};
+        double      QualityErrorL2{0.0};
+        double      SmallMedianRuntimeMilliseconds{0.0};
+        double      LargeMedianRuntimeMilliseconds{0.0};
+        double      RuntimeScalingRatio{0.0};
+        std::size_t SmallBodyCount{0};
+        std::size_t LargeBodyCount{0};
+        std::size_t SmallCandidatePairs{0};
+        std::size_t LargeCandidatePairs{0};
+        std::size_t LargeContactCount{0};
+        std::size_t SmallOracleContactCount{0};
+        std::size_t SmallOracleMismatches{0};
+        bool        Succeeded{false};
+    };
+
+    [[nodiscard]] PhysicsWorldBroadphaseScalingMetrics RunPhysicsWorldBroadphaseScaling();
+} // namespace Intrinsic::Bench::Physics
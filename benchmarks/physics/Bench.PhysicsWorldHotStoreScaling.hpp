@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Intrinsic::Bench::Physics
+{
+    inline constexpr const char* kPhysicsWorldHotStoreScalingBenchmarkId = "physics.world_hot_store.scaling";
+    inline constexpr const char* kPhysicsWorldHotStoreScalingMethod      = "physics.world.soa_hot_store_solve_step";
+    inline constexpr const char* kPhysicsWorldHotStoreScalingDataset     = "builtin.physics_world.overlapping_sphere_lattice_v1";
+
+    struct PhysicsWorldHotStoreScalingTier
+    {
+        std::size_t BodyCount{0};
+        double      IntegrateMedianMilliseconds{0.0};
+        double      SolveStepMedianMilliseconds{0.0};
+        double      SolveStepBodiesPerSecond{0.0};
+        std::size_t ContactsSolved{0};
+    };
+
+    struct PhysicsWorldHotStoreScalingMetrics
+    {
+        double                          RuntimeMilliseconds{0.0};
+        double                          ThroughputItemsPerSecond{0.0};
+        double                          QualityErrorL2{0.0};
+        PhysicsWorldHotStoreScalingTier Small{};
+        PhysicsWorldHotStoreScalingTier Medium{};
+        PhysicsWorldHotStoreScalingTier Large{};
+        std::size_t                     DeterminismMismatches{0};
+        bool                            Succeeded{false};
+    };
+
+    [[nodiscard]] PhysicsWorldHotStoreScalingMetrics RunPhysicsWorldHotStoreScaling();
+} // namespace Intrinsic::Bench::Physics
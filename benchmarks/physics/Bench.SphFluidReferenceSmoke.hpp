@@ -16,6 +16,17 @@ namespace Intrinsic::Bench::Physics
         double      ColumnAverageDensityError{0.0};
         std::size_t ColumnMaxNeighborCount{0};
         bool        ColumnStable{false};
+        // Uniform-grid neighbor search at scale: one timed Step on a ~50k
+        // and a ~200k particle lattice slab (default NeighborSearch).
+        std::size_t LargeParticleCount{0};
+        double      LargeStepMilliseconds{0.0};
+        std::size_t HugeParticleCount{0};
+        double      HugeStepMilliseconds{0.0};
+        // Oracle parity: full grid-vs-brute-force neighbor lists on the small
+        // sets, sampled brute-force scans on the large sets, and bitwise
+        // column trajectories in both NeighborSearch modes. All must be 0.
+        std::size_t NeighborOracleMismatches{0};
+        std::size_t StateOracleMismatches{0};
         bool        Succeeded{false};
     };
 
@@ -0,0 +1,384 @@
+#include "Bench.PhysicsMethodThreadScaling.hpp"
+
+#include "SphFluidReference.hpp"
+#include "XpbdClothReference.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+import Extrinsic.Core.Tasks;
+import Extrinsic.Core.Tasks.CounterEvent;
+
+namespace Intrinsic::Bench::Physics
+{
+    namespace
+    {
+        namespace Sph = Intrinsic::Methods::Physics::SphFluidReference;
+        namespace Cloth = Intrinsic::Methods::Physics::XpbdClothReference;
+        namespace Tasks = Extrinsic::Core::Tasks;
+
+        using ChunkBody = std::function<void(std::size_t)>;
+        using ChunkExecutor = std::function<void(std::size_t, const ChunkBody&)>;
+
+        constexpr int kMeasuredIterations = 3;
+        constexpr double kSphSpacing = 0.05;
+        constexpr double kClothSpacing = 0.01;
+        constexpr int kClothIterations = 10;
+
+        // ~50k particle fluid slab and a ~37k particle pinned cloth sheet.
+        constexpr std::size_t kSphSideX = 50;
+        constexpr std::size_t kSphSideY = 50;
+        constexpr std::size_t kSphSideZ = 20;
+        constexpr std::size_t kClothSide = 192;
+
+        // Persistent plain-thread pool: the calling thread plus
+        // threadCount - 1 workers claim chunks from a shared counter. Every
+        // worker checks in once per Run so no stale worker can observe the
+        // next dispatch's body.
+        class WorkerPool
+        {
+        public:
+            explicit WorkerPool(unsigned threadCount)
+            {
+                for (unsigned i = 1; i < threadCount; ++i)
+                {
+                    m_Workers.emplace_back([this]() { WorkerLoop(); });
+                }
+            }
+
+            ~WorkerPool()
+            {
+                {
+                    std::lock_guard lock{m_Mutex};
+                    m_Stop = true;
+                }
+                m_Wake.notify_all();
+                for (std::thread& worker : m_Workers)
+                {
+                    worker.join();
+                }
+            }
+
+            WorkerPool(const WorkerPool&) = delete;
+            WorkerPool& operator=(const WorkerPool&) = delete;
+
+            void Run(std::size_t chunkCount, const ChunkBody& body)
+            {
+                {
+                    std::lock_guard lock{m_Mutex};
+                    m_Body = &body;
+                    m_ChunkCount = chunkCount;
+                    m_NextChunk.store(0, std::memory_order_relaxed);
+                    m_CheckedIn = 0;
+                    ++m_Generation;
+                }
+                m_Wake.notify_all();
+                Drain();
+
+                std::unique_lock lock{m_Mutex};
+                m_Done.wait(lock, [this]() { return m_CheckedIn == m_Workers.size(); });
+                m_Body = nullptr;
+            }
+
+        private:
+            void Drain()
+            {
+                for (;;)
+                {
+                    const std::size_t chunk = m_NextChunk.fetch_add(1, std::memory_order_relaxed);
+                    if (chunk >= m_ChunkCount)
+                    {
+                        return;
+                    }
+                    (*m_Body)(chunk);
+                }
+            }
+
+            void WorkerLoop()
+            {
+                std::uint64_t seen = 0;
+                for (;;)
+                {
+                    {
+                        std::unique_lock lock{m_Mutex};
+                        m_Wake.wait(lock, [&]() { return m_Stop || m_Generation != seen; });
+                        if (m_Stop)
+                        {
+                            return;
+                        }
+                        seen = m_Generation;
+                    }
+                    Drain();
+                    {
+                        std::lock_guard lock{m_Mutex};
+                        ++m_CheckedIn;
+                    }
+                    m_Done.notify_one();
+                }
+            }
+
+            std::vector<std::thread> m_Workers{};
+            std::mutex               m_Mutex{};
+            std::condition_variable  m_Wake{};
+            std::condition_variable  m_Done{};
+            const ChunkBody*         m_Body{nullptr};
+            std::size_t              m_ChunkCount{0};
+            std::atomic<std::size_t> m_NextChunk{0};
+            std::size_t              m_CheckedIn{0};
+            std::uint64_t            m_Generation{0};
+            bool                     m_Stop{false};
+        };
+
+        // Dispatches one scheduler task per chunk; the caller helps drain the
+        // queues while waiting, mirroring the physics world island solve.
+        void RunOnScheduler(std::size_t chunkCount, const ChunkBody& body)
+        {
+            Tasks::CounterEvent done{static_cast<std::uint32_t>(chunkCount)};
+            for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+            {
+                Tasks::Scheduler::Dispatch(
+                    [&body, &done, chunk]()
+                    {
+                        body(chunk);
+                        done.Signal();
+                    });
+            }
+            while (!done.IsReady())
+            {
+                const auto progress = Tasks::Scheduler::ObserveWorkProgress();
+                const std::uint32_t pending = done.PendingCount();
+                if (pending == 0u)
+                    break;
+                if (Tasks::Scheduler::TryRunOne())
+                    continue;
+                if (!Tasks::Scheduler::WaitForWorkProgress(progress))
+                    done.WaitForProgress(pending);
+            }
+        }
+
+        [[nodiscard]] auto MakeSphSlab() -> std::vector<Sph::ParticleState>
+        {
+            std::vector<Sph::ParticleState> particles;
+            particles.reserve(kSphSideX * kSphSideY * kSphSideZ);
+            for (std::size_t z = 0; z < kSphSideZ; ++z)
+            {
+                for (std::size_t y = 0; y < kSphSideY; ++y)
+                {
+                    for (std::size_t x = 0; x < kSphSideX; ++x)
+                    {
+                        Sph::ParticleState particle{};
+                        particle.Position = Sph::Vec3{static_cast<double>(x) * kSphSpacing,
+                                                      static_cast<double>(y) * kSphSpacing,
+                                                      static_cast<double>(z) * kSphSpacing};
+                        particles.push_back(particle);
+                    }
+                }
+            }
+            return particles;
+        }
+
+        [[nodiscard]] auto SphParams() -> Sph::StepParams
+        {
+            Sph::StepParams params{};
+            params.SmoothingLength = 2.0 * kSphSpacing;
+            params.RestDensity = 1000.0;
+            params.ParticleMass = params.RestDensity * kSphSpacing * kSphSpacing * kSphSpacing;
+            params.Viscosity = 0.2;
+            params.Boundaries = {Sph::MakeBoundaryPlane(Sph::Vec3{0.0, 1.0, 0.0}, 0.0)};
+            return params;
+        }
+
+        [[nodiscard]] auto MakeClothSheet() -> Cloth::ClothState
+        {
+            std::vector<Cloth::Vec3> positions;
+            std::vector<Cloth::Triangle> triangles;
+            positions.reserve(kClothSide * kClothSide);
+            for (std::size_t z = 0; z < kClothSide; ++z)
+            {
+                for (std::size_t x = 0; x < kClothSide; ++x)
+                {
+                    positions.push_back(Cloth::Vec3{static_cast<double>(x) * kClothSpacing, 0.0,
+                                                    static_cast<double>(z) * kClothSpacing});
+                }
+            }
+            for (std::size_t z = 0; z + 1 < kClothSide; ++z)
+            {
+                for (std::size_t x = 0; x + 1 < kClothSide; ++x)
+                {
+                    const std::size_t i = z * kClothSide + x;
+                    triangles.push_back(Cloth::Triangle{i, i + 1, i + kClothSide});
+                    triangles.push_back(Cloth::Triangle{i + 1, i + kClothSide + 1, i + kClothSide});
+                }
+            }
+            Cloth::ClothState state = Cloth::BuildClothFromTriangles(positions, triangles, 0.001, 1.0e-7, 1.0e-4);
+            for (std::size_t x = 0; x < kClothSide; ++x)
+            {
+                state.Particles[x].InverseMass = 0.0;
+            }
+            return state;
+        }
+
+        [[nodiscard]] auto ClothParams() -> Cloth::StepParams
+        {
+            Cloth::StepParams params{};
+            params.Iterations = kClothIterations;
+            params.GlobalDamping = 0.02;
+            params.Order = Cloth::ConstraintOrder::Colored;
+            params.Colliders = {Cloth::MakeHalfSpaceCollider(Cloth::Vec3{0.0, 1.0, 0.0}, -0.5)};
+            return params;
+        }
+
+        [[nodiscard]] auto CountMismatches(const std::vector<Sph::ParticleState>& lhs,
+                                           const std::vector<Sph::ParticleState>& rhs) -> std::size_t
+        {
+            std::size_t mismatches = lhs.size() == rhs.size() ? 0u : 1u;
+            for (std::size_t i = 0; i < std::min(lhs.size(), rhs.size()); ++i)
+            {
+                const bool equal = lhs[i].Position.X == rhs[i].Position.X && lhs[i].Position.Y == rhs[i].Position.Y &&
+                                   lhs[i].Position.Z == rhs[i].Position.Z && lhs[i].Velocity.X == rhs[i].Velocity.X &&
+                                   lhs[i].Velocity.Y == rhs[i].Velocity.Y && lhs[i].Velocity.Z == rhs[i].Velocity.Z;
+                mismatches += equal ? 0u : 1u;
+            }
+            return mismatches;
+        }
+
+        [[nodiscard]] auto CountMismatches(const Cloth::ClothState& lhs, const Cloth::ClothState& rhs) -> std::size_t
+        {
+            std::size_t mismatches = lhs.Particles.size() == rhs.Particles.size() ? 0u : 1u;
+            for (std::size_t i = 0; i < std::min(lhs.Particles.size(), rhs.Particles.size()); ++i)
+            {
+                const Cloth::ParticleState& a = lhs.Particles[i];
+                const Cloth::ParticleState& b = rhs.Particles[i];
+                const bool equal = a.Position.X == b.Position.X && a.Position.Y == b.Position.Y &&
+                                   a.Position.Z == b.Position.Z && a.Velocity.X == b.Velocity.X &&
+                                   a.Velocity.Y == b.Velocity.Y && a.Velocity.Z == b.Velocity.Z;
+                mismatches += equal ? 0u : 1u;
+            }
+            return mismatches;
+        }
+
+        [[nodiscard]] double Median(std::vector<double> values)
+        {
+            std::sort(values.begin(), values.end());
+            return values[values.size() / 2];
+        }
+
+        struct Workloads
+        {
+            std::vector<Sph::ParticleState> SphParticles{};
+            Sph::StepParams                 SphStep{};
+            std::vector<Sph::ParticleState> SphInline{};
+            Cloth::ClothState               Cloth{};
+            Cloth::StepParams               ClothStep{};
+            Cloth::ClothState               ClothInline{};
+        };
+
+        // Median single-step times through the given executor; every
+        // measured step is compared bitwise against the inline result.
+        void MeasurePoint(const Workloads& workloads,
+                          const ChunkExecutor& executor,
+                          double& sphMilliseconds,
+                          double& clothMilliseconds,
+                          std::size_t& mismatches)
+        {
+            Sph::StepParams sphParams = workloads.SphStep;
+            sphParams.Executor = executor;
+            Cloth::StepParams clothParams = workloads.ClothStep;
+            clothParams.Executor = executor;
+
+            std::vector<double> sphSamples;
+            std::vector<double> clothSamples;
+            for (int i = 0; i < kMeasuredIterations; ++i)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                const Sph::StepResult sph = Sph::Step(workloads.SphParticles, sphParams);
+                const auto t1 = std::chrono::steady_clock::now();
+                const Cloth::StepResult cloth = Cloth::Step(workloads.Cloth, clothParams);
+                const auto t2 = std::chrono::steady_clock::now();
+
+                sphSamples.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+                clothSamples.push_back(std::chrono::duration<double, std::milli>(t2 - t1).count());
+                mismatches += CountMismatches(sph.Particles, workloads.SphInline);
+                mismatches += CountMismatches(cloth.State, workloads.ClothInline);
+            }
+            sphMilliseconds = Median(std::move(sphSamples));
+            clothMilliseconds = Median(std::move(clothSamples));
+        }
+    } // namespace
+
+    PhysicsMethodThreadScalingMetrics RunPhysicsMethodThreadScaling()
+    {
+        PhysicsMethodThreadScalingMetrics metrics{};
+        metrics.HardwareThreads = std::thread::hardware_concurrency();
+
+        Workloads workloads{};
+        workloads.SphParticles = MakeSphSlab();
+        workloads.SphStep = SphParams();
+        workloads.Cloth = MakeClothSheet();
+        workloads.ClothStep = ClothParams();
+
+        // Inline (executor-less) steps are both the warmup and the parity
+        // baseline for every executor and thread count.
+        const Sph::StepResult sphInline = Sph::Step(workloads.SphParticles, workloads.SphStep);
+        const Cloth::StepResult clothInline = Cloth::Step(workloads.Cloth, workloads.ClothStep);
+        workloads.SphInline = sphInline.Particles;
+        workloads.ClothInline = clothInline.State;
+
+        metrics.SphParticleCount = workloads.SphParticles.size();
+        metrics.ClothParticleCount = workloads.Cloth.Particles.size();
+        metrics.ClothConstraintCount = workloads.Cloth.StretchConstraints.size() + workloads.Cloth.BendConstraints.size();
+        metrics.ClothColorCount = clothInline.Diagnostics.StretchColorCount + clothInline.Diagnostics.BendColorCount;
+
+        // The scheduler curve needs to size the scheduler itself; skip it if
+        // another owner already initialized one.
+        metrics.SchedulerMeasured = !Tasks::Scheduler::IsInitialized();
+        double bestSeconds = 0.0;
+        for (std::size_t p = 0; p < kPhysicsMethodThreadCounts.size(); ++p)
+        {
+            PhysicsMethodThreadScalingPoint& point = metrics.Points[p];
+            point.ThreadCount = kPhysicsMethodThreadCounts[p];
+            {
+                WorkerPool pool{point.ThreadCount};
+                const ChunkExecutor executor = [&pool](std::size_t chunkCount, const ChunkBody& body)
+                { pool.Run(chunkCount, body); };
+                MeasurePoint(workloads, executor, point.SphWorkerMedianMilliseconds,
+                             point.ClothWorkerMedianMilliseconds, metrics.ParityMismatches);
+            }
+            if (metrics.SchedulerMeasured)
+            {
+                Tasks::Scheduler::Initialize(point.ThreadCount);
+                MeasurePoint(workloads, RunOnScheduler, point.SphSchedulerMedianMilliseconds,
+                             point.ClothSchedulerMedianMilliseconds, metrics.ParityMismatches);
+                Tasks::Scheduler::Shutdown();
+            }
+
+            const double seconds =
+                (point.SphWorkerMedianMilliseconds + point.ClothWorkerMedianMilliseconds) * 1.0e-3;
+            if (seconds > 0.0 && (bestSeconds == 0.0 || seconds < bestSeconds))
+            {
+                bestSeconds = seconds;
+            }
+        }
+
+        metrics.RuntimeMilliseconds =
+            metrics.Points[0].SphWorkerMedianMilliseconds + metrics.Points[0].ClothWorkerMedianMilliseconds;
+        if (bestSeconds > 0.0)
+        {
+            metrics.ThroughputItemsPerSecond =
+                static_cast<double>(metrics.SphParticleCount + metrics.ClothParticleCount) / bestSeconds;
+        }
+        metrics.QualityErrorL2 = static_cast<double>(metrics.ParityMismatches);
+        metrics.Succeeded = sphInline.Diagnostics.Code == Sph::ValidationCode::Valid &&
+                            clothInline.Diagnostics.Code == Cloth::ValidationCode::Valid &&
+                            metrics.ParityMismatches == 0 && metrics.RuntimeMilliseconds > 0.0;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Physics
@@ -0,0 +1,173 @@
+#include "Bench.PhysicsWorldBroadphaseScaling.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+import Extrinsic.Physics.World;
+
+namespace Intrinsic::Bench::Physics
+{
+    namespace
+    {
+        namespace PW = Extrinsic::Physics;
+
+        constexpr int kWarmupIterations = 1;
+        constexpr int kMeasuredIterations = 5;
+        constexpr float kSpacing = 0.9f;
+        constexpr float kRadius = 0.5f;
+
+        struct LatticeShape
+        {
+            int X{0};
+            int Y{0};
+            int Z{0};
+        };
+
+        // 1k and 10k dynamic unit spheres. Axis neighbours overlap by ~0.1,
+        // diagonal neighbours are separated by ~0.27, so the contact set is
+        // unambiguous for the brute-force oracle.
+        constexpr LatticeShape kSmallLattice{10, 10, 10};
+        constexpr LatticeShape kLargeLattice{25, 20, 20};
+
+        [[nodiscard]] float Jitter(int x, int y, int z) noexcept
+        {
+            const std::uint32_t hash = static_cast<std::uint32_t>(x) * 73856093u ^
+                                       static_cast<std::uint32_t>(y) * 19349663u ^
+                                       static_cast<std::uint32_t>(z) * 83492791u;
+            return (static_cast<float>(hash % 1000u) / 1000.0f - 0.5f) * 0.04f;
+        }
+
+        [[nodiscard]] std::vector<glm::vec3> MakeLattice(const LatticeShape& shape)
+        {
+            std::vector<glm::vec3> centers;
+            centers.reserve(static_cast<std::size_t>(shape.X * shape.Y * shape.Z));
+            for (int z = 0; z < shape.Z; ++z)
+            {
+                for (int y = 0; y < shape.Y; ++y)
+                {
+                    for (int x = 0; x < shape.X; ++x)
+                    {
+                        const float j = Jitter(x, y, z);
+                        centers.emplace_back(kSpacing * static_cast<float>(x) + j,
+                                             kSpacing * static_cast<float>(y) - j,
+                                             kSpacing * static_cast<float>(z) + 0.5f * j);
+                    }
+                }
+            }
+            return centers;
+        }
+
+        void PopulateWorld(PW::World& world, const std::vector<glm::vec3>& centers)
+        {
+            for (const glm::vec3& center : centers)
+            {
+                PW::BodyDescriptor body = PW::MakeDynamicBody(1.0f);
+                body.Pose.Position = center;
+                body.Shapes = {PW::MakeSphere(kRadius)};
+                (void)world.AddBody(body);
+            }
+        }
+
+        struct TimedRun
+        {
+            double MedianMilliseconds{0.0};
+            PW::CollisionResult Last{};
+        };
+
+        [[nodiscard]] TimedRun TimeCollision(const PW::World& world)
+        {
+            for (int i = 0; i < kWarmupIterations; ++i)
+            {
+                (void)world.ComputeCollisionContacts();
+            }
+
+            std::array<double, kMeasuredIterations> samples{};
+            TimedRun run{};
+            for (int i = 0; i < kMeasuredIterations; ++i)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                run.Last = world.ComputeCollisionContacts();
+                const auto t1 = std::chrono::steady_clock::now();
+                samples[static_cast<std::size_t>(i)] =
+                    static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) * 1.0e-6;
+            }
+            std::sort(samples.begin(), samples.end());
+            run.MedianMilliseconds = samples[samples.size() / 2u];
+            return run;
+        }
+
+        // All-pairs sphere overlap oracle over body slot indices.
+        [[nodiscard]] std::set<std::pair<std::uint32_t, std::uint32_t>> OracleContacts(
+            const std::vector<glm::vec3>& centers)
+        {
+            std::set<std::pair<std::uint32_t, std::uint32_t>> pairs;
+            const float limit = 2.0f * kRadius;
+            for (std::uint32_t i = 0u; i < centers.size(); ++i)
+            {
+                for (std::uint32_t j = i + 1u; j < centers.size(); ++j)
+                {
+                    if (glm::length(centers[j] - centers[i]) < limit)
+                        pairs.emplace(i, j);
+                }
+            }
+            return pairs;
+        }
+    } // namespace
+
+    PhysicsWorldBroadphaseScalingMetrics RunPhysicsWorldBroadphaseScaling()
+    {
+        PhysicsWorldBroadphaseScalingMetrics metrics{};
+
+        const std::vector<glm::vec3> smallCenters = MakeLattice(kSmallLattice);
+        const std::vector<glm::vec3> largeCenters = MakeLattice(kLargeLattice);
+
+        PW::World smallWorld;
+        PW::World largeWorld;
+        PopulateWorld(smallWorld, smallCenters);
+        PopulateWorld(largeWorld, largeCenters);
+
+        const TimedRun small = TimeCollision(smallWorld);
+        const TimedRun large = TimeCollision(largeWorld);
+
+        std::set<std::pair<std::uint32_t, std::uint32_t>> observed;
+        for (const PW::ContactRecord& contact : small.Last.Contacts)
+            observed.emplace(contact.A.Body.Index, contact.B.Body.Index);
+        const auto oracle = OracleContacts(smallCenters);
+
+        std::size_t mismatches = 0u;
+        for (const auto& pair : oracle)
+            mismatches += observed.count(pair) == 0u ? 1u : 0u;
+        for (const auto& pair : observed)
+            mismatches += oracle.count(pair) == 0u ? 1u : 0u;
+
+        metrics.SmallBodyCount = smallCenters.size();
+        metrics.LargeBodyCount = largeCenters.size();
+        metrics.SmallMedianRuntimeMilliseconds = small.MedianMilliseconds;
+        metrics.LargeMedianRuntimeMilliseconds = large.MedianMilliseconds;
+        metrics.RuntimeMilliseconds = large.MedianMilliseconds;
+        metrics.ThroughputItemsPerSecond = large.MedianMilliseconds > 0.0
+            ? static_cast<double>(largeCenters.size()) / (large.MedianMilliseconds * 1.0e-3)
+            : 0.0;
+        metrics.RuntimeScalingRatio = small.MedianMilliseconds > 0.0
+            ? large.MedianMilliseconds / small.MedianMilliseconds
+            : 0.0;
+        metrics.SmallCandidatePairs = small.Last.Candidates.size();
+        metrics.LargeCandidatePairs = large.Last.Candidates.size();
+        metrics.LargeContactCount = large.Last.Contacts.size();
+        metrics.SmallOracleContactCount = oracle.size();
+        metrics.SmallOracleMismatches = mismatches;
+        metrics.QualityErrorL2 = std::sqrt(static_cast<double>(mismatches));
+        metrics.Succeeded = small.Last.Diagnostics.Status == PW::ValidationStatus::Valid &&
+                            large.Last.Diagnostics.Status == PW::ValidationStatus::Valid &&
+                            !oracle.empty() && mismatches == 0u;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Physics
@@ -0,0 +1,182 @@
+#include "Bench.PhysicsWorldHotStoreScaling.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+import Extrinsic.Physics.World;
+
+namespace Intrinsic::Bench::Physics
+{
+    namespace
+    {
+        namespace PW = Extrinsic::Physics;
+
+        constexpr int kWarmupIterations = 1;
+        constexpr int kMeasuredIterations = 5;
+        constexpr int kDeterminismSteps = 8;
+        constexpr float kSpacing = 0.95f;
+        constexpr float kRadius = 0.5f;
+        constexpr float kDeltaSeconds = 1.0f / 120.0f;
+
+        struct LatticeShape
+        {
+            int X{0};
+            int Y{0};
+            int Z{0};
+        };
+
+        // 1k / 10k / 100k dynamic spheres; axis neighbours overlap by 0.05
+        // so every step integrates and resolves contacts.
+        constexpr LatticeShape kSmallLattice{10, 10, 10};
+        constexpr LatticeShape kMediumLattice{25, 20, 20};
+        constexpr LatticeShape kLargeLattice{50, 50, 40};
+
+        [[nodiscard]] glm::vec3 InitialVelocity(int x, int y, int z) noexcept
+        {
+            const std::uint32_t hash = static_cast<std::uint32_t>(x) * 73856093u ^
+                                       static_cast<std::uint32_t>(y) * 19349663u ^
+                                       static_cast<std::uint32_t>(z) * 83492791u;
+            const float u = static_cast<float>(hash % 1000u) / 1000.0f - 0.5f;
+            const float v = static_cast<float>((hash / 1000u) % 1000u) / 1000.0f - 0.5f;
+            return glm::vec3{u, 0.5f * v, -u} * 0.2f;
+        }
+
+        void PopulateWorld(PW::World& world, const LatticeShape& shape)
+        {
+            for (int z = 0; z < shape.Z; ++z)
+            {
+                for (int y = 0; y < shape.Y; ++y)
+                {
+                    for (int x = 0; x < shape.X; ++x)
+                    {
+                        PW::BodyDescriptor body = PW::MakeDynamicBody(1.0f);
+                        body.Pose.Position = glm::vec3{static_cast<float>(x),
+                                                       static_cast<float>(y),
+                                                       static_cast<float>(z)} * kSpacing;
+                        body.LinearVelocity = InitialVelocity(x, y, z);
+                        body.AngularVelocity = glm::vec3{0.0f, 0.5f, 0.0f};
+                        body.LinearDamping = 0.05f;
+                        body.Shapes = {PW::MakeSphere(kRadius)};
+                        (void)world.AddBody(body);
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] PW::StepInput BenchStep() noexcept
+        {
+            PW::StepInput input{};
+            input.DeltaSeconds = kDeltaSeconds;
+            input.Gravity = glm::vec3{0.0f};
+            return input;
+        }
+
+        [[nodiscard]] PW::SolverSettings BenchSettings() noexcept
+        {
+            PW::SolverSettings settings{};
+            settings.MaxIterations = 4u;
+            settings.EnableSleep = false;
+            return settings;
+        }
+
+        template <typename F>
+        [[nodiscard]] double MedianMilliseconds(F&& run)
+        {
+            for (int i = 0; i < kWarmupIterations; ++i)
+            {
+                run();
+            }
+
+            std::array<double, kMeasuredIterations> samples{};
+            for (int i = 0; i < kMeasuredIterations; ++i)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                run();
+                const auto t1 = std::chrono::steady_clock::now();
+                samples[static_cast<std::size_t>(i)] =
+                    static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) * 1.0e-6;
+            }
+            std::sort(samples.begin(), samples.end());
+            return samples[samples.size() / 2u];
+        }
+
+        [[nodiscard]] PhysicsWorldHotStoreScalingTier RunTier(const LatticeShape& shape, bool& valid)
+        {
+            PW::World world;
+            PopulateWorld(world, shape);
+
+            PhysicsWorldHotStoreScalingTier tier{};
+            tier.BodyCount = world.BodyCount();
+            tier.IntegrateMedianMilliseconds = MedianMilliseconds(
+                [&world, &valid]
+                {
+                    valid = valid && world.Step(BenchStep()).Status == PW::ValidationStatus::Valid;
+                });
+
+            PW::SolveStepDiagnostics last{};
+            tier.SolveStepMedianMilliseconds = MedianMilliseconds(
+                [&world, &last]
+                {
+                    last = world.SolveStep(BenchStep(), BenchSettings());
+                });
+            valid = valid && last.Status == PW::ValidationStatus::Valid &&
+                    last.Solve != PW::SolveStatus::Degraded;
+            tier.ContactsSolved = last.ContactsSolved;
+            tier.SolveStepBodiesPerSecond = tier.SolveStepMedianMilliseconds > 0.0
+                ? static_cast<double>(tier.BodyCount) / (tier.SolveStepMedianMilliseconds * 1.0e-3)
+                : 0.0;
+            return tier;
+        }
+
+        // Two identically built 1k worlds must evolve bitwise-identically.
+        [[nodiscard]] std::size_t CountDeterminismMismatches()
+        {
+            PW::World first;
+            PW::World second;
+            PopulateWorld(first, kSmallLattice);
+            PopulateWorld(second, kSmallLattice);
+            for (int step = 0; step < kDeterminismSteps; ++step)
+            {
+                (void)first.SolveStep(BenchStep(), BenchSettings());
+                (void)second.SolveStep(BenchStep(), BenchSettings());
+            }
+
+            std::size_t mismatches = 0u;
+            for (std::uint32_t index = 0u; index < first.BodyCount(); ++index)
+            {
+                const PW::BodyHandle handle{index, 1u};
+                const PW::BodyDescriptor* a = first.GetBody(handle);
+                const PW::BodyDescriptor* b = second.GetBody(handle);
+                if (a == nullptr || b == nullptr || a->Pose.Position != b->Pose.Position ||
+                    a->LinearVelocity != b->LinearVelocity || a->Pose.Rotation != b->Pose.Rotation)
+                {
+                    ++mismatches;
+                }
+            }
+            return mismatches;
+        }
+    } // namespace
+
+    PhysicsWorldHotStoreScalingMetrics RunPhysicsWorldHotStoreScaling()
+    {
+        PhysicsWorldHotStoreScalingMetrics metrics{};
+
+        bool valid = true;
+        metrics.Small = RunTier(kSmallLattice, valid);
+        metrics.Medium = RunTier(kMediumLattice, valid);
+        metrics.Large = RunTier(kLargeLattice, valid);
+        metrics.DeterminismMismatches = CountDeterminismMismatches();
+
+        metrics.RuntimeMilliseconds = metrics.Large.SolveStepMedianMilliseconds;
+        metrics.ThroughputItemsPerSecond = metrics.Large.SolveStepBodiesPerSecond;
+        metrics.QualityErrorL2 = std::sqrt(static_cast<double>(metrics.DeterminismMismatches));
+        metrics.Succeeded = valid && metrics.DeterminismMismatches == 0u && metrics.Small.ContactsSolved > 0u;
+        return metrics;
+    }
+} // namespace Intrinsic::Bench::Physics
@@ -2,8 +2,10 @@
 
 #include "SphFluidReference.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <vector>
 
 namespace Intrinsic::Bench::Physics
@@ -14,18 +16,20 @@ namespace Intrinsic::Bench::Physics
         constexpr int kMeasuredIterations = 4;
         constexpr int kColumnSteps = 30;
         constexpr double kSpacing = 0.05;
+        constexpr std::size_t kOracleSamples = 64;
 
         using namespace Intrinsic::Methods::Physics::SphFluidReference;
 
-        [[nodiscard]] auto MakeGrid(std::size_t side, double yOffset) -> std::vector<ParticleState>
+        [[nodiscard]] auto MakeLattice(std::size_t sideX, std::size_t sideY, std::size_t sideZ, double yOffset)
+            -> std::vector<ParticleState>
         {
             std::vector<ParticleState> particles;
-            particles.reserve(side * side * side);
-            for (std::size_t z = 0; z < side; ++z)
+            particles.reserve(sideX * sideY * sideZ);
+            for (std::size_t z = 0; z < sideZ; ++z)
             {
-                for (std::size_t y = 0; y < side; ++y)
+                for (std::size_t y = 0; y < sideY; ++y)
                 {
-                    for (std::size_t x = 0; x < side; ++x)
+                    for (std::size_t x = 0; x < sideX; ++x)
                     {
                         ParticleState particle{};
                         particle.Position = Vec3{static_cast<double>(x) * kSpacing,
@@ -38,6 +42,11 @@ namespace Intrinsic::Bench::Physics
             return particles;
         }
 
+        [[nodiscard]] auto MakeGrid(std::size_t side, double yOffset) -> std::vector<ParticleState>
+        {
+            return MakeLattice(side, side, side, yOffset);
+        }
+
         [[nodiscard]] auto BaseParams() -> StepParams
         {
             StepParams params{};
@@ -48,6 +57,99 @@ namespace Intrinsic::Bench::Physics
             return params;
         }
 
+        [[nodiscard]] auto CountListMismatches(const NeighborList& lhs, const NeighborList& rhs) -> std::size_t
+        {
+            if (lhs.Offsets.size() != rhs.Offsets.size())
+            {
+                return lhs.Offsets.size() > rhs.Offsets.size() ? lhs.Offsets.size() - rhs.Offsets.size()
+                                                              : rhs.Offsets.size() - lhs.Offsets.size();
+            }
+            std::size_t mismatches = 0;
+            for (std::size_t i = 0; i + 1 < lhs.Offsets.size(); ++i)
+            {
+                const std::size_t count = lhs.Offsets[i + 1] - lhs.Offsets[i];
+                bool equal = count == rhs.Offsets[i + 1] - rhs.Offsets[i];
+                for (std::size_t k = 0; equal && k < count; ++k)
+                {
+                    equal = lhs.Indices[lhs.Offsets[i] + k] == rhs.Indices[rhs.Offsets[i] + k];
+                }
+                mismatches += equal ? 0u : 1u;
+            }
+            return mismatches;
+        }
+
+        [[nodiscard]] auto CountStateMismatches(const std::vector<ParticleState>& lhs,
+                                                const std::vector<ParticleState>& rhs) -> std::size_t
+        {
+            std::size_t mismatches = 0;
+            for (std::size_t i = 0; i < lhs.size(); ++i)
+            {
+                const bool equal = lhs[i].Position.X == rhs[i].Position.X && lhs[i].Position.Y == rhs[i].Position.Y &&
+                                   lhs[i].Position.Z == rhs[i].Position.Z && lhs[i].Velocity.X == rhs[i].Velocity.X &&
+                                   lhs[i].Velocity.Y == rhs[i].Velocity.Y && lhs[i].Velocity.Z == rhs[i].Velocity.Z;
+                mismatches += equal ? 0u : 1u;
+            }
+            return mismatches;
+        }
+
+        // Brute-force scan of a strided particle sample against the grid
+        // list; a full O(N^2) oracle is out of reach at 200k particles.
+        [[nodiscard]] auto CountSampledMismatches(const std::vector<ParticleState>& particles,
+                                                  const NeighborList& grid,
+                                                  double h) -> std::size_t
+        {
+            std::size_t mismatches = 0;
+            const std::size_t stride = std::max<std::size_t>(1, particles.size() / kOracleSamples);
+            std::vector<std::uint32_t> expected;
+            for (std::size_t i = 0; i < particles.size(); i += stride)
+            {
+                expected.clear();
+                for (std::size_t j = 0; j < particles.size(); ++j)
+                {
+                    if (Length(particles[i].Position - particles[j].Position) < h)
+                    {
+                        expected.push_back(static_cast<std::uint32_t>(j));
+                    }
+                }
+                const std::size_t count = grid.Offsets[i + 1] - grid.Offsets[i];
+                bool equal = count == expected.size();
+                for (std::size_t k = 0; equal && k < count; ++k)
+                {
+                    equal = grid.Indices[grid.Offsets[i] + k] == expected[k];
+                }
+                mismatches += equal ? 0u : 1u;
+            }
+            return mismatches;
+        }
+
+        // One timed Step of a falling slab resting on a floor plane, plus the
+        // sampled neighbor oracle on its initial state.
+        void RunLargeSlab(std::size_t sideX,
+                          std::size_t sideY,
+                          std::size_t sideZ,
+                          std::size_t& particleCount,
+                          double& stepMilliseconds,
+                          SphFluidReferenceSmokeMetrics& metrics,
+                          bool& valid)
+        {
+            const auto slab = MakeLattice(sideX, sideY, sideZ, 0.0);
+            StepParams params = BaseParams();
+            params.Gravity = Vec3{0.0, -9.80665, 0.0};
+            params.Viscosity = 0.2;
+            params.Boundaries = {MakeBoundaryPlane(Vec3{0.0, 1.0, 0.0}, 0.0)};
+
+            const auto t0 = std::chrono::steady_clock::now();
+            const StepResult result = Step(slab, params);
+            const auto t1 = std::chrono::steady_clock::now();
+
+            particleCount = slab.size();
+            stepMilliseconds =
+                static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) * 1.0e-6;
+            valid = valid && result.Diagnostics.Code == ValidationCode::Valid && result.Diagnostics.Stable;
+            metrics.NeighborOracleMismatches +=
+                CountSampledMismatches(slab, BuildNeighborList(slab, params), params.SmoothingLength);
+        }
+
         // Quality: interior-particle relative density error on a static 5^3
         // lattice (kernel discretization accuracy), plus a dynamic 3^3 toy
         // column drop for stability diagnostics.
@@ -63,12 +165,21 @@ namespace Intrinsic::Bench::Physics
             metrics.QualityErrorL2 =
                 std::abs(densities[center] - gridParams.RestDensity) / gridParams.RestDensity;
 
+            StepParams oracleParams = gridParams;
+            oracleParams.Neighbors = NeighborSearch::BruteForce;
+            metrics.NeighborOracleMismatches =
+                CountListMismatches(BuildNeighborList(grid, gridParams), BuildNeighborList(grid, oracleParams));
+
             auto column = MakeGrid(3, 0.2);
             StepParams columnParams = BaseParams();
             columnParams.Gravity = Vec3{0.0, -9.80665, 0.0};
             columnParams.Viscosity = 0.2;
             columnParams.Boundaries = {MakeBoundaryPlane(Vec3{0.0, 1.0, 0.0}, 0.0)};
 
+            StepParams columnOracleParams = columnParams;
+            columnOracleParams.Neighbors = NeighborSearch::BruteForce;
+            auto oracleColumn = column;
+
             bool valid = true;
             Diagnostics lastDiagnostics{};
             for (int i = 0; i < kColumnSteps; ++i)
@@ -78,13 +189,16 @@ namespace Intrinsic::Bench::Physics
                         result.Diagnostics.Stable;
                 lastDiagnostics = result.Diagnostics;
                 column = result.Particles;
+                oracleColumn = Step(oracleColumn, columnOracleParams).Particles;
             }
+            metrics.StateOracleMismatches = CountStateMismatches(column, oracleColumn);
 
             metrics.ColumnMaxCompression = lastDiagnostics.MaxCompression;
             metrics.ColumnAverageDensityError = lastDiagnostics.AverageDensityError;
             metrics.ColumnMaxNeighborCount = lastDiagnostics.MaxNeighborCount;
             metrics.ColumnStable = valid;
-            metrics.Succeeded = valid && metrics.QualityErrorL2 <= 5.0e-2;
+            metrics.Succeeded = valid && metrics.QualityErrorL2 <= 5.0e-2 &&
+                                metrics.NeighborOracleMismatches == 0 && metrics.StateOracleMismatches == 0;
             return metrics;
         }
     } // namespace
@@ -106,6 +220,13 @@ namespace Intrinsic::Bench::Physics
 
         const auto totalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
         last.RuntimeMilliseconds = (static_cast<double>(totalNs) / static_cast<double>(kMeasuredIterations)) * 1.0e-6;
+
+        // Scale runs are timed once each and reported as diagnostics so the
+        // smoke runtime threshold keeps tracking the small workload.
+        bool valid = true;
+        RunLargeSlab(50, 50, 20, last.LargeParticleCount, last.LargeStepMilliseconds, last, valid);
+        RunLargeSlab(100, 50, 40, last.HugeParticleCount, last.HugeStepMilliseconds, last, valid);
+        last.Succeeded = last.Succeeded && valid && last.NeighborOracleMismatches == 0;
         return last;
     }
 } // namespace Intrinsic::Bench::Physics
@@ -2,7 +2,9 @@
 //
 // Compares fresh graph rebuilds against steady-state RenderGraph::Reset()
 // rebuilds on deterministic pass-heavy work. Allocation counts are measured
-// with a scoped global-new probe and reported as diagnostics.
+// with a scoped global-new probe and reported as diagnostics. A short-lived
+// transient chain graph is also compiled and bound into Null-device placed
+// memory to report naive vs lifetime-aliased transient heap bytes.
 #pragma once
 
 #include <cstdint>
@@ -35,6 +37,13 @@ namespace Intrinsic::Bench::Rendering
         std::uint64_t ReusedDeclareCompileAllocations{0u};
         std::uint64_t FreshDeclareCompileBytes{0u};
         std::uint64_t ReusedDeclareCompileBytes{0u};
+        std::uint32_t TransientChainPassCount{0u};
+        std::uint32_t TransientHeapCount{0u};
+        std::uint32_t AliasReuseBarrierCount{0u};
+        std::uint64_t TransientNaiveBytes{0u};
+        std::uint64_t TransientPlacedPeakBytes{0u};
+        std::uint64_t NullDevicePeakMemoryBlockBytes{0u};
+        std::uint64_t NullDeviceAliasedBytes{0u};
         bool Succeeded{false};
     };
 
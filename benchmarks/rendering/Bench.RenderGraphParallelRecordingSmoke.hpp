@@ -3,6 +3,11 @@
 // Compares serial executor pass recording against scheduler-backed parallel
 // record/join on a deterministic pass-heavy CPU/null graph. This records
 // benchmark evidence only; Vulkan smoke remains the operational gate.
+//
+// A second wide, unbalanced lane graph (one heavy pass per topological layer,
+// staggered across independent lanes) compares dependency-driven record wall
+// time against its critical path and against the bound a layer-join executor
+// could reach, where every layer waits for its slowest pass.
 #pragma once
 
 #include <cstdint>
@@ -32,8 +37,29 @@ namespace Intrinsic::Bench::Rendering
         std::uint32_t ParallelMaxLayerWidth{0u};
         std::uint32_t ParallelWorkerTaskCount{0u};
         std::uint32_t ParallelCallerRecordCount{0u};
+        std::uint32_t ParallelRootPassCount{0u};
         std::uint64_t SerialChecksum{0u};
         std::uint64_t ParallelChecksum{0u};
+        double UnbalancedSerialRecordMilliseconds{0.0};
+        double UnbalancedParallelRecordMilliseconds{0.0};
+        double UnbalancedCriticalPathMilliseconds{0.0};
+        double UnbalancedLayerBarrierBoundMilliseconds{0.0};
+        double UnbalancedWorkBoundMilliseconds{0.0};
+        double UnbalancedWallToCriticalPathRatio{0.0};
+        double UnbalancedLayerBarrierToCriticalPathRatio{0.0};
+        std::uint32_t UnbalancedLaneCount{0u};
+        std::uint32_t UnbalancedDepth{0u};
+        std::uint32_t UnbalancedPassCount{0u};
+        std::uint32_t UnbalancedHeavyOpsPerPass{0u};
+        std::uint32_t UnbalancedLayerCount{0u};
+        std::uint32_t UnbalancedRootPassCount{0u};
+        std::uint32_t UnbalancedWorkerTaskCount{0u};
+        std::uint32_t UnbalancedCallerHelpedTaskCount{0u};
+        std::uint64_t UnbalancedCriticalPathOps{0u};
+        std::uint64_t UnbalancedLayerBarrierOps{0u};
+        std::uint64_t UnbalancedTotalOps{0u};
+        std::uint64_t UnbalancedSerialChecksum{0u};
+        std::uint64_t UnbalancedParallelChecksum{0u};
         bool Succeeded{false};
     };
 
@@ -9,11 +9,16 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <memory>
 #include <new>
 #include <string>
+#include <vector>
 
+import Extrinsic.Backends.Null;
 import Extrinsic.Graphics.RenderGraph;
 import Extrinsic.RHI.Descriptors;
+import Extrinsic.RHI.Device;
+import Extrinsic.RHI.Handles;
 
 namespace
 {
@@ -238,6 +243,7 @@ namespace Intrinsic::Bench::Rendering
         constexpr std::uint32_t kPassCount = 192u;
         constexpr std::uint32_t kTextureCount = 48u;
         constexpr std::uint32_t kBufferCount = 32u;
+        constexpr std::uint32_t kTransientChainPassCount = 64u;
 
         struct CompileSummary
         {
@@ -255,6 +261,17 @@ namespace Intrinsic::Bench::Rendering
             CompileSummary Summary{};
         };
 
+        struct TransientMemorySummary
+        {
+            std::uint32_t HeapCount{0u};
+            std::uint32_t AliasReuseBarrierCount{0u};
+            std::uint64_t NaiveBytes{0u};
+            std::uint64_t PlacedPeakBytes{0u};
+            std::uint64_t NullDevicePeakMemoryBlockBytes{0u};
+            std::uint64_t NullDeviceAliasedBytes{0u};
+            bool Succeeded{false};
+        };
+
         [[nodiscard]] std::string IndexedName(const char* prefix, const std::uint32_t index)
         {
             return std::string{prefix} + std::to_string(index);
@@ -346,6 +363,129 @@ namespace Intrinsic::Bench::Rendering
             return summary;
         }
 
+        // Every chain texture lives for three passes and every chain buffer
+        // for two, so lifetime aliasing needs only three plus two heaps.
+        void DeclareTransientChainGraph(Graphics::RenderGraph& graph)
+        {
+            std::array<Graphics::TextureRef, kTransientChainPassCount> textures{};
+            std::array<Graphics::BufferRef, kTransientChainPassCount> buffers{};
+
+            for (std::uint32_t index = 0u; index < kTransientChainPassCount; ++index)
+            {
+                RHI::TextureDesc textureDesc{};
+                textureDesc.Width = 64u + ((index % 4u) * 32u);
+                textureDesc.Height = 64u;
+                textureDesc.Usage = RHI::TextureUsage::Sampled | RHI::TextureUsage::Storage;
+                textures[index] = graph.CreateTexture(IndexedName("ChainTexture", index), textureDesc);
+
+                RHI::BufferDesc bufferDesc{};
+                bufferDesc.SizeBytes = 2048u + (static_cast<std::uint64_t>(index % 3u) * 1024u);
+                bufferDesc.Usage = RHI::BufferUsage::Storage;
+                buffers[index] = graph.CreateBuffer(IndexedName("ChainBuffer", index), bufferDesc);
+            }
+
+            for (std::uint32_t passIndex = 0u; passIndex < kTransientChainPassCount; ++passIndex)
+            {
+                (void)graph.AddPass(IndexedName("ChainPass", passIndex),
+                                    [&, passIndex](Graphics::RenderGraphBuilder& builder) {
+                    if (passIndex > 0u)
+                    {
+                        (void)builder.Read(textures[passIndex - 1u], Graphics::TextureUsage::ShaderRead);
+                        (void)builder.Read(buffers[passIndex - 1u], Graphics::BufferUsage::ShaderRead);
+                    }
+                    if (passIndex > 1u)
+                    {
+                        (void)builder.Read(textures[passIndex - 2u], Graphics::TextureUsage::ShaderRead);
+                    }
+
+                    (void)builder.Write(textures[passIndex], Graphics::TextureUsage::ShaderWrite);
+                    (void)builder.Write(buffers[passIndex], Graphics::BufferUsage::ShaderWrite);
+                    builder.SideEffect();
+                });
+            }
+        }
+
+        [[nodiscard]] std::uint64_t PlacementBlockBytes(
+            const std::vector<Graphics::TransientResourcePlacement>& placements)
+        {
+            std::uint64_t blockBytes = 0u;
+            for (const Graphics::TransientResourcePlacement& placement : placements)
+            {
+                blockBytes = std::max(blockBytes, placement.OffsetBytes + placement.SizeBytes);
+            }
+            return blockBytes;
+        }
+
+        // Binds the compiled placement plan into one Null-device memory block
+        // per resource domain and reads back the device's placed-byte totals.
+        [[nodiscard]] TransientMemorySummary MeasureTransientChainMemory()
+        {
+            Graphics::RenderGraph graph;
+            DeclareTransientChainGraph(graph);
+            const auto compiled = graph.Compile();
+            if (!compiled.has_value())
+            {
+                return {};
+            }
+
+            TransientMemorySummary summary{};
+            summary.HeapCount = compiled->TransientTextureHeapCount + compiled->TransientBufferHeapCount;
+            summary.NaiveBytes = compiled->TransientNaiveMemoryEstimateBytes;
+            summary.PlacedPeakBytes = compiled->TransientPlacedPeakMemoryEstimateBytes;
+            for (const Graphics::BarrierPacket& packet : compiled->BarrierPackets)
+            {
+                summary.AliasReuseBarrierCount += static_cast<std::uint32_t>(
+                    packet.TextureAliasReuseBarriers.size() + packet.BufferAliasReuseBarriers.size());
+            }
+
+            const std::unique_ptr<RHI::IDevice> device = Extrinsic::Backends::Null::CreateNullDevice();
+            const RHI::ResourceMemoryRequirements textureRequirements =
+                device->GetTextureMemoryRequirements(graph.GetTextureDescByIndex(0u)->Desc);
+            const RHI::ResourceMemoryRequirements bufferRequirements =
+                device->GetBufferMemoryRequirements(graph.GetBufferDescByIndex(0u)->Desc);
+            const RHI::MemoryBlockHandle textureBlock = device->CreateMemoryBlock({
+                .SizeBytes = PlacementBlockBytes(compiled->TextureTransientPlacements),
+                .AlignmentBytes = textureRequirements.AlignmentBytes,
+                .MemoryTypeBits = textureRequirements.MemoryTypeBits,
+                .DebugName = "Bench.TransientChain.Textures",
+            });
+            const RHI::MemoryBlockHandle bufferBlock = device->CreateMemoryBlock({
+                .SizeBytes = PlacementBlockBytes(compiled->BufferTransientPlacements),
+                .AlignmentBytes = bufferRequirements.AlignmentBytes,
+                .MemoryTypeBits = bufferRequirements.MemoryTypeBits,
+                .DebugName = "Bench.TransientChain.Buffers",
+            });
+
+            std::uint32_t placedCount = 0u;
+            for (const Graphics::TransientResourcePlacement& placement : compiled->TextureTransientPlacements)
+            {
+                const RHI::TextureHandle handle = device->CreatePlacedTexture({
+                    .Desc = graph.GetTextureDescByIndex(placement.ResourceIndex)->Desc,
+                    .Placement = {.Block = textureBlock, .OffsetBytes = placement.OffsetBytes},
+                });
+                placedCount += handle.IsValid() ? 1u : 0u;
+            }
+            for (const Graphics::TransientResourcePlacement& placement : compiled->BufferTransientPlacements)
+            {
+                const RHI::BufferHandle handle = device->CreatePlacedBuffer({
+                    .Desc = graph.GetBufferDescByIndex(placement.ResourceIndex)->Desc,
+                    .Placement = {.Block = bufferBlock, .OffsetBytes = placement.OffsetBytes},
+                });
+                placedCount += handle.IsValid() ? 1u : 0u;
+            }
+
+            // All chain resources stay alive on the device at once, so the
+            // bytes the heap plan folded together show up as aliased bytes.
+            const RHI::PlacedMemoryStats stats = device->GetPlacedMemoryStats();
+            summary.NullDevicePeakMemoryBlockBytes = stats.PeakMemoryBlockBytes;
+            summary.NullDeviceAliasedBytes = stats.AliasedBytes;
+            summary.Succeeded = textureBlock.IsValid() && bufferBlock.IsValid() &&
+                placedCount == compiled->TextureTransientPlacements.size() +
+                                   compiled->BufferTransientPlacements.size() &&
+                stats.PlacedResourceBytes == summary.NaiveBytes;
+            return summary;
+        }
+
         [[nodiscard]] AllocationProbe MeasureFreshDeclareAllocations()
         {
             AllocationProbe allocations{};
@@ -467,6 +607,7 @@ namespace Intrinsic::Bench::Rendering
         const CompileMeasurement fresh = MeasureFreshDeclareCompile();
         const CompileMeasurement reused = MeasureReusedDeclareCompile();
         const double qualityErrorL2 = std::sqrt(CountQualityError(fresh.Summary, reused.Summary));
+        const TransientMemorySummary transientMemory = MeasureTransientChainMemory();
 
         FramegraphScratchReuseSmokeMetrics metrics{};
         metrics.RuntimeMilliseconds = reused.Milliseconds;
@@ -486,6 +627,13 @@ namespace Intrinsic::Bench::Rendering
         metrics.ReusedDeclareCompileAllocations = reused.Allocations.Count;
         metrics.FreshDeclareCompileBytes = fresh.Allocations.Bytes;
         metrics.ReusedDeclareCompileBytes = reused.Allocations.Bytes;
+        metrics.TransientChainPassCount = kTransientChainPassCount;
+        metrics.TransientHeapCount = transientMemory.HeapCount;
+        metrics.AliasReuseBarrierCount = transientMemory.AliasReuseBarrierCount;
+        metrics.TransientNaiveBytes = transientMemory.NaiveBytes;
+        metrics.TransientPlacedPeakBytes = transientMemory.PlacedPeakBytes;
+        metrics.NullDevicePeakMemoryBlockBytes = transientMemory.NullDevicePeakMemoryBlockBytes;
+        metrics.NullDeviceAliasedBytes = transientMemory.NullDeviceAliasedBytes;
         metrics.Succeeded = fresh.Summary.Succeeded &&
             reused.Summary.Succeeded &&
             metrics.PassCount == kPassCount &&
@@ -494,6 +642,12 @@ namespace Intrinsic::Bench::Rendering
             metrics.ReusedDeclareAllocations < metrics.FreshDeclareAllocations &&
             metrics.ReusedDeclareCompileAllocations < metrics.FreshDeclareCompileAllocations &&
             qualityErrorL2 == 0.0 &&
+            transientMemory.Succeeded &&
+            metrics.TransientHeapCount > 0u &&
+            metrics.TransientHeapCount < 2u * kTransientChainPassCount &&
+            metrics.TransientPlacedPeakBytes < metrics.TransientNaiveBytes &&
+            metrics.NullDevicePeakMemoryBlockBytes == metrics.TransientPlacedPeakBytes &&
+            metrics.NullDeviceAliasedBytes == metrics.TransientNaiveBytes - metrics.TransientPlacedPeakBytes &&
             fresh.Milliseconds > 0.0 &&
             reused.Milliseconds > 0.0;
         return metrics;
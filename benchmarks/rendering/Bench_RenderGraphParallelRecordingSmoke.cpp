@@ -12,6 +12,7 @@
 import Extrinsic.Core.Error;
 import Extrinsic.Core.Tasks;
 import Extrinsic.Graphics.RenderGraph;
+import Extrinsic.RHI.Descriptors;
 
 namespace Intrinsic::Bench::Rendering
 {
@@ -26,6 +27,10 @@ namespace Intrinsic::Bench::Rendering
         constexpr std::uint32_t kPassCount = 256u;
         constexpr std::uint32_t kSchedulerWorkerCount = 2u;
         constexpr std::uint32_t kRecordOpsPerPass = 256u;
+        constexpr std::uint32_t kUnbalancedLaneCount = 8u;
+        constexpr std::uint32_t kUnbalancedDepth = 32u;
+        constexpr std::uint32_t kUnbalancedPassCount = kUnbalancedLaneCount * kUnbalancedDepth;
+        constexpr std::uint32_t kUnbalancedHeavyOpsPerPass = 4096u;
 
         class SchedulerScope
         {
@@ -70,11 +75,118 @@ namespace Intrinsic::Bench::Rendering
             return *compiled;
         }
 
-        [[nodiscard]] std::uint64_t RecordSyntheticPass(const std::uint32_t passIndex) noexcept
+        // Lanes are independent chains: pass (depth, lane) reads the texture
+        // its lane predecessor wrote. Pass indices follow declaration order,
+        // so passIndex = depth * kUnbalancedLaneCount + lane.
+        [[nodiscard]] Graphics::CompiledRenderGraph CompileUnbalancedLaneGraph()
+        {
+            Graphics::RenderGraph graph{};
+            std::vector<Graphics::TextureRef> previous{};
+            std::vector<Graphics::TextureRef> current{};
+            for (std::uint32_t depth = 0u; depth < kUnbalancedDepth; ++depth)
+            {
+                current.clear();
+                for (std::uint32_t lane = 0u; lane < kUnbalancedLaneCount; ++lane)
+                {
+                    const Graphics::TextureRef output = graph.CreateTexture(
+                        "UnbalancedLane" + std::to_string(lane) + "." + std::to_string(depth),
+                        Extrinsic::RHI::TextureDesc{});
+                    const bool hasInput = depth > 0u;
+                    const Graphics::TextureRef input = hasInput ? previous[lane] : Graphics::TextureRef{};
+                    (void)graph.AddPass(
+                        "UnbalancedBench" + std::to_string(depth) + "." + std::to_string(lane),
+                        [hasInput, input, output](Graphics::RenderGraphBuilder& builder)
+                        {
+                            if (hasInput)
+                            {
+                                (void)builder.Read(input, Graphics::TextureUsage::ShaderRead);
+                            }
+                            (void)builder.Write(output, Graphics::TextureUsage::ColorAttachmentWrite);
+                        },
+                        true);
+                    current.push_back(output);
+                }
+                previous.swap(current);
+            }
+
+            auto compiled = graph.Compile();
+            if (!compiled.has_value())
+            {
+                return Graphics::CompiledRenderGraph{};
+            }
+            return *compiled;
+        }
+
+        // One heavy pass per layer, staggered across lanes, so every layer is
+        // as slow as a heavy pass while each lane carries only
+        // kUnbalancedDepth / kUnbalancedLaneCount heavy passes.
+        [[nodiscard]] std::vector<std::uint32_t> BuildUnbalancedOpsByPass()
+        {
+            std::vector<std::uint32_t> opsByPass(kUnbalancedPassCount, kRecordOpsPerPass);
+            for (std::uint32_t depth = 0u; depth < kUnbalancedDepth; ++depth)
+            {
+                const std::uint32_t heavyLane = depth % kUnbalancedLaneCount;
+                opsByPass[depth * kUnbalancedLaneCount + heavyLane] = kUnbalancedHeavyOpsPerPass;
+            }
+            return opsByPass;
+        }
+
+        struct RecordCostBounds
+        {
+            std::uint64_t TotalOps = 0u;
+            std::uint64_t CriticalPathOps = 0u;
+            std::uint64_t LayerBarrierOps = 0u;
+        };
+
+        // Longest weighted path through the live successor CSR, plus the sum
+        // of per-layer maxima a layer-join executor would serialize on.
+        [[nodiscard]] RecordCostBounds MeasureRecordCostBounds(const Graphics::CompiledRenderGraph& compiled,
+                                                               const std::vector<std::uint32_t>& opsByPass)
+        {
+            RecordCostBounds bounds{};
+            if (compiled.PassSuccessorOffsets.size() != compiled.PassDeclarations.size() + 1u ||
+                opsByPass.size() < compiled.PassDeclarations.size())
+            {
+                return bounds;
+            }
+
+            std::vector<std::uint64_t> startOps(compiled.PassDeclarations.size(), 0u);
+            std::vector<std::uint64_t> layerMaxOps{};
+            for (const std::uint32_t passIndex : compiled.TopologicalOrder)
+            {
+                const std::uint64_t ops = opsByPass[passIndex];
+                const std::uint64_t finishOps = startOps[passIndex] + ops;
+                bounds.TotalOps += ops;
+                bounds.CriticalPathOps = std::max(bounds.CriticalPathOps, finishOps);
+                for (std::uint32_t edge = compiled.PassSuccessorOffsets[passIndex];
+                     edge < compiled.PassSuccessorOffsets[passIndex + 1u];
+                     ++edge)
+                {
+                    const std::uint32_t successor = compiled.PassSuccessors[edge];
+                    startOps[successor] = std::max(startOps[successor], finishOps);
+                }
+
+                const std::uint32_t layer = compiled.TopologicalLayerByPass[passIndex];
+                if (layer >= layerMaxOps.size())
+                {
+                    layerMaxOps.resize(static_cast<std::size_t>(layer) + 1u, 0u);
+                }
+                layerMaxOps[layer] = std::max(layerMaxOps[layer], ops);
+            }
+
+            for (const std::uint64_t ops : layerMaxOps)
+            {
+                bounds.LayerBarrierOps += ops;
+            }
+            return bounds;
+        }
+
+        [[nodiscard]] std::uint64_t RecordSyntheticPass(const std::uint32_t passIndex,
+                                                        const std::uint32_t opCount) noexcept
         {
             std::uint64_t value = 0x9E3779B97F4A7C15ull ^
                                   (static_cast<std::uint64_t>(passIndex + 1u) * 0x100000001B3ull);
-            for (std::uint32_t i = 0u; i < kRecordOpsPerPass; ++i)
+            for (std::uint32_t i = 0u; i < opCount; ++i)
             {
                 value ^= value >> 29u;
                 value *= 0xBF58476D1CE4E5B9ull;
@@ -95,6 +207,7 @@ namespace Intrinsic::Bench::Rendering
         }
 
         [[nodiscard]] std::uint64_t ExecuteSerial(const Graphics::CompiledRenderGraph& compiled,
+                                                  const std::vector<std::uint32_t>& opsByPass,
                                                   std::vector<std::uint64_t>& checksums,
                                                   bool& succeeded)
         {
@@ -102,11 +215,11 @@ namespace Intrinsic::Bench::Rendering
             Graphics::RenderGraphExecutor executor{};
             const Core::Result result = executor.Execute(
                 compiled,
-                [&checksums](const std::uint32_t passIndex)
+                [&opsByPass, &checksums](const std::uint32_t passIndex)
                 {
-                    if (passIndex < checksums.size())
+                    if (passIndex < checksums.size() && passIndex < opsByPass.size())
                     {
-                        checksums[passIndex] = RecordSyntheticPass(passIndex);
+                        checksums[passIndex] = RecordSyntheticPass(passIndex, opsByPass[passIndex]);
                     }
                 },
                 {});
@@ -115,6 +228,7 @@ namespace Intrinsic::Bench::Rendering
         }
 
         [[nodiscard]] std::uint64_t ExecuteParallel(const Graphics::CompiledRenderGraph& compiled,
+                                                    const std::vector<std::uint32_t>& opsByPass,
                                                     std::vector<std::uint64_t>& checksums,
                                                     Graphics::ParallelRecordStats& stats,
                                                     bool& succeeded)
@@ -124,14 +238,14 @@ namespace Intrinsic::Bench::Rendering
             Graphics::RenderGraphExecutor executor{};
             const Core::Result result = executor.ExecuteParallelRecordJoin(
                 compiled,
-                [&checksums](const std::uint32_t passIndex,
-                             const std::uint32_t) -> Core::Result
+                [&opsByPass, &checksums](const std::uint32_t passIndex,
+                                         const std::uint32_t) -> Core::Result
                 {
-                    if (passIndex >= checksums.size())
+                    if (passIndex >= checksums.size() || passIndex >= opsByPass.size())
                     {
                         return Core::Err(Core::ErrorCode::OutOfRange);
                     }
-                    checksums[passIndex] = RecordSyntheticPass(passIndex);
+                    checksums[passIndex] = RecordSyntheticPass(passIndex, opsByPass[passIndex]);
                     return Core::Ok();
                 },
                 {},
@@ -170,7 +284,11 @@ namespace Intrinsic::Bench::Rendering
     {
         SchedulerScope scheduler{kSchedulerWorkerCount};
         const Graphics::CompiledRenderGraph compiled = CompileIndependentPassGraph();
+        const std::vector<std::uint32_t> opsByPass(kPassCount, kRecordOpsPerPass);
         std::vector<std::uint64_t> checksums(kPassCount, 0u);
+        const Graphics::CompiledRenderGraph unbalanced = CompileUnbalancedLaneGraph();
+        const std::vector<std::uint32_t> unbalancedOpsByPass = BuildUnbalancedOpsByPass();
+        std::vector<std::uint64_t> unbalancedChecksums(kUnbalancedPassCount, 0u);
 
         Graphics::ParallelRecordStats warmupStats{};
         bool warmupSucceeded = true;
@@ -178,9 +296,18 @@ namespace Intrinsic::Bench::Rendering
         {
             bool serialOk = false;
             bool parallelOk = false;
-            (void)ExecuteSerial(compiled, checksums, serialOk);
-            (void)ExecuteParallel(compiled, checksums, warmupStats, parallelOk);
-            warmupSucceeded = warmupSucceeded && serialOk && parallelOk;
+            bool unbalancedSerialOk = false;
+            bool unbalancedParallelOk = false;
+            (void)ExecuteSerial(compiled, opsByPass, checksums, serialOk);
+            (void)ExecuteParallel(compiled, opsByPass, checksums, warmupStats, parallelOk);
+            (void)ExecuteSerial(unbalanced, unbalancedOpsByPass, unbalancedChecksums, unbalancedSerialOk);
+            (void)ExecuteParallel(unbalanced,
+                                  unbalancedOpsByPass,
+                                  unbalancedChecksums,
+                                  warmupStats,
+                                  unbalancedParallelOk);
+            warmupSucceeded = warmupSucceeded && serialOk && parallelOk &&
+                              unbalancedSerialOk && unbalancedParallelOk;
         }
 
         std::uint64_t serialChecksum = 0u;
@@ -192,7 +319,7 @@ namespace Intrinsic::Bench::Rendering
         const double serialMs = MeasureMilliseconds(
             [&](bool& iterationSucceeded) -> std::uint64_t
             {
-                return ExecuteSerial(compiled, checksums, iterationSucceeded);
+                return ExecuteSerial(compiled, opsByPass, checksums, iterationSucceeded);
             },
             serialChecksum,
             serialSucceeded);
@@ -200,11 +327,50 @@ namespace Intrinsic::Bench::Rendering
         const double parallelMs = MeasureMilliseconds(
             [&](bool& iterationSucceeded) -> std::uint64_t
             {
-                return ExecuteParallel(compiled, checksums, finalStats, iterationSucceeded);
+                return ExecuteParallel(compiled, opsByPass, checksums, finalStats, iterationSucceeded);
             },
             parallelChecksum,
             parallelSucceeded);
 
+        std::uint64_t unbalancedSerialChecksum = 0u;
+        std::uint64_t unbalancedParallelChecksum = 0u;
+        bool unbalancedSerialSucceeded = warmupSucceeded;
+        bool unbalancedParallelSucceeded = warmupSucceeded;
+        Graphics::ParallelRecordStats unbalancedStats{};
+
+        const double unbalancedSerialMs = MeasureMilliseconds(
+            [&](bool& iterationSucceeded) -> std::uint64_t
+            {
+                return ExecuteSerial(unbalanced, unbalancedOpsByPass, unbalancedChecksums, iterationSucceeded);
+            },
+            unbalancedSerialChecksum,
+            unbalancedSerialSucceeded);
+
+        const double unbalancedParallelMs = MeasureMilliseconds(
+            [&](bool& iterationSucceeded) -> std::uint64_t
+            {
+                return ExecuteParallel(unbalanced,
+                                       unbalancedOpsByPass,
+                                       unbalancedChecksums,
+                                       unbalancedStats,
+                                       iterationSucceeded);
+            },
+            unbalancedParallelChecksum,
+            unbalancedParallelSucceeded);
+
+        // Convert op-count bounds to time through the measured serial cost per
+        // op, so both bounds share the serial run's clock and noise.
+        const RecordCostBounds unbalancedBounds = MeasureRecordCostBounds(unbalanced, unbalancedOpsByPass);
+        const double msPerOp = unbalancedBounds.TotalOps > 0u
+                                   ? unbalancedSerialMs / static_cast<double>(unbalancedBounds.TotalOps)
+                                   : 0.0;
+        const double unbalancedCriticalPathMs =
+            static_cast<double>(unbalancedBounds.CriticalPathOps) * msPerOp;
+        const double unbalancedLayerBarrierMs =
+            static_cast<double>(unbalancedBounds.LayerBarrierOps) * msPerOp;
+        const double unbalancedWorkBoundMs =
+            unbalancedSerialMs / static_cast<double>(kSchedulerWorkerCount + 1u);
+
         const double checksumDelta = static_cast<double>(
             std::max(serialChecksum, parallelChecksum) -
             std::min(serialChecksum, parallelChecksum));
@@ -230,8 +396,34 @@ namespace Intrinsic::Bench::Rendering
         metrics.ParallelMaxLayerWidth = finalStats.MaxLayerWidth;
         metrics.ParallelWorkerTaskCount = finalStats.WorkerTaskCount;
         metrics.ParallelCallerRecordCount = finalStats.CallerRecordCount;
+        metrics.ParallelRootPassCount = finalStats.RootPassCount;
         metrics.SerialChecksum = serialChecksum;
         metrics.ParallelChecksum = parallelChecksum;
+        metrics.UnbalancedSerialRecordMilliseconds = unbalancedSerialMs;
+        metrics.UnbalancedParallelRecordMilliseconds = unbalancedParallelMs;
+        metrics.UnbalancedCriticalPathMilliseconds = unbalancedCriticalPathMs;
+        metrics.UnbalancedLayerBarrierBoundMilliseconds = unbalancedLayerBarrierMs;
+        metrics.UnbalancedWorkBoundMilliseconds = unbalancedWorkBoundMs;
+        metrics.UnbalancedWallToCriticalPathRatio =
+            unbalancedCriticalPathMs > 0.0 ? unbalancedParallelMs / unbalancedCriticalPathMs : 0.0;
+        metrics.UnbalancedLayerBarrierToCriticalPathRatio =
+            unbalancedBounds.CriticalPathOps > 0u
+                ? static_cast<double>(unbalancedBounds.LayerBarrierOps) /
+                      static_cast<double>(unbalancedBounds.CriticalPathOps)
+                : 0.0;
+        metrics.UnbalancedLaneCount = kUnbalancedLaneCount;
+        metrics.UnbalancedDepth = kUnbalancedDepth;
+        metrics.UnbalancedPassCount = unbalanced.PassCount;
+        metrics.UnbalancedHeavyOpsPerPass = kUnbalancedHeavyOpsPerPass;
+        metrics.UnbalancedLayerCount = unbalancedStats.LayerCount;
+        metrics.UnbalancedRootPassCount = unbalancedStats.RootPassCount;
+        metrics.UnbalancedWorkerTaskCount = unbalancedStats.WorkerTaskCount;
+        metrics.UnbalancedCallerHelpedTaskCount = unbalancedStats.CallerHelpedTaskCount;
+        metrics.UnbalancedCriticalPathOps = unbalancedBounds.CriticalPathOps;
+        metrics.UnbalancedLayerBarrierOps = unbalancedBounds.LayerBarrierOps;
+        metrics.UnbalancedTotalOps = unbalancedBounds.TotalOps;
+        metrics.UnbalancedSerialChecksum = unbalancedSerialChecksum;
+        metrics.UnbalancedParallelChecksum = unbalancedParallelChecksum;
         metrics.Succeeded = serialSucceeded &&
                             parallelSucceeded &&
                             compiled.PassCount == kPassCount &&
@@ -241,7 +433,18 @@ namespace Intrinsic::Bench::Rendering
                             serialChecksum == parallelChecksum &&
                             qualityErrorL2 == 0.0 &&
                             serialMs > 0.0 &&
-                            parallelMs > 0.0;
+                            parallelMs > 0.0 &&
+                            unbalancedSerialSucceeded &&
+                            unbalancedParallelSucceeded &&
+                            unbalanced.PassCount == kUnbalancedPassCount &&
+                            unbalancedStats.UsedScheduler &&
+                            unbalancedStats.LayerCount == kUnbalancedDepth &&
+                            unbalancedStats.RootPassCount == kUnbalancedLaneCount &&
+                            unbalancedStats.WorkerTaskCount == kUnbalancedPassCount &&
+                            unbalancedSerialChecksum == unbalancedParallelChecksum &&
+                            unbalancedBounds.CriticalPathOps < unbalancedBounds.LayerBarrierOps &&
+                            unbalancedSerialMs > 0.0 &&
+                            unbalancedParallelMs > 0.0;
         return metrics;
     }
 } // namespace Intrinsic::Bench::Rendering
@@ -13,23 +13,36 @@
 // benchmark_id). The single-file form preserves backwards compatibility
 // with the previous scaffold's CMake/CI wiring.
 
+#include "../core/Bench.IOBackendMmapRead.hpp"
+#include "../core/Bench.SceneSerializationBinaryLoad.hpp"
 #include "../core/Bench.SchedulerHardeningSmoke.hpp"
 #include "../core/Bench.TaskGraphPlanReuseSmoke.hpp"
+#include "../core/Bench.TransformHierarchyIncremental.hpp"
 #include "../geometry/Bench.GeometrySmoke.hpp"
 #include "../geometry/Bench.BoundaryFirstFlatteningReferenceSmoke.hpp"
 #include "../geometry/Bench.ContinuousLopReferenceSmoke.hpp"
 #include "../geometry/Bench.CurvatureSegmentationReferenceSmoke.hpp"
 #include "../geometry/Bench.EdgeAwareResamplingReferenceSmoke.hpp"
+#include "../geometry/Bench.KMeansCpuSmoke.hpp"
 #include "../geometry/Bench.LopFamilyComparisonSmoke.hpp"
+#include "../geometry/Bench.MeshImport.hpp"
 #include "../geometry/Bench.PointCloudConsolidationReferenceSmoke.hpp"
 #include "../geometry/Bench.PointCloudFilteringSmoke.hpp"
+#include "../geometry/Bench.PointCloudAsciiLoad.hpp"
+#include "../geometry/Bench.PointCloudNormalsSmoke.hpp"
+#include "../geometry/Bench.PointKDTreeKnnSmoke.hpp"
 #include "../geometry/Bench.ProgressivePoissonReferenceSmoke.hpp"
 #include "../geometry/Bench.QualityMetricsSmoke.hpp"
 #include "../geometry/Bench.SignedHeatReferenceSmoke.hpp"
 #include "../geometry/Bench.SimplificationQualitySmoke.hpp"
+#include "../geometry/Bench.SparseSpMV.hpp"
+#include "../geometry/Bench.SparseSurfaceReconstructionSmoke.hpp"
 #include "../geometry/Bench.SurfaceSamplingSmoke.hpp"
 #include "../geometry/Bench.UvAtlasSmoke.hpp"
 #include "../physics/Bench.ParticleSpringReferenceSmoke.hpp"
+#include "../physics/Bench.PhysicsMethodThreadScaling.hpp"
+#include "../physics/Bench.PhysicsWorldBroadphaseScaling.hpp"
+#include "../physics/Bench.PhysicsWorldHotStoreScaling.hpp"
 #include "../physics/Bench.RigidBodyReferenceSmoke.hpp"
 #include "../physics/Bench.SphFluidReferenceSmoke.hpp"
 #include "../physics/Bench.XpbdClothReferenceSmoke.hpp"
@@ -48,6 +61,7 @@
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -588,7 +602,17 @@ auto EmitSignedHeatReferenceSmoke(const std::string &commit)
       << "    \"degenerate_boundary_vertex_count\": "
       << metrics.DegenerateBoundaryVertexCount << ",\n"
       << "    \"max_abs_distance\": " << metrics.MaxAbsDistance << ",\n"
-      << "    \"mean_boundary_offset\": " << metrics.MeanBoundaryOffset << "\n"
+      << "    \"mean_boundary_offset\": " << metrics.MeanBoundaryOffset << ",\n"
+      << "    \"solver_comparison_dataset\": \""
+      << EscapeJson(kSignedHeatSolverComparisonDataset) << "\",\n"
+      << "    \"solver_comparison_vertex_count\": "
+      << metrics.SolverComparisonVertexCount << ",\n"
+      << "    \"cg_jacobi_iterations\": " << metrics.CGJacobiIterations << ",\n"
+      << "    \"cg_amg_iterations\": " << metrics.CGAMGIterations << ",\n"
+      << "    \"amg_level_count\": " << metrics.AMGLevelCount << ",\n"
+      << "    \"cg_jacobi_ms\": " << metrics.CGJacobiMilliseconds << ",\n"
+      << "    \"amg_setup_ms\": " << metrics.AMGSetupMilliseconds << ",\n"
+      << "    \"cg_amg_ms\": " << metrics.CGAMGMilliseconds << "\n"
       << "  },\n"
       << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
       << "\"\n"
@@ -1082,7 +1106,39 @@ auto EmitSimplificationQualitySmoke(const std::string &commit)
       << "    \"feature_aware_pinned_corner_count\": "
       << metrics.FeatureAwarePinnedCornerCount << ",\n"
       << "    \"feature_aware_quality_rejection_count\": "
-      << metrics.FeatureAwareQualityRejectionCount << "\n"
+      << metrics.FeatureAwareQualityRejectionCount << ",\n"
+      << "    \"independent_set_rms_distance\": "
+      << metrics.IndependentSetRmsDistance << ",\n"
+      << "    \"independent_set_max_distance\": "
+      << metrics.IndependentSetMaxDistance << ",\n"
+      << "    \"independent_set_quality_regression_l2\": "
+      << metrics.IndependentSetQualityRegressionL2 << ",\n"
+      << "    \"independent_set_final_face_count\": "
+      << metrics.IndependentSetFinalFaceCount << ",\n"
+      << "    \"independent_set_round_count\": "
+      << metrics.IndependentSetRoundCount << ",\n"
+      << "    \"schedule_dataset\": \""
+      << EscapeJson(kSimplificationScheduleSpeedDataset) << "\",\n"
+      << "    \"schedule_input_face_count\": "
+      << metrics.ScheduleInputFaceCount << ",\n"
+      << "    \"schedule_target_face_count\": "
+      << metrics.ScheduleTargetFaceCount << ",\n"
+      << "    \"greedy_schedule_ms\": " << metrics.GreedyScheduleMilliseconds
+      << ",\n"
+      << "    \"independent_set_schedule_ms\": "
+      << metrics.IndependentSetScheduleMilliseconds << ",\n"
+      << "    \"independent_set_speedup\": " << metrics.IndependentSetSpeedup
+      << ",\n"
+      << "    \"greedy_schedule_rms_distance\": "
+      << metrics.GreedyScheduleRmsDistance << ",\n"
+      << "    \"independent_set_schedule_rms_distance\": "
+      << metrics.IndependentSetScheduleRmsDistance << ",\n"
+      << "    \"greedy_schedule_final_face_count\": "
+      << metrics.GreedyScheduleFinalFaceCount << ",\n"
+      << "    \"independent_set_schedule_final_face_count\": "
+      << metrics.IndependentSetScheduleFinalFaceCount << ",\n"
+      << "    \"independent_set_schedule_round_count\": "
+      << metrics.IndependentSetScheduleRoundCount << "\n"
       << "  },\n"
       << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
       << "\"\n"
@@ -1145,7 +1201,17 @@ auto EmitBoundaryFirstFlatteningReferenceSmoke(const std::string &commit)
       << "    \"evaluated_face_count\": "
       << metrics.EvaluatedFaceCount << ",\n"
       << "    \"flipped_element_count\": "
-      << metrics.FlippedElementCount << "\n"
+      << metrics.FlippedElementCount << ",\n"
+      << "    \"solver_comparison_dataset\": \""
+      << EscapeJson(kBoundaryFirstFlatteningSolverComparisonDataset) << "\",\n"
+      << "    \"solver_comparison_unknown_count\": "
+      << metrics.SolverComparisonUnknownCount << ",\n"
+      << "    \"cg_jacobi_iterations\": " << metrics.CGJacobiIterations << ",\n"
+      << "    \"cg_amg_iterations\": " << metrics.CGAMGIterations << ",\n"
+      << "    \"amg_level_count\": " << metrics.AMGLevelCount << ",\n"
+      << "    \"cg_jacobi_ms\": " << metrics.CGJacobiMilliseconds << ",\n"
+      << "    \"amg_setup_ms\": " << metrics.AMGSetupMilliseconds << ",\n"
+      << "    \"cg_amg_ms\": " << metrics.CGAMGMilliseconds << "\n"
       << "  },\n"
       << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
       << "\"\n"
@@ -1400,6 +1466,15 @@ auto EmitSphFluidReferenceSmoke(const std::string &commit) -> EmittedBenchmark {
       << "    \"column_max_neighbor_count\": " << metrics.ColumnMaxNeighborCount
       << ",\n"
       << "    \"column_stable\": " << (metrics.ColumnStable ? "true" : "false")
+      << ",\n"
+      << "    \"large_particle_count\": " << metrics.LargeParticleCount
+      << ",\n"
+      << "    \"large_step_ms\": " << metrics.LargeStepMilliseconds << ",\n"
+      << "    \"huge_particle_count\": " << metrics.HugeParticleCount << ",\n"
+      << "    \"huge_step_ms\": " << metrics.HugeStepMilliseconds << ",\n"
+      << "    \"neighbor_oracle_mismatches\": "
+      << metrics.NeighborOracleMismatches << ",\n"
+      << "    \"state_oracle_mismatches\": " << metrics.StateOracleMismatches
       << "\n"
       << "  },\n"
       << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
@@ -1410,6 +1485,177 @@ auto EmitSphFluidReferenceSmoke(const std::string &commit) -> EmittedBenchmark {
                           metrics.Succeeded};
 }
 
+auto EmitPhysicsWorldBroadphaseScaling(const std::string &commit)
+    -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Physics;
+
+  const auto metrics = RunPhysicsWorldBroadphaseScaling();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \""
+      << EscapeJson(kPhysicsWorldBroadphaseScalingBenchmarkId) << "\",\n"
+      << "  \"method\": \""
+      << EscapeJson(kPhysicsWorldBroadphaseScalingMethod) << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \""
+      << EscapeJson(kPhysicsWorldBroadphaseScalingDataset) << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 1,\n"
+      << "    \"measured_iterations\": 5,\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"small_body_count\": " << metrics.SmallBodyCount << ",\n"
+      << "    \"large_body_count\": " << metrics.LargeBodyCount << ",\n"
+      << "    \"small_median_runtime_ms\": "
+      << metrics.SmallMedianRuntimeMilliseconds << ",\n"
+      << "    \"large_median_runtime_ms\": "
+      << metrics.LargeMedianRuntimeMilliseconds << ",\n"
+      << "    \"runtime_scaling_ratio\": " << metrics.RuntimeScalingRatio
+      << ",\n"
+      << "    \"small_candidate_pairs\": " << metrics.SmallCandidatePairs
+      << ",\n"
+      << "    \"large_candidate_pairs\": " << metrics.LargeCandidatePairs
+      << ",\n"
+      << "    \"large_contact_count\": " << metrics.LargeContactCount << ",\n"
+      << "    \"small_oracle_contact_count\": "
+      << metrics.SmallOracleContactCount << ",\n"
+      << "    \"small_oracle_mismatches\": " << metrics.SmallOracleMismatches
+      << "\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kPhysicsWorldBroadphaseScalingBenchmarkId,
+                          out.str(), metrics.Succeeded};
+}
+
+auto EmitPhysicsWorldHotStoreScaling(const std::string &commit)
+    -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Physics;
+
+  const auto metrics = RunPhysicsWorldHotStoreScaling();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \""
+      << EscapeJson(kPhysicsWorldHotStoreScalingBenchmarkId) << "\",\n"
+      << "  \"method\": \""
+      << EscapeJson(kPhysicsWorldHotStoreScalingMethod) << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \""
+      << EscapeJson(kPhysicsWorldHotStoreScalingDataset) << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 1,\n"
+      << "    \"measured_iterations\": 5,\n"
+      << "    \"timing_statistic\": \"median\",\n";
+  const std::array<std::pair<const char *, const PhysicsWorldHotStoreScalingTier *>, 3>
+      tiers{{{"small", &metrics.Small},
+             {"medium", &metrics.Medium},
+             {"large", &metrics.Large}}};
+  for (const auto &[name, tier] : tiers) {
+    out << "    \"" << name << "_body_count\": " << tier->BodyCount << ",\n"
+        << "    \"" << name << "_integrate_median_ms\": "
+        << tier->IntegrateMedianMilliseconds << ",\n"
+        << "    \"" << name << "_solve_step_median_ms\": "
+        << tier->SolveStepMedianMilliseconds << ",\n"
+        << "    \"" << name << "_solve_step_bodies_per_sec\": "
+        << tier->SolveStepBodiesPerSecond << ",\n"
+        << "    \"" << name << "_contacts_solved\": " << tier->ContactsSolved
+        << ",\n";
+  }
+  out << "    \"determinism_mismatches\": " << metrics.DeterminismMismatches
+      << "\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kPhysicsWorldHotStoreScalingBenchmarkId, out.str(),
+                          metrics.Succeeded};
+}
+
+auto EmitPhysicsMethodThreadScaling(const std::string &commit)
+    -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Physics;
+
+  const auto metrics = RunPhysicsMethodThreadScaling();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \""
+      << EscapeJson(kPhysicsMethodThreadScalingBenchmarkId) << "\",\n"
+      << "  \"method\": \""
+      << EscapeJson(kPhysicsMethodThreadScalingMethod) << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \""
+      << EscapeJson(kPhysicsMethodThreadScalingDataset) << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"measured_iterations\": 3,\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"hardware_threads\": " << metrics.HardwareThreads << ",\n"
+      << "    \"sph_particle_count\": " << metrics.SphParticleCount << ",\n"
+      << "    \"cloth_particle_count\": " << metrics.ClothParticleCount
+      << ",\n"
+      << "    \"cloth_constraint_count\": " << metrics.ClothConstraintCount
+      << ",\n"
+      << "    \"cloth_color_count\": " << metrics.ClothColorCount << ",\n"
+      << "    \"scheduler_measured\": "
+      << (metrics.SchedulerMeasured ? "true" : "false") << ",\n";
+  for (const auto &point : metrics.Points) {
+    const std::string prefix = "t" + std::to_string(point.ThreadCount) + "_";
+    out << "    \"" << prefix << "sph_worker_median_ms\": "
+        << point.SphWorkerMedianMilliseconds << ",\n"
+        << "    \"" << prefix << "cloth_worker_median_ms\": "
+        << point.ClothWorkerMedianMilliseconds << ",\n"
+        << "    \"" << prefix << "sph_scheduler_median_ms\": "
+        << point.SphSchedulerMedianMilliseconds << ",\n"
+        << "    \"" << prefix << "cloth_scheduler_median_ms\": "
+        << point.ClothSchedulerMedianMilliseconds << ",\n";
+  }
+  out << "    \"parity_mismatches\": " << metrics.ParityMismatches << "\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kPhysicsMethodThreadScalingBenchmarkId, out.str(),
+                          metrics.Succeeded};
+}
+
 auto EmitVertexFetchLayoutSmoke(const std::string &commit) -> EmittedBenchmark {
   using namespace Intrinsic::Bench::Rendering;
 
@@ -1613,7 +1859,21 @@ auto EmitFramegraphScratchReuseSmoke(const std::string &commit)
       << "    \"fresh_declare_compile_bytes\": "
       << metrics.FreshDeclareCompileBytes << ",\n"
       << "    \"reused_declare_compile_bytes\": "
-      << metrics.ReusedDeclareCompileBytes << "\n"
+      << metrics.ReusedDeclareCompileBytes << ",\n"
+      << "    \"transient_chain_pass_count\": "
+      << metrics.TransientChainPassCount << ",\n"
+      << "    \"transient_heap_count\": " << metrics.TransientHeapCount
+      << ",\n"
+      << "    \"alias_reuse_barrier_count\": "
+      << metrics.AliasReuseBarrierCount << ",\n"
+      << "    \"transient_naive_bytes\": " << metrics.TransientNaiveBytes
+      << ",\n"
+      << "    \"transient_placed_peak_bytes\": "
+      << metrics.TransientPlacedPeakBytes << ",\n"
+      << "    \"null_device_peak_memory_block_bytes\": "
+      << metrics.NullDevicePeakMemoryBlockBytes << ",\n"
+      << "    \"null_device_aliased_bytes\": "
+      << metrics.NullDeviceAliasedBytes << "\n"
       << "  },\n"
       << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
       << "\"\n"
@@ -1726,8 +1986,49 @@ auto EmitRenderGraphParallelRecordingSmoke(const std::string &commit)
       << metrics.ParallelWorkerTaskCount << ",\n"
       << "    \"parallel_caller_record_count\": "
       << metrics.ParallelCallerRecordCount << ",\n"
+      << "    \"parallel_root_pass_count\": " << metrics.ParallelRootPassCount
+      << ",\n"
       << "    \"serial_checksum\": " << metrics.SerialChecksum << ",\n"
-      << "    \"parallel_checksum\": " << metrics.ParallelChecksum << "\n"
+      << "    \"parallel_checksum\": " << metrics.ParallelChecksum << ",\n"
+      << "    \"unbalanced_lane_count\": " << metrics.UnbalancedLaneCount
+      << ",\n"
+      << "    \"unbalanced_depth\": " << metrics.UnbalancedDepth << ",\n"
+      << "    \"unbalanced_pass_count\": " << metrics.UnbalancedPassCount
+      << ",\n"
+      << "    \"unbalanced_heavy_ops_per_pass\": "
+      << metrics.UnbalancedHeavyOpsPerPass << ",\n"
+      << "    \"unbalanced_layer_count\": " << metrics.UnbalancedLayerCount
+      << ",\n"
+      << "    \"unbalanced_root_pass_count\": "
+      << metrics.UnbalancedRootPassCount << ",\n"
+      << "    \"unbalanced_worker_task_count\": "
+      << metrics.UnbalancedWorkerTaskCount << ",\n"
+      << "    \"unbalanced_caller_helped_task_count\": "
+      << metrics.UnbalancedCallerHelpedTaskCount << ",\n"
+      << "    \"unbalanced_total_ops\": " << metrics.UnbalancedTotalOps
+      << ",\n"
+      << "    \"unbalanced_critical_path_ops\": "
+      << metrics.UnbalancedCriticalPathOps << ",\n"
+      << "    \"unbalanced_layer_barrier_ops\": "
+      << metrics.UnbalancedLayerBarrierOps << ",\n"
+      << "    \"unbalanced_serial_record_ms\": "
+      << metrics.UnbalancedSerialRecordMilliseconds << ",\n"
+      << "    \"unbalanced_parallel_record_ms\": "
+      << metrics.UnbalancedParallelRecordMilliseconds << ",\n"
+      << "    \"unbalanced_critical_path_ms\": "
+      << metrics.UnbalancedCriticalPathMilliseconds << ",\n"
+      << "    \"unbalanced_layer_barrier_bound_ms\": "
+      << metrics.UnbalancedLayerBarrierBoundMilliseconds << ",\n"
+      << "    \"unbalanced_work_bound_ms\": "
+      << metrics.UnbalancedWorkBoundMilliseconds << ",\n"
+      << "    \"unbalanced_wall_to_critical_path_ratio\": "
+      << metrics.UnbalancedWallToCriticalPathRatio << ",\n"
+      << "    \"unbalanced_layer_barrier_to_critical_path_ratio\": "
+      << metrics.UnbalancedLayerBarrierToCriticalPathRatio << ",\n"
+      << "    \"unbalanced_serial_checksum\": "
+      << metrics.UnbalancedSerialChecksum << ",\n"
+      << "    \"unbalanced_parallel_checksum\": "
+      << metrics.UnbalancedParallelChecksum << "\n"
       << "  },\n"
       << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
       << "\"\n"
@@ -1804,6 +2105,25 @@ auto EmitSchedulerHardeningSmoke(const std::string &commit)
       << metrics.WaitRegistryContendedScalingEfficiency << ",\n"
       << "    \"wait_registry_succeeded\": "
       << (metrics.WaitRegistrySucceeded ? "true" : "false") << ",\n"
+      << "    \"fan_out_task_count\": " << metrics.FanOutTaskCount << ",\n"
+      << "    \"fan_out_worker_request\": " << metrics.FanOutWorkerRequest
+      << ",\n"
+      << "    \"fan_out_queue_thief_count\": " << metrics.FanOutQueueThiefCount
+      << ",\n"
+      << "    \"fan_out_measured_iterations\": "
+      << metrics.FanOutMeasuredIterations << ",\n"
+      << "    \"fan_out_scheduler_median_ms\": "
+      << metrics.FanOutSchedulerMedianMilliseconds << ",\n"
+      << "    \"fan_out_scheduler_throughput_items_per_sec\": "
+      << metrics.FanOutSchedulerThroughputItemsPerSecond << ",\n"
+      << "    \"fan_out_mutex_deque_median_ms\": "
+      << metrics.FanOutMutexDequeMedianMilliseconds << ",\n"
+      << "    \"fan_out_chase_lev_median_ms\": "
+      << metrics.FanOutChaseLevMedianMilliseconds << ",\n"
+      << "    \"fan_out_chase_lev_speedup\": " << metrics.FanOutChaseLevSpeedup
+      << ",\n"
+      << "    \"fan_out_succeeded\": "
+      << (metrics.FanOutSucceeded ? "true" : "false") << ",\n"
       << "    \"worker_wake_notification_telemetry_available\": false,\n"
       << "    \"worker_wake_evidence\": "
          "\"candidate_stats_and_contract_tests\"\n"
@@ -1873,6 +2193,548 @@ auto EmitTaskGraphPlanReuseSmoke(
                           metrics.Succeeded};
 }
 
+auto EmitTransformHierarchyIncremental(const std::string &commit)
+    -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Core;
+
+  const auto metrics = RunTransformHierarchyIncremental();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \""
+      << EscapeJson(kTransformHierarchyIncrementalBenchmarkId) << "\",\n"
+      << "  \"method\": \""
+      << EscapeJson(kTransformHierarchyIncrementalMethod) << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \""
+      << EscapeJson(kTransformHierarchyIncrementalDataset) << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 1,\n"
+      << "    \"measured_iterations\": 5,\n"
+      << "    \"timing_statistic\": \"median\",\n";
+  const std::array<
+      std::pair<const char *, const TransformHierarchyIncrementalTier *>, 3>
+      tiers{{{"small", &metrics.Small},
+             {"medium", &metrics.Medium},
+             {"large", &metrics.Large}}};
+  for (const auto &[name, tier] : tiers) {
+    out << "    \"" << name << "_entity_count\": " << tier->EntityCount
+        << ",\n"
+        << "    \"" << name << "_sparse_dirty_count\": "
+        << tier->SparseDirtyCount << ",\n"
+        << "    \"" << name << "_sparse_updated_entities\": "
+        << tier->SparseUpdatedEntities << ",\n"
+        << "    \"" << name << "_flat_order_build_ms\": "
+        << tier->FlatOrderBuildMilliseconds << ",\n"
+        << "    \"" << name << "_flat_order_rebuilds\": "
+        << tier->FlatOrderRebuilds << ",\n"
+        << "    \"" << name << "_dirty_0pct_median_ms\": "
+        << tier->CleanMedianMilliseconds << ",\n"
+        << "    \"" << name << "_dirty_1pct_median_ms\": "
+        << tier->SparseMedianMilliseconds << ",\n"
+        << "    \"" << name << "_dirty_100pct_median_ms\": "
+        << tier->FullMedianMilliseconds << ",\n"
+        << "    \"" << name << "_recursive_dirty_0pct_median_ms\": "
+        << tier->RecursiveCleanMedianMilliseconds << ",\n"
+        << "    \"" << name << "_recursive_dirty_1pct_median_ms\": "
+        << tier->RecursiveSparseMedianMilliseconds << ",\n"
+        << "    \"" << name << "_recursive_dirty_100pct_median_ms\": "
+        << tier->RecursiveFullMedianMilliseconds << ",\n"
+        << "    \"" << name << "_dirty_100pct_entities_per_sec\": "
+        << tier->FullEntitiesPerSecond << ",\n";
+  }
+  out << "    \"parity_mismatches\": " << metrics.ParityMismatches << "\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kTransformHierarchyIncrementalBenchmarkId,
+                          out.str(), metrics.Succeeded};
+}
+
+auto EmitSceneSerializationBinaryLoad(const std::string &commit)
+    -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Core;
+
+  const auto metrics = RunSceneSerializationBinaryLoad();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \""
+      << EscapeJson(kSceneSerializationBinaryLoadBenchmarkId) << "\",\n"
+      << "  \"method\": \""
+      << EscapeJson(kSceneSerializationBinaryLoadMethod) << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \""
+      << EscapeJson(kSceneSerializationBinaryLoadDataset) << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 1,\n"
+      << "    \"measured_iterations\": 3,\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"mesh_vertex_count\": " << metrics.MeshVertexCount << ",\n"
+      << "    \"mesh_face_count\": " << metrics.MeshFaceCount << ",\n"
+      << "    \"cloud_point_count\": " << metrics.CloudPointCount << ",\n"
+      << "    \"json_bytes\": " << metrics.JsonBytes << ",\n"
+      << "    \"binary_bytes\": " << metrics.BinaryBytes << ",\n"
+      << "    \"json_save_ms\": " << metrics.JsonSaveMilliseconds << ",\n"
+      << "    \"binary_save_ms\": " << metrics.BinarySaveMilliseconds
+      << ",\n"
+      << "    \"json_load_median_ms\": "
+      << metrics.JsonLoadMedianMilliseconds << ",\n"
+      << "    \"binary_load_median_ms\": "
+      << metrics.BinaryLoadMedianMilliseconds << ",\n"
+      << "    \"load_speedup\": " << metrics.LoadSpeedup << "\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kSceneSerializationBinaryLoadBenchmarkId, out.str(),
+                          metrics.Succeeded};
+}
+
+auto EmitIOBackendMmapRead(const std::string &commit) -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Core;
+
+  const auto metrics = RunIOBackendMmapRead();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \""
+      << EscapeJson(kIOBackendMmapReadBenchmarkId) << "\",\n"
+      << "  \"method\": \"" << EscapeJson(kIOBackendMmapReadMethod)
+      << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \"" << EscapeJson(kIOBackendMmapReadDataset)
+      << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 1,\n"
+      << "    \"measured_iterations\": 3,\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"file_bytes\": " << metrics.FileBytes << ",\n"
+      << "    \"file_cold_ms\": " << metrics.FileColdMilliseconds << ",\n"
+      << "    \"mmap_cold_ms\": " << metrics.MmapColdMilliseconds << ",\n"
+      << "    \"file_warm_median_ms\": " << metrics.FileWarmMedianMilliseconds
+      << ",\n"
+      << "    \"mmap_warm_median_ms\": " << metrics.MmapWarmMedianMilliseconds
+      << ",\n"
+      << "    \"warm_speedup\": " << metrics.WarmSpeedup << "\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kIOBackendMmapReadBenchmarkId, out.str(),
+                          metrics.Succeeded};
+}
+
+auto EmitPointKDTreeKnnSmoke(const std::string &commit) -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Geometry;
+
+  const auto metrics = RunPointKDTreeKnnSmoke();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \""
+      << EscapeJson(kPointKDTreeKnnBenchmarkId) << "\",\n"
+      << "  \"method\": \"" << EscapeJson(kPointKDTreeKnnMethod) << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \"" << EscapeJson(kPointKDTreeKnnDataset) << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 1,\n"
+      << "    \"measured_iterations\": 3,\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"point_count\": " << metrics.PointCount << ",\n"
+      << "    \"query_count\": " << metrics.QueryCount << ",\n"
+      << "    \"kdtree_build_ms\": " << metrics.KDTreeBuildMilliseconds
+      << ",\n"
+      << "    \"point_kdtree_build_ms\": "
+      << metrics.PointKDTreeBuildMilliseconds << ",\n"
+      << "    \"tiers\": [\n";
+  for (std::size_t i = 0; i < metrics.Tiers.size(); ++i) {
+    const auto &tier = metrics.Tiers[i];
+    out << "      {\"k\": " << tier.K
+        << ", \"kdtree_median_ms\": " << tier.KDTreeMedianMilliseconds
+        << ", \"point_kdtree_median_ms\": "
+        << tier.PointKDTreeMedianMilliseconds
+        << ", \"speedup\": " << tier.Speedup
+        << ", \"mismatches\": " << tier.Mismatches << "}"
+        << (i + 1u < metrics.Tiers.size() ? ",\n" : "\n");
+  }
+  out << "    ]\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kPointKDTreeKnnBenchmarkId, out.str(),
+                          metrics.Succeeded};
+}
+
+auto EmitSparseSurfaceReconstructionSmoke(const std::string &commit)
+    -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Geometry;
+
+  const auto metrics = RunSparseSurfaceReconstructionSmoke();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \""
+      << EscapeJson(kSparseSurfaceReconstructionBenchmarkId) << "\",\n"
+      << "  \"method\": \""
+      << EscapeJson(kSparseSurfaceReconstructionMethod) << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \""
+      << EscapeJson(kSparseSurfaceReconstructionDataset) << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 0,\n"
+      << "    \"measured_iterations\": 3,\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"point_count\": " << metrics.PointCount << ",\n"
+      << "    \"narrow_band_cells\": " << metrics.NarrowBandCells << ",\n"
+      << "    \"parity_resolution\": " << metrics.ParityResolution << ",\n"
+      << "    \"dense_parity_ms\": " << metrics.DenseParityMilliseconds
+      << ",\n"
+      << "    \"sparse_parity_ms\": " << metrics.SparseParityMilliseconds
+      << ",\n"
+      << "    \"tiers\": [\n";
+  for (std::size_t i = 0; i < metrics.Tiers.size(); ++i) {
+    const auto &tier = metrics.Tiers[i];
+    out << "      {\"resolution\": " << tier.Resolution
+        << ", \"median_ms\": " << tier.MedianMilliseconds
+        << ", \"allocated_blocks\": " << tier.AllocatedBlockCount
+        << ", \"evaluated_vertices\": " << tier.EvaluatedVertexCount
+        << ", \"sparse_field_bytes\": " << tier.SparseFieldBytes
+        << ", \"dense_field_bytes\": " << tier.DenseFieldBytes
+        << ", \"output_faces\": " << tier.OutputFaceCount << "}"
+        << (i + 1u < metrics.Tiers.size() ? ",\n" : "\n");
+  }
+  out << "    ]\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kSparseSurfaceReconstructionBenchmarkId, out.str(),
+                          metrics.Succeeded};
+}
+
+auto EmitKMeansCpuSmoke(const std::string &commit) -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Geometry;
+
+  const auto metrics = RunKMeansCpuSmoke();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \"" << EscapeJson(kKMeansCpuBenchmarkId)
+      << "\",\n"
+      << "  \"method\": \"" << EscapeJson(kKMeansCpuMethod) << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \"" << EscapeJson(kKMeansCpuDataset) << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 1,\n"
+      << "    \"measured_iterations\": 3,\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"point_count\": " << metrics.PointCount << ",\n"
+      << "    \"cluster_count\": " << metrics.ClusterCount << ",\n"
+      << "    \"iterations\": " << metrics.Iterations << ",\n"
+      << "    \"brute_force_ms\": " << metrics.BruteForceMilliseconds << ",\n"
+      << "    \"exact_median_ms\": " << metrics.ExactMedianMilliseconds
+      << ",\n"
+      << "    \"mini_batch_median_ms\": "
+      << metrics.MiniBatchMedianMilliseconds << ",\n"
+      << "    \"exact_speedup\": " << metrics.ExactSpeedup << ",\n"
+      << "    \"distance_evaluation_fraction\": "
+      << metrics.DistanceEvaluationFraction << ",\n"
+      << "    \"label_mismatches\": " << metrics.LabelMismatches << ",\n"
+      << "    \"mini_batch_inertia_ratio\": " << metrics.MiniBatchInertiaRatio
+      << "\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kKMeansCpuBenchmarkId, out.str(), metrics.Succeeded};
+}
+
+auto EmitPointCloudNormalsSmoke(const std::string &commit)
+    -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Geometry;
+
+  const auto metrics = RunPointCloudNormalsSmoke();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \""
+      << EscapeJson(kPointCloudNormalsBenchmarkId) << "\",\n"
+      << "  \"method\": \"" << EscapeJson(kPointCloudNormalsMethod)
+      << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \"" << EscapeJson(kPointCloudNormalsDataset)
+      << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 1,\n"
+      << "    \"measured_iterations\": 3,\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"parallel_speedup\": " << metrics.ParallelSpeedup << ",\n"
+      << "    \"tiers\": [\n";
+  for (std::size_t i = 0; i < metrics.Tiers.size(); ++i) {
+    const auto &tier = metrics.Tiers[i];
+    out << "      {\"point_count\": " << tier.PointCount
+        << ", \"serial_ms\": " << tier.SerialMilliseconds
+        << ", \"parallel_median_ms\": " << tier.ParallelMedianMilliseconds
+        << ", \"orientation_cells\": " << tier.OrientationCellCount
+        << ", \"merge_rounds\": " << tier.OrientationMergeRoundCount
+        << ", \"inward_normals\": " << tier.InwardNormalCount
+        << ", \"normal_mismatches\": " << tier.NormalMismatchCount << "}"
+        << (i + 1u < metrics.Tiers.size() ? ",\n" : "\n");
+  }
+  out << "    ]\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kPointCloudNormalsBenchmarkId, out.str(),
+                          metrics.Succeeded};
+}
+
+auto EmitSparseSpMVSmoke(const std::string &commit) -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Geometry;
+
+  const SparseSpMVCohort &cohort = kSparseSpMVSmokeCohort;
+  const auto metrics = RunSparseSpMV(cohort);
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \"" << EscapeJson(cohort.BenchmarkId) << "\",\n"
+      << "  \"method\": \"" << EscapeJson(kSparseSpMVMethod) << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \"" << EscapeJson(cohort.Dataset) << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": " << cohort.WarmupIterations << ",\n"
+      << "    \"measured_iterations\": " << cohort.MeasuredIterations
+      << ",\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"row_count\": " << metrics.RowCount << ",\n"
+      << "    \"non_zero_count\": " << metrics.NonZeroCount << ",\n"
+      << "    \"shuffled_bandwidth\": " << metrics.ShuffledBandwidth << ",\n"
+      << "    \"rcm_bandwidth\": " << metrics.RcmBandwidth << ",\n"
+      << "    \"rcm_ms\": " << metrics.RcmMilliseconds << ",\n"
+      << "    \"transpose_build_ms\": " << metrics.TransposeBuildMilliseconds
+      << ",\n"
+      << "    \"baseline_shuffled_gb_per_sec\": "
+      << metrics.BaselineShuffledGBPerSecond << ",\n"
+      << "    \"baseline_rcm_gb_per_sec\": " << metrics.BaselineRcmGBPerSecond
+      << ",\n"
+      << "    \"compact_double_gb_per_sec\": "
+      << metrics.CompactDoubleGBPerSecond << ",\n"
+      << "    \"compact_float_gb_per_sec\": " << metrics.CompactFloatGBPerSecond
+      << ",\n"
+      << "    \"compact_transpose_gb_per_sec\": "
+      << metrics.CompactTransposeGBPerSecond << ",\n"
+      << "    \"float_relative_error_l2\": " << metrics.FloatRelativeErrorL2
+      << "\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{cohort.BenchmarkId, out.str(), metrics.Succeeded};
+}
+
+auto EmitPointCloudAsciiLoad(const std::string &commit) -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Geometry;
+
+  const auto metrics = RunPointCloudAsciiLoad();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \""
+      << EscapeJson(kPointCloudAsciiLoadBenchmarkId) << "\",\n"
+      << "  \"method\": \"" << EscapeJson(kPointCloudAsciiLoadMethod)
+      << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \"" << EscapeJson(kPointCloudAsciiLoadDataset)
+      << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 1,\n"
+      << "    \"measured_iterations\": 3,\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"point_count\": " << metrics.PointCount << ",\n"
+      << "    \"xyz_file_bytes\": " << metrics.XyzFileBytes << ",\n"
+      << "    \"csv_file_bytes\": " << metrics.CsvFileBytes << ",\n"
+      << "    \"chunk_count\": " << metrics.ChunkCount << ",\n"
+      << "    \"reference_mb_per_sec\": " << metrics.ReferenceMBPerSecond
+      << ",\n"
+      << "    \"path_mb_per_sec\": " << metrics.PathMBPerSecond << ",\n"
+      << "    \"mmap_mb_per_sec\": " << metrics.MmapMBPerSecond << ",\n"
+      << "    \"csv_mmap_mb_per_sec\": " << metrics.CsvMmapMBPerSecond
+      << ",\n"
+      << "    \"speedup\": " << metrics.Speedup << "\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kPointCloudAsciiLoadBenchmarkId, out.str(),
+                          metrics.Succeeded};
+}
+
+auto EmitMeshImport(const std::string &commit) -> EmittedBenchmark {
+  using namespace Intrinsic::Bench::Geometry;
+
+  const auto metrics = RunMeshImport();
+
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(6);
+  out << "{\n"
+      << "  \"benchmark_id\": \"" << EscapeJson(kMeshImportBenchmarkId)
+      << "\",\n"
+      << "  \"method\": \"" << EscapeJson(kMeshImportMethod) << "\",\n"
+      << "  \"backend\": \"cpu_optimized\",\n"
+      << "  \"dataset\": \"" << EscapeJson(kMeshImportDataset) << "\",\n"
+      << "  \"commit\": \"" << EscapeJson(commit) << "\",\n"
+      << "  \"metrics\": {\n"
+      << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+      << "    \"throughput_items_per_sec\": "
+      << metrics.ThroughputItemsPerSecond << ",\n"
+      << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+      << "  },\n"
+      << "  \"diagnostics\": {\n"
+      << "    \"runner\": \"IntrinsicBenchmarkSmoke\",\n"
+      << "    \"mode\": \"performance_scaling_smoke\",\n"
+      << "    \"warmup_iterations\": 1,\n"
+      << "    \"measured_iterations\": 3,\n"
+      << "    \"timing_statistic\": \"median\",\n"
+      << "    \"vertex_count\": " << metrics.VertexCount << ",\n"
+      << "    \"triangle_count\": " << metrics.TriangleCount << ",\n"
+      << "    \"obj_file_bytes\": " << metrics.ObjFileBytes << ",\n"
+      << "    \"ply_file_bytes\": " << metrics.PlyFileBytes << ",\n"
+      << "    \"stl_file_bytes\": " << metrics.StlFileBytes << ",\n"
+      << "    \"obj_serial_ms\": " << metrics.ObjSerialMilliseconds << ",\n"
+      << "    \"obj_parallel_ms\": " << metrics.ObjParallelMilliseconds
+      << ",\n"
+      << "    \"ply_serial_ms\": " << metrics.PlySerialMilliseconds << ",\n"
+      << "    \"ply_parallel_ms\": " << metrics.PlyParallelMilliseconds
+      << ",\n"
+      << "    \"stl_serial_ms\": " << metrics.StlSerialMilliseconds << ",\n"
+      << "    \"stl_parallel_ms\": " << metrics.StlParallelMilliseconds
+      << ",\n"
+      << "    \"add_face_build_ms\": " << metrics.AddFaceBuildMilliseconds
+      << ",\n"
+      << "    \"bulk_build_ms\": " << metrics.BulkBuildMilliseconds << ",\n"
+      << "    \"speedup\": " << metrics.Speedup << "\n"
+      << "  },\n"
+      << "  \"status\": \"" << (metrics.Succeeded ? "passed" : "failed")
+      << "\"\n"
+      << "}\n";
+
+  return EmittedBenchmark{kMeshImportBenchmarkId, out.str(),
+                          metrics.Succeeded};
+}
+
 auto WriteFile(const std::filesystem::path &path, std::string_view payload)
     -> bool {
   std::error_code ec;
@@ -1918,6 +2780,9 @@ auto main(int argc, char **argv) -> int {
   emitted.push_back(EmitParticleSpringReferenceSmoke(commit));
   emitted.push_back(EmitXpbdClothReferenceSmoke(commit));
   emitted.push_back(EmitSphFluidReferenceSmoke(commit));
+  emitted.push_back(EmitPhysicsWorldBroadphaseScaling(commit));
+  emitted.push_back(EmitPhysicsWorldHotStoreScaling(commit));
+  emitted.push_back(EmitPhysicsMethodThreadScaling(commit));
   emitted.push_back(EmitFramegraphBarrierEmissionSmoke(commit));
   emitted.push_back(EmitFramegraphCompilerIndexingSmoke(commit));
   emitted.push_back(EmitFramegraphScratchReuseSmoke(commit));
@@ -1933,6 +2798,16 @@ auto main(int argc, char **argv) -> int {
       commit, Intrinsic::Bench::Core::RunTaskGraphPlanReuseRenderPrep9Smoke(),
       Intrinsic::Bench::Core::kTaskGraphPlanReuseRenderPrep9SmokeBenchmarkId,
       Intrinsic::Bench::Core::kTaskGraphPlanReuseRenderPrep9SmokeDataset));
+  emitted.push_back(EmitTransformHierarchyIncremental(commit));
+  emitted.push_back(EmitSceneSerializationBinaryLoad(commit));
+  emitted.push_back(EmitIOBackendMmapRead(commit));
+  emitted.push_back(EmitPointKDTreeKnnSmoke(commit));
+  emitted.push_back(EmitSparseSurfaceReconstructionSmoke(commit));
+  emitted.push_back(EmitKMeansCpuSmoke(commit));
+  emitted.push_back(EmitPointCloudNormalsSmoke(commit));
+  emitted.push_back(EmitSparseSpMVSmoke(commit));
+  emitted.push_back(EmitPointCloudAsciiLoad(commit));
+  emitted.push_back(EmitMeshImport(commit));
 
   // Output target: an existing directory or a path with no extension (or no
   // filename component) is treated as a directory and gets one JSON per
@@ -0,0 +1,141 @@
+// Opt-in SpMV bandwidth profile for the 1M and 10M row cohorts of
+// Bench_SparseSpMV.cpp; the 100k cohort runs in IntrinsicBenchmarkSmoke.
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "../geometry/Bench.SparseSpMV.hpp"
+
+namespace
+{
+    using Intrinsic::Bench::Geometry::SparseSpMVCohort;
+    using Intrinsic::Bench::Geometry::SparseSpMVMetrics;
+
+    [[nodiscard]] std::string ResolveCommit()
+    {
+        const char* value = std::getenv("GIT_COMMIT");
+        return value != nullptr && value[0] != '\0'
+            ? std::string{value}
+            : std::string{"unknown"};
+    }
+
+    [[nodiscard]] std::string EmitResult(
+        const SparseSpMVCohort& cohort,
+        const SparseSpMVMetrics& metrics,
+        const std::string& commit)
+    {
+        std::ostringstream out;
+        out.setf(std::ios::fixed);
+        out.precision(6);
+        out << "{\n"
+            << "  \"benchmark_id\": \"" << cohort.BenchmarkId << "\",\n"
+            << "  \"method\": \""
+            << Intrinsic::Bench::Geometry::kSparseSpMVMethod << "\",\n"
+            << "  \"backend\": \"cpu_optimized\",\n"
+            << "  \"dataset\": \"" << cohort.Dataset << "\",\n"
+            << "  \"commit\": \"" << commit << "\",\n"
+            << "  \"metrics\": {\n"
+            << "    \"runtime_ms\": " << metrics.RuntimeMilliseconds << ",\n"
+            << "    \"throughput_items_per_sec\": "
+            << metrics.ThroughputItemsPerSecond << ",\n"
+            << "    \"quality_error_l2\": " << metrics.QualityErrorL2 << "\n"
+            << "  },\n"
+            << "  \"diagnostics\": {\n"
+            << "    \"runner\": \"IntrinsicSparseSpMVProfile\",\n"
+            << "    \"mode\": \"heavy_bandwidth_profile\",\n"
+            << "    \"warmup_iterations\": " << cohort.WarmupIterations << ",\n"
+            << "    \"measured_iterations\": " << cohort.MeasuredIterations
+            << ",\n"
+            << "    \"timing_statistic\": \"median\",\n"
+            << "    \"row_count\": " << metrics.RowCount << ",\n"
+            << "    \"non_zero_count\": " << metrics.NonZeroCount << ",\n"
+            << "    \"shuffled_bandwidth\": " << metrics.ShuffledBandwidth
+            << ",\n"
+            << "    \"rcm_bandwidth\": " << metrics.RcmBandwidth << ",\n"
+            << "    \"rcm_ms\": " << metrics.RcmMilliseconds << ",\n"
+            << "    \"transpose_build_ms\": "
+            << metrics.TransposeBuildMilliseconds << ",\n"
+            << "    \"baseline_shuffled_gb_per_sec\": "
+            << metrics.BaselineShuffledGBPerSecond << ",\n"
+            << "    \"baseline_rcm_gb_per_sec\": "
+            << metrics.BaselineRcmGBPerSecond << ",\n"
+            << "    \"compact_double_gb_per_sec\": "
+            << metrics.CompactDoubleGBPerSecond << ",\n"
+            << "    \"compact_float_gb_per_sec\": "
+            << metrics.CompactFloatGBPerSecond << ",\n"
+            << "    \"compact_transpose_gb_per_sec\": "
+            << metrics.CompactTransposeGBPerSecond << ",\n"
+            << "    \"float_relative_error_l2\": "
+            << metrics.FloatRelativeErrorL2 << "\n"
+            << "  },\n"
+            << "  \"status\": \""
+            << (metrics.Succeeded ? "passed" : "failed") << "\"\n"
+            << "}\n";
+        return out.str();
+    }
+
+    [[nodiscard]] bool WriteResult(
+        const std::filesystem::path& outputRoot,
+        const std::string& benchmarkId,
+        const std::string& payload)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(outputRoot, error);
+        if (error)
+            return false;
+        std::ofstream output{outputRoot / (benchmarkId + ".json"), std::ios::trunc};
+        if (!output.is_open())
+            return false;
+        output << payload;
+        return output.good();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        std::cerr << "usage: IntrinsicSparseSpMVProfile <output-directory>\n";
+        return 2;
+    }
+
+    // `1m` (default) or `heavy` (1M and 10M rows; the 10M cohort needs
+    // about 4 GiB).
+    const char* cohortEnvironment = std::getenv("INTRINSIC_SPMV_PROFILE_COHORT");
+    const std::string_view cohort = cohortEnvironment == nullptr ? "1m" : cohortEnvironment;
+
+    std::vector<SparseSpMVCohort> selected;
+    if (cohort == "1m")
+        selected.push_back(Intrinsic::Bench::Geometry::kSparseSpMV1MCohort);
+    else if (cohort == "heavy")
+        selected.assign({Intrinsic::Bench::Geometry::kSparseSpMV1MCohort,
+                         Intrinsic::Bench::Geometry::kSparseSpMV10MCohort});
+    else
+    {
+        std::cerr << "INTRINSIC_SPMV_PROFILE_COHORT must be 1m or heavy\n";
+        return 2;
+    }
+
+    const std::filesystem::path outputRoot{argv[1]};
+    const std::string commit = ResolveCommit();
+    bool allPassed = true;
+    for (const SparseSpMVCohort& spec : selected)
+    {
+        const SparseSpMVMetrics metrics = Intrinsic::Bench::Geometry::RunSparseSpMV(spec);
+        if (!WriteResult(outputRoot, spec.BenchmarkId, EmitResult(spec, metrics, commit)))
+        {
+            std::cerr << "failed to write " << spec.BenchmarkId << '\n';
+            return 1;
+        }
+        std::cout << "Wrote " << spec.BenchmarkId << '\n';
+        allPassed &= metrics.Succeeded;
+    }
+    return allPassed ? 0 : 1;
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <vector>
 
 namespace Intrinsic::Methods::Physics::SphFluidReference
@@ -25,6 +27,24 @@ namespace Intrinsic::Methods::Physics::SphFluidReference
         NonFiniteState,
     };
 
+    // Neighbor enumeration strategy. Both yield the same per-particle
+    // neighbor sets in ascending index order, so Step() results are bitwise
+    // identical; BruteForce is the O(N^2) all-pairs validation oracle.
+    enum class NeighborSearch
+    {
+        UniformGrid, // counting-sort spatial hash, cell size = SmoothingLength
+        BruteForce,
+    };
+
+    // Caller-supplied chunked parallel-for (engine task scheduler, plain
+    // worker threads, ...). It must call body(c) exactly once for every c in
+    // [0, chunkCount) and return only after all calls finished; calls may
+    // run concurrently. Chunk boundaries are fixed by the method and every
+    // chunk writes disjoint per-particle outputs, so results are bitwise
+    // identical for any executor and thread count. Empty = run inline.
+    using ParallelFor =
+        std::function<void(std::size_t chunkCount, const std::function<void(std::size_t chunk)>& body)>;
+
     struct ParticleState
     {
         Vec3 Position{};
@@ -49,7 +69,9 @@ namespace Intrinsic::Methods::Physics::SphFluidReference
         double Viscosity{0.05};         // dynamic viscosity mu
         double BoundaryRestitution{0.0}; // normal velocity scale on boundary hit
         std::size_t MaxNeighborLimit{0}; // advisory; 0 = unlimited
+        NeighborSearch Neighbors{NeighborSearch::UniformGrid};
         std::vector<BoundaryPlane> Boundaries{};
+        ParallelFor Executor{}; // per-particle phases; empty = single-threaded
     };
 
     struct Diagnostics
@@ -72,6 +94,15 @@ namespace Intrinsic::Methods::Physics::SphFluidReference
         bool           Stable{true};
     };
 
+    // Compressed per-particle neighbor lists: particle i's neighbors are
+    // Indices[Offsets[i], Offsets[i + 1]) -- every j with |x_i - x_j| < h,
+    // including i itself, in ascending index order.
+    struct NeighborList
+    {
+        std::vector<std::size_t>   Offsets{};
+        std::vector<std::uint32_t> Indices{};
+    };
+
     struct StepResult
     {
         std::vector<ParticleState> Particles{};
@@ -100,10 +131,19 @@ namespace Intrinsic::Methods::Physics::SphFluidReference
     [[nodiscard]] auto Validate(const std::vector<ParticleState>& particles, const StepParams& params)
         -> ValidationCode;
 
+    // Neighbor lists for the current positions using params.Neighbors.
+    // Step() builds them once and shares them across density, neighbor
+    // diagnostics, and forces.
+    [[nodiscard]] auto BuildNeighborList(const std::vector<ParticleState>& particles,
+                                         const StepParams& params) -> NeighborList;
+
     // Density at each particle from the current positions (includes the
     // self-contribution m * W(0)). Deterministic index-ordered accumulation.
     [[nodiscard]] auto ComputeDensities(const std::vector<ParticleState>& particles,
                                         const StepParams& params) -> std::vector<double>;
+    [[nodiscard]] auto ComputeDensities(const std::vector<ParticleState>& particles,
+                                        const StepParams& params,
+                                        const NeighborList& neighbors) -> std::vector<double>;
 
     [[nodiscard]] auto ComputeKineticEnergy(const std::vector<ParticleState>& particles,
                                             const StepParams& params) -> double;
@@ -1,7 +1,9 @@
 #include "SphFluidReference.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 
 namespace Intrinsic::Methods::Physics::SphFluidReference
 {
@@ -9,6 +11,204 @@ namespace Intrinsic::Methods::Physics::SphFluidReference
     {
         constexpr double kPi = 3.141592653589793238462643383279502884;
         constexpr double kDistanceEpsilon = 1.0e-12;
+        // Cell coordinates are clamped so far-flung (finite) particles cannot
+        // overflow the integer conversion; clamped cells only cost extra
+        // distance tests, never correctness.
+        constexpr double kMaxCellCoordinate = 1.0e9;
+        // Work unit handed to StepParams::Executor; fixed so results never
+        // depend on the executor or its thread count.
+        constexpr std::size_t kParticleChunkSize = 1024;
+
+        struct GridCell
+        {
+            std::int64_t X{0};
+            std::int64_t Y{0};
+            std::int64_t Z{0};
+        };
+
+        [[nodiscard]] auto CellCoordinate(double value, double origin, double cellSize) -> std::int64_t
+        {
+            const double cell = std::floor((value - origin) / cellSize);
+            return static_cast<std::int64_t>(std::clamp(cell, -kMaxCellCoordinate, kMaxCellCoordinate));
+        }
+
+        [[nodiscard]] auto HashCell(std::int64_t x, std::int64_t y, std::int64_t z, std::uint64_t mask)
+            -> std::uint32_t
+        {
+            const std::uint64_t hash = static_cast<std::uint64_t>(x) * 73856093ull ^
+                                       static_cast<std::uint64_t>(y) * 19349663ull ^
+                                       static_cast<std::uint64_t>(z) * 83492791ull;
+            return static_cast<std::uint32_t>(hash & mask);
+        }
+
+        [[nodiscard]] auto ChunkCount(std::size_t count) -> std::size_t
+        {
+            return (count + kParticleChunkSize - 1) / kParticleChunkSize;
+        }
+
+        // Runs body(chunk, begin, end) over fixed kParticleChunkSize ranges,
+        // inline or through the caller's executor. Chunking never depends on
+        // the executor, so per-chunk outputs are identical either way.
+        template <typename Body>
+        void ForEachParticleChunk(const ParallelFor& executor, std::size_t count, const Body& body)
+        {
+            const std::size_t chunkCount = ChunkCount(count);
+            const auto runChunk = [&](std::size_t chunk)
+            {
+                const std::size_t begin = chunk * kParticleChunkSize;
+                body(chunk, begin, std::min(count, begin + kParticleChunkSize));
+            };
+            if (!executor || chunkCount <= 1)
+            {
+                for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+                {
+                    runChunk(chunk);
+                }
+                return;
+            }
+            executor(chunkCount, runChunk);
+        }
+
+        // Per-chunk neighbor gathering: query(i, out) appends particle i's
+        // ascending neighbor indices. Chunk buffers are concatenated in
+        // chunk order, so the list does not depend on the executor.
+        template <typename Query>
+        [[nodiscard]] auto GatherNeighborList(std::size_t count, const ParallelFor& executor, const Query& query)
+            -> NeighborList
+        {
+            NeighborList list{};
+            list.Offsets.assign(count + 1, 0);
+            std::vector<std::vector<std::uint32_t>> chunkIndices(ChunkCount(count));
+            ForEachParticleChunk(executor, count,
+                                 [&](std::size_t chunk, std::size_t begin, std::size_t end)
+                                 {
+                                     std::vector<std::uint32_t>& indices = chunkIndices[chunk];
+                                     for (std::size_t i = begin; i < end; ++i)
+                                     {
+                                         const std::size_t before = indices.size();
+                                         query(i, indices);
+                                         list.Offsets[i + 1] = indices.size() - before;
+                                     }
+                                 });
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                list.Offsets[i + 1] += list.Offsets[i];
+            }
+            list.Indices.reserve(list.Offsets[count]);
+            for (const std::vector<std::uint32_t>& indices : chunkIndices)
+            {
+                list.Indices.insert(list.Indices.end(), indices.begin(), indices.end());
+            }
+            return list;
+        }
+
+        [[nodiscard]] auto BuildBruteForceNeighborList(const std::vector<ParticleState>& particles,
+                                                       double h,
+                                                       const ParallelFor& executor) -> NeighborList
+        {
+            return GatherNeighborList(particles.size(), executor,
+                                      [&](std::size_t i, std::vector<std::uint32_t>& out)
+                                      {
+                                          for (std::size_t j = 0; j < particles.size(); ++j)
+                                          {
+                                              if (Length(particles[i].Position - particles[j].Position) < h)
+                                              {
+                                                  out.push_back(static_cast<std::uint32_t>(j));
+                                              }
+                                          }
+                                      });
+        }
+
+        // Counting-sort spatial hash: particles are binned into hashed cells
+        // of edge h (stable, so each bucket lists ascending indices), then
+        // each particle scans the buckets of its 27 surrounding cells. Hash
+        // collisions only add candidates that the distance test rejects;
+        // a bucket shared by two of the 27 cells is scanned once.
+        [[nodiscard]] auto BuildGridNeighborList(const std::vector<ParticleState>& particles,
+                                                 double h,
+                                                 const ParallelFor& executor) -> NeighborList
+        {
+            const std::size_t count = particles.size();
+            if (count == 0)
+            {
+                return NeighborList{{0}, {}};
+            }
+
+            Vec3 origin = particles.front().Position;
+            for (const ParticleState& particle : particles)
+            {
+                origin.X = std::min(origin.X, particle.Position.X);
+                origin.Y = std::min(origin.Y, particle.Position.Y);
+                origin.Z = std::min(origin.Z, particle.Position.Z);
+            }
+
+            std::size_t tableSize = 1;
+            while (tableSize < 2 * count)
+            {
+                tableSize <<= 1u;
+            }
+            const std::uint64_t mask = static_cast<std::uint64_t>(tableSize - 1);
+
+            std::vector<GridCell> cells(count);
+            std::vector<std::uint32_t> buckets(count);
+            std::vector<std::uint32_t> bucketStart(tableSize + 1, 0);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const Vec3& position = particles[i].Position;
+                cells[i] = GridCell{CellCoordinate(position.X, origin.X, h),
+                                    CellCoordinate(position.Y, origin.Y, h),
+                                    CellCoordinate(position.Z, origin.Z, h)};
+                buckets[i] = HashCell(cells[i].X, cells[i].Y, cells[i].Z, mask);
+                ++bucketStart[buckets[i] + 1];
+            }
+            for (std::size_t b = 0; b < tableSize; ++b)
+            {
+                bucketStart[b + 1] += bucketStart[b];
+            }
+            std::vector<std::uint32_t> sorted(count);
+            std::vector<std::uint32_t> cursor(bucketStart.begin(), bucketStart.end() - 1);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                sorted[cursor[buckets[i]]++] = static_cast<std::uint32_t>(i);
+            }
+
+            return GatherNeighborList(
+                count, executor,
+                [&](std::size_t i, std::vector<std::uint32_t>& out)
+                {
+                    const GridCell cell = cells[i];
+                    const std::size_t begin = out.size();
+                    std::array<std::uint32_t, 27> visited{};
+                    std::size_t visitedCount = 0;
+                    for (std::int64_t dz = -1; dz <= 1; ++dz)
+                    {
+                        for (std::int64_t dy = -1; dy <= 1; ++dy)
+                        {
+                            for (std::int64_t dx = -1; dx <= 1; ++dx)
+                            {
+                                const std::uint32_t bucket = HashCell(cell.X + dx, cell.Y + dy, cell.Z + dz, mask);
+                                const auto visitedEnd = visited.begin() + static_cast<std::ptrdiff_t>(visitedCount);
+                                if (std::find(visited.begin(), visitedEnd, bucket) != visitedEnd)
+                                {
+                                    continue;
+                                }
+                                visited[visitedCount++] = bucket;
+                                for (std::uint32_t k = bucketStart[bucket]; k < bucketStart[bucket + 1]; ++k)
+                                {
+                                    const std::uint32_t j = sorted[k];
+                                    if (Length(particles[i].Position - particles[j].Position) < h)
+                                    {
+                                        out.push_back(j);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                    // Ascending order makes every accumulation below match
+                    // the all-pairs oracle bit for bit.
+                    std::sort(out.begin() + static_cast<std::ptrdiff_t>(begin), out.end());
+                });
+        }
 
         [[nodiscard]] auto AllFinite(const std::vector<ParticleState>& particles) -> bool
         {
@@ -125,21 +325,48 @@ namespace Intrinsic::Methods::Physics::SphFluidReference
         return ValidationCode::Valid;
     }
 
+    auto BuildNeighborList(const std::vector<ParticleState>& particles, const StepParams& params)
+        -> NeighborList
+    {
+        // Unvalidated input (non-positive support, non-finite positions) has
+        // no meaningful grid; the all-pairs scan handles it unchanged.
+        if (params.Neighbors == NeighborSearch::BruteForce || !(params.SmoothingLength > 0.0) ||
+            !std::isfinite(params.SmoothingLength) || !AllFinite(particles))
+        {
+            return BuildBruteForceNeighborList(particles, params.SmoothingLength, params.Executor);
+        }
+        return BuildGridNeighborList(particles, params.SmoothingLength, params.Executor);
+    }
+
     auto ComputeDensities(const std::vector<ParticleState>& particles, const StepParams& params)
         -> std::vector<double>
     {
+        return ComputeDensities(particles, params, BuildNeighborList(particles, params));
+    }
+
+    auto ComputeDensities(const std::vector<ParticleState>& particles,
+                          const StepParams& params,
+                          const NeighborList& neighbors) -> std::vector<double>
+    {
+        // Particles outside the support contribute exactly zero, so summing
+        // only the (ascending) neighbor list reproduces the all-pairs sum.
         const double h = params.SmoothingLength;
         std::vector<double> densities(particles.size(), 0.0);
-        for (std::size_t i = 0; i < particles.size(); ++i)
-        {
-            double density = 0.0;
-            for (std::size_t j = 0; j < particles.size(); ++j)
-            {
-                const double r = Length(particles[i].Position - particles[j].Position);
-                density += params.ParticleMass * Poly6Kernel(r, h);
-            }
-            densities[i] = density;
-        }
+        ForEachParticleChunk(params.Executor, particles.size(),
+                             [&](std::size_t, std::size_t begin, std::size_t end)
+                             {
+                                 for (std::size_t i = begin; i < end; ++i)
+                                 {
+                                     double density = 0.0;
+                                     for (std::size_t k = neighbors.Offsets[i]; k < neighbors.Offsets[i + 1]; ++k)
+                                     {
+                                         const std::size_t j = neighbors.Indices[k];
+                                         const double r = Length(particles[i].Position - particles[j].Position);
+                                         density += params.ParticleMass * Poly6Kernel(r, h);
+                                     }
+                                     densities[i] = density;
+                                 }
+                             });
         return densities;
     }
 
@@ -173,120 +400,103 @@ namespace Intrinsic::Methods::Physics::SphFluidReference
         result.Diagnostics.TotalMass = mass * static_cast<double>(particles.size());
         result.Diagnostics.KineticEnergyBefore = ComputeKineticEnergy(particles, params);
 
-        // Density and pressure from current positions. The reference uses
-        // deterministic all-pairs neighbor enumeration in index order; the
-        // neighbor limit is advisory (reported, never truncating).
-        const std::vector<double> densities = ComputeDensities(particles, params);
+        // Density and pressure from current positions. Neighbor lists are
+        // built once (uniform grid or the all-pairs oracle) and enumerated in
+        // index order by every phase; the neighbor limit is advisory
+        // (reported, never truncating).
+        const NeighborList neighbors = BuildNeighborList(particles, params);
+        const std::vector<double> densities = ComputeDensities(particles, params, neighbors);
         std::vector<double> pressures(particles.size(), 0.0);
-        for (std::size_t i = 0; i < particles.size(); ++i)
-        {
-            // Pressure clamped at zero: classic WCSPH avoids tensile
-            // instability by not modeling negative (suction) pressure.
-            pressures[i] = std::max(0.0, params.Stiffness * (densities[i] - params.RestDensity));
-        }
+        ForEachParticleChunk(params.Executor, particles.size(),
+                             [&](std::size_t, std::size_t begin, std::size_t end)
+                             {
+                                 for (std::size_t i = begin; i < end; ++i)
+                                 {
+                                     // Pressure clamped at zero: classic WCSPH
+                                     // avoids tensile instability by not
+                                     // modeling negative (suction) pressure.
+                                     pressures[i] =
+                                         std::max(0.0, params.Stiffness * (densities[i] - params.RestDensity));
+                                 }
+                             });
 
-        if (params.MaxNeighborLimit > 0)
-        {
-            for (std::size_t i = 0; i < particles.size(); ++i)
-            {
-                std::size_t neighbors = 0;
-                for (std::size_t j = 0; j < particles.size(); ++j)
-                {
-                    if (i == j)
-                    {
-                        continue;
-                    }
-                    if (Length(particles[i].Position - particles[j].Position) < h)
-                    {
-                        ++neighbors;
-                    }
-                }
-                result.Diagnostics.MaxNeighborCount =
-                    std::max(result.Diagnostics.MaxNeighborCount, neighbors);
-                if (neighbors > params.MaxNeighborLimit)
-                {
-                    ++result.Diagnostics.NeighborOverflowCount;
-                }
-            }
-        }
-        else
+        for (std::size_t i = 0; i < particles.size(); ++i)
         {
-            for (std::size_t i = 0; i < particles.size(); ++i)
+            // The list includes the particle itself.
+            const std::size_t neighborCount = neighbors.Offsets[i + 1] - neighbors.Offsets[i] - 1;
+            result.Diagnostics.MaxNeighborCount =
+                std::max(result.Diagnostics.MaxNeighborCount, neighborCount);
+            if (params.MaxNeighborLimit > 0 && neighborCount > params.MaxNeighborLimit)
             {
-                std::size_t neighbors = 0;
-                for (std::size_t j = 0; j < particles.size(); ++j)
-                {
-                    if (i != j && Length(particles[i].Position - particles[j].Position) < h)
-                    {
-                        ++neighbors;
-                    }
-                }
-                result.Diagnostics.MaxNeighborCount =
-                    std::max(result.Diagnostics.MaxNeighborCount, neighbors);
+                ++result.Diagnostics.NeighborOverflowCount;
             }
         }
 
         // Symmetric pressure force plus viscosity (Mueller 2003), then
-        // gravity, integrated with semi-implicit Euler.
-        for (std::size_t i = 0; i < particles.size(); ++i)
-        {
-            Vec3 pressureForce{};
-            Vec3 viscosityForce{};
-            for (std::size_t j = 0; j < particles.size(); ++j)
+        // gravity, integrated with semi-implicit Euler. Boundary half-spaces
+        // then project the position back and reflect the normal velocity
+        // scaled by the boundary restitution (0 = inelastic). Validated
+        // normals need not be unit length, so the projection and reflection
+        // scale by dot(N, N) to stay exact for any accepted plane. Each
+        // particle reads only the input state and writes only itself, so
+        // chunks run independently.
+        ForEachParticleChunk(
+            params.Executor, particles.size(),
+            [&](std::size_t, std::size_t begin, std::size_t end)
             {
-                if (i == j)
+                for (std::size_t i = begin; i < end; ++i)
                 {
-                    continue;
-                }
-                const Vec3   delta = particles[i].Position - particles[j].Position;
-                const double r = Length(delta);
-                if (r >= h)
-                {
-                    continue;
-                }
-                if (r > kDistanceEpsilon)
-                {
-                    const Vec3   direction = delta / r;
-                    const double sharedPressure = (pressures[i] + pressures[j]) / (2.0 * densities[j]);
-                    pressureForce =
-                        pressureForce + direction * (mass * sharedPressure * SpikyGradientMagnitude(r, h));
-                }
-                viscosityForce =
-                    viscosityForce + (particles[j].Velocity - particles[i].Velocity) *
-                                         (params.Viscosity * mass / densities[j] * ViscosityLaplacian(r, h));
-            }
+                    Vec3 pressureForce{};
+                    Vec3 viscosityForce{};
+                    for (std::size_t k = neighbors.Offsets[i]; k < neighbors.Offsets[i + 1]; ++k)
+                    {
+                        const std::size_t j = neighbors.Indices[k];
+                        if (i == j)
+                        {
+                            continue;
+                        }
+                        const Vec3   delta = particles[i].Position - particles[j].Position;
+                        const double r = Length(delta);
+                        if (r >= h)
+                        {
+                            continue;
+                        }
+                        if (r > kDistanceEpsilon)
+                        {
+                            const Vec3   direction = delta / r;
+                            const double sharedPressure = (pressures[i] + pressures[j]) / (2.0 * densities[j]);
+                            pressureForce =
+                                pressureForce + direction * (mass * sharedPressure * SpikyGradientMagnitude(r, h));
+                        }
+                        viscosityForce =
+                            viscosityForce + (particles[j].Velocity - particles[i].Velocity) *
+                                                 (params.Viscosity * mass / densities[j] * ViscosityLaplacian(r, h));
+                    }
 
-            ParticleState& particle = result.Particles[i];
-            const Vec3 acceleration = (pressureForce + viscosityForce) / densities[i] + params.Gravity;
-            particle.Velocity = particle.Velocity + acceleration * params.DeltaTime;
-            particle.Position = particle.Position + particle.Velocity * params.DeltaTime;
-        }
+                    ParticleState& particle = result.Particles[i];
+                    const Vec3 acceleration = (pressureForce + viscosityForce) / densities[i] + params.Gravity;
+                    particle.Velocity = particle.Velocity + acceleration * params.DeltaTime;
+                    particle.Position = particle.Position + particle.Velocity * params.DeltaTime;
 
-        // Boundary half-spaces: project position back and reflect the normal
-        // velocity scaled by the boundary restitution (0 = inelastic).
-        // Validated normals need not be unit length, so the projection and
-        // reflection scale by dot(N, N) to stay exact for any accepted plane.
-        for (const BoundaryPlane& plane : params.Boundaries)
-        {
-            const double normalLengthSquared = Dot(plane.Normal, plane.Normal);
-            for (ParticleState& particle : result.Particles)
-            {
-                const double distance =
-                    (Dot(plane.Normal, particle.Position) - plane.Offset) / normalLengthSquared;
-                if (distance < 0.0)
-                {
-                    particle.Position = particle.Position - plane.Normal * distance;
-                    const double normalVelocity =
-                        Dot(plane.Normal, particle.Velocity) / normalLengthSquared;
-                    if (normalVelocity < 0.0)
+                    for (const BoundaryPlane& plane : params.Boundaries)
                     {
-                        particle.Velocity =
-                            particle.Velocity -
-                            plane.Normal * ((1.0 + params.BoundaryRestitution) * normalVelocity);
+                        const double normalLengthSquared = Dot(plane.Normal, plane.Normal);
+                        const double distance =
+                            (Dot(plane.Normal, particle.Position) - plane.Offset) / normalLengthSquared;
+                        if (distance < 0.0)
+                        {
+                            particle.Position = particle.Position - plane.Normal * distance;
+                            const double normalVelocity = Dot(plane.Normal, particle.Velocity) / normalLengthSquared;
+                            if (normalVelocity < 0.0)
+                            {
+                                particle.Velocity =
+                                    particle.Velocity -
+                                    plane.Normal * ((1.0 + params.BoundaryRestitution) * normalVelocity);
+                            }
+                        }
                     }
                 }
-            }
-        }
+            });
 
         if (!AllFinite(result.Particles))
         {
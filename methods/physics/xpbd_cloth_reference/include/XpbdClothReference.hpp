@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <vector>
 
 namespace Intrinsic::Methods::Physics::XpbdClothReference
@@ -27,6 +28,28 @@ namespace Intrinsic::Methods::Physics::XpbdClothReference
         NonFiniteState,
     };
 
+    // Caller-supplied chunked parallel-for (engine task scheduler, plain
+    // worker threads, ...). It must call body(c) exactly once for every c in
+    // [0, chunkCount) and return only after all calls finished; calls may
+    // run concurrently. Chunk boundaries are fixed by the method and every
+    // chunk writes disjoint outputs, so results are bitwise identical for
+    // any executor and thread count. Empty = run inline.
+    using ParallelFor =
+        std::function<void(std::size_t chunkCount, const std::function<void(std::size_t chunk)>& body)>;
+
+    // Constraint projection order. Sequential is the Gauss-Seidel reference:
+    // every stretch then every bend constraint in list order, always on the
+    // calling thread. Colored projects one graph color at a time; no two
+    // constraints of a color share a particle, so a color's constraints run
+    // through StepParams::Executor without atomics. Colored results are
+    // bitwise identical for any executor but differ from Sequential (the
+    // Gauss-Seidel sweep visits constraints in a different order).
+    enum class ConstraintOrder
+    {
+        Sequential,
+        Colored,
+    };
+
     // Inverse mass of 0 pins the particle: it never integrates, ignores
     // constraint corrections, and may be repositioned by the caller between
     // steps (kinematic authoring).
@@ -70,6 +93,15 @@ namespace Intrinsic::Methods::Physics::XpbdClothReference
         double       Radius{0.0};
     };
 
+    // Greedy graph coloring of one constraint list: color c holds
+    // Constraints[ColorOffsets[c], ColorOffsets[c + 1]), ascending constraint
+    // indices, pairwise particle-disjoint.
+    struct ConstraintColoring
+    {
+        std::vector<std::size_t> ColorOffsets{};
+        std::vector<std::size_t> Constraints{};
+    };
+
     struct ClothState
     {
         std::vector<ParticleState>      Particles{};
@@ -86,6 +118,8 @@ namespace Intrinsic::Methods::Physics::XpbdClothReference
         double                GlobalDamping{0.0};      // velocity *= max(0, 1 - GlobalDamping * dt)
         double                ResidualTolerance{1.0e-3};
         std::vector<Collider> Colliders{};
+        ConstraintOrder       Order{ConstraintOrder::Sequential};
+        ParallelFor           Executor{}; // per-particle phases and Colored batches; empty = single-threaded
     };
 
     struct Diagnostics
@@ -99,6 +133,8 @@ namespace Intrinsic::Methods::Physics::XpbdClothReference
         std::size_t    DegenerateTriangleCount{0};  // zero-area triangles (valid indices)
         std::size_t    DegenerateConstraintCount{0}; // coincident endpoints skipped this step
         std::size_t    UnsupportedColliderCount{0};
+        std::size_t    StretchColorCount{0}; // Colored order only
+        std::size_t    BendColorCount{0};    // Colored order only
         int            IterationsUsed{0};
         bool           Converged{true}; // max residual within ResidualTolerance after solve
         double         MaxStretchResidual{0.0};
@@ -147,6 +183,11 @@ namespace Intrinsic::Methods::Physics::XpbdClothReference
                                                double stretchCompliance,
                                                double bendCompliance) -> ClothState;
 
+    // Assigns each constraint the smallest color not yet used at either
+    // endpoint, visiting constraints in list order (deterministic).
+    [[nodiscard]] auto BuildConstraintColoring(const std::vector<DistanceConstraint>& constraints,
+                                               std::size_t particleCount) -> ConstraintColoring;
+
     [[nodiscard]] auto Validate(const ParticleState& particle) -> ValidationCode;
     [[nodiscard]] auto Validate(const DistanceConstraint& constraint, std::size_t particleCount) -> ValidationCode;
     [[nodiscard]] auto Validate(const Collider& collider) -> ValidationCode;
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <map>
 #include <utility>
 
@@ -11,6 +12,31 @@ namespace Intrinsic::Methods::Physics::XpbdClothReference
     {
         constexpr double kDegenerateLengthEpsilon = 1.0e-12;
         constexpr double kDegenerateAreaEpsilon = 1.0e-16;
+        // Work unit handed to StepParams::Executor (particles or constraints
+        // of one color); fixed so results never depend on the executor.
+        constexpr std::size_t kChunkSize = 1024;
+
+        // Runs body(chunk, begin, end) over fixed kChunkSize ranges, inline
+        // or through the caller's executor.
+        template <typename Body>
+        void ForEachChunk(const ParallelFor& executor, std::size_t count, const Body& body)
+        {
+            const std::size_t chunkCount = (count + kChunkSize - 1) / kChunkSize;
+            const auto runChunk = [&](std::size_t chunk)
+            {
+                const std::size_t begin = chunk * kChunkSize;
+                body(chunk, begin, std::min(count, begin + kChunkSize));
+            };
+            if (!executor || chunkCount <= 1)
+            {
+                for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+                {
+                    runChunk(chunk);
+                }
+                return;
+            }
+            executor(chunkCount, runChunk);
+        }
 
         [[nodiscard]] auto DampingFactor(double damping, double dt) -> double
         {
@@ -71,30 +97,80 @@ namespace Intrinsic::Methods::Physics::XpbdClothReference
             b.Position = b.Position - gradient * (b.InverseMass * deltaLambda);
         }
 
+        // Colliders act on each particle independently, so particles are
+        // chunked and each applies every collider in list order.
         void ProjectColliders(std::vector<ParticleState>& particles,
-                              const std::vector<Collider>& colliders)
+                              const std::vector<Collider>& colliders,
+                              const ParallelFor& executor)
         {
-            for (const Collider& collider : colliders)
+            if (colliders.empty())
             {
-                if (collider.Kind != ColliderKind::HalfSpace)
-                {
-                    continue; // unsupported kinds counted once per step elsewhere
-                }
-                // Validated normals need not be unit length, so the projection
-                // scales by dot(N, N) to stay exact for any accepted plane.
-                const double normalLengthSquared = Dot(collider.Normal, collider.Normal);
-                for (ParticleState& particle : particles)
+                return;
+            }
+            ForEachChunk(executor, particles.size(),
+                         [&](std::size_t, std::size_t begin, std::size_t end)
+                         {
+                             for (std::size_t i = begin; i < end; ++i)
+                             {
+                                 ParticleState& particle = particles[i];
+                                 if (particle.InverseMass <= 0.0)
+                                 {
+                                     continue;
+                                 }
+                                 for (const Collider& collider : colliders)
+                                 {
+                                     if (collider.Kind != ColliderKind::HalfSpace)
+                                     {
+                                         continue; // unsupported kinds counted once per step elsewhere
+                                     }
+                                     // Validated normals need not be unit length, so the
+                                     // projection scales by dot(N, N) to stay exact for
+                                     // any accepted plane.
+                                     const double normalLengthSquared = Dot(collider.Normal, collider.Normal);
+                                     const double distance =
+                                         (Dot(collider.Normal, particle.Position) - collider.Offset) /
+                                         normalLengthSquared;
+                                     if (distance < 0.0)
+                                     {
+                                         particle.Position = particle.Position - collider.Normal * distance;
+                                     }
+                                 }
+                             }
+                         });
+        }
+
+        // One Gauss-Seidel sweep over a colored constraint list. Colors run
+        // in order; a color's constraints touch disjoint particles and
+        // lambdas, so its chunks are independent. Degenerate counts are kept
+        // per chunk and summed afterwards.
+        void SolveColoredConstraints(std::vector<ParticleState>& particles,
+                                     const std::vector<DistanceConstraint>& constraints,
+                                     const ConstraintColoring& coloring,
+                                     double dt,
+                                     std::vector<double>& lambdas,
+                                     bool countDegenerate,
+                                     const ParallelFor& executor,
+                                     std::size_t& degenerateCount)
+        {
+            std::vector<std::size_t> chunkDegenerate;
+            for (std::size_t color = 0; color + 1 < coloring.ColorOffsets.size(); ++color)
+            {
+                const std::size_t colorBegin = coloring.ColorOffsets[color];
+                const std::size_t colorSize = coloring.ColorOffsets[color + 1] - colorBegin;
+                chunkDegenerate.assign((colorSize + kChunkSize - 1) / kChunkSize, 0);
+                ForEachChunk(executor, colorSize,
+                             [&](std::size_t chunk, std::size_t begin, std::size_t end)
+                             {
+                                 for (std::size_t k = colorBegin + begin; k < colorBegin + end; ++k)
+                                 {
+                                     const std::size_t index = coloring.Constraints[k];
+                                     SolveDistanceConstraint(particles, constraints[index], dt, lambdas[index],
+                                                             countDegenerate, chunkDegenerate[chunk]);
+                                 }
+                             });
+                for (const std::size_t count : chunkDegenerate)
                 {
-                    if (particle.InverseMass <= 0.0)
-                    {
-                        continue;
-                    }
-                    const double distance =
-                        (Dot(collider.Normal, particle.Position) - collider.Offset) / normalLengthSquared;
-                    if (distance < 0.0)
-                    {
-                        particle.Position = particle.Position - collider.Normal * distance;
-                    }
+                    degenerateCount += count;
                 }
             }
         }
@@ -240,6 +316,73 @@ namespace Intrinsic::Methods::Physics::XpbdClothReference
         return state;
     }
 
+    auto BuildConstraintColoring(const std::vector<DistanceConstraint>& constraints, std::size_t particleCount)
+        -> ConstraintColoring
+    {
+        // Colors 0..63 are tracked as per-particle bit masks; the (rare)
+        // particles with more incident constraints spill into a sorted list.
+        std::vector<std::uint64_t>              usedLow(particleCount, 0);
+        std::vector<std::vector<std::size_t>>   usedHigh(particleCount);
+        std::vector<std::size_t>                colors(constraints.size(), 0);
+        std::size_t                             colorCount = 0;
+        for (std::size_t i = 0; i < constraints.size(); ++i)
+        {
+            const std::size_t a = constraints[i].ParticleA;
+            const std::size_t b = constraints[i].ParticleB;
+            if (a >= particleCount || b >= particleCount)
+            {
+                continue; // rejected by Validate; kept in color 0 for a total partition
+            }
+            const std::uint64_t used = usedLow[a] | usedLow[b];
+            std::size_t color = 0;
+            if (used != ~std::uint64_t{0})
+            {
+                while ((used >> color) & 1u)
+                {
+                    ++color;
+                }
+                usedLow[a] |= std::uint64_t{1} << color;
+                usedLow[b] |= std::uint64_t{1} << color;
+            }
+            else
+            {
+                color = 64;
+                while (std::binary_search(usedHigh[a].begin(), usedHigh[a].end(), color) ||
+                       std::binary_search(usedHigh[b].begin(), usedHigh[b].end(), color))
+                {
+                    ++color;
+                }
+                usedHigh[a].insert(std::lower_bound(usedHigh[a].begin(), usedHigh[a].end(), color), color);
+                usedHigh[b].insert(std::lower_bound(usedHigh[b].begin(), usedHigh[b].end(), color), color);
+            }
+            colors[i] = color;
+            colorCount = std::max(colorCount, color + 1);
+        }
+        if (!constraints.empty())
+        {
+            colorCount = std::max<std::size_t>(colorCount, 1);
+        }
+
+        // Stable counting sort by color keeps ascending indices per color.
+        ConstraintColoring coloring{};
+        coloring.ColorOffsets.assign(colorCount + 1, 0);
+        for (const std::size_t color : colors)
+        {
+            ++coloring.ColorOffsets[color + 1];
+        }
+        for (std::size_t color = 0; color < colorCount; ++color)
+        {
+            coloring.ColorOffsets[color + 1] += coloring.ColorOffsets[color];
+        }
+        coloring.Constraints.resize(constraints.size());
+        std::vector<std::size_t> cursor(coloring.ColorOffsets.begin(), coloring.ColorOffsets.end() - 1);
+        for (std::size_t i = 0; i < constraints.size(); ++i)
+        {
+            coloring.Constraints[cursor[colors[i]]++] = i;
+        }
+        return coloring;
+    }
+
     auto Validate(const ParticleState& particle) -> ValidationCode
     {
         if (!IsFinite(particle.Position) || !IsFinite(particle.Velocity))
@@ -422,54 +565,84 @@ namespace Intrinsic::Methods::Physics::XpbdClothReference
 
         const double dt = params.DeltaTime;
 
+        std::vector<ParticleState>& particles = result.State.Particles;
+
         // Predict positions (semi-implicit velocity, then position).
-        std::vector<Vec3> previousPositions;
-        previousPositions.reserve(result.State.Particles.size());
-        for (ParticleState& particle : result.State.Particles)
-        {
-            previousPositions.push_back(particle.Position);
-            if (particle.InverseMass <= 0.0)
-            {
-                continue;
-            }
-            particle.Velocity = particle.Velocity + params.Gravity * dt;
-            particle.Position = particle.Position + particle.Velocity * dt;
-        }
+        std::vector<Vec3> previousPositions(particles.size());
+        ForEachChunk(params.Executor, particles.size(),
+                     [&](std::size_t, std::size_t begin, std::size_t end)
+                     {
+                         for (std::size_t i = begin; i < end; ++i)
+                         {
+                             ParticleState& particle = particles[i];
+                             previousPositions[i] = particle.Position;
+                             if (particle.InverseMass <= 0.0)
+                             {
+                                 continue;
+                             }
+                             particle.Velocity = particle.Velocity + params.Gravity * dt;
+                             particle.Position = particle.Position + particle.Velocity * dt;
+                         }
+                     });
 
         // XPBD iterations with per-constraint Lagrange multipliers.
+        const bool colored = params.Order == ConstraintOrder::Colored;
+        ConstraintColoring stretchColoring{};
+        ConstraintColoring bendColoring{};
+        if (colored)
+        {
+            stretchColoring = BuildConstraintColoring(state.StretchConstraints, particles.size());
+            bendColoring = BuildConstraintColoring(state.BendConstraints, particles.size());
+            result.Diagnostics.StretchColorCount = stretchColoring.ColorOffsets.size() - 1;
+            result.Diagnostics.BendColorCount = bendColoring.ColorOffsets.size() - 1;
+        }
         std::vector<double> stretchLambdas(state.StretchConstraints.size(), 0.0);
         std::vector<double> bendLambdas(state.BendConstraints.size(), 0.0);
         for (int iteration = 0; iteration < params.Iterations; ++iteration)
         {
             const bool countDegenerate = iteration == 0;
-            for (std::size_t i = 0; i < state.StretchConstraints.size(); ++i)
+            if (colored)
             {
-                SolveDistanceConstraint(result.State.Particles, state.StretchConstraints[i], dt,
-                                        stretchLambdas[i], countDegenerate,
+                SolveColoredConstraints(particles, state.StretchConstraints, stretchColoring, dt, stretchLambdas,
+                                        countDegenerate, params.Executor,
+                                        result.Diagnostics.DegenerateConstraintCount);
+                SolveColoredConstraints(particles, state.BendConstraints, bendColoring, dt, bendLambdas,
+                                        countDegenerate, params.Executor,
                                         result.Diagnostics.DegenerateConstraintCount);
             }
-            for (std::size_t i = 0; i < state.BendConstraints.size(); ++i)
+            else
             {
-                SolveDistanceConstraint(result.State.Particles, state.BendConstraints[i], dt,
-                                        bendLambdas[i], countDegenerate,
-                                        result.Diagnostics.DegenerateConstraintCount);
+                for (std::size_t i = 0; i < state.StretchConstraints.size(); ++i)
+                {
+                    SolveDistanceConstraint(particles, state.StretchConstraints[i], dt, stretchLambdas[i],
+                                            countDegenerate, result.Diagnostics.DegenerateConstraintCount);
+                }
+                for (std::size_t i = 0; i < state.BendConstraints.size(); ++i)
+                {
+                    SolveDistanceConstraint(particles, state.BendConstraints[i], dt, bendLambdas[i],
+                                            countDegenerate, result.Diagnostics.DegenerateConstraintCount);
+                }
             }
-            ProjectColliders(result.State.Particles, params.Colliders);
+            ProjectColliders(particles, params.Colliders, params.Executor);
         }
         result.Diagnostics.IterationsUsed = params.Iterations;
 
         // Velocities from position change (PBD), then global damping.
         const double globalDampingFactor = DampingFactor(params.GlobalDamping, dt);
-        for (std::size_t i = 0; i < result.State.Particles.size(); ++i)
-        {
-            ParticleState& particle = result.State.Particles[i];
-            if (particle.InverseMass <= 0.0)
-            {
-                continue;
-            }
-            particle.Velocity = (particle.Position - previousPositions[i]) / dt;
-            particle.Velocity = particle.Velocity * globalDampingFactor;
-        }
+        ForEachChunk(params.Executor, particles.size(),
+                     [&](std::size_t, std::size_t begin, std::size_t end)
+                     {
+                         for (std::size_t i = begin; i < end; ++i)
+                         {
+                             ParticleState& particle = particles[i];
+                             if (particle.InverseMass <= 0.0)
+                             {
+                                 continue;
+                             }
+                             particle.Velocity = (particle.Position - previousPositions[i]) / dt;
+                             particle.Velocity = particle.Velocity * globalDampingFactor;
+                         }
+                     });
 
         if (!AllFinite(result.State))
         {
@@ -33,6 +33,7 @@ namespace Extrinsic::Assets
         inline constexpr std::array<std::string_view, 1> PtsAliases{"pts"};
         inline constexpr std::array<std::string_view, 1> XyzRgbAliases{"xyzrgb"};
         inline constexpr std::array<std::string_view, 1> PcdAliases{"pcd"};
+        inline constexpr std::array<std::string_view, 1> LasAliases{"las"};
         inline constexpr std::array<std::string_view, 1> TgfAliases{"tgf"};
         inline constexpr std::array<std::string_view, 2> EdgeAliases{"edges", "edgelist"};
         inline constexpr std::array<std::string_view, 1> GltfAliases{"gltf"};
@@ -44,7 +45,7 @@ namespace Extrinsic::Assets
         inline constexpr std::array<std::string_view, 1> HdrAliases{"hdr"};
         inline constexpr std::array<std::string_view, 2> KtxAliases{"ktx", "ktx2"};
 
-        inline constexpr std::array<AssetFileFormatInfo, 18> Formats{{
+        inline constexpr std::array<AssetFileFormatInfo, 19> Formats{{
             {AssetFileFormat::OBJ, "obj", ObjAliases, MeshOnly, MeshOnly, false, false},
             {AssetFileFormat::OFF, "off", OffAliases, MeshOnly, NoPayloads, false, false},
             {AssetFileFormat::STL, "stl", StlAliases, MeshOnly, MeshOnly, true, true},
@@ -53,6 +54,7 @@ namespace Extrinsic::Assets
             {AssetFileFormat::PTS, "pts", PtsAliases, PointCloudOnly, NoPayloads, false, false},
             {AssetFileFormat::XYZRGB, "xyzrgb", XyzRgbAliases, PointCloudOnly, NoPayloads, false, false},
             {AssetFileFormat::PCD, "pcd", PcdAliases, PointCloudOnly, PointCloudOnly, true, true},
+            {AssetFileFormat::LAS, "las", LasAliases, PointCloudOnly, NoPayloads, true, false},
             {AssetFileFormat::TGF, "tgf", TgfAliases, GraphOnly, GraphOnly, false, false},
             {AssetFileFormat::EdgeList, "edges", EdgeAliases, GraphOnly, GraphOnly, false, false},
             {AssetFileFormat::GLTF, "gltf", GltfAliases, ModelSceneOnly, NoPayloads, false, false},
@@ -395,6 +397,8 @@ namespace Extrinsic::Assets
             return "XYZRGB";
         case AssetFileFormat::PCD:
             return "PCD";
+        case AssetFileFormat::LAS:
+            return "LAS";
         case AssetFileFormat::TGF:
             return "TGF";
         case AssetFileFormat::EdgeList:
@@ -41,6 +41,7 @@ export namespace Extrinsic::Assets
         BMP = 15,
         HDR = 16,
         KTX = 17,
+        LAS = 18,
         Unknown = 0xff,
     };
 
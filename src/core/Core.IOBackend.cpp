@@ -1,18 +1,87 @@
 module;
 
+#include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <expected>
 #include <filesystem>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <span>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 module Extrinsic.Core.IOBackend;
 
 namespace Extrinsic::Core::IO
 {
+    namespace
+    {
+        [[nodiscard]] Core::Result WriteWholeFile(const std::string& path,
+                                                  std::span<const std::byte> data)
+        {
+            namespace fs = std::filesystem;
+            std::error_code ec;
+            const auto parent = fs::path(path).parent_path();
+            if (!parent.empty())
+                fs::create_directories(parent, ec);
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+                return std::unexpected(Core::ErrorCode::FileWriteError);
+
+            if (!data.empty())
+            {
+                file.write(reinterpret_cast<const char*>(data.data()),
+                           static_cast<std::streamsize>(data.size()));
+                if (!file)
+                    return std::unexpected(Core::ErrorCode::FileWriteError);
+            }
+            return Core::Ok();
+        }
+
+        // Resolves a request against a file of `fileSize` bytes.
+        [[nodiscard]] bool ResolveRange(const IORequest& request,
+                                        const std::size_t fileSize,
+                                        std::size_t& outSize) noexcept
+        {
+            if (request.Offset > fileSize)
+                return false;
+            outSize = (request.Size == 0) ? (fileSize - request.Offset) : request.Size;
+            return outSize <= fileSize - request.Offset;
+        }
+
+        struct FileIdentity
+        {
+            std::uint64_t Device = 0;
+            std::uint64_t Inode = 0;
+            std::uint64_t Size = 0;
+            std::int64_t ModifiedSeconds = 0;
+            std::int64_t ModifiedNanoseconds = 0;
+
+            bool operator==(const FileIdentity&) const = default;
+        };
+
+        [[nodiscard]] FileIdentity IdentityOf(const struct stat& info) noexcept
+        {
+            return FileIdentity{
+                .Device = static_cast<std::uint64_t>(info.st_dev),
+                .Inode = static_cast<std::uint64_t>(info.st_ino),
+                .Size = static_cast<std::uint64_t>(info.st_size),
+                .ModifiedSeconds = static_cast<std::int64_t>(info.st_mtim.tv_sec),
+                .ModifiedNanoseconds = static_cast<std::int64_t>(info.st_mtim.tv_nsec),
+            };
+        }
+    }
+
     PathKey PathKey::FromPath(std::string_view path) noexcept
     {
         // FNV-1a 64-bit
@@ -41,16 +110,11 @@ namespace Extrinsic::Core::IO
             return std::unexpected(Core::ErrorCode::FileReadError);
 
         const auto fileSize = static_cast<std::size_t>(file.tellg());
-        const std::size_t offset = request.Offset;
-        if (offset > fileSize)
+        std::size_t readSize = 0;
+        if (!ResolveRange(request, fileSize, readSize))
             return std::unexpected(Core::ErrorCode::OutOfRange);
 
-        const std::size_t readSize =
-            (request.Size == 0) ? (fileSize - offset) : request.Size;
-        if (offset + readSize > fileSize)
-            return std::unexpected(Core::ErrorCode::OutOfRange);
-
-        file.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+        file.seekg(static_cast<std::streamoff>(request.Offset), std::ios::beg);
         if (!file)
             return std::unexpected(Core::ErrorCode::FileReadError);
 
@@ -70,24 +134,140 @@ namespace Extrinsic::Core::IO
         if (request.Path.empty())
             return std::unexpected(Core::ErrorCode::InvalidPath);
 
-        namespace fs = std::filesystem;
-        std::error_code ec;
-        const auto parent = fs::path(request.Path).parent_path();
-        if (!parent.empty())
-            fs::create_directories(parent, ec);
+        return WriteWholeFile(request.Path, data);
+    }
 
-        std::ofstream file(request.Path, std::ios::binary | std::ios::trunc);
-        if (!file.is_open())
-            return std::unexpected(Core::ErrorCode::FileWriteError);
+    struct MmapIOBackend::Mapping
+    {
+        Mapping(const std::byte* base, const std::size_t size, const FileIdentity identity) noexcept
+            : Base(base), Size(size), Identity(identity)
+        {
+        }
 
-        if (!data.empty())
+        ~Mapping()
         {
-            file.write(reinterpret_cast<const char*>(data.data()),
-                       static_cast<std::streamsize>(data.size()));
-            if (!file)
-                return std::unexpected(Core::ErrorCode::FileWriteError);
+            if (Base != nullptr)
+                ::munmap(const_cast<std::byte*>(Base), Size);
         }
+
+        Mapping(const Mapping&) = delete;
+        Mapping& operator=(const Mapping&) = delete;
+
+        const std::byte* Base = nullptr;
+        std::size_t Size = 0;
+        FileIdentity Identity{};
+    };
+
+    Core::Expected<IOReadResult> MmapIOBackend::Read(const IORequest& request)
+    {
+        if (request.Path.empty())
+            return std::unexpected(Core::ErrorCode::InvalidPath);
+
+        struct stat info{};
+        if (::stat(request.Path.c_str(), &info) != 0)
+        {
+            return std::unexpected(errno == ENOENT || errno == ENOTDIR
+                                       ? Core::ErrorCode::FileNotFound
+                                       : Core::ErrorCode::FileReadError);
+        }
+        if (!S_ISREG(info.st_mode))
+            return std::unexpected(Core::ErrorCode::FileReadError);
+
+        std::shared_ptr<const Mapping> mapping;
+        {
+            std::lock_guard lock(m_Mutex);
+            const auto it = m_Mappings.find(request.Path);
+            if (it != m_Mappings.end())
+            {
+                mapping = it->second.lock();
+                if (mapping && mapping->Identity != IdentityOf(info))
+                    mapping.reset();
+            }
+        }
+
+        if (!mapping)
+        {
+            const int fd = ::open(request.Path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                return std::unexpected(Core::ErrorCode::FileReadError);
+            if (::fstat(fd, &info) != 0)
+            {
+                ::close(fd);
+                return std::unexpected(Core::ErrorCode::FileReadError);
+            }
+
+            const auto fileSize = static_cast<std::size_t>(info.st_size);
+            const std::byte* base = nullptr;
+            if (fileSize != 0)
+            {
+                void* mapped = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapped == MAP_FAILED)
+                {
+                    ::close(fd);
+                    return std::unexpected(Core::ErrorCode::FileReadError);
+                }
+                base = static_cast<const std::byte*>(mapped);
+            }
+            // The mapping keeps the file referenced after the descriptor closes.
+            ::close(fd);
+            mapping = std::make_shared<Mapping>(base, fileSize, IdentityOf(info));
+
+            std::lock_guard lock(m_Mutex);
+            std::erase_if(m_Mappings, [](const auto& entry) { return entry.second.expired(); });
+            m_Mappings[request.Path] = mapping;
+        }
+
+        std::size_t readSize = 0;
+        if (!ResolveRange(request, mapping->Size, readSize))
+            return std::unexpected(Core::ErrorCode::OutOfRange);
+
+        if (readSize != 0)
+        {
+            const auto pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            const std::size_t begin = request.Offset / pageSize * pageSize;
+            const int advice = request.Priority <= PrefetchPriority ? MADV_WILLNEED : MADV_SEQUENTIAL;
+            // Advisory only; a rejected hint does not fail the read.
+            (void)::madvise(const_cast<std::byte*>(mapping->Base) + begin,
+                            request.Offset + readSize - begin,
+                            advice);
+        }
+
+        IOReadResult result;
+        result.View = std::span<const std::byte>(mapping->Base + request.Offset, readSize);
+        result.Owner = std::move(mapping);
+        return result;
+    }
+
+    Core::Result MmapIOBackend::Write(const IORequest& request,
+                                      std::span<const std::byte> data)
+    {
+        if (request.Path.empty())
+            return std::unexpected(Core::ErrorCode::InvalidPath);
+
+        const std::string staging = request.Path + ".partial";
+        if (const Core::Result written = WriteWholeFile(staging, data); !written.has_value())
+            return written;
+
+        std::error_code ec;
+        std::filesystem::rename(staging, request.Path, ec);
+        if (ec)
+        {
+            std::filesystem::remove(staging, ec);
+            return std::unexpected(Core::ErrorCode::FileWriteError);
+        }
+
+        std::lock_guard lock(m_Mutex);
+        m_Mappings.erase(request.Path);
         return Core::Ok();
     }
+
+    std::size_t MmapIOBackend::LiveMappingCount() const
+    {
+        std::lock_guard lock(m_Mutex);
+        std::size_t live = 0;
+        for (const auto& [path, mapping] : m_Mappings)
+            live += mapping.expired() ? 0u : 1u;
+        return live;
+    }
 }
 
@@ -0,0 +1,54 @@
+module;
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+module Extrinsic.Core.Parallel;
+
+import Extrinsic.Core.Tasks;
+import Extrinsic.Core.Tasks.CounterEvent;
+
+namespace Extrinsic::Core::Parallel::Detail
+{
+    namespace
+    {
+        // AutoGrain aims for this many chunks per hardware thread so stealing
+        // can even out uneven chunk costs without drowning in task overhead.
+        constexpr std::size_t kAutoChunksPerThread = 4u;
+    }
+
+    std::size_t ResolveGrain(const std::size_t count, const std::size_t grain) noexcept
+    {
+        std::size_t resolved = grain;
+        if (resolved == AutoGrain)
+        {
+            const std::size_t threads = std::max(1u, std::thread::hardware_concurrency());
+            const std::size_t targetChunks = threads * kAutoChunksPerThread;
+            resolved = (count + targetChunks - 1u) / targetChunks;
+        }
+
+        constexpr std::size_t maxChunks = std::numeric_limits<std::uint32_t>::max();
+        const std::size_t minGrain = count / maxChunks + 1u;
+        return std::max(resolved, minGrain);
+    }
+
+    void HelpUntilReady(Tasks::CounterEvent& done)
+    {
+        // Observe progress before checking for work so a completion between
+        // the check and the wait cannot be missed.
+        while (!done.IsReady())
+        {
+            const auto progress = Tasks::Scheduler::ObserveWorkProgress();
+            const std::uint32_t pending = done.PendingCount();
+            if (pending == 0u)
+                break;
+            if (Tasks::Scheduler::TryRunOne())
+                continue;
+            if (!Tasks::Scheduler::WaitForWorkProgress(progress))
+                done.WaitForProgress(pending);
+        }
+    }
+}
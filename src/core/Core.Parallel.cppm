@@ -0,0 +1,324 @@
+module;
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+export module Extrinsic.Core.Parallel;
+
+import Extrinsic.Core.Tasks;
+import Extrinsic.Core.Tasks.CounterEvent;
+
+// Data-parallel loops on top of Tasks::Scheduler.
+//
+// A range is cut into fixed chunks of `grain` indices (AutoGrain picks about
+// four chunks per hardware thread). Chunks are handed out by recursive
+// halving: each task dispatches the upper half of its chunk span and keeps
+// the lower half, so idle workers steal large spans first and the split depth
+// adapts to how much stealing actually happens. The calling thread runs the
+// first span itself and then help-runs scheduler work through TryRunOne until
+// every chunk has signalled; it never blocks while runnable work exists.
+//
+// Without an initialized scheduler, or with a single chunk, every primitive
+// runs the same chunks inline in ascending order. Chunking depends only on the
+// range size and the resolved grain, so reductions and scans combine partials
+// in the same order in both paths and produce identical results for a given
+// grain.
+namespace Extrinsic::Core::Parallel
+{
+    export inline constexpr std::size_t AutoGrain = 0u;
+
+    export struct IndexRange
+    {
+        std::size_t Begin{0};
+        std::size_t End{0};
+
+        [[nodiscard]] constexpr std::size_t Size() const noexcept
+        {
+            return End > Begin ? End - Begin : 0u;
+        }
+
+        [[nodiscard]] constexpr bool Empty() const noexcept { return End <= Begin; }
+    };
+
+    export enum class ScanKind : std::uint8_t
+    {
+        Inclusive,
+        Exclusive,
+    };
+
+    namespace Detail
+    {
+        // Resolves AutoGrain and clamps so the chunk count fits a CounterEvent.
+        [[nodiscard]] std::size_t ResolveGrain(std::size_t count, std::size_t grain) noexcept;
+
+        // Help-runs scheduler tasks until `done` reaches zero, parking only
+        // when no task is runnable.
+        void HelpUntilReady(Tasks::CounterEvent& done);
+
+        [[nodiscard]] constexpr std::size_t ChunkCount(const std::size_t count,
+                                                       const std::size_t grain) noexcept
+        {
+            return (count + grain - 1u) / grain;
+        }
+
+        [[nodiscard]] constexpr IndexRange ChunkRange(const IndexRange range,
+                                                      const std::size_t grain,
+                                                      const std::size_t chunk) noexcept
+        {
+            const std::size_t begin = range.Begin + chunk * grain;
+            return IndexRange{begin, std::min(range.End, begin + grain)};
+        }
+
+        template <typename ChunkFn>
+        struct ChunkJob
+        {
+            const ChunkFn* Body = nullptr;
+            Tasks::CounterEvent* Done = nullptr;
+        };
+
+        template <typename ChunkFn>
+        void RunChunkSpan(const ChunkJob<ChunkFn>* job, const std::size_t first, std::size_t last)
+        {
+            while (last - first > 1u)
+            {
+                const std::size_t mid = first + (last - first) / 2u;
+                Tasks::Scheduler::Dispatch([job, mid, last]()
+                {
+                    RunChunkSpan(job, mid, last);
+                });
+                last = mid;
+            }
+
+            (*job->Body)(first);
+            job->Done->Signal();
+        }
+
+        // Invokes body(chunk) exactly once for every chunk in [0, chunkCount).
+        template <typename ChunkFn>
+        void ForEachChunk(const std::size_t chunkCount, const ChunkFn& body)
+        {
+            if (chunkCount == 0u)
+                return;
+
+            if (chunkCount == 1u || !Tasks::Scheduler::IsInitialized())
+            {
+                for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+                    body(chunk);
+                return;
+            }
+
+            Tasks::CounterEvent done{static_cast<std::uint32_t>(chunkCount)};
+            const ChunkJob<ChunkFn> job{&body, &done};
+            RunChunkSpan(&job, 0u, chunkCount);
+            HelpUntilReady(done);
+        }
+
+        template <typename Fn>
+        void InvokeOnRange(Fn& fn, const IndexRange range)
+        {
+            if constexpr (std::is_invocable_v<Fn&, IndexRange>)
+            {
+                fn(range);
+            }
+            else
+            {
+                for (std::size_t i = range.Begin; i < range.End; ++i)
+                    fn(i);
+            }
+        }
+    }
+
+    // fn is called either once per chunk as fn(IndexRange) or once per index
+    // as fn(std::size_t), whichever it accepts. Chunks may run concurrently.
+    export template <typename Fn>
+    void ParallelFor(const IndexRange range, const std::size_t grain, Fn&& fn)
+    {
+        const std::size_t count = range.Size();
+        if (count == 0u)
+            return;
+
+        const std::size_t chunkGrain = Detail::ResolveGrain(count, grain);
+        Detail::ForEachChunk(Detail::ChunkCount(count, chunkGrain), [&](const std::size_t chunk)
+        {
+            Detail::InvokeOnRange(fn, Detail::ChunkRange(range, chunkGrain, chunk));
+        });
+    }
+
+    // reduceChunk(IndexRange, T accumulator) -> T folds one chunk starting
+    // from `identity`; combine(T, T) -> T then folds the chunk partials left
+    // to right in chunk order. combine must be associative.
+    export template <typename T, typename ReduceChunkFn, typename CombineFn>
+    [[nodiscard]] T ParallelReduce(const IndexRange range,
+                                   const std::size_t grain,
+                                   const T& identity,
+                                   ReduceChunkFn&& reduceChunk,
+                                   CombineFn&& combine)
+    {
+        const std::size_t count = range.Size();
+        if (count == 0u)
+            return identity;
+
+        const std::size_t chunkGrain = Detail::ResolveGrain(count, grain);
+        const std::size_t chunkCount = Detail::ChunkCount(count, chunkGrain);
+        std::vector<T> partials(chunkCount, identity);
+        Detail::ForEachChunk(chunkCount, [&](const std::size_t chunk)
+        {
+            partials[chunk] = reduceChunk(Detail::ChunkRange(range, chunkGrain, chunk), identity);
+        });
+
+        T result = std::move(partials[0]);
+        for (std::size_t chunk = 1; chunk < chunkCount; ++chunk)
+            result = combine(std::move(result), std::move(partials[chunk]));
+        return result;
+    }
+
+    // Prefix scan of `input` into `output` (same size; may alias exactly).
+    // Three phases: parallel per-chunk totals, a serial scan of those totals,
+    // then a parallel per-chunk rescan seeded with each chunk's offset. op must
+    // be associative; `identity` seeds the first chunk.
+    export template <typename T, typename Op>
+    void ParallelScan(const std::span<const T> input,
+                      const std::span<T> output,
+                      const std::type_identity_t<T>& identity,
+                      Op&& op,
+                      const ScanKind kind = ScanKind::Inclusive,
+                      const std::size_t grain = AutoGrain)
+    {
+        const std::size_t count = std::min(input.size(), output.size());
+        if (count == 0u)
+            return;
+
+        const IndexRange range{0u, count};
+        const std::size_t chunkGrain = Detail::ResolveGrain(count, grain);
+        const std::size_t chunkCount = Detail::ChunkCount(count, chunkGrain);
+
+        std::vector<T> offsets(chunkCount, identity);
+        if (chunkCount > 1u)
+        {
+            Detail::ForEachChunk(chunkCount - 1u, [&](const std::size_t chunk)
+            {
+                const IndexRange sub = Detail::ChunkRange(range, chunkGrain, chunk);
+                T total = input[sub.Begin];
+                for (std::size_t i = sub.Begin + 1u; i < sub.End; ++i)
+                    total = op(total, input[i]);
+                offsets[chunk + 1u] = std::move(total);
+            });
+
+            for (std::size_t chunk = 1; chunk < chunkCount; ++chunk)
+                offsets[chunk] = op(offsets[chunk - 1u], offsets[chunk]);
+        }
+
+        Detail::ForEachChunk(chunkCount, [&](const std::size_t chunk)
+        {
+            const IndexRange sub = Detail::ChunkRange(range, chunkGrain, chunk);
+            T running = offsets[chunk];
+            for (std::size_t i = sub.Begin; i < sub.End; ++i)
+            {
+                // Read before writing so output may alias input.
+                T value = input[i];
+                if (kind == ScanKind::Exclusive)
+                {
+                    output[i] = running;
+                    running = op(running, value);
+                }
+                else
+                {
+                    running = op(running, value);
+                    output[i] = running;
+                }
+            }
+        });
+    }
+
+    // Stable sort: chunks are stable-sorted in parallel, then adjacent runs
+    // are merged pass by pass. Each merge is cut into grain-sized pieces by
+    // binary search so late passes with few long runs stay parallel. T must
+    // be move-constructible and move-assignable.
+    export template <typename T, typename Compare = std::less<>>
+    void ParallelStableSort(const std::span<T> data,
+                            Compare comp = Compare{},
+                            const std::size_t grain = AutoGrain)
+    {
+        const std::size_t count = data.size();
+        if (count < 2u)
+            return;
+
+        const IndexRange range{0u, count};
+        const std::size_t chunkGrain = std::max<std::size_t>(Detail::ResolveGrain(count, grain), 2u);
+        const std::size_t chunkCount = Detail::ChunkCount(count, chunkGrain);
+        Detail::ForEachChunk(chunkCount, [&](const std::size_t chunk)
+        {
+            const IndexRange sub = Detail::ChunkRange(range, chunkGrain, chunk);
+            std::stable_sort(data.begin() + sub.Begin, data.begin() + sub.End, comp);
+        });
+        if (chunkCount == 1u)
+            return;
+
+        struct MergePiece
+        {
+            std::size_t LeftBegin;
+            std::size_t LeftEnd;
+            std::size_t RightBegin;
+            std::size_t RightEnd;
+            std::size_t Out;
+        };
+
+        std::vector<T> buffer(std::make_move_iterator(data.begin()), std::make_move_iterator(data.end()));
+        std::span<T> source = data;
+        std::span<T> target{buffer};
+        std::vector<MergePiece> pieces;
+        for (std::size_t width = chunkGrain; width < count; width *= 2u)
+        {
+            pieces.clear();
+            for (std::size_t left = 0; left < count; left += 2u * width)
+            {
+                const std::size_t mid = std::min(count, left + width);
+                const std::size_t right = std::min(count, left + 2u * width);
+                // A piece boundary at left index a pairs with the first right
+                // element not less than source[a]: everything before it
+                // precedes source[a] in a stable merge, everything after it
+                // follows.
+                std::size_t leftCursor = left;
+                std::size_t rightCursor = mid;
+                for (std::size_t split = left + chunkGrain; split < mid; split += chunkGrain)
+                {
+                    const std::size_t rightSplit = static_cast<std::size_t>(
+                        std::lower_bound(source.begin() + rightCursor, source.begin() + right,
+                                         source[split], comp) - source.begin());
+                    pieces.push_back({leftCursor, split, rightCursor, rightSplit,
+                                      leftCursor + (rightCursor - mid)});
+                    leftCursor = split;
+                    rightCursor = rightSplit;
+                }
+                pieces.push_back({leftCursor, mid, rightCursor, right, leftCursor + (rightCursor - mid)});
+            }
+
+            Detail::ForEachChunk(pieces.size(), [&](const std::size_t p)
+            {
+                const MergePiece& piece = pieces[p];
+                std::merge(std::make_move_iterator(source.begin() + piece.LeftBegin),
+                           std::make_move_iterator(source.begin() + piece.LeftEnd),
+                           std::make_move_iterator(source.begin() + piece.RightBegin),
+                           std::make_move_iterator(source.begin() + piece.RightEnd),
+                           target.begin() + piece.Out,
+                           comp);
+            });
+            std::swap(source, target);
+        }
+
+        if (source.data() != data.data())
+        {
+            ParallelFor(range, chunkGrain, [&](const IndexRange sub)
+            {
+                std::move(source.begin() + sub.Begin, source.begin() + sub.End, data.begin() + sub.Begin);
+            });
+        }
+    }
+}
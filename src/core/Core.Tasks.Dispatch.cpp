@@ -9,6 +9,7 @@ module;
 module Extrinsic.Core.Tasks;
 
 import :Internal;
+import Extrinsic.Core.WorkStealingDeque;
 
 namespace Extrinsic::Core::Tasks
 {
@@ -25,6 +26,28 @@ namespace Extrinsic::Core::Tasks
                 ? lane
                 : static_cast<std::uint8_t>(DispatchPriority::Normal);
         }
+
+        [[nodiscard]] StealResult StealFromVictim(
+            Detail::SchedulerContext::WorkerState& victim,
+            LocalTask& outTask,
+            const std::uint8_t lane)
+        {
+            Detail::TaskNode* node = nullptr;
+            const StealResult result = victim.localDeques[lane].Steal(node);
+            if (result == StealResult::Abort)
+            {
+                s_Ctx->queueContentionCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            else if (result == StealResult::Success)
+            {
+                outTask = std::move(node->Task);
+                victim.nodePool.ReleaseRemote(node);
+                victim.stealCount.fetch_add(1, std::memory_order_relaxed);
+                s_Ctx->stealPopCount.fetch_add(1, std::memory_order_relaxed);
+                s_Ctx->successfulStealAttempts.fetch_add(1, std::memory_order_relaxed);
+            }
+            return result;
+        }
     }
 
     void Scheduler::Dispatch(Job&& job)
@@ -84,8 +107,9 @@ namespace Extrinsic::Core::Tasks
         if (s_WorkerIndex >= 0)
         {
             auto& worker = s_Ctx->workerStates[static_cast<unsigned>(s_WorkerIndex)];
-            std::lock_guard lock(worker.localLock);
-            worker.localDeques[lane].push_back(std::move(task));
+            Detail::TaskNode* node = worker.nodePool.Acquire();
+            node->Task = std::move(task);
+            worker.localDeques[lane].Push(node);
         }
         else
         {
@@ -215,13 +239,12 @@ namespace Extrinsic::Core::Tasks
                      const std::uint8_t lane)
     {
         auto& worker = s_Ctx->workerStates[workerIndex];
-        std::lock_guard lock(worker.localLock);
-        auto& localDeque = worker.localDeques[lane];
-        if (localDeque.empty())
+        Detail::TaskNode* node = nullptr;
+        if (!worker.localDeques[lane].Pop(node))
             return false;
 
-        outTask = std::move(localDeque.back());
-        localDeque.pop_back();
+        outTask = std::move(node->Task);
+        worker.nodePool.Release(node);
         s_Ctx->localPopCount.fetch_add(1, std::memory_order_relaxed);
         return true;
     }
@@ -238,28 +261,13 @@ namespace Extrinsic::Core::Tasks
         {
             s_Ctx->totalStealAttempts.fetch_add(1, std::memory_order_relaxed);
             const unsigned victimIndex = (thiefIndex + offset) % workerCount;
-            auto& victim = s_Ctx->workerStates[victimIndex];
-            if (!victim.localLock.try_lock())
-            {
-                s_Ctx->queueContentionCount.fetch_add(1, std::memory_order_relaxed);
-                continue;
-            }
-
-            bool stole = false;
-            auto& localDeque = victim.localDeques[lane];
-            if (!localDeque.empty())
+            // A lost top race moves on to the next victim; the winner is
+            // already running that task.
+            if (StealFromVictim(s_Ctx->workerStates[victimIndex], outTask, lane) ==
+                StealResult::Success)
             {
-                outTask = std::move(localDeque.front());
-                localDeque.pop_front();
-                victim.stealCount.fetch_add(1, std::memory_order_relaxed);
-                s_Ctx->stealPopCount.fetch_add(1, std::memory_order_relaxed);
-                s_Ctx->successfulStealAttempts.fetch_add(1, std::memory_order_relaxed);
-                stole = true;
-            }
-            victim.localLock.unlock();
-
-            if (stole)
                 return true;
+            }
         }
 
         return false;
@@ -272,29 +280,17 @@ namespace Extrinsic::Core::Tasks
         {
             s_Ctx->totalStealAttempts.fetch_add(1, std::memory_order_relaxed);
             auto& victim = s_Ctx->workerStates[victimIndex];
-            if (!victim.localLock.try_lock())
+            // External helpers park after this scan. Retry a lost top race
+            // until the victim deque reports empty so contention cannot
+            // masquerade as emptiness and strand already-published work.
+            StealResult result = StealFromVictim(victim, outTask, lane);
+            while (result == StealResult::Abort)
             {
-                s_Ctx->queueContentionCount.fetch_add(1, std::memory_order_relaxed);
-                // External helpers park after this scan. Wait for the short
-                // queue critical section so contention cannot masquerade as
-                // an empty victim deque and strand already-published work.
-                victim.localLock.lock();
-            }
-
-            bool stole = false;
-            auto& localDeque = victim.localDeques[lane];
-            if (!localDeque.empty())
-            {
-                outTask = std::move(localDeque.front());
-                localDeque.pop_front();
-                victim.stealCount.fetch_add(1, std::memory_order_relaxed);
-                s_Ctx->stealPopCount.fetch_add(1, std::memory_order_relaxed);
-                s_Ctx->successfulStealAttempts.fetch_add(1, std::memory_order_relaxed);
-                stole = true;
+                Detail::CpuRelaxOrYield();
+                result = StealFromVictim(victim, outTask, lane);
             }
-            victim.localLock.unlock();
 
-            if (stole)
+            if (result == StealResult::Success)
                 return true;
         }
 
@@ -325,7 +321,7 @@ namespace Extrinsic::Core::Tasks
             : std::nullopt;
         // Explicit help may be followed by a progress wait, including when
         // the helper is itself a worker. Ignore advisory lane counts and wait
-        // through short deque critical sections so empty means definitive.
+        // through lost steal races so empty means definitive.
         if (!TryPopDefinitiveTask(task, workerIndex, lane))
             return false;
 
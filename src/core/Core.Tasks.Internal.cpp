@@ -6,6 +6,7 @@ module;
 #include <thread>
 #include <cmath>
 #include <algorithm>
+#include <memory>
 
 module Extrinsic.Core.Tasks:Internal.Impl;
 import :Internal;
@@ -17,43 +18,6 @@ namespace Extrinsic::Core::Tasks
 
     namespace Detail
     {
-        bool SpinLock::try_lock()
-        {
-            return !locked.exchange(true, std::memory_order_acquire);
-        }
-
-        void SpinLock::lock()
-        {
-            while (true)
-            {
-                if (!locked.exchange(true, std::memory_order_acquire))
-                    return;
-
-                constexpr int kSpinIters = 64;
-                int spins = 0;
-                while (locked.load(std::memory_order_relaxed))
-                {
-                    if (spins++ < kSpinIters)
-                    {
-                        Detail::CpuRelaxOrYield();
-                        continue;
-                    }
-
-                    locked.wait(true, std::memory_order_relaxed);
-                    spins = 0;
-                }
-            }
-        }
-
-        void SpinLock::unlock()
-        {
-            locked.store(false, std::memory_order_release);
-            // The slow path in lock() parks with atomic::wait after its
-            // bounded spin phase, so this notification is load-bearing. It is
-            // separate from scheduler work notifications.
-            locked.notify_one();
-        }
-
         void CpuRelaxOrYield() noexcept
         {
             if (!CpuRelaxOnce())
@@ -73,22 +37,44 @@ namespace Extrinsic::Core::Tasks
 #endif
         }
 
-        SchedulerContext::WorkerState::WorkerState(WorkerState&& other) noexcept
-            : localDeques(std::move(other.localDeques))
-              , stealCount(other.stealCount.load(std::memory_order_relaxed))
+        TaskNode* TaskNodePool::Acquire()
+        {
+            if (!m_LocalFree)
+            {
+                m_LocalFree = m_RemoteFree.exchange(nullptr, std::memory_order_acquire);
+                if (!m_LocalFree)
+                {
+                    auto block = std::make_unique<TaskNode[]>(BlockSize);
+                    for (std::size_t i = 0; i + 1 < BlockSize; ++i)
+                        block[i].Next = &block[i + 1];
+                    m_LocalFree = &block[0];
+                    m_Blocks.push_back(std::move(block));
+                }
+            }
+
+            TaskNode* node = m_LocalFree;
+            m_LocalFree = node->Next;
+            node->Next = nullptr;
+            return node;
+        }
+
+        void TaskNodePool::Release(TaskNode* node) noexcept
         {
-            other.stealCount.store(0, std::memory_order_relaxed);
+            node->Next = m_LocalFree;
+            m_LocalFree = node;
         }
 
-        SchedulerContext::WorkerState& SchedulerContext::WorkerState::operator=(WorkerState&& other) noexcept
+        void TaskNodePool::ReleaseRemote(TaskNode* node) noexcept
         {
-            if (this != &other)
+            // Release publishes the thief's move out of node->Task before the
+            // owner's acquire exchange hands the node to a new dispatch.
+            TaskNode* head = m_RemoteFree.load(std::memory_order_relaxed);
+            do
             {
-                localDeques = std::move(other.localDeques);
-                stealCount.store(other.stealCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
-                other.stealCount.store(0, std::memory_order_relaxed);
+                node->Next = head;
             }
-            return *this;
+            while (!m_RemoteFree.compare_exchange_weak(
+                head, node, std::memory_order_release, std::memory_order_relaxed));
         }
 
         uint64_t EstimateLatencyPercentile(
@@ -18,6 +18,7 @@ export module Extrinsic.Core.Tasks:Internal;
 
 import :LocalTask;
 import Extrinsic.Core.LockFreeQueue;
+import Extrinsic.Core.WorkStealingDeque;
 
 export namespace Extrinsic::Core::Tasks
 {
@@ -32,13 +33,37 @@ export namespace Extrinsic::Core::Tasks
         [[nodiscard]] bool CpuRelaxOnce() noexcept;
         void CpuRelaxOrYield() noexcept;
 
-        struct SpinLock
+        inline constexpr std::size_t LocalDequeInitialCapacity = 256u;
+
+        // Worker-deque entries. The Chase-Lev deque only moves pointers, so
+        // the 128-byte LocalTask lives in a node owned by the pushing
+        // worker's pool.
+        struct TaskNode
+        {
+            LocalTask Task{};
+            TaskNode* Next = nullptr;
+        };
+
+        // Only the owning worker acquires nodes and releases its own pops.
+        // Thieves hand stolen nodes back through a lock-free push-only list
+        // that the owner drains wholesale, so neither side can observe ABA.
+        class TaskNodePool
         {
-            std::atomic<bool> locked = false;
+        public:
+            TaskNodePool() = default;
+            TaskNodePool(const TaskNodePool&) = delete;
+            TaskNodePool& operator=(const TaskNodePool&) = delete;
+
+            [[nodiscard]] TaskNode* Acquire();
+            void Release(TaskNode* node) noexcept;
+            void ReleaseRemote(TaskNode* node) noexcept;
+
+        private:
+            static constexpr std::size_t BlockSize = 256u;
 
-            [[nodiscard]] bool try_lock();
-            void lock();
-            void unlock();
+            TaskNode* m_LocalFree = nullptr;
+            alignas(64) std::atomic<TaskNode*> m_RemoteFree{nullptr};
+            std::vector<std::unique_ptr<TaskNode[]>> m_Blocks{};
         };
 
         struct alignas(64) SchedulerContext
@@ -46,15 +71,17 @@ export namespace Extrinsic::Core::Tasks
             std::uint64_t instanceId = 0;
             struct alignas(64) WorkerState
             {
-                SpinLock localLock{};
-                std::array<std::deque<LocalTask>, PriorityLaneCount> localDeques{};
+                std::array<WorkStealingDeque<TaskNode*>, PriorityLaneCount> localDeques{
+                    WorkStealingDeque<TaskNode*>{LocalDequeInitialCapacity},
+                    WorkStealingDeque<TaskNode*>{LocalDequeInitialCapacity},
+                    WorkStealingDeque<TaskNode*>{LocalDequeInitialCapacity},
+                };
+                TaskNodePool nodePool{};
                 std::atomic<uint64_t> stealCount{0};
 
                 WorkerState() = default;
                 WorkerState(const WorkerState&) = delete;
                 WorkerState& operator=(const WorkerState&) = delete;
-                WorkerState(WorkerState&& other) noexcept;
-                WorkerState& operator=(WorkerState&& other) noexcept;
             };
 
             struct InjectLane
@@ -71,6 +98,8 @@ export namespace Extrinsic::Core::Tasks
             };
 
             std::vector<std::thread> workers;
+            // Sized once in Initialize(); WorkerState is immovable because
+            // thieves hold references to its deques.
             std::vector<WorkerState> workerStates;
             // Preserve the common Normal lane's previous capacity while
             // bounding the two preference lanes at 8K slots each. This is a
@@ -29,7 +29,8 @@ namespace Extrinsic::Core::Tasks
 
         threadCount = std::max(threadCount, 1u);
 
-        s_Ctx->workerStates.resize(threadCount);
+        // WorkerState is immovable, so build the vector at its final size.
+        s_Ctx->workerStates = std::vector<Detail::SchedulerContext::WorkerState>(threadCount);
 
         for (unsigned i = 0; i < threadCount; ++i)
             s_Ctx->workers.emplace_back([i] { WorkerEntry(i); });
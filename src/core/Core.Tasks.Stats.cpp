@@ -72,10 +72,11 @@ namespace Extrinsic::Core::Tasks
         stats.WorkerVictimStealCounts.reserve(s_Ctx->workerStates.size());
         for (auto& worker : s_Ctx->workerStates)
         {
-            std::lock_guard lock(worker.localLock);
+            // Racy bottom-minus-top snapshot per lane, like the other
+            // relaxed counters in this report.
             std::uint32_t localDepth = 0u;
             for (const auto& lane : worker.localDeques)
-                localDepth += static_cast<std::uint32_t>(lane.size());
+                localDepth += static_cast<std::uint32_t>(lane.SizeApprox());
             stats.WorkerLocalDepths.push_back(localDepth);
             stats.WorkerVictimStealCounts.push_back(worker.stealCount.load(std::memory_order_relaxed));
         }
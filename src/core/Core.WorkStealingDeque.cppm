@@ -0,0 +1,195 @@
+module;
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+export module Extrinsic.Core.WorkStealingDeque;
+
+namespace Extrinsic::Core
+{
+    export enum class StealResult : std::uint8_t
+    {
+        Empty,   // No item was visible at the top of the deque.
+        Abort,   // Lost the top race to the owner or another thief; retry.
+        Success,
+    };
+
+    // Chase-Lev work-stealing deque with the C++11 memory orders of
+    // Le, Pop, Cohen and Zappa Nardelli (PPoPP 2013).
+    //
+    // One owner thread calls Push/Pop at the bottom; any thread may Steal from
+    // the top. The ring doubles when full. Retired rings stay alive until the
+    // deque is destroyed because a concurrent thief may still read a slot from
+    // one. Items travel through relaxed atomic slots, so T must be trivially
+    // copyable (a pointer or an index).
+    export template <typename T>
+    class WorkStealingDeque
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "WorkStealingDeque items must be trivially copyable.");
+
+    public:
+        explicit WorkStealingDeque(std::size_t initialCapacity = 256);
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+        WorkStealingDeque(WorkStealingDeque&&) = delete;
+        WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+        // Owner only.
+        void Push(T item);
+
+        // Owner only. Returns false if the deque is empty.
+        [[nodiscard]] bool Pop(T& outItem);
+
+        // Any thread.
+        [[nodiscard]] StealResult Steal(T& outItem);
+
+        // Racy snapshot; exact only while no other thread touches the deque.
+        [[nodiscard]] std::size_t SizeApprox() const noexcept;
+
+        // Owner only.
+        [[nodiscard]] std::size_t Capacity() const noexcept;
+
+    private:
+        struct Ring
+        {
+            explicit Ring(const std::size_t capacity)
+                : Mask(capacity - 1u),
+                  Slots(std::make_unique<std::atomic<T>[]>(capacity))
+            {
+            }
+
+            [[nodiscard]] std::atomic<T>& At(const std::int64_t index) noexcept
+            {
+                return Slots[static_cast<std::size_t>(index) & Mask];
+            }
+
+            std::size_t Mask;
+            std::unique_ptr<std::atomic<T>[]> Slots;
+        };
+
+        [[nodiscard]] Ring* Grow(Ring* ring, std::int64_t top, std::int64_t bottom);
+
+        alignas(64) std::atomic<std::int64_t> m_Top{0};
+        alignas(64) std::atomic<std::int64_t> m_Bottom{0};
+        alignas(64) std::atomic<Ring*> m_Ring{nullptr};
+        // Current ring plus every retired ring; touched only by the owner.
+        std::vector<std::unique_ptr<Ring>> m_Rings;
+    };
+
+    template <typename T>
+    WorkStealingDeque<T>::WorkStealingDeque(std::size_t initialCapacity)
+    {
+        // Capacity must be a power of 2 for bitwise masking
+        if (initialCapacity < 2) initialCapacity = 2;
+
+        std::size_t cap = 1;
+        while (cap < initialCapacity) cap *= 2;
+
+        m_Rings.push_back(std::make_unique<Ring>(cap));
+        m_Ring.store(m_Rings.back().get(), std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    typename WorkStealingDeque<T>::Ring* WorkStealingDeque<T>::Grow(
+        Ring* ring, const std::int64_t top, const std::int64_t bottom)
+    {
+        auto grown = std::make_unique<Ring>((ring->Mask + 1u) * 2u);
+        for (std::int64_t i = top; i < bottom; ++i)
+            grown->At(i).store(ring->At(i).load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        Ring* next = grown.get();
+        m_Rings.push_back(std::move(grown));
+        // Release pairs with the thief's acquire load of m_Ring so the copied
+        // slots are visible before the new ring is.
+        m_Ring.store(next, std::memory_order_release);
+        return next;
+    }
+
+    template <typename T>
+    void WorkStealingDeque<T>::Push(T item)
+    {
+        const std::int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = m_Top.load(std::memory_order_acquire);
+        Ring* ring = m_Ring.load(std::memory_order_relaxed);
+        if (bottom - top > static_cast<std::int64_t>(ring->Mask))
+            ring = Grow(ring, top, bottom);
+
+        ring->At(bottom).store(item, std::memory_order_relaxed);
+        // Release publishes the slot (and whatever the item points at) to the
+        // thief's acquire load of bottom. Equivalent to Le et al.'s release
+        // fence, but visible to ThreadSanitizer.
+        m_Bottom.store(bottom + 1, std::memory_order_release);
+    }
+
+    template <typename T>
+    bool WorkStealingDeque<T>::Pop(T& outItem)
+    {
+        const std::int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        Ring* ring = m_Ring.load(std::memory_order_relaxed);
+        // Every bottom store is a release so a thief that acquires any bottom
+        // value also sees the payloads of earlier pushes; relaxed stores would
+        // end the release sequence.
+        m_Bottom.store(bottom, std::memory_order_release);
+        // The seq_cst fence orders the bottom reservation against the top
+        // read, pairing with the fence in Steal.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = m_Top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_Bottom.store(bottom + 1, std::memory_order_release);
+            return false;
+        }
+
+        outItem = ring->At(bottom).load(std::memory_order_relaxed);
+        if (top != bottom)
+            return true;
+
+        // Last item: race thieves for it through top.
+        const bool won = m_Top.compare_exchange_strong(
+            top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        m_Bottom.store(bottom + 1, std::memory_order_release);
+        return won;
+    }
+
+    template <typename T>
+    StealResult WorkStealingDeque<T>::Steal(T& outItem)
+    {
+        std::int64_t top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+        if (top >= bottom)
+            return StealResult::Empty;
+
+        Ring* ring = m_Ring.load(std::memory_order_acquire);
+        const T item = ring->At(top).load(std::memory_order_relaxed);
+        if (!m_Top.compare_exchange_strong(
+                top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return StealResult::Abort;
+        }
+
+        outItem = item;
+        return StealResult::Success;
+    }
+
+    template <typename T>
+    std::size_t WorkStealingDeque<T>::SizeApprox() const noexcept
+    {
+        const std::int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+        const std::int64_t top = m_Top.load(std::memory_order_acquire);
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0u;
+    }
+
+    template <typename T>
+    std::size_t WorkStealingDeque<T>::Capacity() const noexcept
+    {
+        return m_Ring.load(std::memory_order_relaxed)->Mask + 1u;
+    }
+}
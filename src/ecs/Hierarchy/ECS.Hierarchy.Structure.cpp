@@ -103,6 +103,11 @@ namespace Extrinsic::ECS::Hierarchy::Structure
             return HierarchyQueryStatus::Success;
         }
 
+        struct TopologyVersion
+        {
+            std::uint64_t Value{0};
+        };
+
         [[nodiscard]] HierarchyQueryResult FailedQuery(
             const HierarchyQueryStatus status)
         {
@@ -217,7 +222,7 @@ namespace Extrinsic::ECS::Hierarchy::Structure
                         const EntityHandle child,
                         Component& childComp,
                         const EntityHandle parent,
-                        Component& parentComp) noexcept
+                        Component& parentComp)
     {
         childComp.Parent = parent;
         childComp.NextSibling = parentComp.FirstChild;
@@ -231,9 +236,10 @@ namespace Extrinsic::ECS::Hierarchy::Structure
 
         parentComp.FirstChild = child;
         parentComp.ChildCount++;
+        MarkTopologyChanged(registry);
     }
 
-    void DetachFromParent(entt::registry& registry, Component& childComp) noexcept
+    void DetachFromParent(entt::registry& registry, Component& childComp)
     {
         const EntityHandle parent = childComp.Parent;
         auto* parentComp = registry.valid(parent) ? registry.try_get<Component>(parent) : nullptr;
@@ -269,6 +275,21 @@ namespace Extrinsic::ECS::Hierarchy::Structure
         childComp.Parent = InvalidEntityHandle;
         childComp.NextSibling = InvalidEntityHandle;
         childComp.PrevSibling = InvalidEntityHandle;
+        MarkTopologyChanged(registry);
+    }
+
+    std::uint64_t GetTopologyVersion(const entt::registry& registry) noexcept
+    {
+        const auto* version = registry.ctx().find<TopologyVersion>();
+        return version != nullptr ? version->Value : 0u;
+    }
+
+    void MarkTopologyChanged(entt::registry& registry)
+    {
+        auto* version = registry.ctx().find<TopologyVersion>();
+        if (version == nullptr)
+            version = &registry.ctx().emplace<TopologyVersion>();
+        ++version->Value;
     }
 
     bool ValidateInvariants(const entt::registry& registry, const EntityHandle entity)
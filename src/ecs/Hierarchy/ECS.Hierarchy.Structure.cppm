@@ -65,9 +65,18 @@ export namespace Extrinsic::ECS::Hierarchy::Structure
                         EntityHandle child,
                         Component& childComp,
                         EntityHandle parent,
-                        Component& parentComp) noexcept;
+                        Component& parentComp);
 
-    void DetachFromParent(entt::registry& registry, Component& childComp) noexcept;
+    void DetachFromParent(entt::registry& registry, Component& childComp);
+
+    // Monotonic registry-wide counter of parent/sibling link edits, stored in
+    // the registry context. AttachToParent/DetachFromParent bump it; caches
+    // derived from the link graph (the flat transform traversal order)
+    // compare it against the version they were built at. The first bump on
+    // a registry creates the context entry, so link edits may allocate.
+    [[nodiscard]] std::uint64_t GetTopologyVersion(
+        const entt::registry& registry) noexcept;
+    void MarkTopologyChanged(entt::registry& registry);
 
     [[nodiscard]] bool ValidateInvariants(const entt::registry& registry,
                                           EntityHandle entity);
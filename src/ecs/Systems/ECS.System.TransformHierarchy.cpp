@@ -1,86 +1,357 @@
 module;
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
 #include <entt/entity/registry.hpp>
+#include <entt/signal/sigh.hpp>
 #include <glm/glm.hpp>
 
 module Extrinsic.ECS.System.TransformHierarchy;
 
 import Extrinsic.Core.FrameGraph;
 import Extrinsic.Core.Hash;
+import Extrinsic.Core.Parallel;
 import Extrinsic.ECS.Scene.Handle;
 import Extrinsic.ECS.Component.Hierarchy;
 import Extrinsic.ECS.Component.Transform;
 import Extrinsic.ECS.Component.Transform.WorldMatrix;
+import Extrinsic.ECS.Hierarchy.Structure;
 
 namespace Extrinsic::ECS::Systems::TransformHierarchy
 {
     namespace Components = ::Extrinsic::ECS::Components;
+    namespace Parallel = ::Extrinsic::Core::Parallel;
+    namespace Structure = ::Extrinsic::ECS::Hierarchy::Structure;
 
     namespace
     {
-        void UpdateNode(entt::registry& registry,
-                        const EntityHandle entity,
-                        const glm::mat4& parentMatrix,
-                        const bool parentDirty)
+        // Below one seed per this many nodes the seeds are sorted; above it a
+        // linear mask scan over the flat order is cheaper.
+        constexpr std::size_t kDenseSeedDivisor = 16u;
+        // Dirty nodes per parallel chunk.
+        constexpr std::size_t kMatrixGrain = 2048u;
+
+        // Registry-context cache of the breadth-first traversal order. BFS
+        // keeps every depth level and every sibling group contiguous, so the
+        // dirty set of a level is a short list of index ranges and the
+        // children of a range are again one range.
+        struct FlatHierarchy
+        {
+            std::vector<FlatNode> Nodes{};
+            // Children of node i occupy [ChildBegin[i], ChildBegin[i + 1]).
+            std::vector<std::uint32_t> ChildBegin{};
+            // Depth d occupies [LevelBegin[d], LevelBegin[d + 1]).
+            std::vector<std::uint32_t> LevelBegin{};
+            // Flat index by entt::to_entity(entity); InvalidFlatIndex if absent.
+            std::vector<std::uint32_t> IndexOfEntity{};
+            std::uint64_t BuiltVersion{0};
+            std::uint64_t RebuildCount{0};
+            bool Built{false};
+
+            // Per-update scratch, reused across frames.
+            std::vector<std::uint32_t> Seeds{};
+            std::vector<std::uint8_t> SeedMask{};
+            // Dirty ranges of every visited level, level after level;
+            // level d owns [LevelRangeBegin[d], LevelRangeBegin[d + 1]).
+            std::vector<Parallel::IndexRange> Ranges{};
+            std::vector<std::size_t> LevelRangeBegin{};
+            std::vector<std::size_t> RangeOffsets{};
+        };
+
+        void OnStructuralEdit(entt::registry& registry, const entt::entity)
+        {
+            Structure::MarkTopologyChanged(registry);
+        }
+
+        // Link edits through Hierarchy::Mutation bump the topology version
+        // themselves; these cover raw component edits and the presence of the
+        // components that decide whether a subtree is traversed at all.
+        void ConnectStructuralSignals(entt::registry& registry)
+        {
+            registry.on_construct<Components::Hierarchy::Component>().connect<&OnStructuralEdit>();
+            registry.on_update<Components::Hierarchy::Component>().connect<&OnStructuralEdit>();
+            registry.on_destroy<Components::Hierarchy::Component>().connect<&OnStructuralEdit>();
+            registry.on_construct<Components::Transform::Component>().connect<&OnStructuralEdit>();
+            registry.on_destroy<Components::Transform::Component>().connect<&OnStructuralEdit>();
+            registry.on_construct<Components::Transform::WorldMatrix>().connect<&OnStructuralEdit>();
+            registry.on_destroy<Components::Transform::WorldMatrix>().connect<&OnStructuralEdit>();
+        }
+
+        [[nodiscard]] std::uint32_t FlatIndexOf(const FlatHierarchy& flat, const EntityHandle entity)
+        {
+            const auto id = static_cast<std::size_t>(entt::to_entity(entity));
+            if (id >= flat.IndexOfEntity.size())
+                return InvalidFlatIndex;
+            const std::uint32_t index = flat.IndexOfEntity[id];
+            // The slot may belong to an older version of the same id.
+            if (index == InvalidFlatIndex || flat.Nodes[index].Entity != entity)
+                return InvalidFlatIndex;
+            return index;
+        }
+
+        // Appends entity unless it is already in the order (a corrupt link
+        // graph revisiting a node); returns whether it was appended.
+        bool AppendNode(FlatHierarchy& flat, const EntityHandle entity, const std::uint32_t parent)
         {
-            auto* local = registry.try_get<Components::Transform::Component>(entity);
-            auto* world = registry.try_get<Components::Transform::WorldMatrix>(entity);
-            const auto* hierarchy = registry.try_get<Components::Hierarchy::Component>(entity);
+            const auto id = static_cast<std::size_t>(entt::to_entity(entity));
+            if (id >= flat.IndexOfEntity.size())
+                flat.IndexOfEntity.resize(id + 1u, InvalidFlatIndex);
+            if (flat.IndexOfEntity[id] != InvalidFlatIndex)
+                return false;
+
+            flat.IndexOfEntity[id] = static_cast<std::uint32_t>(flat.Nodes.size());
+            flat.Nodes.push_back(FlatNode{entity, parent});
+            return true;
+        }
 
-            if (local == nullptr || world == nullptr)
+        // Same visiting rules as a recursive walk from the roots: a node
+        // without Transform or WorldMatrix is skipped together with its
+        // subtree, and a sibling chain stops at a link without a Hierarchy.
+        void Rebuild(entt::registry& registry, FlatHierarchy& flat)
+        {
+            const auto& hierarchies = registry.storage<Components::Hierarchy::Component>();
+            const auto& locals = registry.storage<Components::Transform::Component>();
+            const auto& worlds = registry.storage<Components::Transform::WorldMatrix>();
+            const auto traversable = [&](const EntityHandle entity)
             {
-                return;
+                return locals.contains(entity) && worlds.contains(entity);
+            };
+
+            flat.Nodes.clear();
+            flat.ChildBegin.clear();
+            flat.LevelBegin.clear();
+            std::fill(flat.IndexOfEntity.begin(), flat.IndexOfEntity.end(), InvalidFlatIndex);
+
+            for (auto [entity, hierarchy] : registry.view<Components::Hierarchy::Component>().each())
+            {
+                if (hierarchy.Parent == InvalidEntityHandle && traversable(entity))
+                    AppendNode(flat, entity, InvalidFlatIndex);
             }
 
-            const bool localDirty = registry.all_of<Components::Transform::IsDirtyTag>(entity);
-            const bool isDirty = localDirty || parentDirty;
+            flat.LevelBegin.push_back(0u);
+            std::size_t levelEnd = flat.Nodes.size();
+            for (std::size_t i = 0; i < flat.Nodes.size(); ++i)
+            {
+                if (i == levelEnd)
+                {
+                    flat.LevelBegin.push_back(static_cast<std::uint32_t>(i));
+                    levelEnd = flat.Nodes.size();
+                }
+                flat.ChildBegin.push_back(static_cast<std::uint32_t>(flat.Nodes.size()));
+
+                EntityHandle child = hierarchies.get(flat.Nodes[i].Entity).FirstChild;
+                // Bounds a corrupt sibling cycle among skipped children.
+                std::size_t budget = hierarchies.size();
+                while (child != InvalidEntityHandle && hierarchies.contains(child) && budget-- > 0u)
+                {
+                    const EntityHandle next = hierarchies.get(child).NextSibling;
+                    if (traversable(child))
+                        AppendNode(flat, child, static_cast<std::uint32_t>(i));
+                    child = next;
+                }
+            }
+            flat.ChildBegin.push_back(static_cast<std::uint32_t>(flat.Nodes.size()));
+            flat.LevelBegin.push_back(static_cast<std::uint32_t>(flat.Nodes.size()));
 
-            if (isDirty)
+            flat.BuiltVersion = Structure::GetTopologyVersion(registry);
+            flat.Built = true;
+            ++flat.RebuildCount;
+        }
+
+        [[nodiscard]] FlatHierarchy& AcquireFlatHierarchy(entt::registry& registry)
+        {
+            auto* flat = registry.ctx().find<FlatHierarchy>();
+            if (flat == nullptr)
             {
-                world->Matrix = parentMatrix * Components::Transform::GetMatrix(*local);
-                registry.emplace_or_replace<Components::Transform::WorldUpdatedTag>(entity);
-                registry.remove<Components::Transform::IsDirtyTag>(entity);
+                flat = &registry.ctx().emplace<FlatHierarchy>();
+                ConnectStructuralSignals(registry);
             }
+            if (!flat->Built || flat->BuiltVersion != Structure::GetTopologyVersion(registry))
+                Rebuild(registry, *flat);
+            return *flat;
+        }
 
-            if (hierarchy == nullptr || hierarchy->FirstChild == InvalidEntityHandle)
+        // Flat indices of IsDirtyTag entities, ascending. Tagged entities
+        // outside the traversal are ignored and keep their tag.
+        template <typename DirtyView>
+        void CollectSeeds(FlatHierarchy& flat, const DirtyView& dirtyTags)
+        {
+            flat.Seeds.clear();
+            const std::size_t nodeCount = flat.Nodes.size();
+            if (dirtyTags.size() * kDenseSeedDivisor < nodeCount)
             {
+                for (const EntityHandle entity : dirtyTags)
+                {
+                    if (const std::uint32_t index = FlatIndexOf(flat, entity); index != InvalidFlatIndex)
+                        flat.Seeds.push_back(index);
+                }
+                std::sort(flat.Seeds.begin(), flat.Seeds.end());
                 return;
             }
 
-            EntityHandle child = hierarchy->FirstChild;
-            while (child != InvalidEntityHandle)
+            flat.SeedMask.assign(nodeCount, 0u);
+            for (const EntityHandle entity : dirtyTags)
             {
-                const auto& childHierarchy = registry.get<Components::Hierarchy::Component>(child);
-                const EntityHandle next = childHierarchy.NextSibling;
-                UpdateNode(registry, child, world->Matrix, isDirty);
-                child = next;
+                if (const std::uint32_t index = FlatIndexOf(flat, entity); index != InvalidFlatIndex)
+                    flat.SeedMask[index] = 1u;
+            }
+            for (std::size_t i = 0; i < nodeCount; ++i)
+            {
+                if (flat.SeedMask[i] != 0u)
+                    flat.Seeds.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        // Level by level, the dirty set is the children of the previous
+        // level's dirty ranges merged with this level's seeds. Both inputs are
+        // ascending, so one merge yields sorted, disjoint, coalesced ranges.
+        void BuildDirtyRanges(FlatHierarchy& flat)
+        {
+            flat.Ranges.clear();
+            flat.LevelRangeBegin.clear();
+
+            const std::size_t levelCount = flat.LevelBegin.size() - 1u;
+            std::size_t seed = 0;
+            std::size_t parentBegin = 0;
+            std::size_t parentEnd = 0;
+            for (std::size_t level = 0; level < levelCount; ++level)
+            {
+                if (parentBegin == parentEnd && seed == flat.Seeds.size())
+                    break;
+
+                const std::size_t first = flat.Ranges.size();
+                const std::size_t levelEnd = flat.LevelBegin[level + 1u];
+                flat.LevelRangeBegin.push_back(first);
+                const auto append = [&](const std::size_t begin, const std::size_t end)
+                {
+                    if (begin >= end)
+                        return;
+                    if (flat.Ranges.size() > first && flat.Ranges.back().End >= begin)
+                        flat.Ranges.back().End = std::max(flat.Ranges.back().End, end);
+                    else
+                        flat.Ranges.push_back(Parallel::IndexRange{begin, end});
+                };
+
+                std::size_t parent = parentBegin;
+                while (parent < parentEnd || (seed < flat.Seeds.size() && flat.Seeds[seed] < levelEnd))
+                {
+                    std::size_t childBegin = flat.Nodes.size();
+                    std::size_t childEnd = childBegin;
+                    if (parent < parentEnd)
+                    {
+                        childBegin = flat.ChildBegin[flat.Ranges[parent].Begin];
+                        childEnd = flat.ChildBegin[flat.Ranges[parent].End];
+                    }
+
+                    if (seed < flat.Seeds.size() && flat.Seeds[seed] < levelEnd && flat.Seeds[seed] < childBegin)
+                    {
+                        append(flat.Seeds[seed], flat.Seeds[seed] + 1u);
+                        ++seed;
+                    }
+                    else
+                    {
+                        append(childBegin, childEnd);
+                        ++parent;
+                    }
+                }
+
+                parentBegin = first;
+                parentEnd = flat.Ranges.size();
+            }
+            flat.LevelRangeBegin.push_back(flat.Ranges.size());
+        }
+
+        void ComputeWorldMatrices(entt::registry& registry, FlatHierarchy& flat)
+        {
+            const auto& locals = registry.storage<Components::Transform::Component>();
+            auto& worlds = registry.storage<Components::Transform::WorldMatrix>();
+            const auto updateNode = [&](const std::size_t index)
+            {
+                const FlatNode node = flat.Nodes[index];
+                const glm::mat4 parentMatrix = node.Parent == InvalidFlatIndex
+                                                   ? glm::mat4(1.0f)
+                                                   : worlds.get(flat.Nodes[node.Parent].Entity).Matrix;
+                worlds.get(node.Entity).Matrix =
+                    parentMatrix * Components::Transform::GetMatrix(locals.get(node.Entity));
+            };
+
+            // Parents finish before their level's children start; within a
+            // level every node is independent.
+            for (std::size_t level = 0; level + 1u < flat.LevelRangeBegin.size(); ++level)
+            {
+                const std::size_t rangeBegin = flat.LevelRangeBegin[level];
+                const std::size_t rangeEnd = flat.LevelRangeBegin[level + 1u];
+                flat.RangeOffsets.resize(rangeEnd - rangeBegin + 1u);
+                flat.RangeOffsets[0] = 0u;
+                for (std::size_t r = rangeBegin; r < rangeEnd; ++r)
+                    flat.RangeOffsets[r - rangeBegin + 1u] = flat.RangeOffsets[r - rangeBegin] + flat.Ranges[r].Size();
+
+                const std::span<const std::size_t> offsets{flat.RangeOffsets};
+                Parallel::ParallelFor(Parallel::IndexRange{0u, offsets.back()}, kMatrixGrain,
+                    [&](const Parallel::IndexRange chunk)
+                    {
+                        // Chunks index the concatenated dirty ranges of the level.
+                        std::size_t r = static_cast<std::size_t>(
+                            std::upper_bound(offsets.begin(), offsets.end(), chunk.Begin) - offsets.begin()) - 1u;
+                        for (std::size_t position = chunk.Begin; position < chunk.End; ++r)
+                        {
+                            const std::size_t stop = std::min(chunk.End, offsets[r + 1u]);
+                            const std::size_t node = flat.Ranges[rangeBegin + r].Begin + (position - offsets[r]);
+                            for (std::size_t k = 0; k < stop - position; ++k)
+                                updateNode(node + k);
+                            position = stop;
+                        }
+                    });
             }
         }
     }
 
     void OnUpdate(entt::registry& registry)
     {
-        // Roots own the traversal. Iterating over the joint
-        // (Transform, Hierarchy) view ensures we only visit entities that
-        // can actually contribute to a recompute.
-        const auto roots = registry.view<Components::Transform::Component,
-                                         Components::Hierarchy::Component>();
-        for (auto [entity, transform, hierarchy] : roots.each())
+        const auto dirtyTags = registry.view<Components::Transform::IsDirtyTag>();
+        if (dirtyTags.empty())
+            return;
+
+        FlatHierarchy& flat = AcquireFlatHierarchy(registry);
+        CollectSeeds(flat, dirtyTags);
+        if (flat.Seeds.empty())
+            return;
+
+        BuildDirtyRanges(flat);
+        ComputeWorldMatrices(registry, flat);
+
+        // Tag edits touch registry storage and stay on the calling thread.
+        for (const Parallel::IndexRange range : flat.Ranges)
         {
-            (void)transform;
-            if (hierarchy.Parent == InvalidEntityHandle)
+            for (std::size_t i = range.Begin; i < range.End; ++i)
             {
-                UpdateNode(registry, entity, glm::mat4(1.0f), false);
+                const EntityHandle entity = flat.Nodes[i].Entity;
+                registry.emplace_or_replace<Components::Transform::WorldUpdatedTag>(entity);
+                registry.remove<Components::Transform::IsDirtyTag>(entity);
             }
         }
     }
 
+    std::span<const FlatNode> GetFlatOrder(entt::registry& registry)
+    {
+        return AcquireFlatHierarchy(registry).Nodes;
+    }
+
+    std::uint64_t GetFlatOrderRebuildCount(const entt::registry& registry) noexcept
+    {
+        const auto* flat = registry.ctx().find<FlatHierarchy>();
+        return flat != nullptr ? flat->RebuildCount : 0u;
+    }
+
     void RegisterSystem(Extrinsic::Core::FrameGraph& graph, entt::registry& registry)
     {
         graph.AddPass(PassName,
             [](Extrinsic::Core::FrameGraphBuilder& builder)
             {
-                // UpdateNode adds/removes transient transform tags, including
+                // OnUpdate adds/removes transient transform tags, including
                 // first-use component storage creation.
                 builder.StructuralWrite();
                 builder.Read<Components::Transform::Component>();
@@ -1,10 +1,14 @@
 module;
 
+#include <cstdint>
+#include <limits>
+#include <span>
 #include <entt/fwd.hpp>
 
 export module Extrinsic.ECS.System.TransformHierarchy;
 
 import Extrinsic.Core.FrameGraph;
+import Extrinsic.ECS.Scene.Handle;
 
 export namespace Extrinsic::ECS::Systems::TransformHierarchy
 {
@@ -13,15 +17,40 @@ export namespace Extrinsic::ECS::Systems::TransformHierarchy
     // transform update.
     inline constexpr const char* PassName = "TransformUpdate";
 
-    // Walk every root entity (no Hierarchy parent) and recompute the world
-    // matrix for entities whose local transform is dirty (or whose ancestor
-    // is dirty). On entities that get rewritten:
+    inline constexpr std::uint32_t InvalidFlatIndex = std::numeric_limits<std::uint32_t>::max();
+
+    // One entry of the cached breadth-first traversal order. Parent indexes
+    // into the same flat array (InvalidFlatIndex for roots) and always
+    // precedes the entry.
+    struct FlatNode
+    {
+        EntityHandle Entity = InvalidEntityHandle;
+        std::uint32_t Parent = InvalidFlatIndex;
+    };
+
+    // Recompute the world matrix for entities whose local transform is dirty
+    // (or whose ancestor is dirty), starting from every root entity (no
+    // Hierarchy parent). On entities that get rewritten:
     //   - emplace Components::Transform::WorldUpdatedTag (consumer-cleared);
     //   - remove Components::Transform::IsDirtyTag (this system's contract).
     // GPU-sync (Components::DirtyTags::DirtyTransform) is not stamped here;
     // render-sync owns that hand-off.
+    //
+    // The traversal runs over a flat breadth-first order cached in the
+    // registry context and rebuilt only after a structural edit (hierarchy
+    // links, or Transform/WorldMatrix presence). Only the dirty ranges of each
+    // depth level are visited, so a frame with no IsDirtyTag costs O(1); the
+    // matrices of one level are computed in parallel through
+    // Core::Parallel when the scheduler is running.
     void OnUpdate(entt::registry& registry);
 
+    // The cached traversal order, rebuilt first if stale. Valid until the
+    // next structural edit or OnUpdate.
+    [[nodiscard]] std::span<const FlatNode> GetFlatOrder(entt::registry& registry);
+
+    // Number of times the flat order has been rebuilt for this registry.
+    [[nodiscard]] std::uint64_t GetFlatOrderRebuildCount(const entt::registry& registry) noexcept;
+
     // Register the traversal as a FrameGraph pass with declared dependencies:
     //   Read<Transform::Component>, Read<Hierarchy::Component>,
     //   Write<Transform::WorldMatrix>, Write<Transform::IsDirtyTag>,
@@ -262,7 +262,7 @@ export namespace Geometry::DEC
                                                const EdgeWeightConfig& config);
 
     // -------------------------------------------------------------------------
-    // Conjugate Gradient Solver (Jacobi-preconditioned)
+    // Conjugate Gradient Solver (Jacobi- or AMG-preconditioned)
     // -------------------------------------------------------------------------
     // Solves symmetric positive-definite linear systems arising from DEC
     // operators (e.g., Poisson equations, heat diffusion).
@@ -272,7 +272,8 @@ export namespace Geometry::DEC
     using CGResult = Geometry::Sparse::CGResult;
 
     // Solve A*x = b where A is a symmetric positive-definite SparseMatrix.
-    // Uses Jacobi (diagonal) preconditioning.
+    // Jacobi (diagonal) preconditioning by default; CGParams::Preconditioner
+    // selects AMG for large meshes.
     // x is used as the initial guess and overwritten with the solution.
     [[nodiscard]] CGResult SolveCG(
         const SparseMatrix& A,
@@ -4,6 +4,7 @@ module;
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <span>
 #include <vector>
@@ -17,6 +18,8 @@ import Geometry.Properties;
 import Geometry.HalfedgeMesh;
 import Geometry.DEC;
 import Geometry.HalfedgeMesh.Utils;
+import Geometry.Sparse;
+import Extrinsic.Core.Parallel;
 
 namespace Geometry::Geodesic
 {
@@ -41,7 +44,7 @@ namespace Geometry::Geodesic
 
     static std::vector<FaceGradient> ComputeNormalizedGradient(
         const HalfedgeMesh::Mesh& mesh,
-        const std::vector<double>& u)
+        std::span<const double> u)
     {
         const std::size_t nF = mesh.FacesSize();
         std::vector<FaceGradient> gradients(nF);
@@ -268,4 +271,241 @@ namespace Geometry::Geodesic
 
         return result;
     }
+
+    // =========================================================================
+    // GeodesicSolver
+    // =========================================================================
+
+    namespace
+    {
+        namespace Parallel = Extrinsic::Core::Parallel;
+
+        // Identity regularization of the Poisson system; matches the shifted
+        // CG solve in ComputeDistance().
+        constexpr double kPoissonRegularization = 1e-8;
+
+        [[nodiscard]] Sparse::SparseMatrix CombineMassAndLaplacian(
+            const DEC::DiagonalMatrix& mass,
+            double massScale,
+            const DEC::SparseMatrix& laplacian,
+            double laplacianScale)
+        {
+            Sparse::SparseBuilder builder(laplacian.Rows, laplacian.Cols);
+            builder.Reserve(laplacian.Values.size() + mass.Diagonal.size());
+
+            for (std::size_t row = 0; row < laplacian.Rows; ++row)
+            {
+                for (std::size_t k = laplacian.RowOffsets[row]; k < laplacian.RowOffsets[row + 1]; ++k)
+                    builder.Add(row, laplacian.ColIndices[k], laplacianScale * laplacian.Values[k]);
+            }
+
+            const std::size_t diagonalCount = std::min(mass.Size, mass.Diagonal.size());
+            for (std::size_t i = 0; i < diagonalCount; ++i)
+                builder.Add(i, i, massScale * mass.Diagonal[i]);
+
+            return builder.Build().Matrix;
+        }
+
+        [[nodiscard]] bool IsUsableSource(const HalfedgeMesh::Mesh& mesh, std::size_t s)
+        {
+            if (s >= mesh.VerticesSize())
+                return false;
+            VertexHandle vh{static_cast<PropertyIndex>(s)};
+            return !mesh.IsDeleted(vh) && !mesh.IsIsolated(vh);
+        }
+    }
+
+    GeodesicSolver::GeodesicSolver(const GeodesicParams& params)
+        : m_Params(params)
+    {
+    }
+
+    GeodesicSolver::MeshKey GeodesicSolver::KeyOf(const HalfedgeMesh::Mesh& mesh)
+    {
+        const auto vertices = mesh.VertexProperties();
+        const auto halfedges = mesh.HalfedgeProperties();
+        const auto faces = mesh.FaceProperties();
+
+        MeshKey key;
+        key.Mesh = &mesh;
+        key.VertexCount = mesh.VerticesSize();
+        key.FaceCount = mesh.FacesSize();
+        key.Revisions = {
+            vertices.FindPropertyRevision("v:point").value_or(0u),
+            vertices.FindPropertyRevision("v:connectivity").value_or(0u),
+            vertices.FindPropertyRevision("v:deleted").value_or(0u),
+            halfedges.FindPropertyRevision("h:connectivity").value_or(0u),
+            faces.FindPropertyRevision("f:connectivity").value_or(0u),
+            faces.FindPropertyRevision("f:deleted").value_or(0u)};
+        return key;
+    }
+
+    bool GeodesicSolver::Prepare(const HalfedgeMesh::Mesh& mesh)
+    {
+        Reset();
+        if (mesh.IsEmpty() || mesh.FaceCount() == 0)
+            return false;
+
+        const MeshKey key = KeyOf(mesh);
+
+        DEC::DECOperators ops = DEC::BuildOperators(mesh);
+        if (!ops.IsValid())
+            return false;
+
+        const double h = MeanEdgeLength(mesh);
+        const double t = m_Params.TimeStep > 0.0 ? m_Params.TimeStep : h * h;
+        if (!(t > 0.0) || !std::isfinite(t))
+            return false;
+
+        if (!m_HeatSolver.factor(CombineMassAndLaplacian(ops.Hodge0, 1.0, ops.Laplacian, t)).Succeeded())
+            return false;
+
+        DEC::DiagonalMatrix regularizer;
+        regularizer.Size = mesh.VerticesSize();
+        regularizer.Diagonal.assign(regularizer.Size, kPoissonRegularization);
+        if (!m_PoissonSolver.factor(CombineMassAndLaplacian(regularizer, 1.0, ops.Laplacian, 1.0)).Succeeded())
+            return false;
+
+        m_TimeStep = t;
+        m_Key = key;
+        ++m_FactorizationCount;
+        return true;
+    }
+
+    bool GeodesicSolver::IsPreparedFor(const HalfedgeMesh::Mesh& mesh) const
+    {
+        return m_Key.has_value() && *m_Key == KeyOf(mesh);
+    }
+
+    void GeodesicSolver::Reset()
+    {
+        m_Key.reset();
+        m_HeatSolver = Sparse::SparseLLT{};
+        m_PoissonSolver = Sparse::SparseLDLT{};
+        m_TimeStep = 0.0;
+    }
+
+    bool GeodesicSolver::EnsurePrepared(const HalfedgeMesh::Mesh& mesh)
+    {
+        return IsPreparedFor(mesh) || Prepare(mesh);
+    }
+
+    bool GeodesicSolver::Solve(
+        const HalfedgeMesh::Mesh& mesh,
+        std::span<const std::size_t> sourceVertices,
+        std::span<double> distances) const
+    {
+        const std::size_t nV = mesh.VerticesSize();
+
+        std::vector<double> rhs(nV, 0.0);
+        bool anySource = false;
+        for (std::size_t s : sourceVertices)
+        {
+            if (IsUsableSource(mesh, s))
+            {
+                rhs[s] = 1.0;
+                anySource = true;
+            }
+        }
+
+        // No usable source: the heat solution is zero and so is every distance.
+        std::fill(distances.begin(), distances.end(), 0.0);
+        if (!anySource)
+            return true;
+
+        std::vector<double> u(nV, 0.0);
+        if (!m_HeatSolver.solve(rhs, u).Succeeded())
+            return false;
+
+        const auto X = ComputeNormalizedGradient(mesh, u);
+        const auto divX = ComputeDivergence(mesh, X);
+
+        std::vector<double> phi(nV, 0.0);
+        if (!m_PoissonSolver.solve(divX, phi).Succeeded())
+            return false;
+
+        double minDist = 1e30;
+        for (std::size_t vi = 0; vi < nV; ++vi)
+        {
+            VertexHandle vh{static_cast<PropertyIndex>(vi)};
+            if (mesh.IsDeleted(vh) || mesh.IsIsolated(vh)) continue;
+            if (phi[vi] < minDist) minDist = phi[vi];
+        }
+
+        for (std::size_t vi = 0; vi < nV; ++vi)
+        {
+            VertexHandle vh{static_cast<PropertyIndex>(vi)};
+            if (mesh.IsDeleted(vh) || mesh.IsIsolated(vh)) continue;
+            distances[vi] = phi[vi] - minDist;
+        }
+        return true;
+    }
+
+    std::optional<GeodesicResult> GeodesicSolver::ComputeDistance(
+        HalfedgeMesh::Mesh& mesh,
+        std::span<const std::size_t> sourceVertices)
+    {
+        if (mesh.IsEmpty() || mesh.FaceCount() == 0 || sourceVertices.empty())
+            return std::nullopt;
+
+        const HalfedgeMesh::Mesh& constMesh = mesh;
+        if (!EnsurePrepared(constMesh))
+            return std::nullopt;
+
+        const std::size_t nV = constMesh.VerticesSize();
+        std::vector<double> distances(nV, 0.0);
+        if (!Solve(constMesh, sourceVertices, distances))
+            return std::nullopt;
+
+        GeodesicResult result;
+        result.Converged = true;
+        result.DistanceProperty = VertexProperty<double>(
+            mesh.VertexProperties().GetOrAdd<double>("v:geodesic_distance", 0.0));
+        result.IsSourceProperty = VertexProperty<bool>(
+            mesh.VertexProperties().GetOrAdd<bool>("v:is_geodesic_source", false));
+
+        for (std::size_t vi = 0; vi < nV; ++vi)
+        {
+            VertexHandle vh{static_cast<PropertyIndex>(vi)};
+            result.DistanceProperty[vh] = distances[vi];
+            result.IsSourceProperty[vh] = false;
+        }
+
+        for (std::size_t s : sourceVertices)
+        {
+            if (IsUsableSource(constMesh, s))
+                result.IsSourceProperty[VertexHandle{static_cast<PropertyIndex>(s)}] = true;
+        }
+
+        return result;
+    }
+
+    std::optional<GeodesicBatchResult> GeodesicSolver::ComputeDistances(
+        const HalfedgeMesh::Mesh& mesh,
+        std::span<const std::size_t> sourceVertices)
+    {
+        if (sourceVertices.empty() || !EnsurePrepared(mesh))
+            return std::nullopt;
+
+        GeodesicBatchResult batch;
+        batch.VertexCount = mesh.VerticesSize();
+        batch.SourceCount = sourceVertices.size();
+        batch.Distances.assign(batch.VertexCount * batch.SourceCount, 0.0);
+
+        // Each column is an independent pair of back-substitutions plus the
+        // per-face gradient/divergence pass, so columns run as separate tasks.
+        std::vector<std::uint8_t> solved(batch.SourceCount, 0u);
+        const std::span<double> distances{batch.Distances};
+        Parallel::ParallelFor(Parallel::IndexRange{0u, batch.SourceCount}, 1u, [&](const std::size_t s)
+        {
+            solved[s] = Solve(mesh, sourceVertices.subspan(s, 1u),
+                              distances.subspan(s * batch.VertexCount, batch.VertexCount))
+                ? 1u
+                : 0u;
+        });
+
+        if (std::find(solved.begin(), solved.end(), std::uint8_t{0u}) != solved.end())
+            return std::nullopt;
+        return batch;
+    }
 } // namespace Geometry::Geodesic
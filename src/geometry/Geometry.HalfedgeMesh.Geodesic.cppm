@@ -1,5 +1,6 @@
 module;
 
+#include <array>
 #include <cstddef>
 #include <optional>
 #include <span>
@@ -9,6 +10,7 @@ export module Geometry.Geodesic;
 
 import Geometry.Properties;
 import Geometry.HalfedgeMesh;
+import Geometry.Sparse;
 
 export namespace Geometry::Geodesic
 {
@@ -37,11 +39,12 @@ export namespace Geometry::Geodesic
     //
     // Advantages over Dijkstra / fast marching:
     //   - Handles any triangle mesh topology (including non-convex, genus > 0)
-    //   - Same factorization reused for multiple source sets
+    //   - Same factorization reused for multiple source sets (GeodesicSolver)
     //   - Accuracy improves with mesh refinement (converges to true geodesic)
     //
     // The DEC module provides all required operators (Hodge stars, Laplacian,
-    // exterior derivatives). The CG solver handles the two linear solves.
+    // exterior derivatives). ComputeDistance() runs the two linear solves with
+    // CG; GeodesicSolver factors both systems once and back-substitutes.
 
     struct GeodesicParams
     {
@@ -83,4 +86,83 @@ export namespace Geometry::Geodesic
         std::span<const std::size_t> sourceVertices,
         const GeodesicParams& params = {});
 
+    struct GeodesicBatchResult
+    {
+        std::size_t VertexCount{0};
+        std::size_t SourceCount{0};
+
+        // Distances from sourceVertices[s] occupy
+        // [s * VertexCount, (s + 1) * VertexCount). Deleted/isolated vertices
+        // and columns for invalid sources are 0.
+        std::vector<double> Distances{};
+    };
+
+    // -------------------------------------------------------------------------
+    // Prefactored heat-method solver
+    // -------------------------------------------------------------------------
+    //
+    // Builds the DEC operators once per mesh, factors the heat system
+    // (M + t*L) with SparseLLT and the regularized Poisson system with
+    // SparseLDLT, and answers every later query with back-substitution only.
+    // The Poisson system uses the same 1e-8 identity regularization as
+    // ComputeDistance(), so both paths agree up to the CG tolerance.
+    //
+    // The factorization is keyed on the mesh address, element counts, and
+    // the content revisions of the position, connectivity, and deletion
+    // properties; a query against a mesh whose key changed refactors first.
+    // Writing result properties (v:geodesic_distance, ...) does not
+    // invalidate it. GeodesicParams::SolverTolerance and MaxSolverIterations
+    // are not used.
+    class GeodesicSolver
+    {
+    public:
+        explicit GeodesicSolver(const GeodesicParams& params = {});
+
+        // Factors both systems for `mesh`. Returns false, leaving the solver
+        // unprepared, if the mesh has no faces or a factorization fails.
+        [[nodiscard]] bool Prepare(const HalfedgeMesh::Mesh& mesh);
+        [[nodiscard]] bool IsPreparedFor(const HalfedgeMesh::Mesh& mesh) const;
+        void Reset();
+
+        // Same contract and output properties as the free ComputeDistance();
+        // the iteration counts in the result are 0.
+        [[nodiscard]] std::optional<GeodesicResult> ComputeDistance(
+            HalfedgeMesh::Mesh& mesh,
+            std::span<const std::size_t> sourceVertices);
+
+        // One independent single-source query per entry of sourceVertices,
+        // solved in parallel over Core::Parallel. Writes no mesh properties.
+        // Returns nullopt if sourceVertices is empty or preparation fails.
+        [[nodiscard]] std::optional<GeodesicBatchResult> ComputeDistances(
+            const HalfedgeMesh::Mesh& mesh,
+            std::span<const std::size_t> sourceVertices);
+
+        [[nodiscard]] double TimeStep() const noexcept { return m_TimeStep; }
+        [[nodiscard]] std::size_t FactorizationCount() const noexcept { return m_FactorizationCount; }
+
+    private:
+        struct MeshKey
+        {
+            const HalfedgeMesh::Mesh* Mesh{nullptr};
+            std::size_t VertexCount{0};
+            std::size_t FaceCount{0};
+            std::array<PropertyRevision, 6> Revisions{};
+
+            bool operator==(const MeshKey&) const = default;
+        };
+
+        [[nodiscard]] static MeshKey KeyOf(const HalfedgeMesh::Mesh& mesh);
+        [[nodiscard]] bool EnsurePrepared(const HalfedgeMesh::Mesh& mesh);
+        [[nodiscard]] bool Solve(const HalfedgeMesh::Mesh& mesh,
+                                 std::span<const std::size_t> sourceVertices,
+                                 std::span<double> distances) const;
+
+        GeodesicParams m_Params{};
+        std::optional<MeshKey> m_Key{};
+        Sparse::SparseLLT m_HeatSolver{};
+        Sparse::SparseLDLT m_PoissonSolver{};
+        double m_TimeStep{0.0};
+        std::size_t m_FactorizationCount{0};
+    };
+
 } // namespace Geometry::Geodesic
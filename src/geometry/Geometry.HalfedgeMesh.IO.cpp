@@ -9,6 +9,7 @@ module;
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <ios>
 #include <limits>
 #include <optional>
@@ -28,6 +29,7 @@ module Geometry.HalfedgeMesh.IO;
 
 import Geometry.Properties;
 import Extrinsic.Core.Error;
+import Extrinsic.Core.Parallel;
 
 namespace Geometry::MeshIO
 {
@@ -37,10 +39,13 @@ namespace Geometry::MeshIO
         using Geometry::IOText::NextLine;
         using Geometry::IOText::ParseNumber;
         using Geometry::IOText::ReadTextFile;
+        using Geometry::IOText::SplitLineAlignedChunks;
         using Geometry::IOText::SplitWhitespace;
         using Geometry::IOText::TextFileError;
         using Geometry::IOText::Trim;
 
+        namespace Parallel = Extrinsic::Core::Parallel;
+
         [[nodiscard]] Extrinsic::Core::ErrorCode ToCoreError(TextFileError error)
         {
             switch (error)
@@ -184,43 +189,114 @@ namespace Geometry::MeshIO
             }
         }
 
+        // Polygons in CSR form: face f owns Corners[Offsets[f], Offsets[f + 1]).
+        template <typename T>
+        struct FlatPolygons
+        {
+            std::vector<std::size_t> Offsets{0u};
+            std::vector<T> Corners;
+
+            [[nodiscard]] std::size_t FaceCount() const noexcept { return Offsets.size() - 1u; }
+
+            [[nodiscard]] std::span<const T> Face(std::size_t face) const
+            {
+                return std::span<const T>{Corners}.subspan(Offsets[face], Offsets[face + 1u] - Offsets[face]);
+            }
+        };
+
+        using FlatFaces = FlatPolygons<std::uint32_t>;
+
+        // Concatenates select(chunk) over all chunks in chunk order; each
+        // chunk copies its part on its own task.
+        template <typename T, typename Chunk, typename SelectFn>
+        [[nodiscard]] std::vector<T> GatherChunks(const std::vector<Chunk>& chunks, const SelectFn& select)
+        {
+            std::vector<std::size_t> offsets(chunks.size() + 1u, 0u);
+            for (std::size_t c = 0; c < chunks.size(); ++c)
+            {
+                offsets[c + 1u] = offsets[c] + select(chunks[c]).size();
+            }
+
+            std::vector<T> gathered(offsets.back());
+            Parallel::ParallelFor(Parallel::IndexRange{0u, chunks.size()}, 1u, [&](const std::size_t c)
+            {
+                const std::vector<T>& part = select(chunks[c]);
+                std::copy(part.begin(), part.end(), gathered.begin() + static_cast<std::ptrdiff_t>(offsets[c]));
+            });
+            return gathered;
+        }
+
+        // Gathers per-chunk FaceSizes/FaceCorners into one CSR face list.
+        template <typename T, typename Chunk>
+        [[nodiscard]] FlatPolygons<T> GatherFaces(const std::vector<Chunk>& chunks)
+        {
+            const std::vector<std::size_t> sizes =
+                GatherChunks<std::size_t>(chunks, [](const Chunk& chunk) -> const auto& { return chunk.FaceSizes; });
+
+            FlatPolygons<T> faces;
+            faces.Offsets.assign(sizes.size() + 1u, 0u);
+            Parallel::ParallelScan<std::size_t>(sizes, std::span<std::size_t>{faces.Offsets}.subspan(1u), 0u,
+                                                std::plus<>{}, Parallel::ScanKind::Inclusive);
+            faces.Corners = GatherChunks<T>(chunks, [](const Chunk& chunk) -> const auto& { return chunk.FaceCorners; });
+            return faces;
+        }
+
+        // Calls rowFn(trimmedLine) for each line of a newline-aligned chunk
+        // until it returns false; lines split exactly as NextLine splits the
+        // whole text.
+        template <typename RowFn>
+        void ForEachChunkLine(std::string_view text, const RowFn& rowFn)
+        {
+            std::size_t cursor = 0;
+            std::string_view line;
+            while (NextLine(text, cursor, line))
+            {
+                if (!rowFn(line))
+                {
+                    return;
+                }
+            }
+        }
+
         void PopulateResult(MeshIOResult& result,
                             std::span<const glm::vec3> vertices,
-                            std::span<const std::vector<std::uint32_t>> faces,
+                            const FlatFaces& faces,
                             std::span<const glm::vec3> normals = {},
                             std::span<const glm::vec4> colors = {})
         {
+            // Spans are fetched once; element access through the property
+            // marks it modified and must stay off the worker tasks.
             result.Vertices.Resize(vertices.size());
             auto positions = result.Vertices.GetOrAdd<glm::vec3>("v:point", glm::vec3(0.0f));
-            for (std::size_t i = 0; i < vertices.size(); ++i)
-            {
-                positions[i] = vertices[i];
-            }
+            std::ranges::copy(vertices, positions.Span().begin());
 
             if (!normals.empty() && normals.size() == vertices.size())
             {
                 auto normalProperty = result.Vertices.GetOrAdd<glm::vec3>("v:normal", glm::vec3(0.0f, 1.0f, 0.0f));
-                for (std::size_t i = 0; i < normals.size(); ++i)
-                {
-                    normalProperty[i] = normals[i];
-                }
+                std::ranges::copy(normals, normalProperty.Span().begin());
             }
 
             if (!colors.empty() && colors.size() == vertices.size())
             {
                 auto colorProperty = result.Vertices.GetOrAdd<glm::vec4>("v:color", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-                for (std::size_t i = 0; i < colors.size(); ++i)
-                {
-                    colorProperty[i] = colors[i];
-                }
+                std::ranges::copy(colors, colorProperty.Span().begin());
             }
 
-            result.Faces.Resize(faces.size());
+            result.Faces.Resize(faces.FaceCount());
             auto faceVertices = result.Faces.GetOrAdd<std::vector<std::uint32_t>>("f:vertices", {});
-            for (std::size_t i = 0; i < faces.size(); ++i)
-            {
-                faceVertices[i] = faces[i];
-            }
+            const std::span<std::vector<std::uint32_t>> faceSpan = faceVertices.Span();
+            Parallel::ParallelFor(Parallel::IndexRange{0u, faces.FaceCount()}, Parallel::AutoGrain,
+                [&](const std::size_t face)
+                {
+                    const std::span<const std::uint32_t> corners = faces.Face(face);
+                    faceSpan[face].assign(corners.begin(), corners.end());
+                });
+        }
+
+        void PopulateVertexTexcoords(MeshIOResult& result, std::span<const glm::vec2> texcoords)
+        {
+            auto texcoordProperty = result.Vertices.GetOrAdd<glm::vec2>("v:texcoord", glm::vec2(0.0f));
+            std::ranges::copy(texcoords, texcoordProperty.Span().begin());
         }
 
         [[nodiscard]] Extrinsic::Core::Expected<MeshIOResult> InvalidMeshFormat()
@@ -577,10 +653,131 @@ namespace Geometry::MeshIO
             return std::nullopt;
         }
 
+        // ASCII OFF and PLY bodies are row lists: vertexCount vertex rows,
+        // then faceCount face rows. Each newline-aligned chunk first counts
+        // its rows, the counts give every chunk the file row it starts at,
+        // and each chunk then parses its rows into its own buffers.
+        struct TextRowChunk
+        {
+            std::string_view Text;
+            std::size_t RowCount = 0;
+            std::size_t FirstRow = 0;
+            std::vector<glm::vec3> Vertices;
+            std::vector<glm::vec3> Normals;
+            std::vector<glm::vec4> Colors;
+            std::vector<glm::vec2> Texcoords;
+            std::vector<std::size_t> FaceSizes;
+            std::vector<std::uint32_t> FaceCorners;
+            bool Failed = false;
+        };
+
+        [[nodiscard]] std::vector<TextRowChunk> MakeTextRowChunks(std::string_view body, std::size_t chunkBytes)
+        {
+            const std::vector<std::string_view> pieces = SplitLineAlignedChunks(body, chunkBytes);
+            std::vector<TextRowChunk> chunks(pieces.size());
+            for (std::size_t c = 0; c < pieces.size(); ++c)
+            {
+                chunks[c].Text = pieces[c];
+            }
+            return chunks;
+        }
+
+        // isRow(line) separates rows from skipped lines; parseRow(line, row,
+        // tokens, chunk) parses file row `row`. Rows past rowLimit are
+        // ignored. Fails when the body has fewer than rowLimit rows or a row
+        // is rejected.
+        template <typename IsRowFn, typename ParseRowFn>
+        [[nodiscard]] bool ParseTextRows(std::vector<TextRowChunk>& chunks,
+                                         std::size_t rowLimit,
+                                         const IsRowFn& isRow,
+                                         const ParseRowFn& parseRow)
+        {
+            const Parallel::IndexRange chunkRange{0u, chunks.size()};
+            Parallel::ParallelFor(chunkRange, 1u, [&](const std::size_t c)
+            {
+                TextRowChunk& chunk = chunks[c];
+                ForEachChunkLine(chunk.Text, [&](std::string_view line)
+                {
+                    chunk.RowCount += isRow(line) ? 1u : 0u;
+                    return true;
+                });
+            });
+
+            std::size_t rows = 0;
+            for (TextRowChunk& chunk : chunks)
+            {
+                chunk.FirstRow = rows;
+                rows += chunk.RowCount;
+            }
+            if (rows < rowLimit)
+            {
+                return false;
+            }
+
+            Parallel::ParallelFor(chunkRange, 1u, [&](const std::size_t c)
+            {
+                TextRowChunk& chunk = chunks[c];
+                std::size_t row = chunk.FirstRow;
+                if (row >= rowLimit)
+                {
+                    return;
+                }
+                std::vector<std::string_view> tokens;
+                ForEachChunkLine(chunk.Text, [&](std::string_view line)
+                {
+                    if (!isRow(line))
+                    {
+                        return true;
+                    }
+                    SplitWhitespace(line, tokens);
+                    if (!parseRow(row, tokens, chunk))
+                    {
+                        chunk.Failed = true;
+                        return false;
+                    }
+                    return ++row < rowLimit;
+                });
+            });
+            return std::ranges::none_of(chunks, [](const TextRowChunk& chunk) { return chunk.Failed; });
+        }
+
+        // `count i0 i1 ...` face row shared by ASCII OFF and PLY.
+        [[nodiscard]] bool ParseFaceRow(std::span<const std::string_view> tokens,
+                                        std::size_t vertexCount,
+                                        TextRowChunk& chunk)
+        {
+            if (tokens.empty())
+            {
+                return false;
+            }
+            const auto count = ParseNumber<std::size_t>(tokens[0]);
+            if (!count || *count < 3 || *count > tokens.size() - 1)
+            {
+                return false;
+            }
+            const std::size_t first = chunk.FaceCorners.size();
+            for (std::size_t j = 0; j < *count; ++j)
+            {
+                const auto index = ParseNumber<std::size_t>(tokens[j + 1]);
+                if (!index || *index >= vertexCount)
+                {
+                    return false;
+                }
+                chunk.FaceCorners.push_back(static_cast<std::uint32_t>(*index));
+            }
+            if (HasDuplicateFaceIndices(std::span<const std::uint32_t>{chunk.FaceCorners}.subspan(first)))
+            {
+                return false;
+            }
+            chunk.FaceSizes.push_back(*count);
+            return true;
+        }
+
         [[nodiscard]] Extrinsic::Core::Expected<MeshIOResult> ParseAsciiPLY(std::string_view text,
                                                                 std::size_t cursor,
                                                                 const std::vector<PlyElement>& elements,
-                                                                std::string_view absolute_path)
+                                                                std::string_view absolute_path,
+                                                                const MeshLoadOptions& options)
         {
             std::size_t vertexCount = 0;
             std::size_t faceCount = 0;
@@ -665,48 +862,33 @@ namespace Geometry::MeshIO
                 return InvalidMeshFormat();
             }
 
-            std::vector<glm::vec3> vertices;
-            vertices.reserve(vertexReserve);
-            std::vector<glm::vec3> normals;
-            if (hasNormals)
+            // Every body line is a row, blank or not.
+            std::vector<TextRowChunk> chunks = MakeTextRowChunks(text.substr(cursor), options.ChunkBytes);
+            const auto parseRow = [&](const std::size_t row,
+                                      std::span<const std::string_view> tokens,
+                                      TextRowChunk& chunk)
             {
-                normals.reserve(vertexReserve);
-            }
-            std::vector<glm::vec4> colors;
-            if (hasColors)
-            {
-                colors.reserve(vertexReserve);
-            }
-            std::vector<glm::vec2> texcoords;
-            if (hasTexcoords)
-            {
-                texcoords.reserve(vertexReserve);
-            }
-            std::string_view line;
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                if (!NextLine(text, cursor, line))
+                if (row >= vertexCount)
                 {
-                    return InvalidMeshFormat();
+                    return ParseFaceRow(tokens, vertexCount, chunk);
                 }
-                const auto tokens = SplitWhitespace(line);
                 if (tokens.size() < vertexElement->Properties.size())
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
                 const auto x = ParseNumber<float>(tokens[*xIndex]);
                 const auto y = ParseNumber<float>(tokens[*yIndex]);
                 const auto z = ParseNumber<float>(tokens[*zIndex]);
                 if (!x || !y || !z)
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
                 const glm::vec3 position(*x, *y, *z);
                 if (!IsFinite(position))
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
-                vertices.push_back(position);
+                chunk.Vertices.push_back(position);
                 if (hasNormals)
                 {
                     const auto nx = ParseNumber<float>(tokens[*nxIndex]);
@@ -714,14 +896,14 @@ namespace Geometry::MeshIO
                     const auto nz = ParseNumber<float>(tokens[*nzIndex]);
                     if (!nx || !ny || !nz)
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
                     const glm::vec3 normal(*nx, *ny, *nz);
                     if (!IsFinite(normal))
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
-                    normals.push_back(normal);
+                    chunk.Normals.push_back(normal);
                 }
                 if (hasColors)
                 {
@@ -731,17 +913,17 @@ namespace Geometry::MeshIO
                     const std::optional<float> a = aIndex ? ParseNumber<float>(tokens[*aIndex]) : std::optional<float>{1.0f};
                     if (!r || !g || !b || !a)
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
                     const glm::vec4 color(*r, *g, *b, *a);
                     if (!IsFinite(color))
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
-                    colors.emplace_back(NormalizePLYColorChannel(color.r),
-                                        NormalizePLYColorChannel(color.g),
-                                        NormalizePLYColorChannel(color.b),
-                                        NormalizePLYColorChannel(color.a));
+                    chunk.Colors.emplace_back(NormalizePLYColorChannel(color.r),
+                                              NormalizePLYColorChannel(color.g),
+                                              NormalizePLYColorChannel(color.b),
+                                              NormalizePLYColorChannel(color.a));
                 }
                 if (hasTexcoords)
                 {
@@ -749,53 +931,32 @@ namespace Geometry::MeshIO
                     const auto v = ParseNumber<float>(tokens[*texVIndex]);
                     if (!u || !v)
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
                     const glm::vec2 texcoord(*u, *v);
                     if (!IsFinite(texcoord))
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
-                    texcoords.push_back(texcoord);
+                    chunk.Texcoords.push_back(texcoord);
                 }
-            }
-
-            std::vector<std::vector<std::uint32_t>> faces;
-            faces.reserve(faceReserve);
-            for (std::size_t i = 0; i < faceCount; ++i)
+                return true;
+            };
+            if (!ParseTextRows(chunks, vertexCount + faceCount, [](std::string_view) { return true; }, parseRow))
             {
-                if (!NextLine(text, cursor, line))
-                {
-                    return InvalidMeshFormat();
-                }
-                const auto tokens = SplitWhitespace(line);
-                if (tokens.empty())
-                {
-                    return InvalidMeshFormat();
-                }
-                const auto count = ParseNumber<std::size_t>(tokens[0]);
-                if (!count || *count < 3 || *count > tokens.size() - 1)
-                {
-                    return InvalidMeshFormat();
-                }
-                std::vector<std::uint32_t> face;
-                face.reserve(*count);
-                for (std::size_t j = 0; j < *count; ++j)
-                {
-                    const auto index = ParseNumber<std::size_t>(tokens[j + 1]);
-                    if (!index || *index >= vertices.size())
-                    {
-                        return InvalidMeshFormat();
-                    }
-                    face.push_back(static_cast<std::uint32_t>(*index));
-                }
-                if (HasDuplicateFaceIndices(face))
-                {
-                    return InvalidMeshFormat();
-                }
-                faces.push_back(std::move(face));
+                return InvalidMeshFormat();
             }
 
+            const std::vector<glm::vec3> vertices =
+                GatherChunks<glm::vec3>(chunks, [](const TextRowChunk& chunk) -> const auto& { return chunk.Vertices; });
+            const std::vector<glm::vec3> normals =
+                GatherChunks<glm::vec3>(chunks, [](const TextRowChunk& chunk) -> const auto& { return chunk.Normals; });
+            const std::vector<glm::vec4> colors =
+                GatherChunks<glm::vec4>(chunks, [](const TextRowChunk& chunk) -> const auto& { return chunk.Colors; });
+            const std::vector<glm::vec2> texcoords =
+                GatherChunks<glm::vec2>(chunks, [](const TextRowChunk& chunk) -> const auto& { return chunk.Texcoords; });
+            const FlatFaces faces = GatherFaces<std::uint32_t>(chunks);
+
             MeshIOResult result;
             const auto pathInfo = MakePathInfo(absolute_path);
             result.SourcePath = pathInfo.SourcePath;
@@ -803,15 +964,14 @@ namespace Geometry::MeshIO
             PopulateResult(result, vertices, faces, normals, colors);
             if (hasTexcoords && texcoords.size() == vertices.size())
             {
-                auto texcoordProperty = result.Vertices.GetOrAdd<glm::vec2>("v:texcoord", glm::vec2(0.0f));
-                for (std::size_t i = 0; i < texcoords.size(); ++i)
-                {
-                    texcoordProperty[i] = texcoords[i];
-                }
+                PopulateVertexTexcoords(result, texcoords);
             }
             return result;
         }
 
+        // Binary face rows are variable-length, so their layout is walked
+        // serially (list counts only) to find where each index list starts;
+        // vertex rows and the index lists are then decoded in parallel.
         [[nodiscard]] Extrinsic::Core::Expected<MeshIOResult> ParseBinaryPLY(std::span<const std::byte> body,
                                                                  const std::vector<PlyElement>& elements,
                                                                  bool bigEndian,
@@ -973,31 +1133,19 @@ namespace Geometry::MeshIO
                 return InvalidMeshFormat();
             }
 
-            std::vector<glm::vec3> vertices;
-            vertices.reserve(vertexElement->Count);
-            std::vector<glm::vec3> normals;
-            if (hasNormals)
-            {
-                normals.reserve(vertexElement->Count);
-            }
-            std::vector<glm::vec4> colors;
-            if (hasColors)
-            {
-                colors.reserve(vertexElement->Count);
-            }
-            std::vector<glm::vec2> texcoords;
-            if (hasTexcoords)
-            {
-                texcoords.reserve(vertexElement->Count);
-            }
-            std::vector<std::vector<std::uint32_t>> faces;
-            faces.reserve(faceElement->Count);
+            const std::size_t vertexCount = vertexElement->Count;
+            std::vector<glm::vec3> vertices(vertexCount);
+            std::vector<glm::vec3> normals(hasNormals ? vertexCount : 0u);
+            std::vector<glm::vec4> colors(hasColors ? vertexCount : 0u);
+            std::vector<glm::vec2> texcoords(hasTexcoords ? vertexCount : 0u);
+            FlatFaces faces;
 
             auto readUInt8 = [&](const std::byte* base, std::size_t offset) -> std::uint8_t {
                 std::uint8_t v = 0;
                 std::memcpy(&v, base + offset, 1);
                 return v;
             };
+            const auto allValid = [](const bool lhs, const bool rhs) { return lhs && rhs; };
 
             for (const PlyElement& element : elements)
             {
@@ -1012,60 +1160,75 @@ namespace Geometry::MeshIO
                     {
                         return InvalidMeshFormat();
                     }
-                    for (std::size_t row = 0; row < element.Count; ++row)
-                    {
-                        const std::byte* base = cursor + row * vertexStride;
-                        const glm::vec3 position(
-                            ReadFloatingScalarAt(base, vertexOffsets[xIndex], vertexElement->Properties[xIndex].ScalarType, bigEndian),
-                            ReadFloatingScalarAt(base, vertexOffsets[yIndex], vertexElement->Properties[yIndex].ScalarType, bigEndian),
-                            ReadFloatingScalarAt(base, vertexOffsets[zIndex], vertexElement->Properties[zIndex].ScalarType, bigEndian));
-                        if (!IsFinite(position))
-                        {
-                            return InvalidMeshFormat();
-                        }
-                        vertices.push_back(position);
-                        if (hasNormals)
-                        {
-                            const glm::vec3 normal(
-                                ReadFloatingScalarAt(base, vertexOffsets[nxIndex], vertexElement->Properties[nxIndex].ScalarType, bigEndian),
-                                ReadFloatingScalarAt(base, vertexOffsets[nyIndex], vertexElement->Properties[nyIndex].ScalarType, bigEndian),
-                                ReadFloatingScalarAt(base, vertexOffsets[nzIndex], vertexElement->Properties[nzIndex].ScalarType, bigEndian));
-                            if (!IsFinite(normal))
-                            {
-                                return InvalidMeshFormat();
-                            }
-                            normals.push_back(normal);
-                        }
-                        if (hasColors)
-                        {
-                            const float r = static_cast<float>(readUInt8(base, vertexOffsets[rIndex]));
-                            const float g = static_cast<float>(readUInt8(base, vertexOffsets[gIndex]));
-                            const float b = static_cast<float>(readUInt8(base, vertexOffsets[bIndex]));
-                            const float a = aIndex >= 0 ? static_cast<float>(readUInt8(base, vertexOffsets[aIndex])) : 255.0f;
-                            colors.emplace_back(NormalizePLYColorChannel(r),
-                                                NormalizePLYColorChannel(g),
-                                                NormalizePLYColorChannel(b),
-                                                NormalizePLYColorChannel(a));
-                        }
-                        if (hasTexcoords)
+                    const std::byte* const rows = cursor;
+                    const bool verticesValid = Parallel::ParallelReduce(
+                        Parallel::IndexRange{0u, vertexCount}, Parallel::AutoGrain, true,
+                        [&](const Parallel::IndexRange range, const bool valid)
                         {
-                            const glm::vec2 texcoord(
-                                ReadFloatingScalarAt(base, vertexOffsets[texUIndex], vertexElement->Properties[texUIndex].ScalarType, bigEndian),
-                                ReadFloatingScalarAt(base, vertexOffsets[texVIndex], vertexElement->Properties[texVIndex].ScalarType, bigEndian));
-                            if (!IsFinite(texcoord))
+                            for (std::size_t row = range.Begin; row < range.End; ++row)
                             {
-                                return InvalidMeshFormat();
+                                const std::byte* base = rows + row * vertexStride;
+                                const glm::vec3 position(
+                                    ReadFloatingScalarAt(base, vertexOffsets[xIndex], vertexElement->Properties[xIndex].ScalarType, bigEndian),
+                                    ReadFloatingScalarAt(base, vertexOffsets[yIndex], vertexElement->Properties[yIndex].ScalarType, bigEndian),
+                                    ReadFloatingScalarAt(base, vertexOffsets[zIndex], vertexElement->Properties[zIndex].ScalarType, bigEndian));
+                                if (!IsFinite(position))
+                                {
+                                    return false;
+                                }
+                                vertices[row] = position;
+                                if (hasNormals)
+                                {
+                                    const glm::vec3 normal(
+                                        ReadFloatingScalarAt(base, vertexOffsets[nxIndex], vertexElement->Properties[nxIndex].ScalarType, bigEndian),
+                                        ReadFloatingScalarAt(base, vertexOffsets[nyIndex], vertexElement->Properties[nyIndex].ScalarType, bigEndian),
+                                        ReadFloatingScalarAt(base, vertexOffsets[nzIndex], vertexElement->Properties[nzIndex].ScalarType, bigEndian));
+                                    if (!IsFinite(normal))
+                                    {
+                                        return false;
+                                    }
+                                    normals[row] = normal;
+                                }
+                                if (hasColors)
+                                {
+                                    const float r = static_cast<float>(readUInt8(base, vertexOffsets[rIndex]));
+                                    const float g = static_cast<float>(readUInt8(base, vertexOffsets[gIndex]));
+                                    const float b = static_cast<float>(readUInt8(base, vertexOffsets[bIndex]));
+                                    const float a = aIndex >= 0 ? static_cast<float>(readUInt8(base, vertexOffsets[aIndex])) : 255.0f;
+                                    colors[row] = glm::vec4(NormalizePLYColorChannel(r),
+                                                            NormalizePLYColorChannel(g),
+                                                            NormalizePLYColorChannel(b),
+                                                            NormalizePLYColorChannel(a));
+                                }
+                                if (hasTexcoords)
+                                {
+                                    const glm::vec2 texcoord(
+                                        ReadFloatingScalarAt(base, vertexOffsets[texUIndex], vertexElement->Properties[texUIndex].ScalarType, bigEndian),
+                                        ReadFloatingScalarAt(base, vertexOffsets[texVIndex], vertexElement->Properties[texVIndex].ScalarType, bigEndian));
+                                    if (!IsFinite(texcoord))
+                                    {
+                                        return false;
+                                    }
+                                    texcoords[row] = texcoord;
+                                }
                             }
-                            texcoords.push_back(texcoord);
-                        }
+                            return valid;
+                        },
+                        allValid);
+                    if (!verticesValid)
+                    {
+                        return InvalidMeshFormat();
                     }
                     cursor += total;
                 }
                 else if (&element == faceElement)
                 {
+                    const PlyScalar indexType = element.Properties[static_cast<std::size_t>(faceListIndex)].ScalarType;
+                    std::vector<const std::byte*> listStarts;
+                    listStarts.reserve(element.Count);
+                    faces.Offsets.reserve(element.Count + 1u);
                     for (std::size_t row = 0; row < element.Count; ++row)
                     {
-                        std::vector<std::uint32_t> face;
                         for (std::size_t i = 0; i < element.Properties.size(); ++i)
                         {
                             const auto& prop = element.Properties[i];
@@ -1108,31 +1271,41 @@ namespace Geometry::MeshIO
                                 {
                                     return InvalidMeshFormat();
                                 }
-                                face.reserve(static_cast<std::size_t>(*count));
-                                for (std::uint64_t j = 0; j < *count; ++j)
+                                listStarts.push_back(cursor);
+                                faces.Offsets.push_back(faces.Offsets.back() + static_cast<std::size_t>(*count));
+                            }
+                            cursor += totalBytes;
+                        }
+                    }
+
+                    faces.Corners.resize(faces.Offsets.back());
+                    const bool facesValid = Parallel::ParallelReduce(
+                        Parallel::IndexRange{0u, listStarts.size()}, Parallel::AutoGrain, true,
+                        [&](const Parallel::IndexRange range, const bool valid)
+                        {
+                            for (std::size_t face = range.Begin; face < range.End; ++face)
+                            {
+                                const std::byte* indexCursor = listStarts[face];
+                                for (std::size_t corner = faces.Offsets[face]; corner < faces.Offsets[face + 1u]; ++corner)
                                 {
-                                    const auto idx = ReadScalarAs<std::uint64_t>(cursor, prop.ScalarType, bigEndian);
-                                    if (idx >= vertexElement->Count)
+                                    const auto idx = ReadScalarAs<std::uint64_t>(indexCursor, indexType, bigEndian);
+                                    if (idx >= vertexCount)
                                     {
-                                        return InvalidMeshFormat();
+                                        return false;
                                     }
-                                    face.push_back(static_cast<std::uint32_t>(idx));
+                                    faces.Corners[corner] = static_cast<std::uint32_t>(idx);
+                                }
+                                if (HasDuplicateFaceIndices(faces.Face(face)))
+                                {
+                                    return false;
                                 }
                             }
-                            else
-                            {
-                                cursor += totalBytes;
-                            }
-                        }
-                        if (face.empty())
-                        {
-                            return InvalidMeshFormat();
-                        }
-                        if (HasDuplicateFaceIndices(face))
-                        {
-                            return InvalidMeshFormat();
-                        }
-                        faces.push_back(std::move(face));
+                            return valid;
+                        },
+                        allValid);
+                    if (!facesValid)
+                    {
+                        return InvalidMeshFormat();
                     }
                 }
                 else
@@ -1177,11 +1350,7 @@ namespace Geometry::MeshIO
             PopulateResult(result, vertices, faces, normals, colors);
             if (hasTexcoords && texcoords.size() == vertices.size())
             {
-                auto texcoordProperty = result.Vertices.GetOrAdd<glm::vec2>("v:texcoord", glm::vec2(0.0f));
-                for (std::size_t i = 0; i < texcoords.size(); ++i)
-                {
-                    texcoordProperty[i] = texcoords[i];
-                }
+                PopulateVertexTexcoords(result, texcoords);
             }
             return result;
         }
@@ -1220,127 +1389,62 @@ namespace Geometry::MeshIO
             return data.size() >= 84;
         }
 
-        [[nodiscard]] Extrinsic::Core::Expected<MeshIOResult> ParseBinarySTL(std::span<const std::byte> data,
-                                                                  std::string_view absolute_path)
+        // OBJ chunks are parsed in two passes. The first counts the v, vt and
+        // vn statements of each chunk; their running totals give every chunk
+        // the element counts in force at its first line, so the second pass
+        // resolves negative indices and rejects forward references exactly as
+        // a single serial pass does.
+        struct OBJElementCounts
         {
-            if (data.size() < 84)
-            {
-                return InvalidMeshFormat();
-            }
-
-            std::uint32_t triCount = 0;
-            std::memcpy(&triCount, data.data() + 80, sizeof(std::uint32_t));
-            if (triCount == 0)
-            {
-                return InvalidMeshFormat();
-            }
-
-            const std::size_t expectedSize =
-                std::size_t{84} + static_cast<std::size_t>(triCount) * std::size_t{50};
-            if (data.size() < expectedSize)
-            {
-                return InvalidMeshFormat();
-            }
-
-            std::vector<glm::vec3> vertices;
-            vertices.reserve(static_cast<std::size_t>(triCount) * 3);
-            std::vector<std::vector<std::uint32_t>> faces;
-            faces.reserve(triCount);
-
-            const std::byte* base = data.data() + 84;
-            for (std::uint32_t t = 0; t < triCount; ++t)
-            {
-                const std::byte* record = base + static_cast<std::size_t>(t) * 50;
-                glm::vec3 triangle[3];
-                for (int v = 0; v < 3; ++v)
-                {
-                    float x = 0.0f;
-                    float y = 0.0f;
-                    float z = 0.0f;
-                    const std::byte* vertexPtr = record + 12 + v * 12;
-                    std::memcpy(&x, vertexPtr + 0, sizeof(float));
-                    std::memcpy(&y, vertexPtr + 4, sizeof(float));
-                    std::memcpy(&z, vertexPtr + 8, sizeof(float));
-                    triangle[v] = glm::vec3(x, y, z);
-                    if (!IsFinite(triangle[v]))
-                    {
-                        return InvalidMeshFormat();
-                    }
-                }
-                if (SamePosition(triangle[0], triangle[1]) || SamePosition(triangle[0], triangle[2]) ||
-                    SamePosition(triangle[1], triangle[2]))
-                {
-                    return InvalidMeshFormat();
-                }
-                const auto baseIndex = static_cast<std::uint32_t>(vertices.size());
-                vertices.push_back(triangle[0]);
-                vertices.push_back(triangle[1]);
-                vertices.push_back(triangle[2]);
-                faces.push_back({baseIndex, baseIndex + 1u, baseIndex + 2u});
-            }
+            std::size_t Vertices = 0;
+            std::size_t Texcoords = 0;
+            std::size_t Normals = 0;
+        };
 
-            MeshIOResult result;
-            const auto pathInfo = MakePathInfo(absolute_path);
-            result.SourcePath = pathInfo.SourcePath;
-            result.BasePath = pathInfo.BasePath;
-            PopulateResult(result, vertices, faces);
-            return result;
-        }
-    }
+        struct OBJChunk
+        {
+            std::string_view Text;
+            OBJElementCounts Counts; // Statements in this chunk.
+            OBJElementCounts Before; // Statements in all earlier chunks.
+            std::vector<glm::vec3> Vertices;
+            std::vector<glm::vec3> Normals;
+            std::vector<glm::vec2> Texcoords;
+            std::vector<glm::vec4> Colors;
+            std::vector<std::size_t> FaceSizes;
+            std::vector<OBJFaceVertex> FaceCorners;
+            bool HasFaceNormals = false;
+            bool HasFaceTexcoords = false;
+            bool Failed = false;
+        };
 
-    Extrinsic::Core::Expected<MeshIOResult> LoadOBJ(std::string_view absolute_path)
-    {
-        auto text = ReadTextFile(absolute_path);
-        if (!text)
+        // Trimmed line without its comment.
+        [[nodiscard]] std::string_view StripOBJComment(std::string_view line)
         {
-            return Extrinsic::Core::Err<MeshIOResult>(ToCoreError(text.error()));
+            const std::size_t comment = line.find('#');
+            return comment == std::string_view::npos ? line : Trim(line.substr(0, comment));
         }
 
-        std::vector<glm::vec3> vertices;
-        std::vector<glm::vec3> normals;
-        std::vector<glm::vec2> texcoords;
-        std::vector<glm::vec4> colors;
-        std::vector<std::vector<OBJFaceVertex>> faceVertices;
-        bool hasFaceNormals = false;
-        bool hasFaceTexcoords = false;
-        std::size_t cursor = 0;
-        std::string_view line;
-        while (NextLine(*text, cursor, line))
+        [[nodiscard]] bool ParseOBJStatement(std::span<const std::string_view> tokens, OBJChunk& chunk)
         {
-            const std::size_t comment = line.find('#');
-            if (comment != std::string_view::npos)
-            {
-                line = Trim(line.substr(0, comment));
-            }
-            if (line.empty())
-            {
-                continue;
-            }
-
-            const auto tokens = SplitWhitespace(line);
-            if (tokens.empty())
-            {
-                continue;
-            }
             if (tokens[0] == "v")
             {
                 if (tokens.size() < 4)
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
                 const auto x = ParseNumber<float>(tokens[1]);
                 const auto y = ParseNumber<float>(tokens[2]);
                 const auto z = ParseNumber<float>(tokens[3]);
                 if (!x || !y || !z)
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
                 const glm::vec3 position(*x, *y, *z);
                 if (!IsFinite(position))
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
-                vertices.push_back(position);
+                chunk.Vertices.push_back(position);
                 if (tokens.size() == 7)
                 {
                     const auto r = ParseNumber<float>(tokens[4]);
@@ -1348,14 +1452,14 @@ namespace Geometry::MeshIO
                     const auto b = ParseNumber<float>(tokens[6]);
                     if (!r || !g || !b)
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
                     const glm::vec4 color(*r, *g, *b, 1.0f);
                     if (!IsFinite(color))
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
-                    colors.push_back(color);
+                    chunk.Colors.push_back(color);
                 }
                 else if (tokens.size() == 8)
                 {
@@ -1365,89 +1469,344 @@ namespace Geometry::MeshIO
                     const auto a = ParseNumber<float>(tokens[7]);
                     if (!r || !g || !b || !a)
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
                     const glm::vec4 color(*r, *g, *b, *a);
                     if (!IsFinite(color))
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
-                    colors.push_back(color);
+                    chunk.Colors.push_back(color);
                 }
             }
             else if (tokens[0] == "vn")
             {
                 if (tokens.size() < 4)
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
                 const auto x = ParseNumber<float>(tokens[1]);
                 const auto y = ParseNumber<float>(tokens[2]);
                 const auto z = ParseNumber<float>(tokens[3]);
                 if (!x || !y || !z)
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
                 const glm::vec3 normal(*x, *y, *z);
                 if (!IsFinite(normal))
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
-                normals.push_back(normal);
+                chunk.Normals.push_back(normal);
             }
             else if (tokens[0] == "vt")
             {
                 if (tokens.size() < 3)
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
                 const auto u = ParseNumber<float>(tokens[1]);
                 const auto v = ParseNumber<float>(tokens[2]);
                 if (!u || !v)
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
                 const glm::vec2 texcoord(*u, *v);
                 if (!IsFinite(texcoord))
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
-                texcoords.push_back(texcoord);
+                chunk.Texcoords.push_back(texcoord);
             }
             else if (tokens[0] == "f")
             {
                 if (tokens.size() < 4)
                 {
-                    return InvalidMeshFormat();
+                    return false;
                 }
-                std::vector<OBJFaceVertex> face;
-                face.reserve(tokens.size() - 1);
+                const std::size_t first = chunk.FaceCorners.size();
                 for (std::size_t i = 1; i < tokens.size(); ++i)
                 {
-                    const auto parsed = ParseOBJFaceVertex(tokens[i], vertices.size(), texcoords.size(), normals.size());
+                    const auto parsed = ParseOBJFaceVertex(tokens[i],
+                                                           chunk.Before.Vertices + chunk.Vertices.size(),
+                                                           chunk.Before.Texcoords + chunk.Texcoords.size(),
+                                                           chunk.Before.Normals + chunk.Normals.size());
                     if (!parsed)
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
                     if (parsed->Texcoord >= 0)
                     {
-                        hasFaceTexcoords = true;
+                        chunk.HasFaceTexcoords = true;
+                    }
+                    if (parsed->Normal >= 0)
+                    {
+                        chunk.HasFaceNormals = true;
+                    }
+                    chunk.FaceCorners.push_back(*parsed);
+                }
+                if (HasDuplicateOBJFacePositions(std::span<const OBJFaceVertex>{chunk.FaceCorners}.subspan(first)))
+                {
+                    return false;
+                }
+                chunk.FaceSizes.push_back(tokens.size() - 1);
+            }
+            return true;
+        }
+
+        [[nodiscard]] std::vector<OBJChunk> ParseOBJChunks(std::string_view text, std::size_t chunkBytes)
+        {
+            const std::vector<std::string_view> pieces = SplitLineAlignedChunks(text, chunkBytes);
+            std::vector<OBJChunk> chunks(pieces.size());
+            const Parallel::IndexRange chunkRange{0u, chunks.size()};
+            Parallel::ParallelFor(chunkRange, 1u, [&](const std::size_t c)
+            {
+                OBJChunk& chunk = chunks[c];
+                chunk.Text = pieces[c];
+                ForEachChunkLine(chunk.Text, [&](std::string_view line)
+                {
+                    const std::string_view statement = StripOBJComment(line);
+                    const std::string_view keyword = statement.substr(0, statement.find_first_of(" \t\r"));
+                    chunk.Counts.Vertices += keyword == "v" ? 1u : 0u;
+                    chunk.Counts.Texcoords += keyword == "vt" ? 1u : 0u;
+                    chunk.Counts.Normals += keyword == "vn" ? 1u : 0u;
+                    return true;
+                });
+            });
+
+            OBJElementCounts running;
+            for (OBJChunk& chunk : chunks)
+            {
+                chunk.Before = running;
+                running.Vertices += chunk.Counts.Vertices;
+                running.Texcoords += chunk.Counts.Texcoords;
+                running.Normals += chunk.Counts.Normals;
+            }
+
+            Parallel::ParallelFor(chunkRange, 1u, [&](const std::size_t c)
+            {
+                OBJChunk& chunk = chunks[c];
+                std::vector<std::string_view> tokens;
+                ForEachChunkLine(chunk.Text, [&](std::string_view line)
+                {
+                    const std::string_view statement = StripOBJComment(line);
+                    if (statement.empty())
+                    {
+                        return true;
+                    }
+                    SplitWhitespace(statement, tokens);
+                    if (!tokens.empty() && !ParseOBJStatement(tokens, chunk))
+                    {
+                        chunk.Failed = true;
+                        return false;
+                    }
+                    return true;
+                });
+            });
+            return chunks;
+        }
+
+        // STL is a triangle soup: vertex 3t + k is corner k of triangle t.
+        [[nodiscard]] FlatFaces MakeTriangleSoupFaces(std::size_t triangleCount)
+        {
+            FlatFaces faces;
+            faces.Offsets.resize(triangleCount + 1u);
+            faces.Corners.resize(triangleCount * 3u);
+            Parallel::ParallelFor(Parallel::IndexRange{0u, triangleCount}, Parallel::AutoGrain, [&](const std::size_t t)
+            {
+                faces.Offsets[t + 1u] = 3u * (t + 1u);
+                for (std::size_t k = 0; k < 3u; ++k)
+                {
+                    faces.Corners[3u * t + k] = static_cast<std::uint32_t>(3u * t + k);
+                }
+            });
+            return faces;
+        }
+
+        struct WeldKey
+        {
+            std::array<std::uint32_t, 3> Bits{};
+            std::uint32_t Vertex = 0;
+        };
+
+        [[nodiscard]] std::uint32_t CanonicalFloatBits(float value)
+        {
+            // -0 and +0 compare equal, so they must weld together.
+            return std::bit_cast<std::uint32_t>(value == 0.0f ? 0.0f : value);
+        }
+
+        // Merges bit-identical positions with a parallel stable sort of their
+        // bit patterns rather than a hash map. Equal keys stay in vertex
+        // order, so each run's first vertex survives, and survivors keep
+        // their relative order; for STL that is first use.
+        void WeldVertices(std::vector<glm::vec3>& vertices, FlatFaces& faces)
+        {
+            const std::size_t count = vertices.size();
+            const Parallel::IndexRange vertexRange{0u, count};
+            std::vector<WeldKey> keys(count);
+            Parallel::ParallelFor(vertexRange, Parallel::AutoGrain, [&](const std::size_t v)
+            {
+                const glm::vec3& p = vertices[v];
+                keys[v] = WeldKey{{CanonicalFloatBits(p.x), CanonicalFloatBits(p.y), CanonicalFloatBits(p.z)},
+                                  static_cast<std::uint32_t>(v)};
+            });
+            Parallel::ParallelStableSort(std::span<WeldKey>{keys}, [](const WeldKey& lhs, const WeldKey& rhs)
+            {
+                return lhs.Bits < rhs.Bits;
+            });
+
+            std::vector<std::uint32_t> survivor(count);
+            Parallel::ParallelFor(vertexRange, Parallel::AutoGrain, [&](const Parallel::IndexRange range)
+            {
+                for (std::size_t first = range.Begin; first < range.End; ++first)
+                {
+                    if (first > 0u && keys[first - 1u].Bits == keys[first].Bits)
+                    {
+                        continue;
                     }
-                    if (parsed->Normal >= 0)
+                    for (std::size_t i = first; i < count && keys[i].Bits == keys[first].Bits; ++i)
                     {
-                        hasFaceNormals = true;
+                        survivor[keys[i].Vertex] = keys[first].Vertex;
                     }
-                    face.push_back(*parsed);
                 }
-                if (HasDuplicateOBJFacePositions(face))
+            });
+
+            std::vector<std::uint32_t> newIndex(count);
+            Parallel::ParallelFor(vertexRange, Parallel::AutoGrain, [&](const std::size_t v)
+            {
+                newIndex[v] = survivor[v] == v ? 1u : 0u;
+            });
+            const std::size_t lastSurvives = count == 0u ? 0u : newIndex.back();
+            Parallel::ParallelScan<std::uint32_t>(newIndex, newIndex, 0u, std::plus<>{}, Parallel::ScanKind::Exclusive);
+
+            std::vector<glm::vec3> welded(count == 0u ? 0u : newIndex.back() + lastSurvives);
+            Parallel::ParallelFor(vertexRange, Parallel::AutoGrain, [&](const std::size_t v)
+            {
+                if (survivor[v] == v)
                 {
-                    return InvalidMeshFormat();
+                    welded[newIndex[v]] = vertices[v];
                 }
-                faceVertices.push_back(std::move(face));
+            });
+            Parallel::ParallelFor(Parallel::IndexRange{0u, faces.Corners.size()}, Parallel::AutoGrain,
+                [&](const std::size_t corner)
+                {
+                    faces.Corners[corner] = newIndex[survivor[faces.Corners[corner]]];
+                });
+            vertices = std::move(welded);
+        }
+
+        [[nodiscard]] MeshIOResult MakeSTLResult(std::vector<glm::vec3>& vertices,
+                                                 std::string_view absolute_path,
+                                                 const MeshLoadOptions& options)
+        {
+            FlatFaces faces = MakeTriangleSoupFaces(vertices.size() / 3u);
+            if (options.WeldSTLVertices)
+            {
+                WeldVertices(vertices, faces);
+            }
+
+            MeshIOResult result;
+            const auto pathInfo = MakePathInfo(absolute_path);
+            result.SourcePath = pathInfo.SourcePath;
+            result.BasePath = pathInfo.BasePath;
+            PopulateResult(result, vertices, faces);
+            return result;
+        }
+
+        [[nodiscard]] Extrinsic::Core::Expected<MeshIOResult> ParseBinarySTL(std::span<const std::byte> data,
+                                                                  std::string_view absolute_path,
+                                                                  const MeshLoadOptions& options)
+        {
+            if (data.size() < 84)
+            {
+                return InvalidMeshFormat();
+            }
+
+            std::uint32_t triCount = 0;
+            std::memcpy(&triCount, data.data() + 80, sizeof(std::uint32_t));
+            if (triCount == 0)
+            {
+                return InvalidMeshFormat();
+            }
+
+            const std::size_t expectedSize =
+                std::size_t{84} + static_cast<std::size_t>(triCount) * std::size_t{50};
+            if (data.size() < expectedSize)
+            {
+                return InvalidMeshFormat();
+            }
+
+            std::vector<glm::vec3> vertices(static_cast<std::size_t>(triCount) * 3);
+            const std::byte* base = data.data() + 84;
+            const bool trianglesValid = Parallel::ParallelReduce(
+                Parallel::IndexRange{0u, triCount}, Parallel::AutoGrain, true,
+                [&](const Parallel::IndexRange range, const bool valid)
+                {
+                    for (std::size_t t = range.Begin; t < range.End; ++t)
+                    {
+                        const std::byte* record = base + t * 50;
+                        glm::vec3* triangle = vertices.data() + 3u * t;
+                        for (int v = 0; v < 3; ++v)
+                        {
+                            float x = 0.0f;
+                            float y = 0.0f;
+                            float z = 0.0f;
+                            const std::byte* vertexPtr = record + 12 + v * 12;
+                            std::memcpy(&x, vertexPtr + 0, sizeof(float));
+                            std::memcpy(&y, vertexPtr + 4, sizeof(float));
+                            std::memcpy(&z, vertexPtr + 8, sizeof(float));
+                            triangle[v] = glm::vec3(x, y, z);
+                            if (!IsFinite(triangle[v]))
+                            {
+                                return false;
+                            }
+                        }
+                        if (SamePosition(triangle[0], triangle[1]) || SamePosition(triangle[0], triangle[2]) ||
+                            SamePosition(triangle[1], triangle[2]))
+                        {
+                            return false;
+                        }
+                    }
+                    return valid;
+                },
+                [](const bool lhs, const bool rhs) { return lhs && rhs; });
+            if (!trianglesValid)
+            {
+                return InvalidMeshFormat();
             }
+            return MakeSTLResult(vertices, absolute_path, options);
+        }
+    }
+
+    Extrinsic::Core::Expected<MeshIOResult> LoadOBJ(std::string_view absolute_path, const MeshLoadOptions& options)
+    {
+        auto text = ReadTextFile(absolute_path);
+        if (!text)
+        {
+            return Extrinsic::Core::Err<MeshIOResult>(ToCoreError(text.error()));
+        }
+
+        const std::vector<OBJChunk> chunks = ParseOBJChunks(*text, options.ChunkBytes);
+        if (std::ranges::any_of(chunks, [](const OBJChunk& chunk) { return chunk.Failed; }))
+        {
+            return InvalidMeshFormat();
         }
 
-        if (vertices.empty() || faceVertices.empty())
+        const std::vector<glm::vec3> vertices =
+            GatherChunks<glm::vec3>(chunks, [](const OBJChunk& chunk) -> const auto& { return chunk.Vertices; });
+        const std::vector<glm::vec3> normals =
+            GatherChunks<glm::vec3>(chunks, [](const OBJChunk& chunk) -> const auto& { return chunk.Normals; });
+        const std::vector<glm::vec2> texcoords =
+            GatherChunks<glm::vec2>(chunks, [](const OBJChunk& chunk) -> const auto& { return chunk.Texcoords; });
+        const std::vector<glm::vec4> colors =
+            GatherChunks<glm::vec4>(chunks, [](const OBJChunk& chunk) -> const auto& { return chunk.Colors; });
+        const FlatPolygons<OBJFaceVertex> faceVertices = GatherFaces<OBJFaceVertex>(chunks);
+        const bool hasFaceNormals =
+            std::ranges::any_of(chunks, [](const OBJChunk& chunk) { return chunk.HasFaceNormals; });
+        const bool hasFaceTexcoords =
+            std::ranges::any_of(chunks, [](const OBJChunk& chunk) { return chunk.HasFaceTexcoords; });
+
+        if (vertices.empty() || faceVertices.FaceCount() == 0u)
         {
             return InvalidMeshFormat();
         }
@@ -1467,20 +1826,13 @@ namespace Geometry::MeshIO
             if (hasFaceTexcoords)
             {
                 std::unordered_map<std::uint32_t, int> firstTexcoordForPosition;
-                for (const auto& sourceFace : faceVertices)
+                for (const OBJFaceVertex& sourceVertex : faceVertices.Corners)
                 {
-                    for (const OBJFaceVertex& sourceVertex : sourceFace)
-                    {
-                        const auto [it, inserted] = firstTexcoordForPosition.try_emplace(
-                            sourceVertex.Position, sourceVertex.Texcoord);
-                        if (!inserted && it->second != sourceVertex.Texcoord)
-                        {
-                            hasTexcoordSeam = true;
-                            break;
-                        }
-                    }
-                    if (hasTexcoordSeam)
+                    const auto [it, inserted] = firstTexcoordForPosition.try_emplace(
+                        sourceVertex.Position, sourceVertex.Texcoord);
+                    if (!inserted && it->second != sourceVertex.Texcoord)
                     {
+                        hasTexcoordSeam = true;
                         break;
                     }
                 }
@@ -1495,21 +1847,11 @@ namespace Geometry::MeshIO
                 hasFaceNormals && normals.size() == vertices.size();
             if (hasLockstepFaceNormals)
             {
-                for (const auto& sourceFace : faceVertices)
+                hasLockstepFaceNormals = std::ranges::all_of(faceVertices.Corners, [](const OBJFaceVertex& sourceVertex)
                 {
-                    for (const OBJFaceVertex& sourceVertex : sourceFace)
-                    {
-                        if (sourceVertex.Normal < 0 ||
-                            static_cast<std::uint32_t>(sourceVertex.Normal) !=
-                                sourceVertex.Position)
-                        {
-                            hasLockstepFaceNormals = false;
-                            break;
-                        }
-                    }
-                    if (!hasLockstepFaceNormals)
-                        break;
-                }
+                    return sourceVertex.Normal >= 0 &&
+                           static_cast<std::uint32_t>(sourceVertex.Normal) == sourceVertex.Position;
+                });
             }
 
             const bool hasLockstepColors = colors.size() == vertices.size();
@@ -1519,10 +1861,11 @@ namespace Geometry::MeshIO
             std::vector<glm::vec2> cornerTexcoords;
             std::vector<glm::vec3> cornerNormals;
             std::vector<glm::vec4> remappedColors;
-            std::vector<std::vector<std::uint32_t>> remappedFaces;
+            FlatFaces remappedFaces;
             std::unordered_map<OBJFaceVertexKey, std::uint32_t, OBJFaceVertexKeyHash> remap;
 
-            remappedFaces.reserve(faceVertices.size());
+            remappedFaces.Offsets = faceVertices.Offsets;
+            remappedFaces.Corners.reserve(faceVertices.Corners.size());
             if (hasFaceTexcoords)
             {
                 remappedTexcoords.reserve(vertices.size());
@@ -1536,53 +1879,49 @@ namespace Geometry::MeshIO
                 remappedColors.reserve(vertices.size());
             }
 
-            for (const auto& sourceFace : faceVertices)
+            // First-use numbering makes this pass order-dependent, so it
+            // stays serial.
+            for (const OBJFaceVertex& sourceVertex : faceVertices.Corners)
             {
-                std::vector<std::uint32_t> face;
-                face.reserve(sourceFace.size());
-                for (const OBJFaceVertex& sourceVertex : sourceFace)
+                const glm::vec2 uv = sourceVertex.Texcoord >= 0
+                    ? texcoords[static_cast<std::size_t>(sourceVertex.Texcoord)]
+                    : glm::vec2(0.0f);
+                if (hasFaceTexcoords)
+                {
+                    cornerTexcoords.push_back(uv);
+                }
+                if (hasFaceNormals && !hasLockstepFaceNormals)
+                {
+                    cornerNormals.push_back(
+                        sourceVertex.Normal >= 0
+                            ? normals[static_cast<std::size_t>(sourceVertex.Normal)]
+                            : glm::vec3(0.0f, 1.0f, 0.0f));
+                }
+
+                const OBJFaceVertexKey key{
+                    sourceVertex.Position,
+                    (hasFaceTexcoords && !hasTexcoordSeam) ? sourceVertex.Texcoord : -1,
+                };
+                auto [it, inserted] = remap.try_emplace(key, static_cast<std::uint32_t>(remappedVertices.size()));
+                if (inserted)
                 {
-                    const glm::vec2 uv = sourceVertex.Texcoord >= 0
-                        ? texcoords[static_cast<std::size_t>(sourceVertex.Texcoord)]
-                        : glm::vec2(0.0f);
+                    remappedVertices.push_back(vertices[sourceVertex.Position]);
                     if (hasFaceTexcoords)
                     {
-                        cornerTexcoords.push_back(uv);
+                        remappedTexcoords.push_back(uv);
                     }
-                    if (hasFaceNormals && !hasLockstepFaceNormals)
+                    if (hasLockstepFaceNormals)
                     {
-                        cornerNormals.push_back(
-                            sourceVertex.Normal >= 0
-                                ? normals[static_cast<std::size_t>(sourceVertex.Normal)]
-                                : glm::vec3(0.0f, 1.0f, 0.0f));
+                        remappedNormals.push_back(
+                            normals[static_cast<std::size_t>(
+                                sourceVertex.Normal)]);
                     }
-
-                    const OBJFaceVertexKey key{
-                        sourceVertex.Position,
-                        (hasFaceTexcoords && !hasTexcoordSeam) ? sourceVertex.Texcoord : -1,
-                    };
-                    auto [it, inserted] = remap.try_emplace(key, static_cast<std::uint32_t>(remappedVertices.size()));
-                    if (inserted)
+                    if (hasLockstepColors)
                     {
-                        remappedVertices.push_back(vertices[sourceVertex.Position]);
-                        if (hasFaceTexcoords)
-                        {
-                            remappedTexcoords.push_back(uv);
-                        }
-                        if (hasLockstepFaceNormals)
-                        {
-                            remappedNormals.push_back(
-                                normals[static_cast<std::size_t>(
-                                    sourceVertex.Normal)]);
-                        }
-                        if (hasLockstepColors)
-                        {
-                            remappedColors.push_back(colors[static_cast<std::size_t>(sourceVertex.Position)]);
-                        }
+                        remappedColors.push_back(colors[static_cast<std::size_t>(sourceVertex.Position)]);
                     }
-                    face.push_back(it->second);
                 }
-                remappedFaces.push_back(std::move(face));
+                remappedFaces.Corners.push_back(it->second);
             }
 
             PopulateResult(result,
@@ -1605,28 +1944,19 @@ namespace Geometry::MeshIO
             }
             else if (hasFaceTexcoords && remappedTexcoords.size() == remappedVertices.size())
             {
-                auto texcoordProperty =
-                    result.Vertices.GetOrAdd<glm::vec2>("v:texcoord", glm::vec2(0.0f));
-                for (std::size_t i = 0; i < remappedTexcoords.size(); ++i)
-                {
-                    texcoordProperty[i] = remappedTexcoords[i];
-                }
+                PopulateVertexTexcoords(result, remappedTexcoords);
             }
             return result;
         }
 
-        std::vector<std::vector<std::uint32_t>> faces;
-        faces.reserve(faceVertices.size());
-        for (const auto& sourceFace : faceVertices)
-        {
-            std::vector<std::uint32_t> face;
-            face.reserve(sourceFace.size());
-            for (const OBJFaceVertex& sourceVertex : sourceFace)
+        FlatFaces faces;
+        faces.Offsets = faceVertices.Offsets;
+        faces.Corners.resize(faceVertices.Corners.size());
+        Parallel::ParallelFor(Parallel::IndexRange{0u, faces.Corners.size()}, Parallel::AutoGrain,
+            [&](const std::size_t corner)
             {
-                face.push_back(sourceVertex.Position);
-            }
-            faces.push_back(std::move(face));
-        }
+                faces.Corners[corner] = faceVertices.Corners[corner].Position;
+            });
 
         const std::span<const glm::vec3> normalsSpan =
             normals.size() == vertices.size() ? std::span<const glm::vec3>(normals) : std::span<const glm::vec3>{};
@@ -1635,17 +1965,12 @@ namespace Geometry::MeshIO
         PopulateResult(result, vertices, faces, normalsSpan, colorsSpan);
         if (texcoords.size() == vertices.size())
         {
-            auto texcoordProperty =
-                result.Vertices.GetOrAdd<glm::vec2>("v:texcoord", glm::vec2(0.0f));
-            for (std::size_t i = 0; i < texcoords.size(); ++i)
-            {
-                texcoordProperty[i] = texcoords[i];
-            }
+            PopulateVertexTexcoords(result, texcoords);
         }
         return result;
     }
 
-    Extrinsic::Core::Expected<MeshIOResult> LoadOFF(std::string_view absolute_path)
+    Extrinsic::Core::Expected<MeshIOResult> LoadOFF(std::string_view absolute_path, const MeshLoadOptions& options)
     {
         auto text = ReadTextFile(absolute_path);
         if (!text)
@@ -1698,47 +2023,33 @@ namespace Geometry::MeshIO
             return InvalidMeshFormat();
         }
 
-        std::vector<glm::vec3> vertices;
-        vertices.reserve(vertexReserve);
-        std::vector<glm::vec3> normals;
-        if (hasNormals)
-        {
-            normals.reserve(vertexReserve);
-        }
-        std::vector<glm::vec4> colors;
-        if (hasColors)
-        {
-            colors.reserve(vertexReserve);
-        }
-        for (std::size_t i = 0; i < *vertexCount; ++i)
+        // Blank and comment lines are not rows.
+        const auto isRow = [](std::string_view candidate) { return !candidate.empty() && candidate.front() != '#'; };
+        const auto parseRow = [&](const std::size_t row,
+                                  std::span<const std::string_view> tokens,
+                                  TextRowChunk& chunk)
         {
-            if (!NextLine(*text, cursor, line))
-            {
-                return InvalidMeshFormat();
-            }
-            if (line.empty() || line.front() == '#')
+            if (row >= *vertexCount)
             {
-                --i;
-                continue;
+                return ParseFaceRow(tokens, *vertexCount, chunk);
             }
-            const auto tokens = SplitWhitespace(line);
             if (tokens.size() < 3)
             {
-                return InvalidMeshFormat();
+                return false;
             }
             const auto x = ParseNumber<float>(tokens[0]);
             const auto y = ParseNumber<float>(tokens[1]);
             const auto z = ParseNumber<float>(tokens[2]);
             if (!x || !y || !z)
             {
-                return InvalidMeshFormat();
+                return false;
             }
             const glm::vec3 position(*x, *y, *z);
             if (!IsFinite(position))
             {
-                return InvalidMeshFormat();
+                return false;
             }
-            vertices.push_back(position);
+            chunk.Vertices.push_back(position);
 
             std::size_t tokenIdx = 3;
 
@@ -1755,11 +2066,11 @@ namespace Geometry::MeshIO
                         normal = glm::vec3(*nx, *ny, *nz);
                         if (!IsFinite(normal))
                         {
-                            return InvalidMeshFormat();
+                            return false;
                         }
                     }
                 }
-                normals.push_back(normal);
+                chunk.Normals.push_back(normal);
                 tokenIdx += 3;
             }
 
@@ -1776,73 +2087,33 @@ namespace Geometry::MeshIO
                         const glm::vec3 rawColor(*r, *g, *b);
                         if (!IsFinite(rawColor))
                         {
-                            return InvalidMeshFormat();
+                            return false;
                         }
                         color = glm::vec4(NormalizeOFFColorChannel(rawColor.r),
                                           NormalizeOFFColorChannel(rawColor.g),
                                           NormalizeOFFColorChannel(rawColor.b),
                                           1.0f);
                     }
-                    tokenIdx += 3;
-                    if (tokenIdx < tokens.size())
-                    {
-                        (void)ParseNumber<float>(tokens[tokenIdx]);
-                    }
-                }
-                colors.push_back(color);
-            }
-        }
-
-        std::vector<std::vector<std::uint32_t>> faces;
-        faces.reserve(faceReserve);
-        for (std::size_t i = 0; i < *faceCount; ++i)
-        {
-            if (!NextLine(*text, cursor, line))
-            {
-                return InvalidMeshFormat();
-            }
-            if (line.empty() || line.front() == '#')
-            {
-                --i;
-                continue;
-            }
-            const auto tokens = SplitWhitespace(line);
-            if (tokens.empty())
-            {
-                return InvalidMeshFormat();
-            }
-            const auto count = ParseNumber<std::size_t>(tokens[0]);
-            if (!count || *count < 3)
-            {
-                return InvalidMeshFormat();
-            }
-            if (*count > tokens.size() - 1)
-            {
-                return InvalidMeshFormat();
-            }
-            std::vector<std::uint32_t> face;
-            face.reserve(*count);
-            for (std::size_t j = 0; j < *count; ++j)
-            {
-                const auto index = ParseNumber<std::size_t>(tokens[j + 1]);
-                if (!index || *index >= vertices.size())
-                {
-                    return InvalidMeshFormat();
                 }
-                face.push_back(static_cast<std::uint32_t>(*index));
+                chunk.Colors.push_back(color);
             }
-                if (HasDuplicateFaceIndices(face))
-                {
-                    return InvalidMeshFormat();
-                }
-            faces.push_back(std::move(face));
-        }
+            return true;
+        };
 
-        if (faces.empty())
+        std::vector<TextRowChunk> chunks = MakeTextRowChunks(std::string_view{*text}.substr(cursor), options.ChunkBytes);
+        if (!ParseTextRows(chunks, *vertexCount + *faceCount, isRow, parseRow))
         {
             return InvalidMeshFormat();
         }
 
+        const std::vector<glm::vec3> vertices =
+            GatherChunks<glm::vec3>(chunks, [](const TextRowChunk& chunk) -> const auto& { return chunk.Vertices; });
+        const std::vector<glm::vec3> normals =
+            GatherChunks<glm::vec3>(chunks, [](const TextRowChunk& chunk) -> const auto& { return chunk.Normals; });
+        const std::vector<glm::vec4> colors =
+            GatherChunks<glm::vec4>(chunks, [](const TextRowChunk& chunk) -> const auto& { return chunk.Colors; });
+        const FlatFaces faces = GatherFaces<std::uint32_t>(chunks);
+
         MeshIOResult result;
         const auto pathInfo = MakePathInfo(absolute_path);
         result.SourcePath = pathInfo.SourcePath;
@@ -1851,7 +2122,7 @@ namespace Geometry::MeshIO
         return result;
     }
 
-    Extrinsic::Core::Expected<MeshIOResult> LoadPLY(std::string_view absolute_path)
+    Extrinsic::Core::Expected<MeshIOResult> LoadPLY(std::string_view absolute_path, const MeshLoadOptions& options)
     {
         auto text = ReadTextFile(absolute_path);
         if (!text)
@@ -1976,7 +2247,7 @@ namespace Geometry::MeshIO
 
         if (format == PlyFormat::Ascii)
         {
-            return ParseAsciiPLY(*text, cursor, elements, absolute_path);
+            return ParseAsciiPLY(*text, cursor, elements, absolute_path, options);
         }
 
         const std::span<const std::byte> body(
@@ -1985,7 +2256,7 @@ namespace Geometry::MeshIO
         return ParseBinaryPLY(body, elements, format == PlyFormat::BinaryBigEndian, absolute_path);
     }
 
-    Extrinsic::Core::Expected<MeshIOResult> LoadSTL(std::string_view absolute_path)
+    Extrinsic::Core::Expected<MeshIOResult> LoadSTL(std::string_view absolute_path, const MeshLoadOptions& options)
     {
         auto text = ReadTextFile(absolute_path);
         if (!text)
@@ -1997,58 +2268,71 @@ namespace Geometry::MeshIO
             reinterpret_cast<const std::byte*>(text->data()), text->size());
         if (IsBinarySTL(bytes))
         {
-            return ParseBinarySTL(bytes, absolute_path);
+            return ParseBinarySTL(bytes, absolute_path, options);
         }
 
-        std::vector<glm::vec3> vertices;
-        std::vector<std::vector<std::uint32_t>> faces;
-        std::vector<std::uint32_t> currentFace;
-        currentFace.reserve(3);
-
-        std::size_t cursor = 0;
-        std::string_view line;
-        while (NextLine(*text, cursor, line))
+        // Only `vertex x y z` lines carry data; every three of them form a
+        // triangle, whichever chunk they land in.
+        std::vector<TextRowChunk> chunks = MakeTextRowChunks(*text, options.ChunkBytes);
+        Parallel::ParallelFor(Parallel::IndexRange{0u, chunks.size()}, 1u, [&](const std::size_t c)
         {
-            const auto tokens = SplitWhitespace(line);
-            if (tokens.size() == 4 && tokens[0] == "vertex")
+            TextRowChunk& chunk = chunks[c];
+            std::vector<std::string_view> tokens;
+            ForEachChunkLine(chunk.Text, [&](std::string_view line)
             {
+                SplitWhitespace(line, tokens);
+                if (tokens.size() != 4 || tokens[0] != "vertex")
+                {
+                    return true;
+                }
                 const auto x = ParseNumber<float>(tokens[1]);
                 const auto y = ParseNumber<float>(tokens[2]);
                 const auto z = ParseNumber<float>(tokens[3]);
-                if (!x || !y || !z)
-                {
-                    return InvalidMeshFormat();
-                }
-                const glm::vec3 position(*x, *y, *z);
-                if (!IsFinite(position))
+                const glm::vec3 position(x.value_or(0.0f), y.value_or(0.0f), z.value_or(0.0f));
+                if (!x || !y || !z || !IsFinite(position))
                 {
-                    return InvalidMeshFormat();
+                    chunk.Failed = true;
+                    return false;
                 }
-                vertices.push_back(position);
-                currentFace.push_back(static_cast<std::uint32_t>(vertices.size() - 1));
-                if (currentFace.size() == 3)
+                chunk.Vertices.push_back(position);
+                return true;
+            });
+        });
+        if (std::ranges::any_of(chunks, [](const TextRowChunk& chunk) { return chunk.Failed; }))
+        {
+            return InvalidMeshFormat();
+        }
+
+        std::vector<glm::vec3> vertices =
+            GatherChunks<glm::vec3>(chunks, [](const TextRowChunk& chunk) -> const auto& { return chunk.Vertices; });
+        if (vertices.empty() || vertices.size() % 3u != 0u)
+        {
+            return InvalidMeshFormat();
+        }
+        const bool trianglesValid = Parallel::ParallelReduce(
+            Parallel::IndexRange{0u, vertices.size() / 3u}, Parallel::AutoGrain, true,
+            [&](const Parallel::IndexRange range, const bool valid)
+            {
+                for (std::size_t t = range.Begin; t < range.End; ++t)
                 {
-                    if (FaceHasDuplicatePositions(vertices, currentFace))
+                    const std::array<std::uint32_t, 3> triangle{
+                        static_cast<std::uint32_t>(3u * t),
+                        static_cast<std::uint32_t>(3u * t + 1u),
+                        static_cast<std::uint32_t>(3u * t + 2u),
+                    };
+                    if (FaceHasDuplicatePositions(vertices, triangle))
                     {
-                        return InvalidMeshFormat();
+                        return false;
                     }
-                    faces.push_back(currentFace);
-                    currentFace.clear();
                 }
-            }
-        }
-
-        if (vertices.empty() || faces.empty() || !currentFace.empty())
+                return valid;
+            },
+            [](const bool lhs, const bool rhs) { return lhs && rhs; });
+        if (!trianglesValid)
         {
             return InvalidMeshFormat();
         }
-
-        MeshIOResult result;
-        const auto pathInfo = MakePathInfo(absolute_path);
-        result.SourcePath = pathInfo.SourcePath;
-        result.BasePath = pathInfo.BasePath;
-        PopulateResult(result, vertices, faces);
-        return result;
+        return MakeSTLResult(vertices, absolute_path, options);
     }
 
     MeshIOWriteStatus WriteOBJ(std::string_view absolute_path, const MeshIOResult& mesh)
@@ -3068,4 +3352,133 @@ namespace Geometry::MeshIO
         }
         return MeshIOWriteStatus::Success;
     }
+
+    namespace
+    {
+        void AppendLE32(std::vector<char>& out, std::uint32_t bits)
+        {
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                out.push_back(static_cast<char>((bits >> shift) & 0xFFu));
+            }
+        }
+    }
+
+    MeshIOWriteStatus PLYBinaryStreamWriter::Open(std::string_view absolute_path,
+                                                  std::size_t vertexCount,
+                                                  std::size_t triangleCount)
+    {
+        if (absolute_path.empty() || m_Stream.is_open())
+        {
+            return MeshIOWriteStatus::InvalidPath;
+        }
+        if (vertexCount == 0 || triangleCount == 0
+            || vertexCount > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+        {
+            return MeshIOWriteStatus::EmptyMesh;
+        }
+
+        m_Stream.open(std::string(absolute_path), std::ios::binary | std::ios::trunc);
+        if (!m_Stream)
+        {
+            return MeshIOWriteStatus::InvalidPath;
+        }
+        m_VertexCount = vertexCount;
+        m_TriangleCount = triangleCount;
+        m_VerticesWritten = 0;
+        m_TrianglesWritten = 0;
+
+        char headerBuffer[192];
+        m_Stream << "ply\n";
+        m_Stream << "format binary_little_endian 1.0\n";
+        m_Stream << "comment Exported by IntrinsicEngine\n";
+        int written = std::snprintf(headerBuffer, sizeof(headerBuffer), "element vertex %zu\n", vertexCount);
+        if (written <= 0)
+        {
+            return MeshIOWriteStatus::FileWriteError;
+        }
+        m_Stream.write(headerBuffer, written);
+        m_Stream << "property float x\n";
+        m_Stream << "property float y\n";
+        m_Stream << "property float z\n";
+        written = std::snprintf(headerBuffer, sizeof(headerBuffer), "element face %zu\n", triangleCount);
+        if (written <= 0)
+        {
+            return MeshIOWriteStatus::FileWriteError;
+        }
+        m_Stream.write(headerBuffer, written);
+        m_Stream << "property list uchar int vertex_indices\n";
+        m_Stream << "end_header\n";
+        return m_Stream.good() ? MeshIOWriteStatus::Success : MeshIOWriteStatus::FileWriteError;
+    }
+
+    MeshIOWriteStatus PLYBinaryStreamWriter::WriteVertices(std::span<const glm::vec3> positions)
+    {
+        if (!m_Stream.is_open() || m_TrianglesWritten != 0
+            || positions.size() > m_VertexCount - m_VerticesWritten)
+        {
+            return MeshIOWriteStatus::FileWriteError;
+        }
+
+        std::vector<char> bytes;
+        bytes.reserve(positions.size() * 12u);
+        for (const glm::vec3& p : positions)
+        {
+            if (!IsFinite(p))
+            {
+                return MeshIOWriteStatus::FileWriteError;
+            }
+            AppendLE32(bytes, std::bit_cast<std::uint32_t>(p.x));
+            AppendLE32(bytes, std::bit_cast<std::uint32_t>(p.y));
+            AppendLE32(bytes, std::bit_cast<std::uint32_t>(p.z));
+        }
+        m_Stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        m_VerticesWritten += positions.size();
+        return m_Stream.good() ? MeshIOWriteStatus::Success : MeshIOWriteStatus::FileWriteError;
+    }
+
+    MeshIOWriteStatus PLYBinaryStreamWriter::WriteTriangles(std::span<const std::array<std::uint32_t, 3>> triangles)
+    {
+        if (!m_Stream.is_open() || m_VerticesWritten != m_VertexCount
+            || triangles.size() > m_TriangleCount - m_TrianglesWritten)
+        {
+            return MeshIOWriteStatus::FileWriteError;
+        }
+
+        std::vector<char> bytes;
+        bytes.reserve(triangles.size() * 13u);
+        for (const auto& triangle : triangles)
+        {
+            if (HasDuplicateFaceIndices(triangle))
+            {
+                return MeshIOWriteStatus::InvalidFace;
+            }
+            bytes.push_back(static_cast<char>(3));
+            for (const std::uint32_t index : triangle)
+            {
+                if (static_cast<std::size_t>(index) >= m_VertexCount)
+                {
+                    return MeshIOWriteStatus::InvalidFace;
+                }
+                AppendLE32(bytes, index);
+            }
+        }
+        m_Stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        m_TrianglesWritten += triangles.size();
+        return m_Stream.good() ? MeshIOWriteStatus::Success : MeshIOWriteStatus::FileWriteError;
+    }
+
+    MeshIOWriteStatus PLYBinaryStreamWriter::Close()
+    {
+        if (!m_Stream.is_open())
+        {
+            return MeshIOWriteStatus::FileWriteError;
+        }
+        m_Stream.flush();
+        const bool complete = m_Stream.good()
+            && m_VerticesWritten == m_VertexCount
+            && m_TrianglesWritten == m_TriangleCount;
+        m_Stream.close();
+        return complete ? MeshIOWriteStatus::Success : MeshIOWriteStatus::FileWriteError;
+    }
 }
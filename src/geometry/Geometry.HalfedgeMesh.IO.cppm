@@ -1,8 +1,15 @@
 module;
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <span>
 #include <string_view>
 #include <string>
 
+#include <glm/glm.hpp>
+
 export module Geometry.HalfedgeMesh.IO;
 
 import Geometry.Properties;
@@ -24,10 +31,23 @@ export namespace Geometry::MeshIO
         std::string BasePath;              // Directory containing the file (for relative refs)
     };
 
-    Extrinsic::Core::Expected<MeshIOResult> LoadOBJ(std::string_view absolute_path);
-    Extrinsic::Core::Expected<MeshIOResult> LoadOFF(std::string_view absolute_path);
-    Extrinsic::Core::Expected<MeshIOResult> LoadPLY(std::string_view absolute_path);
-    Extrinsic::Core::Expected<MeshIOResult> LoadSTL(std::string_view absolute_path);
+    // Text bodies are cut into newline-aligned chunks that are parsed on the
+    // task scheduler, and binary records are decoded in parallel ranges;
+    // vertices, faces and corners keep their file order either way.
+    struct MeshLoadOptions
+    {
+        // Target chunk size; each chunk runs on to the end of its last line.
+        std::size_t ChunkBytes{std::size_t{8} << 20u};
+        // STL stores three positions per triangle. When set, bit-identical
+        // positions (-0 and +0 alike) become one vertex, numbered by first
+        // use; otherwise every triangle keeps its own three vertices.
+        bool WeldSTLVertices{false};
+    };
+
+    Extrinsic::Core::Expected<MeshIOResult> LoadOBJ(std::string_view absolute_path, const MeshLoadOptions& options = {});
+    Extrinsic::Core::Expected<MeshIOResult> LoadOFF(std::string_view absolute_path, const MeshLoadOptions& options = {});
+    Extrinsic::Core::Expected<MeshIOResult> LoadPLY(std::string_view absolute_path, const MeshLoadOptions& options = {});
+    Extrinsic::Core::Expected<MeshIOResult> LoadSTL(std::string_view absolute_path, const MeshLoadOptions& options = {});
     // and other missing formats for meshes only. Complete models or scenes will be handled differently?
 
     enum class MeshIOWriteStatus
@@ -45,4 +65,30 @@ export namespace Geometry::MeshIO
     MeshIOWriteStatus WritePLYBinary(std::string_view absolute_path, const MeshIOResult& mesh);
     MeshIOWriteStatus WriteSTL(std::string_view absolute_path, const MeshIOResult& mesh);
     MeshIOWriteStatus WriteSTLBinary(std::string_view absolute_path, const MeshIOResult& mesh);
+
+    // Incremental binary little-endian PLY writer for positions and
+    // triangles, for meshes that are never resident as one MeshIOResult.
+    // The element counts are declared up front; all vertices must be written
+    // before the first triangle, and Close() fails unless exactly the
+    // declared counts were written. The output is laid out exactly like
+    // WritePLYBinary with positions only.
+    class PLYBinaryStreamWriter
+    {
+    public:
+        [[nodiscard]] MeshIOWriteStatus Open(std::string_view absolute_path,
+                                             std::size_t vertexCount,
+                                             std::size_t triangleCount);
+        [[nodiscard]] MeshIOWriteStatus WriteVertices(std::span<const glm::vec3> positions);
+        [[nodiscard]] MeshIOWriteStatus WriteTriangles(std::span<const std::array<std::uint32_t, 3>> triangles);
+        [[nodiscard]] MeshIOWriteStatus Close();
+
+        [[nodiscard]] bool IsOpen() const noexcept { return m_Stream.is_open(); }
+
+    private:
+        std::ofstream m_Stream{};
+        std::size_t m_VertexCount{0};
+        std::size_t m_TriangleCount{0};
+        std::size_t m_VerticesWritten{0};
+        std::size_t m_TrianglesWritten{0};
+    };
 }
@@ -0,0 +1,1048 @@
+module;
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+module Geometry.Simplification.Streaming;
+
+import Geometry.HalfedgeMesh;
+import Geometry.HalfedgeMesh.IO;
+import Geometry.Properties;
+import Extrinsic.Core.Error;
+import Extrinsic.Core.IOBackend;
+
+namespace Geometry::Simplification
+{
+    namespace
+    {
+        namespace IO = Extrinsic::Core::IO;
+        using Extrinsic::Core::ErrorCode;
+        using Extrinsic::Core::Expected;
+
+        constexpr std::size_t kHeaderProbeBytes = std::size_t{64} << 10u;
+        constexpr std::size_t kVertexPageRecords = 8192;
+        constexpr std::size_t kPlyTriangleRecordBytes = 13; // uchar count + 3 x int32
+        constexpr std::uint32_t kMaxGridCellsPerAxis = 1024;
+        constexpr std::uint32_t kMaxSplitDepth = 12;
+        constexpr std::uint32_t kNoSeam = std::numeric_limits<std::uint32_t>::max();
+        constexpr const char* kSeamProperty = "v:streaming_seam";
+
+        // Resident bytes per triangle while a chunk is simplified: the
+        // halfedge mesh, per-face normals, quadrics, cones and candidates.
+        // Deliberately generous so the budget holds for every option set.
+        constexpr std::size_t kBytesPerResidentTriangle = 1024;
+        constexpr std::size_t kBytesPerSeamEntry = 32;
+
+        // Triangle as carried through the chunk spills. Positions travel with
+        // the triangle so chunk processing never reads the input again.
+        struct TriangleRecord
+        {
+            std::array<std::uint32_t, 3> Indices{};
+            std::array<glm::vec3, 3> Positions{};
+        };
+        static_assert(std::is_trivially_copyable_v<TriangleRecord>);
+
+        // Vertex of a simplified chunk; Seam is the input index of a locked
+        // seam vertex, or kNoSeam.
+        struct ChunkVertexRecord
+        {
+            std::uint32_t Seam{kNoSeam};
+            glm::vec3 Position{0.0f};
+        };
+        static_assert(std::is_trivially_copyable_v<ChunkVertexRecord>);
+
+        struct PlyLayout
+        {
+            std::size_t VertexCount{0};
+            std::size_t FaceCount{0};
+            std::size_t VertexStride{0};
+            std::array<std::size_t, 3> CoordinateOffsets{};
+            std::size_t VertexDataOffset{0};
+            std::size_t FaceDataOffset{0};
+        };
+
+        struct Chunk
+        {
+            glm::dvec3 Min{0.0};
+            glm::dvec3 Max{0.0};
+            std::vector<std::byte> Pending{};
+            std::vector<std::string> Spills{};
+            std::size_t TriangleCount{0};
+            std::uint32_t Depth{0};
+            bool Split{false};
+        };
+
+        [[nodiscard]] std::uint32_t LoadLE32(const std::byte* bytes) noexcept
+        {
+            return static_cast<std::uint32_t>(bytes[0])
+                | (static_cast<std::uint32_t>(bytes[1]) << 8u)
+                | (static_cast<std::uint32_t>(bytes[2]) << 16u)
+                | (static_cast<std::uint32_t>(bytes[3]) << 24u);
+        }
+
+        [[nodiscard]] bool IsFinite(const glm::vec3& p) noexcept
+        {
+            return std::isfinite(p.x) && std::isfinite(p.y) && std::isfinite(p.z);
+        }
+
+        template <typename T>
+        void AppendRaw(std::vector<std::byte>& out, const T& value)
+        {
+            const std::size_t offset = out.size();
+            out.resize(offset + sizeof(T));
+            std::memcpy(out.data() + offset, &value, sizeof(T));
+        }
+
+        template <typename T>
+        [[nodiscard]] T LoadRaw(const std::byte* bytes) noexcept
+        {
+            T value{};
+            std::memcpy(&value, bytes, sizeof(T));
+            return value;
+        }
+
+        [[nodiscard]] std::size_t PlyScalarBytes(std::string_view type) noexcept
+        {
+            if (type == "char" || type == "int8" || type == "uchar" || type == "uint8")
+                return 1;
+            if (type == "short" || type == "int16" || type == "ushort" || type == "uint16")
+                return 2;
+            if (type == "int" || type == "int32" || type == "uint" || type == "uint32"
+                || type == "float" || type == "float32")
+                return 4;
+            if (type == "double" || type == "float64")
+                return 8;
+            return 0;
+        }
+
+        [[nodiscard]] std::vector<std::string_view> SplitTokens(std::string_view line)
+        {
+            std::vector<std::string_view> tokens;
+            std::size_t i = 0;
+            while (i < line.size())
+            {
+                while (i < line.size() && (line[i] == ' ' || line[i] == '\t' || line[i] == '\r'))
+                    ++i;
+                const std::size_t begin = i;
+                while (i < line.size() && line[i] != ' ' && line[i] != '\t' && line[i] != '\r')
+                    ++i;
+                if (i > begin)
+                    tokens.push_back(line.substr(begin, i - begin));
+            }
+            return tokens;
+        }
+
+        [[nodiscard]] std::optional<std::size_t> ParseCount(std::string_view token) noexcept
+        {
+            if (token.empty())
+                return std::nullopt;
+            std::size_t value = 0;
+            for (const char c : token)
+            {
+                if (c < '0' || c > '9')
+                    return std::nullopt;
+                const auto digit = static_cast<std::size_t>(c - '0');
+                if (value > (std::numeric_limits<std::size_t>::max() - digit) / 10u)
+                    return std::nullopt;
+                value = value * 10u + digit;
+            }
+            return value;
+        }
+
+        [[nodiscard]] Expected<IO::IOReadResult> ReadRange(IO::IIOBackend& backend, const std::string& path,
+                                                           std::size_t offset, std::size_t size)
+        {
+            // Size 0 means "to the end of the file" for the backend, so an
+            // empty range is answered here.
+            if (size == 0)
+                return IO::IOReadResult{};
+            auto read = backend.Read(IO::IORequest{.Path = path, .Offset = offset, .Size = size});
+            if (!read.has_value())
+                return Extrinsic::Core::Err<IO::IOReadResult>(ErrorCode::InvalidFormat);
+            if (read->Bytes().size() != size)
+                return Extrinsic::Core::Err<IO::IOReadResult>(ErrorCode::InvalidFormat);
+            return read;
+        }
+
+        [[nodiscard]] Expected<PlyLayout> ReadPlyLayout(IO::IIOBackend& backend, const std::string& path)
+        {
+            // Probe a bounded prefix; a file shorter than the probe is read whole.
+            auto read = backend.Read(IO::IORequest{.Path = path, .Offset = 0, .Size = kHeaderProbeBytes});
+            if (!read.has_value())
+                read = backend.Read(IO::IORequest{.Path = path});
+            if (!read.has_value())
+                return Extrinsic::Core::Err<PlyLayout>(read.error());
+
+            const std::span<const std::byte> bytes = read->Bytes();
+            const std::string_view text(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+            constexpr std::string_view kEndHeader = "end_header";
+            const std::size_t endHeader = text.find(kEndHeader);
+            if (!text.starts_with("ply") || endHeader == std::string_view::npos)
+                return Extrinsic::Core::Err<PlyLayout>(ErrorCode::InvalidFormat);
+            const std::size_t newline = text.find('\n', endHeader);
+            if (newline == std::string_view::npos)
+                return Extrinsic::Core::Err<PlyLayout>(ErrorCode::InvalidFormat);
+
+            PlyLayout layout{};
+            std::array<bool, 3> hasCoordinate{};
+            enum class Section { None, Vertex, Face } section = Section::None;
+            bool sawFormat = false;
+            bool sawFaceList = false;
+
+            std::size_t lineBegin = 0;
+            while (lineBegin < endHeader)
+            {
+                std::size_t lineEnd = text.find('\n', lineBegin);
+                if (lineEnd == std::string_view::npos || lineEnd > endHeader)
+                    lineEnd = endHeader;
+                const std::vector<std::string_view> tokens = SplitTokens(text.substr(lineBegin, lineEnd - lineBegin));
+                lineBegin = lineEnd + 1;
+                if (tokens.empty() || tokens[0] == "ply" || tokens[0] == "comment" || tokens[0] == "obj_info")
+                    continue;
+
+                if (tokens[0] == "format")
+                {
+                    if (tokens.size() < 2 || tokens[1] != "binary_little_endian")
+                        return Extrinsic::Core::Err<PlyLayout>(ErrorCode::UnsupportedFormat);
+                    sawFormat = true;
+                }
+                else if (tokens[0] == "element")
+                {
+                    if (tokens.size() != 3)
+                        return Extrinsic::Core::Err<PlyLayout>(ErrorCode::InvalidFormat);
+                    const auto count = ParseCount(tokens[2]);
+                    if (!count)
+                        return Extrinsic::Core::Err<PlyLayout>(ErrorCode::InvalidFormat);
+                    if (tokens[1] == "vertex" && section == Section::None)
+                    {
+                        section = Section::Vertex;
+                        layout.VertexCount = *count;
+                    }
+                    else if (tokens[1] == "face" && section == Section::Vertex)
+                    {
+                        section = Section::Face;
+                        layout.FaceCount = *count;
+                    }
+                    else
+                    {
+                        return Extrinsic::Core::Err<PlyLayout>(ErrorCode::UnsupportedFormat);
+                    }
+                }
+                else if (tokens[0] == "property")
+                {
+                    if (section == Section::Vertex)
+                    {
+                        if (tokens.size() != 3)
+                            return Extrinsic::Core::Err<PlyLayout>(ErrorCode::UnsupportedFormat);
+                        const std::size_t scalarBytes = PlyScalarBytes(tokens[1]);
+                        if (scalarBytes == 0)
+                            return Extrinsic::Core::Err<PlyLayout>(ErrorCode::InvalidFormat);
+                        constexpr std::array<std::string_view, 3> kAxes{"x", "y", "z"};
+                        for (std::size_t axis = 0; axis < 3; ++axis)
+                        {
+                            if (tokens[2] == kAxes[axis])
+                            {
+                                if (tokens[1] != "float" && tokens[1] != "float32")
+                                    return Extrinsic::Core::Err<PlyLayout>(ErrorCode::UnsupportedFormat);
+                                layout.CoordinateOffsets[axis] = layout.VertexStride;
+                                hasCoordinate[axis] = true;
+                            }
+                        }
+                        layout.VertexStride += scalarBytes;
+                    }
+                    else if (section == Section::Face)
+                    {
+                        if (sawFaceList || tokens.size() != 5 || tokens[1] != "list"
+                            || PlyScalarBytes(tokens[2]) != 1
+                            || (tokens[3] != "int" && tokens[3] != "int32"
+                                && tokens[3] != "uint" && tokens[3] != "uint32"))
+                        {
+                            return Extrinsic::Core::Err<PlyLayout>(ErrorCode::UnsupportedFormat);
+                        }
+                        sawFaceList = true;
+                    }
+                    else
+                    {
+                        return Extrinsic::Core::Err<PlyLayout>(ErrorCode::InvalidFormat);
+                    }
+                }
+                else
+                {
+                    return Extrinsic::Core::Err<PlyLayout>(ErrorCode::InvalidFormat);
+                }
+            }
+
+            if (!sawFormat || !sawFaceList || !hasCoordinate[0] || !hasCoordinate[1] || !hasCoordinate[2])
+                return Extrinsic::Core::Err<PlyLayout>(ErrorCode::UnsupportedFormat);
+            if (layout.VertexCount == 0 || layout.FaceCount == 0
+                || layout.VertexCount > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+            {
+                return Extrinsic::Core::Err<PlyLayout>(ErrorCode::InvalidFormat);
+            }
+            if (layout.VertexCount > (std::numeric_limits<std::size_t>::max() - newline) / layout.VertexStride
+                || layout.FaceCount > std::numeric_limits<std::size_t>::max() / kPlyTriangleRecordBytes)
+            {
+                return Extrinsic::Core::Err<PlyLayout>(ErrorCode::InvalidFormat);
+            }
+
+            layout.VertexDataOffset = newline + 1;
+            layout.FaceDataOffset = layout.VertexDataOffset + layout.VertexCount * layout.VertexStride;
+            return layout;
+        }
+
+        [[nodiscard]] glm::vec3 DecodePosition(const std::byte* record, const PlyLayout& layout) noexcept
+        {
+            return glm::vec3{
+                std::bit_cast<float>(LoadLE32(record + layout.CoordinateOffsets[0])),
+                std::bit_cast<float>(LoadLE32(record + layout.CoordinateOffsets[1])),
+                std::bit_cast<float>(LoadLE32(record + layout.CoordinateOffsets[2]))};
+        }
+
+        // Least-recently-used cache of decoded vertex pages, so triangles can
+        // look up arbitrary vertices with ranged reads of bounded size.
+        class VertexPageCache
+        {
+        public:
+            VertexPageCache(IO::IIOBackend& backend, const std::string& path, const PlyLayout& layout,
+                            std::size_t capacityPages)
+                : m_Backend(backend), m_Path(path), m_Layout(layout),
+                  m_Capacity(std::max<std::size_t>(capacityPages, 1u))
+            {
+            }
+
+            [[nodiscard]] Expected<glm::vec3> Fetch(std::uint32_t index)
+            {
+                const std::size_t pageIndex = index / kVertexPageRecords;
+                const std::size_t slot = m_Slots.contains(pageIndex) ? m_Slots[pageIndex] : kNoSlot;
+                if (slot != kNoSlot)
+                {
+                    m_Pages[slot].LastUse = ++m_Clock;
+                    return m_Pages[slot].Positions[index - pageIndex * kVertexPageRecords];
+                }
+
+                auto loaded = Load(pageIndex);
+                if (!loaded.has_value())
+                    return Extrinsic::Core::Err<glm::vec3>(loaded.error());
+                return m_Pages[*loaded].Positions[index - pageIndex * kVertexPageRecords];
+            }
+
+            [[nodiscard]] std::size_t ResidentBytes() const noexcept
+            {
+                return m_Pages.size() * kVertexPageRecords * sizeof(glm::vec3);
+            }
+
+        private:
+            static constexpr std::size_t kNoSlot = std::numeric_limits<std::size_t>::max();
+
+            struct Page
+            {
+                std::size_t PageIndex{0};
+                std::uint64_t LastUse{0};
+                std::vector<glm::vec3> Positions{};
+            };
+
+            [[nodiscard]] Expected<std::size_t> Load(std::size_t pageIndex)
+            {
+                const std::size_t first = pageIndex * kVertexPageRecords;
+                const std::size_t count = std::min(kVertexPageRecords, m_Layout.VertexCount - first);
+                auto read = ReadRange(m_Backend, m_Path, m_Layout.VertexDataOffset + first * m_Layout.VertexStride,
+                                      count * m_Layout.VertexStride);
+                if (!read.has_value())
+                    return Extrinsic::Core::Err<std::size_t>(read.error());
+
+                std::size_t slot = m_Pages.size();
+                if (m_Pages.size() < m_Capacity)
+                {
+                    m_Pages.emplace_back();
+                }
+                else
+                {
+                    slot = 0;
+                    for (std::size_t i = 1; i < m_Pages.size(); ++i)
+                    {
+                        if (m_Pages[i].LastUse < m_Pages[slot].LastUse)
+                            slot = i;
+                    }
+                    m_Slots.erase(m_Pages[slot].PageIndex);
+                }
+
+                Page& page = m_Pages[slot];
+                page.PageIndex = pageIndex;
+                page.LastUse = ++m_Clock;
+                page.Positions.resize(count);
+                const std::byte* bytes = read->Bytes().data();
+                for (std::size_t i = 0; i < count; ++i)
+                    page.Positions[i] = DecodePosition(bytes + i * m_Layout.VertexStride, m_Layout);
+                m_Slots[pageIndex] = slot;
+                return slot;
+            }
+
+            IO::IIOBackend& m_Backend;
+            const std::string& m_Path;
+            const PlyLayout& m_Layout;
+            std::size_t m_Capacity{1};
+            std::vector<Page> m_Pages{};
+            std::unordered_map<std::size_t, std::size_t> m_Slots{};
+            std::uint64_t m_Clock{0};
+        };
+
+        // Owns the chunk list and keeps the in-memory chunk buffers under
+        // their budget by spilling the largest ones through the backend.
+        class ChunkSpiller
+        {
+        public:
+            ChunkSpiller(IO::IIOBackend& backend, std::string directory, std::size_t pendingCapacity,
+                         StreamingResult& stats, std::vector<std::string>& spillPaths)
+                : m_Backend(backend), m_Directory(std::move(directory)),
+                  m_PendingCapacity(std::max<std::size_t>(pendingCapacity, sizeof(TriangleRecord))),
+                  m_Stats(stats), m_SpillPaths(spillPaths)
+            {
+            }
+
+            [[nodiscard]] Extrinsic::Core::Result Append(std::vector<Chunk>& chunks, std::size_t chunk,
+                                                         const TriangleRecord& record)
+            {
+                AppendRaw(chunks[chunk].Pending, record);
+                ++chunks[chunk].TriangleCount;
+                m_PendingBytes += sizeof(TriangleRecord);
+                if (m_PendingBytes <= m_PendingCapacity)
+                    return Extrinsic::Core::Ok();
+
+                // Spill the largest buffers until half the capacity is free,
+                // so each spill event writes at least that much.
+                std::vector<std::size_t> order;
+                for (std::size_t i = 0; i < chunks.size(); ++i)
+                {
+                    if (!chunks[i].Pending.empty())
+                        order.push_back(i);
+                }
+                std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b)
+                {
+                    if (chunks[a].Pending.size() != chunks[b].Pending.size())
+                        return chunks[a].Pending.size() > chunks[b].Pending.size();
+                    return a < b;
+                });
+                for (const std::size_t i : order)
+                {
+                    if (m_PendingBytes <= m_PendingCapacity / 2u)
+                        break;
+                    if (auto flushed = Flush(chunks[i]); !flushed.has_value())
+                        return flushed;
+                }
+                return Extrinsic::Core::Ok();
+            }
+
+            [[nodiscard]] Extrinsic::Core::Result Flush(Chunk& chunk)
+            {
+                if (chunk.Pending.empty())
+                    return Extrinsic::Core::Ok();
+                std::string path = m_Directory + "/spill_" + std::to_string(m_SpillPaths.size()) + ".bin";
+                if (!m_Backend.Write(IO::IORequest{.Path = path}, chunk.Pending).has_value())
+                    return Extrinsic::Core::Err<Extrinsic::Core::Unit>(ErrorCode::FileWriteError);
+
+                ++m_Stats.SpillFileCount;
+                m_Stats.SpillBytesWritten += chunk.Pending.size();
+                m_PendingBytes -= chunk.Pending.size();
+                std::vector<std::byte>().swap(chunk.Pending);
+                chunk.Spills.push_back(path);
+                m_SpillPaths.push_back(std::move(path));
+                return Extrinsic::Core::Ok();
+            }
+
+            // Takes a chunk's in-memory triangles out of the spiller's
+            // accounting and hands them to the caller.
+            [[nodiscard]] std::vector<std::byte> Release(Chunk& chunk) noexcept
+            {
+                m_PendingBytes -= chunk.Pending.size();
+                return std::exchange(chunk.Pending, {});
+            }
+
+            [[nodiscard]] std::size_t PendingBytes() const noexcept { return m_PendingBytes; }
+
+        private:
+            IO::IIOBackend& m_Backend;
+            std::string m_Directory;
+            std::size_t m_PendingCapacity{0};
+            std::size_t m_PendingBytes{0};
+            StreamingResult& m_Stats;
+            std::vector<std::string>& m_SpillPaths;
+        };
+
+        // Calls fn(record) for every triangle of the chunk: spills first, in
+        // write order, then the in-memory remainder.
+        template <typename Fn>
+        [[nodiscard]] Extrinsic::Core::Result ForEachTriangle(IO::IIOBackend& backend, const Chunk& chunk, Fn&& fn)
+        {
+            auto visit = [&](std::span<const std::byte> bytes)
+            {
+                for (std::size_t offset = 0; offset + sizeof(TriangleRecord) <= bytes.size();
+                     offset += sizeof(TriangleRecord))
+                {
+                    fn(LoadRaw<TriangleRecord>(bytes.data() + offset));
+                }
+            };
+            for (const std::string& spill : chunk.Spills)
+            {
+                auto read = backend.Read(IO::IORequest{.Path = spill});
+                if (!read.has_value() || read->Bytes().size() % sizeof(TriangleRecord) != 0)
+                    return Extrinsic::Core::Err<Extrinsic::Core::Unit>(ErrorCode::FileReadError);
+                visit(read->Bytes());
+            }
+            visit(chunk.Pending);
+            return Extrinsic::Core::Ok();
+        }
+
+        [[nodiscard]] glm::dvec3 Centroid(const TriangleRecord& record) noexcept
+        {
+            return (glm::dvec3(record.Positions[0]) + glm::dvec3(record.Positions[1])
+                    + glm::dvec3(record.Positions[2])) / 3.0;
+        }
+
+        // Distance from p to the outside of the box; negative when p lies
+        // outside it.
+        [[nodiscard]] double InteriorDistance(const glm::dvec3& p, const Chunk& chunk) noexcept
+        {
+            double d = std::numeric_limits<double>::max();
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                d = std::min(d, p[axis] - chunk.Min[axis]);
+                d = std::min(d, chunk.Max[axis] - p[axis]);
+            }
+            return d;
+        }
+
+        struct ChunkOutput
+        {
+            std::vector<ChunkVertexRecord> Vertices{};
+            std::vector<std::array<std::uint32_t, 3>> Triangles{};
+        };
+
+        [[nodiscard]] std::vector<std::byte> EncodeChunkOutput(const ChunkOutput& output)
+        {
+            std::vector<std::byte> bytes;
+            bytes.reserve(8u + output.Vertices.size() * sizeof(ChunkVertexRecord)
+                          + output.Triangles.size() * sizeof(std::array<std::uint32_t, 3>));
+            AppendRaw(bytes, static_cast<std::uint32_t>(output.Vertices.size()));
+            AppendRaw(bytes, static_cast<std::uint32_t>(output.Triangles.size()));
+            for (const ChunkVertexRecord& vertex : output.Vertices)
+                AppendRaw(bytes, vertex);
+            for (const auto& triangle : output.Triangles)
+                AppendRaw(bytes, triangle);
+            return bytes;
+        }
+
+        [[nodiscard]] std::optional<ChunkOutput> DecodeChunkOutput(std::span<const std::byte> bytes)
+        {
+            if (bytes.size() < 8u)
+                return std::nullopt;
+            const auto vertexCount = LoadRaw<std::uint32_t>(bytes.data());
+            const auto triangleCount = LoadRaw<std::uint32_t>(bytes.data() + 4u);
+            const std::size_t vertexBytes = std::size_t{vertexCount} * sizeof(ChunkVertexRecord);
+            const std::size_t triangleBytes = std::size_t{triangleCount} * sizeof(std::array<std::uint32_t, 3>);
+            if (bytes.size() != 8u + vertexBytes + triangleBytes)
+                return std::nullopt;
+
+            ChunkOutput output;
+            output.Vertices.resize(vertexCount);
+            output.Triangles.resize(triangleCount);
+            if (vertexBytes != 0)
+                std::memcpy(output.Vertices.data(), bytes.data() + 8u, vertexBytes);
+            if (triangleBytes != 0)
+                std::memcpy(output.Triangles.data(), bytes.data() + 8u + vertexBytes, triangleBytes);
+            return output;
+        }
+
+        [[nodiscard]] ErrorCode ToErrorCode(MeshIO::MeshIOWriteStatus status) noexcept
+        {
+            return status == MeshIO::MeshIOWriteStatus::InvalidPath ? ErrorCode::InvalidPath : ErrorCode::FileWriteError;
+        }
+    }
+
+    Extrinsic::Core::Expected<StreamingResult> SimplifyStreaming(
+        std::string_view inputPath,
+        std::string_view outputPath,
+        Extrinsic::Core::IO::IIOBackend& backend,
+        const StreamingParams& params)
+    {
+        using Extrinsic::Core::Err;
+
+        if (inputPath.empty() || outputPath.empty() || params.SpillDirectory.empty()
+            || params.MemoryBudgetBytes < kMinimumStreamingBudgetBytes
+            || !(params.TargetRatio > 0.0) || params.TargetRatio > 1.0)
+        {
+            return Err<StreamingResult>(ErrorCode::InvalidArgument);
+        }
+
+        const std::string input(inputPath);
+        auto layoutRead = ReadPlyLayout(backend, input);
+        if (!layoutRead.has_value())
+            return Err<StreamingResult>(layoutRead.error());
+        const PlyLayout layout = *layoutRead;
+
+        // Budget split: half for the chunk being simplified, a quarter for
+        // chunk buffers, an eighth each for the vertex page cache and the
+        // streamed input batches.
+        const std::size_t budget = params.MemoryBudgetBytes;
+        const std::size_t chunkTriangleLimit = std::max<std::size_t>(budget / 2u / kBytesPerResidentTriangle, 1u);
+        const std::size_t pendingCapacity = budget / 4u;
+        const std::size_t cachePages = budget / 8u / (kVertexPageRecords * sizeof(glm::vec3));
+        const std::size_t batchBytes = budget / 8u;
+
+        StreamingResult result;
+        result.InputVertexCount = layout.VertexCount;
+        result.InputTriangleCount = layout.FaceCount;
+
+        std::vector<std::string> spillPaths;
+        auto removeSpills = [&]()
+        {
+            if (!params.RemoveSpillFiles)
+                return;
+            std::error_code ec;
+            for (const std::string& path : spillPaths)
+                std::filesystem::remove(path, ec);
+        };
+        auto fail = [&](ErrorCode code)
+        {
+            removeSpills();
+            return Err<StreamingResult>(code);
+        };
+        auto noteResident = [&](std::size_t bytes)
+        {
+            result.PeakResidentBytesEstimate = std::max(result.PeakResidentBytesEstimate, bytes);
+        };
+
+        // -----------------------------------------------------------------
+        // Pass 1: bounds of the vertex section
+        // -----------------------------------------------------------------
+
+        glm::dvec3 boundsMin{std::numeric_limits<double>::max()};
+        glm::dvec3 boundsMax{std::numeric_limits<double>::lowest()};
+        {
+            const std::size_t batchVertices = std::max<std::size_t>(batchBytes / layout.VertexStride, 1u);
+            for (std::size_t first = 0; first < layout.VertexCount; first += batchVertices)
+            {
+                const std::size_t count = std::min(batchVertices, layout.VertexCount - first);
+                auto read = ReadRange(backend, input, layout.VertexDataOffset + first * layout.VertexStride,
+                                      count * layout.VertexStride);
+                if (!read.has_value())
+                    return fail(read.error());
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const glm::vec3 p = DecodePosition(read->Bytes().data() + i * layout.VertexStride, layout);
+                    if (!IsFinite(p))
+                        return fail(ErrorCode::InvalidFormat);
+                    boundsMin = glm::min(boundsMin, glm::dvec3(p));
+                    boundsMax = glm::max(boundsMax, glm::dvec3(p));
+                }
+                noteResident(count * layout.VertexStride);
+            }
+        }
+
+        // -----------------------------------------------------------------
+        // Pass 2: bin triangles into grid chunks by centroid
+        //
+        // Surfaces occupy roughly (cells per axis)^2 cells, so the grid is
+        // sized from the square root of the chunk count the budget needs.
+        // -----------------------------------------------------------------
+
+        const glm::dvec3 extent = boundsMax - boundsMin;
+        const double maxExtent = std::max({extent.x, extent.y, extent.z, 1e-12});
+        const auto cellsPerAxis = static_cast<std::uint32_t>(std::clamp<double>(
+            std::ceil(std::sqrt(static_cast<double>(layout.FaceCount) / static_cast<double>(chunkTriangleLimit))),
+            1.0, static_cast<double>(kMaxGridCellsPerAxis)));
+        const double cellSize = maxExtent / static_cast<double>(cellsPerAxis);
+        glm::uvec3 gridCells{1u};
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            gridCells[axis] = static_cast<std::uint32_t>(std::clamp<double>(
+                std::ceil(extent[axis] / cellSize), 1.0, static_cast<double>(kMaxGridCellsPerAxis)));
+        }
+
+        std::vector<Chunk> chunks;
+        std::unordered_map<std::uint64_t, std::size_t> chunkOfCell;
+        ChunkSpiller spiller(backend, params.SpillDirectory, pendingCapacity, result, spillPaths);
+        double maxEdgeLength2 = 0.0;
+        {
+            VertexPageCache cache(backend, input, layout, cachePages);
+            const std::size_t batchTriangles = std::max<std::size_t>(batchBytes / kPlyTriangleRecordBytes, 1u);
+            for (std::size_t first = 0; first < layout.FaceCount; first += batchTriangles)
+            {
+                const std::size_t count = std::min(batchTriangles, layout.FaceCount - first);
+                auto read = ReadRange(backend, input, layout.FaceDataOffset + first * kPlyTriangleRecordBytes,
+                                      count * kPlyTriangleRecordBytes);
+                if (!read.has_value())
+                    return fail(read.error());
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const std::byte* bytes = read->Bytes().data() + i * kPlyTriangleRecordBytes;
+                    if (static_cast<std::uint8_t>(bytes[0]) != 3u)
+                        return fail(ErrorCode::UnsupportedFormat);
+
+                    TriangleRecord record{};
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        record.Indices[k] = LoadLE32(bytes + 1u + 4u * k);
+                        if (record.Indices[k] >= layout.VertexCount)
+                            return fail(ErrorCode::InvalidFormat);
+                    }
+                    if (record.Indices[0] == record.Indices[1] || record.Indices[1] == record.Indices[2]
+                        || record.Indices[0] == record.Indices[2])
+                    {
+                        ++result.DroppedDegenerateTriangleCount;
+                        continue;
+                    }
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        auto position = cache.Fetch(record.Indices[k]);
+                        if (!position.has_value())
+                            return fail(position.error());
+                        record.Positions[k] = *position;
+                    }
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        const glm::dvec3 edge = glm::dvec3(record.Positions[k]) - glm::dvec3(record.Positions[(k + 1) % 3]);
+                        maxEdgeLength2 = std::max(maxEdgeLength2, glm::dot(edge, edge));
+                    }
+
+                    const glm::dvec3 centroid = Centroid(record);
+                    glm::uvec3 cell{0u};
+                    for (int axis = 0; axis < 3; ++axis)
+                    {
+                        const double coordinate = std::floor((centroid[axis] - boundsMin[axis]) / cellSize);
+                        cell[axis] = static_cast<std::uint32_t>(
+                            std::clamp(coordinate, 0.0, static_cast<double>(gridCells[axis] - 1u)));
+                    }
+                    const std::uint64_t key = (std::uint64_t{cell.x} << 40u) | (std::uint64_t{cell.y} << 20u) | cell.z;
+                    auto [it, inserted] = chunkOfCell.try_emplace(key, chunks.size());
+                    if (inserted)
+                    {
+                        Chunk& chunk = chunks.emplace_back();
+                        chunk.Min = boundsMin + glm::dvec3(cell) * cellSize;
+                        chunk.Max = chunk.Min + glm::dvec3(cellSize);
+                    }
+                    if (auto appended = spiller.Append(chunks, it->second, record); !appended.has_value())
+                        return fail(appended.error());
+                }
+                noteResident(count * kPlyTriangleRecordBytes + cache.ResidentBytes() + spiller.PendingBytes()
+                             + chunks.size() * sizeof(Chunk));
+            }
+        }
+        chunkOfCell = {};
+
+        // Any triangle of another chunk that shares a vertex has its centroid
+        // outside this chunk's cell and within two thirds of the longest edge
+        // of that vertex; the slack absorbs rounding in the binning.
+        const double seamMargin = (2.0 / 3.0) * std::sqrt(maxEdgeLength2) * (1.0 + 1e-6) + 1e-9 * maxExtent;
+
+        // -----------------------------------------------------------------
+        // Pass 3: split chunks that exceed the budget into octants
+        // -----------------------------------------------------------------
+
+        for (std::size_t c = 0; c < chunks.size(); ++c)
+        {
+            if (chunks[c].TriangleCount <= chunkTriangleLimit || chunks[c].Depth >= kMaxSplitDepth)
+                continue;
+
+            Chunk parent;
+            parent.Min = chunks[c].Min;
+            parent.Max = chunks[c].Max;
+            parent.Depth = chunks[c].Depth;
+            parent.Spills = std::move(chunks[c].Spills);
+            parent.Pending = spiller.Release(chunks[c]);
+            chunks[c].Split = true;
+            chunks[c].TriangleCount = 0;
+            ++result.SplitChunkCount;
+
+            const glm::dvec3 mid = 0.5 * (parent.Min + parent.Max);
+            const std::size_t firstChild = chunks.size();
+            for (std::uint32_t octant = 0; octant < 8u; ++octant)
+            {
+                Chunk& child = chunks.emplace_back();
+                child.Depth = parent.Depth + 1u;
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    const bool upper = ((octant >> axis) & 1u) != 0u;
+                    child.Min[axis] = upper ? mid[axis] : parent.Min[axis];
+                    child.Max[axis] = upper ? parent.Max[axis] : mid[axis];
+                }
+            }
+
+            Extrinsic::Core::Result appended = Extrinsic::Core::Ok();
+            auto streamed = ForEachTriangle(backend, parent, [&](const TriangleRecord& record)
+            {
+                if (!appended.has_value())
+                    return;
+                const glm::dvec3 centroid = Centroid(record);
+                std::uint32_t octant = 0;
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    if (centroid[axis] >= mid[axis])
+                        octant |= 1u << axis;
+                }
+                appended = spiller.Append(chunks, firstChild + octant, record);
+            });
+            if (!streamed.has_value())
+                return fail(streamed.error());
+            if (!appended.has_value())
+                return fail(appended.error());
+            if (params.RemoveSpillFiles)
+            {
+                std::error_code ec;
+                for (const std::string& spill : parent.Spills)
+                    std::filesystem::remove(spill, ec);
+            }
+            noteResident(parent.Pending.size() + spiller.PendingBytes()
+                         + chunks.size() * sizeof(Chunk));
+        }
+
+        // -----------------------------------------------------------------
+        // Pass 4: simplify each leaf chunk with its seam vertices locked
+        // -----------------------------------------------------------------
+
+        Params chunkParams = params.Chunk;
+        chunkParams.LockedVertexProperty = kSeamProperty;
+
+        std::vector<std::string> chunkOutputs;
+        for (std::size_t c = 0; c < chunks.size(); ++c)
+        {
+            Chunk& chunk = chunks[c];
+            if (chunk.Split || chunk.TriangleCount == 0)
+                continue;
+            ++result.ChunkCount;
+
+            HalfedgeMesh::Mesh mesh;
+            auto seam = mesh.VertexProperties().GetOrAdd<std::uint8_t>(kSeamProperty, 0u);
+            std::unordered_map<std::uint32_t, VertexHandle> vertexOf;
+            vertexOf.reserve(chunk.TriangleCount);
+            std::vector<std::uint32_t> inputIndexOf;
+            std::vector<std::uint8_t> isSeam;
+            std::vector<std::array<VertexHandle, 3>> passThrough;
+
+            auto streamed = ForEachTriangle(backend, chunk, [&](const TriangleRecord& record)
+            {
+                std::array<VertexHandle, 3> v{};
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    auto [it, inserted] = vertexOf.try_emplace(record.Indices[k]);
+                    if (inserted)
+                    {
+                        it->second = mesh.AddVertex(record.Positions[k]);
+                        const bool onSeam = InteriorDistance(glm::dvec3(record.Positions[k]), chunk) <= seamMargin;
+                        inputIndexOf.push_back(record.Indices[k]);
+                        isSeam.push_back(onSeam ? 1u : 0u);
+                        seam[it->second.Index] = onSeam ? 1u : 0u;
+                    }
+                    v[k] = it->second;
+                }
+                if (!mesh.AddTriangle(v[0], v[1], v[2]).has_value())
+                {
+                    passThrough.push_back(v);
+                    for (const VertexHandle vh : v)
+                        seam[vh.Index] = 1u;
+                }
+            });
+            if (!streamed.has_value())
+                return fail(streamed.error());
+            (void)spiller.Release(chunk);
+            if (params.RemoveSpillFiles)
+            {
+                std::error_code ec;
+                for (const std::string& spill : chunk.Spills)
+                    std::filesystem::remove(spill, ec);
+            }
+            vertexOf = {};
+            result.PassThroughTriangleCount += passThrough.size();
+
+            if (mesh.FaceCount() > 0)
+            {
+                chunkParams.TargetFaces = std::max<std::size_t>(
+                    static_cast<std::size_t>(std::ceil(params.TargetRatio * static_cast<double>(mesh.FaceCount()))),
+                    1u);
+                // Simplify declines meshes it cannot reduce; those chunks are
+                // written unchanged.
+                if (const auto simplified = Simplify(mesh, chunkParams))
+                    result.MaxCollapseError = std::max(result.MaxCollapseError, simplified->MaxCollapseError);
+            }
+            noteResident(chunk.TriangleCount * kBytesPerResidentTriangle + spiller.PendingBytes()
+                         + chunks.size() * sizeof(Chunk));
+
+            // Only vertices that a surviving triangle uses are written. Seam
+            // vertices were never moved, so they carry their input index.
+            ChunkOutput output;
+            std::vector<std::uint32_t> outputOf(mesh.VerticesSize(), kNoSeam);
+            auto emit = [&](VertexHandle vh) -> std::uint32_t
+            {
+                std::uint32_t& id = outputOf[vh.Index];
+                if (id == kNoSeam)
+                {
+                    id = static_cast<std::uint32_t>(output.Vertices.size());
+                    output.Vertices.push_back(ChunkVertexRecord{
+                        .Seam = isSeam[vh.Index] != 0u ? inputIndexOf[vh.Index] : kNoSeam,
+                        .Position = mesh.Position(vh)});
+                }
+                return id;
+            };
+            for (std::size_t fi = 0; fi < mesh.FacesSize(); ++fi)
+            {
+                const FaceHandle fh{static_cast<PropertyIndex>(fi)};
+                if (mesh.IsDeleted(fh))
+                    continue;
+                std::array<std::uint32_t, 3> triangle{};
+                std::size_t corner = 0;
+                for (const VertexHandle vh : mesh.VerticesAroundFace(fh))
+                {
+                    if (corner < 3)
+                        triangle[corner] = emit(vh);
+                    ++corner;
+                }
+                if (corner == 3)
+                    output.Triangles.push_back(triangle);
+            }
+            for (const auto& v : passThrough)
+                output.Triangles.push_back({emit(v[0]), emit(v[1]), emit(v[2])});
+
+            std::string path = params.SpillDirectory + "/chunk_" + std::to_string(chunkOutputs.size()) + ".bin";
+            const std::vector<std::byte> bytes = EncodeChunkOutput(output);
+            if (!backend.Write(IO::IORequest{.Path = path}, bytes).has_value())
+                return fail(ErrorCode::FileWriteError);
+            ++result.SpillFileCount;
+            result.SpillBytesWritten += bytes.size();
+            spillPaths.push_back(path);
+            chunkOutputs.push_back(std::move(path));
+        }
+
+        // -----------------------------------------------------------------
+        // Pass 5: stream the chunks into the output, merging seam vertices
+        //
+        // Output indices are assigned in chunk order; a seam vertex takes the
+        // index of its first occurrence. The chunk files are replayed three
+        // times (count, vertices, triangles) so only one chunk and the seam
+        // table are resident.
+        // -----------------------------------------------------------------
+
+        auto readChunk = [&](const std::string& path) -> std::optional<ChunkOutput>
+        {
+            auto read = backend.Read(IO::IORequest{.Path = path});
+            if (!read.has_value())
+                return std::nullopt;
+            return DecodeChunkOutput(read->Bytes());
+        };
+
+        std::unordered_map<std::uint32_t, std::uint32_t> seamOutput;
+        std::size_t vertexCount = 0;
+        std::size_t triangleCount = 0;
+        for (const std::string& path : chunkOutputs)
+        {
+            const auto output = readChunk(path);
+            if (!output)
+                return fail(ErrorCode::FileReadError);
+            for (const ChunkVertexRecord& vertex : output->Vertices)
+            {
+                if (vertex.Seam == kNoSeam || seamOutput.try_emplace(vertex.Seam, vertexCount).second)
+                    ++vertexCount;
+            }
+            triangleCount += output->Triangles.size();
+            noteResident(seamOutput.size() * kBytesPerSeamEntry
+                         + output->Vertices.size() * sizeof(ChunkVertexRecord)
+                         + output->Triangles.size() * sizeof(std::array<std::uint32_t, 3>));
+        }
+        if (vertexCount == 0 || triangleCount == 0
+            || vertexCount > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+        {
+            return fail(ErrorCode::InvalidState);
+        }
+
+        MeshIO::PLYBinaryStreamWriter writer;
+        if (const auto status = writer.Open(outputPath, vertexCount, triangleCount);
+            status != MeshIO::MeshIOWriteStatus::Success)
+        {
+            return fail(ToErrorCode(status));
+        }
+
+        // Replays the index assignment of the counting pass; fn(local,
+        // output, first) sees every chunk vertex.
+        std::uint32_t next = 0;
+        auto assign = [&](const ChunkVertexRecord& vertex, bool& first) -> std::uint32_t
+        {
+            const std::uint32_t id = vertex.Seam == kNoSeam ? next : seamOutput.at(vertex.Seam);
+            first = id == next;
+            if (first)
+                ++next;
+            return id;
+        };
+
+        for (const std::string& path : chunkOutputs)
+        {
+            const auto output = readChunk(path);
+            if (!output)
+                return fail(ErrorCode::FileReadError);
+            std::vector<glm::vec3> positions;
+            positions.reserve(output->Vertices.size());
+            for (const ChunkVertexRecord& vertex : output->Vertices)
+            {
+                bool first = false;
+                (void)assign(vertex, first);
+                if (first)
+                    positions.push_back(vertex.Position);
+            }
+            if (const auto status = writer.WriteVertices(positions); status != MeshIO::MeshIOWriteStatus::Success)
+                return fail(ToErrorCode(status));
+        }
+
+        next = 0;
+        for (const std::string& path : chunkOutputs)
+        {
+            auto output = readChunk(path);
+            if (!output)
+                return fail(ErrorCode::FileReadError);
+            std::vector<std::uint32_t> outputOf(output->Vertices.size());
+            for (std::size_t i = 0; i < output->Vertices.size(); ++i)
+            {
+                bool first = false;
+                outputOf[i] = assign(output->Vertices[i], first);
+            }
+            for (auto& triangle : output->Triangles)
+            {
+                for (std::uint32_t& index : triangle)
+                {
+                    if (index >= outputOf.size())
+                        return fail(ErrorCode::FileReadError);
+                    index = outputOf[index];
+                }
+            }
+            if (const auto status = writer.WriteTriangles(output->Triangles);
+                status != MeshIO::MeshIOWriteStatus::Success)
+            {
+                return fail(ToErrorCode(status));
+            }
+        }
+
+        if (const auto status = writer.Close(); status != MeshIO::MeshIOWriteStatus::Success)
+            return fail(ToErrorCode(status));
+
+        result.OutputVertexCount = vertexCount;
+        result.OutputTriangleCount = triangleCount;
+        result.SeamVertexCount = seamOutput.size();
+        removeSpills();
+        return result;
+    }
+}
@@ -0,0 +1,115 @@
+module;
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+export module Geometry.Simplification.Streaming;
+
+export import Geometry.Simplification;
+import Extrinsic.Core.Error;
+import Extrinsic.Core.IOBackend;
+
+export namespace Geometry::Simplification
+{
+    // =========================================================================
+    // Out-of-core streaming simplification
+    // =========================================================================
+    //
+    // Decimates a binary little-endian PLY triangle mesh that need not fit in
+    // memory, writing the result incrementally as binary PLY through
+    // MeshIO::PLYBinaryStreamWriter.
+    //
+    //   1. The vertex section is streamed once for the bounds.
+    //   2. The face section is streamed in batches. Each triangle is binned by
+    //      its centroid into a uniform grid cell and appended, with its three
+    //      positions, to that cell's chunk. Vertex positions are fetched
+    //      through a small page cache of ranged reads. Chunk buffers that
+    //      outgrow their share of the budget are spilled through the
+    //      IIOBackend.
+    //   3. A chunk with more triangles than fit the budget is split into
+    //      octants by re-streaming its spills, until every chunk fits or a
+    //      depth limit is reached.
+    //   4. Each chunk is built as a HalfedgeMesh and passed to Simplify with
+    //      its seam vertices locked (Params::LockedVertexProperty). A vertex
+    //      is a seam vertex when it lies within two thirds of the longest input
+    //      edge of its chunk's cell boundary: any triangle of another chunk
+    //      that uses it has its centroid outside the cell, which is at most
+    //      that far from the vertex. Seam vertices therefore keep their
+    //      original index and position in every chunk that uses them, and the
+    //      chunks stitch without cracks.
+    //   5. The simplified chunks are spilled and finally streamed into the
+    //      output, merging the shared seam vertices.
+    //
+    // Only vertex positions are carried; other vertex and face properties of
+    // the input are dropped. Triangles that cannot enter a chunk's halfedge
+    // mesh (non-manifold configurations) are copied unchanged with their
+    // vertices locked; triangles with a repeated vertex index are dropped.
+    // The output is deterministic for a given input and budget.
+    //
+    // Accepted input: one `vertex` element whose x, y and z are `float`
+    // properties (any other fixed-size properties are skipped) and one `face`
+    // element whose only property is `list uchar int` (or `uint`) with three
+    // indices per face, as written by MeshIO::WritePLYBinary.
+
+    struct StreamingParams
+    {
+        // Per-chunk settings. TargetFaces is derived from TargetRatio per
+        // chunk, and LockedVertexProperty is overwritten with the seam lock.
+        Params Chunk{};
+
+        // Fraction of each chunk's triangles to keep, in (0, 1].
+        double TargetRatio{0.1};
+
+        // Upper bound for the working set: chunk meshes, chunk buffers, the
+        // vertex page cache, and the seam-vertex merge table. The resident
+        // triangle estimate per chunk is deliberately conservative, so the
+        // actual peak normally stays well below it. Must be at least
+        // kMinimumStreamingBudgetBytes.
+        std::size_t MemoryBudgetBytes{std::size_t{512} << 20u};
+
+        // Directory (backend path prefix) for chunk spills. Required.
+        std::string SpillDirectory{};
+
+        // Remove the spill files from the local file system when done.
+        bool RemoveSpillFiles{true};
+    };
+
+    inline constexpr std::size_t kMinimumStreamingBudgetBytes = std::size_t{1} << 20u;
+
+    struct StreamingResult
+    {
+        std::size_t InputVertexCount{0};
+        std::size_t InputTriangleCount{0};
+        std::size_t OutputVertexCount{0};
+        std::size_t OutputTriangleCount{0};
+
+        // Leaf chunks simplified, and how many chunks were split to fit.
+        std::size_t ChunkCount{0};
+        std::size_t SplitChunkCount{0};
+
+        // Distinct output vertices that were locked as chunk seams.
+        std::size_t SeamVertexCount{0};
+        std::size_t PassThroughTriangleCount{0};
+        std::size_t DroppedDegenerateTriangleCount{0};
+
+        std::size_t SpillFileCount{0};
+        std::size_t SpillBytesWritten{0};
+
+        // Largest estimated working set observed, in bytes.
+        std::size_t PeakResidentBytesEstimate{0};
+
+        // Largest MaxCollapseError over all chunks.
+        double MaxCollapseError{0.0};
+    };
+
+    // Returns InvalidArgument for bad parameters, UnsupportedFormat for a PLY
+    // layout outside the accepted subset, InvalidFormat for malformed or
+    // truncated input, and FileReadError / FileWriteError for backend or
+    // output failures.
+    [[nodiscard]] Extrinsic::Core::Expected<StreamingResult> SimplifyStreaming(
+        std::string_view inputPath,
+        std::string_view outputPath,
+        Extrinsic::Core::IO::IIOBackend& backend,
+        const StreamingParams& params = {});
+}
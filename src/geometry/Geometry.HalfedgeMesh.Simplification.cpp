@@ -9,6 +9,7 @@ module;
 #include <limits>
 #include <numbers>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -23,6 +24,7 @@ import Geometry.HalfedgeMesh.Features;
 import Geometry.HalfedgeMesh.Utils;
 import Geometry.MeshClosestFace;
 import Geometry.Validation;
+import Extrinsic.Core.Parallel;
 
 namespace Geometry::Simplification
 {
@@ -30,6 +32,14 @@ namespace Geometry::Simplification
 
     namespace
     {
+        namespace Parallel = Extrinsic::Core::Parallel;
+
+        // Faces per task when initializing face normals and quadrics.
+        constexpr std::size_t kFaceGrain = 4096;
+        // Edges per task when evaluating collapse candidates. One evaluation
+        // walks both one-rings for up to three placements per direction.
+        constexpr std::size_t kEvaluationGrain = 256;
+
         // =====================================================================
         // Normal Cone — tracks accumulated normal deviation per face
         //
@@ -118,6 +128,32 @@ namespace Geometry::Simplification
             }
         };
 
+        // Total order used by the independent-set schedule: cost, then edge
+        // index, so batches do not depend on evaluation order.
+        [[nodiscard]] bool CandidateLess(CollapseCandidate const& a, CollapseCandidate const& b) noexcept
+        {
+            if (a.Cost != b.Cost)
+            {
+                return a.Cost < b.Cost;
+            }
+            return a.Edge.Index < b.Edge.Index;
+        }
+
+        // Rejections counted while evaluating candidates; summed per chunk
+        // when evaluation runs in parallel.
+        struct RejectionCounts
+        {
+            std::size_t Topology{0};
+            std::size_t Quality{0};
+
+            RejectionCounts& operator+=(RejectionCounts const& other) noexcept
+            {
+                Topology += other.Topology;
+                Quality += other.Quality;
+                return *this;
+            }
+        };
+
         struct EdgeHeap
         {
             std::vector<CollapseCandidate> Entries;
@@ -249,6 +285,21 @@ namespace Geometry::Simplification
         // Face helpers
         // =====================================================================
 
+        // A vertex read at a trial position instead of its stored one. Collapse
+        // evaluation uses this rather than writing the trial position into the
+        // mesh, so evaluations only read shared state and can run
+        // concurrently. The default (invalid vertex) reads the mesh as is.
+        struct TrialVertex
+        {
+            VertexHandle Vertex{};
+            glm::vec3 Position{0.0f};
+
+            [[nodiscard]] glm::vec3 PositionOf(HalfedgeMesh::Mesh const& mesh, VertexHandle v) const noexcept
+            {
+                return v == Vertex ? Position : mesh.Position(v);
+            }
+        };
+
         struct FaceTrianglePointsD
         {
             glm::dvec3 P0{0.0};
@@ -256,15 +307,18 @@ namespace Geometry::Simplification
             glm::dvec3 P2{0.0};
         };
 
-        [[nodiscard]] FaceTrianglePointsD GetFaceTrianglePointsD(HalfedgeMesh::Mesh const& mesh, FaceHandle f) noexcept
+        [[nodiscard]] FaceTrianglePointsD GetFaceTrianglePointsD(
+            HalfedgeMesh::Mesh const& mesh,
+            FaceHandle f,
+            TrialVertex const& trial = {}) noexcept
         {
             MeshUtils::TriangleFaceView tri{};
             if (MeshUtils::TryGetTriangleFaceView(mesh, f, tri))
             {
                 return {
-                    glm::dvec3(tri.P0),
-                    glm::dvec3(tri.P1),
-                    glm::dvec3(tri.P2)};
+                    glm::dvec3(tri.V0 == trial.Vertex ? trial.Position : tri.P0),
+                    glm::dvec3(tri.V1 == trial.Vertex ? trial.Position : tri.P1),
+                    glm::dvec3(tri.V2 == trial.Vertex ? trial.Position : tri.P2)};
             }
 
             // Preserve historical behavior for any non-triangular face that may
@@ -274,22 +328,29 @@ namespace Geometry::Simplification
             const HalfedgeHandle h1 = mesh.NextHalfedge(h0);
             const HalfedgeHandle h2 = mesh.NextHalfedge(h1);
             return {
-                glm::dvec3(mesh.Position(mesh.ToVertex(h0))),
-                glm::dvec3(mesh.Position(mesh.ToVertex(h1))),
-                glm::dvec3(mesh.Position(mesh.ToVertex(h2)))};
+                glm::dvec3(trial.PositionOf(mesh, mesh.ToVertex(h0))),
+                glm::dvec3(trial.PositionOf(mesh, mesh.ToVertex(h1))),
+                glm::dvec3(trial.PositionOf(mesh, mesh.ToVertex(h2)))};
         }
 
-        [[nodiscard]] glm::dvec3 ComputeFaceNormalD(HalfedgeMesh::Mesh const& mesh, FaceHandle f) noexcept
+        [[nodiscard]] glm::dvec3 ComputeFaceNormalD(
+            HalfedgeMesh::Mesh const& mesh,
+            FaceHandle f,
+            TrialVertex const& trial = {}) noexcept
         {
-            const FaceTrianglePointsD tri = GetFaceTrianglePointsD(mesh, f);
+            const FaceTrianglePointsD tri = GetFaceTrianglePointsD(mesh, f, trial);
             glm::dvec3 n = glm::cross(tri.P1 - tri.P0, tri.P2 - tri.P0);
             const double len = glm::length(n);
             return len > 1e-12 ? n / len : glm::dvec3(0.0);
         }
 
-        [[nodiscard]] double FacePointDistance(HalfedgeMesh::Mesh const& mesh, FaceHandle f, glm::vec3 const& p) noexcept
+        [[nodiscard]] double FacePointDistance(
+            HalfedgeMesh::Mesh const& mesh,
+            FaceHandle f,
+            glm::vec3 const& p,
+            TrialVertex const& trial = {}) noexcept
         {
-            const FaceTrianglePointsD tri = GetFaceTrianglePointsD(mesh, f);
+            const FaceTrianglePointsD tri = GetFaceTrianglePointsD(mesh, f, trial);
             return PointTriangleDistance(glm::dvec3(p), tri.P0, tri.P1, tri.P2);
         }
 
@@ -799,20 +860,25 @@ namespace Geometry::Simplification
             ? mesh.FaceProperties().Get<glm::dmat3>(params.Quadric.FaceNormalCovarianceProperty)
             : Property<glm::dmat3>{};
 
+        // Worker-thread passes (cache setup, candidate evaluation, batch
+        // revalidation) read through this const view: the mutable
+        // Position() overload marks the vertex storage modified, which is a
+        // data race off the owning thread. Only applyCollapse edits mesh.
+        const HalfedgeMesh::Mesh& view = mesh;
+
         // -----------------------------------------------------------------
         // Phase 1: Compute face normals and initialize configurable quadrics
         // -----------------------------------------------------------------
 
         std::vector<glm::dvec3> faceNormals(nF, glm::dvec3(0.0));
-        for (std::size_t fi = 0; fi < nF; ++fi)
+        Parallel::ParallelFor(Parallel::IndexRange{0u, nF}, kFaceGrain, [&](const std::size_t fi)
         {
             const FaceHandle fh{static_cast<PropertyIndex>(fi)};
-            if (mesh.IsDeleted(fh))
+            if (!view.IsDeleted(fh))
             {
-                continue;
+                faceNormals[fi] = ComputeFaceNormalD(view, fh);
             }
-            faceNormals[fi] = ComputeFaceNormalD(mesh, fh);
-        }
+        });
 
         // -----------------------------------------------------------------
         // Phase 1b (FA_QEM): classify the protected feature skeleton.
@@ -904,27 +970,49 @@ namespace Geometry::Simplification
             }
         }
 
+        // Caller-locked vertices (e.g. streaming chunk seams) hold under both
+        // metrics.
+        std::vector<std::uint8_t> lockedVertex(nV, 0u);
+        std::size_t lockedCount = 0;
+        if (!params.LockedVertexProperty.empty())
+        {
+            const Property<std::uint8_t> locked =
+                mesh.VertexProperties().Get<std::uint8_t>(params.LockedVertexProperty);
+            if (locked.IsValid())
+            {
+                for (std::size_t vi = 0; vi < nV; ++vi)
+                {
+                    const VertexHandle vh{static_cast<PropertyIndex>(vi)};
+                    if (locked[vi] != 0u && !mesh.IsDeleted(vh))
+                    {
+                        lockedVertex[vi] = 1u;
+                        ++lockedCount;
+                    }
+                }
+            }
+        }
+
         std::vector<Quadric> vertexPointQuadrics(nV);
         if (params.Quadric.Type == QuadricType::Point)
         {
-            for (std::size_t vi = 0; vi < nV; ++vi)
+            Parallel::ParallelFor(Parallel::IndexRange{0u, nV}, kFaceGrain, [&](const std::size_t vi)
             {
                 const VertexHandle vh{static_cast<PropertyIndex>(vi)};
-                vertexPointQuadrics[vi] = ComputePointQuadric(mesh, vh);
-            }
+                vertexPointQuadrics[vi] = ComputePointQuadric(view, vh);
+            });
         }
 
         const bool needFaceQuadrics = UsesFacePrimitive(params.Quadric.Type) || UsesFaceResidence(params.Quadric.Residence);
         std::vector<Quadric> faceQuadrics(nF);
         if (needFaceQuadrics)
         {
-            for (std::size_t fi = 0; fi < nF; ++fi)
+            Parallel::ParallelFor(Parallel::IndexRange{0u, nF}, kFaceGrain, [&](const std::size_t fi)
             {
                 const FaceHandle fh{static_cast<PropertyIndex>(fi)};
-                if (!mesh.IsDeleted(fh))
+                if (!view.IsDeleted(fh))
                 {
                     faceQuadrics[fi] = ComputeFaceQuadric(
-                        mesh,
+                        view,
                         fh,
                         faceNormals[fi],
                         params.Quadric,
@@ -933,7 +1021,7 @@ namespace Geometry::Simplification
                         faceSigmaP,
                         faceSigmaN);
                 }
-            }
+            });
         }
 
         // -----------------------------------------------------------------
@@ -973,16 +1061,23 @@ namespace Geometry::Simplification
 
         auto isCollapseLegal = [&](HalfedgeHandle hCollapse, glm::vec3 const& targetPosition) -> bool
         {
-            if (!mesh.IsCollapseOk(hCollapse))
+            if (!view.IsCollapseOk(hCollapse))
             {
                 return false;
             }
 
-            const HalfedgeHandle hOpp = mesh.OppositeHalfedge(hCollapse);
-            const VertexHandle vRemoved = mesh.FromVertex(hCollapse);
-            const VertexHandle vSurvivor = mesh.ToVertex(hCollapse);
-            if (mesh.IsDeleted(vRemoved) || mesh.IsDeleted(vSurvivor)
-                || mesh.IsIsolated(vRemoved) || mesh.IsIsolated(vSurvivor))
+            const HalfedgeHandle hOpp = view.OppositeHalfedge(hCollapse);
+            const VertexHandle vRemoved = view.FromVertex(hCollapse);
+            const VertexHandle vSurvivor = view.ToVertex(hCollapse);
+            if (view.IsDeleted(vRemoved) || view.IsDeleted(vSurvivor)
+                || view.IsIsolated(vRemoved) || view.IsIsolated(vSurvivor))
+            {
+                return false;
+            }
+
+            // Locked vertices are never removed and never moved.
+            if (lockedVertex[vRemoved.Index] != 0u
+                || (lockedVertex[vSurvivor.Index] != 0u && targetPosition != view.Position(vSurvivor)))
             {
                 return false;
             }
@@ -1001,10 +1096,10 @@ namespace Geometry::Simplification
                     }
                     if (removedKind == FeatureProtection::Line)
                     {
-                        const EdgeHandle featureEdge = mesh.Edge(hCollapse);
+                        const EdgeHandle featureEdge = view.Edge(hCollapse);
                         const bool edgeIsFeature =
                             HalfedgeMesh::Features::IsFeatureEdgeFailClosed(
-                                mesh,
+                                view,
                                 featureEdge,
                                 faceNormals,
                                 featureParams);
@@ -1022,30 +1117,30 @@ namespace Geometry::Simplification
                 }
             }
 
-            const FaceHandle removedLeft = mesh.IsBoundary(hCollapse) ? FaceHandle{} : mesh.Face(hCollapse);
-            const FaceHandle removedRight = mesh.IsBoundary(hOpp) ? FaceHandle{} : mesh.Face(hOpp);
-            const VertexHandle vl = removedLeft.IsValid() ? mesh.ToVertex(mesh.NextHalfedge(hCollapse)) : VertexHandle{};
-            const VertexHandle vr = removedRight.IsValid() ? mesh.ToVertex(mesh.NextHalfedge(hOpp)) : VertexHandle{};
+            const FaceHandle removedLeft = view.IsBoundary(hCollapse) ? FaceHandle{} : view.Face(hCollapse);
+            const FaceHandle removedRight = view.IsBoundary(hOpp) ? FaceHandle{} : view.Face(hOpp);
+            const VertexHandle vl = removedLeft.IsValid() ? view.ToVertex(view.NextHalfedge(hCollapse)) : VertexHandle{};
+            const VertexHandle vr = removedRight.IsValid() ? view.ToVertex(view.NextHalfedge(hOpp)) : VertexHandle{};
 
             // Preserve the open boundary as an immutable feature set: when enabled,
             // no collapse may consume or move a boundary vertex, even through an
             // interior edge adjacent to the boundary.
             if (params.PreserveBoundary
-                && (mesh.IsBoundary(vRemoved) || mesh.IsBoundary(vSurvivor)))
+                && (view.IsBoundary(vRemoved) || view.IsBoundary(vSurvivor)))
             {
                 return false;
             }
 
             // Boundary → interior check
             if (params.ForbidBoundaryInteriorCollapse
-                && mesh.IsBoundary(vRemoved) && !mesh.IsBoundary(vSurvivor))
+                && view.IsBoundary(vRemoved) && !view.IsBoundary(vSurvivor))
             {
                 return false;
             }
 
             // Minimum incident faces on removed vertex
             if (params.MinRemovedVertexIncidentFaces >= 2
-                && CountIncidentFaces(mesh, vRemoved) < params.MinRemovedVertexIncidentFaces)
+                && CountIncidentFaces(view, vRemoved) < params.MinRemovedVertexIncidentFaces)
             {
                 return false;
             }
@@ -1053,8 +1148,8 @@ namespace Geometry::Simplification
             // Max valence check
             if (params.MaxValence > 0)
             {
-                const std::size_t valRemoved = mesh.Valence(vRemoved);
-                const std::size_t valSurvivor = mesh.Valence(vSurvivor);
+                const std::size_t valRemoved = view.Valence(vRemoved);
+                const std::size_t valSurvivor = view.Valence(vSurvivor);
                 std::size_t predicted = valRemoved + valSurvivor - 1u;
                 if (removedLeft.IsValid())
                 {
@@ -1070,18 +1165,19 @@ namespace Geometry::Simplification
                 }
             }
 
-            const glm::vec3 p0 = mesh.Position(vRemoved);
+            const glm::vec3 p0 = view.Position(vRemoved);
             const glm::vec3 p1 = targetPosition;
+            const TrialVertex trial{vRemoved, p1};
 
             // Max edge length check
             if (params.MaxEdgeLength > 0.0)
             {
-                for (const HalfedgeHandle h : mesh.HalfedgesAroundVertex(vRemoved))
+                for (const HalfedgeHandle h : view.HalfedgesAroundVertex(vRemoved))
                 {
-                    const VertexHandle neighbor = mesh.ToVertex(h);
+                    const VertexHandle neighbor = view.ToVertex(h);
                     if (neighbor != vSurvivor && neighbor != vl && neighbor != vr)
                     {
-                        const double len = static_cast<double>(glm::distance(p1, mesh.Position(neighbor)));
+                        const double len = static_cast<double>(glm::distance(p1, view.Position(neighbor)));
                         if (!IsFinite(len) || len > params.MaxEdgeLength)
                         {
                             return false;
@@ -1094,22 +1190,20 @@ namespace Geometry::Simplification
             if (normalDeviationRad <= 1e-12)
             {
                 // Simple normal-flip check
-                mesh.Position(vRemoved) = p1;
                 bool flipped = false;
-                ForEachFace(mesh, vRemoved, [&](FaceHandle f)
+                ForEachFace(view, vRemoved, [&](FaceHandle f)
                 {
                     if (flipped || f == removedLeft || f == removedRight)
                     {
                         return;
                     }
                     const glm::dvec3 n0 = faceNormals[f.Index];
-                    const glm::dvec3 n1 = ComputeFaceNormalD(mesh, f);
+                    const glm::dvec3 n1 = ComputeFaceNormalD(view, f, trial);
                     if (glm::dot(n0, n1) < 0.0)
                     {
                         flipped = true;
                     }
                 });
-                mesh.Position(vRemoved) = p0;
                 if (flipped)
                 {
                     return false;
@@ -1118,23 +1212,21 @@ namespace Geometry::Simplification
             else
             {
                 // Normal cone check
-                mesh.Position(vRemoved) = p1;
-
                 FaceHandle fll;
                 FaceHandle frr;
                 if (vl.IsValid())
                 {
-                    const HalfedgeHandle hOpp2 = mesh.OppositeHalfedge(mesh.PrevHalfedge(hCollapse));
-                    fll = mesh.Face(hOpp2);
+                    const HalfedgeHandle hOpp2 = view.OppositeHalfedge(view.PrevHalfedge(hCollapse));
+                    fll = view.Face(hOpp2);
                 }
                 if (vr.IsValid())
                 {
-                    const HalfedgeHandle hOpp2 = mesh.OppositeHalfedge(mesh.NextHalfedge(hOpp));
-                    frr = mesh.Face(hOpp2);
+                    const HalfedgeHandle hOpp2 = view.OppositeHalfedge(view.NextHalfedge(hOpp));
+                    frr = view.Face(hOpp2);
                 }
 
                 bool coneExceeded = false;
-                ForEachFace(mesh, vRemoved, [&](FaceHandle f)
+                ForEachFace(view, vRemoved, [&](FaceHandle f)
                 {
                     if (coneExceeded || f == removedLeft || f == removedRight)
                     {
@@ -1142,7 +1234,7 @@ namespace Geometry::Simplification
                     }
 
                     NormalCone nc = normalCones[f.Index];
-                    nc.Merge(ComputeFaceNormalD(mesh, f));
+                    nc.Merge(ComputeFaceNormalD(view, f, trial));
 
                     if (f == fll && removedLeft.IsValid())
                     {
@@ -1159,7 +1251,6 @@ namespace Geometry::Simplification
                     }
                 });
 
-                mesh.Position(vRemoved) = p0;
                 if (coneExceeded)
                 {
                     return false;
@@ -1171,26 +1262,22 @@ namespace Geometry::Simplification
             {
                 double ar0 = 0.0;
                 double ar1 = 0.0;
-                ForEachFace(mesh, vRemoved, [&](FaceHandle f)
+                ForEachFace(view, vRemoved, [&](FaceHandle f)
                 {
                     if (f == removedLeft || f == removedRight)
                     {
                         return;
                     }
                     MeshUtils::TriangleFaceView tri{};
-                    if (!MeshUtils::TryGetTriangleFaceView(mesh, f, tri))
+                    if (!MeshUtils::TryGetTriangleFaceView(view, f, tri))
                     {
                         return;
                     }
                     ar0 = std::max(ar0, TriangleAspectRatioMetric(tri.P0, tri.P1, tri.P2));
-
-                    mesh.Position(vRemoved) = p1;
-                    MeshUtils::TriangleFaceView triNew{};
-                    if (MeshUtils::TryGetTriangleFaceView(mesh, f, triNew))
-                    {
-                        ar1 = std::max(ar1, TriangleAspectRatioMetric(triNew.P0, triNew.P1, triNew.P2));
-                    }
-                    mesh.Position(vRemoved) = p0;
+                    ar1 = std::max(ar1, TriangleAspectRatioMetric(
+                        trial.PositionOf(view, tri.V0),
+                        trial.PositionOf(view, tri.V1),
+                        trial.PositionOf(view, tri.V2)));
                 });
 
                 if (ar1 > params.MaxAspectRatio && ar1 > ar0)
@@ -1203,25 +1290,24 @@ namespace Geometry::Simplification
             if (params.HausdorffError > 0.0)
             {
                 PointList testPoints;
-                ForEachFace(mesh, vRemoved, [&](FaceHandle f)
+                ForEachFace(view, vRemoved, [&](FaceHandle f)
                 {
                     const auto& pts = facePoints[f.Index];
                     testPoints.insert(testPoints.end(), pts.begin(), pts.end());
                 });
                 testPoints.push_back(p0);
 
-                mesh.Position(vRemoved) = p1;
                 bool hausdorffOk = true;
                 for (const auto& pt : testPoints)
                 {
                     bool pointOk = false;
-                    ForEachFace(mesh, vRemoved, [&](FaceHandle f)
+                    ForEachFace(view, vRemoved, [&](FaceHandle f)
                     {
                         if (pointOk || f == removedLeft || f == removedRight)
                         {
                             return;
                         }
-                        if (FacePointDistance(mesh, f, pt) < params.HausdorffError)
+                        if (FacePointDistance(view, f, pt, trial) < params.HausdorffError)
                         {
                             pointOk = true;
                         }
@@ -1232,7 +1318,6 @@ namespace Geometry::Simplification
                         break;
                     }
                 }
-                mesh.Position(vRemoved) = p0;
                 if (!hausdorffOk)
                 {
                     return false;
@@ -1271,60 +1356,57 @@ namespace Geometry::Simplification
         auto normalConsistencyPenalty =
             [&](HalfedgeHandle hCollapse, glm::vec3 const& targetPosition) -> double
         {
-            const VertexHandle vRemoved = mesh.FromVertex(hCollapse);
-            const VertexHandle vSurvivor = mesh.ToVertex(hCollapse);
-            const HalfedgeHandle hOpp = mesh.OppositeHalfedge(hCollapse);
-            const FaceHandle removedLeft = mesh.IsBoundary(hCollapse) ? FaceHandle{} : mesh.Face(hCollapse);
-            const FaceHandle removedRight = mesh.IsBoundary(hOpp) ? FaceHandle{} : mesh.Face(hOpp);
+            const VertexHandle vRemoved = view.FromVertex(hCollapse);
+            const VertexHandle vSurvivor = view.ToVertex(hCollapse);
+            const HalfedgeHandle hOpp = view.OppositeHalfedge(hCollapse);
+            const FaceHandle removedLeft = view.IsBoundary(hCollapse) ? FaceHandle{} : view.Face(hCollapse);
+            const FaceHandle removedRight = view.IsBoundary(hOpp) ? FaceHandle{} : view.Face(hOpp);
 
-            const glm::vec3 original = mesh.Position(vRemoved);
-            const glm::dvec3 edge = glm::dvec3(original) - glm::dvec3(mesh.Position(vSurvivor));
+            const glm::dvec3 edge = glm::dvec3(view.Position(vRemoved)) - glm::dvec3(view.Position(vSurvivor));
             const double edgeLen2 = glm::dot(edge, edge);
 
-            mesh.Position(vRemoved) = targetPosition;
+            const TrialVertex trial{vRemoved, targetPosition};
             double sum = 0.0;
-            ForEachFace(mesh, vRemoved, [&](FaceHandle f)
+            ForEachFace(view, vRemoved, [&](FaceHandle f)
             {
-                if (f == removedLeft || f == removedRight || mesh.IsDeleted(f))
+                if (f == removedLeft || f == removedRight || view.IsDeleted(f))
                 {
                     return;
                 }
-                const double dp = glm::dot(faceNormals[f.Index], ComputeFaceNormalD(mesh, f));
+                const double dp = glm::dot(faceNormals[f.Index], ComputeFaceNormalD(view, f, trial));
                 sum += std::max(0.0, 1.0 - dp);
             });
-            mesh.Position(vRemoved) = original;
 
             const double penalty = params.NormalWeight * edgeLen2 * sum;
             return IsFinite(penalty) ? std::max(0.0, penalty) : 0.0;
         };
 
-        // Compute directed collapse: evaluate cost of collapsing FromVertex(h) into ToVertex(h)
-        std::size_t topologyRejectionCount = 0u;
-        std::size_t qualityRejectionCount = 0u;
-
-        auto computeDirectedCollapse = [&](HalfedgeHandle hCollapse) -> CollapseCandidate
+        // Compute directed collapse: evaluate cost of collapsing FromVertex(h) into ToVertex(h).
+        // Only reads the const view and the per-element caches, so disjoint or
+        // unchanged neighbourhoods may be evaluated concurrently.
+        auto computeDirectedCollapse = [&](HalfedgeHandle hCollapse, RejectionCounts& rejections) -> CollapseCandidate
         {
             CollapseCandidate best;
             best.Halfedge = hCollapse;
-            best.Edge = mesh.Edge(hCollapse);
+            best.Edge = view.Edge(hCollapse);
             best.Version = edgeVersion[best.Edge.Index];
-            best.Position = mesh.Position(mesh.ToVertex(hCollapse));
+            best.Position = view.Position(view.ToVertex(hCollapse));
 
-            if (!mesh.IsCollapseOk(hCollapse))
+            if (!view.IsCollapseOk(hCollapse))
             {
-                ++topologyRejectionCount;
+                ++rejections.Topology;
                 return best;
             }
 
-            const VertexHandle vRemoved = mesh.FromVertex(hCollapse);
-            const VertexHandle vSurvivor = mesh.ToVertex(hCollapse);
+            const VertexHandle vRemoved = view.FromVertex(hCollapse);
+            const VertexHandle vSurvivor = view.ToVertex(hCollapse);
 
-            const Quadric Q = ComputeCollapseQuadric(mesh, hCollapse, params.Quadric, faceQuadrics, vertexPointQuadrics);
+            const Quadric Q = ComputeCollapseQuadric(view, hCollapse, params.Quadric, faceQuadrics, vertexPointQuadrics);
 
             std::vector<glm::vec3> candidatePositions;
             candidatePositions.reserve(3);
-            const glm::vec3 removedPos = mesh.Position(vRemoved);
-            const glm::vec3 survivorPos = mesh.Position(vSurvivor);
+            const glm::vec3 removedPos = view.Position(vRemoved);
+            const glm::vec3 survivorPos = view.Position(vSurvivor);
 
             switch (params.Quadric.PlacementPolicy)
             {
@@ -1352,7 +1434,7 @@ namespace Geometry::Simplification
             {
                 if (!isCollapseLegal(hCollapse, candidatePosition))
                 {
-                    ++qualityRejectionCount;
+                    ++rejections.Quality;
                     continue;
                 }
 
@@ -1371,73 +1453,63 @@ namespace Geometry::Simplification
             return best;
         };
 
-        auto computeCollapse = [&](EdgeHandle eh) -> CollapseCandidate
+        auto computeCollapse = [&](EdgeHandle eh, RejectionCounts& rejections) -> CollapseCandidate
         {
-            const CollapseCandidate c0 = computeDirectedCollapse(mesh.Halfedge(eh, 0));
-            const CollapseCandidate c1 = computeDirectedCollapse(mesh.Halfedge(eh, 1));
+            const CollapseCandidate c0 = computeDirectedCollapse(view.Halfedge(eh, 0), rejections);
+            const CollapseCandidate c1 = computeDirectedCollapse(view.Halfedge(eh, 1), rejections);
             if (!c0.IsValid()) return c1;
             if (!c1.IsValid()) return c0;
             return c1.Cost < c0.Cost ? c1 : c0;
         };
 
         // -----------------------------------------------------------------
-        // Phase 5: Build edge heap
+        // Phase 5: Evaluate every collapsible edge
+        //
+        // Evaluation only reads the const view, so this pass runs in chunks on
+        // Core::Parallel. Candidates are stored by edge index and the
+        // rejection counts are summed in chunk order, so the result does not
+        // depend on the thread count.
         // -----------------------------------------------------------------
 
-        EdgeHeap heap;
-        for (std::size_t ei = 0; ei < nE; ++ei)
+        auto isCandidateEdge = [&](EdgeHandle eh) -> bool
         {
-            const EdgeHandle eh{static_cast<PropertyIndex>(ei)};
-            if (mesh.IsDeleted(eh))
-            {
-                continue;
-            }
-            if (params.PreserveBoundary && mesh.IsBoundary(eh))
-            {
-                continue;
-            }
-            CollapseCandidate candidate = computeCollapse(eh);
-            if (candidate.IsValid())
-            {
-                heap.Push(candidate);
-            }
-        }
+            return !view.IsDeleted(eh) && (!params.PreserveBoundary || !view.IsBoundary(eh));
+        };
 
-        // -----------------------------------------------------------------
-        // Phase 6: Greedy collapse loop
-        // -----------------------------------------------------------------
+        auto evaluateEdges = [&](std::size_t count, auto&& edgeAt, std::vector<CollapseCandidate>& out)
+        {
+            return Parallel::ParallelReduce(
+                Parallel::IndexRange{0u, count},
+                kEvaluationGrain,
+                RejectionCounts{},
+                [&](const Parallel::IndexRange range, RejectionCounts acc)
+                {
+                    for (std::size_t i = range.Begin; i < range.End; ++i)
+                    {
+                        const EdgeHandle eh = edgeAt(i);
+                        out[eh.Index] = isCandidateEdge(eh) ? computeCollapse(eh, acc) : CollapseCandidate{};
+                    }
+                    return acc;
+                },
+                [](RejectionCounts lhs, RejectionCounts const& rhs) { return lhs += rhs; });
+        };
+
+        std::vector<CollapseCandidate> candidates(nE);
+        RejectionCounts rejections = evaluateEdges(nE, [](std::size_t i)
+        {
+            return EdgeHandle{static_cast<PropertyIndex>(i)};
+        }, candidates);
 
         Result result;
         result.FinalFaceCount = mesh.FaceCount();
         result.SharpFeatureVerticesPinned = featurePinnedCount;
         result.SeamVerticesPinned = seamPinnedCount;
+        result.LockedVerticesPinned = lockedCount;
 
-        while (!heap.Empty() && result.FinalFaceCount > targetFaces)
+        // Applies one legal collapse and refreshes the per-face caches
+        // (normals, quadrics, cones, Hausdorff points) around the survivor.
+        auto applyCollapse = [&](CollapseCandidate const& top) -> std::optional<VertexHandle>
         {
-            const CollapseCandidate top = heap.Pop();
-            if (!top.IsValid() || mesh.IsDeleted(top.Edge))
-            {
-                continue;
-            }
-            if (top.Version != edgeVersion[top.Edge.Index])
-            {
-                continue;
-            }
-            if (top.Cost > params.MaxError)
-            {
-                break;
-            }
-            if (!mesh.IsCollapseOk(top.Halfedge))
-            {
-                ++topologyRejectionCount;
-                continue;
-            }
-            if (!isCollapseLegal(top.Halfedge, top.Position))
-            {
-                ++qualityRejectionCount;
-                continue;
-            }
-
             const VertexHandle vRemoved = mesh.FromVertex(top.Halfedge);
             const VertexHandle vSurvivor = mesh.ToVertex(top.Halfedge);
             const HalfedgeHandle hOpp = mesh.OppositeHalfedge(top.Halfedge);
@@ -1497,7 +1569,7 @@ namespace Geometry::Simplification
             auto surviving = mesh.Collapse(top.Halfedge, top.Position);
             if (!surviving)
             {
-                continue;
+                return std::nullopt;
             }
 
             ++result.CollapseCount;
@@ -1577,29 +1649,252 @@ namespace Geometry::Simplification
                 }
             }
 
-            // Update edge heap: recompute cost for all edges around surviving vertex
-            // Skip if we've already reached the target — avoids expensive recomputation
-            // on degenerate post-collapse topology that won't be used.
-            if (result.FinalFaceCount > targetFaces && !mesh.IsIsolated(*surviving))
+            return surviving;
+        };
+
+        if (params.Schedule == CollapseSchedule::Greedy)
+        {
+            // -------------------------------------------------------------
+            // Phase 6: Greedy collapse loop
+            // -------------------------------------------------------------
+
+            EdgeHeap heap;
+            for (CollapseCandidate const& candidate : candidates)
+            {
+                if (candidate.IsValid())
+                {
+                    heap.Push(candidate);
+                }
+            }
+            std::vector<CollapseCandidate>().swap(candidates);
+
+            while (!heap.Empty() && result.FinalFaceCount > targetFaces)
+            {
+                const CollapseCandidate top = heap.Pop();
+                if (!top.IsValid() || mesh.IsDeleted(top.Edge))
+                {
+                    continue;
+                }
+                if (top.Version != edgeVersion[top.Edge.Index])
+                {
+                    continue;
+                }
+                if (top.Cost > params.MaxError)
+                {
+                    break;
+                }
+                if (!mesh.IsCollapseOk(top.Halfedge))
+                {
+                    ++rejections.Topology;
+                    continue;
+                }
+                if (!isCollapseLegal(top.Halfedge, top.Position))
+                {
+                    ++rejections.Quality;
+                    continue;
+                }
+
+                const std::optional<VertexHandle> surviving = applyCollapse(top);
+                if (!surviving)
+                {
+                    continue;
+                }
+
+                // Update edge heap: recompute cost for all edges around surviving vertex
+                // Skip if we've already reached the target — avoids expensive recomputation
+                // on degenerate post-collapse topology that won't be used.
+                if (result.FinalFaceCount > targetFaces && !mesh.IsIsolated(*surviving))
+                {
+                    for (const HalfedgeHandle h : mesh.HalfedgesAroundVertex(*surviving))
+                    {
+                        const EdgeHandle eAdj = mesh.Edge(h);
+                        if (isCandidateEdge(eAdj))
+                        {
+                            ++edgeVersion[eAdj.Index];
+                            CollapseCandidate candidate = computeCollapse(eAdj, rejections);
+                            if (candidate.IsValid())
+                            {
+                                heap.Push(candidate);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            // -------------------------------------------------------------
+            // Phase 6: Independent-set rounds
+            //
+            // Each round takes the cheapest fraction of the live candidates
+            // and picks, in cost order, edges whose closed one-ring regions
+            // (both endpoints and all their neighbours) are pairwise
+            // disjoint. A collapse only changes faces incident to its
+            // endpoints, so within a round no picked collapse can change
+            // another's legality or cost. Picked candidates are revalidated
+            // in parallel (they may be stale from earlier rounds, exactly as
+            // heap entries are), applied in cost order, and only the edges
+            // around the survivors are re-evaluated for the next round.
+            // -------------------------------------------------------------
+
+            const double fraction = params.IndependentSetCandidateFraction > 0.0
+                ? std::min(params.IndependentSetCandidateFraction, 1.0)
+                : 0.0;
+
+            std::vector<std::uint32_t> claimedRound(nV, 0u);
+            std::vector<std::uint32_t> dirtyRound(nE, 0u);
+            std::vector<CollapseCandidate> eligible;
+            std::vector<CollapseCandidate> batch;
+            std::vector<std::uint8_t> batchLegal;
+            std::vector<EdgeHandle> dirty;
+            std::vector<VertexHandle> region;
+            std::uint32_t round = 0u;
+
+            // Claims the closed one-ring region of the edge, or leaves every
+            // claim untouched when any vertex of it is already taken.
+            auto claimRegion = [&](HalfedgeHandle h) -> bool
+            {
+                region.clear();
+                for (const VertexHandle v : {mesh.FromVertex(h), mesh.ToVertex(h)})
+                {
+                    region.push_back(v);
+                    for (const HalfedgeHandle out : mesh.HalfedgesAroundVertex(v))
+                    {
+                        region.push_back(mesh.ToVertex(out));
+                    }
+                }
+                for (const VertexHandle v : region)
+                {
+                    if (claimedRound[v.Index] == round)
+                    {
+                        return false;
+                    }
+                }
+                for (const VertexHandle v : region)
+                {
+                    claimedRound[v.Index] = round;
+                }
+                return true;
+            };
+
+            while (result.FinalFaceCount > targetFaces)
             {
-                for (const HalfedgeHandle h : mesh.HalfedgesAroundVertex(*surviving))
+                ++round;
+
+                eligible.clear();
+                for (CollapseCandidate const& candidate : candidates)
+                {
+                    if (candidate.IsValid() && candidate.Cost <= params.MaxError
+                        && !mesh.IsDeleted(candidate.Edge))
+                    {
+                        eligible.push_back(candidate);
+                    }
+                }
+                if (eligible.empty())
+                {
+                    break;
+                }
+
+                const std::size_t keep = std::clamp<std::size_t>(
+                    static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(eligible.size()))),
+                    1u,
+                    eligible.size());
+                if (keep < eligible.size())
+                {
+                    std::nth_element(eligible.begin(), eligible.begin() + static_cast<std::ptrdiff_t>(keep),
+                                     eligible.end(), CandidateLess);
+                    eligible.resize(keep);
+                }
+                Parallel::ParallelStableSort(std::span<CollapseCandidate>{eligible}, CandidateLess);
+
+                // Stop picking once the batch alone would reach the target.
+                batch.clear();
+                const std::size_t removableFaces = result.FinalFaceCount - targetFaces;
+                std::size_t plannedFaces = 0u;
+                for (CollapseCandidate const& candidate : eligible)
+                {
+                    if (plannedFaces >= removableFaces)
+                    {
+                        break;
+                    }
+                    if (!claimRegion(candidate.Halfedge))
+                    {
+                        continue;
+                    }
+                    batch.push_back(candidate);
+                    plannedFaces += (mesh.IsBoundary(candidate.Halfedge) ? 0u : 1u)
+                        + (mesh.IsBoundary(mesh.OppositeHalfedge(candidate.Halfedge)) ? 0u : 1u);
+                }
+
+                batchLegal.assign(batch.size(), 0u);
+                rejections += Parallel::ParallelReduce(
+                    Parallel::IndexRange{0u, batch.size()},
+                    kEvaluationGrain,
+                    RejectionCounts{},
+                    [&](const Parallel::IndexRange range, RejectionCounts acc)
+                    {
+                        for (std::size_t i = range.Begin; i < range.End; ++i)
+                        {
+                            if (!view.IsCollapseOk(batch[i].Halfedge))
+                            {
+                                ++acc.Topology;
+                            }
+                            else if (!isCollapseLegal(batch[i].Halfedge, batch[i].Position))
+                            {
+                                ++acc.Quality;
+                            }
+                            else
+                            {
+                                batchLegal[i] = 1u;
+                            }
+                        }
+                        return acc;
+                    },
+                    [](RejectionCounts lhs, RejectionCounts const& rhs) { return lhs += rhs; });
+
+                // A rejected candidate is dropped until a neighbouring
+                // collapse re-evaluates it, as with a rejected heap entry.
+                dirty.clear();
+                for (std::size_t i = 0; i < batch.size(); ++i)
                 {
-                    const EdgeHandle eAdj = mesh.Edge(h);
-                    if (!mesh.IsDeleted(eAdj) && (!params.PreserveBoundary || !mesh.IsBoundary(eAdj)))
+                    CollapseCandidate const& top = batch[i];
+                    if (batchLegal[i] == 0u)
                     {
-                        ++edgeVersion[eAdj.Index];
-                        CollapseCandidate candidate = computeCollapse(eAdj);
-                        if (candidate.IsValid())
+                        candidates[top.Edge.Index] = CollapseCandidate{};
+                        continue;
+                    }
+                    if (result.FinalFaceCount <= targetFaces)
+                    {
+                        break;
+                    }
+
+                    const std::optional<VertexHandle> surviving = applyCollapse(top);
+                    candidates[top.Edge.Index] = CollapseCandidate{};
+                    if (!surviving || mesh.IsIsolated(*surviving))
+                    {
+                        continue;
+                    }
+                    for (const HalfedgeHandle h : mesh.HalfedgesAroundVertex(*surviving))
+                    {
+                        const EdgeHandle eAdj = mesh.Edge(h);
+                        if (dirtyRound[eAdj.Index] != round)
                         {
-                            heap.Push(candidate);
+                            dirtyRound[eAdj.Index] = round;
+                            dirty.push_back(eAdj);
                         }
                     }
                 }
+
+                ++result.IndependentSetRounds;
+                if (result.FinalFaceCount > targetFaces && !dirty.empty())
+                {
+                    rejections += evaluateEdges(dirty.size(), [&](std::size_t i) { return dirty[i]; }, candidates);
+                }
             }
         }
 
-        result.CollapsesRejectedTopology = topologyRejectionCount;
-        result.CollapsesRejectedQuality = qualityRejectionCount;
+        result.CollapsesRejectedTopology = rejections.Topology;
+        result.CollapsesRejectedQuality = rejections.Quality;
         return result;
     }
 
@@ -68,6 +68,27 @@ export namespace Geometry::Simplification
         BestOfEndpointsAndMinimizer
     };
 
+    // How accepted collapses are ordered.
+    //
+    // Greedy is the reference schedule: one collapse at a time from a global
+    // cost heap, re-evaluating the survivor's edges after each.
+    //
+    // IndependentSets runs batched rounds. Each round considers the cheapest
+    // IndependentSetCandidateFraction of the current candidates and picks, in
+    // cost order, edges whose closed one-ring regions (both endpoints and all
+    // of their neighbours) are pairwise disjoint, so no collapse in a round can
+    // change another's legality or cost. The picks are revalidated against
+    // every guard and feature pin, applied, and only the survivors' edges are
+    // re-evaluated. Candidate evaluation and revalidation run on
+    // Core::Parallel; the result does not depend on the thread count. Costs
+    // are taken per round rather than per collapse, so the output differs
+    // from Greedy and is usually slightly worse at the same face count.
+    enum class CollapseSchedule
+    {
+        Greedy,
+        IndependentSets
+    };
+
     struct QuadricOptions
     {
         QuadricType Type{QuadricType::Plane};
@@ -169,6 +190,23 @@ export namespace Geometry::Simplification
         // No-op when the mesh carries neither property.
         bool PreserveUvSeams{true};
 
+        // Optional std::uint8_t vertex property; vertices with a nonzero value
+        // are locked under both metrics: they are never removed, and a
+        // collapse into one must keep its position. Streaming simplification
+        // uses this to keep chunk seams fixed. No-op when the mesh does not
+        // carry the property.
+        std::string LockedVertexProperty{"v:simplification_locked"};
+
+        // Collapse ordering; see CollapseSchedule. Every guard, feature pin, and
+        // stopping criterion in this struct applies to both schedules.
+        CollapseSchedule Schedule{CollapseSchedule::Greedy};
+
+        // IndependentSets only. Fraction of the cheapest valid candidates that
+        // may be picked in one round. Smaller values follow the greedy order
+        // more closely at the cost of more rounds. Values above 1 are clamped
+        // to 1; values <= 0 (or NaN) consider one candidate per round.
+        double IndependentSetCandidateFraction{0.25};
+
         // Target number of faces. The algorithm stops when FaceCount() <= TargetFaces.
         // Set to 0 to use only the error threshold.
         std::size_t TargetFaces{0};
@@ -239,6 +277,13 @@ export namespace Geometry::Simplification
         // that owns the UVs (see PreserveUvSeams). Zero under ClassicalQEM or
         // when the mesh carries no texcoord property.
         std::size_t SeamVerticesPinned{0};
+
+        // Number of live vertices locked through LockedVertexProperty.
+        std::size_t LockedVerticesPinned{0};
+
+        // CollapseSchedule::IndependentSets: number of batched rounds run.
+        // Zero under Greedy.
+        std::size_t IndependentSetRounds{0};
     };
 
     // -------------------------------------------------------------------------
@@ -248,6 +293,11 @@ export namespace Geometry::Simplification
     // Modifies the mesh in-place. After simplification, call
     // mesh.GarbageCollection() to compact the storage.
     //
+    // The initial face data and the first evaluation of every edge run on
+    // Core::Parallel under both schedules (serially without a scheduler);
+    // collapses themselves are applied one at a time because they rewrite
+    // shared connectivity and deletion state.
+    //
     // Returns nullopt if the mesh cannot be simplified (e.g., too few faces,
     // non-manifold input, or all collapses violate the link condition).
     [[nodiscard]] std::optional<Result> Simplify(
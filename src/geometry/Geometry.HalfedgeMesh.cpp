@@ -4,6 +4,9 @@ module;
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <numbers>
 #include <optional>
@@ -19,6 +22,7 @@ module Geometry.HalfedgeMesh;
 
 import Geometry.HalfedgeMesh.Fwd;
 import Geometry.Properties;
+import Extrinsic.Core.Parallel;
 
 namespace Geometry::HalfedgeMesh
 {
@@ -573,6 +577,313 @@ namespace Geometry::HalfedgeMesh
         return f;
     }
 
+    namespace
+    {
+        namespace Parallel = Extrinsic::Core::Parallel;
+
+        constexpr std::uint32_t kNoCorner = std::numeric_limits<std::uint32_t>::max();
+
+        // Undirected edge of a face corner (the corner's vertex and the next
+        // vertex of its face), smaller vertex index in the high word.
+        struct CornerEdge
+        {
+            std::uint64_t Key = 0;
+            std::uint32_t Corner = 0;
+        };
+
+        [[nodiscard]] std::uint64_t UndirectedEdgeKey(const std::uint32_t a, const std::uint32_t b) noexcept
+        {
+            return (static_cast<std::uint64_t>(std::min(a, b)) << 32u) | static_cast<std::uint64_t>(std::max(a, b));
+        }
+
+        struct BoundaryHalfedge
+        {
+            std::uint32_t From = 0;
+            std::uint32_t Halfedge = 0;
+        };
+
+        [[nodiscard]] bool BothValid(const bool lhs, const bool rhs) noexcept
+        {
+            return lhs && rhs;
+        }
+    }
+
+    bool Mesh::BuildFromPolygons(std::span<const glm::vec3> positions,
+                                 std::span<const std::size_t> faceOffsets,
+                                 std::span<const std::uint32_t> faceIndices)
+    {
+        Clear();
+
+        const std::size_t vertexCount = positions.size();
+        const std::size_t cornerCount = faceIndices.size();
+        // Every corner owns at most one edge, so 2 * cornerCount bounds the
+        // halfedge count.
+        if (faceOffsets.empty() || faceOffsets.front() != 0u || faceOffsets.back() != cornerCount ||
+            vertexCount >= kInvalidIndex || cornerCount >= kInvalidIndex / 2u)
+        {
+            return false;
+        }
+
+        const std::size_t faceCount = faceOffsets.size() - 1u;
+        const Parallel::IndexRange vertexRange{0u, vertexCount};
+        const Parallel::IndexRange faceRange{0u, faceCount};
+        const Parallel::IndexRange cornerRange{0u, cornerCount};
+        const auto fail = [this]()
+        {
+            Clear();
+            return false;
+        };
+
+        // Corner c runs from faceIndices[c] to faceIndices[nextCorner[c]].
+        std::vector<std::uint32_t> nextCorner(cornerCount);
+        std::vector<CornerEdge> edges(cornerCount);
+        const bool facesValid = Parallel::ParallelReduce(faceRange, Parallel::AutoGrain, true,
+            [&](const Parallel::IndexRange range, const bool valid)
+            {
+                for (std::size_t f = range.Begin; f < range.End; ++f)
+                {
+                    const std::size_t begin = faceOffsets[f];
+                    const std::size_t end = faceOffsets[f + 1u];
+                    if (end < begin + 3u || end > cornerCount)
+                    {
+                        return false;
+                    }
+                    for (std::size_t c = begin; c < end; ++c)
+                    {
+                        const std::uint32_t vertex = faceIndices[c];
+                        const auto previous = faceIndices.begin() + static_cast<std::ptrdiff_t>(c);
+                        if (vertex >= vertexCount ||
+                            std::find(faceIndices.begin() + static_cast<std::ptrdiff_t>(begin), previous, vertex) != previous)
+                        {
+                            return false;
+                        }
+                        const std::size_t next = c + 1u < end ? c + 1u : begin;
+                        nextCorner[c] = static_cast<std::uint32_t>(next);
+                        edges[c] = CornerEdge{UndirectedEdgeKey(vertex, faceIndices[next]), static_cast<std::uint32_t>(c)};
+                    }
+                }
+                return valid;
+            },
+            BothValid);
+        if (!facesValid)
+        {
+            return fail();
+        }
+
+        // The sort is stable, so a run of equal keys lists its corners in
+        // face order and the run's first corner is the edge's first use.
+        Parallel::ParallelStableSort(std::span<CornerEdge>{edges}, [](const CornerEdge& lhs, const CornerEdge& rhs)
+        {
+            return lhs.Key < rhs.Key;
+        });
+
+        std::vector<std::uint32_t> twin(cornerCount, kNoCorner);
+        std::vector<std::uint32_t> firstUse(cornerCount, 0u);
+        const bool edgesManifold = Parallel::ParallelReduce(cornerRange, Parallel::AutoGrain, true,
+            [&](const Parallel::IndexRange range, const bool valid)
+            {
+                for (std::size_t i = range.Begin; i < range.End; ++i)
+                {
+                    const std::uint64_t key = edges[i].Key;
+                    if (i > 0u && edges[i - 1u].Key == key)
+                    {
+                        continue;
+                    }
+                    const std::uint32_t first = edges[i].Corner;
+                    firstUse[first] = 1u;
+                    if (i + 1u == cornerCount || edges[i + 1u].Key != key)
+                    {
+                        continue;
+                    }
+                    // A third face on the edge, or a second face running the
+                    // same way, cannot be paired.
+                    const std::uint32_t second = edges[i + 1u].Corner;
+                    if ((i + 2u < cornerCount && edges[i + 2u].Key == key) || faceIndices[first] == faceIndices[second])
+                    {
+                        return false;
+                    }
+                    twin[first] = second;
+                    twin[second] = first;
+                }
+                return valid;
+            },
+            BothValid);
+        if (!edgesManifold)
+        {
+            return fail();
+        }
+
+        // Edges are numbered by first use, which travels along the even
+        // halfedge just as NewEdge(start, end) lays it out for AddFace.
+        std::vector<std::uint32_t> edgeOfCorner(cornerCount);
+        Parallel::ParallelScan<std::uint32_t>(firstUse, edgeOfCorner, 0u, std::plus<>{}, Parallel::ScanKind::Exclusive);
+        const std::size_t edgeCount = cornerCount == 0u ? 0u : edgeOfCorner.back() + firstUse.back();
+        std::vector<std::uint32_t> halfedgeOfCorner(cornerCount);
+        Parallel::ParallelFor(cornerRange, Parallel::AutoGrain, [&](const std::size_t c)
+        {
+            halfedgeOfCorner[c] = firstUse[c] != 0u ? 2u * edgeOfCorner[c] : 2u * edgeOfCorner[twin[c]] + 1u;
+        });
+
+        m_Vertices.Resize(vertexCount);
+        m_Edges.Resize(edgeCount);
+        m_Halfedges.Resize(2u * edgeCount);
+        m_Faces.Resize(faceCount);
+
+        // Spans are taken once up front; per-element property access marks
+        // the storage modified and must not run on worker threads.
+        const std::span<glm::vec3> points = m_VPoint.Span();
+        const std::span<VertexConnectivity> vertexConnectivity = m_VConn.Span();
+        const std::span<HalfedgeConnectivity> halfedgeConnectivity = m_HConn.Span();
+        const std::span<HalfedgeFaceConnectivity> halfedgeFaces =
+            m_Halfedges.Get<HalfedgeFaceConnectivity>("h:face").Span();
+        const std::span<FaceConnectivity> faceConnectivity = m_FConn.Span();
+
+        Parallel::ParallelFor(vertexRange, Parallel::AutoGrain, [&](const Parallel::IndexRange range)
+        {
+            std::copy(positions.begin() + static_cast<std::ptrdiff_t>(range.Begin),
+                      positions.begin() + static_cast<std::ptrdiff_t>(range.End),
+                      points.begin() + static_cast<std::ptrdiff_t>(range.Begin));
+        });
+
+        // A face writes only its own halfedges and, for unpaired corners, the
+        // boundary halfedge opposite them.
+        Parallel::ParallelFor(faceRange, Parallel::AutoGrain, [&](const std::size_t f)
+        {
+            const std::size_t begin = faceOffsets[f];
+            const std::size_t end = faceOffsets[f + 1u];
+            for (std::size_t c = begin; c < end; ++c)
+            {
+                const std::uint32_t h = halfedgeOfCorner[c];
+                const std::uint32_t next = nextCorner[c];
+                const std::uint32_t hNext = halfedgeOfCorner[next];
+                halfedgeConnectivity[h].Vertex = VertexHandle{faceIndices[next]};
+                halfedgeConnectivity[h].Next = HalfedgeHandle{hNext};
+                halfedgeConnectivity[hNext].Prev = HalfedgeHandle{h};
+                halfedgeFaces[h].Face = FaceHandle{static_cast<PropertyIndex>(f)};
+                if (twin[c] == kNoCorner)
+                {
+                    halfedgeConnectivity[h ^ 1u].Vertex = VertexHandle{faceIndices[c]};
+                }
+            }
+            faceConnectivity[f].Halfedge = HalfedgeHandle{halfedgeOfCorner[end - 1u]};
+        });
+
+        // Boundary halfedges, sorted by the vertex they leave. A vertex with
+        // two of them has two separate fans.
+        std::vector<std::uint32_t> boundarySlot(cornerCount);
+        Parallel::ParallelFor(cornerRange, Parallel::AutoGrain, [&](const std::size_t c)
+        {
+            boundarySlot[c] = twin[c] == kNoCorner ? 1u : 0u;
+        });
+        const std::size_t lastIsBoundary = cornerCount == 0u ? 0u : boundarySlot.back();
+        Parallel::ParallelScan<std::uint32_t>(boundarySlot, boundarySlot, 0u, std::plus<>{}, Parallel::ScanKind::Exclusive);
+        const std::size_t boundaryCount = cornerCount == 0u ? 0u : boundarySlot.back() + lastIsBoundary;
+        std::vector<BoundaryHalfedge> boundary(boundaryCount);
+        Parallel::ParallelFor(cornerRange, Parallel::AutoGrain, [&](const std::size_t c)
+        {
+            if (twin[c] == kNoCorner)
+            {
+                boundary[boundarySlot[c]] = BoundaryHalfedge{faceIndices[nextCorner[c]], halfedgeOfCorner[c] ^ 1u};
+            }
+        });
+        Parallel::ParallelStableSort(std::span<BoundaryHalfedge>{boundary},
+                                     [](const BoundaryHalfedge& lhs, const BoundaryHalfedge& rhs)
+        {
+            return lhs.From < rhs.From;
+        });
+
+        std::vector<std::uint32_t> boundaryOut(vertexCount, kInvalidIndex);
+        const Parallel::IndexRange boundaryRange{0u, boundaryCount};
+        const bool singleBoundaryGap = Parallel::ParallelReduce(boundaryRange, Parallel::AutoGrain, true,
+            [&](const Parallel::IndexRange range, const bool valid)
+            {
+                for (std::size_t i = range.Begin; i < range.End; ++i)
+                {
+                    if (i > 0u && boundary[i - 1u].From == boundary[i].From)
+                    {
+                        return false;
+                    }
+                    boundaryOut[boundary[i].From] = boundary[i].Halfedge;
+                }
+                return valid;
+            },
+            BothValid);
+        if (!singleBoundaryGap)
+        {
+            return fail();
+        }
+
+        // Each vertex has as many boundary halfedges arriving as leaving, so
+        // every boundary halfedge continues with the one leaving its end.
+        const bool boundaryClosed = Parallel::ParallelReduce(boundaryRange, Parallel::AutoGrain, true,
+            [&](const Parallel::IndexRange range, const bool valid)
+            {
+                for (std::size_t i = range.Begin; i < range.End; ++i)
+                {
+                    const std::uint32_t h = boundary[i].Halfedge;
+                    const std::uint32_t next = boundaryOut[halfedgeConnectivity[h].Vertex.Index];
+                    if (next == kInvalidIndex)
+                    {
+                        return false;
+                    }
+                    halfedgeConnectivity[h].Next = HalfedgeHandle{next};
+                    halfedgeConnectivity[next].Prev = HalfedgeHandle{h};
+                }
+                return valid;
+            },
+            BothValid);
+        if (!boundaryClosed)
+        {
+            return fail();
+        }
+
+        // Any outgoing halfedge serves an interior vertex; a single serial
+        // pass keeps these scattered writes race-free. Boundary vertices start
+        // at their boundary halfedge, as AddFace leaves them.
+        for (std::size_t c = 0; c < cornerCount; ++c)
+        {
+            vertexConnectivity[faceIndices[c]].Halfedge = HalfedgeHandle{halfedgeOfCorner[c]};
+        }
+        Parallel::ParallelFor(vertexRange, Parallel::AutoGrain, [&](const std::size_t v)
+        {
+            if (boundaryOut[v] != kInvalidIndex)
+            {
+                vertexConnectivity[v].Halfedge = HalfedgeHandle{boundaryOut[v]};
+            }
+        });
+
+        // Rotating around a vertex reaches every halfedge leaving it only
+        // when its faces form a single fan, so the rotations cover all
+        // halfedges exactly when every vertex is manifold.
+        const std::size_t halfedgeCount = 2u * edgeCount;
+        const std::size_t rotated = Parallel::ParallelReduce(vertexRange, Parallel::AutoGrain, std::size_t{0},
+            [&](const Parallel::IndexRange range, std::size_t count)
+            {
+                for (std::size_t v = range.Begin; v < range.End && count <= halfedgeCount; ++v)
+                {
+                    const HalfedgeHandle start = vertexConnectivity[v].Halfedge;
+                    if (!start.IsValid())
+                    {
+                        continue;
+                    }
+                    HalfedgeHandle h = start;
+                    do
+                    {
+                        ++count;
+                        h = halfedgeConnectivity[h.Index ^ 1u].Next;
+                    }
+                    while (h != start && count <= halfedgeCount);
+                }
+                return count;
+            },
+            std::plus<>{});
+        if (rotated != halfedgeCount)
+        {
+            return fail();
+        }
+        return true;
+    }
+
     std::size_t Mesh::Valence(VertexHandle v) const
     {
         std::size_t count = 0;
@@ -51,6 +51,20 @@ export namespace Geometry::HalfedgeMesh
         [[nodiscard]] std::optional<FaceHandle> AddTriangle(VertexHandle v0, VertexHandle v1, VertexHandle v2);
         [[nodiscard]] std::optional<FaceHandle> AddQuad(VertexHandle v0, VertexHandle v1, VertexHandle v2, VertexHandle v3);
 
+        // Bulk construction: replaces the mesh with `positions` and the
+        // polygons faceIndices[faceOffsets[f], faceOffsets[f + 1]). Twin
+        // halfedges are paired by a parallel sort of undirected edge keys
+        // rather than per-face AddFace lookups. Edges are numbered by first
+        // use, so halfedges, edges and faces get the indices AddFace gives
+        // them for the same face order. Returns false and leaves the mesh
+        // empty unless the polygons form an oriented manifold: every edge has
+        // at most two faces running in opposite directions, no face repeats a
+        // vertex, and the faces around each vertex form a single fan. AddFace
+        // accepts some of the rejected inputs, so callers fall back to it.
+        [[nodiscard]] bool BuildFromPolygons(std::span<const glm::vec3> positions,
+                                             std::span<const std::size_t> faceOffsets,
+                                             std::span<const std::uint32_t> faceIndices);
+
         void Clear();
         void FreeMemory();
         void Reserve(std::size_t nVertices, std::size_t nEdges, std::size_t nFaces);
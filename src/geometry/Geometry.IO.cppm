@@ -29,6 +29,7 @@ export namespace Geometry::IO
         TXT,
         XYZRGB,
         PCD,
+        LAS,
         TGF,
         EdgeList,
     };
@@ -70,10 +71,11 @@ namespace Geometry::IO
         inline constexpr std::array<std::string_view, 1> TxtAliases{"txt"};
         inline constexpr std::array<std::string_view, 1> XyzRgbAliases{"xyzrgb"};
         inline constexpr std::array<std::string_view, 1> PcdAliases{"pcd"};
+        inline constexpr std::array<std::string_view, 1> LasAliases{"las"};
         inline constexpr std::array<std::string_view, 1> TgfAliases{"tgf"};
         inline constexpr std::array<std::string_view, 1> EdgeAliases{"edges"};
 
-        inline constexpr std::array<GeometryIOFormatInfo, 14> Formats{{
+        inline constexpr std::array<GeometryIOFormatInfo, 15> Formats{{
             {Kind::OBJ, "obj", ObjAliases, MeshOnly, MeshOnly, false, false},
             {Kind::OFF, "off", OffAliases, MeshOnly, MeshOnly, false, false},
             {Kind::STL, "stl", StlAliases, MeshOnly, MeshOnly, true, true},
@@ -86,6 +88,7 @@ namespace Geometry::IO
             {Kind::TXT, "txt", TxtAliases, PointCloudOnly, NoDomains, false, false},
             {Kind::XYZRGB, "xyzrgb", XyzRgbAliases, PointCloudOnly, NoDomains, false, false},
             {Kind::PCD, "pcd", PcdAliases, PointCloudOnly, PointCloudOnly, true, true},
+            {Kind::LAS, "las", LasAliases, PointCloudOnly, NoDomains, true, false},
             {Kind::TGF, "tgf", TgfAliases, GraphOnly, GraphOnly, false, false},
             {Kind::EdgeList, "edges", EdgeAliases, GraphOnly, GraphOnly, false, false},
         }};
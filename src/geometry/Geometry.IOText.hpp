@@ -89,9 +89,10 @@ namespace Geometry::IOText
         return true;
     }
 
-    [[nodiscard]] inline std::vector<std::string_view> SplitWhitespace(std::string_view line)
+    // Refills `tokens` in place so per-line parsing loops reuse one buffer.
+    inline void SplitWhitespace(std::string_view line, std::vector<std::string_view>& tokens)
     {
-        std::vector<std::string_view> tokens;
+        tokens.clear();
         std::size_t cursor = 0;
         while (cursor < line.size())
         {
@@ -109,9 +110,41 @@ namespace Geometry::IOText
                 tokens.emplace_back(line.substr(start, cursor - start));
             }
         }
+    }
+
+    [[nodiscard]] inline std::vector<std::string_view> SplitWhitespace(std::string_view line)
+    {
+        std::vector<std::string_view> tokens;
+        SplitWhitespace(line, tokens);
         return tokens;
     }
 
+    // Cuts `body` into pieces of about chunkBytes that each end right after a
+    // '\n' (the last one at the end of body), so no line straddles two pieces.
+    [[nodiscard]] inline std::vector<std::string_view> SplitLineAlignedChunks(std::string_view body,
+                                                                             std::size_t chunkBytes)
+    {
+        const std::size_t step = chunkBytes > 0 ? chunkBytes : 1u;
+        std::vector<std::string_view> chunks;
+        chunks.reserve(body.size() / step + 1u);
+        std::size_t begin = 0;
+        while (begin < body.size())
+        {
+            std::size_t end = body.size();
+            if (body.size() - begin > step)
+            {
+                const std::size_t newline = body.find('\n', begin + step - 1u);
+                if (newline != std::string_view::npos)
+                {
+                    end = newline + 1u;
+                }
+            }
+            chunks.push_back(body.substr(begin, end - begin));
+            begin = end;
+        }
+        return chunks;
+    }
+
     template <class T>
     [[nodiscard]] std::optional<T> ParseNumber(std::string_view token)
     {
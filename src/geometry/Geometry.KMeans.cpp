@@ -1,15 +1,19 @@
 module;
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <numeric>
 #include <optional>
 #include <random>
 #include <span>
+#include <utility>
 #include <vector>
 
 #include <glm/geometric.hpp>
@@ -18,6 +22,7 @@ module;
 module Geometry.KMeans;
 
 import Geometry.KDTree;
+import Extrinsic.Core.Parallel;
 
 namespace Geometry::KMeans
 {
@@ -184,38 +189,427 @@ namespace Geometry::KMeans
                 centroids, cpuScratch->CentroidTreeBuildParams).has_value();
         }
 
-        [[nodiscard]] std::optional<std::pair<uint32_t, float>> FindNearestCentroid(
-            const glm::vec3& point,
-            std::span<const glm::vec3> centroids,
-            CpuScratch* cpuScratch)
+        namespace Parallel = Extrinsic::Core::Parallel;
+
+        // Chunking only depends on n, so the assignment partials (farthest
+        // point, evaluation count, change and non-finite flags) reduce in
+        // the same order for every thread count. The cap bounds the number
+        // of partials the reduction combines.
+        constexpr std::size_t kMinAssignGrain = 4096;
+        constexpr std::size_t kMaxAssignChunks = 256;
+        // Relative slack applied to every bound so float rounding in the
+        // bound updates can never skip a scan brute force would resolve
+        // differently.
+        constexpr float kBoundEpsilon = 4.0f * std::numeric_limits<float>::epsilon();
+        // MiniBatch seeding runs the configured initializer on this many
+        // batches' worth of randomly drawn points instead of the full input.
+        constexpr std::size_t kMiniBatchSeedBatches = 16;
+        constexpr uint32_t kInvalidLabel = std::numeric_limits<uint32_t>::max();
+
+        [[nodiscard]] std::size_t AssignGrain(const std::size_t count) noexcept
         {
-            if (centroids.empty() || !IsFiniteVec3(point))
-                return std::nullopt;
+            return std::max(kMinAssignGrain, (count + kMaxAssignChunks - 1u) / kMaxAssignChunks);
+        }
+
+        // Four-wide vectors through the GCC/Clang vector extension. They
+        // lower to SSE on the x86-64 baseline and widen under -march=native.
+        using Float4 = float __attribute__((vector_size(16)));
+        using Int4 = int32_t __attribute__((vector_size(16)));
+
+        // Centroids are scanned eight at a time, as two independent Float4
+        // accumulators so consecutive compare/select chains overlap.
+        constexpr std::size_t kLanes = 8;
+
+        // Centroid coordinates as separate arrays, padded to a multiple of
+        // kLanes with centroids at infinity that never win a comparison.
+        struct CentroidSoA
+        {
+            std::vector<float> X{};
+            std::vector<float> Y{};
+            std::vector<float> Z{};
+
+            void Assign(std::span<const glm::vec3> centroids)
+            {
+                const std::size_t padded = (centroids.size() + kLanes - 1u) / kLanes * kLanes;
+                X.assign(padded, std::numeric_limits<float>::infinity());
+                Y.assign(padded, std::numeric_limits<float>::infinity());
+                Z.assign(padded, std::numeric_limits<float>::infinity());
+                for (std::size_t c = 0; c < centroids.size(); ++c)
+                {
+                    X[c] = centroids[c].x;
+                    Y[c] = centroids[c].y;
+                    Z[c] = centroids[c].z;
+                }
+            }
+        };
+
+        struct NearestPair
+        {
+            uint32_t Cluster = 0;
+            float DistanceSquared = 0.0f;
+            float SecondDistanceSquared = std::numeric_limits<float>::infinity();
+        };
+
+        // Per-lane running nearest, second-nearest and nearest index.
+        struct LaneNearest
+        {
+            Float4 Best{};
+            Float4 Second{};
+            Int4 Index{};
+        };
+
+        [[nodiscard]] Float4 LoadFloat4(const float* data) noexcept
+        {
+            Float4 v;
+            std::memcpy(&v, data, sizeof(v));
+            return v;
+        }
+
+        [[nodiscard]] Float4 Select(const Int4 mask, const Float4 a, const Float4 b) noexcept
+        {
+            return std::bit_cast<Float4>((mask & std::bit_cast<Int4>(a)) | (~mask & std::bit_cast<Int4>(b)));
+        }
+
+        void ScanFour(LaneNearest& lanes, const CentroidSoA& centroids, const std::size_t base,
+                      const Float4 px, const Float4 py, const Float4 pz) noexcept
+        {
+            // Separate statements keep FMA contraction out, so every lane is
+            // bitwise equal to SquaredDistance().
+            const Float4 dx = px - LoadFloat4(centroids.X.data() + base);
+            const Float4 dy = py - LoadFloat4(centroids.Y.data() + base);
+            const Float4 dz = pz - LoadFloat4(centroids.Z.data() + base);
+            const Float4 xx = dx * dx;
+            const Float4 yy = dy * dy;
+            const Float4 zz = dz * dz;
+            const Float4 d = xx + yy + zz;
+
+            const Int4 closer = d < lanes.Best;
+            const Float4 second = Select(d < lanes.Second, d, lanes.Second);
+            lanes.Second = Select(closer, lanes.Best, second);
+            lanes.Best = Select(closer, d, lanes.Best);
+            const Int4 index = Int4{0, 1, 2, 3} + static_cast<int32_t>(base);
+            lanes.Index = (closer & index) | (~closer & lanes.Index);
+        }
+
+        // Brute-force scan returning the nearest centroid and the distance to
+        // the second nearest. Ties resolve to the lowest index, the same as
+        // the scalar first-minimum loop this replaces.
+        [[nodiscard]] NearestPair FindTwoNearest(const glm::vec3& point, const CentroidSoA& centroids) noexcept
+        {
+            const float inf = std::numeric_limits<float>::infinity();
+            LaneNearest low{Float4{} + inf, Float4{} + inf, Int4{}};
+            LaneNearest high = low;
+            const Float4 px = Float4{} + point.x;
+            const Float4 py = Float4{} + point.y;
+            const Float4 pz = Float4{} + point.z;
+            for (std::size_t base = 0; base < centroids.X.size(); base += kLanes)
+            {
+                ScanFour(low, centroids, base, px, py, pz);
+                ScanFour(high, centroids, base + 4u, px, py, pz);
+            }
+
+            // Merge the two accumulators lane-wise, then the four lanes.
+            const Int4 takeHigh = (high.Best < low.Best) | ((high.Best == low.Best) & (high.Index < low.Index));
+            const Float4 keptSecond = Select(takeHigh, high.Second, low.Second);
+            const Float4 otherBest = Select(takeHigh, low.Best, high.Best);
+            const LaneNearest merged{
+                Select(takeHigh, high.Best, low.Best),
+                Select(keptSecond < otherBest, keptSecond, otherBest),
+                (takeHigh & high.Index) | (~takeHigh & low.Index),
+            };
+
+            int winner = 0;
+            for (int lane = 1; lane < 4; ++lane)
+            {
+                if (merged.Best[lane] < merged.Best[winner] ||
+                    (merged.Best[lane] == merged.Best[winner] && merged.Index[lane] < merged.Index[winner]))
+                {
+                    winner = lane;
+                }
+            }
+
+            NearestPair nearest{static_cast<uint32_t>(merged.Index[winner]), merged.Best[winner],
+                                merged.Second[winner]};
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                if (lane != winner)
+                    nearest.SecondDistanceSquared = std::min(nearest.SecondDistanceSquared, merged.Best[lane]);
+            }
+            return nearest;
+        }
+
+        // Per-iteration state shared by the assignment chunks.
+        struct AssignmentContext
+        {
+            std::span<const glm::vec3> Points{};
+            std::span<const glm::vec3> Centroids{};
+            const CentroidSoA* CentroidArrays = nullptr;
+            const CpuScratch* Scratch = nullptr;
+            std::span<const uint32_t> PreviousLabels{};
+            std::span<uint32_t> Labels{};
+            std::span<float> SquaredDistances{};
+            // Hamerly state; empty when every point needs a full scan.
+            std::span<float> LowerBounds{};
+            std::span<const float> HalfGaps{};
+            uint32_t MaxDriftCluster = 0;
+            float MaxDrift = 0.0f;
+            float SecondMaxDrift = 0.0f;
+            bool UseBounds = false;
+        };
+
+        struct AssignmentPartial
+        {
+            float MaxDistance = -1.0f;
+            uint32_t MaxDistanceIndex = 0;
+            uint64_t DistanceEvaluations = 0;
+            bool LabelChanged = false;
+            bool NonFinitePoint = false;
+        };
+
+        [[nodiscard]] NearestPair FullScan(const AssignmentContext& ctx,
+                                           const glm::vec3& point,
+                                           std::vector<KDTree::ElementIndex>& treeBuffer,
+                                           uint64_t& evaluations)
+        {
+            if (ctx.Scratch != nullptr && !ctx.Scratch->CentroidTree.Nodes().empty())
+            {
+                const uint32_t want = std::min<uint32_t>(2u, static_cast<uint32_t>(ctx.Centroids.size()));
+                const auto knn = ctx.Scratch->CentroidTree.QueryKNN(point, want, treeBuffer);
+                if (knn && !treeBuffer.empty() && treeBuffer.front() < ctx.Centroids.size())
+                {
+                    evaluations += knn->DistanceEvaluations;
+                    NearestPair nearest{treeBuffer.front(), SquaredDistance(point, ctx.Centroids[treeBuffer.front()])};
+                    if (treeBuffer.size() > 1u && treeBuffer[1] < ctx.Centroids.size())
+                        nearest.SecondDistanceSquared = SquaredDistance(point, ctx.Centroids[treeBuffer[1]]);
+                    return nearest;
+                }
+            }
+
+            evaluations += ctx.Centroids.size();
+            return FindTwoNearest(point, *ctx.CentroidArrays);
+        }
+
+        void AssignChunk(const AssignmentContext& ctx, const Parallel::IndexRange range, AssignmentPartial& partial)
+        {
+            std::vector<KDTree::ElementIndex> treeBuffer;
+
+            // Locals rather than partial members so the float stores below
+            // cannot alias the running totals.
+            float maxDistance = partial.MaxDistance;
+            uint32_t maxDistanceIndex = partial.MaxDistanceIndex;
+            uint64_t evaluations = 0;
+            bool labelChanged = false;
+            constexpr float kUpperSlack = (1.0f + kBoundEpsilon) * (1.0f + kBoundEpsilon);
+
+            for (std::size_t i = range.Begin; i < range.End; ++i)
+            {
+                const glm::vec3 point = ctx.Points[i];
+                if (!IsFiniteVec3(point))
+                {
+                    partial.NonFinitePoint = true;
+                    return;
+                }
+
+                const uint32_t previous = ctx.PreviousLabels[i];
+                uint32_t label = previous;
+                float distance2 = 0.0f;
+                bool resolved = false;
+
+                if (ctx.UseBounds)
+                {
+                    const float drift = previous == ctx.MaxDriftCluster ? ctx.SecondMaxDrift : ctx.MaxDrift;
+                    const float lower = (ctx.LowerBounds[i] - drift) * (1.0f - kBoundEpsilon);
+                    ctx.LowerBounds[i] = lower;
+
+                    distance2 = SquaredDistance(point, ctx.Centroids[previous]);
+                    ++evaluations;
+                    const float bound = std::max(lower, ctx.HalfGaps[previous]);
+                    resolved = distance2 * kUpperSlack < bound * bound;
+                }
+
+                if (!resolved)
+                {
+                    const NearestPair nearest = FullScan(ctx, point, treeBuffer, evaluations);
+                    label = nearest.Cluster;
+                    distance2 = nearest.DistanceSquared;
+                    if (!ctx.LowerBounds.empty())
+                        ctx.LowerBounds[i] = std::sqrt(nearest.SecondDistanceSquared) * (1.0f - kBoundEpsilon);
+                }
+
+                ctx.Labels[i] = label;
+                ctx.SquaredDistances[i] = distance2;
+                if (distance2 > maxDistance)
+                {
+                    maxDistance = distance2;
+                    maxDistanceIndex = static_cast<uint32_t>(i);
+                }
+                labelChanged = labelChanged || label != previous;
+            }
+
+            partial.MaxDistance = maxDistance;
+            partial.MaxDistanceIndex = maxDistanceIndex;
+            partial.DistanceEvaluations += evaluations;
+            partial.LabelChanged = partial.LabelChanged || labelChanged;
+        }
+
+        [[nodiscard]] AssignmentPartial AssignAll(const AssignmentContext& ctx)
+        {
+            return Parallel::ParallelReduce(
+                Parallel::IndexRange{0, ctx.Points.size()},
+                AssignGrain(ctx.Points.size()),
+                AssignmentPartial{},
+                [&ctx](const Parallel::IndexRange range, AssignmentPartial partial)
+                {
+                    AssignChunk(ctx, range, partial);
+                    return partial;
+                },
+                [](AssignmentPartial a, AssignmentPartial b)
+                {
+                    if (b.MaxDistance > a.MaxDistance)
+                    {
+                        a.MaxDistance = b.MaxDistance;
+                        a.MaxDistanceIndex = b.MaxDistanceIndex;
+                    }
+                    a.DistanceEvaluations += b.DistanceEvaluations;
+                    a.LabelChanged = a.LabelChanged || b.LabelChanged;
+                    a.NonFinitePoint = a.NonFinitePoint || b.NonFinitePoint;
+                    return a;
+                });
+        }
+
+        // Float sums and inertia accumulated serially in index order. The
+        // summation order never depends on the chunking above, so centroids
+        // and inertia are bit-identical at any thread count. One streaming
+        // pass, no distance work.
+        [[nodiscard]] float AccumulateClusters(std::span<const glm::vec3> points,
+                                               std::span<const uint32_t> labels,
+                                               std::span<const float> squaredDistances,
+                                               std::vector<glm::vec3>& sums,
+                                               std::vector<uint32_t>& counts)
+        {
+            std::fill(sums.begin(), sums.end(), glm::vec3(0.0f));
+            std::fill(counts.begin(), counts.end(), 0u);
+
+            float inertia = 0.0f;
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                sums[labels[i]] += points[i];
+                ++counts[labels[i]];
+                inertia += squaredDistances[i];
+            }
+            return inertia;
+        }
 
-            if (cpuScratch != nullptr && !cpuScratch->CentroidTree.Nodes().empty())
+        // Half the distance from each centroid to its nearest other centroid.
+        void ComputeHalfGaps(std::span<const glm::vec3> centroids, std::vector<float>& halfGaps)
+        {
+            halfGaps.assign(centroids.size(), std::numeric_limits<float>::infinity());
+            for (std::size_t a = 0; a < centroids.size(); ++a)
             {
-                auto& nearest = cpuScratch->QueryBuffer;
-                if (cpuScratch->CentroidTree.QueryKNN(point, 1u, nearest) && !nearest.empty())
+                for (std::size_t b = a + 1u; b < centroids.size(); ++b)
                 {
-                    const uint32_t bestCluster = nearest.front();
-                    if (bestCluster < centroids.size())
-                        return std::pair<uint32_t, float>{bestCluster, SquaredDistance(point, centroids[bestCluster])};
+                    const float gap = 0.5f * std::sqrt(SquaredDistance(centroids[a], centroids[b])) *
+                        (1.0f - kBoundEpsilon);
+                    halfGaps[a] = std::min(halfGaps[a], gap);
+                    halfGaps[b] = std::min(halfGaps[b], gap);
                 }
             }
+        }
+
+        [[nodiscard]] std::optional<KMeansResult> ClusterMiniBatch(
+            std::span<const glm::vec3> points,
+            std::span<const glm::vec3> initialCentroids,
+            const KMeansParams& params,
+            const uint32_t k,
+            KMeansResult result)
+        {
+            std::mt19937 rng(params.Seed);
+            std::uniform_int_distribution<std::size_t> pick(0u, points.size() - 1u);
+            const std::size_t batchSize = std::min<std::size_t>(params.MiniBatchSize, points.size());
+
+            const std::size_t seedSampleSize = std::max<std::size_t>(k, batchSize * kMiniBatchSeedBatches);
+            if (seedSampleSize >= points.size())
+            {
+                result.Centroids = BuildInitialCentroids(points, initialCentroids, params, k);
+            }
+            else
+            {
+                std::vector<glm::vec3> sample(seedSampleSize);
+                for (glm::vec3& p : sample)
+                    p = points[pick(rng)];
+                result.Centroids = BuildInitialCentroids(sample, initialCentroids, params, k);
+            }
+            if (result.Centroids.size() != k)
+                return std::nullopt;
+
+            CentroidSoA soa{};
+            std::vector<uint32_t> updateCounts(k, 0u);
+            std::vector<std::size_t> batch(batchSize);
+            std::vector<uint32_t> batchLabels(batchSize);
+            const float tol2 = params.ConvergenceTolerance * params.ConvergenceTolerance;
 
-            uint32_t bestCluster = 0;
-            float bestDistance = SquaredDistance(point, centroids[0]);
-            for (uint32_t c = 1; c < static_cast<uint32_t>(centroids.size()); ++c)
+            for (uint32_t iter = 0; iter < params.MaxIterations; ++iter)
             {
-                const float d = SquaredDistance(point, centroids[c]);
-                if (d < bestDistance)
+                for (std::size_t& index : batch)
+                    index = pick(rng);
+
+                soa.Assign(result.Centroids);
+                Parallel::ParallelFor(Parallel::IndexRange{0, batchSize}, kMinAssignGrain,
+                    [&](const Parallel::IndexRange range)
+                    {
+                        for (std::size_t b = range.Begin; b < range.End; ++b)
+                        {
+                            const glm::vec3& point = points[batch[b]];
+                            batchLabels[b] = IsFiniteVec3(point)
+                                ? FindTwoNearest(point, soa).Cluster
+                                : kInvalidLabel;
+                        }
+                    });
+                result.DistanceEvaluations += static_cast<uint64_t>(batchSize) * k;
+
+                // Sequential per-centroid learning-rate updates, in batch order.
+                const std::vector<glm::vec3> previous = result.Centroids;
+                for (std::size_t b = 0; b < batchSize; ++b)
                 {
-                    bestDistance = d;
-                    bestCluster = c;
+                    const uint32_t label = batchLabels[b];
+                    if (label == kInvalidLabel)
+                        continue;
+                    const float eta = 1.0f / static_cast<float>(++updateCounts[label]);
+                    result.Centroids[label] += eta * (points[batch[b]] - result.Centroids[label]);
+                }
+
+                float maxShift = 0.0f;
+                for (uint32_t c = 0; c < k; ++c)
+                    maxShift = std::max(maxShift, SquaredDistance(previous[c], result.Centroids[c]));
+
+                result.Iterations = iter + 1;
+                if (maxShift <= tol2)
+                {
+                    result.Converged = true;
+                    break;
                 }
             }
 
-            return std::pair<uint32_t, float>{bestCluster, bestDistance};
+            soa.Assign(result.Centroids);
+            const std::vector<uint32_t> noLabels(points.size(), 0u);
+            const AssignmentContext ctx{
+                .Points = points,
+                .Centroids = result.Centroids,
+                .CentroidArrays = &soa,
+                .PreviousLabels = noLabels,
+                .Labels = result.Labels,
+                .SquaredDistances = result.SquaredDistances,
+            };
+            const AssignmentPartial assignment = AssignAll(ctx);
+            if (assignment.NonFinitePoint)
+                return std::nullopt;
+
+            std::vector<glm::vec3> sums(k, glm::vec3(0.0f));
+            std::vector<uint32_t> counts(k, 0u);
+            result.Inertia = AccumulateClusters(points, result.Labels, result.SquaredDistances, sums, counts);
+            result.MaxDistanceIndex = assignment.MaxDistanceIndex;
+            result.DistanceEvaluations += assignment.DistanceEvaluations;
+            return result;
         }
     }
 
@@ -236,58 +630,65 @@ namespace Geometry::KMeans
         if (k == 0)
             return std::nullopt;
 
+        if (params.Update == UpdateMode::MiniBatch && params.MiniBatchSize == 0)
+            return std::nullopt;
+
         KMeansResult result{};
         result.RequestedBackend = params.Compute;
         result.ActualBackend = Backend::CPU;
         result.FellBackToCPU = params.Compute != Backend::CPU;
         result.Labels.assign(points.size(), 0u);
         result.SquaredDistances.assign(points.size(), 0.0f);
+        if (params.Update == UpdateMode::MiniBatch)
+            return ClusterMiniBatch(points, initialCentroids, params, k, std::move(result));
+
         result.Centroids = BuildInitialCentroids(points, initialCentroids, params, k);
         if (result.Centroids.size() != k)
             return std::nullopt;
 
+        CentroidSoA soa{};
         std::vector<glm::vec3> sums(k, glm::vec3(0.0f));
         std::vector<uint32_t> counts(k, 0u);
         std::vector<uint32_t> nextLabels(points.size(), 0u);
+        std::vector<float> lowerBounds(points.size(), 0.0f);
+        std::vector<float> halfGaps{};
+        uint32_t maxDriftCluster = 0;
+        float maxDrift = 0.0f;
+        float secondMaxDrift = 0.0f;
 
         const float tol2 = params.ConvergenceTolerance * params.ConvergenceTolerance;
-        bool anyLabelChanged = true;
 
         for (uint32_t iter = 0; iter < params.MaxIterations; ++iter)
         {
-            std::fill(sums.begin(), sums.end(), glm::vec3(0.0f));
-            std::fill(counts.begin(), counts.end(), 0u);
             static_cast<void>(RebuildCentroidTree(result.Centroids, cpuScratch));
-
-            float inertia = 0.0f;
-            float maxDistance = -1.0f;
-            uint32_t maxDistanceIndex = 0;
-            anyLabelChanged = false;
-
-            for (std::size_t i = 0; i < points.size(); ++i)
-            {
-                const auto assignment = FindNearestCentroid(points[i], result.Centroids, cpuScratch);
-                if (!assignment)
-                    return std::nullopt;
-
-                const auto [bestCluster, bestDistance] = *assignment;
-                nextLabels[i] = bestCluster;
-                result.SquaredDistances[i] = bestDistance;
-                sums[bestCluster] += points[i];
-                ++counts[bestCluster];
-                inertia += bestDistance;
-
-                if (bestDistance > maxDistance)
-                {
-                    maxDistance = bestDistance;
-                    maxDistanceIndex = static_cast<uint32_t>(i);
-                }
-
-                if (nextLabels[i] != result.Labels[i])
-                    anyLabelChanged = true;
-            }
+            soa.Assign(result.Centroids);
+            ComputeHalfGaps(result.Centroids, halfGaps);
+
+            const AssignmentContext ctx{
+                .Points = points,
+                .Centroids = result.Centroids,
+                .CentroidArrays = &soa,
+                .Scratch = cpuScratch,
+                .PreviousLabels = result.Labels,
+                .Labels = nextLabels,
+                .SquaredDistances = result.SquaredDistances,
+                .LowerBounds = lowerBounds,
+                .HalfGaps = halfGaps,
+                .MaxDriftCluster = maxDriftCluster,
+                .MaxDrift = maxDrift,
+                .SecondMaxDrift = secondMaxDrift,
+                .UseBounds = iter > 0,
+            };
+            const AssignmentPartial assignment = AssignAll(ctx);
+            if (assignment.NonFinitePoint)
+                return std::nullopt;
+            result.DistanceEvaluations += assignment.DistanceEvaluations;
+            const float inertia = AccumulateClusters(points, nextLabels, result.SquaredDistances, sums, counts);
 
             float maxShift = 0.0f;
+            maxDriftCluster = 0;
+            maxDrift = 0.0f;
+            secondMaxDrift = 0.0f;
             for (uint32_t c = 0; c < k; ++c)
             {
                 glm::vec3 nextCentroid = result.Centroids[c];
@@ -297,19 +698,34 @@ namespace Geometry::KMeans
                 }
                 else
                 {
-                    nextCentroid = points[maxDistanceIndex];
+                    nextCentroid = points[assignment.MaxDistanceIndex];
                 }
 
-                maxShift = std::max(maxShift, SquaredDistance(result.Centroids[c], nextCentroid));
+                const float shift = SquaredDistance(result.Centroids[c], nextCentroid);
+                maxShift = std::max(maxShift, shift);
                 result.Centroids[c] = nextCentroid;
+
+                // Lower bounds shrink by the largest drift of any centroid
+                // other than the point's own.
+                const float drift = std::sqrt(shift) * (1.0f + kBoundEpsilon);
+                if (drift > maxDrift)
+                {
+                    secondMaxDrift = maxDrift;
+                    maxDrift = drift;
+                    maxDriftCluster = c;
+                }
+                else if (drift > secondMaxDrift)
+                {
+                    secondMaxDrift = drift;
+                }
             }
 
             result.Iterations = iter + 1;
             result.Inertia = inertia;
-            result.MaxDistanceIndex = maxDistanceIndex;
-            result.Labels = nextLabels;
+            result.MaxDistanceIndex = assignment.MaxDistanceIndex;
+            result.Labels.swap(nextLabels);
 
-            if (!anyLabelChanged || maxShift <= tol2)
+            if (!assignment.LabelChanged || maxShift <= tol2)
             {
                 result.Converged = true;
                 break;
@@ -28,6 +28,15 @@ export namespace Geometry::KMeans
         KMeansPlusPlus = 2,
     };
 
+    enum class UpdateMode : uint8_t
+    {
+        // Full-batch Lloyd iterations over every point.
+        Exact = 0,
+        // Sculley-style mini-batch updates on MiniBatchSize random points
+        // per iteration, followed by one full assignment pass.
+        MiniBatch = 1,
+    };
+
     struct KMeansParams
     {
         uint32_t ClusterCount = 8;
@@ -36,6 +45,8 @@ export namespace Geometry::KMeans
         uint32_t Seed = 42;
         Initialization Init = Initialization::Hierarchical;
         Backend Compute = Backend::CPU;
+        UpdateMode Update = UpdateMode::Exact;
+        uint32_t MiniBatchSize = 4096;
     };
 
     struct KMeansResult
@@ -50,6 +61,8 @@ export namespace Geometry::KMeans
         Backend RequestedBackend = Backend::CPU;
         Backend ActualBackend = Backend::CPU;
         bool FellBackToCPU = false;
+        // Point-to-centroid distances evaluated by the CPU assignment steps.
+        uint64_t DistanceEvaluations = 0;
     };
 
     struct CpuScratch
@@ -71,13 +84,29 @@ export namespace Geometry::KMeans
     //   - random or farthest-point-style hierarchical seeding,
     //   - returns labels, squared distances, centroids, inertia, and farthest sample.
     //
+    // CPU backend:
+    //   - the assignment step runs in fixed-size chunks on Core::Parallel
+    //     and scans SoA centroid arrays; centroid sums and inertia are then
+    //     accumulated in float in one serial pass in index order, so
+    //     results are bit-identical for every thread count,
+    //   - Hamerly bounds (one upper and one lower bound per point) skip the
+    //     full centroid scan for points whose assigned centroid is provably
+    //     still the nearest; the bounds carry a few ulps of slack, so labels
+    //     equal a brute-force Lloyd assignment against the same centroids,
+    //   - UpdateMode::MiniBatch seeds from a random sample, moves centroids
+    //     with per-centroid learning rates on MiniBatchSize points per
+    //     iteration, and finishes with one exact assignment pass. It is
+    //     meant for inputs too large for full Lloyd iterations.
+    //
     // Robustness:
-    //   - returns nullopt for empty input or zero requested clusters,
+    //   - returns nullopt for empty input, zero requested clusters, a zero
+    //     mini-batch size in MiniBatch mode, or non-finite points,
     //   - clamps k <= n,
     //   - re-seeds empty clusters from the farthest currently assigned point.
     //
     // Complexity:
-    //   - Time: O(n * k * iters)
+    //   - Time: O(n * k * iters) worst case; O(n * iters) once the bounds
+    //     skip most scans. MiniBatch: O(b * k * iters + n * k).
     //   - Space: O(n + k)
     [[nodiscard]] std::optional<KMeansResult> Cluster(
         std::span<const glm::vec3> points,
@@ -92,7 +121,8 @@ export namespace Geometry::KMeans
     //
     // CPU scratch owns only temporary acceleration structures. In particular,
     // the implementation rebuilds the centroid KD-tree each iteration because
-    // centroid positions are mutable within the solve.
+    // centroid positions are mutable within the solve, and answers the full
+    // scans the bounds cannot skip with two-nearest tree queries.
     [[nodiscard]] std::optional<KMeansResult> Cluster(
         std::span<const glm::vec3> points,
         std::span<const glm::vec3> initialCentroids,
@@ -6,10 +6,12 @@ module;
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -21,6 +23,7 @@ import Geometry.Grid;
 import Geometry.HalfedgeMesh;
 import Geometry.Handle;
 import Geometry.Properties;
+import Extrinsic.Core.Parallel;
 
 namespace Geometry::MarchingCubes
 {
@@ -61,7 +64,7 @@ namespace Geometry::MarchingCubes
         0x230, 0x339, 0x033, 0x13a, 0x636, 0x73f, 0x435, 0x53c,
         0xa3c, 0xb35, 0x83f, 0x936, 0xe3a, 0xf33, 0xc39, 0xd30,
         0x3a0, 0x2a9, 0x1a3, 0x0aa, 0x7a6, 0x6af, 0x5a5, 0x4ac,
-        0xba4, 0xaad, 0x9a7, 0x8ae, 0xfaa, 0xea3, 0xda9, 0xca0,
+        0xbac, 0xaa5, 0x9af, 0x8a6, 0xfaa, 0xea3, 0xda9, 0xca0,
         0x460, 0x569, 0x663, 0x76a, 0x066, 0x16f, 0x265, 0x36c,
         0xc6c, 0xd65, 0xe6f, 0xf66, 0x86a, 0x963, 0xa69, 0xb60,
         0x5f0, 0x4f9, 0x7f3, 0x6fa, 0x1f6, 0x0ff, 0x3f5, 0x2fc,
@@ -78,7 +81,7 @@ namespace Geometry::MarchingCubes
         0x2fc, 0x3f5, 0x0ff, 0x1f6, 0x6fa, 0x7f3, 0x4f9, 0x5f0,
         0xb60, 0xa69, 0x963, 0x86a, 0xf66, 0xe6f, 0xd65, 0xc6c,
         0x36c, 0x265, 0x16f, 0x066, 0x76a, 0x663, 0x569, 0x460,
-        0xca0, 0xda9, 0xea3, 0xfaa, 0x8ae, 0x9a7, 0xaad, 0xba4,
+        0xca0, 0xda9, 0xea3, 0xfaa, 0x8a6, 0x9af, 0xaa5, 0xbac,
         0x4ac, 0x5a5, 0x6af, 0x7a6, 0x0aa, 0x1a3, 0x2a9, 0x3a0,
         0xd30, 0xc39, 0xf33, 0xe3a, 0x936, 0x83f, 0xb35, 0xa3c,
         0x53c, 0x435, 0x73f, 0x636, 0x13a, 0x033, 0x339, 0x230,
@@ -351,16 +354,6 @@ namespace Geometry::MarchingCubes
     };
     // NOLINTEND(readability-magic-numbers)
 
-    // =========================================================================
-    // Edge endpoint vertex pairs
-    // =========================================================================
-    // For each of the 12 cube edges, the two vertex indices it connects.
-    static constexpr std::array<std::array<int, 2>, 12> kEdgeVertices = {{
-        {0, 1}, {1, 2}, {2, 3}, {3, 0},  // bottom face
-        {4, 5}, {5, 6}, {6, 7}, {7, 4},  // top face
-        {0, 4}, {1, 5}, {2, 6}, {3, 7},  // vertical edges
-    }};
-
     // Cube vertex offsets: dx, dy, dz relative to cell origin
     static constexpr std::array<std::array<int, 3>, 8> kVertexOffsets = {{
         {0,0,0}, {1,0,0}, {1,1,0}, {0,1,0},
@@ -499,10 +492,218 @@ namespace Geometry::MarchingCubes
         return {gx, gy, gz};
     }
 
+    namespace
+    {
+        namespace Parallel = Extrinsic::Core::Parallel;
+
+        // Number of triangles kTriTable emits for each cube configuration.
+        constexpr std::array<std::uint8_t, 256> kTriangleCounts = []
+        {
+            std::array<std::uint8_t, 256> counts{};
+            for (std::size_t c = 0; c < 256; ++c)
+            {
+                std::uint8_t n = 0;
+                while (n < 5 && kTriTable[c][3 * n] != -1)
+                    ++n;
+                counts[c] = n;
+            }
+            return counts;
+        }();
+
+        // Isovalue crossing on an edge whose lower vertex holds f0 and upper
+        // vertex f1.
+        [[nodiscard]] float EdgeParameter(float f0, float f1, float iso)
+        {
+            float t = 0.5f;
+            const float denom = f1 - f0;
+            if (std::abs(denom) > 1e-10f)
+                t = (iso - f0) / denom;
+            return std::clamp(t, 0.0f, 1.0f);
+        }
+
+        [[nodiscard]] glm::vec3 InterpolateNormal(const glm::vec3& g0, const glm::vec3& g1, float t)
+        {
+            const glm::vec3 grad = g0 + t * (g1 - g0);
+            const float len = glm::length(grad);
+            if (len > 1e-10f)
+                return grad / len;
+            return {0.0f, 1.0f, 0.0f};
+        }
+
+        // Slab s of a box covers vertex layer z = MinZ + s, which owns the
+        // crossing edges starting on it, and (below MaxZ) cell layer z.
+        // Layer index tables hold, per axis, the output index of the edge
+        // starting at each vertex of the layer.
+        struct DenseSlabs
+        {
+            const Grid::DenseGrid& Grid;
+            const ConstProperty<float>& Scalar;
+            const CellBox& Box;
+            const MarchingCubesParams& Params;
+            std::size_t Width{0};  // vertices per row
+            std::size_t Height{0}; // rows per layer
+
+            [[nodiscard]] float At(std::size_t x, std::size_t y, std::size_t z) const
+            {
+                return Scalar[Grid.Dimensions().LinearIndex(x, y, z)];
+            }
+
+            [[nodiscard]] std::size_t LayerSlot(int axis, std::size_t x, std::size_t y) const
+            {
+                return (static_cast<std::size_t>(axis) * Height + (y - Box.MinY)) * Width + (x - Box.MinX);
+            }
+
+            [[nodiscard]] uint8_t CubeIndex(std::size_t cx, std::size_t cy, std::size_t cz) const
+            {
+                uint8_t cubeIndex = 0;
+                for (int v = 0; v < 8; ++v)
+                {
+                    if (At(cx + static_cast<std::size_t>(kVertexOffsets[v][0]),
+                           cy + static_cast<std::size_t>(kVertexOffsets[v][1]),
+                           cz + static_cast<std::size_t>(kVertexOffsets[v][2])) < Params.Isovalue)
+                        cubeIndex |= static_cast<uint8_t>(1u << v);
+                }
+                return cubeIndex;
+            }
+
+            // Calls fn(x, y, axis, f0, f1) for each crossing edge owned by
+            // vertex layer z, in output order.
+            template <class F>
+            void ForEachLayerEdge(std::size_t z, F&& fn) const
+            {
+                const float iso = Params.Isovalue;
+                for (std::size_t y = Box.MinY; y <= Box.MaxY; ++y)
+                {
+                    for (std::size_t x = Box.MinX; x <= Box.MaxX; ++x)
+                    {
+                        const float f0 = At(x, y, z);
+                        const bool inside = f0 < iso;
+                        if (x < Box.MaxX)
+                        {
+                            const float f1 = At(x + 1, y, z);
+                            if ((f1 < iso) != inside)
+                                fn(x, y, 0, f0, f1);
+                        }
+                        if (y < Box.MaxY)
+                        {
+                            const float f1 = At(x, y + 1, z);
+                            if ((f1 < iso) != inside)
+                                fn(x, y, 1, f0, f1);
+                        }
+                        if (z < Box.MaxZ)
+                        {
+                            const float f1 = At(x, y, z + 1);
+                            if ((f1 < iso) != inside)
+                                fn(x, y, 2, f0, f1);
+                        }
+                    }
+                }
+            }
+
+            [[nodiscard]] std::size_t CountVertices(std::size_t z) const
+            {
+                std::size_t count = 0;
+                ForEachLayerEdge(z, [&](std::size_t, std::size_t, int, float, float) { ++count; });
+                return count;
+            }
+
+            [[nodiscard]] std::size_t CountTriangles(std::size_t z) const
+            {
+                std::size_t count = 0;
+                for (std::size_t cy = Box.MinY; cy < Box.MaxY; ++cy)
+                    for (std::size_t cx = Box.MinX; cx < Box.MaxX; ++cx)
+                        count += kTriangleCounts[CubeIndex(cx, cy, z)];
+                return count;
+            }
+
+            // Numbers the crossing edges of vertex layer z from `offset` into
+            // `layer`; with `result`, also writes their vertices.
+            void IndexLayer(std::size_t z, std::size_t offset, std::vector<std::size_t>& layer,
+                            MarchingCubesResult* result) const
+            {
+                const auto& dims = Grid.Dimensions();
+                const auto& scalar = Scalar;
+                const auto& grid = Grid;
+                ForEachLayerEdge(z, [&](std::size_t x, std::size_t y, int axis, float f0, float f1)
+                {
+                    const std::size_t index = offset++;
+                    layer[LayerSlot(axis, x, y)] = index;
+                    if (result == nullptr)
+                        return;
+
+                    const std::size_t x1 = x + (axis == 0 ? 1u : 0u);
+                    const std::size_t y1 = y + (axis == 1 ? 1u : 0u);
+                    const std::size_t z1 = z + (axis == 2 ? 1u : 0u);
+                    const float t = EdgeParameter(f0, f1, Params.Isovalue);
+                    const glm::vec3 p0 = dims.WorldPosition(x, y, z);
+                    const glm::vec3 p1 = dims.WorldPosition(x1, y1, z1);
+                    result->Vertices[index] = p0 + t * (p1 - p0);
+
+                    if (Params.ComputeNormals)
+                    {
+                        result->Normals[index] = InterpolateNormal(
+                            ComputeGradientDense(grid, scalar, x, y, z),
+                            ComputeGradientDense(grid, scalar, x1, y1, z1), t);
+                    }
+                });
+            }
+
+            // Writes the triangles of cell layer z from `offset`; `lower` and
+            // `upper` index vertex layers z and z + 1.
+            void EmitTriangles(std::size_t z, const std::vector<std::size_t>& lower,
+                               const std::vector<std::size_t>& upper, std::size_t offset,
+                               MarchingCubesResult& result) const
+            {
+                for (std::size_t cy = Box.MinY; cy < Box.MaxY; ++cy)
+                {
+                    for (std::size_t cx = Box.MinX; cx < Box.MaxX; ++cx)
+                    {
+                        const uint8_t cubeIndex = CubeIndex(cx, cy, z);
+                        if (kTriangleCounts[cubeIndex] == 0)
+                            continue;
+
+                        std::array<std::size_t, 12> vertIdx{};
+                        const uint16_t edges = kEdgeTable[cubeIndex];
+                        for (int e = 0; e < 12; ++e)
+                        {
+                            if (!(edges & (1u << e)))
+                                continue;
+                            const auto& ek = kEdgeKeys[e];
+                            const auto& layer = ek.dz != 0 ? upper : lower;
+                            vertIdx[static_cast<std::size_t>(e)] = layer[LayerSlot(ek.axis,
+                                cx + static_cast<std::size_t>(ek.dx), cy + static_cast<std::size_t>(ek.dy))];
+                        }
+
+                        const int8_t* tri = kTriTable[cubeIndex];
+                        for (int i = 0; tri[i] != -1; i += 3)
+                        {
+                            result.Triangles[offset++] = {
+                                vertIdx[static_cast<std::size_t>(tri[i])],
+                                vertIdx[static_cast<std::size_t>(tri[i + 1])],
+                                vertIdx[static_cast<std::size_t>(tri[i + 2])]
+                            };
+                        }
+                    }
+                }
+            }
+        };
+    }
+
     std::optional<MarchingCubesResult> Extract(
         const Grid::DenseGrid& grid,
         const MarchingCubesParams& params,
         std::string_view scalarPropertyName)
+    {
+        const auto& dims = grid.Dimensions();
+        const CellBox box{0, 0, 0, dims.NX, dims.NY, dims.NZ};
+        return Extract(grid, box, params, scalarPropertyName);
+    }
+
+    std::optional<MarchingCubesResult> Extract(
+        const Grid::DenseGrid& grid,
+        const CellBox& box,
+        const MarchingCubesParams& params,
+        std::string_view scalarPropertyName)
     {
         const auto& dims = grid.Dimensions();
         if (!dims.IsValid())
@@ -516,144 +717,318 @@ namespace Geometry::MarchingCubes
         if (grid.Cells().Size() != dims.VertexCount())
             return std::nullopt;
 
-        const auto nx = dims.NX;
-        const auto ny = dims.NY;
-        const auto nz = dims.NZ;
-        const float iso = params.Isovalue;
+        if (box.IsEmpty() || box.MaxX > dims.NX || box.MaxY > dims.NY || box.MaxZ > dims.NZ)
+            return std::nullopt;
+
+        const DenseSlabs slabs{
+            .Grid = grid,
+            .Scalar = scalarProp,
+            .Box = box,
+            .Params = params,
+            .Width = box.MaxX - box.MinX + 1,
+            .Height = box.MaxY - box.MinY + 1};
+        const std::size_t slabCount = box.MaxZ - box.MinZ + 1;
+
+        // Phase 1: per-slab vertex and triangle counts.
+        std::vector<std::size_t> vertexCounts(slabCount, 0u);
+        std::vector<std::size_t> triangleCounts(slabCount, 0u);
+        Parallel::ParallelFor(Parallel::IndexRange{0u, slabCount}, Parallel::AutoGrain, [&](std::size_t s)
+        {
+            const std::size_t z = box.MinZ + s;
+            vertexCounts[s] = slabs.CountVertices(z);
+            if (z < box.MaxZ)
+                triangleCounts[s] = slabs.CountTriangles(z);
+        });
+
+        // Phase 2: output offsets.
+        std::vector<std::size_t> vertexOffsets(slabCount, 0u);
+        std::vector<std::size_t> triangleOffsets(slabCount, 0u);
+        Parallel::ParallelScan<std::size_t>(vertexCounts, vertexOffsets, 0u, std::plus<>{},
+                                            Parallel::ScanKind::Exclusive);
+        Parallel::ParallelScan<std::size_t>(triangleCounts, triangleOffsets, 0u, std::plus<>{},
+                                            Parallel::ScanKind::Exclusive);
+        const std::size_t vertexTotal = vertexOffsets.back() + vertexCounts.back();
+        const std::size_t triangleTotal = triangleOffsets.back() + triangleCounts.back();
+        if (triangleTotal == 0)
+            return std::nullopt;
 
         MarchingCubesResult result;
+        result.Vertices.resize(vertexTotal);
+        if (params.ComputeNormals)
+            result.Normals.resize(vertexTotal);
+        result.Triangles.resize(triangleTotal);
+
+        // Phase 3: emit. A chunk numbers each vertex layer once where it can:
+        // the upper layer of one slab is the lower layer of the next, and the
+        // chunk writes its vertices when it owns that next slab.
+        const std::size_t layerSize = 3 * slabs.Width * slabs.Height;
+        Parallel::ParallelFor(Parallel::IndexRange{0u, slabCount}, Parallel::AutoGrain,
+            [&](const Parallel::IndexRange chunk)
+        {
+            std::vector<std::size_t> lower(layerSize);
+            std::vector<std::size_t> upper(layerSize);
+            bool lowerReady = false;
+            for (std::size_t s = chunk.Begin; s < chunk.End; ++s)
+            {
+                const std::size_t z = box.MinZ + s;
+                if (!lowerReady)
+                    slabs.IndexLayer(z, vertexOffsets[s], lower, &result);
+                if (z == box.MaxZ)
+                    break;
+
+                const bool ownsNext = s + 1 < chunk.End;
+                slabs.IndexLayer(z + 1, vertexOffsets[s + 1], upper, ownsNext ? &result : nullptr);
+                slabs.EmitTriangles(z, lower, upper, triangleOffsets[s], result);
+                std::swap(lower, upper);
+                lowerReady = ownsNext;
+            }
+        });
+
+        result.VertexCount = result.Vertices.size();
+        result.TriangleCount = result.Triangles.size();
+
+        return result;
+    }
+
+    // =========================================================================
+    // SparseGrid extraction
+    // =========================================================================
 
-        // Vertex welding map
-        const std::size_t totalGridVerts = dims.VertexCount();
-        const std::size_t edgeMapSize = 3 * totalGridVerts;
-        constexpr std::size_t kNoVertex = std::numeric_limits<std::size_t>::max();
-        std::vector<std::size_t> edgeVertexMap(edgeMapSize, kNoVertex);
+    namespace
+    {
+        constexpr std::size_t kBlockSize = Grid::SparseGrid::BlockSize;
+        constexpr std::size_t kCornerSide = kBlockSize + 1;
 
-        auto edgeSlot = [&](std::size_t gx, std::size_t gy, std::size_t gz, int axis) -> std::size_t
+        struct SparseBlock
         {
-            return 3 * (gz * (ny + 1) * (nx + 1) + gy * (nx + 1) + gx)
-                   + static_cast<std::size_t>(axis);
+            std::size_t BX{0};
+            std::size_t BY{0};
+            std::size_t BZ{0};
+            std::size_t Base{0};
         };
 
-        // Pre-compute gradients at grid vertices (if normals requested)
-        std::vector<glm::vec3> gradients;
-        if (params.ComputeNormals)
+        // Value at grid vertex (x, y, z), or nullopt if it is outside the
+        // grid, in an unallocated block, or NaN.
+        [[nodiscard]] std::optional<float> SampleSparse(
+            const Grid::SparseGrid& grid,
+            const ConstProperty<float>& scalar,
+            std::int64_t x, std::int64_t y, std::int64_t z)
         {
-            gradients.resize(totalGridVerts);
-            for (std::size_t z = 0; z <= nz; ++z)
-                for (std::size_t y = 0; y <= ny; ++y)
-                    for (std::size_t x = 0; x <= nx; ++x)
-                        gradients[dims.LinearIndex(x, y, z)] =
-                            ComputeGradientDense(grid, scalarProp, x, y, z);
+            if (!grid.InBounds(static_cast<int>(x), static_cast<int>(y), static_cast<int>(z)))
+                return std::nullopt;
+
+            const auto index = grid.VertexIndex(
+                static_cast<std::size_t>(x), static_cast<std::size_t>(y), static_cast<std::size_t>(z));
+            if (!index.has_value())
+                return std::nullopt;
+
+            const float value = scalar[*index];
+            if (std::isnan(value))
+                return std::nullopt;
+            return value;
         }
 
-        // Accessor lambda for the scalar field
-        auto at = [&](std::size_t ax, std::size_t ay, std::size_t az) -> float
+        // Central differences where both neighbours are available, one-sided
+        // otherwise; matches ComputeGradientDense on a fully allocated grid.
+        [[nodiscard]] glm::vec3 ComputeGradientSparse(
+            const Grid::SparseGrid& grid,
+            const ConstProperty<float>& scalar,
+            std::size_t x, std::size_t y, std::size_t z,
+            float center)
+        {
+            const auto& spacing = grid.Dimensions().Spacing;
+            const std::array<std::int64_t, 3> p{
+                static_cast<std::int64_t>(x), static_cast<std::int64_t>(y), static_cast<std::int64_t>(z)};
+
+            glm::vec3 gradient{0.0f};
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                std::array<std::int64_t, 3> lo = p;
+                std::array<std::int64_t, 3> hi = p;
+                --lo[static_cast<std::size_t>(axis)];
+                ++hi[static_cast<std::size_t>(axis)];
+
+                const auto fm = SampleSparse(grid, scalar, lo[0], lo[1], lo[2]);
+                const auto fp = SampleSparse(grid, scalar, hi[0], hi[1], hi[2]);
+                const float h = spacing[axis];
+
+                if (fm.has_value() && fp.has_value())
+                    gradient[axis] = (*fp - *fm) / (2.0f * h);
+                else if (fp.has_value())
+                    gradient[axis] = (*fp - center) / h;
+                else if (fm.has_value())
+                    gradient[axis] = (center - *fm) / h;
+            }
+            return gradient;
+        }
+    }
+
+    std::optional<MarchingCubesResult> Extract(
+        const Grid::SparseGrid& grid,
+        const MarchingCubesParams& params,
+        std::string_view scalarPropertyName)
+    {
+        const auto& dims = grid.Dimensions();
+        if (!dims.IsValid())
+            return std::nullopt;
+
+        auto scalarProp = grid.GetProperty<float>(scalarPropertyName);
+        if (!scalarProp.IsValid())
+            return std::nullopt;
+
+        std::vector<SparseBlock> blocks;
+        blocks.reserve(grid.AllocatedBlockCount());
+        grid.ForEachBlock([&](std::size_t bx, std::size_t by, std::size_t bz, std::size_t base)
+        {
+            blocks.push_back({bx, by, bz, base});
+        });
+        std::sort(blocks.begin(), blocks.end(), [](const SparseBlock& a, const SparseBlock& b)
         {
-            return scalarProp[dims.LinearIndex(ax, ay, az)];
+            if (a.BZ != b.BZ) return a.BZ < b.BZ;
+            if (a.BY != b.BY) return a.BY < b.BY;
+            return a.BX < b.BX;
+        });
+
+        const float iso = params.Isovalue;
+        constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+        MarchingCubesResult result;
+
+        // Welding map keyed on the global grid edge (lower vertex, axis), so
+        // blocks processed independently still share boundary vertices.
+        std::unordered_map<std::uint64_t, std::size_t> edgeVertexMap;
+
+        // Corner values of one block plus its +1 layer from the seven
+        // neighbouring blocks; NaN where unavailable.
+        std::array<float, kCornerSide * kCornerSide * kCornerSide> corners{};
+        const auto cornerIndex = [](std::size_t lx, std::size_t ly, std::size_t lz)
+        {
+            return (lz * kCornerSide + ly) * kCornerSide + lx;
         };
 
-        // Process each cell
-        for (std::size_t cz = 0; cz < nz; ++cz)
+        for (const SparseBlock& block : blocks)
         {
-            for (std::size_t cy = 0; cy < ny; ++cy)
+            const std::size_t ox = block.BX * kBlockSize;
+            const std::size_t oy = block.BY * kBlockSize;
+            const std::size_t oz = block.BZ * kBlockSize;
+            if (ox >= dims.NX || oy >= dims.NY || oz >= dims.NZ)
+                continue;
+
+            // Base index of this block and its +x/+y/+z neighbours, indexed by
+            // dx | dy << 1 | dz << 2.
+            std::array<std::optional<std::size_t>, 8> bases{};
+            for (std::size_t n = 0; n < 8; ++n)
             {
-                for (std::size_t cx = 0; cx < nx; ++cx)
-                {
-                    uint8_t cubeIndex = 0;
-                    std::array<float, 8> val{};
-                    for (int v = 0; v < 8; ++v)
+                const std::size_t dx = n & 1u;
+                const std::size_t dy = (n >> 1) & 1u;
+                const std::size_t dz = (n >> 2) & 1u;
+                bases[n] = n == 0
+                    ? std::optional<std::size_t>{block.Base}
+                    : grid.VertexIndex(ox + dx * kBlockSize, oy + dy * kBlockSize, oz + dz * kBlockSize);
+            }
+
+            for (std::size_t lz = 0; lz < kCornerSide; ++lz)
+                for (std::size_t ly = 0; ly < kCornerSide; ++ly)
+                    for (std::size_t lx = 0; lx < kCornerSide; ++lx)
                     {
-                        std::size_t gx = cx + static_cast<std::size_t>(kVertexOffsets[v][0]);
-                        std::size_t gy = cy + static_cast<std::size_t>(kVertexOffsets[v][1]);
-                        std::size_t gz = cz + static_cast<std::size_t>(kVertexOffsets[v][2]);
-                        val[static_cast<std::size_t>(v)] = at(gx, gy, gz);
-                        if (val[static_cast<std::size_t>(v)] < iso)
-                            cubeIndex |= static_cast<uint8_t>(1u << v);
+                        const std::size_t n = (lx / kBlockSize) | ((ly / kBlockSize) << 1) | ((lz / kBlockSize) << 2);
+                        float value = kNaN;
+                        if (bases[n].has_value()
+                            && ox + lx <= dims.NX && oy + ly <= dims.NY && oz + lz <= dims.NZ)
+                        {
+                            const std::size_t local = ((lz % kBlockSize) * kBlockSize + (ly % kBlockSize)) * kBlockSize
+                                + (lx % kBlockSize);
+                            value = scalarProp[*bases[n] + local];
+                        }
+                        corners[cornerIndex(lx, ly, lz)] = value;
                     }
 
-                    uint16_t edges = kEdgeTable[cubeIndex];
-                    if (edges == 0)
-                        continue;
-
-                    std::array<std::size_t, 12> vertIdx{};
-
-                    for (int e = 0; e < 12; ++e)
+            for (std::size_t lz = 0; lz < kBlockSize && oz + lz < dims.NZ; ++lz)
+            {
+                for (std::size_t ly = 0; ly < kBlockSize && oy + ly < dims.NY; ++ly)
+                {
+                    for (std::size_t lx = 0; lx < kBlockSize && ox + lx < dims.NX; ++lx)
                     {
-                        if (!(edges & (1u << e)))
+                        uint8_t cubeIndex = 0;
+                        std::array<float, 8> val{};
+                        bool complete = true;
+                        for (int v = 0; v < 8; ++v)
+                        {
+                            const float f = corners[cornerIndex(
+                                lx + static_cast<std::size_t>(kVertexOffsets[v][0]),
+                                ly + static_cast<std::size_t>(kVertexOffsets[v][1]),
+                                lz + static_cast<std::size_t>(kVertexOffsets[v][2]))];
+                            if (std::isnan(f))
+                            {
+                                complete = false;
+                                break;
+                            }
+                            val[static_cast<std::size_t>(v)] = f;
+                            if (f < iso)
+                                cubeIndex |= static_cast<uint8_t>(1u << v);
+                        }
+                        if (!complete)
                             continue;
 
-                        const auto& ek = kEdgeKeys[e];
-                        std::size_t gx = cx + static_cast<std::size_t>(ek.dx);
-                        std::size_t gy = cy + static_cast<std::size_t>(ek.dy);
-                        std::size_t gz = cz + static_cast<std::size_t>(ek.dz);
-                        std::size_t slot = edgeSlot(gx, gy, gz, ek.axis);
+                        const uint16_t edges = kEdgeTable[cubeIndex];
+                        if (edges == 0)
+                            continue;
 
-                        if (edgeVertexMap[slot] != kNoVertex)
-                        {
-                            vertIdx[static_cast<std::size_t>(e)] = edgeVertexMap[slot];
-                        }
-                        else
+                        const std::size_t cx = ox + lx;
+                        const std::size_t cy = oy + ly;
+                        const std::size_t cz = oz + lz;
+
+                        std::array<std::size_t, 12> vertIdx{};
+                        for (int e = 0; e < 12; ++e)
                         {
-                            int v0 = kEdgeVertices[e][0];
-                            int v1 = kEdgeVertices[e][1];
-                            float f0 = val[static_cast<std::size_t>(v0)];
-                            float f1 = val[static_cast<std::size_t>(v1)];
-
-                            float t = 0.5f;
-                            float denom = f1 - f0;
-                            if (std::abs(denom) > 1e-10f)
-                                t = (iso - f0) / denom;
-                            t = std::clamp(t, 0.0f, 1.0f);
-
-                            auto gv0 = [&]() -> std::array<std::size_t, 3>
-                            {
-                                return {cx + static_cast<std::size_t>(kVertexOffsets[v0][0]),
-                                        cy + static_cast<std::size_t>(kVertexOffsets[v0][1]),
-                                        cz + static_cast<std::size_t>(kVertexOffsets[v0][2])};
-                            };
-                            auto gv1 = [&]() -> std::array<std::size_t, 3>
-                            {
-                                return {cx + static_cast<std::size_t>(kVertexOffsets[v1][0]),
-                                        cy + static_cast<std::size_t>(kVertexOffsets[v1][1]),
-                                        cz + static_cast<std::size_t>(kVertexOffsets[v1][2])};
-                            };
+                            if (!(edges & (1u << e)))
+                                continue;
+
+                            const auto& ek = kEdgeKeys[e];
+                            const std::uint64_t key = 3u * static_cast<std::uint64_t>(dims.LinearIndex(
+                                    cx + static_cast<std::size_t>(ek.dx),
+                                    cy + static_cast<std::size_t>(ek.dy),
+                                    cz + static_cast<std::size_t>(ek.dz)))
+                                + static_cast<std::uint64_t>(ek.axis);
 
-                            auto [x0, y0, z0] = gv0();
-                            auto [x1, y1, z1] = gv1();
+                            const auto [it, inserted] = edgeVertexMap.try_emplace(key, result.Vertices.size());
+                            vertIdx[static_cast<std::size_t>(e)] = it->second;
+                            if (!inserted)
+                                continue;
 
-                            glm::vec3 p0 = dims.WorldPosition(x0, y0, z0);
-                            glm::vec3 p1 = dims.WorldPosition(x1, y1, z1);
-                            glm::vec3 pos = p0 + t * (p1 - p0);
+                            // Interpolate from the edge's lower vertex, as the
+                            // dense extractor does.
+                            const std::size_t lx0 = lx + static_cast<std::size_t>(ek.dx);
+                            const std::size_t ly0 = ly + static_cast<std::size_t>(ek.dy);
+                            const std::size_t lz0 = lz + static_cast<std::size_t>(ek.dz);
+                            const std::size_t lx1 = lx0 + (ek.axis == 0 ? 1u : 0u);
+                            const std::size_t ly1 = ly0 + (ek.axis == 1 ? 1u : 0u);
+                            const std::size_t lz1 = lz0 + (ek.axis == 2 ? 1u : 0u);
+                            const float f0 = corners[cornerIndex(lx0, ly0, lz0)];
+                            const float f1 = corners[cornerIndex(lx1, ly1, lz1)];
+                            const float t = EdgeParameter(f0, f1, iso);
 
-                            std::size_t newIdx = result.Vertices.size();
-                            result.Vertices.push_back(pos);
+                            const glm::vec3 p0 = dims.WorldPosition(ox + lx0, oy + ly0, oz + lz0);
+                            const glm::vec3 p1 = dims.WorldPosition(ox + lx1, oy + ly1, oz + lz1);
+                            result.Vertices.push_back(p0 + t * (p1 - p0));
 
                             if (params.ComputeNormals)
                             {
-                                glm::vec3 g0 = gradients[dims.LinearIndex(x0, y0, z0)];
-                                glm::vec3 g1 = gradients[dims.LinearIndex(x1, y1, z1)];
-                                glm::vec3 grad = g0 + t * (g1 - g0);
-                                float len = glm::length(grad);
-                                if (len > 1e-10f)
-                                    result.Normals.push_back(grad / len);
-                                else
-                                    result.Normals.push_back({0.0f, 1.0f, 0.0f});
+                                result.Normals.push_back(InterpolateNormal(
+                                    ComputeGradientSparse(grid, scalarProp, ox + lx0, oy + ly0, oz + lz0, f0),
+                                    ComputeGradientSparse(grid, scalarProp, ox + lx1, oy + ly1, oz + lz1, f1), t));
                             }
-
-                            edgeVertexMap[slot] = newIdx;
-                            vertIdx[static_cast<std::size_t>(e)] = newIdx;
                         }
-                    }
 
-                    const int8_t* tri = kTriTable[cubeIndex];
-                    for (int i = 0; tri[i] != -1; i += 3)
-                    {
-                        result.Triangles.push_back({
-                            vertIdx[static_cast<std::size_t>(tri[i])],
-                            vertIdx[static_cast<std::size_t>(tri[i + 1])],
-                            vertIdx[static_cast<std::size_t>(tri[i + 2])]
-                        });
+                        const int8_t* tri = kTriTable[cubeIndex];
+                        for (int i = 0; tri[i] != -1; i += 3)
+                        {
+                            result.Triangles.push_back({
+                                vertIdx[static_cast<std::size_t>(tri[i])],
+                                vertIdx[static_cast<std::size_t>(tri[i + 1])],
+                                vertIdx[static_cast<std::size_t>(tri[i + 2])]
+                            });
+                        }
                     }
                 }
             }
@@ -39,7 +39,9 @@ export namespace Geometry::MarchingCubes
     // Vertex welding: Adjacent cells share edges. The implementation assigns
     // each edge a unique key based on axis direction and grid-vertex origin,
     // ensuring intersection vertices on shared edges are created once and
-    // reused, producing a watertight mesh without duplicate vertices.
+    // reused, producing a watertight mesh without duplicate vertices. Every
+    // edge is interpolated from its lower grid vertex, so both extractors
+    // produce bitwise-identical vertices for the same field.
 
     // -------------------------------------------------------------------------
     // Parameters and result
@@ -66,6 +68,22 @@ export namespace Geometry::MarchingCubes
         std::size_t TriangleCount{0};
     };
 
+    // Half-open range of grid cells [Min, Max) on each axis.
+    struct CellBox
+    {
+        std::size_t MinX{0};
+        std::size_t MinY{0};
+        std::size_t MinZ{0};
+        std::size_t MaxX{0};
+        std::size_t MaxY{0};
+        std::size_t MaxZ{0};
+
+        [[nodiscard]] bool IsEmpty() const noexcept
+        {
+            return MinX >= MaxX || MinY >= MaxY || MinZ >= MaxZ;
+        }
+    };
+
     // -------------------------------------------------------------------------
     // Extraction
     // -------------------------------------------------------------------------
@@ -77,8 +95,47 @@ export namespace Geometry::MarchingCubes
     //   - The grid dimensions are invalid
     //   - The named property does not exist or is not float
     //   - The isosurface is empty
+    //
+    // Runs in three phases over z-slabs (one grid-vertex layer plus the cell
+    // layer above it) on Core::Parallel: slabs count their crossing edges
+    // and triangles, an exclusive scan turns the counts into output offsets,
+    // and slabs then write vertices and triangles straight into the sized
+    // output arrays. Each crossing edge belongs to the slab of its lower
+    // vertex, so there is no shared welding map and no locking. Output order
+    // is by slab, then (y, x, axis) for vertices and (y, x) for cells, and
+    // is identical for every thread count, including without a scheduler.
+    [[nodiscard]] std::optional<MarchingCubesResult> Extract(
+        const Grid::DenseGrid& grid,
+        const MarchingCubesParams& params = {},
+        std::string_view scalarPropertyName = "scalar");
+
+    // Extract the isosurface inside a sub-box of a DenseGrid's cells, e.g.
+    // to stream a large grid in pieces. Vertices are welded within the box;
+    // crossings on a face shared with an adjacent box are emitted by both
+    // boxes at bitwise-identical positions. Normals sample the full grid, so
+    // they match the whole-grid extraction. Returns nullopt if the box is
+    // empty or exceeds the grid, plus the DenseGrid cases above.
     [[nodiscard]] std::optional<MarchingCubesResult> Extract(
         const Grid::DenseGrid& grid,
+        const CellBox& box,
+        const MarchingCubesParams& params = {},
+        std::string_view scalarPropertyName = "scalar");
+
+    // Extract an isosurface from a block-sparse grid.
+    //
+    // Only cells whose eight corners lie in allocated blocks are processed;
+    // corners with a NaN value also exclude their cells, so a caller can
+    // leave vertices outside its band of interest unevaluated. Blocks are
+    // visited in (z, y, x) block order and intersection vertices are welded
+    // through a hash keyed on the global grid edge, so a surface that
+    // crosses block boundaries stays watertight. Memory is proportional to
+    // the allocated blocks plus the output, not to the grid volume.
+    //
+    // For a fully allocated grid with no NaN values the output has the same
+    // vertices and triangles as the DenseGrid overload, in a different order.
+    // This overload runs serially.
+    [[nodiscard]] std::optional<MarchingCubesResult> Extract(
+        const Grid::SparseGrid& grid,
         const MarchingCubesParams& params = {},
         std::string_view scalarPropertyName = "scalar");
 
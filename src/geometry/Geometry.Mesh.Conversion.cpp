@@ -2,6 +2,7 @@ module;
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <span>
 #include <string>
 #include <string_view>
@@ -12,13 +13,74 @@ module;
 module Geometry.Mesh.Conversion;
 
 import Geometry.Properties;
+import Extrinsic.Core.Parallel;
 
 namespace Geometry::Mesh::Conversion
 {
     namespace
     {
+        namespace Parallel = Extrinsic::Core::Parallel;
+
         constexpr MeshSoup::Index kInvalidIndex = static_cast<MeshSoup::Index>(-1);
 
+        // Flattens the polygons into CSR form and hands them to the bulk
+        // halfedge builder.
+        [[nodiscard]] bool BuildHalfedgeMeshInBulk(HalfedgeMesh::Mesh& mesh, const MeshSoup::IndexedMeshView& view)
+        {
+            const std::size_t faceCount = view.Faces.size();
+            std::vector<std::size_t> offsets(faceCount + 1u, 0u);
+            Parallel::ParallelFor(Parallel::IndexRange{0u, faceCount}, Parallel::AutoGrain, [&](const std::size_t f)
+            {
+                offsets[f + 1u] = view.Faces[f].Indices.size();
+            });
+            Parallel::ParallelScan<std::size_t>(offsets, offsets, 0u, std::plus<>{}, Parallel::ScanKind::Inclusive);
+
+            std::vector<MeshSoup::Index> indices(offsets.back());
+            Parallel::ParallelFor(Parallel::IndexRange{0u, faceCount}, Parallel::AutoGrain, [&](const std::size_t f)
+            {
+                const std::vector<MeshSoup::Index>& face = view.Faces[f].Indices;
+                std::copy(face.begin(), face.end(), indices.begin() + static_cast<std::ptrdiff_t>(offsets[f]));
+            });
+            return mesh.BuildFromPolygons(view.Positions, offsets, indices);
+        }
+
+        // Incremental construction, face by face; reports the first face
+        // AddFace rejects.
+        void AddFacesIncrementally(ToHalfedgeMeshResult& result, const MeshSoup::IndexedMeshView& view)
+        {
+            std::vector<VertexHandle> vertices;
+            vertices.reserve(view.Positions.size());
+            for (const glm::vec3& position : view.Positions)
+            {
+                vertices.push_back(result.Mesh.AddVertex(position));
+            }
+
+            std::vector<VertexHandle> faceVertices;
+            for (std::size_t faceIndex = 0u; faceIndex < view.Faces.size(); ++faceIndex)
+            {
+                const MeshSoup::PolygonFace& face = view.Faces[faceIndex];
+                faceVertices.clear();
+                faceVertices.reserve(face.Indices.size());
+                for (const MeshSoup::Index index : face.Indices)
+                {
+                    faceVertices.push_back(vertices[index]);
+                }
+
+                if (!result.Mesh.AddFace(faceVertices))
+                {
+                    result.Diagnostics.push_back(ConversionDiagnostic{
+                        .Kind = ConversionDiagnosticKind::AddFaceFailed,
+                        .Severity = MeshSoup::ValidationSeverity::Error,
+                        .FaceIndex = faceIndex,
+                        .AttributeDomainValue = MeshSoup::AttributeDomain::Face,
+                        .AttributeName = "face vertex index",
+                        .Detail = "HalfedgeMesh::Mesh rejected the face topology",
+                    });
+                    return;
+                }
+            }
+        }
+
         void AppendValidationDiagnostics(std::vector<ConversionDiagnostic>& diagnostics,
                                          const MeshSoup::ValidationResult& validation)
         {
@@ -110,36 +172,16 @@ namespace Geometry::Mesh::Conversion
             return result;
         }
 
-        std::vector<VertexHandle> vertices;
-        vertices.reserve(view.Positions.size());
-        for (const glm::vec3& position : view.Positions)
+        // Validation already rejects most topology the bulk builder refuses;
+        // whatever remains (e.g. non-manifold vertices) takes the AddFace
+        // path so its failure diagnostics are unchanged.
+        if (!BuildHalfedgeMeshInBulk(result.Mesh, view))
         {
-            vertices.push_back(result.Mesh.AddVertex(position));
+            AddFacesIncrementally(result, view);
         }
-
-        std::vector<VertexHandle> faceVertices;
-        for (std::size_t faceIndex = 0u; faceIndex < view.Faces.size(); ++faceIndex)
+        if (HasErrors(result.Diagnostics))
         {
-            const MeshSoup::PolygonFace& face = view.Faces[faceIndex];
-            faceVertices.clear();
-            faceVertices.reserve(face.Indices.size());
-            for (const MeshSoup::Index index : face.Indices)
-            {
-                faceVertices.push_back(vertices[index]);
-            }
-
-            if (!result.Mesh.AddFace(faceVertices))
-            {
-                result.Diagnostics.push_back(ConversionDiagnostic{
-                    .Kind = ConversionDiagnosticKind::AddFaceFailed,
-                    .Severity = MeshSoup::ValidationSeverity::Error,
-                    .FaceIndex = faceIndex,
-                    .AttributeDomainValue = MeshSoup::AttributeDomain::Face,
-                    .AttributeName = "face vertex index",
-                    .Detail = "HalfedgeMesh::Mesh rejected the face topology",
-                });
-                return result;
-            }
+            return result;
         }
 
         if (view.VertexProperties != nullptr && view.VertexProperties->Properties().size() > 1u)
@@ -5,6 +5,7 @@ module;
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <span>
 #include <string>
 #include <string_view>
@@ -18,6 +19,7 @@ module;
 module Geometry.MeshSoup;
 
 import Geometry.Properties;
+import Extrinsic.Core.Parallel;
 
 namespace Geometry::MeshSoup
 {
@@ -189,17 +191,27 @@ namespace Geometry::MeshSoup
 
     namespace
     {
+        namespace Parallel = Extrinsic::Core::Parallel;
+
         constexpr Index kInvalidIndex = static_cast<Index>(-1);
 
+        // One face corner's edge; Corner is its position in face order.
         struct EdgeObservation
         {
+            std::uint64_t Key{0u};
             Index Start{kInvalidIndex};
             Index End{kInvalidIndex};
             std::size_t FaceIndex{static_cast<std::size_t>(-1)};
-            std::size_t IncidentCount{0u};
-            bool SameDirectedEdgeSeen{false};
-            bool NonManifoldReported{false};
-            bool WindingReported{false};
+            std::size_t Corner{0u};
+        };
+
+        struct TopologyEvent
+        {
+            std::size_t Corner{0u};
+            ValidationDiagnosticKind Kind{ValidationDiagnosticKind::NonManifoldEdge};
+            std::size_t FaceIndex{0u};
+            Index EdgeStart{kInvalidIndex};
+            Index EdgeEnd{kInvalidIndex};
         };
 
         struct PositionKey
@@ -421,19 +433,31 @@ namespace Geometry::MeshSoup
             return (static_cast<std::uint64_t>(lo) << 32u) | static_cast<std::uint64_t>(hi);
         }
 
+        // Edge observations are grouped by a stable parallel sort of their
+        // undirected keys, so each run lists one edge's corners in face order.
+        // A run reports its third corner as non-manifold and the first later
+        // corner repeating the first corner's direction as a winding flip;
+        // events are emitted in corner order, as a single face-order scan
+        // would find them.
         void AppendTopologyDiagnostics(ValidationResult& result,
                                        IndexedMeshView view,
                                        std::span<const std::uint8_t> validForTopology)
         {
-            std::vector<EdgeObservation> observations;
-            observations.reserve(CornerCount(view));
-            std::unordered_map<std::uint64_t, std::size_t> observationByEdge;
-            observationByEdge.reserve(CornerCount(view));
-            for (std::size_t faceIndex = 0u; faceIndex < view.Faces.size(); ++faceIndex)
+            const std::size_t faceCount = view.Faces.size();
+            const Parallel::IndexRange faceRange{0u, faceCount};
+            std::vector<std::size_t> faceOffsets(faceCount + 1u, 0u);
+            Parallel::ParallelFor(faceRange, Parallel::AutoGrain, [&](const std::size_t faceIndex)
+            {
+                faceOffsets[faceIndex + 1u] = validForTopology[faceIndex] ? view.Faces[faceIndex].Indices.size() : 0u;
+            });
+            Parallel::ParallelScan<std::size_t>(faceOffsets, faceOffsets, 0u, std::plus<>{}, Parallel::ScanKind::Inclusive);
+
+            std::vector<EdgeObservation> observations(faceOffsets.back());
+            Parallel::ParallelFor(faceRange, Parallel::AutoGrain, [&](const std::size_t faceIndex)
             {
                 if (!validForTopology[faceIndex])
                 {
-                    continue;
+                    return;
                 }
 
                 const PolygonFace& face = view.Faces[faceIndex];
@@ -441,58 +465,92 @@ namespace Geometry::MeshSoup
                 {
                     const Index start = face.Indices[i];
                     const Index end = face.Indices[(i + 1u) % face.Indices.size()];
-                    const std::uint64_t edgeKey = MakeUndirectedEdgeKey(start, end);
-                    const auto [edgeIt, inserted] = observationByEdge.try_emplace(edgeKey, observations.size());
-                    if (inserted)
-                    {
-                        observations.push_back(EdgeObservation{
-                            .Start = start,
-                            .End = end,
-                            .FaceIndex = faceIndex,
-                            .IncidentCount = 1u,
-                        });
-                        continue;
-                    }
+                    const std::size_t corner = faceOffsets[faceIndex] + i;
+                    observations[corner] = EdgeObservation{
+                        .Key = MakeUndirectedEdgeKey(start, end),
+                        .Start = start,
+                        .End = end,
+                        .FaceIndex = faceIndex,
+                        .Corner = corner,
+                    };
+                }
+            });
+            Parallel::ParallelStableSort(std::span<EdgeObservation>{observations},
+                                         [](const EdgeObservation& lhs, const EdgeObservation& rhs)
+            {
+                return lhs.Key < rhs.Key;
+            });
 
-                    EdgeObservation& edge = observations[edgeIt->second];
-                    ++edge.IncidentCount;
-                    if (edge.Start == start && edge.End == end)
+            const std::size_t observationCount = observations.size();
+            std::vector<TopologyEvent> events = Parallel::ParallelReduce(
+                Parallel::IndexRange{0u, observationCount}, Parallel::AutoGrain, std::vector<TopologyEvent>{},
+                [&](const Parallel::IndexRange range, std::vector<TopologyEvent> found)
+                {
+                    for (std::size_t first = range.Begin; first < range.End; ++first)
                     {
-                        edge.SameDirectedEdgeSeen = true;
+                        const EdgeObservation& edge = observations[first];
+                        if (first > 0u && observations[first - 1u].Key == edge.Key)
+                        {
+                            continue;
+                        }
+
+                        bool windingReported = false;
+                        for (std::size_t k = first + 1u; k < observationCount && observations[k].Key == edge.Key; ++k)
+                        {
+                            const EdgeObservation& other = observations[k];
+                            if (k == first + 2u)
+                            {
+                                found.push_back(TopologyEvent{
+                                    .Corner = other.Corner,
+                                    .Kind = ValidationDiagnosticKind::NonManifoldEdge,
+                                    .FaceIndex = other.FaceIndex,
+                                    .EdgeStart = std::min(other.Start, other.End),
+                                    .EdgeEnd = std::max(other.Start, other.End),
+                                });
+                            }
+                            if (!windingReported && other.Start == edge.Start && other.End == edge.End)
+                            {
+                                windingReported = true;
+                                found.push_back(TopologyEvent{
+                                    .Corner = other.Corner,
+                                    .Kind = ValidationDiagnosticKind::InconsistentWinding,
+                                    .FaceIndex = other.FaceIndex,
+                                    .EdgeStart = other.Start,
+                                    .EdgeEnd = other.End,
+                                });
+                            }
+                        }
                     }
+                    return found;
+                },
+                [](std::vector<TopologyEvent> lhs, std::vector<TopologyEvent> rhs)
+                {
+                    lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+                    return lhs;
+                });
 
-                    if (edge.IncidentCount > 2u && !edge.NonManifoldReported)
-                    {
-                        edge.NonManifoldReported = true;
-                        result.Diagnostics.push_back(ValidationDiagnostic{
-                            .Kind = ValidationDiagnosticKind::NonManifoldEdge,
-                            .Severity = ValidationSeverity::Error,
-                            .FaceIndex = faceIndex,
-                            .EdgeStart = std::min(start, end),
-                            .EdgeEnd = std::max(start, end),
-                            .AttributeName = {},
-                            .AttributeDomainValue = AttributeDomain::Face,
-                            .ExpectedCount = 2u,
-                            .ActualCount = edge.IncidentCount,
-                        });
-                    }
+            // At a shared corner the non-manifold report precedes the winding one.
+            std::ranges::sort(events, [](const TopologyEvent& lhs, const TopologyEvent& rhs)
+            {
+                const bool lhsWinding = lhs.Kind == ValidationDiagnosticKind::InconsistentWinding;
+                const bool rhsWinding = rhs.Kind == ValidationDiagnosticKind::InconsistentWinding;
+                return lhs.Corner != rhs.Corner ? lhs.Corner < rhs.Corner : !lhsWinding && rhsWinding;
+            });
 
-                    if (edge.SameDirectedEdgeSeen && !edge.WindingReported)
-                    {
-                        edge.WindingReported = true;
-                        result.Diagnostics.push_back(ValidationDiagnostic{
-                            .Kind = ValidationDiagnosticKind::InconsistentWinding,
-                            .Severity = ValidationSeverity::Error,
-                            .FaceIndex = faceIndex,
-                            .EdgeStart = start,
-                            .EdgeEnd = end,
-                            .AttributeName = {},
-                            .AttributeDomainValue = AttributeDomain::Face,
-                            .ExpectedCount = 0u,
-                            .ActualCount = 0u,
-                        });
-                    }
-                }
+            for (const TopologyEvent& event : events)
+            {
+                const bool nonManifold = event.Kind == ValidationDiagnosticKind::NonManifoldEdge;
+                result.Diagnostics.push_back(ValidationDiagnostic{
+                    .Kind = event.Kind,
+                    .Severity = ValidationSeverity::Error,
+                    .FaceIndex = event.FaceIndex,
+                    .EdgeStart = event.EdgeStart,
+                    .EdgeEnd = event.EdgeEnd,
+                    .AttributeName = {},
+                    .AttributeDomainValue = AttributeDomain::Face,
+                    .ExpectedCount = nonManifold ? 2u : 0u,
+                    .ActualCount = nonManifold ? 3u : 0u,
+                });
             }
         }
 
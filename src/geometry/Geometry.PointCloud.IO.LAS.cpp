@@ -0,0 +1,467 @@
+module;
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Geometry.IOText.hpp"
+
+module Geometry.PointCloud.IO;
+
+import Geometry.PointCloud;
+import Geometry.Properties;
+import Extrinsic.Core.Error;
+import Extrinsic.Core.IOBackend;
+import Extrinsic.Core.Parallel;
+
+namespace Geometry::PointCloudIO
+{
+    namespace
+    {
+        namespace Parallel = Extrinsic::Core::Parallel;
+        using Extrinsic::Core::ErrorCode;
+        using Geometry::IOText::MakePathInfo;
+
+        // Public header block sizes: 1.0-1.2, 1.3 (waveform start), 1.4
+        // (extended VLRs and 64-bit point counts).
+        constexpr std::size_t kLasLegacyHeaderSize = 227;
+        constexpr std::size_t kLas13HeaderSize = 235;
+        constexpr std::size_t kLas14HeaderSize = 375;
+        constexpr std::size_t kLas14PointCountOffset = 247;
+
+        constexpr std::uint8_t kLasMaxPointFormat = 10;
+        // Bits 6 and 7 of the point format id mark LAZ-compressed data.
+        constexpr std::uint8_t kLasCompressedFormatBits = 0xC0;
+        constexpr std::size_t kLasAbsent = std::numeric_limits<std::size_t>::max();
+
+        // Core record length of each point data record format.
+        constexpr std::array<std::uint16_t, kLasMaxPointFormat + 1u> kLasRecordLength{
+            20, 28, 26, 34, 57, 63, 30, 36, 38, 59, 67};
+
+        // LAS is little-endian, as is every host the engine targets.
+        template <class T>
+        [[nodiscard]] T ReadLE(const std::byte* bytes) noexcept
+        {
+            T value{};
+            std::memcpy(&value, bytes, sizeof(T));
+            return value;
+        }
+
+        [[nodiscard]] glm::dvec3 ReadLEVec3(const std::byte* bytes) noexcept
+        {
+            return {ReadLE<double>(bytes), ReadLE<double>(bytes + 8), ReadLE<double>(bytes + 16)};
+        }
+
+        // A range past the end of the file means the header promised more
+        // than the file holds.
+        [[nodiscard]] Extrinsic::Core::Expected<Extrinsic::Core::IO::IOReadResult> ReadLasRange(
+            Extrinsic::Core::IO::IIOBackend& backend,
+            const std::string_view path,
+            const std::size_t offset,
+            const std::size_t size)
+        {
+            auto read = backend.Read(Extrinsic::Core::IO::IORequest{
+                .Path = std::string(path), .Offset = offset, .Size = size});
+            if (!read)
+            {
+                return Extrinsic::Core::Err<Extrinsic::Core::IO::IOReadResult>(
+                    read.error() == ErrorCode::OutOfRange ? ErrorCode::InvalidFormat : read.error());
+            }
+            if (read->Bytes().size() != size)
+            {
+                return Extrinsic::Core::Err<Extrinsic::Core::IO::IOReadResult>(ErrorCode::InvalidFormat);
+            }
+            return read;
+        }
+
+        [[nodiscard]] bool IsValidLasScale(const glm::dvec3& scale)
+        {
+            return std::isfinite(scale.x) && std::isfinite(scale.y) && std::isfinite(scale.z) &&
+                scale.x != 0.0 && scale.y != 0.0 && scale.z != 0.0;
+        }
+
+        [[nodiscard]] Extrinsic::Core::Expected<LasHeader> DecodeLasHeader(
+            Extrinsic::Core::IO::IIOBackend& backend,
+            const std::string_view path)
+        {
+            auto legacy = ReadLasRange(backend, path, 0, kLasLegacyHeaderSize);
+            if (!legacy)
+            {
+                return Extrinsic::Core::Err<LasHeader>(legacy.error());
+            }
+            const std::byte* bytes = legacy->Bytes().data();
+            if (std::memcmp(bytes, "LASF", 4) != 0)
+            {
+                return Extrinsic::Core::Err<LasHeader>(ErrorCode::InvalidFormat);
+            }
+
+            LasHeader header;
+            header.VersionMajor = ReadLE<std::uint8_t>(bytes + 24);
+            header.VersionMinor = ReadLE<std::uint8_t>(bytes + 25);
+            if (header.VersionMajor != 1u)
+            {
+                return Extrinsic::Core::Err<LasHeader>(ErrorCode::UnsupportedFormat);
+            }
+            header.HeaderSize = ReadLE<std::uint16_t>(bytes + 94);
+            header.PointDataOffset = ReadLE<std::uint32_t>(bytes + 96);
+            const auto formatId = ReadLE<std::uint8_t>(bytes + 104);
+            header.PointRecordLength = ReadLE<std::uint16_t>(bytes + 105);
+            header.PointCount = ReadLE<std::uint32_t>(bytes + 107);
+            header.Scale = ReadLEVec3(bytes + 131);
+            header.Offset = ReadLEVec3(bytes + 155);
+            header.BoundsMax = {ReadLE<double>(bytes + 179), ReadLE<double>(bytes + 195), ReadLE<double>(bytes + 211)};
+            header.BoundsMin = {ReadLE<double>(bytes + 187), ReadLE<double>(bytes + 203), ReadLE<double>(bytes + 219)};
+
+            if ((formatId & kLasCompressedFormatBits) != 0u ||
+                (formatId & ~kLasCompressedFormatBits) > kLasMaxPointFormat)
+            {
+                return Extrinsic::Core::Err<LasHeader>(ErrorCode::UnsupportedFormat);
+            }
+            header.PointFormat = formatId;
+
+            const std::size_t requiredHeaderSize = header.VersionMinor >= 4u ? kLas14HeaderSize
+                : header.VersionMinor == 3u ? kLas13HeaderSize
+                : kLasLegacyHeaderSize;
+            if (header.HeaderSize < requiredHeaderSize || header.PointDataOffset < header.HeaderSize ||
+                header.PointRecordLength < kLasRecordLength[header.PointFormat] ||
+                !IsValidLasScale(header.Scale) || !std::isfinite(header.Offset.x) ||
+                !std::isfinite(header.Offset.y) || !std::isfinite(header.Offset.z))
+            {
+                return Extrinsic::Core::Err<LasHeader>(ErrorCode::InvalidFormat);
+            }
+
+            // 1.4 moved the point count to 64 bits; the legacy field is 0 for
+            // formats 6-10 and for files past 2^32 points.
+            if (header.VersionMinor >= 4u)
+            {
+                auto extended = ReadLasRange(backend, path, kLas14PointCountOffset, sizeof(std::uint64_t));
+                if (!extended)
+                {
+                    return Extrinsic::Core::Err<LasHeader>(extended.error());
+                }
+                if (const auto count = ReadLE<std::uint64_t>(extended->Bytes().data()); count != 0u)
+                {
+                    header.PointCount = count;
+                }
+            }
+
+            const std::uint64_t maxRecords =
+                (std::numeric_limits<std::size_t>::max() - header.PointDataOffset) / header.PointRecordLength;
+            if (header.PointCount > maxRecords)
+            {
+                return Extrinsic::Core::Err<LasHeader>(ErrorCode::InvalidFormat);
+            }
+            return header;
+        }
+
+        struct LasRecordLayout
+        {
+            bool Extended{false}; // formats 6-10
+            std::size_t GpsTimeOffset{kLasAbsent};
+            std::size_t RgbOffset{kLasAbsent};
+        };
+
+        [[nodiscard]] LasRecordLayout MakeLasRecordLayout(const LasHeader& header)
+        {
+            LasRecordLayout layout;
+            layout.Extended = header.PointFormat >= 6u;
+            if (header.HasGpsTime())
+            {
+                layout.GpsTimeOffset = layout.Extended ? 22u : 20u;
+            }
+            if (header.HasColors())
+            {
+                layout.RgbOffset = header.PointFormat == 2u ? 20u : layout.Extended ? 30u : 28u;
+            }
+            return layout;
+        }
+
+        struct LasBatchBuffers
+        {
+            std::vector<glm::vec3> Positions;
+            std::vector<std::uint16_t> Intensities;
+            std::vector<std::uint8_t> Classifications;
+            std::vector<std::uint8_t> ReturnNumbers;
+            std::vector<std::uint8_t> ReturnCounts;
+            std::vector<double> GpsTimes;
+            std::vector<glm::vec4> Colors;
+
+            void Clear()
+            {
+                Positions.clear();
+                Intensities.clear();
+                Classifications.clear();
+                ReturnNumbers.clear();
+                ReturnCounts.clear();
+                GpsTimes.clear();
+                Colors.clear();
+            }
+
+            [[nodiscard]] LasPointBatch View(const std::uint64_t firstRecord) const
+            {
+                return LasPointBatch{
+                    .FirstRecord = firstRecord,
+                    .Positions = Positions,
+                    .Intensities = Intensities,
+                    .Classifications = Classifications,
+                    .ReturnNumbers = ReturnNumbers,
+                    .ReturnCounts = ReturnCounts,
+                    .GpsTimes = GpsTimes,
+                    .Colors = Colors,
+                };
+            }
+        };
+
+        void DecodeLasRecords(std::span<const std::byte> records,
+                              const std::size_t count,
+                              const LasHeader& header,
+                              const LasRecordLayout& layout,
+                              const LasLoadOptions& options,
+                              LasBatchBuffers& out)
+        {
+            const bool intensity = options.Intensity;
+            const bool classification = options.Classification;
+            const bool returns = options.Returns;
+            const bool gpsTime = options.GpsTime && layout.GpsTimeOffset != kLasAbsent;
+            const bool colors = options.Colors && layout.RgbOffset != kLasAbsent;
+
+            out.Clear();
+            out.Positions.reserve(count);
+            if (intensity) out.Intensities.reserve(count);
+            if (classification) out.Classifications.reserve(count);
+            if (returns)
+            {
+                out.ReturnNumbers.reserve(count);
+                out.ReturnCounts.reserve(count);
+            }
+            if (gpsTime) out.GpsTimes.reserve(count);
+            if (colors) out.Colors.reserve(count);
+
+            constexpr double kColorScale = 1.0 / 65535.0;
+            const std::size_t stride = header.PointRecordLength;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::byte* record = records.data() + i * stride;
+                const glm::dvec3 position(
+                    header.Offset.x + header.Scale.x * static_cast<double>(ReadLE<std::int32_t>(record)),
+                    header.Offset.y + header.Scale.y * static_cast<double>(ReadLE<std::int32_t>(record + 4)),
+                    header.Offset.z + header.Scale.z * static_cast<double>(ReadLE<std::int32_t>(record + 8)));
+                if (options.Crop &&
+                    (position.x < options.CropMin.x || position.y < options.CropMin.y ||
+                     position.z < options.CropMin.z || position.x > options.CropMax.x ||
+                     position.y > options.CropMax.y || position.z > options.CropMax.z))
+                {
+                    continue;
+                }
+                out.Positions.emplace_back(position - options.Origin);
+
+                if (intensity)
+                {
+                    out.Intensities.push_back(ReadLE<std::uint16_t>(record + 12));
+                }
+                if (classification)
+                {
+                    // Legacy formats pack the synthetic/key-point/withheld
+                    // flags into the top three bits of the class byte.
+                    out.Classifications.push_back(layout.Extended
+                        ? ReadLE<std::uint8_t>(record + 16)
+                        : static_cast<std::uint8_t>(ReadLE<std::uint8_t>(record + 15) & 0x1Fu));
+                }
+                if (returns)
+                {
+                    const auto bits = ReadLE<std::uint8_t>(record + 14);
+                    out.ReturnNumbers.push_back(static_cast<std::uint8_t>(layout.Extended ? bits & 0x0Fu : bits & 0x07u));
+                    out.ReturnCounts.push_back(static_cast<std::uint8_t>(layout.Extended ? bits >> 4u : (bits >> 3u) & 0x07u));
+                }
+                if (gpsTime)
+                {
+                    out.GpsTimes.push_back(ReadLE<double>(record + layout.GpsTimeOffset));
+                }
+                if (colors)
+                {
+                    const std::byte* rgb = record + layout.RgbOffset;
+                    out.Colors.emplace_back(
+                        static_cast<float>(ReadLE<std::uint16_t>(rgb) * kColorScale),
+                        static_cast<float>(ReadLE<std::uint16_t>(rgb + 2) * kColorScale),
+                        static_cast<float>(ReadLE<std::uint16_t>(rgb + 4) * kColorScale),
+                        1.0f);
+                }
+            }
+        }
+
+        [[nodiscard]] std::size_t LasBatchCount(const LasHeader& header, const std::size_t batchPoints)
+        {
+            return static_cast<std::size_t>((header.PointCount + batchPoints - 1u) / batchPoints);
+        }
+
+        [[nodiscard]] Extrinsic::Core::Expected<Extrinsic::Core::IO::IOReadResult> ReadLasBatch(
+            Extrinsic::Core::IO::IIOBackend& backend,
+            const std::string_view path,
+            const LasHeader& header,
+            const std::size_t batchPoints,
+            const std::size_t batch,
+            std::size_t& count)
+        {
+            const std::size_t first = batch * batchPoints;
+            count = std::min<std::size_t>(batchPoints, static_cast<std::size_t>(header.PointCount) - first);
+            return ReadLasRange(backend, path,
+                                header.PointDataOffset + first * header.PointRecordLength,
+                                count * header.PointRecordLength);
+        }
+
+        template <class T>
+        void CopyLasChannel(PointCloud::Cloud& cloud,
+                            const std::string_view name,
+                            const std::vector<T>& values,
+                            const std::size_t offset)
+        {
+            if (values.empty())
+            {
+                return;
+            }
+            auto property = cloud.GetOrAddVertexProperty<T>(name);
+            std::copy(values.begin(), values.end(), property.Span().begin() + static_cast<std::ptrdiff_t>(offset));
+        }
+
+        void ApplyPathInfo(PointCloudIOResult& result, std::string_view path)
+        {
+            auto pathInfo = MakePathInfo(path);
+            result.SourcePath = std::move(pathInfo.SourcePath);
+            result.BasePath = std::move(pathInfo.BasePath);
+        }
+    }
+
+    Extrinsic::Core::Expected<LasHeader> ReadLASHeader(std::string_view absolute_path,
+        Extrinsic::Core::IO::IIOBackend& backend)
+    {
+        return DecodeLasHeader(backend, absolute_path);
+    }
+
+    Extrinsic::Core::Expected<LasHeader> StreamLAS(std::string_view absolute_path,
+        Extrinsic::Core::IO::IIOBackend& backend,
+        const LasLoadOptions& options,
+        const LasBatchCallback& onBatch)
+    {
+        if (options.BatchPoints == 0 || !onBatch)
+        {
+            return Extrinsic::Core::Err<LasHeader>(ErrorCode::InvalidArgument);
+        }
+        auto header = DecodeLasHeader(backend, absolute_path);
+        if (!header)
+        {
+            return header;
+        }
+
+        const LasRecordLayout layout = MakeLasRecordLayout(*header);
+        LasBatchBuffers buffers;
+        const std::size_t batchCount = LasBatchCount(*header, options.BatchPoints);
+        for (std::size_t batch = 0; batch < batchCount; ++batch)
+        {
+            std::size_t count = 0;
+            auto read = ReadLasBatch(backend, absolute_path, *header, options.BatchPoints, batch, count);
+            if (!read)
+            {
+                return Extrinsic::Core::Err<LasHeader>(read.error());
+            }
+            DecodeLasRecords(read->Bytes(), count, *header, layout, options, buffers);
+            if (!onBatch(buffers.View(static_cast<std::uint64_t>(batch) * options.BatchPoints)))
+            {
+                break;
+            }
+        }
+        return header;
+    }
+
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadLAS(std::string_view absolute_path)
+    {
+        Extrinsic::Core::IO::FileIOBackend backend;
+        return LoadLAS(absolute_path, backend, LasLoadOptions{});
+    }
+
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadLAS(std::string_view absolute_path,
+        Extrinsic::Core::IO::IIOBackend& backend,
+        const LasLoadOptions& options)
+    {
+        if (options.BatchPoints == 0)
+        {
+            return Extrinsic::Core::Err<PointCloudIOResult>(ErrorCode::InvalidArgument);
+        }
+        const auto header = DecodeLasHeader(backend, absolute_path);
+        if (!header)
+        {
+            return Extrinsic::Core::Err<PointCloudIOResult>(header.error());
+        }
+
+        const LasRecordLayout layout = MakeLasRecordLayout(*header);
+        const std::size_t batchCount = LasBatchCount(*header, options.BatchPoints);
+        std::vector<LasBatchBuffers> batches(batchCount);
+        std::vector<ErrorCode> errors(batchCount, ErrorCode::Success);
+        Parallel::ParallelFor(Parallel::IndexRange{0u, batchCount}, 1u, [&](const std::size_t batch)
+        {
+            std::size_t count = 0;
+            auto read = ReadLasBatch(backend, absolute_path, *header, options.BatchPoints, batch, count);
+            if (!read)
+            {
+                errors[batch] = read.error();
+                return;
+            }
+            DecodeLasRecords(read->Bytes(), count, *header, layout, options, batches[batch]);
+        });
+        if (const auto failed = std::find_if(errors.begin(), errors.end(),
+                                             [](const ErrorCode code) { return code != ErrorCode::Success; });
+            failed != errors.end())
+        {
+            return Extrinsic::Core::Err<PointCloudIOResult>(*failed);
+        }
+
+        std::size_t total = 0;
+        for (const LasBatchBuffers& batch : batches)
+        {
+            total += batch.Positions.size();
+        }
+        if (total == 0)
+        {
+            return Extrinsic::Core::Err<PointCloudIOResult>(ErrorCode::InvalidFormat);
+        }
+
+        PointCloudIOResult result;
+        ApplyPathInfo(result, absolute_path);
+        PointCloud::Cloud& cloud = result.Cloud;
+        cloud.Reserve(total);
+        if (options.Colors && header->HasColors())
+        {
+            cloud.EnableColors();
+        }
+        for (LasBatchBuffers& batch : batches)
+        {
+            const std::size_t offset = cloud.VerticesSize();
+            for (const glm::vec3& position : batch.Positions)
+            {
+                cloud.AddPoint(position);
+            }
+            if (!batch.Colors.empty())
+            {
+                std::copy(batch.Colors.begin(), batch.Colors.end(),
+                          cloud.Colors().begin() + static_cast<std::ptrdiff_t>(offset));
+            }
+            CopyLasChannel(cloud, kLasIntensityProperty, batch.Intensities, offset);
+            CopyLasChannel(cloud, kLasClassificationProperty, batch.Classifications, offset);
+            CopyLasChannel(cloud, kLasReturnNumberProperty, batch.ReturnNumbers, offset);
+            CopyLasChannel(cloud, kLasReturnCountProperty, batch.ReturnCounts, offset);
+            CopyLasChannel(cloud, kLasGpsTimeProperty, batch.GpsTimes, offset);
+            batch = {};
+        }
+        return result;
+    }
+}
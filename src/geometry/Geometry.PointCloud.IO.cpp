@@ -17,20 +17,26 @@ module;
 #include <string_view>
 #include <vector>
 #include <fstream>
-#include <sstream>
 
 #include <glm/glm.hpp>
 
+#include "Geometry.IOText.hpp"
+
 module Geometry.PointCloud.IO;
 
 import Geometry.PointCloud;
 import Geometry.Properties;
 import Extrinsic.Core.Error;
+import Extrinsic.Core.IOBackend;
+import Extrinsic.Core.Parallel;
 
 namespace Geometry::PointCloudIO
 {
     namespace
     {
+        namespace Parallel = Extrinsic::Core::Parallel;
+        using Geometry::IOText::SplitLineAlignedChunks;
+
         struct PathInfo
         {
             std::string SourcePath;
@@ -50,19 +56,26 @@ namespace Geometry::PointCloudIO
 
         [[nodiscard]] Extrinsic::Core::Expected<std::string> ReadTextFile(std::string_view path)
         {
-            std::ifstream file(std::string(path), std::ios::binary);
+            std::ifstream file(std::string(path), std::ios::binary | std::ios::ate);
             if (!file)
             {
                 return Extrinsic::Core::Err<std::string>(Extrinsic::Core::ErrorCode::FileNotFound);
             }
 
-            std::ostringstream buffer;
-            buffer << file.rdbuf();
-            if (!file.good() && !file.eof())
+            // One sized read instead of streaming through an ostringstream,
+            // which copied the whole file a second time.
+            const std::streamoff size = file.tellg();
+            if (size < 0)
+            {
+                return Extrinsic::Core::Err<std::string>(Extrinsic::Core::ErrorCode::FileReadError);
+            }
+            std::string text(static_cast<std::size_t>(size), '\0');
+            file.seekg(0, std::ios::beg);
+            if (size > 0 && !file.read(text.data(), size))
             {
                 return Extrinsic::Core::Err<std::string>(Extrinsic::Core::ErrorCode::FileReadError);
             }
-            return buffer.str();
+            return text;
         }
 
         [[nodiscard]] std::string_view Trim(std::string_view text)
@@ -171,95 +184,6 @@ namespace Geometry::PointCloudIO
             return true;
         }
 
-        [[nodiscard]] std::optional<glm::vec4> ParseRgb(std::span<const std::string_view> tokens, std::size_t offset)
-        {
-            if (tokens.size() < offset + 3)
-            {
-                return std::nullopt;
-            }
-            const auto r = ParseNumber<float>(tokens[offset]);
-            const auto g = ParseNumber<float>(tokens[offset + 1]);
-            const auto b = ParseNumber<float>(tokens[offset + 2]);
-            if (!r || !g || !b)
-            {
-                return std::nullopt;
-            }
-            if (!IsFinite(*r) || !IsFinite(*g) || !IsFinite(*b))
-            {
-                return std::nullopt;
-            }
-            return glm::vec4(NormalizeColorChannel(*r), NormalizeColorChannel(*g), NormalizeColorChannel(*b), 1.0f);
-        }
-
-        [[nodiscard]] std::optional<glm::vec4> ParseXYZPointColor(std::span<const std::string_view> tokens)
-        {
-            if (tokens.size() >= 7)
-            {
-                if (auto color = ParseRgb(tokens, tokens.size() - 3))
-                {
-                    return color;
-                }
-            }
-            if (tokens.size() >= 6)
-            {
-                if (auto color = ParseRgb(tokens, 3))
-                {
-                    return color;
-                }
-            }
-            if (tokens.size() == 4)
-            {
-                if (const auto intensity = ParseNumber<float>(tokens[3]))
-                {
-                    if (!IsFinite(*intensity))
-                    {
-                        return std::nullopt;
-                    }
-                    const float c = NormalizeColorChannel(*intensity);
-                    return glm::vec4(c, c, c, 1.0f);
-                }
-            }
-            return std::nullopt;
-        }
-
-        [[nodiscard]] bool IsXYZScanLineMarker(std::span<const std::string_view> tokens)
-        {
-            if (tokens.size() != 1)
-            {
-                return false;
-            }
-            const std::string_view token = tokens.front();
-            if (token.size() <= 2 || !token.starts_with("LH"))
-            {
-                return false;
-            }
-            for (char c : token.substr(2))
-            {
-                if (c < '0' || c > '9')
-                {
-                    return false;
-                }
-            }
-            return true;
-        }
-
-        [[nodiscard]] bool XYZNeedsDelimiterNormalization(std::string_view line)
-        {
-            return line.find(';') != std::string_view::npos;
-        }
-
-        void XYZNormalizeDelimitedLine(std::string_view line, std::string& scratch)
-        {
-            scratch.assign(line.begin(), line.end());
-            for (char& c : scratch)
-            {
-                if (c == ';')
-                {
-                    c = ' ';
-                }
-            }
-        }
-
         [[nodiscard]] Extrinsic::Core::Expected<PointCloudIOResult> InvalidPointCloudFormat()
         {
             return Extrinsic::Core::Err<PointCloudIOResult>(Extrinsic::Core::ErrorCode::InvalidFormat);
@@ -280,57 +204,6 @@ namespace Geometry::PointCloudIO
             TXT,
         };
 
-        [[nodiscard]] std::optional<std::vector<std::string_view>> SplitCsvStrict(std::string_view line)
-        {
-            std::vector<std::string_view> tokens;
-            std::size_t start = 0;
-            while (start <= line.size())
-            {
-                const std::size_t end = line.find(',', start);
-                std::string_view token = end == std::string_view::npos
-                                             ? line.substr(start)
-                                             : line.substr(start, end - start);
-                token = Trim(token);
-                if (token.empty())
-                {
-                    return std::nullopt;
-                }
-                tokens.push_back(token);
-                if (end == std::string_view::npos)
-                {
-                    break;
-                }
-                start = end + 1;
-            }
-            return tokens;
-        }
-
-        [[nodiscard]] std::vector<std::string_view> SplitAsciiPointCloudTokens(
-            std::string_view line,
-            const StrictAsciiPointCloudFormat format,
-            std::string& scratch)
-        {
-            if (format == StrictAsciiPointCloudFormat::CSV)
-            {
-                const auto csvTokens = SplitCsvStrict(line);
-                return csvTokens.value_or(std::vector<std::string_view>{});
-            }
-
-            if (line.find(';') != std::string_view::npos || line.find(',') != std::string_view::npos)
-            {
-                scratch.assign(line.begin(), line.end());
-                for (char& c : scratch)
-                {
-                    if (c == ';' || c == ',')
-                    {
-                        c = ' ';
-                    }
-                }
-                line = Trim(std::string_view(scratch));
-            }
-            return SplitWhitespace(line);
-        }
-
         [[nodiscard]] std::optional<std::vector<float>> ParseFiniteFloatTokens(
             std::span<const std::string_view> tokens)
         {
@@ -385,155 +258,637 @@ namespace Geometry::PointCloudIO
                     format == StrictAsciiPointCloudFormat::TXT);
         }
 
-        [[nodiscard]] Extrinsic::Core::Expected<PointCloudIOResult> ParseStrictAsciiPointCloud(
-            std::string_view text,
-            std::string_view absolutePath,
-            const StrictAsciiPointCloudFormat format)
+        // -----------------------------------------------------------------
+        // Chunked ASCII rows (XYZ, PTS, CSV, 3D, TXT and ASCII PCD bodies).
+        // The body is cut into pieces of about AsciiLoadOptions::ChunkBytes
+        // that each end on a '\n', every piece is parsed on its own task
+        // straight out of the source buffer into per-chunk SoA rows, and the
+        // rows are appended to the cloud in file order. Chunks count their
+        // lines, so the first rejected row is reported by its file line once
+        // the counts of the chunks before it are summed.
+        // -----------------------------------------------------------------
+
+        // Cloud::EnableNormals/EnableColors defaults, used to pad rows without
+        // the attribute inside a chunk that has it.
+        const glm::vec3 kAsciiDefaultNormal{0.0f, 1.0f, 0.0f};
+        const glm::vec4 kAsciiDefaultColor{1.0f};
+
+        enum class AsciiLineStatus
         {
-            PointCloudIOResult result;
-            ApplyPathInfo(result, absolutePath);
+            Skip,
+            Row,
+            Error,
+        };
 
-            std::size_t cursor = 0;
-            std::string_view line;
-            bool firstPayloadLine = true;
-            std::size_t expectedCount = 0;
-            std::string normalizedLine;
+        struct AsciiChunk
+        {
+            std::string_view Text;
+            std::vector<glm::vec3> Positions;
+            std::vector<glm::vec3> Normals; // Empty, or one per row once parsed.
+            std::vector<glm::vec4> Colors;  // Empty, or one per row once parsed.
+            std::size_t LineCount = 0;
+            std::size_t ErrorLine = 0;      // 1-based line within Text; 0 = accepted.
 
-            while (NextLine(text, cursor, line))
+            // Call after pushing the row's position.
+            void AddNormal(const glm::vec3& normal)
             {
-                const auto comment = line.find('#');
-                if (comment != std::string_view::npos)
-                {
-                    line = Trim(line.substr(0, comment));
-                }
-                if (line.empty())
-                {
-                    continue;
-                }
+                Normals.resize(Positions.size() - 1, kAsciiDefaultNormal);
+                Normals.push_back(normal);
+            }
 
-                const auto tokens = SplitAsciiPointCloudTokens(line, format, normalizedLine);
-                if (tokens.empty())
-                {
-                    return InvalidPointCloudFormat();
-                }
+            void AddColor(const glm::vec4& color)
+            {
+                Colors.resize(Positions.size() - 1, kAsciiDefaultColor);
+                Colors.push_back(color);
+            }
+        };
 
-                if (firstPayloadLine &&
-                    (format == StrictAsciiPointCloudFormat::PTS || format == StrictAsciiPointCloudFormat::TXT) &&
-                    tokens.size() == 1)
-                {
-                    const auto count = ParseNumber<std::size_t>(tokens[0]);
-                    if (!count || *count == 0)
-                    {
-                        return InvalidPointCloudFormat();
-                    }
-                    expectedCount = *count;
-                    firstPayloadLine = false;
-                    continue;
-                }
-                firstPayloadLine = false;
+        // The tokens of one row without allocating: the first kHeadCapacity
+        // in Head and the full token count.
+        struct AsciiLineTokens
+        {
+            static constexpr std::size_t kHeadCapacity = 7;
+
+            std::array<std::string_view, kHeadCapacity> Head{};
+            std::size_t Count = 0;
 
-                if (expectedCount > 0 && result.Cloud.VerticesSize() >= expectedCount)
+            void Push(const std::string_view token)
+            {
+                if (Count < kHeadCapacity)
                 {
-                    return InvalidPointCloudFormat();
+                    Head[Count] = token;
                 }
+                ++Count;
+            }
+        };
+
+        [[nodiscard]] bool IsAsciiBlank(const char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
 
-                if (!ValidStrictAsciiColumnCount(format, tokens.size()))
+        // Calls onToken for every maximal run of non-delimiter characters.
+        template <typename IsDelimiterFn, typename OnTokenFn>
+        void ForEachAsciiToken(std::string_view line, const IsDelimiterFn& isDelimiter, OnTokenFn&& onToken)
+        {
+            std::size_t cursor = 0;
+            while (cursor < line.size())
+            {
+                while (cursor < line.size() && isDelimiter(line[cursor]))
                 {
-                    return InvalidPointCloudFormat();
+                    ++cursor;
                 }
-
-                const auto values = ParseFiniteFloatTokens(tokens);
-                if (!values)
+                const std::size_t start = cursor;
+                while (cursor < line.size() && !isDelimiter(line[cursor]))
                 {
-                    return InvalidPointCloudFormat();
+                    ++cursor;
                 }
-
-                const glm::vec3 position((*values)[0], (*values)[1], (*values)[2]);
-                if (!IsFinite(position))
+                if (start < cursor)
                 {
-                    return InvalidPointCloudFormat();
+                    onToken(line.substr(start, cursor - start));
                 }
+            }
+        }
+
+        [[nodiscard]] std::string_view StripAsciiComment(std::string_view line)
+        {
+            if (const auto comment = line.find('#'); comment != std::string_view::npos)
+            {
+                line = line.substr(0, comment);
+            }
+            return Trim(line);
+        }
+
+        // XYZ splits on whitespace and ';' only.
+        [[nodiscard]] AsciiLineTokens SplitXYZRow(const std::string_view line)
+        {
+            AsciiLineTokens tokens;
+            ForEachAsciiToken(line,
+                              [](const char c) { return IsAsciiBlank(c) || c == ';'; },
+                              [&](const std::string_view token) { tokens.Push(token); });
+            return tokens;
+        }
 
-                const bool hasNormal = StrictAsciiRowHasNormal(format, values->size());
-                const bool hasColor = StrictAsciiRowHasColor(format, values->size());
-                if (hasNormal && !result.Cloud.HasNormals())
+        // CSV splits on ',' and rejects empty fields (Count == 0); the other
+        // strict formats treat ';' and ',' like whitespace.
+        [[nodiscard]] AsciiLineTokens SplitStrictAsciiRow(
+            const std::string_view line,
+            const StrictAsciiPointCloudFormat format)
+        {
+            AsciiLineTokens tokens;
+            if (format == StrictAsciiPointCloudFormat::CSV)
+            {
+                std::size_t start = 0;
+                while (true)
                 {
-                    result.Cloud.EnableNormals();
+                    const std::size_t end = line.find(',', start);
+                    const std::string_view token = Trim(end == std::string_view::npos
+                                                            ? line.substr(start)
+                                                            : line.substr(start, end - start));
+                    if (token.empty())
+                    {
+                        return {};
+                    }
+                    tokens.Push(token);
+                    if (end == std::string_view::npos)
+                    {
+                        break;
+                    }
+                    start = end + 1;
                 }
-                if (hasColor && !result.Cloud.HasColors())
+                return tokens;
+            }
+
+            ForEachAsciiToken(line,
+                              [](const char c) { return IsAsciiBlank(c) || c == ';' || c == ','; },
+                              [&](const std::string_view token) { tokens.Push(token); });
+            return tokens;
+        }
+
+        [[nodiscard]] bool IsXYZScanLineMarker(const AsciiLineTokens& tokens)
+        {
+            if (tokens.Count != 1)
+            {
+                return false;
+            }
+            const std::string_view token = tokens.Head[0];
+            if (token.size() <= 2 || !token.starts_with("LH"))
+            {
+                return false;
+            }
+            for (char c : token.substr(2))
+            {
+                if (c < '0' || c > '9')
                 {
-                    result.Cloud.EnableColors(glm::vec4(1.0f));
+                    return false;
                 }
+            }
+            return true;
+        }
 
-                const auto point = result.Cloud.AddPoint(position);
-                if (hasNormal)
+        // One XYZ row, each token parsed once: the first six values and the
+        // last three, with whether each token was numeric.
+        struct XYZRowValues
+        {
+            std::array<float, 6> Head{};
+            std::array<bool, 6> HeadNumeric{};
+            std::array<float, 3> Tail{};
+            std::array<bool, 3> TailNumeric{};
+            std::size_t Count = 0;
+            bool NonFiniteAttribute = false;
+
+            void Push(const std::string_view token)
+            {
+                const auto value = ParseNumber<float>(token);
+                if (Count >= 3 && value && !IsFinite(*value))
                 {
-                    const glm::vec3 normal((*values)[3], (*values)[4], (*values)[5]);
-                    if (!IsFinite(normal))
-                    {
-                        return InvalidPointCloudFormat();
-                    }
-                    result.Cloud.Normal(point) = normal;
+                    NonFiniteAttribute = true;
                 }
-                if (hasColor)
+                if (Count < Head.size())
                 {
-                    const std::size_t colorOffset =
-                        format == StrictAsciiPointCloudFormat::PTS ? 4u : 3u;
-                    result.Cloud.Color(point) = glm::vec4(
-                        NormalizeColorChannel((*values)[colorOffset]),
-                        NormalizeColorChannel((*values)[colorOffset + 1]),
-                        NormalizeColorChannel((*values)[colorOffset + 2]),
-                        1.0f);
+                    Head[Count] = value.value_or(0.0f);
+                    HeadNumeric[Count] = value.has_value();
                 }
+                Tail = {Tail[1], Tail[2], value.value_or(0.0f)};
+                TailNumeric = {TailNumeric[1], TailNumeric[2], value.has_value()};
+                ++Count;
             }
+        };
 
-            if (result.Cloud.IsEmpty())
+        // RGB from the last three values of 7+ columns, else from columns
+        // 3..5 of 6+ columns, else a 4th column read as intensity. The
+        // values are finite here; a non-finite one rejected the row already.
+        [[nodiscard]] std::optional<glm::vec4> XYZPointColor(const XYZRowValues& row)
+        {
+            const auto rgb = [](const float r, const float g, const float b)
             {
-                return InvalidPointCloudFormat();
+                return glm::vec4(NormalizeColorChannel(r), NormalizeColorChannel(g), NormalizeColorChannel(b), 1.0f);
+            };
+            if (row.Count >= 7 && row.TailNumeric[0] && row.TailNumeric[1] && row.TailNumeric[2])
+            {
+                return rgb(row.Tail[0], row.Tail[1], row.Tail[2]);
             }
-            if (expectedCount > 0 && result.Cloud.VerticesSize() != expectedCount)
+            if (row.Count >= 6 && row.HeadNumeric[3] && row.HeadNumeric[4] && row.HeadNumeric[5])
             {
-                return InvalidPointCloudFormat();
+                return rgb(row.Head[3], row.Head[4], row.Head[5]);
             }
-            return result;
+            if (row.Count == 4 && row.HeadNumeric[3])
+            {
+                const float c = NormalizeColorChannel(row.Head[3]);
+                return glm::vec4(c, c, c, 1.0f);
+            }
+            return std::nullopt;
         }
 
-        [[nodiscard]] std::optional<glm::vec3> ParseStrictVec3(
-            std::span<const std::string_view> tokens)
+        // Lenient XYZ row: short or non-numeric rows are skipped, but a
+        // non-finite position or extra attribute rejects the file.
+        [[nodiscard]] AsciiLineStatus ParseXYZRow(std::string_view line, std::size_t, AsciiChunk& chunk)
         {
-            if (tokens.size() != 3)
+            XYZRowValues row;
+            ForEachAsciiToken(StripAsciiComment(line),
+                              [](const char c) { return IsAsciiBlank(c) || c == ';'; },
+                              [&](const std::string_view token) { row.Push(token); });
+            if (row.Count < 3 || !row.HeadNumeric[0] || !row.HeadNumeric[1] || !row.HeadNumeric[2])
             {
-                return std::nullopt;
+                return AsciiLineStatus::Skip;
             }
-            const auto values = ParseFiniteFloatTokens(tokens);
-            if (!values || values->size() != 3)
+            const glm::vec3 position(row.Head[0], row.Head[1], row.Head[2]);
+            if (!IsFinite(position) || row.NonFiniteAttribute)
             {
-                return std::nullopt;
+                return AsciiLineStatus::Error;
             }
-            return glm::vec3((*values)[0], (*values)[1], (*values)[2]);
+
+            chunk.Positions.push_back(position);
+            if (const std::optional<glm::vec4> color = XYZPointColor(row))
+            {
+                chunk.AddColor(*color);
+            }
+            return AsciiLineStatus::Row;
         }
 
-        [[nodiscard]] Extrinsic::Core::Expected<PointCloudIOResult> ParsePWNPointCloud(
-            std::string_view text,
-            std::string_view absolutePath)
+        // Strict row: every non-blank row must be a valid point, and a row
+        // past rowLimit is rejected.
+        [[nodiscard]] AsciiLineStatus ParseStrictAsciiRow(
+            std::string_view line,
+            const std::size_t rowLimit,
+            AsciiChunk& chunk,
+            const StrictAsciiPointCloudFormat format)
         {
-            std::size_t cursor = 0;
-            std::string_view line;
-            bool countSeen = false;
-            std::size_t expectedCount = 0;
-            std::vector<glm::vec3> positions;
-            std::vector<glm::vec3> normals;
+            line = StripAsciiComment(line);
+            if (line.empty())
+            {
+                return AsciiLineStatus::Skip;
+            }
 
-            while (NextLine(text, cursor, line))
+            const AsciiLineTokens tokens = SplitStrictAsciiRow(line, format);
+            if (tokens.Count == 0 || chunk.Positions.size() >= rowLimit ||
+                !ValidStrictAsciiColumnCount(format, tokens.Count))
             {
-                const auto comment = line.find('#');
-                if (comment != std::string_view::npos)
+                return AsciiLineStatus::Error;
+            }
+
+            std::array<float, AsciiLineTokens::kHeadCapacity> values{};
+            for (std::size_t i = 0; i < tokens.Count; ++i)
+            {
+                const auto value = ParseNumber<float>(tokens.Head[i]);
+                if (!value || !IsFinite(*value))
                 {
-                    line = Trim(line.substr(0, comment));
+                    return AsciiLineStatus::Error;
                 }
-                if (line.empty())
-                {
-                    continue;
+                values[i] = *value;
+            }
+
+            chunk.Positions.emplace_back(values[0], values[1], values[2]);
+            if (StrictAsciiRowHasNormal(format, tokens.Count))
+            {
+                chunk.AddNormal(glm::vec3(values[3], values[4], values[5]));
+            }
+            if (StrictAsciiRowHasColor(format, tokens.Count))
+            {
+                const std::size_t colorOffset = format == StrictAsciiPointCloudFormat::PTS ? 4u : 3u;
+                chunk.AddColor(glm::vec4(NormalizeColorChannel(values[colorOffset]),
+                                         NormalizeColorChannel(values[colorOffset + 1]),
+                                         NormalizeColorChannel(values[colorOffset + 2]),
+                                         1.0f));
+            }
+            return AsciiLineStatus::Row;
+        }
+
+        // Parses chunk rows until parseLine rejects one. With stopAtLimit the
+        // chunk also stops after rowLimit rows, for readers that ignore rows
+        // past their declared count.
+        template <typename ParseLineFn>
+        void ParseAsciiChunk(AsciiChunk& chunk,
+                             const std::size_t rowLimit,
+                             const bool stopAtLimit,
+                             const ParseLineFn& parseLine)
+        {
+            const std::string_view text = chunk.Text;
+            chunk.Positions.reserve(text.size() / 32u);
+
+            std::size_t cursor = 0;
+            std::size_t line = 0;
+            while (cursor < text.size())
+            {
+                if (stopAtLimit && chunk.Positions.size() >= rowLimit)
+                {
+                    break;
+                }
+                const std::size_t newline = text.find('\n', cursor);
+                const std::size_t end = newline == std::string_view::npos ? text.size() : newline;
+                ++line;
+                const AsciiLineStatus status = parseLine(text.substr(cursor, end - cursor), rowLimit, chunk);
+                cursor = newline == std::string_view::npos ? text.size() : newline + 1u;
+                if (status == AsciiLineStatus::Error)
+                {
+                    chunk.ErrorLine = line;
+                    break;
+                }
+            }
+
+            // Unvisited lines still shift the numbering of later chunks.
+            const std::string_view rest = text.substr(cursor);
+            chunk.LineCount = line + static_cast<std::size_t>(std::count(rest.begin(), rest.end(), '\n')) +
+                              (!rest.empty() && rest.back() != '\n' ? 1u : 0u);
+            if (!chunk.Normals.empty())
+            {
+                chunk.Normals.resize(chunk.Positions.size(), kAsciiDefaultNormal);
+            }
+            if (!chunk.Colors.empty())
+            {
+                chunk.Colors.resize(chunk.Positions.size(), kAsciiDefaultColor);
+            }
+        }
+
+        template <typename ParseLineFn>
+        [[nodiscard]] std::vector<AsciiChunk> ParseAsciiChunks(const std::string_view body,
+                                                               const AsciiLoadOptions& options,
+                                                               const std::size_t rowLimit,
+                                                               const bool stopAtLimit,
+                                                               const ParseLineFn& parseLine)
+        {
+            const std::vector<std::string_view> pieces = SplitLineAlignedChunks(body, options.ChunkBytes);
+            std::vector<AsciiChunk> chunks(pieces.size());
+            for (std::size_t chunk = 0; chunk < pieces.size(); ++chunk)
+            {
+                chunks[chunk].Text = pieces[chunk];
+            }
+            Parallel::ParallelFor(Parallel::IndexRange{0u, chunks.size()}, 1u, [&](const std::size_t chunk)
+            {
+                ParseAsciiChunk(chunks[chunk], rowLimit, stopAtLimit, parseLine);
+            });
+            return chunks;
+        }
+
+        // Appends the parsed chunks to cloud in file order; firstLine is the
+        // number of lines before the body. With stopAtLimit rows past rowLimit
+        // and any errors after them are ignored; otherwise the first row past
+        // rowLimit is rejected, and its line is found by re-parsing its chunk
+        // with the remaining budget. Returns the 1-based file line of the
+        // first rejected row, or 0 once every row is appended.
+        template <typename ParseLineFn>
+        [[nodiscard]] std::size_t AppendAsciiChunks(PointCloud::Cloud& cloud,
+                                                    std::vector<AsciiChunk>& chunks,
+                                                    std::size_t firstLine,
+                                                    const std::size_t rowLimit,
+                                                    const bool stopAtLimit,
+                                                    const ParseLineFn& parseLine)
+        {
+            std::size_t rows = 0;
+            std::size_t used = 0;
+            for (; used < chunks.size(); ++used)
+            {
+                AsciiChunk& chunk = chunks[used];
+                const std::size_t budget = rowLimit - rows;
+                if (stopAtLimit && chunk.Positions.size() >= budget)
+                {
+                    chunk.Positions.resize(budget);
+                    chunk.Normals.resize(std::min(chunk.Normals.size(), budget));
+                    chunk.Colors.resize(std::min(chunk.Colors.size(), budget));
+                    rows += budget;
+                    ++used;
+                    break;
+                }
+                if (!stopAtLimit && chunk.Positions.size() > budget)
+                {
+                    AsciiChunk rescan;
+                    rescan.Text = chunk.Text;
+                    ParseAsciiChunk(rescan, budget, false, parseLine);
+                    return firstLine + rescan.ErrorLine;
+                }
+                if (chunk.ErrorLine != 0)
+                {
+                    return firstLine + chunk.ErrorLine;
+                }
+                rows += chunk.Positions.size();
+                firstLine += chunk.LineCount;
+            }
+
+            bool anyNormals = false;
+            bool anyColors = false;
+            for (std::size_t c = 0; c < used; ++c)
+            {
+                anyNormals = anyNormals || !chunks[c].Normals.empty();
+                anyColors = anyColors || !chunks[c].Colors.empty();
+            }
+
+            cloud.Reserve(cloud.VerticesSize() + rows);
+            if (anyNormals && !cloud.HasNormals())
+            {
+                cloud.EnableNormals(kAsciiDefaultNormal);
+            }
+            if (anyColors && !cloud.HasColors())
+            {
+                cloud.EnableColors(kAsciiDefaultColor);
+            }
+            for (std::size_t c = 0; c < used; ++c)
+            {
+                AsciiChunk& chunk = chunks[c];
+                const std::size_t offset = cloud.VerticesSize();
+                for (const glm::vec3& position : chunk.Positions)
+                {
+                    cloud.AddPoint(position);
+                }
+                if (!chunk.Normals.empty())
+                {
+                    std::copy(chunk.Normals.begin(), chunk.Normals.end(),
+                              cloud.Normals().begin() + static_cast<std::ptrdiff_t>(offset));
+                }
+                if (!chunk.Colors.empty())
+                {
+                    std::copy(chunk.Colors.begin(), chunk.Colors.end(),
+                              cloud.Colors().begin() + static_cast<std::ptrdiff_t>(offset));
+                }
+                chunk = {};
+            }
+            return 0;
+        }
+
+        [[nodiscard]] Extrinsic::Core::Expected<PointCloudIOResult> RejectAsciiLine(
+            AsciiLoadDiagnostics* diagnostics,
+            const std::size_t line)
+        {
+            if (diagnostics != nullptr)
+            {
+                diagnostics->FailedLine = line;
+            }
+            return InvalidPointCloudFormat();
+        }
+
+        [[nodiscard]] Extrinsic::Core::Expected<PointCloudIOResult> ParseXYZPointCloud(
+            const std::string_view text,
+            const std::string_view absolutePath,
+            const AsciiLoadOptions& options,
+            AsciiLoadDiagnostics* diagnostics)
+        {
+            if (diagnostics != nullptr)
+            {
+                *diagnostics = {};
+            }
+            PointCloudIOResult result;
+            ApplyPathInfo(result, absolutePath);
+
+            // Blank, comment and scan-line marker lines before the first row,
+            // then an optional point-count line, are consumed serially.
+            std::size_t cursor = 0;
+            std::size_t headerLines = 0;
+            std::size_t expectedCount = 0;
+            while (cursor < text.size())
+            {
+                const std::size_t newline = text.find('\n', cursor);
+                const std::size_t next = newline == std::string_view::npos ? text.size() : newline + 1u;
+                const AsciiLineTokens tokens = SplitXYZRow(
+                    StripAsciiComment(text.substr(cursor, next - cursor)));
+                if (tokens.Count == 0 || IsXYZScanLineMarker(tokens))
+                {
+                    cursor = next;
+                    ++headerLines;
+                    continue;
+                }
+                if (tokens.Count == 1)
+                {
+                    if (const auto count = ParseNumber<std::size_t>(tokens.Head[0]))
+                    {
+                        expectedCount = *count;
+                        cursor = next;
+                        ++headerLines;
+                    }
+                }
+                break;
+            }
+
+            const std::size_t rowLimit = expectedCount > 0 ? expectedCount : std::numeric_limits<std::size_t>::max();
+            std::vector<AsciiChunk> chunks =
+                ParseAsciiChunks(text.substr(cursor), options, rowLimit, true, ParseXYZRow);
+            if (diagnostics != nullptr)
+            {
+                diagnostics->ChunkCount = chunks.size();
+            }
+            if (const std::size_t failed =
+                    AppendAsciiChunks(result.Cloud, chunks, headerLines, rowLimit, true, ParseXYZRow);
+                failed != 0)
+            {
+                return RejectAsciiLine(diagnostics, failed);
+            }
+
+            if (result.Cloud.IsEmpty())
+            {
+                return InvalidPointCloudFormat();
+            }
+            return result;
+        }
+
+        [[nodiscard]] Extrinsic::Core::Expected<PointCloudIOResult> ParseStrictAsciiPointCloud(
+            const std::string_view text,
+            const std::string_view absolutePath,
+            const StrictAsciiPointCloudFormat format,
+            const AsciiLoadOptions& options,
+            AsciiLoadDiagnostics* diagnostics)
+        {
+            if (diagnostics != nullptr)
+            {
+                *diagnostics = {};
+            }
+            PointCloudIOResult result;
+            ApplyPathInfo(result, absolutePath);
+
+            // PTS and TXT may open with a point-count line.
+            std::size_t cursor = 0;
+            std::size_t headerLines = 0;
+            std::size_t expectedCount = 0;
+            while (cursor < text.size())
+            {
+                const std::size_t newline = text.find('\n', cursor);
+                const std::size_t next = newline == std::string_view::npos ? text.size() : newline + 1u;
+                const std::string_view line = StripAsciiComment(text.substr(cursor, next - cursor));
+                if (line.empty())
+                {
+                    cursor = next;
+                    ++headerLines;
+                    continue;
+                }
+                if (format == StrictAsciiPointCloudFormat::PTS || format == StrictAsciiPointCloudFormat::TXT)
+                {
+                    const AsciiLineTokens tokens = SplitStrictAsciiRow(line, format);
+                    if (tokens.Count == 1)
+                    {
+                        const auto count = ParseNumber<std::size_t>(tokens.Head[0]);
+                        if (!count || *count == 0)
+                        {
+                            return RejectAsciiLine(diagnostics, headerLines + 1u);
+                        }
+                        expectedCount = *count;
+                        cursor = next;
+                        ++headerLines;
+                    }
+                }
+                break;
+            }
+
+            const auto parseRow = [format](const std::string_view line, const std::size_t rowLimit, AsciiChunk& chunk)
+            {
+                return ParseStrictAsciiRow(line, rowLimit, chunk, format);
+            };
+            const std::size_t rowLimit = expectedCount > 0 ? expectedCount : std::numeric_limits<std::size_t>::max();
+            std::vector<AsciiChunk> chunks = ParseAsciiChunks(text.substr(cursor), options, rowLimit, false, parseRow);
+            if (diagnostics != nullptr)
+            {
+                diagnostics->ChunkCount = chunks.size();
+            }
+            if (const std::size_t failed =
+                    AppendAsciiChunks(result.Cloud, chunks, headerLines, rowLimit, false, parseRow);
+                failed != 0)
+            {
+                return RejectAsciiLine(diagnostics, failed);
+            }
+
+            if (result.Cloud.IsEmpty())
+            {
+                return InvalidPointCloudFormat();
+            }
+            if (expectedCount > 0 && result.Cloud.VerticesSize() != expectedCount)
+            {
+                return InvalidPointCloudFormat();
+            }
+            return result;
+        }
+
+        [[nodiscard]] std::optional<glm::vec3> ParseStrictVec3(
+            std::span<const std::string_view> tokens)
+        {
+            if (tokens.size() != 3)
+            {
+                return std::nullopt;
+            }
+            const auto values = ParseFiniteFloatTokens(tokens);
+            if (!values || values->size() != 3)
+            {
+                return std::nullopt;
+            }
+            return glm::vec3((*values)[0], (*values)[1], (*values)[2]);
+        }
+
+        [[nodiscard]] Extrinsic::Core::Expected<PointCloudIOResult> ParsePWNPointCloud(
+            std::string_view text,
+            std::string_view absolutePath)
+        {
+            std::size_t cursor = 0;
+            std::string_view line;
+            bool countSeen = false;
+            std::size_t expectedCount = 0;
+            std::vector<glm::vec3> positions;
+            std::vector<glm::vec3> normals;
+
+            while (NextLine(text, cursor, line))
+            {
+                const auto comment = line.find('#');
+                if (comment != std::string_view::npos)
+                {
+                    line = Trim(line.substr(0, comment));
+                }
+                if (line.empty())
+                {
+                    continue;
                 }
 
                 const auto tokens = SplitWhitespace(line);
@@ -1582,107 +1937,7 @@ namespace Geometry::PointCloudIO
         {
             return Extrinsic::Core::Err<PointCloudIOResult>(text.error());
         }
-
-        PointCloudIOResult result;
-        ApplyPathInfo(result, absolute_path);
-
-        std::size_t cursor = 0;
-        std::string_view line;
-        bool firstPayloadLine = true;
-        std::size_t expectedCount = 0;
-        std::string normalizedLine;
-        while (NextLine(*text, cursor, line))
-        {
-            const auto comment = line.find('#');
-            if (comment != std::string_view::npos)
-            {
-                line = Trim(line.substr(0, comment));
-            }
-            if (line.empty())
-            {
-                continue;
-            }
-
-            if (XYZNeedsDelimiterNormalization(line))
-            {
-                XYZNormalizeDelimitedLine(line, normalizedLine);
-                line = Trim(std::string_view(normalizedLine));
-                if (line.empty())
-                {
-                    continue;
-                }
-            }
-
-            const auto tokens = SplitWhitespace(line);
-            if (tokens.empty())
-            {
-                continue;
-            }
-            if (IsXYZScanLineMarker(tokens))
-            {
-                continue;
-            }
-            if (firstPayloadLine && tokens.size() == 1)
-            {
-                if (const auto count = ParseNumber<std::size_t>(tokens[0]))
-                {
-                    expectedCount = *count;
-                    result.Cloud.Reserve(expectedCount);
-                    firstPayloadLine = false;
-                    continue;
-                }
-            }
-            firstPayloadLine = false;
-
-            if (tokens.size() < 3)
-            {
-                continue;
-            }
-            const auto x = ParseNumber<float>(tokens[0]);
-            const auto y = ParseNumber<float>(tokens[1]);
-            const auto z = ParseNumber<float>(tokens[2]);
-            if (!x || !y || !z)
-            {
-                continue;
-            }
-
-            const glm::vec3 position(*x, *y, *z);
-            if (!IsFinite(position))
-            {
-                return InvalidPointCloudFormat();
-            }
-
-            for (std::size_t i = 3; i < tokens.size(); ++i)
-            {
-                if (const auto attribute = ParseNumber<float>(tokens[i]); attribute && !IsFinite(*attribute))
-                {
-                    return InvalidPointCloudFormat();
-                }
-            }
-
-            const std::optional<glm::vec4> color = ParseXYZPointColor(tokens);
-
-            if (color && !result.Cloud.HasColors())
-            {
-                result.Cloud.EnableColors(glm::vec4(1.0f));
-            }
-            const auto point = result.Cloud.AddPoint(position);
-            if (color)
-            {
-                result.Cloud.Color(point) = *color;
-            }
-
-            if (expectedCount > 0 && result.Cloud.VerticesSize() >= expectedCount)
-            {
-                break;
-            }
-        }
-
-        if (result.Cloud.IsEmpty())
-        {
-            return InvalidPointCloudFormat();
-        }
-        return result;
+        return ParseXYZPointCloud(*text, absolute_path, AsciiLoadOptions{}, nullptr);
     }
 
     Extrinsic::Core::Expected<PointCloudIOResult> LoadPTS(std::string_view absolute_path)
@@ -1692,7 +1947,8 @@ namespace Geometry::PointCloudIO
         {
             return Extrinsic::Core::Err<PointCloudIOResult>(text.error());
         }
-        return ParseStrictAsciiPointCloud(*text, absolute_path, StrictAsciiPointCloudFormat::PTS);
+        return ParseStrictAsciiPointCloud(*text, absolute_path, StrictAsciiPointCloudFormat::PTS,
+            AsciiLoadOptions{}, nullptr);
     }
 
     Extrinsic::Core::Expected<PointCloudIOResult> LoadPWN(std::string_view absolute_path)
@@ -1712,7 +1968,8 @@ namespace Geometry::PointCloudIO
         {
             return Extrinsic::Core::Err<PointCloudIOResult>(text.error());
         }
-        return ParseStrictAsciiPointCloud(*text, absolute_path, StrictAsciiPointCloudFormat::CSV);
+        return ParseStrictAsciiPointCloud(*text, absolute_path, StrictAsciiPointCloudFormat::CSV,
+            AsciiLoadOptions{}, nullptr);
     }
 
     Extrinsic::Core::Expected<PointCloudIOResult> Load3D(std::string_view absolute_path)
@@ -1722,7 +1979,8 @@ namespace Geometry::PointCloudIO
         {
             return Extrinsic::Core::Err<PointCloudIOResult>(text.error());
         }
-        return ParseStrictAsciiPointCloud(*text, absolute_path, StrictAsciiPointCloudFormat::ThreeD);
+        return ParseStrictAsciiPointCloud(*text, absolute_path, StrictAsciiPointCloudFormat::ThreeD,
+            AsciiLoadOptions{}, nullptr);
     }
 
     Extrinsic::Core::Expected<PointCloudIOResult> LoadTXT(std::string_view absolute_path)
@@ -1732,386 +1990,575 @@ namespace Geometry::PointCloudIO
         {
             return Extrinsic::Core::Err<PointCloudIOResult>(text.error());
         }
-        return ParseStrictAsciiPointCloud(*text, absolute_path, StrictAsciiPointCloudFormat::TXT);
+        return ParseStrictAsciiPointCloud(*text, absolute_path, StrictAsciiPointCloudFormat::TXT,
+            AsciiLoadOptions{}, nullptr);
     }
 
-    Extrinsic::Core::Expected<PointCloudIOResult> LoadPCD(std::string_view absolute_path)
+    namespace
     {
-        auto text = ReadTextFile(absolute_path);
-        if (!text)
+        [[nodiscard]] std::string_view ReadBytesAsText(const Extrinsic::Core::IO::IOReadResult& read)
         {
-            return Extrinsic::Core::Err<PointCloudIOResult>(text.error());
+            const std::span<const std::byte> bytes = read.Bytes();
+            return std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
         }
 
-        std::size_t cursor = 0;
-        const auto headerOpt = ParsePCDHeader(*text, cursor);
-        if (!headerOpt)
+        [[nodiscard]] Extrinsic::Core::Expected<PointCloudIOResult> LoadStrictAsciiPointCloud(
+            const std::string_view absolutePath,
+            Extrinsic::Core::IO::IIOBackend& backend,
+            const StrictAsciiPointCloudFormat format,
+            const AsciiLoadOptions& options,
+            AsciiLoadDiagnostics* diagnostics)
         {
-            return InvalidPointCloudFormat();
+            auto read = backend.Read(Extrinsic::Core::IO::IORequest{.Path = std::string(absolutePath)});
+            if (!read)
+            {
+                return Extrinsic::Core::Err<PointCloudIOResult>(read.error());
+            }
+            return ParseStrictAsciiPointCloud(ReadBytesAsText(*read), absolutePath, format, options, diagnostics);
         }
-        const PcdHeader& header = *headerOpt;
+    }
 
-        const auto* xField = FindPCDField(header.Fields, "x");
-        const auto* yField = FindPCDField(header.Fields, "y");
-        const auto* zField = FindPCDField(header.Fields, "z");
-        if (xField == nullptr || yField == nullptr || zField == nullptr)
-        {
-            return InvalidPointCloudFormat();
-        }
-        const auto* nxField = FindPCDField(header.Fields, "normal_x");
-        const auto* nyField = FindPCDField(header.Fields, "normal_y");
-        const auto* nzField = FindPCDField(header.Fields, "normal_z");
-        const auto* rField = FindPCDField(header.Fields, "r");
-        const auto* gField = FindPCDField(header.Fields, "g");
-        const auto* bField = FindPCDField(header.Fields, "b");
-        const auto* packedRgbField = FindPCDField(header.Fields, "rgb");
-        const auto* packedRgbaField = FindPCDField(header.Fields, "rgba");
-        const auto* packedColorField = packedRgbField != nullptr ? packedRgbField : packedRgbaField;
-        const bool hasNormals = nxField && nyField && nzField;
-        const bool hasSeparateColors = rField && gField && bField;
-        const bool hasPackedColors = !hasSeparateColors && packedColorField != nullptr;
-        const bool hasColors = hasSeparateColors || hasPackedColors;
-
-        PointCloudIOResult result;
-        ApplyPathInfo(result, absolute_path);
-        if (header.Points > 0)
-        {
-            result.Cloud.Reserve(header.Points);
-        }
-        if (hasNormals)
-        {
-            result.Cloud.EnableNormals();
-        }
-        if (hasColors)
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadXYZ(std::string_view absolute_path,
+        Extrinsic::Core::IO::IIOBackend& backend,
+        const AsciiLoadOptions& options,
+        AsciiLoadDiagnostics* diagnostics)
+    {
+        auto read = backend.Read(Extrinsic::Core::IO::IORequest{.Path = std::string(absolute_path)});
+        if (!read)
         {
-            result.Cloud.EnableColors(glm::vec4(1.0f));
+            return Extrinsic::Core::Err<PointCloudIOResult>(read.error());
         }
+        return ParseXYZPointCloud(ReadBytesAsText(*read), absolute_path, options, diagnostics);
+    }
 
-        if (header.DataEncoding == "ascii")
-        {
-            std::string_view line;
-            while (NextLine(*text, cursor, line))
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadPTS(std::string_view absolute_path,
+        Extrinsic::Core::IO::IIOBackend& backend,
+        const AsciiLoadOptions& options,
+        AsciiLoadDiagnostics* diagnostics)
+    {
+        return LoadStrictAsciiPointCloud(absolute_path, backend, StrictAsciiPointCloudFormat::PTS, options,
+            diagnostics);
+    }
+
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadCSV(std::string_view absolute_path,
+        Extrinsic::Core::IO::IIOBackend& backend,
+        const AsciiLoadOptions& options,
+        AsciiLoadDiagnostics* diagnostics)
+    {
+        return LoadStrictAsciiPointCloud(absolute_path, backend, StrictAsciiPointCloudFormat::CSV, options,
+            diagnostics);
+    }
+
+    Extrinsic::Core::Expected<PointCloudIOResult> Load3D(std::string_view absolute_path,
+        Extrinsic::Core::IO::IIOBackend& backend,
+        const AsciiLoadOptions& options,
+        AsciiLoadDiagnostics* diagnostics)
+    {
+        return LoadStrictAsciiPointCloud(absolute_path, backend, StrictAsciiPointCloudFormat::ThreeD, options,
+            diagnostics);
+    }
+
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadTXT(std::string_view absolute_path,
+        Extrinsic::Core::IO::IIOBackend& backend,
+        const AsciiLoadOptions& options,
+        AsciiLoadDiagnostics* diagnostics)
+    {
+        return LoadStrictAsciiPointCloud(absolute_path, backend, StrictAsciiPointCloudFormat::TXT, options,
+            diagnostics);
+    }
+
+    namespace
+    {
+        // Scalar offsets of the fields an ASCII PCD row is read from, in the
+        // order x y z normal_x normal_y normal_z r g b rgb(a); absent fields
+        // hold SIZE_MAX.
+        struct PcdAsciiLayout
+        {
+            static constexpr std::size_t kSlotCount = 10;
+
+            std::array<std::size_t, kSlotCount> Offsets{};
+            const PcdField* PackedColorField = nullptr;
+            std::size_t ScalarValueCount = 0;
+            bool HasNormals = false;
+            bool HasSeparateColors = false;
+            bool HasPackedColors = false;
+        };
+
+        [[nodiscard]] AsciiLineStatus ParsePCDAsciiRow(std::string_view line,
+                                                       const PcdAsciiLayout& layout,
+                                                       AsciiChunk& chunk)
+        {
+            line = Trim(line);
+            if (line.empty() || line.front() == '#')
             {
-                if (line.empty() || line.front() == '#')
-                {
-                    continue;
-                }
-                const auto tokens = SplitWhitespace(line);
-                if (tokens.size() < header.ScalarValueCount)
+                return AsciiLineStatus::Skip;
+            }
+
+            std::array<std::string_view, PcdAsciiLayout::kSlotCount> slots{};
+            std::size_t count = 0;
+            ForEachAsciiToken(line, IsAsciiBlank, [&](const std::string_view token)
+            {
+                for (std::size_t slot = 0; slot < PcdAsciiLayout::kSlotCount; ++slot)
                 {
-                    return InvalidPointCloudFormat();
+                    if (layout.Offsets[slot] == count)
+                    {
+                        slots[slot] = token;
+                    }
                 }
-                const auto x = ParseNumber<float>(tokens[xField->ScalarOffset]);
-                const auto y = ParseNumber<float>(tokens[yField->ScalarOffset]);
-                const auto z = ParseNumber<float>(tokens[zField->ScalarOffset]);
-                if (!x || !y || !z)
+                ++count;
+            });
+            if (count < layout.ScalarValueCount)
+            {
+                return AsciiLineStatus::Error;
+            }
+
+            const auto parseFiniteVec3 = [&slots](const std::size_t first) -> std::optional<glm::vec3>
+            {
+                const auto a = ParseNumber<float>(slots[first]);
+                const auto b = ParseNumber<float>(slots[first + 1]);
+                const auto c = ParseNumber<float>(slots[first + 2]);
+                if (!a || !b || !c)
                 {
-                    return InvalidPointCloudFormat();
+                    return std::nullopt;
                 }
-                const glm::vec3 position(*x, *y, *z);
-                if (!IsFinite(position))
+                const glm::vec3 value(*a, *b, *c);
+                if (!IsFinite(value))
                 {
-                    return InvalidPointCloudFormat();
+                    return std::nullopt;
                 }
-                const auto point = result.Cloud.AddPoint(position);
+                return value;
+            };
 
-                if (hasNormals)
+            const auto position = parseFiniteVec3(0);
+            if (!position)
+            {
+                return AsciiLineStatus::Error;
+            }
+            std::optional<glm::vec3> normal;
+            if (layout.HasNormals)
+            {
+                normal = parseFiniteVec3(3);
+                if (!normal)
                 {
-                    const auto nx = ParseNumber<float>(tokens[nxField->ScalarOffset]);
-                    const auto ny = ParseNumber<float>(tokens[nyField->ScalarOffset]);
-                    const auto nz = ParseNumber<float>(tokens[nzField->ScalarOffset]);
-                    if (!nx || !ny || !nz)
-                    {
-                        return InvalidPointCloudFormat();
-                    }
-                    const glm::vec3 normal(*nx, *ny, *nz);
-                    if (!IsFinite(normal))
-                    {
-                        return InvalidPointCloudFormat();
-                    }
-                    result.Cloud.Normal(point) = normal;
+                    return AsciiLineStatus::Error;
                 }
-                if (hasSeparateColors)
+            }
+            std::optional<glm::vec4> color;
+            if (layout.HasSeparateColors)
+            {
+                const auto rawColor = parseFiniteVec3(6);
+                if (!rawColor)
                 {
-                    const auto r = ParseNumber<float>(tokens[rField->ScalarOffset]);
-                    const auto g = ParseNumber<float>(tokens[gField->ScalarOffset]);
-                    const auto b = ParseNumber<float>(tokens[bField->ScalarOffset]);
-                    if (!r || !g || !b)
-                    {
-                        return InvalidPointCloudFormat();
-                    }
-                    const glm::vec3 rawColor(*r, *g, *b);
-                    if (!IsFinite(rawColor))
-                    {
-                        return InvalidPointCloudFormat();
-                    }
-                    result.Cloud.Color(point) = glm::vec4(
-                        NormalizeColorChannel(rawColor.r),
-                        NormalizeColorChannel(rawColor.g),
-                        NormalizeColorChannel(rawColor.b),
-                        1.0f);
+                    return AsciiLineStatus::Error;
                 }
-                else if (hasPackedColors)
+                color = glm::vec4(NormalizeColorChannel(rawColor->r),
+                                  NormalizeColorChannel(rawColor->g),
+                                  NormalizeColorChannel(rawColor->b),
+                                  1.0f);
+            }
+            else if (layout.HasPackedColors)
+            {
+                color = ParsePCDAsciiPackedColor(slots[9], *layout.PackedColorField);
+                if (!color)
                 {
-                    const auto color = ParsePCDAsciiPackedColor(tokens[packedColorField->ScalarOffset],
-                                                                *packedColorField);
-                    if (!color)
-                    {
-                        return InvalidPointCloudFormat();
-                    }
-                    result.Cloud.Color(point) = *color;
+                    return AsciiLineStatus::Error;
                 }
+            }
 
-                if (header.Points > 0 && result.Cloud.VerticesSize() >= header.Points)
-                {
-                    break;
-                }
+            chunk.Positions.push_back(*position);
+            if (normal)
+            {
+                chunk.AddNormal(*normal);
+            }
+            if (color)
+            {
+                chunk.AddColor(*color);
             }
+            return AsciiLineStatus::Row;
         }
-        else if (header.DataEncoding == "binary")
+
+        [[nodiscard]] Extrinsic::Core::Expected<PointCloudIOResult> ParsePCDDocument(std::string_view text,
+            std::string_view absolute_path,
+            const AsciiLoadOptions& options,
+            AsciiLoadDiagnostics* diagnostics)
         {
-            if (header.PointStride == 0)
+            if (diagnostics != nullptr)
+            {
+                *diagnostics = {};
+            }
+            std::size_t cursor = 0;
+            const auto headerOpt = ParsePCDHeader(text, cursor);
+            if (!headerOpt)
             {
                 return InvalidPointCloudFormat();
             }
-            if (cursor > text->size())
+            const PcdHeader& header = *headerOpt;
+
+            const auto* xField = FindPCDField(header.Fields, "x");
+            const auto* yField = FindPCDField(header.Fields, "y");
+            const auto* zField = FindPCDField(header.Fields, "z");
+            if (xField == nullptr || yField == nullptr || zField == nullptr)
             {
                 return InvalidPointCloudFormat();
             }
-            const std::span<const std::byte> body(
-                reinterpret_cast<const std::byte*>(text->data() + cursor),
-                text->size() - cursor);
+            const auto* nxField = FindPCDField(header.Fields, "normal_x");
+            const auto* nyField = FindPCDField(header.Fields, "normal_y");
+            const auto* nzField = FindPCDField(header.Fields, "normal_z");
+            const auto* rField = FindPCDField(header.Fields, "r");
+            const auto* gField = FindPCDField(header.Fields, "g");
+            const auto* bField = FindPCDField(header.Fields, "b");
+            const auto* packedRgbField = FindPCDField(header.Fields, "rgb");
+            const auto* packedRgbaField = FindPCDField(header.Fields, "rgba");
+            const auto* packedColorField = packedRgbField != nullptr ? packedRgbField : packedRgbaField;
+            const bool hasNormals = nxField && nyField && nzField;
+            const bool hasSeparateColors = rField && gField && bField;
+            const bool hasPackedColors = !hasSeparateColors && packedColorField != nullptr;
+            const bool hasColors = hasSeparateColors || hasPackedColors;
 
-            std::size_t pointCount = header.Points;
-            if (pointCount == 0)
+            PointCloudIOResult result;
+            ApplyPathInfo(result, absolute_path);
+            if (header.Points > 0)
             {
-                if (header.PointStride == 0 || body.size() % header.PointStride != 0)
-                {
-                    return InvalidPointCloudFormat();
-                }
-                pointCount = body.size() / header.PointStride;
+                result.Cloud.Reserve(header.Points);
             }
-            if (pointCount == 0)
+            if (hasNormals)
             {
-                return InvalidPointCloudFormat();
+                result.Cloud.EnableNormals();
             }
-
-            const std::size_t requiredBytes = pointCount * header.PointStride;
-            if (body.size() < requiredBytes)
+            if (hasColors)
             {
-                return InvalidPointCloudFormat();
+                result.Cloud.EnableColors(glm::vec4(1.0f));
             }
 
-            for (std::size_t row = 0; row < pointCount; ++row)
+            if (header.DataEncoding == "ascii")
             {
-                const std::span<const std::byte> pointBytes =
-                    body.subspan(row * header.PointStride, header.PointStride);
+                const auto offsetOf = [](const PcdField* field)
+                {
+                    return field != nullptr ? field->ScalarOffset : std::numeric_limits<std::size_t>::max();
+                };
+                PcdAsciiLayout layout;
+                layout.Offsets = {offsetOf(xField), offsetOf(yField), offsetOf(zField),
+                                  offsetOf(nxField), offsetOf(nyField), offsetOf(nzField),
+                                  offsetOf(rField), offsetOf(gField), offsetOf(bField),
+                                  offsetOf(packedColorField)};
+                layout.PackedColorField = packedColorField;
+                layout.ScalarValueCount = header.ScalarValueCount;
+                layout.HasNormals = hasNormals;
+                layout.HasSeparateColors = hasSeparateColors;
+                layout.HasPackedColors = hasPackedColors;
+                const auto parseRow = [&layout](const std::string_view line, const std::size_t, AsciiChunk& chunk)
+                {
+                    return ParsePCDAsciiRow(line, layout, chunk);
+                };
 
-                const auto x = ReadPCDBinaryScalar(pointBytes, *xField);
-                const auto y = ReadPCDBinaryScalar(pointBytes, *yField);
-                const auto z = ReadPCDBinaryScalar(pointBytes, *zField);
-                if (!x || !y || !z)
+                const std::size_t bodyOffset = std::min(cursor, text.size());
+                const auto headerLines = static_cast<std::size_t>(
+                    std::count(text.begin(), text.begin() + static_cast<std::ptrdiff_t>(bodyOffset), '\n'));
+                const std::size_t rowLimit =
+                    header.Points > 0 ? header.Points : std::numeric_limits<std::size_t>::max();
+                std::vector<AsciiChunk> chunks =
+                    ParseAsciiChunks(text.substr(bodyOffset), options, rowLimit, true, parseRow);
+                if (diagnostics != nullptr)
+                {
+                    diagnostics->ChunkCount = chunks.size();
+                }
+                if (const std::size_t failed =
+                        AppendAsciiChunks(result.Cloud, chunks, headerLines, rowLimit, true, parseRow);
+                    failed != 0)
+                {
+                    return RejectAsciiLine(diagnostics, failed);
+                }
+            }
+            else if (header.DataEncoding == "binary")
+            {
+                if (header.PointStride == 0)
                 {
                     return InvalidPointCloudFormat();
                 }
-                const glm::vec3 position(*x, *y, *z);
-                if (!IsFinite(position))
+                if (cursor > text.size())
                 {
                     return InvalidPointCloudFormat();
                 }
-                const auto point = result.Cloud.AddPoint(position);
+                const std::span<const std::byte> body(
+                    reinterpret_cast<const std::byte*>(text.data() + cursor),
+                    text.size() - cursor);
 
-                if (hasNormals)
+                std::size_t pointCount = header.Points;
+                if (pointCount == 0)
                 {
-                    const auto nx = ReadPCDBinaryScalar(pointBytes, *nxField);
-                    const auto ny = ReadPCDBinaryScalar(pointBytes, *nyField);
-                    const auto nz = ReadPCDBinaryScalar(pointBytes, *nzField);
-                    if (!nx || !ny || !nz)
-                    {
-                        return InvalidPointCloudFormat();
-                    }
-                    const glm::vec3 normal(*nx, *ny, *nz);
-                    if (!IsFinite(normal))
+                    if (header.PointStride == 0 || body.size() % header.PointStride != 0)
                     {
                         return InvalidPointCloudFormat();
                     }
-                    result.Cloud.Normal(point) = normal;
+                    pointCount = body.size() / header.PointStride;
                 }
-                if (hasSeparateColors)
+                if (pointCount == 0)
                 {
-                    const auto r = ReadPCDBinaryScalar(pointBytes, *rField);
-                    const auto g = ReadPCDBinaryScalar(pointBytes, *gField);
-                    const auto b = ReadPCDBinaryScalar(pointBytes, *bField);
-                    if (!r || !g || !b)
+                    return InvalidPointCloudFormat();
+                }
+
+                const std::size_t requiredBytes = pointCount * header.PointStride;
+                if (body.size() < requiredBytes)
+                {
+                    return InvalidPointCloudFormat();
+                }
+
+                for (std::size_t row = 0; row < pointCount; ++row)
+                {
+                    const std::span<const std::byte> pointBytes =
+                        body.subspan(row * header.PointStride, header.PointStride);
+
+                    const auto x = ReadPCDBinaryScalar(pointBytes, *xField);
+                    const auto y = ReadPCDBinaryScalar(pointBytes, *yField);
+                    const auto z = ReadPCDBinaryScalar(pointBytes, *zField);
+                    if (!x || !y || !z)
                     {
                         return InvalidPointCloudFormat();
                     }
-                    const glm::vec3 rawColor(*r, *g, *b);
-                    if (!IsFinite(rawColor))
+                    const glm::vec3 position(*x, *y, *z);
+                    if (!IsFinite(position))
                     {
                         return InvalidPointCloudFormat();
                     }
-                    result.Cloud.Color(point) = glm::vec4(
-                        NormalizeColorChannel(rawColor.r),
-                        NormalizeColorChannel(rawColor.g),
-                        NormalizeColorChannel(rawColor.b),
-                        1.0f);
-                }
-                else if (hasPackedColors)
-                {
-                    const auto color = ReadPCDBinaryPackedColor(pointBytes, *packedColorField);
-                    if (!color)
+                    const auto point = result.Cloud.AddPoint(position);
+
+                    if (hasNormals)
                     {
-                        return InvalidPointCloudFormat();
+                        const auto nx = ReadPCDBinaryScalar(pointBytes, *nxField);
+                        const auto ny = ReadPCDBinaryScalar(pointBytes, *nyField);
+                        const auto nz = ReadPCDBinaryScalar(pointBytes, *nzField);
+                        if (!nx || !ny || !nz)
+                        {
+                            return InvalidPointCloudFormat();
+                        }
+                        const glm::vec3 normal(*nx, *ny, *nz);
+                        if (!IsFinite(normal))
+                        {
+                            return InvalidPointCloudFormat();
+                        }
+                        result.Cloud.Normal(point) = normal;
+                    }
+                    if (hasSeparateColors)
+                    {
+                        const auto r = ReadPCDBinaryScalar(pointBytes, *rField);
+                        const auto g = ReadPCDBinaryScalar(pointBytes, *gField);
+                        const auto b = ReadPCDBinaryScalar(pointBytes, *bField);
+                        if (!r || !g || !b)
+                        {
+                            return InvalidPointCloudFormat();
+                        }
+                        const glm::vec3 rawColor(*r, *g, *b);
+                        if (!IsFinite(rawColor))
+                        {
+                            return InvalidPointCloudFormat();
+                        }
+                        result.Cloud.Color(point) = glm::vec4(
+                            NormalizeColorChannel(rawColor.r),
+                            NormalizeColorChannel(rawColor.g),
+                            NormalizeColorChannel(rawColor.b),
+                            1.0f);
+                    }
+                    else if (hasPackedColors)
+                    {
+                        const auto color = ReadPCDBinaryPackedColor(pointBytes, *packedColorField);
+                        if (!color)
+                        {
+                            return InvalidPointCloudFormat();
+                        }
+                        result.Cloud.Color(point) = *color;
                     }
-                    result.Cloud.Color(point) = *color;
                 }
             }
-        }
-        else
-        {
-            return InvalidPointCloudFormat();
-        }
+            else
+            {
+                return InvalidPointCloudFormat();
+            }
 
-        if (result.Cloud.IsEmpty() || (header.Points > 0 && result.Cloud.VerticesSize() != header.Points))
-        {
-            return InvalidPointCloudFormat();
+            if (result.Cloud.IsEmpty() || (header.Points > 0 && result.Cloud.VerticesSize() != header.Points))
+            {
+                return InvalidPointCloudFormat();
+            }
+            return result;
         }
-        return result;
     }
 
-    Extrinsic::Core::Expected<PointCloudIOResult> LoadPLY(std::string_view absolute_path)
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadPCD(std::string_view absolute_path)
     {
         auto text = ReadTextFile(absolute_path);
         if (!text)
         {
             return Extrinsic::Core::Err<PointCloudIOResult>(text.error());
         }
+        return ParsePCDDocument(*text, absolute_path, AsciiLoadOptions{}, nullptr);
+    }
 
-        std::size_t cursor = 0;
-        std::string_view line;
-        if (!NextLine(*text, cursor, line) || line != "ply")
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadPCD(std::string_view absolute_path,
+        Extrinsic::Core::IO::IIOBackend& backend,
+        const AsciiLoadOptions& options,
+        AsciiLoadDiagnostics* diagnostics)
+    {
+        auto read = backend.Read(Extrinsic::Core::IO::IORequest{.Path = std::string(absolute_path)});
+        if (!read)
         {
-            return InvalidPointCloudFormat();
+            return Extrinsic::Core::Err<PointCloudIOResult>(read.error());
         }
+        return ParsePCDDocument(ReadBytesAsText(*read), absolute_path, options, diagnostics);
+    }
 
-        PlyFormat format = PlyFormat::Ascii;
-        bool formatSeen = false;
-        bool headerEndSeen = false;
-        std::vector<PlyElement> elements;
-        while (NextLine(*text, cursor, line))
+    namespace
+    {
+        [[nodiscard]] Extrinsic::Core::Expected<PointCloudIOResult> ParsePLYDocument(std::string_view text,
+            std::string_view absolute_path)
         {
-            if (line == "end_header")
-            {
-                headerEndSeen = true;
-                break;
-            }
-            if (line.empty())
-            {
-                continue;
-            }
-            const auto tokens = SplitWhitespace(line);
-            if (tokens.empty())
-            {
-                continue;
-            }
-            if (tokens[0] == "comment" || tokens[0] == "obj_info")
+            std::size_t cursor = 0;
+            std::string_view line;
+            if (!NextLine(text, cursor, line) || line != "ply")
             {
-                continue;
+                return InvalidPointCloudFormat();
             }
-            if (tokens[0] == "format")
+
+            PlyFormat format = PlyFormat::Ascii;
+            bool formatSeen = false;
+            bool headerEndSeen = false;
+            std::vector<PlyElement> elements;
+            while (NextLine(text, cursor, line))
             {
-                if (tokens.size() != 3 || tokens[2] != "1.0")
-                {
-                    return InvalidPointCloudFormat();
-                }
-                if (tokens[1] == "ascii")
-                {
-                    format = PlyFormat::Ascii;
-                }
-                else if (tokens[1] == "binary_little_endian")
+                if (line == "end_header")
                 {
-                    format = PlyFormat::BinaryLittleEndian;
-                }
-                else if (tokens[1] == "binary_big_endian")
-                {
-                    format = PlyFormat::BinaryBigEndian;
-                }
-                else
-                {
-                    return InvalidPointCloudFormat();
+                    headerEndSeen = true;
+                    break;
                 }
-                formatSeen = true;
-            }
-            else if (tokens[0] == "element")
-            {
-                if (tokens.size() < 3)
+                if (line.empty())
                 {
-                    return InvalidPointCloudFormat();
+                    continue;
                 }
-                const auto count = ParseNumber<std::size_t>(tokens[2]);
-                if (!count)
+                const auto tokens = SplitWhitespace(line);
+                if (tokens.empty())
                 {
-                    return InvalidPointCloudFormat();
+                    continue;
                 }
-                PlyElement element;
-                element.Name = std::string(tokens[1]);
-                element.Count = *count;
-                elements.push_back(std::move(element));
-            }
-            else if (tokens[0] == "property")
-            {
-                if (elements.empty())
+                if (tokens[0] == "comment" || tokens[0] == "obj_info")
                 {
-                    return InvalidPointCloudFormat();
+                    continue;
                 }
-                PlyProperty prop;
-                if (tokens.size() >= 5 && tokens[1] == "list")
+                if (tokens[0] == "format")
                 {
-                    const auto countType = ParsePlyScalarType(tokens[2]);
-                    const auto elemType = ParsePlyScalarType(tokens[3]);
-                    if (!countType || !elemType)
+                    if (tokens.size() != 3 || tokens[2] != "1.0")
+                    {
+                        return InvalidPointCloudFormat();
+                    }
+                    if (tokens[1] == "ascii")
+                    {
+                        format = PlyFormat::Ascii;
+                    }
+                    else if (tokens[1] == "binary_little_endian")
+                    {
+                        format = PlyFormat::BinaryLittleEndian;
+                    }
+                    else if (tokens[1] == "binary_big_endian")
+                    {
+                        format = PlyFormat::BinaryBigEndian;
+                    }
+                    else
                     {
                         return InvalidPointCloudFormat();
                     }
-                    prop.IsList = true;
-                    prop.ListCountType = *countType;
-                    prop.ScalarType = *elemType;
-                    prop.Name = std::string(tokens[4]);
+                    formatSeen = true;
                 }
-                else if (tokens.size() >= 3)
+                else if (tokens[0] == "element")
                 {
-                    const auto scalarType = ParsePlyScalarType(tokens[1]);
-                    if (!scalarType)
+                    if (tokens.size() < 3)
+                    {
+                        return InvalidPointCloudFormat();
+                    }
+                    const auto count = ParseNumber<std::size_t>(tokens[2]);
+                    if (!count)
                     {
                         return InvalidPointCloudFormat();
                     }
-                    prop.IsList = false;
-                    prop.ScalarType = *scalarType;
-                    prop.Name = std::string(tokens[2]);
+                    PlyElement element;
+                    element.Name = std::string(tokens[1]);
+                    element.Count = *count;
+                    elements.push_back(std::move(element));
                 }
-                else
+                else if (tokens[0] == "property")
                 {
-                    return InvalidPointCloudFormat();
+                    if (elements.empty())
+                    {
+                        return InvalidPointCloudFormat();
+                    }
+                    PlyProperty prop;
+                    if (tokens.size() >= 5 && tokens[1] == "list")
+                    {
+                        const auto countType = ParsePlyScalarType(tokens[2]);
+                        const auto elemType = ParsePlyScalarType(tokens[3]);
+                        if (!countType || !elemType)
+                        {
+                            return InvalidPointCloudFormat();
+                        }
+                        prop.IsList = true;
+                        prop.ListCountType = *countType;
+                        prop.ScalarType = *elemType;
+                        prop.Name = std::string(tokens[4]);
+                    }
+                    else if (tokens.size() >= 3)
+                    {
+                        const auto scalarType = ParsePlyScalarType(tokens[1]);
+                        if (!scalarType)
+                        {
+                            return InvalidPointCloudFormat();
+                        }
+                        prop.IsList = false;
+                        prop.ScalarType = *scalarType;
+                        prop.Name = std::string(tokens[2]);
+                    }
+                    else
+                    {
+                        return InvalidPointCloudFormat();
+                    }
+                    elements.back().Properties.push_back(std::move(prop));
                 }
-                elements.back().Properties.push_back(std::move(prop));
             }
+
+            if (!formatSeen || !headerEndSeen)
+            {
+                return InvalidPointCloudFormat();
+            }
+
+            if (format == PlyFormat::Ascii)
+            {
+                return ParseAsciiPLYPointCloud(text, cursor, elements, absolute_path);
+            }
+
+            const std::span<const std::byte> body(
+                reinterpret_cast<const std::byte*>(text.data() + cursor),
+                text.size() - cursor);
+            return ParseBinaryPLYPointCloud(body, elements, format == PlyFormat::BinaryBigEndian, absolute_path);
         }
+    }
 
-        if (!formatSeen || !headerEndSeen)
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadPLY(std::string_view absolute_path)
+    {
+        auto text = ReadTextFile(absolute_path);
+        if (!text)
         {
-            return InvalidPointCloudFormat();
+            return Extrinsic::Core::Err<PointCloudIOResult>(text.error());
         }
+        return ParsePLYDocument(*text, absolute_path);
+    }
 
-        if (format == PlyFormat::Ascii)
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadPLY(std::string_view absolute_path,
+        Extrinsic::Core::IO::IIOBackend& backend)
+    {
+        auto read = backend.Read(Extrinsic::Core::IO::IORequest{.Path = std::string(absolute_path)});
+        if (!read)
         {
-            return ParseAsciiPLYPointCloud(*text, cursor, elements, absolute_path);
+            return Extrinsic::Core::Err<PointCloudIOResult>(read.error());
         }
 
-        const std::span<const std::byte> body(
-            reinterpret_cast<const std::byte*>(text->data() + cursor),
-            text->size() - cursor);
-        return ParseBinaryPLYPointCloud(body, elements, format == PlyFormat::BinaryBigEndian, absolute_path);
+        const std::span<const std::byte> bytes = read->Bytes();
+        return ParsePLYDocument(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()),
+            absolute_path);
     }
 
     PointCloudIOWriteStatus WritePLY(std::string_view absolute_path, const PointCloudIOResult& cloud)
@@ -1,12 +1,19 @@
 module;
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
 #include <string>
 #include <string_view>
 
+#include <glm/glm.hpp>
+
 export module Geometry.PointCloud.IO;
 
 import Geometry.PointCloud;
 import Extrinsic.Core.Error;
+import Extrinsic.Core.IOBackend;
 
 export namespace Geometry::PointCloudIO
 {
@@ -27,6 +34,163 @@ export namespace Geometry::PointCloudIO
     Extrinsic::Core::Expected<PointCloudIOResult> LoadPCD(std::string_view absolute_path);
     Extrinsic::Core::Expected<PointCloudIOResult> LoadPLY(std::string_view absolute_path);
 
+    // The XYZ, PTS, CSV, 3D, TXT and ASCII PCD readers cut the body into
+    // newline-aligned chunks and parse them in parallel on the task scheduler
+    // (serially when it is not initialized); rows keep their file order.
+    struct AsciiLoadOptions
+    {
+        // Target chunk size; each chunk runs on to the end of its last line.
+        std::size_t ChunkBytes{std::size_t{8} << 20u};
+    };
+
+    struct AsciiLoadDiagnostics
+    {
+        // 1-based file line of the row that rejected the load; 0 when the load
+        // succeeded or failed for a reason not tied to a row (I/O, empty file,
+        // point count mismatch).
+        std::size_t FailedLine{0};
+        std::size_t ChunkCount{0};
+    };
+
+    // Backend-routed loads parse straight out of IOReadResult::Bytes(), so an
+    // MmapIOBackend serves large files without an intermediate copy.
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadXYZ(std::string_view absolute_path,
+                                                          Extrinsic::Core::IO::IIOBackend& backend,
+                                                          const AsciiLoadOptions& options = {},
+                                                          AsciiLoadDiagnostics* diagnostics = nullptr);
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadPTS(std::string_view absolute_path,
+                                                          Extrinsic::Core::IO::IIOBackend& backend,
+                                                          const AsciiLoadOptions& options = {},
+                                                          AsciiLoadDiagnostics* diagnostics = nullptr);
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadCSV(std::string_view absolute_path,
+                                                          Extrinsic::Core::IO::IIOBackend& backend,
+                                                          const AsciiLoadOptions& options = {},
+                                                          AsciiLoadDiagnostics* diagnostics = nullptr);
+    Extrinsic::Core::Expected<PointCloudIOResult> Load3D(std::string_view absolute_path,
+                                                         Extrinsic::Core::IO::IIOBackend& backend,
+                                                         const AsciiLoadOptions& options = {},
+                                                         AsciiLoadDiagnostics* diagnostics = nullptr);
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadTXT(std::string_view absolute_path,
+                                                          Extrinsic::Core::IO::IIOBackend& backend,
+                                                          const AsciiLoadOptions& options = {},
+                                                          AsciiLoadDiagnostics* diagnostics = nullptr);
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadPCD(std::string_view absolute_path,
+                                                          Extrinsic::Core::IO::IIOBackend& backend,
+                                                          const AsciiLoadOptions& options = {},
+                                                          AsciiLoadDiagnostics* diagnostics = nullptr);
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadPLY(std::string_view absolute_path,
+                                                          Extrinsic::Core::IO::IIOBackend& backend);
+
+    // ---- LAS 1.0-1.4 ----
+    // Uncompressed point data record formats 0-10, decoded without an external
+    // library. Compressed (LAZ) point data is rejected with UnsupportedFormat;
+    // records longer than their format carry extra bytes, which are skipped.
+    // Coordinates are decoded in double precision as offset + scale * value,
+    // less LasLoadOptions::Origin, and then stored as float.
+
+    struct LasHeader
+    {
+        std::uint8_t VersionMajor{1};
+        std::uint8_t VersionMinor{2};
+        std::uint8_t PointFormat{0};
+        std::uint16_t HeaderSize{0};
+        std::uint16_t PointRecordLength{0};
+        std::uint32_t PointDataOffset{0};
+        std::uint64_t PointCount{0};
+        glm::dvec3 Scale{1.0};
+        glm::dvec3 Offset{0.0};
+        glm::dvec3 BoundsMin{0.0};
+        glm::dvec3 BoundsMax{0.0};
+
+        [[nodiscard]] bool HasGpsTime() const noexcept
+        {
+            return PointFormat == 1u || PointFormat >= 3u;
+        }
+
+        [[nodiscard]] bool HasColors() const noexcept
+        {
+            return PointFormat == 2u || PointFormat == 3u || PointFormat == 5u || PointFormat == 7u ||
+                PointFormat == 8u || PointFormat == 10u;
+        }
+    };
+
+    struct LasLoadOptions
+    {
+        // Records per batch: the unit StreamLAS hands to its callback and
+        // LoadLAS decodes per task. Each batch is one ranged backend read.
+        std::size_t BatchPoints{std::size_t{1} << 16u};
+
+        // Subtracted from every decoded coordinate before the float
+        // conversion. Projected airborne coordinates (~1e6 m) lose
+        // centimetres in float; pass the header's BoundsMin from
+        // ReadLASHeader to keep them.
+        glm::dvec3 Origin{0.0};
+
+        // Attribute channels to decode; channels the point format lacks stay
+        // empty.
+        bool Intensity{true};
+        bool Classification{true};
+        bool Returns{true};
+        bool GpsTime{true};
+        bool Colors{true};
+
+        // When set, records outside [CropMin, CropMax] (file coordinates,
+        // inclusive) are dropped before any attribute is decoded.
+        bool Crop{false};
+        glm::dvec3 CropMin{0.0};
+        glm::dvec3 CropMax{0.0};
+    };
+
+    // Named point properties LoadLAS attaches to the cloud, one per decoded
+    // channel. Colors go to the built-in color channel (16-bit RGB / 65535).
+    inline constexpr std::string_view kLasIntensityProperty = "p:intensity";             // std::uint16_t
+    inline constexpr std::string_view kLasClassificationProperty = "p:classification";   // std::uint8_t
+    inline constexpr std::string_view kLasReturnNumberProperty = "p:return_number";      // std::uint8_t
+    inline constexpr std::string_view kLasReturnCountProperty = "p:return_count";        // std::uint8_t
+    inline constexpr std::string_view kLasGpsTimeProperty = "p:gps_time";                // double
+
+    // One batch of decoded records. Attribute spans are either empty or hold
+    // one entry per position. The spans stay valid only during the callback.
+    struct LasPointBatch
+    {
+        // File index of the first record read for this batch; with cropping
+        // the batch may hold fewer points than records read.
+        std::uint64_t FirstRecord{0};
+        std::span<const glm::vec3> Positions{};
+        std::span<const std::uint16_t> Intensities{};
+        std::span<const std::uint8_t> Classifications{};
+        std::span<const std::uint8_t> ReturnNumbers{};
+        std::span<const std::uint8_t> ReturnCounts{};
+        std::span<const double> GpsTimes{};
+        std::span<const glm::vec4> Colors{};
+    };
+
+    // Return false to stop streaming; the call still succeeds.
+    using LasBatchCallback = std::function<bool(const LasPointBatch&)>;
+
+    // Errors: FileNotFound / FileReadError from the backend, InvalidFormat
+    // for a malformed or truncated file, UnsupportedFormat for LAZ, unknown
+    // point formats or major versions other than 1, InvalidArgument for a
+    // zero BatchPoints.
+    Extrinsic::Core::Expected<LasHeader> ReadLASHeader(std::string_view absolute_path,
+                                                       Extrinsic::Core::IO::IIOBackend& backend);
+
+    // Streams the point records in file order, one ranged read per batch,
+    // so only one batch is resident at a time. Returns the file header.
+    Extrinsic::Core::Expected<LasHeader> StreamLAS(std::string_view absolute_path,
+                                                   Extrinsic::Core::IO::IIOBackend& backend,
+                                                   const LasLoadOptions& options,
+                                                   const LasBatchCallback& onBatch);
+
+    // Decodes the batches in parallel on the task scheduler (serially when it
+    // is not initialized) and appends them in file order. A file whose
+    // records are all cropped away fails with InvalidFormat, like an empty
+    // file.
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadLAS(std::string_view absolute_path);
+    Extrinsic::Core::Expected<PointCloudIOResult> LoadLAS(std::string_view absolute_path,
+                                                          Extrinsic::Core::IO::IIOBackend& backend,
+                                                          const LasLoadOptions& options = {});
+
     enum class PointCloudIOWriteStatus
     {
         Success = 0,
@@ -1,16 +1,20 @@
 module;
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
+#include <numeric>
 #include <optional>
-#include <queue>
 #include <span>
 #include <string>
 #include <string_view>
-#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -19,10 +23,12 @@ module;
 
 module Geometry.PointCloud.Normals;
 
+import Extrinsic.Core.Parallel;
 import Geometry.KDTree;
 import Geometry.Octree;
 import Geometry.PCA;
 import Geometry.PointCloud;
+import Geometry.PointKDTree;
 import Geometry.Properties;
 import Geometry.Primitives;
 
@@ -30,18 +36,43 @@ namespace Geometry::PointCloud::Normals
 {
     namespace
     {
+        namespace Parallel = Extrinsic::Core::Parallel;
+
         constexpr glm::vec3 kDefaultFallbackNormal{0.0f, 0.0f, 1.0f};
-        constexpr std::size_t kInvalidPointIndex = std::numeric_limits<std::size_t>::max();
+        constexpr std::uint32_t kInvalidVertex = std::numeric_limits<std::uint32_t>::max();
+        constexpr std::uint64_t kNoEdge = std::numeric_limits<std::uint64_t>::max();
+
+        // Points per estimation task. Each point costs one neighbourhood
+        // query and a small PCA, so chunks stay small enough to balance
+        // clustered clouds whose queries differ in cost.
+        constexpr std::size_t kEstimateGrain = 1024u;
+        // Average valid points per orientation cell; a cell is one local
+        // Kruskal task.
+        constexpr std::size_t kOrientationCellPoints = 4096u;
+        constexpr std::size_t kEdgeGrain = 16384u;
 
         struct QueryContext
         {
             NeighborhoodBackend Backend{NeighborhoodBackend::KDTree};
             const KDTree* KdTree{nullptr};
             const Octree* OctreeIndex{nullptr};
-            KDTree OwnedKdTree{};
-            std::vector<glm::vec3> CompactPoints{};
+            PointKDTree OwnedTree{};
             std::vector<std::size_t> CompactToOriginal{};
-            std::vector<std::size_t> OriginalToCompact{};
+        };
+
+        // Filtered neighbourhoods of the points with a valid normal in CSR
+        // form: the neighbours of point i are
+        // Indices[Offsets[i], Offsets[i + 1]), ordered by (distance, index).
+        struct NeighborGraph
+        {
+            std::vector<std::size_t> Offsets{};
+            std::vector<std::uint32_t> Indices{};
+
+            [[nodiscard]] std::span<const std::uint32_t> Of(const std::size_t point) const noexcept
+            {
+                return std::span<const std::uint32_t>{Indices}.subspan(
+                    Offsets[point], Offsets[point + 1u] - Offsets[point]);
+            }
         };
 
         [[nodiscard]] bool IsFinite(const glm::vec3 value) noexcept
@@ -176,10 +207,9 @@ namespace Geometry::PointCloud::Normals
                                                  QueryContext& context)
         {
             context.Backend = NeighborhoodBackend::KDTree;
-            context.OriginalToCompact.assign(points.size(), kInvalidPointIndex);
-            context.CompactPoints.clear();
             context.CompactToOriginal.clear();
 
+            std::vector<glm::vec3> compactPoints;
             for (std::size_t index = 0; index < points.size(); ++index)
             {
                 if (IsDeletedPoint(deleted, index, params))
@@ -193,27 +223,31 @@ namespace Geometry::PointCloud::Normals
                     continue;
                 }
 
-                context.OriginalToCompact[index] = context.CompactPoints.size();
                 context.CompactToOriginal.push_back(index);
-                context.CompactPoints.push_back(points[index]);
+                compactPoints.push_back(points[index]);
             }
 
-            result.Diagnostics.FinitePointCount = context.CompactPoints.size();
-            if (context.CompactPoints.size() < 3u)
+            result.Diagnostics.FinitePointCount = compactPoints.size();
+            if (compactPoints.size() < 3u)
             {
                 result.Status = RecomputeStatus::TooFewFinitePoints;
                 MarkAllNonDeletedFallbacks(points, deleted, params, result.Diagnostics);
                 return false;
             }
 
-            const auto build = context.OwnedKdTree.BuildFromPoints(context.CompactPoints, params.KDTreeBuild);
-            if (!build.has_value())
+            // The point-only tree returns the same (distance, index) ordered
+            // neighbourhoods as KDTree and keeps its own leaf-ordered copy of
+            // the positions.
+            const PointKDTreeBuildParams buildParams{
+                .LeafSize = params.KDTreeBuild.LeafSize,
+                .MaxDepth = params.KDTreeBuild.MaxDepth,
+            };
+            if (!context.OwnedTree.Build(compactPoints, buildParams).has_value())
             {
                 result.Status = RecomputeStatus::SpatialIndexBuildFailed;
                 return false;
             }
 
-            context.KdTree = &context.OwnedKdTree;
             return true;
         }
 
@@ -247,72 +281,66 @@ namespace Geometry::PointCloud::Normals
             return true;
         }
 
-        [[nodiscard]] bool QueryKDTreeNeighbors(const KDTree& tree,
-                                                const QueryContext& context,
-                                                const bool compactIndex,
-                                                const glm::vec3 query,
-                                                const std::size_t queryIndex,
-                                                const Params& params,
-                                                EstimateResult& result,
-                                                std::vector<std::size_t>& out)
+        // Shared by the internal PointKDTree and a supplied KDTree; both
+        // return neighbourhoods ordered by (distance, index). A non-empty
+        // compactToOriginal maps tree indices back to input indices.
+        template <typename Tree>
+        [[nodiscard]] bool QueryTreeNeighbors(const Tree& tree,
+                                              std::span<const std::size_t> compactToOriginal,
+                                              const glm::vec3 query,
+                                              const Params& params,
+                                              Diagnostics& diagnostics,
+                                              std::vector<std::uint32_t>& indices,
+                                              std::vector<std::size_t>& out)
         {
             out.clear();
             if (params.UseRadiusSearch)
             {
                 if (!std::isfinite(params.Radius) || params.Radius <= 0.0f)
                 {
-                    ++result.Diagnostics.SpatialQueryFailureCount;
+                    ++diagnostics.SpatialQueryFailureCount;
                     return false;
                 }
 
-                std::vector<KDTree::ElementIndex> indices;
                 const auto queryResult = tree.QueryRadius(query, params.Radius, indices);
                 if (!queryResult.has_value())
                 {
-                    ++result.Diagnostics.SpatialQueryFailureCount;
+                    ++diagnostics.SpatialQueryFailureCount;
                     return false;
                 }
 
-                result.Diagnostics.KNNVisitedNodeCount += queryResult->VisitedNodes;
-                result.Diagnostics.KNNDistanceEvaluationCount += queryResult->DistanceEvaluations;
-                out.reserve(indices.size());
-                for (const auto index : indices)
+                diagnostics.KNNVisitedNodeCount += queryResult->VisitedNodes;
+                diagnostics.KNNDistanceEvaluationCount += queryResult->DistanceEvaluations;
+            }
+            else
+            {
+                const std::size_t target = EffectiveNeighborTarget(params) + 1u;
+                const auto queryResult = tree.QueryKNN(query, static_cast<std::uint32_t>(target), indices);
+                if (!queryResult.has_value())
                 {
-                    const std::size_t mapped = compactIndex
-                        ? context.CompactToOriginal[static_cast<std::size_t>(index)]
-                        : static_cast<std::size_t>(index);
-                    out.push_back(mapped);
+                    ++diagnostics.SpatialQueryFailureCount;
+                    return false;
                 }
-                return true;
-            }
 
-            const std::size_t target = EffectiveNeighborTarget(params) + 1u;
-            std::vector<KDTree::ElementIndex> indices;
-            const auto queryResult = tree.QueryKNN(query, static_cast<std::uint32_t>(target), indices);
-            if (!queryResult.has_value())
-            {
-                ++result.Diagnostics.SpatialQueryFailureCount;
-                return false;
+                diagnostics.KNNVisitedNodeCount += queryResult->VisitedNodes;
+                diagnostics.KNNDistanceEvaluationCount += queryResult->DistanceEvaluations;
             }
 
-            result.Diagnostics.KNNVisitedNodeCount += queryResult->VisitedNodes;
-            result.Diagnostics.KNNDistanceEvaluationCount += queryResult->DistanceEvaluations;
             out.reserve(indices.size());
             for (const auto index : indices)
             {
-                const std::size_t mapped = compactIndex
-                    ? context.CompactToOriginal[static_cast<std::size_t>(index)]
-                    : static_cast<std::size_t>(index);
+                const std::size_t mapped = compactToOriginal.empty()
+                    ? static_cast<std::size_t>(index)
+                    : compactToOriginal[static_cast<std::size_t>(index)];
                 out.push_back(mapped);
             }
-            static_cast<void>(queryIndex);
             return true;
         }
 
         [[nodiscard]] bool QueryOctreeNeighbors(const Octree& octree,
                                                 const glm::vec3 query,
                                                 const Params& params,
-                                                EstimateResult& result,
+                                                Diagnostics& diagnostics,
                                                 std::vector<std::size_t>& out)
         {
             out.clear();
@@ -320,7 +348,7 @@ namespace Geometry::PointCloud::Normals
             {
                 if (!std::isfinite(params.Radius) || params.Radius <= 0.0f)
                 {
-                    ++result.Diagnostics.SpatialQueryFailureCount;
+                    ++diagnostics.SpatialQueryFailureCount;
                     return false;
                 }
 
@@ -352,227 +380,801 @@ namespace Geometry::PointCloud::Normals
             }
         }
 
-        void OrientNormalsMST(std::span<const glm::vec3> points,
-                              const glm::vec3 fallbackNormal,
-                              const std::vector<std::vector<std::size_t>>& neighborhoods,
-                              const std::vector<bool>& validNormals,
-                              std::vector<glm::vec3>& normals,
-                              Diagnostics& diagnostics)
+        void AccumulateEstimateCounts(Diagnostics& into, const Diagnostics& from) noexcept
         {
-            const std::size_t n = points.size();
-            std::vector<bool> visited(n, false);
+            into.WrittenCount += from.WrittenCount;
+            into.ValidNormalPointCount += from.ValidNormalPointCount;
+            into.FallbackPointCount += from.FallbackPointCount;
+            into.DegenerateNeighborhoodCount += from.DegenerateNeighborhoodCount;
+            into.TooFewNeighborCount += from.TooFewNeighborCount;
+            into.CollinearNeighborhoodCount += from.CollinearNeighborhoodCount;
+            into.DuplicatePositionCount += from.DuplicatePositionCount;
+            into.SpatialQueryFailureCount += from.SpatialQueryFailureCount;
+            into.KNNVisitedNodeCount += from.KNNVisitedNodeCount;
+            into.KNNDistanceEvaluationCount += from.KNNDistanceEvaluationCount;
+        }
+
+        struct EstimateJob
+        {
+            std::span<const glm::vec3> Points{};
+            const ConstProperty<bool>& Deleted;
+            const QueryContext& Context;
+            const Params& Settings;
+            std::span<glm::vec3> Normals{};
+            std::span<std::uint8_t> ValidNormals{};
+            // Neighbour count per point; exclusive-scanned into CSR offsets.
+            std::span<std::size_t> NeighborCounts{};
+        };
 
-            using QueueEntry = std::tuple<float, std::size_t, std::size_t>;
-            std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> queue;
+        struct EstimatePartial
+        {
+            Diagnostics Counts{};
+            std::vector<std::uint32_t> Neighbors{};
+        };
+
+        // Estimates the normals of one chunk of points. Only points that end
+        // up with a valid normal keep their neighbourhood for orientation.
+        void EstimateChunk(const EstimateJob& job,
+                           const Parallel::IndexRange range,
+                           EstimatePartial& partial)
+        {
+            const Params& params = job.Settings;
+            const QueryContext& context = job.Context;
+            Diagnostics& counts = partial.Counts;
+
+            std::vector<std::uint32_t> treeIndices;
+            std::vector<std::size_t> neighbors;
+            std::vector<glm::vec3> samples;
 
-            while (true)
+            for (std::size_t index = range.Begin; index < range.End; ++index)
             {
-                std::size_t seed = kInvalidPointIndex;
-                float bestZ = -std::numeric_limits<float>::max();
-                for (std::size_t i = 0; i < n; ++i)
+                if (IsDeletedPoint(job.Deleted, index, params))
                 {
-                    if (!validNormals[i] || visited[i])
-                    {
-                        continue;
-                    }
-                    if (points[i].z > bestZ || (points[i].z == bestZ && i < seed))
-                    {
-                        bestZ = points[i].z;
-                        seed = i;
-                    }
+                    continue;
                 }
 
-                if (seed == kInvalidPointIndex)
+                const glm::vec3 point = job.Points[index];
+                if (!IsFinite(point))
                 {
-                    break;
+                    ++counts.FallbackPointCount;
+                    ++counts.WrittenCount;
+                    continue;
                 }
 
-                if (glm::dot(normals[seed], fallbackNormal) < 0.0f)
+                bool queryOk = false;
+                if (context.Backend == NeighborhoodBackend::KDTree)
                 {
-                    normals[seed] = -normals[seed];
-                    ++diagnostics.FlippedOrientationCount;
+                    queryOk = QueryTreeNeighbors(context.OwnedTree, context.CompactToOriginal, point,
+                                                 params, counts, treeIndices, neighbors);
+                }
+                else if (context.Backend == NeighborhoodBackend::SuppliedKDTree)
+                {
+                    queryOk = context.KdTree != nullptr
+                        && QueryTreeNeighbors(*context.KdTree, {}, point, params, counts, treeIndices, neighbors);
+                }
+                else
+                {
+                    queryOk = context.OctreeIndex != nullptr
+                        && QueryOctreeNeighbors(*context.OctreeIndex, point, params, counts, neighbors);
                 }
 
-                queue.emplace(0.0f, seed, seed);
-                while (!queue.empty())
+                if (!queryOk)
                 {
-                    const auto [weight, current, parent] = queue.top();
-                    static_cast<void>(weight);
-                    queue.pop();
+                    ++counts.FallbackPointCount;
+                    ++counts.WrittenCount;
+                    continue;
+                }
 
-                    if (visited[current])
-                    {
-                        continue;
-                    }
-                    visited[current] = true;
+                SortAndFilterNeighbors(job.Points, job.Deleted, index, params, neighbors);
 
-                    if (current != parent && glm::dot(normals[current], normals[parent]) < 0.0f)
-                    {
-                        normals[current] = -normals[current];
-                        ++diagnostics.FlippedOrientationCount;
-                    }
+                if (neighbors.size() < params.MinimumNeighbors)
+                {
+                    ++counts.TooFewNeighborCount;
+                    ++counts.FallbackPointCount;
+                    ++counts.WrittenCount;
+                    continue;
+                }
 
-                    for (const std::size_t neighbor : neighborhoods[current])
-                    {
-                        if (neighbor >= n || visited[neighbor] || !validNormals[neighbor])
-                        {
-                            continue;
-                        }
-                        const float edgeWeight = 1.0f - std::abs(glm::dot(normals[current], normals[neighbor]));
-                        queue.emplace(edgeWeight, neighbor, current);
-                    }
+                samples.clear();
+                samples.push_back(point);
+                for (const std::size_t neighbor : neighbors)
+                {
+                    samples.push_back(job.Points[neighbor]);
+                }
+
+                if (samples.size() < 3u)
+                {
+                    ++counts.DegenerateNeighborhoodCount;
+                    ++counts.FallbackPointCount;
+                    ++counts.WrittenCount;
+                    continue;
                 }
+
+                CountDuplicateSamples(samples, params, counts);
+
+                const PCAResult pca = ToPCA(samples);
+                if (!pca.Valid || IsCollinearNeighborhood(pca, params))
+                {
+                    ++counts.CollinearNeighborhoodCount;
+                    ++counts.FallbackPointCount;
+                    ++counts.WrittenCount;
+                    continue;
+                }
+
+                glm::vec3 normal = pca.Eigenvectors[2];
+                if (!NormalizeNormal(normal, params))
+                {
+                    ++counts.DegenerateNeighborhoodCount;
+                    ++counts.FallbackPointCount;
+                    ++counts.WrittenCount;
+                    continue;
+                }
+
+                job.Normals[index] = normal;
+                job.ValidNormals[index] = 1u;
+                job.NeighborCounts[index] = neighbors.size();
+                for (const std::size_t neighbor : neighbors)
+                {
+                    partial.Neighbors.push_back(static_cast<std::uint32_t>(neighbor));
+                }
+                ++counts.ValidNormalPointCount;
+                ++counts.WrittenCount;
             }
         }
 
-        [[nodiscard]] EstimateResult Compute(std::span<const glm::vec3> points,
-                                             const ConstProperty<bool>& deleted,
-                                             QueryContext& context,
-                                             const Params& params)
+        // Union-find with union by size; ties keep the lower index as root.
+        // Find() halves paths and is for serial use. FindRoot() only reads,
+        // so it may run concurrently between serial merge passes.
+        class DisjointSets
         {
-            EstimateResult result{};
-            result.Backend = context.Backend;
-            result.Diagnostics.PointSlotCount = points.size();
+        public:
+            explicit DisjointSets(const std::size_t count)
+                : m_Parent(count), m_Size(count, 1u)
+            {
+                std::iota(m_Parent.begin(), m_Parent.end(), 0u);
+            }
 
-            glm::vec3 fallbackNormal{0.0f};
-            NormalizeFallback(params, result.Diagnostics, fallbackNormal);
-            result.Normals.assign(points.size(), fallbackNormal);
+            [[nodiscard]] std::uint32_t Find(std::uint32_t v) noexcept
+            {
+                while (m_Parent[v] != v)
+                {
+                    m_Parent[v] = m_Parent[m_Parent[v]];
+                    v = m_Parent[v];
+                }
+                return v;
+            }
 
-            if (points.empty())
+            [[nodiscard]] std::uint32_t FindRoot(std::uint32_t v) const noexcept
             {
-                result.Status = RecomputeStatus::EmptyInput;
-                return result;
+                while (m_Parent[v] != v)
+                {
+                    v = m_Parent[v];
+                }
+                return v;
             }
 
-            if (context.Backend == NeighborhoodBackend::KDTree)
+            [[nodiscard]] bool IsRoot(const std::uint32_t v) const noexcept { return m_Parent[v] == v; }
+
+            bool Union(const std::uint32_t a, const std::uint32_t b) noexcept
             {
-                if (!PrepareInternalKDTree(points, deleted, params, result, context))
+                std::uint32_t rootA = Find(a);
+                std::uint32_t rootB = Find(b);
+                if (rootA == rootB)
                 {
-                    return result;
+                    return false;
+                }
+                if (m_Size[rootA] < m_Size[rootB] || (m_Size[rootA] == m_Size[rootB] && rootB < rootA))
+                {
+                    std::swap(rootA, rootB);
                 }
+                m_Parent[rootB] = rootA;
+                m_Size[rootA] += m_Size[rootB];
+                return true;
             }
-            else if (!PrepareSuppliedIndex(points, deleted, params, result))
+
+        private:
+            std::vector<std::uint32_t> m_Parent;
+            std::vector<std::uint32_t> m_Size;
+        };
+
+        // Undirected edge of the symmetrized neighbour graph, A < B.
+        struct OrientationEdge
+        {
+            float Weight{0.0f};
+            std::uint32_t A{0};
+            std::uint32_t B{0};
+        };
+
+        [[nodiscard]] bool EdgeLess(const OrientationEdge& lhs, const OrientationEdge& rhs) noexcept
+        {
+            if (lhs.Weight != rhs.Weight)
             {
-                return result;
+                return lhs.Weight < rhs.Weight;
+            }
+            if (lhs.A != rhs.A)
+            {
+                return lhs.A < rhs.A;
             }
+            return lhs.B < rhs.B;
+        }
 
-            std::vector<std::vector<std::size_t>> neighborhoods(points.size());
-            std::vector<bool> validNormals(points.size(), false);
-            std::vector<std::size_t> neighbors;
-            std::vector<glm::vec3> samples;
+        // 1 - |cos| between the two normals, clamped at zero so the IEEE
+        // bit pattern of the weight orders like its value.
+        [[nodiscard]] float EdgeWeight(const glm::vec3 a, const glm::vec3 b) noexcept
+        {
+            return std::max(0.0f, 1.0f - std::abs(glm::dot(a, b)));
+        }
 
-            for (std::size_t index = 0; index < points.size(); ++index)
+        // Uniform grid over the valid points with about
+        // kOrientationCellPoints points per cell on average. Axes much
+        // thinner than a cell (planar scans) collapse to a single layer.
+        struct CellGrid
+        {
+            glm::vec3 Origin{0.0f};
+            float InvCellSize{0.0f};
+            std::array<std::uint32_t, 3> Dims{1u, 1u, 1u};
+
+            [[nodiscard]] std::size_t CellCount() const noexcept
             {
-                if (IsDeletedPoint(deleted, index, params))
+                return static_cast<std::size_t>(Dims[0]) * Dims[1] * Dims[2];
+            }
+
+            [[nodiscard]] std::uint32_t CellOf(const glm::vec3 point) const noexcept
+            {
+                std::array<std::uint32_t, 3> cell{};
+                for (int axis = 0; axis < 3; ++axis)
                 {
-                    continue;
+                    const float t = std::max(0.0f, (point[axis] - Origin[axis]) * InvCellSize);
+                    cell[axis] = std::min(Dims[axis] - 1u, static_cast<std::uint32_t>(std::min(t, 1.0e9f)));
                 }
+                return (cell[2] * Dims[1] + cell[1]) * Dims[0] + cell[0];
+            }
+        };
 
-                if (!IsFinite(points[index]))
+        [[nodiscard]] CellGrid MakeCellGrid(const glm::vec3 minCorner,
+                                            const glm::vec3 maxCorner,
+                                            const std::size_t validCount) noexcept
+        {
+            CellGrid grid{};
+            grid.Origin = minCorner;
+            const double targetCells = static_cast<double>(validCount / kOrientationCellPoints);
+            if (targetCells <= 1.0)
+            {
+                return grid;
+            }
+
+            const glm::dvec3 extent = glm::dvec3(maxCorner) - glm::dvec3(minCorner);
+            std::array<double, 3> sorted{extent.x, extent.y, extent.z};
+            std::sort(sorted.begin(), sorted.end(), std::greater<>{});
+
+            double side = 0.0;
+            for (int active = 3; active >= 1; --active)
+            {
+                double volume = 1.0;
+                for (int axis = 0; axis < active; ++axis)
                 {
-                    ++result.Diagnostics.FallbackPointCount;
-                    ++result.Diagnostics.WrittenCount;
-                    continue;
+                    volume *= sorted[static_cast<std::size_t>(axis)];
                 }
+                side = std::pow(volume / targetCells, 1.0 / static_cast<double>(active));
+                if (active == 1 || sorted[static_cast<std::size_t>(active - 1)] >= side)
+                {
+                    break;
+                }
+            }
+            if (!std::isfinite(side) || side <= 0.0)
+            {
+                return grid;
+            }
 
-                bool queryOk = false;
-                if (context.Backend == NeighborhoodBackend::KDTree)
+            // Every active axis spans at least one cell side, so the grid
+            // holds at most 8x the target cell count.
+            grid.InvCellSize = static_cast<float>(1.0 / side);
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const double cells = std::floor(extent[axis] / side) + 1.0;
+                grid.Dims[static_cast<std::size_t>(axis)] =
+                    static_cast<std::uint32_t>(std::max(cells, 1.0));
+            }
+            return grid;
+        }
+
+        // True when the edge {v, q} is emitted from q's list instead: every
+        // undirected edge is emitted once, by its lower endpoint if that
+        // endpoint lists the other, otherwise by the one that does.
+        [[nodiscard]] bool EmittedByNeighbor(const NeighborGraph& graph,
+                                             const std::uint32_t v,
+                                             const std::uint32_t q) noexcept
+        {
+            if (q > v)
+            {
+                return false;
+            }
+            const auto reverse = graph.Of(q);
+            return std::find(reverse.begin(), reverse.end(), v) != reverse.end();
+        }
+
+        // (weight bits, index): the weights are non-negative, so integer
+        // order matches (weight, index) order.
+        [[nodiscard]] std::uint64_t EdgeKey(const float weight, const std::size_t index) noexcept
+        {
+            return (static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(weight)) << 32u)
+                | static_cast<std::uint64_t>(index);
+        }
+
+        // Keys are created in ascending index order, so a stable LSD radix
+        // sort on the weight half alone yields full (weight, index) order.
+        void SortEdgeKeys(std::vector<std::uint64_t>& keys, std::vector<std::uint64_t>& scratch)
+        {
+            constexpr std::size_t kRadixCutoff = 256u;
+            if (keys.size() < kRadixCutoff)
+            {
+                std::sort(keys.begin(), keys.end());
+                return;
+            }
+
+            constexpr unsigned kDigitBits = 11u;
+            constexpr std::size_t kBuckets = std::size_t{1} << kDigitBits;
+            scratch.resize(keys.size());
+            std::array<std::size_t, kBuckets> offsets{};
+            for (unsigned shift = 32u; shift < 64u; shift += kDigitBits)
+            {
+                offsets.fill(0u);
+                for (const std::uint64_t key : keys)
                 {
-                    queryOk = QueryKDTreeNeighbors(*context.KdTree,
-                                                   context,
-                                                   true,
-                                                   points[index],
-                                                   index,
-                                                   params,
-                                                   result,
-                                                   neighbors);
+                    ++offsets[(key >> shift) & (kBuckets - 1u)];
                 }
-                else if (context.Backend == NeighborhoodBackend::SuppliedKDTree)
+                std::size_t running = 0;
+                for (std::size_t& offset : offsets)
                 {
-                    queryOk = context.KdTree != nullptr
-                        && QueryKDTreeNeighbors(*context.KdTree,
-                                                context,
-                                                false,
-                                                points[index],
-                                                index,
-                                                params,
-                                                result,
-                                                neighbors);
+                    running += std::exchange(offset, running);
                 }
-                else
+                for (const std::uint64_t key : keys)
                 {
-                    queryOk = context.OctreeIndex != nullptr
-                        && QueryOctreeNeighbors(*context.OctreeIndex,
-                                                points[index],
-                                                params,
-                                                result,
-                                                neighbors);
+                    scratch[offsets[(key >> shift) & (kBuckets - 1u)]++] = key;
                 }
+                keys.swap(scratch);
+            }
+        }
 
-                if (!queryOk)
+        void AtomicMin(std::atomic<std::uint64_t>& slot, const std::uint64_t value) noexcept
+        {
+            std::uint64_t current = slot.load(std::memory_order_relaxed);
+            while (value < current
+                   && !slot.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        // Minimum spanning forest of the symmetrized neighbour graph over the
+        // points with valid normals, weighted by 1 - |n_i . n_j|.
+        //
+        // Points are bucketed into grid cells and every cell runs Kruskal on
+        // its internal edges in parallel. By the cycle property an internal
+        // edge a cell drops is the heaviest on some cycle and cannot be in a
+        // minimum spanning forest of the whole graph, so the cell forests
+        // plus the cross-cell edges still contain one. Boruvka rounds then
+        // stitch that reduced edge set: every component picks its lightest
+        // incident edge with an atomic min over EdgeKey, the picks are merged
+        // serially in component order, labels are refreshed in parallel, and
+        // edges that became internal are dropped. The forest does not depend
+        // on the thread count.
+        [[nodiscard]] std::vector<OrientationEdge> MinimumSpanningForest(std::span<const glm::vec3> points,
+                                                                         std::span<const glm::vec3> normals,
+                                                                         std::span<const std::uint8_t> validNormals,
+                                                                         const NeighborGraph& graph,
+                                                                         Diagnostics& diagnostics)
+        {
+            const std::size_t n = points.size();
+            const Parallel::IndexRange vertexRange{0u, n};
+
+            struct Bounds
+            {
+                glm::vec3 Min{std::numeric_limits<float>::max()};
+                glm::vec3 Max{-std::numeric_limits<float>::max()};
+                std::size_t Count{0};
+            };
+            const Bounds bounds = Parallel::ParallelReduce(
+                vertexRange, kEdgeGrain, Bounds{},
+                [&](const Parallel::IndexRange range, Bounds acc)
                 {
-                    ++result.Diagnostics.FallbackPointCount;
-                    ++result.Diagnostics.WrittenCount;
-                    continue;
+                    for (std::size_t v = range.Begin; v < range.End; ++v)
+                    {
+                        if (validNormals[v] != 0u)
+                        {
+                            acc.Min = glm::min(acc.Min, points[v]);
+                            acc.Max = glm::max(acc.Max, points[v]);
+                            ++acc.Count;
+                        }
+                    }
+                    return acc;
+                },
+                [](Bounds lhs, const Bounds& rhs)
+                {
+                    lhs.Min = glm::min(lhs.Min, rhs.Min);
+                    lhs.Max = glm::max(lhs.Max, rhs.Max);
+                    lhs.Count += rhs.Count;
+                    return lhs;
+                });
+            if (bounds.Count < 2u)
+            {
+                diagnostics.OrientationComponentCount = bounds.Count;
+                return {};
+            }
+
+            const CellGrid grid = MakeCellGrid(bounds.Min, bounds.Max, bounds.Count);
+            const std::size_t cellCount = grid.CellCount();
+            diagnostics.OrientationCellCount = cellCount;
+
+            std::vector<std::uint32_t> cellOf(n, kInvalidVertex);
+            Parallel::ParallelFor(vertexRange, kEdgeGrain, [&](const std::size_t v)
+            {
+                if (validNormals[v] != 0u)
+                {
+                    cellOf[v] = grid.CellOf(points[v]);
+                }
+            });
+
+            // Counting sort keeps each cell's points in ascending index order.
+            std::vector<std::size_t> cellStart(cellCount + 1u, 0u);
+            for (std::size_t v = 0; v < n; ++v)
+            {
+                if (cellOf[v] != kInvalidVertex)
+                {
+                    ++cellStart[cellOf[v] + 1u];
+                }
+            }
+            std::partial_sum(cellStart.begin(), cellStart.end(), cellStart.begin());
+            std::vector<std::uint32_t> cellPoints(bounds.Count);
+            std::vector<std::uint32_t> localOf(n, kInvalidVertex);
+            {
+                std::vector<std::size_t> cursor(cellStart.begin(), cellStart.end() - 1);
+                for (std::size_t v = 0; v < n; ++v)
+                {
+                    if (cellOf[v] == kInvalidVertex)
+                    {
+                        continue;
+                    }
+                    const std::size_t slot = cursor[cellOf[v]]++;
+                    cellPoints[slot] = static_cast<std::uint32_t>(v);
+                    localOf[v] = static_cast<std::uint32_t>(slot - cellStart[cellOf[v]]);
                 }
+            }
 
-                SortAndFilterNeighbors(points, deleted, index, params, neighbors);
-                neighborhoods[index] = neighbors;
+            std::vector<OrientationEdge> edges = Parallel::ParallelReduce(
+                Parallel::IndexRange{0u, cellCount}, 1u, std::vector<OrientationEdge>{},
+                [&](const Parallel::IndexRange range, std::vector<OrientationEdge> acc)
+                {
+                    std::vector<OrientationEdge> internal;
+                    std::vector<std::uint64_t> order;
+                    std::vector<std::uint64_t> orderScratch;
+                    for (std::size_t cell = range.Begin; cell < range.End; ++cell)
+                    {
+                        const std::size_t begin = cellStart[cell];
+                        const std::size_t end = cellStart[cell + 1u];
+                        if (begin == end)
+                        {
+                            continue;
+                        }
 
-                if (neighbors.size() < params.MinimumNeighbors)
+                        internal.clear();
+                        for (std::size_t slot = begin; slot < end; ++slot)
+                        {
+                            const std::uint32_t v = cellPoints[slot];
+                            for (const std::uint32_t q : graph.Of(v))
+                            {
+                                if (validNormals[q] == 0u || EmittedByNeighbor(graph, v, q))
+                                {
+                                    continue;
+                                }
+                                const OrientationEdge edge{EdgeWeight(normals[v], normals[q]),
+                                                           std::min(v, q), std::max(v, q)};
+                                if (cellOf[q] == cell)
+                                {
+                                    internal.push_back(edge);
+                                }
+                                else
+                                {
+                                    acc.push_back(edge);
+                                }
+                            }
+                        }
+
+                        order.resize(internal.size());
+                        for (std::size_t i = 0; i < internal.size(); ++i)
+                        {
+                            order[i] = EdgeKey(internal[i].Weight, i);
+                        }
+                        SortEdgeKeys(order, orderScratch);
+                        DisjointSets local(end - begin);
+                        for (const std::uint64_t key : order)
+                        {
+                            const OrientationEdge& edge = internal[static_cast<std::size_t>(key & 0xFFFFFFFFu)];
+                            if (local.Union(localOf[edge.A], localOf[edge.B]))
+                            {
+                                acc.push_back(edge);
+                            }
+                        }
+                    }
+                    return acc;
+                },
+                [](std::vector<OrientationEdge> lhs, std::vector<OrientationEdge> rhs)
                 {
-                    ++result.Diagnostics.TooFewNeighborCount;
-                    ++result.Diagnostics.FallbackPointCount;
-                    ++result.Diagnostics.WrittenCount;
-                    continue;
+                    if (lhs.empty())
+                    {
+                        return rhs;
+                    }
+                    lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+                    return lhs;
+                });
+            cellOf = {};
+            localOf = {};
+            cellPoints = {};
+
+            DisjointSets sets(n);
+            std::vector<std::uint32_t> component(n, kInvalidVertex);
+            std::vector<std::uint32_t> roots;
+            roots.reserve(bounds.Count);
+            for (std::size_t v = 0; v < n; ++v)
+            {
+                if (validNormals[v] != 0u)
+                {
+                    component[v] = static_cast<std::uint32_t>(v);
+                    roots.push_back(static_cast<std::uint32_t>(v));
                 }
+            }
 
-                samples.clear();
-                samples.push_back(points[index]);
-                for (const std::size_t neighbor : neighbors)
+            std::vector<OrientationEdge> forest;
+            forest.reserve(bounds.Count - 1u);
+
+            if (edges.size() >= std::size_t{kInvalidVertex})
+            {
+                // Edge indices no longer fit the low half of the atomic key;
+                // fall back to a single global Kruskal pass.
+                std::sort(edges.begin(), edges.end(), EdgeLess);
+                for (const OrientationEdge& edge : edges)
+                {
+                    if (sets.Union(edge.A, edge.B))
+                    {
+                        forest.push_back(edge);
+                    }
+                }
+                std::size_t componentCount = 0;
+                for (const std::uint32_t root : roots)
                 {
-                    samples.push_back(points[neighbor]);
+                    componentCount += sets.IsRoot(root) ? 1u : 0u;
                 }
+                diagnostics.OrientationComponentCount = componentCount;
+                return forest;
+            }
 
-                if (samples.size() < 3u)
+            std::vector<std::atomic<std::uint64_t>> lightest(n);
+            while (roots.size() > 1u)
+            {
+                Parallel::ParallelFor(Parallel::IndexRange{0u, roots.size()}, kEdgeGrain, [&](const std::size_t r)
                 {
-                    ++result.Diagnostics.DegenerateNeighborhoodCount;
-                    ++result.Diagnostics.FallbackPointCount;
-                    ++result.Diagnostics.WrittenCount;
-                    continue;
+                    lightest[roots[r]].store(kNoEdge, std::memory_order_relaxed);
+                });
+                Parallel::ParallelFor(Parallel::IndexRange{0u, edges.size()}, kEdgeGrain, [&](const std::size_t e)
+                {
+                    const std::uint32_t a = component[edges[e].A];
+                    const std::uint32_t b = component[edges[e].B];
+                    if (a == b)
+                    {
+                        return;
+                    }
+                    const std::uint64_t key = EdgeKey(edges[e].Weight, e);
+                    AtomicMin(lightest[a], key);
+                    AtomicMin(lightest[b], key);
+                });
+                ++diagnostics.OrientationMergeRoundCount;
+
+                bool merged = false;
+                for (const std::uint32_t root : roots)
+                {
+                    const std::uint64_t key = lightest[root].load(std::memory_order_relaxed);
+                    if (key == kNoEdge)
+                    {
+                        continue;
+                    }
+                    const OrientationEdge& edge = edges[static_cast<std::size_t>(key & 0xFFFFFFFFu)];
+                    if (sets.Union(edge.A, edge.B))
+                    {
+                        forest.push_back(edge);
+                        merged = true;
+                    }
+                }
+                if (!merged)
+                {
+                    break;
                 }
 
-                CountDuplicateSamples(samples, params, result.Diagnostics);
+                Parallel::ParallelFor(vertexRange, kEdgeGrain, [&](const std::size_t v)
+                {
+                    if (component[v] != kInvalidVertex)
+                    {
+                        component[v] = sets.FindRoot(static_cast<std::uint32_t>(v));
+                    }
+                });
+                std::erase_if(roots, [&](const std::uint32_t root) { return !sets.IsRoot(root); });
+                std::erase_if(edges, [&](const OrientationEdge& edge)
+                {
+                    return component[edge.A] == component[edge.B];
+                });
+            }
 
-                const PCAResult pca = ToPCA(samples);
-                if (!pca.Valid || IsCollinearNeighborhood(pca, params))
+            diagnostics.OrientationComponentCount = roots.size();
+            return forest;
+        }
+
+        // Orients every connected component of the neighbour graph from its
+        // highest point (lowest index on ties), which is first aligned with
+        // the fallback normal, and flips each tree child that disagrees with
+        // its parent. The forest build is parallel; this final walk is a
+        // linear serial pass.
+        void OrientNormalsMST(std::span<const glm::vec3> points,
+                              const glm::vec3 fallbackNormal,
+                              const NeighborGraph& graph,
+                              std::span<const std::uint8_t> validNormals,
+                              std::vector<glm::vec3>& normals,
+                              Diagnostics& diagnostics)
+        {
+            const std::size_t n = points.size();
+            const std::vector<OrientationEdge> forest =
+                MinimumSpanningForest(points, normals, validNormals, graph, diagnostics);
+
+            std::vector<std::size_t> treeOffsets(n + 1u, 0u);
+            for (const OrientationEdge& edge : forest)
+            {
+                ++treeOffsets[edge.A + 1u];
+                ++treeOffsets[edge.B + 1u];
+            }
+            std::partial_sum(treeOffsets.begin(), treeOffsets.end(), treeOffsets.begin());
+            std::vector<std::uint32_t> treeNeighbors(treeOffsets[n]);
+            {
+                std::vector<std::size_t> cursor(treeOffsets.begin(), treeOffsets.end() - 1);
+                for (const OrientationEdge& edge : forest)
                 {
-                    ++result.Diagnostics.CollinearNeighborhoodCount;
-                    ++result.Diagnostics.FallbackPointCount;
-                    ++result.Diagnostics.WrittenCount;
-                    continue;
+                    treeNeighbors[cursor[edge.A]++] = edge.B;
+                    treeNeighbors[cursor[edge.B]++] = edge.A;
                 }
+            }
 
-                glm::vec3 normal = pca.Eigenvectors[2];
-                if (!NormalizeNormal(normal, params))
+            // Each component is walked twice: once to find its seed, then
+            // from the seed along the tree.
+            constexpr std::uint8_t kCollected = 1u;
+            constexpr std::uint8_t kOriented = 2u;
+            std::vector<std::uint8_t> state(n, 0u);
+            std::vector<std::uint32_t> queue;
+            queue.reserve(n);
+            for (std::size_t start = 0; start < n; ++start)
+            {
+                if (validNormals[start] == 0u || state[start] != 0u)
                 {
-                    ++result.Diagnostics.DegenerateNeighborhoodCount;
-                    ++result.Diagnostics.FallbackPointCount;
-                    ++result.Diagnostics.WrittenCount;
                     continue;
                 }
 
-                result.Normals[index] = normal;
-                validNormals[index] = true;
-                ++result.Diagnostics.ValidNormalPointCount;
-                ++result.Diagnostics.WrittenCount;
+                queue.clear();
+                queue.push_back(static_cast<std::uint32_t>(start));
+                state[start] = kCollected;
+                std::uint32_t seed = static_cast<std::uint32_t>(start);
+                for (std::size_t head = 0; head < queue.size(); ++head)
+                {
+                    const std::uint32_t current = queue[head];
+                    if (points[current].z > points[seed].z
+                        || (points[current].z == points[seed].z && current < seed))
+                    {
+                        seed = current;
+                    }
+                    for (std::size_t t = treeOffsets[current]; t < treeOffsets[current + 1u]; ++t)
+                    {
+                        const std::uint32_t next = treeNeighbors[t];
+                        if (state[next] == 0u)
+                        {
+                            state[next] = kCollected;
+                            queue.push_back(next);
+                        }
+                    }
+                }
+
+                if (glm::dot(normals[seed], fallbackNormal) < 0.0f)
+                {
+                    normals[seed] = -normals[seed];
+                    ++diagnostics.FlippedOrientationCount;
+                }
+
+                queue.clear();
+                queue.push_back(seed);
+                state[seed] = kOriented;
+                for (std::size_t head = 0; head < queue.size(); ++head)
+                {
+                    const std::uint32_t current = queue[head];
+                    for (std::size_t t = treeOffsets[current]; t < treeOffsets[current + 1u]; ++t)
+                    {
+                        const std::uint32_t next = treeNeighbors[t];
+                        if (state[next] == kOriented)
+                        {
+                            continue;
+                        }
+                        state[next] = kOriented;
+                        if (glm::dot(normals[next], normals[current]) < 0.0f)
+                        {
+                            normals[next] = -normals[next];
+                            ++diagnostics.FlippedOrientationCount;
+                        }
+                        queue.push_back(next);
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] EstimateResult Compute(std::span<const glm::vec3> points,
+                                             const ConstProperty<bool>& deleted,
+                                             QueryContext& context,
+                                             const Params& params)
+        {
+            EstimateResult result{};
+            result.Backend = context.Backend;
+            result.Diagnostics.PointSlotCount = points.size();
+
+            glm::vec3 fallbackNormal{0.0f};
+            NormalizeFallback(params, result.Diagnostics, fallbackNormal);
+            result.Normals.assign(points.size(), fallbackNormal);
+
+            if (points.empty())
+            {
+                result.Status = RecomputeStatus::EmptyInput;
+                return result;
+            }
+
+            if (context.Backend == NeighborhoodBackend::KDTree)
+            {
+                if (!PrepareInternalKDTree(points, deleted, params, result, context))
+                {
+                    return result;
+                }
             }
+            else if (!PrepareSuppliedIndex(points, deleted, params, result))
+            {
+                return result;
+            }
+
+            std::vector<std::uint8_t> validNormals(points.size(), 0u);
+            NeighborGraph graph{};
+            graph.Offsets.assign(points.size() + 1u, 0u);
+
+            const EstimateJob job{
+                .Points = points,
+                .Deleted = deleted,
+                .Context = context,
+                .Settings = params,
+                .Normals = result.Normals,
+                .ValidNormals = validNormals,
+                .NeighborCounts = graph.Offsets,
+            };
+            EstimatePartial estimate = Parallel::ParallelReduce(
+                Parallel::IndexRange{0u, points.size()}, kEstimateGrain, EstimatePartial{},
+                [&](const Parallel::IndexRange range, EstimatePartial acc)
+                {
+                    EstimateChunk(job, range, acc);
+                    return acc;
+                },
+                [](EstimatePartial lhs, EstimatePartial rhs)
+                {
+                    AccumulateEstimateCounts(lhs.Counts, rhs.Counts);
+                    lhs.Neighbors.insert(lhs.Neighbors.end(), rhs.Neighbors.begin(), rhs.Neighbors.end());
+                    return lhs;
+                });
+            AccumulateEstimateCounts(result.Diagnostics, estimate.Counts);
+            graph.Indices = std::move(estimate.Neighbors);
+            Parallel::ParallelScan<std::size_t>(graph.Offsets, graph.Offsets, 0u,
+                                                [](const std::size_t a, const std::size_t b) { return a + b; },
+                                                Parallel::ScanKind::Exclusive);
 
             if (params.Orientation == OrientationMode::MinimumSpanningTree)
             {
                 OrientNormalsMST(points,
                                  fallbackNormal,
-                                 neighborhoods,
+                                 graph,
                                  validNormals,
                                  result.Normals,
                                  result.Diagnostics);
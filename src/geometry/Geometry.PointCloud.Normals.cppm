@@ -83,6 +83,9 @@ export namespace Geometry::PointCloud::Normals
         std::size_t FlippedOrientationCount{0};
         std::size_t KNNVisitedNodeCount{0};
         std::size_t KNNDistanceEvaluationCount{0};
+        std::size_t OrientationCellCount{0};
+        std::size_t OrientationComponentCount{0};
+        std::size_t OrientationMergeRoundCount{0};
         bool FallbackNormalWasRepaired{false};
     };
 
@@ -114,6 +117,18 @@ export namespace Geometry::PointCloud::Normals
     [[nodiscard]] std::string_view DebugName(OrientationMode mode) noexcept;
     [[nodiscard]] std::string_view DebugName(RecomputeStatus status) noexcept;
 
+    // Estimation runs in fixed chunks of points on Core::Parallel (serially
+    // without a scheduler): one neighbourhood query and one closed-form PCA
+    // per point. The internal backend queries a PointKDTree built over the
+    // finite, non-deleted points; supplied KDTree and Octree indices are only
+    // read, so concurrent queries are safe.
+    //
+    // MinimumSpanningTree orientation builds a minimum spanning forest of the
+    // symmetrized neighbour graph (weight 1 - |n_i . n_j|) from per-cell
+    // Kruskal fragments stitched by parallel Boruvka rounds, then flips
+    // normals along the tree from the highest point of each component, which
+    // is first aligned with FallbackNormal. Normals and diagnostics do not
+    // depend on the thread count.
     [[nodiscard]] std::optional<EstimateResult> Estimate(std::span<const glm::vec3> points,
                                                          const Params& params = {});
 
@@ -0,0 +1,493 @@
+module;
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+
+module Geometry.PointKDTree;
+
+import Extrinsic.Core.Parallel;
+
+namespace Geometry
+{
+    namespace
+    {
+        namespace Parallel = Extrinsic::Core::Parallel;
+
+        // Queries per task; large enough to amortize dispatch, small enough
+        // to balance the uneven per-query cost of clustered clouds.
+        constexpr std::size_t kQueryGrain = 512u;
+        constexpr std::size_t kMaxPointCount = (std::size_t{1} << 30u) - 1u;
+
+        struct BuildFrame
+        {
+            std::uint32_t Start{0};
+            std::uint32_t Count{0};
+            std::uint32_t Depth{0};
+            // Inner node whose Offset receives this node's index, or
+            // kInvalidIndex for the root and for left children.
+            std::uint32_t RightOf{PointKDTree::kInvalidIndex};
+        };
+
+        struct LeafView
+        {
+            const float* X{nullptr};
+            const float* Y{nullptr};
+            const float* Z{nullptr};
+            const PointKDTree::ElementIndex* Ids{nullptr};
+        };
+
+        [[nodiscard]] AABB BoundsOf(std::span<const glm::vec3> points,
+            std::span<const PointKDTree::ElementIndex> order)
+        {
+            AABB bounds{};
+            for (const PointKDTree::ElementIndex index : order)
+            {
+                bounds.Min = glm::min(bounds.Min, points[index]);
+                bounds.Max = glm::max(bounds.Max, points[index]);
+            }
+            return bounds;
+        }
+
+        // Sorted (distance, index) buffer of capacity k. Worst() is the k-th
+        // distance once full, so it doubles as the pruning radius.
+        class KnnBuffer
+        {
+        public:
+            KnnBuffer(float* distances, PointKDTree::ElementIndex* indices, const std::uint32_t capacity)
+                : m_Distances(distances), m_Indices(indices), m_Capacity(capacity)
+            {
+            }
+
+            [[nodiscard]] float Worst() const noexcept
+            {
+                return m_Size < m_Capacity ? std::numeric_limits<float>::infinity() : m_Distances[m_Capacity - 1u];
+            }
+
+            void Insert(const float distance, const PointKDTree::ElementIndex index) noexcept
+            {
+                std::uint32_t slot = m_Size;
+                if (m_Size == m_Capacity)
+                {
+                    const float worst = m_Distances[m_Capacity - 1u];
+                    if (distance > worst || (distance == worst && index >= m_Indices[m_Capacity - 1u]))
+                    {
+                        return;
+                    }
+                    slot = m_Capacity - 1u;
+                }
+                else
+                {
+                    ++m_Size;
+                }
+
+                while (slot > 0u && (m_Distances[slot - 1u] > distance ||
+                                     (m_Distances[slot - 1u] == distance && m_Indices[slot - 1u] > index)))
+                {
+                    m_Distances[slot] = m_Distances[slot - 1u];
+                    m_Indices[slot] = m_Indices[slot - 1u];
+                    --slot;
+                }
+                m_Distances[slot] = distance;
+                m_Indices[slot] = index;
+            }
+
+            [[nodiscard]] std::uint32_t Size() const noexcept { return m_Size; }
+
+        private:
+            float* m_Distances;
+            PointKDTree::ElementIndex* m_Indices;
+            std::uint32_t m_Capacity;
+            std::uint32_t m_Size{0};
+        };
+
+        struct SearchStats
+        {
+            std::size_t VisitedNodes{0};
+            std::size_t DistanceEvaluations{0};
+        };
+
+        struct KnnSearch
+        {
+            const PointKDTree::Node* Nodes{nullptr};
+            LeafView Leaves{};
+            glm::vec3 Query{0.0f};
+            KnnBuffer* Best{nullptr};
+            SearchStats Stats{};
+
+            // rd is the squared distance from Query to the node's cell,
+            // assembled from the per-axis offsets in `offsets`.
+            void Visit(const PointKDTree::NodeIndex nodeIndex, const float rd, glm::vec3& offsets)
+            {
+                ++Stats.VisitedNodes;
+                const PointKDTree::Node& node = Nodes[nodeIndex];
+                if (node.IsLeaf())
+                {
+                    const std::uint32_t end = node.Offset + node.Count();
+                    Stats.DistanceEvaluations += node.Count();
+                    for (std::uint32_t i = node.Offset; i < end; ++i)
+                    {
+                        const float dx = Query.x - Leaves.X[i];
+                        const float dy = Query.y - Leaves.Y[i];
+                        const float dz = Query.z - Leaves.Z[i];
+                        const float dist2 = dx * dx + dy * dy + dz * dz;
+                        if (dist2 <= Best->Worst())
+                        {
+                            Best->Insert(dist2, Leaves.Ids[i]);
+                        }
+                    }
+                    return;
+                }
+
+                const std::uint32_t axis = node.Axis();
+                const float diff = Query[static_cast<int>(axis)] - node.SplitValue;
+                const PointKDTree::NodeIndex nearChild = diff <= 0.0f ? nodeIndex + 1u : node.Offset;
+                const PointKDTree::NodeIndex farChild = diff <= 0.0f ? node.Offset : nodeIndex + 1u;
+
+                Visit(nearChild, rd, offsets);
+
+                float& offset = offsets[static_cast<int>(axis)];
+                const float previous = offset;
+                const float farRd = rd - previous * previous + diff * diff;
+                if (farRd <= Best->Worst())
+                {
+                    offset = diff;
+                    Visit(farChild, farRd, offsets);
+                    offset = previous;
+                }
+            }
+        };
+
+        struct RadiusSearch
+        {
+            const PointKDTree::Node* Nodes{nullptr};
+            LeafView Leaves{};
+            glm::vec3 Query{0.0f};
+            float Radius2{0.0f};
+            std::vector<PointKDTree::ElementIndex>* Out{nullptr};
+            SearchStats Stats{};
+
+            void Visit(const PointKDTree::NodeIndex nodeIndex, const float rd, glm::vec3& offsets)
+            {
+                ++Stats.VisitedNodes;
+                const PointKDTree::Node& node = Nodes[nodeIndex];
+                if (node.IsLeaf())
+                {
+                    const std::uint32_t end = node.Offset + node.Count();
+                    Stats.DistanceEvaluations += node.Count();
+                    for (std::uint32_t i = node.Offset; i < end; ++i)
+                    {
+                        const float dx = Query.x - Leaves.X[i];
+                        const float dy = Query.y - Leaves.Y[i];
+                        const float dz = Query.z - Leaves.Z[i];
+                        if (dx * dx + dy * dy + dz * dz <= Radius2)
+                        {
+                            Out->push_back(Leaves.Ids[i]);
+                        }
+                    }
+                    return;
+                }
+
+                const std::uint32_t axis = node.Axis();
+                const float diff = Query[static_cast<int>(axis)] - node.SplitValue;
+                const PointKDTree::NodeIndex nearChild = diff <= 0.0f ? nodeIndex + 1u : node.Offset;
+                const PointKDTree::NodeIndex farChild = diff <= 0.0f ? node.Offset : nodeIndex + 1u;
+
+                Visit(nearChild, rd, offsets);
+
+                float& offset = offsets[static_cast<int>(axis)];
+                const float previous = offset;
+                const float farRd = rd - previous * previous + diff * diff;
+                if (farRd <= Radius2)
+                {
+                    offset = diff;
+                    Visit(farChild, farRd, offsets);
+                    offset = previous;
+                }
+            }
+        };
+
+        // Per-axis distance from the query to the root bounds.
+        [[nodiscard]] float RootOffsets(const AABB& bounds, const glm::vec3& query, glm::vec3& offsets)
+        {
+            offsets = glm::max(glm::max(bounds.Min - query, query - bounds.Max), glm::vec3(0.0f));
+            return glm::dot(offsets, offsets);
+        }
+
+        [[nodiscard]] KDTreeKNNResult CombineKnn(KDTreeKNNResult lhs, const KDTreeKNNResult& rhs)
+        {
+            lhs.ReturnedCount += rhs.ReturnedCount;
+            lhs.VisitedNodes += rhs.VisitedNodes;
+            lhs.DistanceEvaluations += rhs.DistanceEvaluations;
+            lhs.MaxDistanceSquared = std::max(lhs.MaxDistanceSquared, rhs.MaxDistanceSquared);
+            return lhs;
+        }
+    }
+
+    std::optional<KDTreeBuildResult> PointKDTree::Build(std::span<const glm::vec3> points,
+        const PointKDTreeBuildParams& params)
+    {
+        m_Nodes.clear();
+        m_ElementIndices.clear();
+        m_X.clear();
+        m_Y.clear();
+        m_Z.clear();
+        m_Bounds = AABB{};
+
+        if (points.empty() || points.size() > kMaxPointCount || params.LeafSize == 0 || params.MaxDepth == 0)
+        {
+            return std::nullopt;
+        }
+        for (const glm::vec3& p : points)
+        {
+            if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z))
+            {
+                return std::nullopt;
+            }
+        }
+
+        m_ElementIndices.resize(points.size());
+        std::iota(m_ElementIndices.begin(), m_ElementIndices.end(), ElementIndex{0});
+        m_Nodes.reserve(2u * (points.size() / params.LeafSize) + 1u);
+
+        std::vector<BuildFrame> stack;
+        stack.push_back(BuildFrame{0u, static_cast<std::uint32_t>(points.size()), 0u, kInvalidIndex});
+        std::uint32_t maxDepthReached = 0;
+
+        while (!stack.empty())
+        {
+            const BuildFrame frame = stack.back();
+            stack.pop_back();
+
+            // Depth-first emission: a left child is popped right after its
+            // parent, so it always lands at parent + 1.
+            const NodeIndex nodeIndex = static_cast<NodeIndex>(m_Nodes.size());
+            m_Nodes.push_back(Node{});
+            if (frame.RightOf != kInvalidIndex)
+            {
+                m_Nodes[frame.RightOf].Offset = nodeIndex;
+            }
+            maxDepthReached = std::max(maxDepthReached, frame.Depth);
+
+            const std::span<ElementIndex> order{m_ElementIndices.data() + frame.Start, frame.Count};
+            const AABB bounds = BoundsOf(points, order);
+            if (frame.Depth == 0u)
+            {
+                m_Bounds = bounds;
+            }
+
+            const glm::vec3 extent = bounds.Max - bounds.Min;
+            int axis = 0;
+            if (extent.y > extent[axis]) axis = 1;
+            if (extent.z > extent[axis]) axis = 2;
+
+            if (frame.Count <= params.LeafSize || frame.Depth >= params.MaxDepth || !(extent[axis] > 0.0f))
+            {
+                m_Nodes[nodeIndex].Offset = frame.Start;
+                m_Nodes[nodeIndex].Meta = (frame.Count << 2u) | kLeafAxis;
+                continue;
+            }
+
+            const std::uint32_t leftCount = frame.Count / 2u;
+            std::nth_element(order.begin(), order.begin() + leftCount, order.end(),
+                [&points, axis](const ElementIndex lhs, const ElementIndex rhs)
+                {
+                    const float l = points[lhs][axis];
+                    const float r = points[rhs][axis];
+                    if (l != r)
+                    {
+                        return l < r;
+                    }
+                    return lhs < rhs;
+                });
+
+            m_Nodes[nodeIndex].SplitValue = points[order[leftCount]][axis];
+            m_Nodes[nodeIndex].Meta = static_cast<std::uint32_t>(axis);
+
+            stack.push_back(BuildFrame{frame.Start + leftCount, frame.Count - leftCount, frame.Depth + 1u, nodeIndex});
+            stack.push_back(BuildFrame{frame.Start, leftCount, frame.Depth + 1u, kInvalidIndex});
+        }
+
+        m_X.resize(points.size());
+        m_Y.resize(points.size());
+        m_Z.resize(points.size());
+        Parallel::ParallelFor(Parallel::IndexRange{0u, points.size()}, Parallel::AutoGrain, [&](const std::size_t i)
+        {
+            const glm::vec3& p = points[m_ElementIndices[i]];
+            m_X[i] = p.x;
+            m_Y[i] = p.y;
+            m_Z[i] = p.z;
+        });
+
+        return KDTreeBuildResult{
+            .ElementCount = points.size(),
+            .NodeCount = m_Nodes.size(),
+            .MaxDepthReached = maxDepthReached,
+        };
+    }
+
+    std::optional<KDTreeKNNResult> PointKDTree::QueryKNN(const glm::vec3& query, const std::uint32_t k,
+        std::vector<ElementIndex>& outElementIndices) const
+    {
+        outElementIndices.clear();
+        std::vector<float> distances;
+        const auto result = QueryKNNBatch(std::span<const glm::vec3>{&query, 1u}, k, outElementIndices, distances);
+        if (!result)
+        {
+            return std::nullopt;
+        }
+        outElementIndices.resize(result->ReturnedCount);
+        return result;
+    }
+
+    std::optional<KDTreeKNNResult> PointKDTree::QueryKNNBatch(std::span<const glm::vec3> queries,
+        const std::uint32_t k, std::vector<ElementIndex>& outElementIndices) const
+    {
+        std::vector<float> distances;
+        return QueryKNNBatch(queries, k, outElementIndices, distances);
+    }
+
+    std::optional<KDTreeKNNResult> PointKDTree::QueryKNNBatch(std::span<const glm::vec3> queries,
+        const std::uint32_t k, std::vector<ElementIndex>& outElementIndices,
+        std::vector<float>& outDistancesSquared) const
+    {
+        outElementIndices.clear();
+        outDistancesSquared.clear();
+        if (m_Nodes.empty() || k == 0)
+        {
+            return std::nullopt;
+        }
+
+        outElementIndices.assign(queries.size() * k, kInvalidIndex);
+        outDistancesSquared.assign(queries.size() * k, std::numeric_limits<float>::infinity());
+        const LeafView leaves{m_X.data(), m_Y.data(), m_Z.data(), m_ElementIndices.data()};
+
+        return Parallel::ParallelReduce(
+            Parallel::IndexRange{0u, queries.size()}, kQueryGrain, KDTreeKNNResult{},
+            [&](const Parallel::IndexRange chunk, KDTreeKNNResult acc)
+            {
+                for (std::size_t q = chunk.Begin; q < chunk.End; ++q)
+                {
+                    KnnBuffer best(outDistancesSquared.data() + q * k, outElementIndices.data() + q * k, k);
+                    KnnSearch search{.Nodes = m_Nodes.data(), .Leaves = leaves, .Query = queries[q], .Best = &best};
+                    glm::vec3 offsets{0.0f};
+                    const float rd = RootOffsets(m_Bounds, queries[q], offsets);
+                    search.Visit(0u, rd, offsets);
+
+                    acc.ReturnedCount += best.Size();
+                    acc.VisitedNodes += search.Stats.VisitedNodes;
+                    acc.DistanceEvaluations += search.Stats.DistanceEvaluations;
+                    if (best.Size() > 0u)
+                    {
+                        acc.MaxDistanceSquared =
+                            std::max(acc.MaxDistanceSquared, outDistancesSquared[q * k + best.Size() - 1u]);
+                    }
+                }
+                return acc;
+            },
+            CombineKnn);
+    }
+
+    std::optional<KDTreeRadiusResult> PointKDTree::QueryRadius(const glm::vec3& query, const float radius,
+        std::vector<ElementIndex>& outElementIndices) const
+    {
+        outElementIndices.clear();
+        if (m_Nodes.empty() || !std::isfinite(radius) || radius < 0.0f)
+        {
+            return std::nullopt;
+        }
+
+        RadiusSearch search{
+            .Nodes = m_Nodes.data(),
+            .Leaves = LeafView{m_X.data(), m_Y.data(), m_Z.data(), m_ElementIndices.data()},
+            .Query = query,
+            .Radius2 = radius * radius,
+            .Out = &outElementIndices,
+        };
+        glm::vec3 offsets{0.0f};
+        const float rd = RootOffsets(m_Bounds, query, offsets);
+        if (rd <= search.Radius2)
+        {
+            search.Visit(0u, rd, offsets);
+        }
+        std::sort(outElementIndices.begin(), outElementIndices.end());
+
+        return KDTreeRadiusResult{
+            .ReturnedCount = outElementIndices.size(),
+            .VisitedNodes = search.Stats.VisitedNodes,
+            .DistanceEvaluations = search.Stats.DistanceEvaluations,
+        };
+    }
+
+    std::optional<KDTreeRadiusResult> PointKDTree::QueryRadiusBatch(std::span<const glm::vec3> queries,
+        const float radius, std::vector<std::size_t>& outOffsets,
+        std::vector<ElementIndex>& outElementIndices) const
+    {
+        outOffsets.clear();
+        outElementIndices.clear();
+        if (m_Nodes.empty() || !std::isfinite(radius) || radius < 0.0f)
+        {
+            return std::nullopt;
+        }
+
+        // Each chunk gathers its rows locally; rows are then stitched in
+        // query order so the output does not depend on scheduling.
+        const std::size_t chunkCount = (queries.size() + kQueryGrain - 1u) / kQueryGrain;
+        std::vector<std::vector<ElementIndex>> chunkHits(chunkCount);
+        std::vector<SearchStats> chunkStats(chunkCount);
+        outOffsets.assign(queries.size() + 1u, 0u);
+        const LeafView leaves{m_X.data(), m_Y.data(), m_Z.data(), m_ElementIndices.data()};
+        const float radius2 = radius * radius;
+
+        Parallel::ParallelFor(Parallel::IndexRange{0u, chunkCount}, 1u, [&](const std::size_t chunk)
+        {
+            const std::size_t begin = chunk * kQueryGrain;
+            const std::size_t end = std::min(queries.size(), begin + kQueryGrain);
+            std::vector<ElementIndex>& hits = chunkHits[chunk];
+            for (std::size_t q = begin; q < end; ++q)
+            {
+                const std::size_t rowBegin = hits.size();
+                RadiusSearch search{
+                    .Nodes = m_Nodes.data(),
+                    .Leaves = leaves,
+                    .Query = queries[q],
+                    .Radius2 = radius2,
+                    .Out = &hits,
+                };
+                glm::vec3 offsets{0.0f};
+                const float rd = RootOffsets(m_Bounds, queries[q], offsets);
+                if (rd <= radius2)
+                {
+                    search.Visit(0u, rd, offsets);
+                }
+                std::sort(hits.begin() + static_cast<std::ptrdiff_t>(rowBegin), hits.end());
+                outOffsets[q + 1u] = hits.size() - rowBegin;
+                chunkStats[chunk].VisitedNodes += search.Stats.VisitedNodes;
+                chunkStats[chunk].DistanceEvaluations += search.Stats.DistanceEvaluations;
+            }
+        });
+
+        std::partial_sum(outOffsets.begin(), outOffsets.end(), outOffsets.begin());
+        outElementIndices.resize(outOffsets.back());
+        Parallel::ParallelFor(Parallel::IndexRange{0u, chunkCount}, 1u, [&](const std::size_t chunk)
+        {
+            std::copy(chunkHits[chunk].begin(), chunkHits[chunk].end(),
+                outElementIndices.begin() + static_cast<std::ptrdiff_t>(outOffsets[chunk * kQueryGrain]));
+        });
+
+        KDTreeRadiusResult result{.ReturnedCount = outElementIndices.size()};
+        for (const SearchStats& stats : chunkStats)
+        {
+            result.VisitedNodes += stats.VisitedNodes;
+            result.DistanceEvaluations += stats.DistanceEvaluations;
+        }
+        return result;
+    }
+}
@@ -0,0 +1,102 @@
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+
+export module Geometry.PointKDTree;
+
+import Geometry.AABB;
+import Geometry.KDTree;
+
+export namespace Geometry
+{
+    struct PointKDTreeBuildParams
+    {
+        std::uint32_t LeafSize{8};
+        std::uint32_t MaxDepth{48};
+    };
+
+    // Point-only KD-tree for neighbourhood-heavy point-cloud kernels.
+    //
+    // Unlike KDTree, which keeps one AABB per element and per node, this tree
+    // stores 12-byte nodes in depth-first order (a node's left child is the
+    // next node) and copies the positions into leaf order as separate x/y/z
+    // arrays, so a leaf scan reads contiguous floats. Traversal bounds are
+    // the per-axis split-plane offsets accumulated on the way down
+    // (Arya-Mount incremental distance), seeded from the root bounds.
+    //
+    // KNN results are ordered by (squared distance, element index), the same
+    // order KDTree::QueryKNN returns for point AABBs. Candidates live in a
+    // fixed-size sorted insertion buffer instead of a heap, which is faster
+    // for the k <= 64 neighbourhoods the point-cloud kernels use.
+    //
+    // The batch queries split the query span into chunks on
+    // Core::Parallel and fall back to a serial loop without a scheduler;
+    // their results do not depend on the thread count.
+    class PointKDTree
+    {
+    public:
+        using NodeIndex = std::uint32_t;
+        using ElementIndex = std::uint32_t;
+        static constexpr ElementIndex kInvalidIndex = std::numeric_limits<ElementIndex>::max();
+        static constexpr std::uint32_t kLeafAxis = 3u;
+
+        struct Node
+        {
+            float SplitValue{0.0f};  // Inner nodes: split coordinate on Axis().
+            std::uint32_t Offset{0}; // Inner nodes: right child. Leaves: first point in leaf order.
+            std::uint32_t Meta{0};   // Low two bits: axis, or kLeafAxis. High bits: leaf point count.
+
+            [[nodiscard]] bool IsLeaf() const noexcept { return (Meta & 3u) == kLeafAxis; }
+            [[nodiscard]] std::uint32_t Axis() const noexcept { return Meta & 3u; }
+            [[nodiscard]] std::uint32_t Count() const noexcept { return Meta >> 2u; }
+        };
+
+        [[nodiscard]] std::optional<KDTreeBuildResult> Build(std::span<const glm::vec3> points,
+            const PointKDTreeBuildParams& params = {});
+
+        [[nodiscard]] std::optional<KDTreeKNNResult> QueryKNN(const glm::vec3& query, std::uint32_t k,
+            std::vector<ElementIndex>& outElementIndices) const;
+
+        // Row-major results: row q holds the neighbours of queries[q] in
+        // slots [q * k, q * k + k). Rows are padded with kInvalidIndex (and
+        // infinite distances) when the tree holds fewer than k points. The
+        // returned diagnostics are summed over all queries;
+        // MaxDistanceSquared is the largest k-th neighbour distance.
+        [[nodiscard]] std::optional<KDTreeKNNResult> QueryKNNBatch(std::span<const glm::vec3> queries,
+            std::uint32_t k, std::vector<ElementIndex>& outElementIndices) const;
+        [[nodiscard]] std::optional<KDTreeKNNResult> QueryKNNBatch(std::span<const glm::vec3> queries,
+            std::uint32_t k, std::vector<ElementIndex>& outElementIndices,
+            std::vector<float>& outDistancesSquared) const;
+
+        [[nodiscard]] std::optional<KDTreeRadiusResult> QueryRadius(const glm::vec3& query, float radius,
+            std::vector<ElementIndex>& outElementIndices) const;
+
+        // CSR results: the sorted element indices within `radius` of
+        // queries[q] are outElementIndices[outOffsets[q], outOffsets[q + 1]).
+        // Offsets are std::size_t because the total hit count may exceed
+        // 2^32 even though each row is bounded by Size().
+        [[nodiscard]] std::optional<KDTreeRadiusResult> QueryRadiusBatch(std::span<const glm::vec3> queries,
+            float radius, std::vector<std::size_t>& outOffsets,
+            std::vector<ElementIndex>& outElementIndices) const;
+
+        [[nodiscard]] std::size_t Size() const noexcept { return m_ElementIndices.size(); }
+        [[nodiscard]] const AABB& Bounds() const noexcept { return m_Bounds; }
+        [[nodiscard]] const std::vector<Node>& Nodes() const noexcept { return m_Nodes; }
+        // Original element index of each point, in leaf order.
+        [[nodiscard]] const std::vector<ElementIndex>& ElementIndices() const noexcept { return m_ElementIndices; }
+
+    private:
+        AABB m_Bounds{};
+        std::vector<Node> m_Nodes{};
+        std::vector<ElementIndex> m_ElementIndices{};
+        std::vector<float> m_X{};
+        std::vector<float> m_Y{};
+        std::vector<float> m_Z{};
+    };
+}
@@ -4,6 +4,7 @@ module;
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <span>
@@ -18,12 +19,15 @@ module;
 #define EIGEN_DONT_PARALLELIZE
 #endif
 
+#include <Eigen/Dense>
 #include <Eigen/IterativeLinearSolvers>
 #include <Eigen/SparseCholesky>
 #include <Eigen/SparseCore>
 
 module Geometry.Sparse;
 
+import Extrinsic.Core.Parallel;
+
 namespace Geometry::Sparse
 {
     namespace
@@ -36,9 +40,29 @@ namespace Geometry::Sparse
         using EigenBiCGSTABDiagonal = Eigen::BiCGSTAB<EigenIterativeSparseMatrix, Eigen::DiagonalPreconditioner<double>>;
         using EigenBiCGSTABILUT = Eigen::BiCGSTAB<EigenIterativeSparseMatrix, Eigen::IncompleteLUT<double, int>>;
 
+        namespace Parallel = Extrinsic::Core::Parallel;
+
         constexpr double kSymmetryTolerance = 1.0e-10;
         constexpr double kPivotTolerance = 1.0e-12;
 
+        // Rows per SpMV chunk: large enough that a chunk outweighs its
+        // dispatch, small enough to balance meshes of a few thousand rows.
+        constexpr std::size_t kSpMVGrain = 2048;
+
+        // Non-zeros per compact SpMV chunk (about 200 KiB of double values
+        // and indices): rows are split at these boundaries so that chunks
+        // carry equal work even when row lengths vary.
+        constexpr std::size_t kCompactSpMVChunkNonZeros = 16384;
+
+        // Pseudo-peripheral root search stops after this many BFS sweeps;
+        // on meshes it settles within two or three.
+        constexpr std::size_t kMaxPeripheralSweeps = 8;
+
+        // AMG levels up to this size are solved with a dense LDLT; a larger
+        // coarsest level (coarsening stalled) gets Jacobi sweeps instead.
+        constexpr std::size_t kAMGMaxDenseCoarseRows = 1024;
+        constexpr std::size_t kAMGCoarseJacobiSweeps = 16;
+
         [[nodiscard]] double Norm(std::span<const double> values)
         {
             double sum = 0.0;
@@ -150,6 +174,10 @@ namespace Geometry::Sparse
             case SparsePreconditioner::Diagonal:
             case SparsePreconditioner::IncompleteLUT:
                 return true;
+            case SparsePreconditioner::AMG:
+                // The V-cycle is a symmetric preconditioner; BiCGSTAB targets
+                // non-symmetric systems and keeps to Eigen's preconditioners.
+                return false;
             }
             return false;
         }
@@ -652,10 +680,320 @@ namespace Geometry::Sparse
                 EigenBiCGSTABILUT solver;
                 return SolveBiCGSTABWithSolver(solver, eigenMatrix, rhs, x, params);
             }
+            case SparsePreconditioner::AMG:
+                break;
             }
 
             return MakeIterativeDiagnostics(SparseIterativeStatus::InvalidInput, params.Preconditioner);
         }
+
+        // -----------------------------------------------------------------
+        // Smoothed-aggregation AMG setup
+        // -----------------------------------------------------------------
+
+        constexpr std::size_t kUnaggregated = std::numeric_limits<std::size_t>::max();
+        constexpr std::size_t kIsolated = kUnaggregated - 1u;
+
+        // CSR arrays of the transpose of a rows x cols matrix. With 32-bit
+        // indices the row count must fit the column index type.
+        template <typename Index, typename Value>
+        void TransposeCsrArrays(
+            const std::size_t rows,
+            const std::size_t cols,
+            std::span<const std::size_t> rowOffsets,
+            std::span<const Index> colIndices,
+            std::span<const Value> values,
+            std::vector<std::size_t>& outRowOffsets,
+            std::vector<Index>& outColIndices,
+            std::vector<Value>& outValues)
+        {
+            outRowOffsets.assign(cols + 1, 0u);
+            for (const Index col : colIndices)
+            {
+                ++outRowOffsets[col + 1];
+            }
+            for (std::size_t col = 0; col < cols; ++col)
+            {
+                outRowOffsets[col + 1] += outRowOffsets[col];
+            }
+
+            outColIndices.resize(values.size());
+            outValues.resize(values.size());
+            std::vector<std::size_t> cursor(outRowOffsets.begin(), outRowOffsets.end() - 1);
+            for (std::size_t row = 0; row < rows; ++row)
+            {
+                for (std::size_t k = rowOffsets[row]; k < rowOffsets[row + 1]; ++k)
+                {
+                    const std::size_t slot = cursor[colIndices[k]]++;
+                    outColIndices[slot] = static_cast<Index>(row);
+                    outValues[slot] = values[k];
+                }
+            }
+        }
+
+        [[nodiscard]] SparseMatrix TransposeCsr(const SparseMatrix& matrix)
+        {
+            SparseMatrix transposed;
+            transposed.Rows = matrix.Cols;
+            transposed.Cols = matrix.Rows;
+            TransposeCsrArrays<std::size_t, double>(matrix.Rows, matrix.Cols, matrix.RowOffsets,
+                                                    matrix.ColIndices, matrix.Values, transposed.RowOffsets,
+                                                    transposed.ColIndices, transposed.Values);
+            return transposed;
+        }
+
+        // Gustavson row-by-row product. Rows are computed in parallel into
+        // per-row buffers with sorted columns, then concatenated, so the
+        // result does not depend on the thread count.
+        [[nodiscard]] SparseMatrix MultiplyCsr(const SparseMatrix& lhs, const SparseMatrix& rhs)
+        {
+            assert(lhs.Cols == rhs.Rows);
+
+            std::vector<std::vector<std::size_t>> rowCols(lhs.Rows);
+            std::vector<std::vector<double>> rowValues(lhs.Rows);
+            Parallel::ParallelFor(Parallel::IndexRange{0u, lhs.Rows}, kSpMVGrain / 4u,
+                                  [&](const Parallel::IndexRange range)
+            {
+                std::vector<std::size_t> slotOf(rhs.Cols, kUnaggregated);
+                for (std::size_t row = range.Begin; row < range.End; ++row)
+                {
+                    std::vector<std::size_t>& cols = rowCols[row];
+                    std::vector<double>& values = rowValues[row];
+                    for (std::size_t k = lhs.RowOffsets[row]; k < lhs.RowOffsets[row + 1]; ++k)
+                    {
+                        const std::size_t mid = lhs.ColIndices[k];
+                        const double a = lhs.Values[k];
+                        for (std::size_t m = rhs.RowOffsets[mid]; m < rhs.RowOffsets[mid + 1]; ++m)
+                        {
+                            const std::size_t col = rhs.ColIndices[m];
+                            if (slotOf[col] == kUnaggregated)
+                            {
+                                slotOf[col] = cols.size();
+                                cols.push_back(col);
+                                values.push_back(0.0);
+                            }
+                            values[slotOf[col]] += a * rhs.Values[m];
+                        }
+                    }
+
+                    std::vector<std::size_t> order(cols.size());
+                    for (std::size_t i = 0; i < order.size(); ++i)
+                    {
+                        order[i] = i;
+                    }
+                    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b)
+                    {
+                        return cols[a] < cols[b];
+                    });
+                    std::vector<std::size_t> sortedCols(cols.size());
+                    std::vector<double> sortedValues(cols.size());
+                    for (std::size_t i = 0; i < order.size(); ++i)
+                    {
+                        sortedCols[i] = cols[order[i]];
+                        sortedValues[i] = values[order[i]];
+                        slotOf[sortedCols[i]] = kUnaggregated;
+                    }
+                    cols = std::move(sortedCols);
+                    values = std::move(sortedValues);
+                }
+            });
+
+            SparseMatrix product;
+            product.Rows = lhs.Rows;
+            product.Cols = rhs.Cols;
+            product.RowOffsets.assign(lhs.Rows + 1, 0u);
+            for (std::size_t row = 0; row < lhs.Rows; ++row)
+            {
+                product.RowOffsets[row + 1] = product.RowOffsets[row] + rowCols[row].size();
+            }
+            product.ColIndices.reserve(product.RowOffsets.back());
+            product.Values.reserve(product.RowOffsets.back());
+            for (std::size_t row = 0; row < lhs.Rows; ++row)
+            {
+                product.ColIndices.insert(product.ColIndices.end(), rowCols[row].begin(), rowCols[row].end());
+                product.Values.insert(product.Values.end(), rowValues[row].begin(), rowValues[row].end());
+            }
+            return product;
+        }
+
+        [[nodiscard]] std::vector<double> ExtractDiagonal(const SparseMatrix& matrix)
+        {
+            std::vector<double> diagonal(matrix.Rows, 0.0);
+            for (std::size_t row = 0; row < matrix.Rows; ++row)
+            {
+                diagonal[row] = FindValue(matrix, row, row);
+            }
+            return diagonal;
+        }
+
+        // Upper bound on the spectral radius of D^-1 A (Gershgorin). It never
+        // underestimates, which keeps the damped-Jacobi steps convergent; for
+        // Laplacians it is close to the true radius of about 2.
+        [[nodiscard]] double JacobiSpectralBound(const SparseMatrix& matrix, std::span<const double> diagonal)
+        {
+            double bound = 0.0;
+            for (std::size_t row = 0; row < matrix.Rows; ++row)
+            {
+                double sum = 0.0;
+                for (std::size_t k = matrix.RowOffsets[row]; k < matrix.RowOffsets[row + 1]; ++k)
+                {
+                    sum += std::abs(matrix.Values[k]);
+                }
+                bound = std::max(bound, sum / diagonal[row]);
+            }
+            return std::max(bound, 1.0);
+        }
+
+        // Greedy three-phase aggregation (Vanek, Mandel and Brezina) over the
+        // symmetric strength graph. Rows without strong neighbours (e.g.
+        // identity rows of eliminated unknowns) stay unaggregated: the
+        // smoother handles them exactly.
+        [[nodiscard]] std::size_t Aggregate(
+            const SparseMatrix& matrix,
+            std::span<const double> diagonal,
+            double threshold,
+            std::vector<std::size_t>& aggregateOf)
+        {
+            const std::size_t n = matrix.Rows;
+            auto isStrong = [&](std::size_t row, std::size_t k)
+            {
+                const std::size_t col = matrix.ColIndices[k];
+                return col != row
+                    && std::abs(matrix.Values[k]) >= threshold * std::sqrt(diagonal[row] * diagonal[col]);
+            };
+
+            aggregateOf.assign(n, kUnaggregated);
+            for (std::size_t row = 0; row < n; ++row)
+            {
+                bool hasStrong = false;
+                for (std::size_t k = matrix.RowOffsets[row]; k < matrix.RowOffsets[row + 1] && !hasStrong; ++k)
+                {
+                    hasStrong = isStrong(row, k);
+                }
+                if (!hasStrong)
+                {
+                    aggregateOf[row] = kIsolated;
+                }
+            }
+
+            // Phase 1: a row whose whole strong neighbourhood is still free
+            // seeds an aggregate with that neighbourhood.
+            std::size_t aggregateCount = 0;
+            for (std::size_t row = 0; row < n; ++row)
+            {
+                if (aggregateOf[row] != kUnaggregated)
+                {
+                    continue;
+                }
+                bool allFree = true;
+                for (std::size_t k = matrix.RowOffsets[row]; k < matrix.RowOffsets[row + 1] && allFree; ++k)
+                {
+                    allFree = !isStrong(row, k) || aggregateOf[matrix.ColIndices[k]] == kUnaggregated;
+                }
+                if (!allFree)
+                {
+                    continue;
+                }
+                aggregateOf[row] = aggregateCount;
+                for (std::size_t k = matrix.RowOffsets[row]; k < matrix.RowOffsets[row + 1]; ++k)
+                {
+                    if (isStrong(row, k))
+                    {
+                        aggregateOf[matrix.ColIndices[k]] = aggregateCount;
+                    }
+                }
+                ++aggregateCount;
+            }
+
+            // Phase 2: leftover rows join the phase-1 aggregate they are most
+            // strongly connected to.
+            const std::vector<std::size_t> seeded = aggregateOf;
+            for (std::size_t row = 0; row < n; ++row)
+            {
+                if (seeded[row] != kUnaggregated)
+                {
+                    continue;
+                }
+                double best = 0.0;
+                for (std::size_t k = matrix.RowOffsets[row]; k < matrix.RowOffsets[row + 1]; ++k)
+                {
+                    const std::size_t col = matrix.ColIndices[k];
+                    if (isStrong(row, k) && seeded[col] < kIsolated && std::abs(matrix.Values[k]) > best)
+                    {
+                        best = std::abs(matrix.Values[k]);
+                        aggregateOf[row] = seeded[col];
+                    }
+                }
+            }
+
+            // Phase 3: what is still free forms aggregates with its free
+            // strong neighbours.
+            for (std::size_t row = 0; row < n; ++row)
+            {
+                if (aggregateOf[row] != kUnaggregated)
+                {
+                    continue;
+                }
+                aggregateOf[row] = aggregateCount;
+                for (std::size_t k = matrix.RowOffsets[row]; k < matrix.RowOffsets[row + 1]; ++k)
+                {
+                    if (isStrong(row, k) && aggregateOf[matrix.ColIndices[k]] == kUnaggregated)
+                    {
+                        aggregateOf[matrix.ColIndices[k]] = aggregateCount;
+                    }
+                }
+                ++aggregateCount;
+            }
+            return aggregateCount;
+        }
+
+        // P = (I - omega D^-1 A) T for the column-normalized piecewise-constant
+        // tentative prolongator T.
+        [[nodiscard]] SparseMatrix SmoothedProlongator(
+            const SparseMatrix& matrix,
+            std::span<const double> diagonal,
+            double omega,
+            std::span<const std::size_t> aggregateOf,
+            std::size_t aggregateCount)
+        {
+            const std::size_t n = matrix.Rows;
+            std::vector<double> aggregateSize(aggregateCount, 0.0);
+            for (const std::size_t aggregate : aggregateOf)
+            {
+                if (aggregate < kIsolated)
+                {
+                    aggregateSize[aggregate] += 1.0;
+                }
+            }
+            std::vector<double> tentative(n, 0.0);
+            for (std::size_t row = 0; row < n; ++row)
+            {
+                if (aggregateOf[row] < kIsolated)
+                {
+                    tentative[row] = 1.0 / std::sqrt(aggregateSize[aggregateOf[row]]);
+                }
+            }
+
+            SparseBuilder builder(n, aggregateCount);
+            builder.Reserve(matrix.NonZeros());
+            for (std::size_t row = 0; row < n; ++row)
+            {
+                if (aggregateOf[row] < kIsolated)
+                {
+                    builder.Add(row, aggregateOf[row], tentative[row]);
+                }
+                const double scale = omega / diagonal[row];
+                for (std::size_t k = matrix.RowOffsets[row]; k < matrix.RowOffsets[row + 1]; ++k)
+                {
+                    const std::size_t col = matrix.ColIndices[k];
+                    if (aggregateOf[col] < kIsolated)
+                    {
+                        builder.Add(row, aggregateOf[col], -scale * matrix.Values[k] * tentative[col]);
+                    }
+                }
+            }
+            return builder.Build(0.0).Matrix;
+        }
     }
 
     namespace Detail
@@ -669,6 +1007,22 @@ namespace Geometry::Sparse
         {
             EigenLLT Solver;
         };
+
+        struct AMGLevel
+        {
+            SparseMatrix A;
+            SparseMatrix P; // prolongation to this level from the next; empty on the coarsest
+            SparseMatrix R; // P^T
+            std::vector<double> SmootherScale; // omega / a_ii
+        };
+
+        struct AMGHierarchyImpl
+        {
+            std::vector<AMGLevel> Levels;
+            Eigen::LDLT<Eigen::MatrixXd> Coarse;
+            bool DenseCoarse{false};
+            std::size_t SmoothingSweeps{1};
+        };
     }
 
     void SparseMatrix::Multiply(std::span<const double> x, std::span<double> y) const
@@ -676,15 +1030,20 @@ namespace Geometry::Sparse
         assert(x.size() >= Cols);
         assert(y.size() >= Rows);
 
-        for (std::size_t row = 0; row < Rows; ++row)
+        // Rows are independent, so the parallel result is bit-identical to
+        // the serial loop.
+        Parallel::ParallelFor(Parallel::IndexRange{0u, Rows}, kSpMVGrain, [&](const Parallel::IndexRange range)
         {
-            double sum = 0.0;
-            for (std::size_t k = RowOffsets[row]; k < RowOffsets[row + 1]; ++k)
+            for (std::size_t row = range.Begin; row < range.End; ++row)
             {
-                sum += Values[k] * x[ColIndices[k]];
+                double sum = 0.0;
+                for (std::size_t k = RowOffsets[row]; k < RowOffsets[row + 1]; ++k)
+                {
+                    sum += Values[k] * x[ColIndices[k]];
+                }
+                y[row] = sum;
             }
-            y[row] = sum;
-        }
+        });
     }
 
     void SparseMatrix::MultiplyTranspose(std::span<const double> x, std::span<double> y) const
@@ -702,6 +1061,393 @@ namespace Geometry::Sparse
         }
     }
 
+    namespace
+    {
+        // First row of chunk `chunk` when [0, rows) is cut into `chunkCount`
+        // pieces of about nonZeros / chunkCount non-zeros each.
+        [[nodiscard]] std::size_t ChunkRowBoundary(
+            std::span<const std::size_t> rowOffsets,
+            const std::size_t rows,
+            const std::size_t chunk,
+            const std::size_t chunkCount)
+        {
+            if (chunk == 0)
+            {
+                return 0;
+            }
+            if (chunk >= chunkCount)
+            {
+                return rows;
+            }
+            const std::size_t nonZeros = rowOffsets[rows];
+            const std::size_t target = (nonZeros / chunkCount) * chunk
+                + (nonZeros % chunkCount) * chunk / chunkCount;
+            const auto it = std::upper_bound(rowOffsets.begin(), rowOffsets.begin() + static_cast<std::ptrdiff_t>(rows), target);
+            return static_cast<std::size_t>(it - rowOffsets.begin()) - 1u;
+        }
+
+        // Runs fn(rowBegin, rowEnd) over row chunks of balanced non-zero count.
+        template <typename Fn>
+        void ForEachBalancedRowChunk(
+            std::span<const std::size_t> rowOffsets,
+            const std::size_t rows,
+            Fn&& fn)
+        {
+            if (rows == 0)
+            {
+                return;
+            }
+            const std::size_t nonZeros = rowOffsets[rows];
+            const std::size_t chunkCount = std::max<std::size_t>(
+                1u, (nonZeros + kCompactSpMVChunkNonZeros - 1u) / kCompactSpMVChunkNonZeros);
+            Parallel::ParallelFor(Parallel::IndexRange{0u, chunkCount}, 1u, [&](const Parallel::IndexRange range)
+            {
+                for (std::size_t chunk = range.Begin; chunk < range.End; ++chunk)
+                {
+                    fn(ChunkRowBoundary(rowOffsets, rows, chunk, chunkCount),
+                       ChunkRowBoundary(rowOffsets, rows, chunk + 1u, chunkCount));
+                }
+            });
+        }
+    }
+
+    template <typename TValue>
+    void CompactSparseMatrix<TValue>::Multiply(std::span<const TValue> x, std::span<TValue> y) const
+    {
+        assert(x.size() >= Cols_);
+        assert(y.size() >= Rows_);
+        assert(RowOffsets_.size() == Rows_ + 1);
+
+        ForEachBalancedRowChunk(RowOffsets_, Rows_, [&](const std::size_t rowBegin, const std::size_t rowEnd)
+        {
+            for (std::size_t row = rowBegin; row < rowEnd; ++row)
+            {
+                double sum = 0.0;
+                for (std::size_t k = RowOffsets_[row]; k < RowOffsets_[row + 1]; ++k)
+                {
+                    sum += static_cast<double>(Values_[k]) * static_cast<double>(x[ColIndices_[k]]);
+                }
+                y[row] = static_cast<TValue>(sum);
+            }
+        });
+    }
+
+    template <typename TValue>
+    void CompactSparseMatrix<TValue>::MultiplyTranspose(std::span<const TValue> x, std::span<TValue> y) const
+    {
+        assert(x.size() >= Rows_);
+        assert(y.size() >= Cols_);
+
+        if (Transposed_)
+        {
+            assert(Transposed_->Rows_ == Cols_ && Transposed_->Cols_ == Rows_);
+            Transposed_->Multiply(x, y);
+            return;
+        }
+
+        std::vector<double> sums(Cols_, 0.0);
+        for (std::size_t row = 0; row < Rows_; ++row)
+        {
+            const double xr = static_cast<double>(x[row]);
+            for (std::size_t k = RowOffsets_[row]; k < RowOffsets_[row + 1]; ++k)
+            {
+                sums[ColIndices_[k]] += static_cast<double>(Values_[k]) * xr;
+            }
+        }
+        for (std::size_t col = 0; col < Cols_; ++col)
+        {
+            y[col] = static_cast<TValue>(sums[col]);
+        }
+    }
+
+    template <typename TValue>
+    void CompactSparseMatrix<TValue>::BuildTranspose()
+    {
+        // The transposed column indices are row indices of this matrix.
+        if (Rows_ > std::numeric_limits<std::uint32_t>::max())
+        {
+            Transposed_.reset();
+            return;
+        }
+        auto transposed = std::make_shared<CompactSparseMatrix>();
+        transposed->Rows_ = Cols_;
+        transposed->Cols_ = Rows_;
+        TransposeCsrArrays<std::uint32_t, TValue>(Rows_, Cols_, RowOffsets_, ColIndices_, Values_,
+                                                  transposed->RowOffsets_, transposed->ColIndices_,
+                                                  transposed->Values_);
+        Transposed_ = std::move(transposed);
+    }
+
+    template <typename TValue>
+    CompactSparseBuildResult<TValue> MakeCompact(const SparseMatrix& matrix)
+    {
+        if (!ValidateCsr(matrix) || matrix.Cols > std::numeric_limits<std::uint32_t>::max())
+        {
+            return {};
+        }
+
+        CompactSparseBuildResult<TValue> result;
+        CompactSparseMatrix<TValue>& compact = result.Matrix;
+        compact.Rows_ = matrix.Rows;
+        compact.Cols_ = matrix.Cols;
+        compact.RowOffsets_ = matrix.RowOffsets;
+        compact.ColIndices_.resize(matrix.NonZeros());
+        compact.Values_.resize(matrix.NonZeros());
+        for (std::size_t k = 0; k < matrix.NonZeros(); ++k)
+        {
+            const TValue value = static_cast<TValue>(matrix.Values[k]);
+            if (!std::isfinite(value))
+            {
+                return {};
+            }
+            compact.ColIndices_[k] = static_cast<std::uint32_t>(matrix.ColIndices[k]);
+            compact.Values_[k] = value;
+        }
+        result.Valid = true;
+        return result;
+    }
+
+    template class CompactSparseMatrix<double>;
+    template class CompactSparseMatrix<float>;
+    template CompactSparseBuildResult<double> MakeCompact<double>(const SparseMatrix&);
+    template CompactSparseBuildResult<float> MakeCompact<float>(const SparseMatrix&);
+
+    std::vector<std::size_t> ComputeReverseCuthillMcKee(const SparseMatrix& matrix)
+    {
+        if (!ValidateCsr(matrix) || matrix.Rows != matrix.Cols)
+        {
+            return {};
+        }
+
+        // Adjacency of the symmetrized pattern, without self loops.
+        const std::size_t n = matrix.Rows;
+        const SparseMatrix transposed = TransposeCsr(matrix);
+        std::vector<std::size_t> adjacencyOffsets(n + 1, 0u);
+        std::vector<std::size_t> adjacency;
+        adjacency.reserve(2u * matrix.NonZeros());
+        for (std::size_t row = 0; row < n; ++row)
+        {
+            const std::size_t begin = adjacency.size();
+            for (const SparseMatrix* source : {&matrix, &transposed})
+            {
+                for (std::size_t k = source->RowOffsets[row]; k < source->RowOffsets[row + 1]; ++k)
+                {
+                    if (source->ColIndices[k] != row)
+                    {
+                        adjacency.push_back(source->ColIndices[k]);
+                    }
+                }
+            }
+            std::sort(adjacency.begin() + static_cast<std::ptrdiff_t>(begin), adjacency.end());
+            adjacency.erase(std::unique(adjacency.begin() + static_cast<std::ptrdiff_t>(begin), adjacency.end()),
+                            adjacency.end());
+            adjacencyOffsets[row + 1] = adjacency.size();
+        }
+
+        const auto degree = [&](const std::size_t v)
+        {
+            return adjacencyOffsets[v + 1] - adjacencyOffsets[v];
+        };
+        const auto byDegree = [&](const std::size_t a, const std::size_t b)
+        {
+            const std::size_t da = degree(a);
+            const std::size_t db = degree(b);
+            return da != db ? da < db : a < b;
+        };
+
+        // Level structure rooted at `root`: fills `order` breadth first and
+        // returns {depth, index in `order` where the last level starts}.
+        std::vector<std::size_t> stamp(n, 0u);
+        std::size_t currentStamp = 0;
+        const auto levelStructure = [&](const std::size_t root, std::vector<std::size_t>& order)
+        {
+            ++currentStamp;
+            order.clear();
+            order.push_back(root);
+            stamp[root] = currentStamp;
+            std::size_t levelBegin = 0;
+            std::size_t lastLevelBegin = 0;
+            std::size_t depth = 0;
+            while (levelBegin < order.size())
+            {
+                const std::size_t levelEnd = order.size();
+                lastLevelBegin = levelBegin;
+                for (std::size_t i = levelBegin; i < levelEnd; ++i)
+                {
+                    const std::size_t v = order[i];
+                    for (std::size_t k = adjacencyOffsets[v]; k < adjacencyOffsets[v + 1]; ++k)
+                    {
+                        if (stamp[adjacency[k]] != currentStamp)
+                        {
+                            stamp[adjacency[k]] = currentStamp;
+                            order.push_back(adjacency[k]);
+                        }
+                    }
+                }
+                levelBegin = levelEnd;
+                ++depth;
+            }
+            return std::pair{depth, lastLevelBegin};
+        };
+
+        std::vector<std::size_t> ordering;
+        ordering.reserve(n);
+        std::vector<bool> visited(n, false);
+        std::vector<std::size_t> levels;
+        std::vector<std::size_t> candidateLevels;
+        std::vector<std::size_t> neighbours;
+        for (std::size_t seed = 0; seed < n; ++seed)
+        {
+            if (visited[seed])
+            {
+                continue;
+            }
+
+            // George-Liu: move to the minimum-degree vertex of the last level
+            // while that deepens the level structure.
+            std::size_t root = seed;
+            auto [depth, lastLevelBegin] = levelStructure(root, levels);
+            for (std::size_t sweep = 0; sweep < kMaxPeripheralSweeps; ++sweep)
+            {
+                const std::size_t candidate = *std::min_element(
+                    levels.begin() + static_cast<std::ptrdiff_t>(lastLevelBegin), levels.end(), byDegree);
+                const auto [candidateDepth, candidateLastLevelBegin] = levelStructure(candidate, candidateLevels);
+                if (candidateDepth <= depth)
+                {
+                    break;
+                }
+                root = candidate;
+                depth = candidateDepth;
+                lastLevelBegin = candidateLastLevelBegin;
+                std::swap(levels, candidateLevels);
+            }
+
+            std::size_t head = ordering.size();
+            ordering.push_back(root);
+            visited[root] = true;
+            while (head < ordering.size())
+            {
+                const std::size_t v = ordering[head++];
+                neighbours.clear();
+                for (std::size_t k = adjacencyOffsets[v]; k < adjacencyOffsets[v + 1]; ++k)
+                {
+                    if (!visited[adjacency[k]])
+                    {
+                        visited[adjacency[k]] = true;
+                        neighbours.push_back(adjacency[k]);
+                    }
+                }
+                std::sort(neighbours.begin(), neighbours.end(), byDegree);
+                ordering.insert(ordering.end(), neighbours.begin(), neighbours.end());
+            }
+        }
+
+        std::reverse(ordering.begin(), ordering.end());
+        return ordering;
+    }
+
+    SparseBuildResult PermuteSymmetric(const SparseMatrix& matrix, std::span<const std::size_t> permutation)
+    {
+        constexpr std::size_t kUnset = std::numeric_limits<std::size_t>::max();
+
+        SparseBuildResult result;
+        result.Valid = false;
+        if (!ValidateCsr(matrix) || matrix.Rows != matrix.Cols || permutation.size() != matrix.Rows)
+        {
+            return result;
+        }
+
+        const std::size_t n = matrix.Rows;
+        std::vector<std::size_t> inverse(n, kUnset);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (permutation[i] >= n || inverse[permutation[i]] != kUnset)
+            {
+                return result;
+            }
+            inverse[permutation[i]] = i;
+        }
+
+        SparseMatrix& permuted = result.Matrix;
+        permuted.Rows = n;
+        permuted.Cols = n;
+        permuted.RowOffsets.assign(n + 1, 0u);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const std::size_t old = permutation[i];
+            permuted.RowOffsets[i + 1] = permuted.RowOffsets[i] + (matrix.RowOffsets[old + 1] - matrix.RowOffsets[old]);
+        }
+        permuted.ColIndices.resize(matrix.NonZeros());
+        permuted.Values.resize(matrix.NonZeros());
+
+        Parallel::ParallelFor(Parallel::IndexRange{0u, n}, kSpMVGrain, [&](const Parallel::IndexRange range)
+        {
+            std::vector<std::pair<std::size_t, double>> row;
+            for (std::size_t i = range.Begin; i < range.End; ++i)
+            {
+                const std::size_t old = permutation[i];
+                row.clear();
+                for (std::size_t k = matrix.RowOffsets[old]; k < matrix.RowOffsets[old + 1]; ++k)
+                {
+                    row.emplace_back(inverse[matrix.ColIndices[k]], matrix.Values[k]);
+                }
+                std::sort(row.begin(), row.end());
+                std::size_t slot = permuted.RowOffsets[i];
+                for (const auto& [col, value] : row)
+                {
+                    permuted.ColIndices[slot] = col;
+                    permuted.Values[slot] = value;
+                    ++slot;
+                }
+            }
+        });
+
+        result.Valid = true;
+        return result;
+    }
+
+    void PermuteVector(
+        std::span<const std::size_t> permutation,
+        std::span<const double> values,
+        std::span<double> out)
+    {
+        assert(values.size() >= permutation.size());
+        assert(out.size() >= permutation.size());
+
+        for (std::size_t i = 0; i < permutation.size(); ++i)
+        {
+            out[i] = values[permutation[i]];
+        }
+    }
+
+    void InversePermuteVector(
+        std::span<const std::size_t> permutation,
+        std::span<const double> values,
+        std::span<double> out)
+    {
+        assert(values.size() >= permutation.size());
+        assert(out.size() >= permutation.size());
+
+        for (std::size_t i = 0; i < permutation.size(); ++i)
+        {
+            out[permutation[i]] = values[i];
+        }
+    }
+
+    std::size_t ComputeBandwidth(const SparseMatrix& matrix)
+    {
+        std::size_t bandwidth = 0;
+        for (std::size_t row = 0; row < matrix.Rows; ++row)
+        {
+            for (std::size_t k = matrix.RowOffsets[row]; k < matrix.RowOffsets[row + 1]; ++k)
+            {
+                const std::size_t col = matrix.ColIndices[k];
+                bandwidth = std::max(bandwidth, col > row ? col - row : row - col);
+            }
+        }
+        return bandwidth;
+    }
+
     void DiagonalMatrix::Multiply(std::span<const double> x, std::span<double> y) const
     {
         assert(x.size() >= Size);
@@ -1087,6 +1833,223 @@ namespace Geometry::Sparse
         return Diagnostics_;
     }
 
+    namespace
+    {
+        // One damped-Jacobi sweep x += S (b - A x).
+        void JacobiSweep(const Detail::AMGLevel& level, std::vector<double>& x,
+                         const std::vector<double>& b, std::vector<double>& residual)
+        {
+            level.A.Multiply(x, residual);
+            Parallel::ParallelFor(Parallel::IndexRange{0u, level.A.Rows}, kSpMVGrain,
+                                  [&](const Parallel::IndexRange range)
+            {
+                for (std::size_t i = range.Begin; i < range.End; ++i)
+                {
+                    x[i] += level.SmootherScale[i] * (b[i] - residual[i]);
+                }
+            });
+        }
+
+        // Solves level.A X = B approximately, starting from X = 0, with the
+        // per-level vectors in `workspace`. The pre- and post-smoothing are
+        // mirror images, which keeps the cycle symmetric.
+        void RunVCycle(const Detail::AMGHierarchyImpl& impl, AMGWorkspace& workspace, std::size_t levelIndex)
+        {
+            const Detail::AMGLevel& level = impl.Levels[levelIndex];
+            std::vector<double>& x = workspace.X[levelIndex];
+            std::vector<double>& b = workspace.B[levelIndex];
+            std::vector<double>& residual = workspace.Residual[levelIndex];
+            const std::size_t n = level.A.Rows;
+            const bool coarsest = levelIndex + 1 == impl.Levels.size();
+
+            if (coarsest && impl.DenseCoarse)
+            {
+                const Eigen::Map<const Eigen::VectorXd> rhs(b.data(), static_cast<Eigen::Index>(n));
+                Eigen::Map<Eigen::VectorXd>(x.data(), static_cast<Eigen::Index>(n)) = impl.Coarse.solve(rhs);
+                return;
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                x[i] = level.SmootherScale[i] * b[i];
+            }
+            const std::size_t sweeps = coarsest ? kAMGCoarseJacobiSweeps : impl.SmoothingSweeps;
+            for (std::size_t sweep = 1; sweep < sweeps; ++sweep)
+            {
+                JacobiSweep(level, x, b, residual);
+            }
+            if (coarsest)
+            {
+                return;
+            }
+
+            level.A.Multiply(x, residual);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                residual[i] = b[i] - residual[i];
+            }
+            level.R.Multiply(residual, workspace.B[levelIndex + 1]);
+            RunVCycle(impl, workspace, levelIndex + 1);
+            level.P.Multiply(workspace.X[levelIndex + 1], residual);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                x[i] += residual[i];
+            }
+
+            for (std::size_t sweep = 0; sweep < impl.SmoothingSweeps; ++sweep)
+            {
+                JacobiSweep(level, x, b, residual);
+            }
+        }
+    }
+
+    AMGHierarchy::AMGHierarchy()
+        : Impl_(std::make_unique<Detail::AMGHierarchyImpl>())
+    {
+    }
+
+    AMGHierarchy::~AMGHierarchy() = default;
+
+    AMGHierarchy::AMGHierarchy(AMGHierarchy&&) noexcept = default;
+
+    AMGHierarchy& AMGHierarchy::operator=(AMGHierarchy&&) noexcept = default;
+
+    AMGDiagnostics AMGHierarchy::build(const SparseMatrix& matrix, const AMGParams& params)
+    {
+        Diagnostics_ = {};
+        Dimension_ = 0;
+        if (!Impl_)
+        {
+            Impl_ = std::make_unique<Detail::AMGHierarchyImpl>();
+        }
+        Impl_->Levels.clear();
+        Impl_->DenseCoarse = false;
+        Impl_->SmoothingSweeps = std::max<std::size_t>(params.SmoothingSweeps, 1u);
+
+        if (matrix.Rows != matrix.Cols)
+        {
+            Diagnostics_.Status = SparseFactorizationStatus::DimensionMismatch;
+            return Diagnostics_;
+        }
+        if (!ValidateCsr(matrix) || !std::isfinite(params.StrengthThreshold) || params.StrengthThreshold < 0.0
+            || params.MaxLevels == 0)
+        {
+            Diagnostics_.Status = SparseFactorizationStatus::InvalidInput;
+            return Diagnostics_;
+        }
+
+        SparseMatrix current = matrix;
+        const double fineNonZeros = std::max<double>(static_cast<double>(matrix.NonZeros()), 1.0);
+        double totalNonZeros = 0.0;
+        while (true)
+        {
+            const std::vector<double> diagonal = ExtractDiagonal(current);
+            for (const double d : diagonal)
+            {
+                if (!(d > 0.0))
+                {
+                    Impl_->Levels.clear();
+                    Diagnostics_.Status = SparseFactorizationStatus::NonSPD;
+                    return Diagnostics_;
+                }
+            }
+
+            Detail::AMGLevel& level = Impl_->Levels.emplace_back();
+            const std::size_t n = current.Rows;
+            const double omega = (4.0 / 3.0) / JacobiSpectralBound(current, diagonal);
+            level.SmootherScale.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                level.SmootherScale[i] = omega / diagonal[i];
+            }
+            totalNonZeros += static_cast<double>(current.NonZeros());
+
+            bool coarsen = n > params.CoarsestRows && Impl_->Levels.size() < params.MaxLevels;
+            std::vector<std::size_t> aggregateOf;
+            std::size_t aggregateCount = 0;
+            if (coarsen)
+            {
+                aggregateCount = Aggregate(current, diagonal, params.StrengthThreshold, aggregateOf);
+                // Stop when coarsening stalls; a level this size gains nothing.
+                coarsen = aggregateCount > 0 && aggregateCount * 10u < n * 9u;
+            }
+            if (!coarsen)
+            {
+                level.A = std::move(current);
+                break;
+            }
+
+            level.P = SmoothedProlongator(current, diagonal, omega, aggregateOf, aggregateCount);
+            level.R = TransposeCsr(level.P);
+            SparseMatrix coarse = MultiplyCsr(level.R, MultiplyCsr(current, level.P));
+            level.A = std::move(current);
+            current = std::move(coarse);
+        }
+
+        const Detail::AMGLevel& coarsest = Impl_->Levels.back();
+        if (coarsest.A.Rows <= kAMGMaxDenseCoarseRows)
+        {
+            Eigen::MatrixXd dense = Eigen::MatrixXd::Zero(
+                static_cast<Eigen::Index>(coarsest.A.Rows),
+                static_cast<Eigen::Index>(coarsest.A.Rows));
+            for (std::size_t row = 0; row < coarsest.A.Rows; ++row)
+            {
+                for (std::size_t k = coarsest.A.RowOffsets[row]; k < coarsest.A.RowOffsets[row + 1]; ++k)
+                {
+                    dense(static_cast<Eigen::Index>(row), static_cast<Eigen::Index>(coarsest.A.ColIndices[k]))
+                        = coarsest.A.Values[k];
+                }
+            }
+            Impl_->Coarse.compute(dense);
+            Impl_->DenseCoarse = Impl_->Coarse.info() == Eigen::Success;
+        }
+
+        Dimension_ = matrix.Rows;
+        Diagnostics_.Status = SparseFactorizationStatus::Success;
+        Diagnostics_.LevelCount = Impl_->Levels.size();
+        Diagnostics_.CoarsestRows = coarsest.A.Rows;
+        Diagnostics_.OperatorComplexity = totalNonZeros / fineNonZeros;
+        return Diagnostics_;
+    }
+
+    void AMGHierarchy::apply(std::span<const double> r, std::span<double> z) const
+    {
+        AMGWorkspace workspace;
+        apply(r, z, workspace);
+    }
+
+    void AMGHierarchy::apply(std::span<const double> r, std::span<double> z, AMGWorkspace& workspace) const
+    {
+        assert(r.size() >= Dimension_);
+        assert(z.size() >= Dimension_);
+        if (!Impl_ || !Diagnostics_.Succeeded() || Dimension_ == 0)
+        {
+            std::copy(r.begin(), r.begin() + static_cast<std::ptrdiff_t>(Dimension_), z.begin());
+            return;
+        }
+
+        const std::size_t levelCount = Impl_->Levels.size();
+        workspace.X.resize(levelCount);
+        workspace.B.resize(levelCount);
+        workspace.Residual.resize(levelCount);
+        for (std::size_t levelIndex = 0; levelIndex < levelCount; ++levelIndex)
+        {
+            const std::size_t n = Impl_->Levels[levelIndex].A.Rows;
+            workspace.X[levelIndex].resize(n);
+            workspace.B[levelIndex].resize(n);
+            workspace.Residual[levelIndex].resize(n);
+        }
+
+        std::copy(r.begin(), r.begin() + static_cast<std::ptrdiff_t>(Dimension_), workspace.B.front().begin());
+        RunVCycle(*Impl_, workspace, 0);
+        std::copy(workspace.X.front().begin(), workspace.X.front().end(), z.begin());
+    }
+
+    const AMGDiagnostics& AMGHierarchy::diagnostics() const noexcept
+    {
+        return Diagnostics_;
+    }
+
     SparseIterativeDiagnostics SparseBiCGSTAB::solve(
         const SparseMatrix& matrix,
         std::span<const double> rhs,
@@ -1134,8 +2097,12 @@ namespace Geometry::Sparse
     CGResult SolveCG(const SparseMatrix& A, std::span<const double> b, std::span<double> x, const CGParams& params)
     {
         CGResult result;
+        result.Preconditioner = params.Preconditioner;
+        const bool supportedPreconditioner = params.Preconditioner == SparsePreconditioner::None
+            || params.Preconditioner == SparsePreconditioner::Diagonal
+            || params.Preconditioner == SparsePreconditioner::AMG;
         if (A.Rows != A.Cols || b.size() < A.Rows || x.size() < A.Rows || !ValidateCsr(A)
-            || !IsFiniteSpan(b) || !IsFiniteSpan(x))
+            || !IsFiniteSpan(b) || !IsFiniteSpan(x) || !supportedPreconditioner)
         {
             result.Reason = CGConvergenceReason::InvalidInput;
             return result;
@@ -1149,19 +2116,59 @@ namespace Geometry::Sparse
             return result;
         }
 
-        std::vector<double> diagInv(n, 1.0);
-        for (std::size_t row = 0; row < n; ++row)
+        std::vector<double> diagInv;
+        AMGHierarchy ownedHierarchy;
+        const AMGHierarchy* hierarchy = params.Hierarchy;
+        AMGWorkspace amgWorkspace;
+        if (params.Preconditioner == SparsePreconditioner::Diagonal)
         {
-            for (std::size_t k = A.RowOffsets[row]; k < A.RowOffsets[row + 1]; ++k)
+            diagInv.assign(n, 1.0);
+            for (std::size_t row = 0; row < n; ++row)
             {
-                if (A.ColIndices[k] == row)
+                for (std::size_t k = A.RowOffsets[row]; k < A.RowOffsets[row + 1]; ++k)
                 {
-                    const double d = A.Values[k];
-                    diagInv[row] = (std::abs(d) > 1e-15) ? (1.0 / d) : 1.0;
-                    break;
+                    if (A.ColIndices[k] == row)
+                    {
+                        const double d = A.Values[k];
+                        diagInv[row] = (std::abs(d) > 1e-15) ? (1.0 / d) : 1.0;
+                        break;
+                    }
                 }
             }
         }
+        else if (params.Preconditioner == SparsePreconditioner::AMG)
+        {
+            if (hierarchy == nullptr)
+            {
+                (void)ownedHierarchy.build(A, params.AMG);
+                hierarchy = &ownedHierarchy;
+            }
+            if (!hierarchy->diagnostics().Succeeded() || hierarchy->rows() != n)
+            {
+                result.Reason = CGConvergenceReason::InvalidInput;
+                return result;
+            }
+        }
+
+        auto precondition = [&](std::span<const double> residual, std::span<double> out)
+        {
+            switch (params.Preconditioner)
+            {
+            case SparsePreconditioner::Diagonal:
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    out[i] = diagInv[i] * residual[i];
+                }
+                return;
+            case SparsePreconditioner::AMG:
+                hierarchy->apply(residual, out, amgWorkspace);
+                return;
+            case SparsePreconditioner::None:
+            case SparsePreconditioner::IncompleteLUT:
+                break;
+            }
+            std::copy(residual.begin(), residual.begin() + static_cast<std::ptrdiff_t>(n), out.begin());
+        };
 
         std::vector<double> r(n);
         std::vector<double> Ax(n);
@@ -1172,10 +2179,7 @@ namespace Geometry::Sparse
         }
 
         std::vector<double> z(n);
-        for (std::size_t i = 0; i < n; ++i)
-        {
-            z[i] = diagInv[i] * r[i];
-        }
+        precondition(r, z);
         std::vector<double> p(z);
 
         double rz = 0.0;
@@ -1240,10 +2244,7 @@ namespace Geometry::Sparse
                 return result;
             }
 
-            for (std::size_t i = 0; i < n; ++i)
-            {
-                z[i] = diagInv[i] * r[i];
-            }
+            precondition(r, z);
 
             double rzNew = 0.0;
             for (std::size_t i = 0; i < n; ++i)
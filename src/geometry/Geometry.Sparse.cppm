@@ -22,6 +22,7 @@ namespace Geometry::Sparse::Detail
 {
     struct SparseLDLTImpl;
     struct SparseLLTImpl;
+    struct AMGHierarchyImpl;
 }
 
 export namespace Geometry::Sparse
@@ -60,7 +61,9 @@ export namespace Geometry::Sparse
     {
         None = 0,
         Diagonal,
-        IncompleteLUT
+        IncompleteLUT,
+        // Smoothed-aggregation algebraic multigrid (AMGHierarchy). CG only.
+        AMG
     };
 
     struct SparseMatrix
@@ -120,6 +123,117 @@ export namespace Geometry::Sparse
         [[nodiscard]] SparseBuildResult Build(double dropTolerance = 0.0) const;
     };
 
+    // =========================================================================
+    // Compact CSR for bandwidth-bound SpMV
+    // =========================================================================
+    //
+    // Same layout as SparseMatrix, but with 32-bit column indices and a
+    // selectable value type (double or float). On a mesh Laplacian this moves
+    // 12 (double) or 8 (float) bytes per non-zero instead of 16. Products
+    // accumulate in double whatever TValue is.
+    //
+    // Multiply splits the rows into chunks of roughly equal non-zero count
+    // and runs them on Core::Parallel; each row is summed serially, so the
+    // result does not depend on the thread count. MultiplyTranspose runs
+    // Multiply on a transposed copy built by BuildTranspose(), and falls back
+    // to a serial scatter while there is none.
+    //
+    // The arrays are read-only once MakeCompact() has built them, so the
+    // transposed copy can never go stale; copies of the matrix share it.
+    // Rebuild from the SparseMatrix to change the entries.
+
+    template <typename TValue>
+    struct CompactSparseBuildResult;
+
+    // Converts a SparseMatrix. Invalid (Matrix left empty) when the source
+    // fails structural validation, has more than 2^32 - 1 columns, or has a
+    // value that is not finite in TValue.
+    template <typename TValue>
+    [[nodiscard]] CompactSparseBuildResult<TValue> MakeCompact(const SparseMatrix& matrix);
+
+    template <typename TValue>
+    class CompactSparseMatrix
+    {
+    public:
+        using ValueType = TValue;
+
+        [[nodiscard]] std::size_t Rows() const noexcept { return Rows_; }
+        [[nodiscard]] std::size_t Cols() const noexcept { return Cols_; }
+        [[nodiscard]] std::span<const std::size_t> RowOffsets() const noexcept { return RowOffsets_; }
+        [[nodiscard]] std::span<const std::uint32_t> ColIndices() const noexcept { return ColIndices_; }
+        [[nodiscard]] std::span<const TValue> Values() const noexcept { return Values_; }
+
+        [[nodiscard]] std::size_t NonZeros() const noexcept { return Values_.size(); }
+        [[nodiscard]] bool IsEmpty() const noexcept { return Rows_ == 0 && Cols_ == 0; }
+        [[nodiscard]] bool HasTranspose() const noexcept { return Transposed_ != nullptr; }
+
+        // Bytes of the three CSR arrays (not counting the transposed copy).
+        [[nodiscard]] std::size_t StorageBytes() const noexcept
+        {
+            return RowOffsets_.size() * sizeof(std::size_t)
+                + ColIndices_.size() * sizeof(std::uint32_t)
+                + Values_.size() * sizeof(TValue);
+        }
+
+        void Multiply(std::span<const TValue> x, std::span<TValue> y) const;
+        void MultiplyTranspose(std::span<const TValue> x, std::span<TValue> y) const;
+
+        void BuildTranspose();
+        void ClearTranspose() noexcept { Transposed_.reset(); }
+
+    private:
+        friend CompactSparseBuildResult<TValue> MakeCompact<TValue>(const SparseMatrix& matrix);
+
+        std::size_t Rows_{0};
+        std::size_t Cols_{0};
+        std::vector<std::size_t> RowOffsets_;
+        std::vector<std::uint32_t> ColIndices_;
+        std::vector<TValue> Values_;
+        std::shared_ptr<const CompactSparseMatrix> Transposed_{};
+    };
+
+    template <typename TValue>
+    struct CompactSparseBuildResult
+    {
+        CompactSparseMatrix<TValue> Matrix{};
+        bool Valid{false};
+    };
+
+    // =========================================================================
+    // Bandwidth-reducing reordering
+    // =========================================================================
+    //
+    // Permutations map new index -> old index: row `i` of the reordered
+    // matrix is row `permutation[i]` of the original.
+
+    // Reverse Cuthill-McKee ordering of the symmetrized pattern of a square
+    // matrix. Each connected component starts from a pseudo-peripheral vertex
+    // (George-Liu) and is visited breadth first with neighbours in ascending
+    // degree; the result is deterministic. Returns an empty vector for a
+    // non-square or structurally invalid matrix.
+    [[nodiscard]] std::vector<std::size_t> ComputeReverseCuthillMcKee(const SparseMatrix& matrix);
+
+    // P A P^T for a square matrix. Invalid (Matrix left empty) when the
+    // matrix is not square or valid, or `permutation` is not a permutation of
+    // [0, Rows). Rows of the result keep their columns sorted.
+    [[nodiscard]] SparseBuildResult PermuteSymmetric(
+        const SparseMatrix& matrix,
+        std::span<const std::size_t> permutation);
+
+    // out[i] = values[permutation[i]], and its inverse. All spans have the
+    // permutation's length.
+    void PermuteVector(
+        std::span<const std::size_t> permutation,
+        std::span<const double> values,
+        std::span<double> out);
+    void InversePermuteVector(
+        std::span<const std::size_t> permutation,
+        std::span<const double> values,
+        std::span<double> out);
+
+    // max |row - col| over the stored entries.
+    [[nodiscard]] std::size_t ComputeBandwidth(const SparseMatrix& matrix);
+
     struct SparseDiagnostics
     {
         bool ValidShape{false};
@@ -167,10 +281,104 @@ export namespace Geometry::Sparse
         }
     };
 
+    struct AMGParams
+    {
+        // j is a strong neighbour of i when |a_ij| >= theta * sqrt(a_ii * a_jj).
+        double StrengthThreshold{0.08};
+        std::size_t MaxLevels{12};
+        // Coarsening stops once a level has at most this many rows; that level
+        // is solved with a dense LDLT.
+        std::size_t CoarsestRows{256};
+        // Damped-Jacobi sweeps before and after each coarse correction.
+        std::size_t SmoothingSweeps{1};
+    };
+
+    struct AMGDiagnostics
+    {
+        SparseFactorizationStatus Status{SparseFactorizationStatus::NotFactored};
+        std::size_t LevelCount{0};
+        std::size_t CoarsestRows{0};
+        // Sum of the non-zeros of all level operators over those of the input.
+        double OperatorComplexity{0.0};
+
+        [[nodiscard]] bool Succeeded() const noexcept
+        {
+            return Status == SparseFactorizationStatus::Success;
+        }
+    };
+
+    // Per-level V-cycle vectors for AMGHierarchy::apply(), sized on first use.
+    // A workspace must not be shared between concurrent apply() calls.
+    struct AMGWorkspace
+    {
+        std::vector<std::vector<double>> X;
+        std::vector<std::vector<double>> B;
+        std::vector<std::vector<double>> Residual;
+    };
+
+    // Smoothed-aggregation AMG hierarchy for a symmetric matrix with a
+    // positive diagonal (graph or cotan Laplacians, optionally shifted by a
+    // mass matrix, with or without identity rows for eliminated unknowns).
+    //
+    // Aggregates grow greedily over the strength graph; the piecewise-constant
+    // tentative prolongator is smoothed with one damped-Jacobi step, and the
+    // coarse operators are the Galerkin products P^T A P. apply() runs one
+    // symmetric V-cycle (damped Jacobi pre/post smoothing), so it is a valid
+    // SPD preconditioner for CG. Building once and passing the hierarchy via
+    // CGParams::Hierarchy amortizes the setup over repeated solves with the
+    // same operator (heat method, per-axis smoothing, multiple right-hand
+    // sides).
+    //
+    // The hierarchy is read-only after build(): the V-cycle vectors live in an
+    // AMGWorkspace, so one hierarchy can serve several solves at once as long
+    // as each uses its own workspace.
+    class AMGHierarchy
+    {
+    public:
+        AMGHierarchy();
+        ~AMGHierarchy();
+
+        AMGHierarchy(AMGHierarchy&&) noexcept;
+        AMGHierarchy& operator=(AMGHierarchy&&) noexcept;
+
+        AMGHierarchy(const AMGHierarchy&) = delete;
+        AMGHierarchy& operator=(const AMGHierarchy&) = delete;
+
+        // Fails with InvalidInput for a malformed or non-square matrix and
+        // NonSPD for a non-positive diagonal entry.
+        [[nodiscard]] AMGDiagnostics build(const SparseMatrix& matrix, const AMGParams& params = {});
+
+        // z = B r for the V-cycle approximation B of the inverse. Both spans
+        // must hold at least rows() entries. Copies r to z unless build()
+        // succeeded. The two-argument form uses a temporary workspace; pass
+        // one to reuse its storage across calls.
+        void apply(std::span<const double> r, std::span<double> z) const;
+        void apply(std::span<const double> r, std::span<double> z, AMGWorkspace& workspace) const;
+
+        [[nodiscard]] std::size_t rows() const noexcept { return Dimension_; }
+        [[nodiscard]] const AMGDiagnostics& diagnostics() const noexcept;
+
+    private:
+        std::unique_ptr<Detail::AMGHierarchyImpl> Impl_;
+        AMGDiagnostics Diagnostics_{};
+        std::size_t Dimension_{0};
+    };
+
     struct CGParams
     {
         std::size_t MaxIterations{1000};
         double Tolerance{1e-8};
+
+        // None, Diagonal (Jacobi) or AMG. IncompleteLUT is not symmetric and
+        // is rejected as InvalidInput.
+        SparsePreconditioner Preconditioner{SparsePreconditioner::Diagonal};
+
+        // With Preconditioner == AMG: a prebuilt hierarchy to reuse. It must
+        // have as many rows as the system; for the shifted solvers it should
+        // be built from the combined operator alpha*M + beta*A. When null, a
+        // hierarchy is built for the system with the AMG settings below.
+        const AMGHierarchy* Hierarchy{nullptr};
+        AMGParams AMG{};
     };
 
     struct SparseBiCGSTABParams
@@ -188,6 +396,7 @@ export namespace Geometry::Sparse
         double RelativeResidual{0.0};
         bool Converged{false};
         CGConvergenceReason Reason{CGConvergenceReason::NotRun};
+        SparsePreconditioner Preconditioner{SparsePreconditioner::Diagonal};
     };
 
     using EigenDenseMatrixXd = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>;
@@ -310,3 +519,12 @@ export namespace Geometry::Sparse
         std::span<double> x,
         const CGParams& params = {});
 }
+
+namespace Geometry::Sparse
+{
+    // Defined for these value types in Geometry.Sparse.cpp.
+    extern template class CompactSparseMatrix<double>;
+    extern template class CompactSparseMatrix<float>;
+    extern template CompactSparseBuildResult<double> MakeCompact<double>(const SparseMatrix&);
+    extern template CompactSparseBuildResult<float> MakeCompact<float>(const SparseMatrix&);
+}
@@ -1,9 +1,11 @@
 module;
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <optional>
 #include <span>
@@ -23,6 +25,7 @@ import Geometry.Octree;
 import Geometry.Properties;
 import Geometry.Primitives;
 import Geometry.Validation;
+import Extrinsic.Core.Parallel;
 
 namespace Geometry::SurfaceReconstruction
 {
@@ -44,30 +47,13 @@ namespace Geometry::SurfaceReconstruction
     // Signed distance computation
     // =========================================================================
 
-    // Compute signed distance at a query point using the nearest point.
-    // d(g) = dot(g - p_nearest, n_nearest)
-    static float SignedDistanceNearest(
-        const glm::vec3& queryPoint,
-        const Octree& octree,
-        std::span<const glm::vec3> points,
-        std::span<const glm::vec3> normals)
-    {
-        std::size_t nearestIdx = 0;
-        octree.QueryNearest(queryPoint, nearestIdx);
-
-        if (nearestIdx >= points.size())
-            return std::numeric_limits<float>::max();
-
-        glm::vec3 diff = queryPoint - points[nearestIdx];
-        return glm::dot(diff, normals[nearestIdx]);
-    }
-
     // Compute signed distance at a query point using weighted average over
-    // k nearest neighbors.
+    // k nearest neighbors; nearestIdx is the query's nearest point.
     // d(g) = sum(w_i * dot(g - p_i, n_i)) / sum(w_i)
     // where w_i = exp(-||g - p_i||^2 / (2 h^2)) * max(0, dot(n_i, n_ref))^p
     static float SignedDistanceWeighted(
         const glm::vec3& queryPoint,
+        std::size_t nearestIdx,
         const Octree& octree,
         std::span<const glm::vec3> points,
         std::span<const glm::vec3> normals,
@@ -80,11 +66,6 @@ namespace Geometry::SurfaceReconstruction
         if (neighborBuffer.empty())
             return std::numeric_limits<float>::max();
 
-        std::size_t nearestIdx = 0;
-        octree.QueryNearest(queryPoint, nearestIdx);
-        if (nearestIdx >= points.size())
-            return std::numeric_limits<float>::max();
-
         const glm::vec3 refNormal = normals[nearestIdx];
 
         float maxDist2 = 0.0f;
@@ -127,6 +108,216 @@ namespace Geometry::SurfaceReconstruction
         return sumWD / sumW;
     }
 
+    // Signed distance sampler shared by the dense and narrow-band paths.
+    // Const and allocation-free apart from the caller's neighbour buffer, so
+    // one sampler may be evaluated concurrently with per-thread buffers.
+    struct DistanceSampler
+    {
+        const Octree& Tree;
+        std::span<const glm::vec3> Points;
+        std::span<const glm::vec3> Normals;
+        const ReconstructionParams& Params;
+        bool UseWeighted{false};
+        std::size_t EffectiveK{1};
+
+        // Nearest point: d(g) = dot(g - p_nearest, n_nearest). Weighted:
+        // SignedDistanceWeighted(). nearestDistance2 receives the squared
+        // distance to the nearest point (float max if there is none).
+        [[nodiscard]] float Evaluate(
+            const glm::vec3& queryPoint,
+            std::vector<std::size_t>& neighborBuffer,
+            float& nearestDistance2) const
+        {
+            nearestDistance2 = std::numeric_limits<float>::max();
+
+            std::size_t nearestIdx = 0;
+            Tree.QueryNearest(queryPoint, nearestIdx);
+            if (nearestIdx >= Points.size())
+                return std::numeric_limits<float>::max();
+
+            const glm::vec3 diff = queryPoint - Points[nearestIdx];
+            nearestDistance2 = glm::dot(diff, diff);
+
+            if (!UseWeighted)
+                return glm::dot(diff, Normals[nearestIdx]);
+
+            return SignedDistanceWeighted(
+                queryPoint, nearestIdx, Tree, Points, Normals,
+                EffectiveK, Params, neighborBuffer);
+        }
+    };
+
+    // =========================================================================
+    // Scalar field + isosurface extraction
+    // =========================================================================
+
+    static std::optional<MarchingCubes::MarchingCubesResult> ExtractDense(
+        const Grid::GridDimensions& dims,
+        const DistanceSampler& sampler,
+        const MarchingCubes::MarchingCubesParams& mcParams,
+        ReconstructionResult& stats)
+    {
+        Grid::DenseGrid grid(dims);
+        auto scalar = grid.AddProperty<float>("scalar", 0.0f);
+
+        std::vector<std::size_t> neighborBuffer;
+        float nearestDistance2 = 0.0f;
+
+        for (std::size_t z = 0; z <= dims.NZ; ++z)
+        {
+            for (std::size_t y = 0; y <= dims.NY; ++y)
+            {
+                for (std::size_t x = 0; x <= dims.NX; ++x)
+                {
+                    const glm::vec3 gp = grid.WorldPosition(x, y, z);
+                    grid.Set(scalar, x, y, z, sampler.Evaluate(gp, neighborBuffer, nearestDistance2));
+                }
+            }
+        }
+
+        stats.AllocatedBlockCount = 1;
+        stats.AllocatedVertexCount = dims.VertexCount();
+        stats.EvaluatedVertexCount = dims.VertexCount();
+
+        return MarchingCubes::Extract(grid, mcParams, "scalar");
+    }
+
+    static std::optional<MarchingCubes::MarchingCubesResult> ExtractNarrowBand(
+        const Grid::GridDimensions& dims,
+        std::size_t bandCells,
+        const DistanceSampler& sampler,
+        const MarchingCubes::MarchingCubesParams& mcParams,
+        ReconstructionResult& stats)
+    {
+        namespace Parallel = Extrinsic::Core::Parallel;
+        using Grid::SparseGrid;
+
+        SparseGrid grid(dims);
+        const float cellSize = dims.Spacing.x;
+
+        // Blocks of a fresh grid are numbered in allocation order (base =
+        // index * BlockVolume). Each keeps its origin and a bitmask of the
+        // vertices some point's band box reaches; only those are evaluated.
+        struct BandBlock
+        {
+            std::size_t OX{0};
+            std::size_t OY{0};
+            std::size_t OZ{0};
+            std::array<std::uint64_t, SparseGrid::BlockVolume / 64> Mask{};
+        };
+        std::vector<BandBlock> blocks;
+
+        // A point in cell c reaches vertices [c - band, c + 1 + band] on each
+        // axis. Consecutive points usually share a cell, so repeats are
+        // skipped.
+        constexpr std::uint64_t kNoCell = std::numeric_limits<std::uint64_t>::max();
+        std::uint64_t lastCell = kNoCell;
+        const std::array<std::size_t, 3> cellCounts{dims.NX, dims.NY, dims.NZ};
+        for (const glm::vec3& p : sampler.Points)
+        {
+            const glm::vec3 local = (p - dims.Origin) / cellSize;
+            std::array<std::size_t, 3> cell{};
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float c = std::floor(local[axis]);
+                const auto maxCell = static_cast<float>(cellCounts[static_cast<std::size_t>(axis)] - 1);
+                cell[static_cast<std::size_t>(axis)] = static_cast<std::size_t>(std::clamp(c, 0.0f, maxCell));
+            }
+
+            const std::uint64_t key = (static_cast<std::uint64_t>(cell[2]) << 42)
+                | (static_cast<std::uint64_t>(cell[1]) << 21)
+                | static_cast<std::uint64_t>(cell[0]);
+            if (key == lastCell)
+                continue;
+            lastCell = key;
+
+            std::array<std::size_t, 3> lo{};
+            std::array<std::size_t, 3> hi{};
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                lo[axis] = cell[axis] > bandCells ? cell[axis] - bandCells : 0;
+                hi[axis] = std::min(cell[axis] + 1 + bandCells, cellCounts[axis]);
+            }
+
+            for (std::size_t bz = lo[2] >> SparseGrid::BlockBits; bz <= hi[2] >> SparseGrid::BlockBits; ++bz)
+                for (std::size_t by = lo[1] >> SparseGrid::BlockBits; by <= hi[1] >> SparseGrid::BlockBits; ++by)
+                    for (std::size_t bx = lo[0] >> SparseGrid::BlockBits; bx <= hi[0] >> SparseGrid::BlockBits; ++bx)
+                    {
+                        const std::size_t index = grid.TouchBlock(bx, by, bz) / SparseGrid::BlockVolume;
+                        if (index == blocks.size())
+                        {
+                            blocks.push_back({bx * SparseGrid::BlockSize, by * SparseGrid::BlockSize,
+                                              bz * SparseGrid::BlockSize, {}});
+                        }
+
+                        BandBlock& block = blocks[index];
+                        const std::size_t x0 = std::max(lo[0], block.OX) - block.OX;
+                        const std::size_t y0 = std::max(lo[1], block.OY) - block.OY;
+                        const std::size_t z0 = std::max(lo[2], block.OZ) - block.OZ;
+                        const std::size_t x1 = std::min(hi[0], block.OX + SparseGrid::BlockMask) - block.OX;
+                        const std::size_t y1 = std::min(hi[1], block.OY + SparseGrid::BlockMask) - block.OY;
+                        const std::size_t z1 = std::min(hi[2], block.OZ + SparseGrid::BlockMask) - block.OZ;
+                        for (std::size_t lz = z0; lz <= z1; ++lz)
+                            for (std::size_t ly = y0; ly <= y1; ++ly)
+                                for (std::size_t lx = x0; lx <= x1; ++lx)
+                                {
+                                    const std::size_t bit = (lz * SparseGrid::BlockSize + ly) * SparseGrid::BlockSize + lx;
+                                    block.Mask[bit >> 6] |= std::uint64_t{1} << (bit & 63u);
+                                }
+                    }
+        }
+
+        // Blocks are allocated before the property exists, so allocation
+        // only grows the element count; the property is sized once here.
+        auto scalar = grid.AddProperty<float>("scalar", std::numeric_limits<float>::quiet_NaN());
+
+        // Vertices beyond the band keep NaN so Marching Cubes skips their
+        // cells. Each block writes only its own slots.
+        const float band = static_cast<float>(bandCells) * cellSize;
+        const float band2 = band * band;
+        float* values = scalar.Vector().data();
+        std::vector<std::size_t> evaluated(blocks.size(), 0u);
+
+        Parallel::ParallelFor(Parallel::IndexRange{0u, blocks.size()}, Parallel::AutoGrain,
+            [&](const Parallel::IndexRange chunk)
+        {
+            std::vector<std::size_t> neighborBuffer;
+            for (std::size_t b = chunk.Begin; b < chunk.End; ++b)
+            {
+                const BandBlock& block = blocks[b];
+                std::size_t count = 0;
+                for (std::size_t bit = 0; bit < SparseGrid::BlockVolume; ++bit)
+                {
+                    if ((block.Mask[bit >> 6] & (std::uint64_t{1} << (bit & 63u))) == 0)
+                        continue;
+
+                    const std::size_t lx = bit & SparseGrid::BlockMask;
+                    const std::size_t ly = (bit >> SparseGrid::BlockBits) & SparseGrid::BlockMask;
+                    const std::size_t lz = bit >> (2 * SparseGrid::BlockBits);
+
+                    float nearestDistance2 = 0.0f;
+                    const float sd = sampler.Evaluate(
+                        dims.WorldPosition(block.OX + lx, block.OY + ly, block.OZ + lz),
+                        neighborBuffer, nearestDistance2);
+                    if (nearestDistance2 > band2)
+                        continue;
+
+                    values[b * SparseGrid::BlockVolume + bit] = sd;
+                    ++count;
+                }
+                evaluated[b] = count;
+            }
+        });
+
+        stats.AllocatedBlockCount = grid.AllocatedBlockCount();
+        stats.AllocatedVertexCount = grid.AllocatedVertexCount();
+        stats.EvaluatedVertexCount = 0;
+        for (const std::size_t count : evaluated)
+            stats.EvaluatedVertexCount += count;
+
+        return MarchingCubes::Extract(grid, mcParams, "scalar");
+    }
+
     // =========================================================================
     // Main reconstruction
     // =========================================================================
@@ -146,6 +337,9 @@ namespace Geometry::SurfaceReconstruction
         if (normals.empty() && !params.EstimateNormals)
             return std::nullopt;
 
+        if (params.Grid == GridMode::SparseNarrowBand && params.NarrowBandCells == 0)
+            return std::nullopt;
+
         const std::size_t n = points.size();
 
         // -----------------------------------------------------------------
@@ -261,6 +455,7 @@ namespace Geometry::SurfaceReconstruction
 
         // -----------------------------------------------------------------
         // Step 5: Compute signed distance field on the grid
+        // Step 6: Extract isosurface via Marching Cubes
         // -----------------------------------------------------------------
         Grid::GridDimensions dims;
         dims.NX = gridNX;
@@ -269,47 +464,22 @@ namespace Geometry::SurfaceReconstruction
         dims.Origin = bbMin;
         dims.Spacing = spacing;
 
-        Grid::DenseGrid grid(dims);
-        auto scalar = grid.AddProperty<float>("scalar", 0.0f);
-
-        const bool useWeighted = (params.KNeighbors > 1);
-        const std::size_t effectiveK = std::min(params.KNeighbors, usedPoints.size());
-        std::vector<std::size_t> neighborBuffer;
-
-        for (std::size_t z = 0; z <= gridNZ; ++z)
-        {
-            for (std::size_t y = 0; y <= gridNY; ++y)
-            {
-                for (std::size_t x = 0; x <= gridNX; ++x)
-                {
-                    glm::vec3 gp = grid.WorldPosition(x, y, z);
-
-                    float sd;
-                    if (useWeighted)
-                    {
-                        sd = SignedDistanceWeighted(
-                            gp, octree, usedPoints, usedNormals,
-                            effectiveK, params, neighborBuffer);
-                    }
-                    else
-                    {
-                        sd = SignedDistanceNearest(
-                            gp, octree, usedPoints, usedNormals);
-                    }
-
-                    grid.Set(scalar, x, y, z, sd);
-                }
-            }
-        }
+        const DistanceSampler sampler{
+            .Tree = octree,
+            .Points = usedPoints,
+            .Normals = usedNormals,
+            .Params = params,
+            .UseWeighted = params.KNeighbors > 1,
+            .EffectiveK = std::min(params.KNeighbors, usedPoints.size())};
 
-        // -----------------------------------------------------------------
-        // Step 6: Extract isosurface via Marching Cubes
-        // -----------------------------------------------------------------
         MarchingCubes::MarchingCubesParams mcParams;
         mcParams.Isovalue = 0.0f;
         mcParams.ComputeNormals = true;
 
-        auto mcResult = MarchingCubes::Extract(grid, mcParams, "scalar");
+        ReconstructionResult result;
+        auto mcResult = params.Grid == GridMode::SparseNarrowBand
+            ? ExtractNarrowBand(dims, params.NarrowBandCells, sampler, mcParams, result)
+            : ExtractDense(dims, sampler, mcParams, result);
         if (!mcResult.has_value())
             return std::nullopt;
 
@@ -320,7 +490,6 @@ namespace Geometry::SurfaceReconstruction
         if (!meshOpt.has_value())
             return std::nullopt;
 
-        ReconstructionResult result;
         result.OutputMesh = std::move(*meshOpt);
         result.OutputVertexCount = result.OutputMesh.VertexCount();
         result.OutputFaceCount = result.OutputMesh.FaceCount();
@@ -1,6 +1,7 @@
 module;
 
 #include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <span>
 
@@ -33,6 +34,16 @@ export namespace Geometry::SurfaceReconstruction
     //   5. Extract the zero-level-set isosurface via Marching Cubes.
     //   6. Convert the triangle soup to a halfedge mesh.
     //
+    // GridMode::SparseNarrowBand replaces the dense grid of steps 3-5 with a
+    // Grid::SparseGrid: only the 8^3-vertex blocks that reach within
+    // NarrowBandCells cells of an input point are allocated, only vertices
+    // that close to a point's cell are evaluated, vertices farther than
+    // NarrowBandCells cells from every point are left NaN, and
+    // Marching Cubes runs over the allocated blocks with a shared
+    // edge-vertex map. Memory and time then scale with the surface area
+    // instead of Resolution^3, and the spurious far-field zero crossings of
+    // the nearest-plane distance are never meshed.
+    //
     // References:
     //   - Hoppe, DeRose, Duchamp, McDonald, Stuetzle, "Surface Reconstruction
     //     from Unorganized Points", SIGGRAPH 1992.
@@ -42,13 +53,29 @@ export namespace Geometry::SurfaceReconstruction
     // Parameters
     // -------------------------------------------------------------------------
 
+    enum class GridMode : std::uint8_t
+    {
+        Dense = 0,
+        SparseNarrowBand
+    };
+
     struct ReconstructionParams
     {
         // Grid resolution: number of cells along the longest bounding box axis.
         // Higher values produce finer detail but consume more memory and time.
-        // Memory: O(Resolution^3). Time: O(Resolution^3 * KNeighbors).
+        // Dense memory: O(Resolution^3). Time: O(Resolution^3 * KNeighbors).
+        // SparseNarrowBand memory and time: O(Resolution^2) for a surface.
         std::size_t Resolution{64};
 
+        // Storage for the signed distance field; see the header comment.
+        GridMode Grid{GridMode::Dense};
+
+        // SparseNarrowBand: half-width of the evaluated band, in cells, around
+        // the cell containing each input point. Must be at least 1, and
+        // should exceed the point spacing in cells, or cells the surface
+        // crosses between samples are left open.
+        std::size_t NarrowBandCells{2};
+
         // Number of nearest neighbors for signed distance computation.
         // k=1 uses only the nearest point (fast, may be noisy).
         // k>1 uses weighted averaging over neighbors (smoother).
@@ -99,6 +126,14 @@ export namespace Geometry::SurfaceReconstruction
         std::size_t GridNX{0};
         std::size_t GridNY{0};
         std::size_t GridNZ{0};
+
+        // Scalar-field storage actually used. Dense mode reports one block
+        // covering the grid and every grid vertex as allocated and evaluated.
+        // EvaluatedVertexCount counts vertices holding a finite distance;
+        // in sparse mode the remaining allocated vertices are NaN.
+        std::size_t AllocatedBlockCount{0};
+        std::size_t AllocatedVertexCount{0};
+        std::size_t EvaluatedVertexCount{0};
     };
 
     // -------------------------------------------------------------------------
@@ -117,6 +152,7 @@ export namespace Geometry::SurfaceReconstruction
     //   - normals is non-empty but size doesn't match points
     //   - normals is empty and EstimateNormals is false
     //   - Normal estimation fails
+    //   - Grid is SparseNarrowBand and NarrowBandCells is 0
     //   - The isosurface is empty (no geometry extracted)
     [[nodiscard]] std::optional<ReconstructionResult> Reconstruct(
         std::span<const glm::vec3> points,
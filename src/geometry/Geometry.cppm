@@ -29,6 +29,7 @@ export import Geometry.HalfedgeMesh.Vertices.Normals;
 export import Geometry.SpatialQueries;
 export import Geometry.Octree;
 export import Geometry.KDTree;
+export import Geometry.PointKDTree;
 export import Geometry.BVH;
 export import Geometry.Raycast;
 export import Geometry.Overlap;
@@ -54,6 +55,7 @@ export import Geometry.DEC;
 export import Geometry.Curvature;
 export import Geometry.Smoothing;
 export import Geometry.Simplification;
+export import Geometry.Simplification.Streaming;
 export import Geometry.SignedHeatMethod;
 export import Geometry.Subdivision;
 export import Geometry.HalfedgeMesh.SubdivisionSqrt3;
@@ -1230,6 +1230,8 @@ namespace Extrinsic::Graphics
         ResourceCount = other.ResourceCount;
         TransientTextureCount = other.TransientTextureCount;
         TransientBufferCount = other.TransientBufferCount;
+        TransientTextureHeapCount = other.TransientTextureHeapCount;
+        TransientBufferHeapCount = other.TransientBufferHeapCount;
         EdgeCount = other.EdgeCount;
         QueueHandoffEdgeCount = other.QueueHandoffEdgeCount;
         CrossQueueTimelineEdgeCount = other.CrossQueueTimelineEdgeCount;
@@ -1239,6 +1241,8 @@ namespace Extrinsic::Graphics
         TransientPlacedPeakMemoryEstimateBytes = other.TransientPlacedPeakMemoryEstimateBytes;
         TopologicalOrder = other.TopologicalOrder;
         TopologicalLayerByPass = other.TopologicalLayerByPass;
+        PassSuccessorOffsets = other.PassSuccessorOffsets;
+        PassSuccessors = other.PassSuccessors;
         PassNames = other.PassNames;
         PassIds = other.PassIds;
         PassQueues = other.PassQueues;
@@ -1285,6 +1289,8 @@ namespace Extrinsic::Graphics
         ResourceCount = other.ResourceCount;
         TransientTextureCount = other.TransientTextureCount;
         TransientBufferCount = other.TransientBufferCount;
+        TransientTextureHeapCount = other.TransientTextureHeapCount;
+        TransientBufferHeapCount = other.TransientBufferHeapCount;
         EdgeCount = other.EdgeCount;
         QueueHandoffEdgeCount = other.QueueHandoffEdgeCount;
         CrossQueueTimelineEdgeCount = other.CrossQueueTimelineEdgeCount;
@@ -1294,6 +1300,8 @@ namespace Extrinsic::Graphics
         TransientPlacedPeakMemoryEstimateBytes = other.TransientPlacedPeakMemoryEstimateBytes;
         TopologicalOrder = std::move(other.TopologicalOrder);
         TopologicalLayerByPass = std::move(other.TopologicalLayerByPass);
+        PassSuccessorOffsets = std::move(other.PassSuccessorOffsets);
+        PassSuccessors = std::move(other.PassSuccessors);
         PassNames = std::move(other.PassNames);
         PassIds = std::move(other.PassIds);
         PassQueues = std::move(other.PassQueues);
@@ -1649,6 +1657,7 @@ namespace Extrinsic::Graphics
             CompiledRenderGraph compiled{};
             compiled.PassCount = passCount;
             compiled.ResourceCount = resourceCount;
+            compiled.PassSuccessorOffsets.assign(1u, 0u);
             compiled.TextureNames.resize(textures.size());
             compiled.BufferNames.resize(buffers.size());
             compiled.TextureResourceIds.resize(textures.size());
@@ -2165,8 +2174,11 @@ namespace Extrinsic::Graphics
             executionRankByPass);
 
         std::uint32_t activeEdgeCount = 0;
+        std::vector<std::uint32_t> passSuccessorOffsets(static_cast<std::size_t>(passCount) + 1u, 0u);
+        std::vector<std::uint32_t> passSuccessors{};
         for (std::uint32_t from = 0; from < passCount; ++from)
         {
+            passSuccessorOffsets[from] = static_cast<std::uint32_t>(passSuccessors.size());
             if (!live[from])
             {
                 continue;
@@ -2175,10 +2187,13 @@ namespace Extrinsic::Graphics
             {
                 if (live[to])
                 {
+                    passSuccessors.push_back(to);
                     ++activeEdgeCount;
                 }
             }
+            std::ranges::sort(passSuccessors.begin() + passSuccessorOffsets[from], passSuccessors.end());
         }
+        passSuccessorOffsets[passCount] = static_cast<std::uint32_t>(passSuccessors.size());
 
         std::uint32_t activeQueueHandoffEdgeCount = 0;
         auto& activeQueueHandoffDedup = scratch.ActiveQueueHandoffDedup;
@@ -2425,6 +2440,8 @@ namespace Extrinsic::Graphics
         compiled.CrossQueueOwnershipTransferCount = crossQueueOwnershipTransferCount;
         compiled.TopologicalOrder = std::move(order);
         compiled.TopologicalLayerByPass = std::move(layerByPass);
+        compiled.PassSuccessorOffsets = std::move(passSuccessorOffsets);
+        compiled.PassSuccessors = std::move(passSuccessors);
         compiled.PassNames = std::move(passNames);
         compiled.PassIds = std::move(passIds);
         compiled.PassQueues = std::move(passQueues);
@@ -2557,7 +2574,9 @@ namespace Extrinsic::Graphics
             << " cross_queue_ownership_transfers=" << compiled.CrossQueueOwnershipTransferCount
             << " barrier_packet_count=" << compiled.BarrierPackets.size()
             << " transient_naive_memory_bytes=" << compiled.TransientNaiveMemoryEstimateBytes
-            << " transient_placed_peak_memory_bytes=" << compiled.TransientPlacedPeakMemoryEstimateBytes << '\n';
+            << " transient_placed_peak_memory_bytes=" << compiled.TransientPlacedPeakMemoryEstimateBytes
+            << " transient_texture_heaps=" << compiled.TransientTextureHeapCount
+            << " transient_buffer_heaps=" << compiled.TransientBufferHeapCount << '\n';
 
         out << "  passes:\n";
         for (std::size_t orderIndex = 0; orderIndex < compiled.TopologicalOrder.size(); ++orderIndex)
@@ -2723,6 +2742,7 @@ namespace Extrinsic::Graphics
                     out << " name=\"" << compiled.TextureNames[placement.ResourceIndex] << '"';
                 }
                 out << " block=" << placement.BlockIndex
+                    << " heap=" << placement.HeapIndex
                     << " offset_bytes=" << placement.OffsetBytes
                     << " size_bytes=" << placement.SizeBytes
                     << " alignment_bytes=" << placement.AlignmentBytes
@@ -2747,6 +2767,7 @@ namespace Extrinsic::Graphics
                     out << " name=\"" << compiled.BufferNames[placement.ResourceIndex] << '"';
                 }
                 out << " block=" << placement.BlockIndex
+                    << " heap=" << placement.HeapIndex
                     << " offset_bytes=" << placement.OffsetBytes
                     << " size_bytes=" << placement.SizeBytes
                     << " alignment_bytes=" << placement.AlignmentBytes
@@ -144,6 +144,9 @@ namespace Extrinsic::Graphics
     {
         std::uint32_t ResourceIndex = 0;
         std::uint32_t BlockIndex = 0;
+        // Heap inside the block; resources sharing a heap sit at offsets
+        // within its byte range and alias only where lifetimes are disjoint.
+        std::uint32_t HeapIndex = 0;
         std::uint64_t OffsetBytes = 0;
         std::uint64_t SizeBytes = 0;
         std::uint64_t AlignmentBytes = 1;
@@ -192,6 +195,8 @@ namespace Extrinsic::Graphics
         std::uint32_t ResourceCount = 0;
         std::uint32_t TransientTextureCount = 0;
         std::uint32_t TransientBufferCount = 0;
+        std::uint32_t TransientTextureHeapCount = 0;
+        std::uint32_t TransientBufferHeapCount = 0;
         std::uint32_t EdgeCount = 0;
         std::uint32_t QueueHandoffEdgeCount = 0;
         std::uint32_t CrossQueueTimelineEdgeCount = 0;
@@ -201,6 +206,11 @@ namespace Extrinsic::Graphics
         std::uint64_t TransientPlacedPeakMemoryEstimateBytes = 0;
         std::vector<std::uint32_t> TopologicalOrder{};
         std::vector<std::uint32_t> TopologicalLayerByPass{};
+        // Live dependency edges in CSR form, indexed by pass index: the
+        // successors of pass p are PassSuccessors[PassSuccessorOffsets[p],
+        // PassSuccessorOffsets[p + 1]). Culled passes have empty ranges.
+        std::vector<std::uint32_t> PassSuccessorOffsets{};
+        std::vector<std::uint32_t> PassSuccessors{};
         std::vector<std::string> PassNames{};
         std::vector<FramePassId> PassIds{};
         std::vector<RenderQueue> PassQueues{};
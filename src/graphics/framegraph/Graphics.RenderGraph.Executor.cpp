@@ -5,7 +5,6 @@ module;
 #include <cstdint>
 #include <cstddef>
 #include <limits>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -53,33 +52,85 @@ namespace Extrinsic::Graphics
             return Core::Ok();
         }
 
-        [[nodiscard]] Core::Expected<std::vector<std::vector<std::uint32_t>>> BuildParallelRecordLayers(
+        struct ParallelRecordSchedule
+        {
+            std::vector<std::uint32_t> PredecessorCountByPass{};
+            std::uint32_t LayerCount = 0u;
+            std::uint32_t MaxLayerWidth = 0u;
+            std::uint32_t RootPassCount = 0u;
+        };
+
+        // Derives per-pass predecessor counts from the compiled successor CSR.
+        // Every live edge must point from a scheduled pass to a scheduled pass
+        // in a strictly later topological layer, so releasing successors as
+        // their counts reach zero always drains the whole graph.
+        [[nodiscard]] Core::Expected<ParallelRecordSchedule> BuildParallelRecordSchedule(
             const CompiledRenderGraph& graph)
         {
-            std::uint32_t maxLayer = 0u;
-            bool hasPass = false;
+            const std::size_t passCount = graph.PassDeclarations.size();
+            if (graph.PassSuccessorOffsets.size() != passCount + 1u ||
+                graph.PassSuccessorOffsets.back() != graph.PassSuccessors.size())
+            {
+                return Core::Err<ParallelRecordSchedule>(Core::ErrorCode::InvalidState);
+            }
+
+            std::vector<bool> scheduled(passCount, false);
             for (const std::uint32_t passIndex : graph.TopologicalOrder)
             {
                 if (passIndex >= graph.TopologicalLayerByPass.size())
                 {
-                    return Core::Err<std::vector<std::vector<std::uint32_t>>>(Core::ErrorCode::OutOfRange);
+                    return Core::Err<ParallelRecordSchedule>(Core::ErrorCode::OutOfRange);
                 }
-                maxLayer = std::max(maxLayer, graph.TopologicalLayerByPass[passIndex]);
-                hasPass = true;
+                scheduled[passIndex] = true;
             }
 
-            std::vector<std::vector<std::uint32_t>> layers{};
-            if (hasPass)
+            ParallelRecordSchedule schedule{};
+            schedule.PredecessorCountByPass.assign(passCount, 0u);
+            std::vector<std::uint32_t> layerWidths{};
+            for (const std::uint32_t passIndex : graph.TopologicalOrder)
             {
-                layers.resize(static_cast<std::size_t>(maxLayer) + 1u);
+                const std::uint32_t layer = graph.TopologicalLayerByPass[passIndex];
+                if (layer >= layerWidths.size())
+                {
+                    layerWidths.resize(static_cast<std::size_t>(layer) + 1u, 0u);
+                }
+                ++layerWidths[layer];
+
+                const std::uint32_t begin = graph.PassSuccessorOffsets[passIndex];
+                const std::uint32_t end = graph.PassSuccessorOffsets[passIndex + 1u];
+                if (begin > end || end > graph.PassSuccessors.size())
+                {
+                    return Core::Err<ParallelRecordSchedule>(Core::ErrorCode::InvalidState);
+                }
+                for (std::uint32_t edge = begin; edge < end; ++edge)
+                {
+                    const std::uint32_t successor = graph.PassSuccessors[edge];
+                    if (successor >= passCount || !scheduled[successor])
+                    {
+                        return Core::Err<ParallelRecordSchedule>(Core::ErrorCode::OutOfRange);
+                    }
+                    if (graph.TopologicalLayerByPass[successor] <= layer)
+                    {
+                        return Core::Err<ParallelRecordSchedule>(Core::ErrorCode::InvalidState);
+                    }
+                    ++schedule.PredecessorCountByPass[successor];
+                }
             }
 
+            schedule.LayerCount = static_cast<std::uint32_t>(layerWidths.size());
+            for (const std::uint32_t width : layerWidths)
+            {
+                schedule.MaxLayerWidth = std::max(schedule.MaxLayerWidth, width);
+            }
             for (const std::uint32_t passIndex : graph.TopologicalOrder)
             {
-                layers[graph.TopologicalLayerByPass[passIndex]].push_back(passIndex);
+                if (schedule.PredecessorCountByPass[passIndex] == 0u)
+                {
+                    ++schedule.RootPassCount;
+                }
             }
 
-            return layers;
+            return schedule;
         }
 
         [[nodiscard]] Core::Result EmitBarriersForPass(const CompiledRenderGraph& graph,
@@ -100,23 +151,137 @@ namespace Extrinsic::Graphics
             return Core::Ok();
         }
 
-        struct SignalCounterOnExit
+        constexpr std::uint32_t kNoReadyPass = std::numeric_limits<std::uint32_t>::max();
+
+        // Shared state for one dependency-driven record submission. It lives
+        // on the joining thread's stack; Done counts every scheduled pass, and
+        // each task signals it only after releasing its successors, so the
+        // state outlives every task that can still reference it.
+        struct ParallelRecordState
+        {
+            const CompiledRenderGraph& Graph;
+            const RenderGraphExecutor::ParallelRecordObserver& OnRecord;
+            std::vector<std::atomic<std::uint32_t>> PendingPredecessors;
+            std::vector<std::atomic<bool>> SkipRecord;
+            Core::Tasks::CounterEvent Done;
+            std::atomic<std::uint32_t> FirstError{0u};
+
+            ParallelRecordState(const CompiledRenderGraph& graph,
+                                const RenderGraphExecutor::ParallelRecordObserver& onRecord,
+                                const std::vector<std::uint32_t>& predecessorCountByPass)
+                : Graph(graph)
+                , OnRecord(onRecord)
+                , PendingPredecessors(predecessorCountByPass.size())
+                , SkipRecord(predecessorCountByPass.size())
+                , Done(static_cast<std::uint32_t>(graph.TopologicalOrder.size()))
+            {
+                for (std::size_t passIndex = 0u; passIndex < predecessorCountByPass.size(); ++passIndex)
+                {
+                    PendingPredecessors[passIndex].store(predecessorCountByPass[passIndex],
+                                                         std::memory_order_relaxed);
+                    SkipRecord[passIndex].store(false, std::memory_order_relaxed);
+                }
+            }
+
+            ParallelRecordState(const ParallelRecordState&) = delete;
+            ParallelRecordState& operator=(const ParallelRecordState&) = delete;
+        };
+
+        // Records one pass, then releases its successors. A failed or skipped
+        // pass marks its successors skipped so dependents of a failed record
+        // are joined without being recorded. Returns one newly ready successor
+        // for the calling task to continue with; the rest are dispatched.
+        [[nodiscard]] std::uint32_t RecordPassAndReleaseSuccessors(ParallelRecordState& state,
+                                                                   std::uint32_t passIndex);
+
+        void DispatchParallelRecord(ParallelRecordState& state, const std::uint32_t passIndex)
         {
-            Core::Tasks::CounterEvent& Counter;
+            Core::Tasks::Scheduler::Dispatch([&state, passIndex]()
+            {
+                std::uint32_t next = passIndex;
+                while (next != kNoReadyPass)
+                {
+                    const std::uint32_t current = next;
+                    next = RecordPassAndReleaseSuccessors(state, current);
+                    state.Done.Signal();
+                }
+            });
+        }
 
-            explicit SignalCounterOnExit(Core::Tasks::CounterEvent& counter)
-                : Counter(counter)
+        std::uint32_t RecordPassAndReleaseSuccessors(ParallelRecordState& state, const std::uint32_t passIndex)
+        {
+            bool failed = state.SkipRecord[passIndex].load(std::memory_order_relaxed);
+            if (!failed && state.OnRecord)
             {
+                Core::Result recordResult =
+                    state.OnRecord(passIndex, state.Graph.TopologicalLayerByPass[passIndex]);
+                if (!recordResult.has_value())
+                {
+                    std::uint32_t expected = 0u;
+                    (void)state.FirstError.compare_exchange_strong(
+                        expected,
+                        static_cast<std::uint32_t>(recordResult.error()),
+                        std::memory_order_acq_rel,
+                        std::memory_order_acquire);
+                    failed = true;
+                }
             }
 
-            ~SignalCounterOnExit()
+            std::uint32_t continuation = kNoReadyPass;
+            const std::uint32_t begin = state.Graph.PassSuccessorOffsets[passIndex];
+            const std::uint32_t end = state.Graph.PassSuccessorOffsets[passIndex + 1u];
+            for (std::uint32_t edge = begin; edge < end; ++edge)
             {
-                Counter.Signal();
+                const std::uint32_t successor = state.Graph.PassSuccessors[edge];
+                if (failed)
+                {
+                    state.SkipRecord[successor].store(true, std::memory_order_relaxed);
+                }
+                // acq_rel publishes this pass's record (and skip flag) to the
+                // task that observes the count reaching zero.
+                if (state.PendingPredecessors[successor].fetch_sub(1u, std::memory_order_acq_rel) != 1u)
+                {
+                    continue;
+                }
+                if (continuation == kNoReadyPass)
+                {
+                    continuation = successor;
+                }
+                else
+                {
+                    DispatchParallelRecord(state, successor);
+                }
             }
 
-            SignalCounterOnExit(const SignalCounterOnExit&) = delete;
-            SignalCounterOnExit& operator=(const SignalCounterOnExit&) = delete;
-        };
+            return continuation;
+        }
+
+        // Help drain the scheduler instead of spinning: observe progress
+        // before checking for work so a completion between the check and the
+        // wait cannot be missed.
+        [[nodiscard]] std::uint32_t HelpUntilRecorded(Core::Tasks::CounterEvent& done)
+        {
+            std::uint32_t helpedTaskCount = 0u;
+            while (!done.IsReady())
+            {
+                const auto progress = Core::Tasks::Scheduler::ObserveWorkProgress();
+                const std::uint32_t pending = done.PendingCount();
+                if (pending == 0u)
+                {
+                    break;
+                }
+                if (Core::Tasks::Scheduler::TryRunOne())
+                {
+                    ++helpedTaskCount;
+                    continue;
+                }
+                if (!Core::Tasks::Scheduler::WaitForWorkProgress(progress))
+                {
+                    done.WaitForProgress(pending);
+                }
+            }
+            return helpedTaskCount;
+        }
     }
 
     Core::Result ValidateBarrierPacketBounds(const CompiledRenderGraph& graph)
@@ -249,91 +414,70 @@ namespace Extrinsic::Graphics
             return validationResult;
         }
 
-        auto layers = BuildParallelRecordLayers(graph);
-        if (!layers.has_value())
+        auto schedule = BuildParallelRecordSchedule(graph);
+        if (!schedule.has_value())
         {
-            return Core::Err(layers.error());
+            return Core::Err(schedule.error());
         }
 
+        const std::uint32_t scheduledPassCount = static_cast<std::uint32_t>(graph.TopologicalOrder.size());
         if (stats)
         {
-            stats->LayerCount = static_cast<std::uint32_t>(layers->size());
-            for (const std::vector<std::uint32_t>& layer : *layers)
-            {
-                stats->MaxLayerWidth = std::max(stats->MaxLayerWidth,
-                                                static_cast<std::uint32_t>(layer.size()));
-                stats->ScheduledPassCount += static_cast<std::uint32_t>(layer.size());
-            }
+            stats->LayerCount = schedule->LayerCount;
+            stats->MaxLayerWidth = schedule->MaxLayerWidth;
+            stats->ScheduledPassCount = scheduledPassCount;
+            stats->RootPassCount = schedule->RootPassCount;
         }
 
         const std::uint32_t minWorkerPassCount =
             options.MinWorkerPassCount == 0u ? 1u : options.MinWorkerPassCount;
-        const bool schedulerReady = options.UseScheduler && Core::Tasks::Scheduler::IsInitialized();
-        const auto recordOne = [&onRecord](const std::uint32_t passIndex,
-                                           const std::uint32_t layerIndex) -> Core::Result
-        {
-            return onRecord ? onRecord(passIndex, layerIndex) : Core::Ok();
-        };
-
-        for (std::uint32_t layerIndex = 0u; layerIndex < layers->size(); ++layerIndex)
+        const bool useWorkers = options.UseScheduler &&
+                                Core::Tasks::Scheduler::IsInitialized() &&
+                                scheduledPassCount > 0u &&
+                                schedule->MaxLayerWidth >= minWorkerPassCount;
+        if (!useWorkers)
         {
-            const std::vector<std::uint32_t>& layer = (*layers)[layerIndex];
-            if (layer.empty())
+            if (stats)
             {
-                continue;
+                stats->CallerRecordCount = scheduledPassCount;
             }
-
-            const bool useWorkers = schedulerReady &&
-                                    layer.size() >= static_cast<std::size_t>(minWorkerPassCount);
-            if (!useWorkers)
+            for (const std::uint32_t passIndex : graph.TopologicalOrder)
             {
-                if (stats)
+                if (!onRecord)
                 {
-                    stats->CallerRecordCount += static_cast<std::uint32_t>(layer.size());
+                    break;
                 }
-                for (const std::uint32_t passIndex : layer)
+                Core::Result recordResult = onRecord(passIndex, graph.TopologicalLayerByPass[passIndex]);
+                if (!recordResult.has_value())
                 {
-                    Core::Result recordResult = recordOne(passIndex, layerIndex);
-                    if (!recordResult.has_value())
-                    {
-                        return recordResult;
-                    }
+                    return recordResult;
                 }
-                continue;
             }
-
+        }
+        else
+        {
             if (stats)
             {
                 stats->UsedScheduler = true;
-                stats->WorkerTaskCount += static_cast<std::uint32_t>(layer.size());
+                stats->WorkerTaskCount = scheduledPassCount;
             }
 
-            Core::Tasks::CounterEvent done{static_cast<std::uint32_t>(layer.size())};
-            std::atomic<std::uint32_t> firstError{0u};
-            for (const std::uint32_t passIndex : layer)
+            ParallelRecordState state{graph, onRecord, schedule->PredecessorCountByPass};
+            for (const std::uint32_t passIndex : graph.TopologicalOrder)
             {
-                Core::Tasks::Scheduler::Dispatch([passIndex, layerIndex, &done, &firstError, &recordOne]()
+                if (schedule->PredecessorCountByPass[passIndex] == 0u)
                 {
-                    SignalCounterOnExit signalDone{done};
-                    Core::Result recordResult = recordOne(passIndex, layerIndex);
-                    if (!recordResult.has_value())
-                    {
-                        std::uint32_t expected = 0u;
-                        (void)firstError.compare_exchange_strong(
-                            expected,
-                            static_cast<std::uint32_t>(recordResult.error()),
-                            std::memory_order_acq_rel,
-                            std::memory_order_acquire);
-                    }
-                });
+                    DispatchParallelRecord(state, passIndex);
+                }
             }
 
-            while (!done.IsReady())
+            const std::uint32_t helpedTaskCount = HelpUntilRecorded(state.Done);
+            if (stats)
             {
-                std::this_thread::yield();
+                stats->CallerHelpedTaskCount = helpedTaskCount;
             }
 
-            const std::uint32_t errorCode = firstError.load(std::memory_order_acquire);
+            const std::uint32_t errorCode = state.FirstError.load(std::memory_order_acquire);
             if (errorCode != 0u)
             {
                 return Core::Err(static_cast<Core::ErrorCode>(errorCode));
@@ -16,6 +16,9 @@ namespace Extrinsic::Graphics
     export struct ParallelRecordOptions
     {
         bool UseScheduler = true;
+        // Records on scheduler workers only when the widest topological layer
+        // holds at least this many passes; narrower graphs record serially on
+        // the caller thread.
         std::uint32_t MinWorkerPassCount = 2u;
     };
 
@@ -24,8 +27,13 @@ namespace Extrinsic::Graphics
         std::uint32_t LayerCount = 0u;
         std::uint32_t MaxLayerWidth = 0u;
         std::uint32_t ScheduledPassCount = 0u;
+        // Passes without live predecessors, dispatched before the join.
+        std::uint32_t RootPassCount = 0u;
         std::uint32_t WorkerTaskCount = 0u;
         std::uint32_t CallerRecordCount = 0u;
+        // Scheduler tasks the joining thread ran through TryRunOne() while
+        // waiting; may include unrelated work queued on the same scheduler.
+        std::uint32_t CallerHelpedTaskCount = 0u;
         bool UsedScheduler = false;
     };
 
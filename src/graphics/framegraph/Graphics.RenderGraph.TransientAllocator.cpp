@@ -1,7 +1,13 @@
 module;
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 module Extrinsic.Graphics.RenderGraph;
 
@@ -22,6 +28,229 @@ namespace Extrinsic::Graphics
         {
             return a.SizeBytes == b.SizeBytes && a.Usage == b.Usage && a.HostVisible == b.HostVisible;
         }
+
+        [[nodiscard]] constexpr std::uint64_t AlignHeapOffset(const std::uint64_t value,
+                                                              const std::uint64_t alignment) noexcept
+        {
+            if (alignment <= 1u)
+            {
+                return value;
+            }
+            const std::uint64_t remainder = value % alignment;
+            return remainder == 0u ? value : value + (alignment - remainder);
+        }
+
+        // Sweeps requests in lifetime order, placing each at the lowest offset
+        // of a retired range that fits, else in a new heap at the end of the
+        // block. spanAdjacentRanges lets one placement cover several adjacent
+        // retired ranges of the same heap.
+        [[nodiscard]] TransientHeapPlan PackFirstFit(const std::span<const TransientHeapRequest> requests,
+                                                     const std::span<const std::uint32_t> order,
+                                                     const bool aliasingEnabled,
+                                                     const bool spanAdjacentRanges)
+        {
+            struct ActiveRange
+            {
+                std::uint32_t ResourceIndex = 0u;
+                std::uint32_t LastUsePass = 0u;
+                std::uint32_t HeapIndex = 0u;
+                std::uint64_t OffsetBytes = 0u;
+                std::uint64_t SizeBytes = 0u;
+            };
+
+            struct FreeRange
+            {
+                std::uint32_t HeapIndex = 0u;
+                std::uint64_t OffsetBytes = 0u;
+                std::uint64_t SizeBytes = 0u;
+                std::uint32_t PreviousResourceIndex = kInvalidTransientHeapResource;
+            };
+
+            TransientHeapPlan plan{};
+            plan.Assignments.reserve(requests.size());
+
+            std::vector<ActiveRange> activeRanges{};
+            std::vector<FreeRange> freeRanges{};
+            std::uint64_t blockBytes = 0u;
+            for (const std::uint32_t requestIndex : order)
+            {
+                const TransientHeapRequest& request = requests[requestIndex];
+                const std::uint64_t alignmentBytes = std::max<std::uint64_t>(request.AlignmentBytes, 1u);
+                plan.NaiveBytes += request.SizeBytes;
+                plan.BlockAlignmentBytes = std::max(plan.BlockAlignmentBytes, alignmentBytes);
+
+                TransientHeapAssignment assignment{
+                    .ResourceIndex = request.ResourceIndex,
+                    .SizeBytes = request.SizeBytes,
+                    .AlignmentBytes = alignmentBytes,
+                    .FirstUsePass = request.FirstUsePass,
+                    .LastUsePass = request.LastUsePass,
+                };
+                if (request.SizeBytes == 0u)
+                {
+                    // Nothing to back; keep the record so callers see every request.
+                    plan.Assignments.push_back(assignment);
+                    continue;
+                }
+
+                // Retire every range whose occupant is dead before this request starts.
+                std::erase_if(activeRanges, [&](const ActiveRange& active) {
+                    if (active.LastUsePass >= request.FirstUsePass)
+                    {
+                        return false;
+                    }
+                    if (aliasingEnabled)
+                    {
+                        freeRanges.push_back(FreeRange{
+                            .HeapIndex = active.HeapIndex,
+                            .OffsetBytes = active.OffsetBytes,
+                            .SizeBytes = active.SizeBytes,
+                            .PreviousResourceIndex = active.ResourceIndex,
+                        });
+                    }
+                    return true;
+                });
+                std::ranges::sort(freeRanges, [](const FreeRange& lhs, const FreeRange& rhs) {
+                    return std::tie(lhs.OffsetBytes, lhs.SizeBytes, lhs.PreviousResourceIndex) <
+                           std::tie(rhs.OffsetBytes, rhs.SizeBytes, rhs.PreviousResourceIndex);
+                });
+
+                // First fit by offset over runs of adjacent free ranges in one
+                // heap. Ranges are never merged in place, so each keeps the
+                // occupant it came from; the unused head and tail stay free.
+                bool placed = false;
+                for (std::size_t first = 0u; first < freeRanges.size() && !placed; ++first)
+                {
+                    const FreeRange& head = freeRanges[first];
+                    const std::uint64_t alignedOffset = AlignHeapOffset(head.OffsetBytes, alignmentBytes);
+                    if (alignedOffset >= head.OffsetBytes + head.SizeBytes)
+                    {
+                        continue;
+                    }
+
+                    const std::uint64_t allocationEnd = alignedOffset + request.SizeBytes;
+                    std::size_t last = first;
+                    while (spanAdjacentRanges &&
+                           freeRanges[last].OffsetBytes + freeRanges[last].SizeBytes < allocationEnd &&
+                           last + 1u < freeRanges.size() &&
+                           freeRanges[last + 1u].HeapIndex == head.HeapIndex &&
+                           freeRanges[last + 1u].OffsetBytes == freeRanges[last].OffsetBytes + freeRanges[last].SizeBytes)
+                    {
+                        ++last;
+                    }
+                    const FreeRange tail = freeRanges[last];
+                    const std::uint64_t runEnd = tail.OffsetBytes + tail.SizeBytes;
+                    if (runEnd < allocationEnd)
+                    {
+                        continue;
+                    }
+
+                    for (std::size_t covered = first; covered <= last; ++covered)
+                    {
+                        const std::uint32_t previous = freeRanges[covered].PreviousResourceIndex;
+                        const bool alreadyReported = std::ranges::any_of(
+                            freeRanges.begin() + static_cast<std::ptrdiff_t>(first),
+                            freeRanges.begin() + static_cast<std::ptrdiff_t>(covered),
+                            [previous](const FreeRange& range) { return range.PreviousResourceIndex == previous; });
+                        if (!alreadyReported)
+                        {
+                            plan.AliasHazards.push_back(TransientHeapAliasHazard{
+                                .PreviousResourceIndex = previous,
+                                .ResourceIndex = request.ResourceIndex,
+                                .FirstUsePass = request.FirstUsePass,
+                                .HeapIndex = head.HeapIndex,
+                                .OffsetBytes = alignedOffset,
+                                .SizeBytes = request.SizeBytes,
+                            });
+                        }
+                    }
+
+                    const FreeRange headRange = head;
+                    freeRanges.erase(freeRanges.begin() + static_cast<std::ptrdiff_t>(first),
+                                     freeRanges.begin() + static_cast<std::ptrdiff_t>(last + 1u));
+                    if (headRange.OffsetBytes < alignedOffset)
+                    {
+                        freeRanges.push_back(FreeRange{
+                            .HeapIndex = headRange.HeapIndex,
+                            .OffsetBytes = headRange.OffsetBytes,
+                            .SizeBytes = alignedOffset - headRange.OffsetBytes,
+                            .PreviousResourceIndex = headRange.PreviousResourceIndex,
+                        });
+                    }
+                    if (allocationEnd < runEnd)
+                    {
+                        freeRanges.push_back(FreeRange{
+                            .HeapIndex = tail.HeapIndex,
+                            .OffsetBytes = allocationEnd,
+                            .SizeBytes = runEnd - allocationEnd,
+                            .PreviousResourceIndex = tail.PreviousResourceIndex,
+                        });
+                    }
+
+                    assignment.HeapIndex = headRange.HeapIndex;
+                    assignment.OffsetBytes = alignedOffset;
+                    placed = true;
+                }
+
+                if (!placed)
+                {
+                    // No retired range fits: open a heap at the end of the block.
+                    assignment.HeapIndex = static_cast<std::uint32_t>(plan.Heaps.size());
+                    assignment.OffsetBytes = AlignHeapOffset(blockBytes, alignmentBytes);
+                    blockBytes = assignment.OffsetBytes + request.SizeBytes;
+                    plan.Heaps.push_back(TransientHeap{
+                        .OffsetBytes = assignment.OffsetBytes,
+                        .SizeBytes = request.SizeBytes,
+                    });
+                }
+
+                TransientHeap& heap = plan.Heaps[assignment.HeapIndex];
+                heap.AlignmentBytes = std::max(heap.AlignmentBytes, alignmentBytes);
+                ++heap.ResourceCount;
+                activeRanges.push_back(ActiveRange{
+                    .ResourceIndex = request.ResourceIndex,
+                    .LastUsePass = request.LastUsePass,
+                    .HeapIndex = assignment.HeapIndex,
+                    .OffsetBytes = assignment.OffsetBytes,
+                    .SizeBytes = request.SizeBytes,
+                });
+                plan.Assignments.push_back(assignment);
+            }
+            plan.PeakBytes = blockBytes;
+
+            std::ranges::sort(plan.Assignments, [](const TransientHeapAssignment& lhs,
+                                                   const TransientHeapAssignment& rhs) {
+                return lhs.ResourceIndex < rhs.ResourceIndex;
+            });
+            return plan;
+        }
+    }
+
+    TransientHeapPlan PlanTransientHeaps(const std::span<const TransientHeapRequest> requests,
+                                         const bool aliasingEnabled)
+    {
+        std::vector<std::uint32_t> order(requests.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::ranges::sort(order, [requests](const std::uint32_t lhs, const std::uint32_t rhs) {
+            return std::tie(requests[lhs].FirstUsePass, requests[lhs].ResourceIndex) <
+                   std::tie(requests[rhs].FirstUsePass, requests[rhs].ResourceIndex);
+        });
+
+        // Spanning adjacent ranges lets small retired resources be reused by a
+        // larger one, but first fit is not monotone: on some inputs it leaves
+        // worse fragmentation than single-range first fit. Keep whichever
+        // plan has the smaller block; ties keep the single-range plan, which
+        // emits fewer alias hazards.
+        TransientHeapPlan plan = PackFirstFit(requests, order, aliasingEnabled, false);
+        if (aliasingEnabled)
+        {
+            TransientHeapPlan spanning = PackFirstFit(requests, order, aliasingEnabled, true);
+            if (spanning.PeakBytes < plan.PeakBytes)
+            {
+                plan = std::move(spanning);
+            }
+        }
+        return plan;
     }
 
     RHI::TextureHandle TransientAllocator::AcquireTexture(const RHI::TextureDesc& desc)
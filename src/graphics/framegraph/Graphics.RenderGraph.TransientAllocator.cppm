@@ -1,6 +1,8 @@
 module;
 
 #include <cstdint>
+#include <limits>
+#include <span>
 #include <vector>
 
 export module Extrinsic.Graphics.RenderGraph:TransientAllocator;
@@ -10,6 +12,80 @@ import Extrinsic.RHI.Descriptors;
 
 namespace Extrinsic::Graphics
 {
+    export inline constexpr std::uint32_t kInvalidTransientHeapIndex =
+        std::numeric_limits<std::uint32_t>::max();
+    export inline constexpr std::uint32_t kInvalidTransientHeapResource =
+        std::numeric_limits<std::uint32_t>::max();
+
+    // One transient resource to place. Lifetimes are inclusive execution-rank
+    // intervals as reported by the compiler's ResourceLifetime records.
+    export struct TransientHeapRequest
+    {
+        std::uint32_t ResourceIndex = 0;
+        std::uint32_t FirstUsePass = 0;
+        std::uint32_t LastUsePass = 0;
+        std::uint64_t SizeBytes = 0;
+        std::uint64_t AlignmentBytes = 1;
+    };
+
+    export struct TransientHeapAssignment
+    {
+        std::uint32_t ResourceIndex = 0;
+        std::uint32_t HeapIndex = kInvalidTransientHeapIndex;
+        std::uint64_t OffsetBytes = 0;
+        std::uint64_t SizeBytes = 0;
+        std::uint64_t AlignmentBytes = 1;
+        std::uint32_t FirstUsePass = 0;
+        std::uint32_t LastUsePass = 0;
+    };
+
+    // A resource placed over bytes a retired resource used. One hazard is
+    // emitted per previous occupant of the covered range; FirstUsePass is the
+    // execution rank of the new occupant's first use.
+    export struct TransientHeapAliasHazard
+    {
+        std::uint32_t PreviousResourceIndex = kInvalidTransientHeapResource;
+        std::uint32_t ResourceIndex = 0;
+        std::uint32_t FirstUsePass = 0;
+        std::uint32_t HeapIndex = 0;
+        std::uint64_t OffsetBytes = 0;
+        std::uint64_t SizeBytes = 0;
+    };
+
+    export struct TransientHeap
+    {
+        std::uint64_t OffsetBytes = 0;
+        std::uint64_t SizeBytes = 0;
+        std::uint64_t AlignmentBytes = 1;
+        std::uint32_t ResourceCount = 0;
+    };
+
+    // Heaps are laid out back to back so a backend can bind the whole plan
+    // from one memory block per resource domain; PeakBytes is that block size.
+    export struct TransientHeapPlan
+    {
+        std::vector<TransientHeapAssignment> Assignments{};
+        std::vector<TransientHeapAliasHazard> AliasHazards{};
+        std::vector<TransientHeap> Heaps{};
+        std::uint64_t NaiveBytes = 0;
+        std::uint64_t PeakBytes = 0;
+        std::uint64_t BlockAlignmentBytes = 1;
+    };
+
+    // First-fit packing of transient lifetimes: requests are swept in
+    // (FirstUsePass, ResourceIndex) order and each takes the lowest offset in
+    // a retired byte range that fits, splitting the range so the remainder
+    // stays free for other resources, else opens a new heap at the end of the
+    // block. A heap is the range one such allocation created; several
+    // resources may live in it at once at different offsets. Two passes run,
+    // one where a placement may also span adjacent retired ranges of a heap,
+    // and the plan with the smaller block wins, so PeakBytes never exceeds
+    // single-range first fit. With aliasing disabled every resource receives
+    // its own heap. Assignments are sorted by ResourceIndex; hazards are in
+    // placement order.
+    export [[nodiscard]] TransientHeapPlan PlanTransientHeaps(std::span<const TransientHeapRequest> requests,
+                                                              bool aliasingEnabled);
+
     export class TransientAllocator final
     {
     public:
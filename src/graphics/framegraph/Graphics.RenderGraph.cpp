@@ -65,8 +65,6 @@ namespace Extrinsic::Graphics
             return state == BufferState::ShaderWrite || state == BufferState::TransferDst;
         }
 
-        inline constexpr std::uint32_t kInvalidTransientPlacementResource =
-            std::numeric_limits<std::uint32_t>::max();
         inline constexpr std::uint64_t kDefaultTransientPlacementAlignmentBytes = 256u;
 
         [[nodiscard]] constexpr std::uint64_t AlignUp(const std::uint64_t value,
@@ -113,169 +111,6 @@ namespace Extrinsic::Graphics
             });
             return packets.back();
         }
-
-        struct TransientPlacementItem
-        {
-            std::uint32_t ResourceIndex = 0u;
-            std::uint32_t FirstUsePass = 0u;
-            std::uint32_t LastUsePass = 0u;
-            std::uint64_t SizeBytes = 0u;
-            std::uint64_t AlignmentBytes = 1u;
-        };
-
-        struct TransientPlacementPlan
-        {
-            std::vector<TransientResourcePlacement> Placements{};
-            std::uint64_t PeakBytes = 0u;
-        };
-
-        template <typename EmitAliasReuseHazard>
-        [[nodiscard]] TransientPlacementPlan BuildTransientPlacementPlan(
-            const std::span<const TransientPlacementItem> items,
-            const bool aliasingEnabled,
-            EmitAliasReuseHazard&& emitAliasReuseHazard)
-        {
-            struct ActiveRange
-            {
-                std::uint32_t ResourceIndex = 0u;
-                std::uint32_t LastUsePass = 0u;
-                std::uint32_t BlockIndex = 0u;
-                std::uint64_t OffsetBytes = 0u;
-                std::uint64_t SizeBytes = 0u;
-            };
-
-            struct FreeRange
-            {
-                std::uint32_t BlockIndex = 0u;
-                std::uint64_t OffsetBytes = 0u;
-                std::uint64_t SizeBytes = 0u;
-                std::uint32_t PreviousResourceIndex = kInvalidTransientPlacementResource;
-            };
-
-            std::vector<ActiveRange> activeRanges{};
-            std::vector<FreeRange> freeRanges{};
-            std::uint64_t blockSize = 0u;
-            TransientPlacementPlan plan{};
-            plan.Placements.reserve(items.size());
-
-            auto sortFreeRanges = [&]() {
-                std::ranges::sort(freeRanges, [](const FreeRange& lhs, const FreeRange& rhs) {
-                    return std::tuple{lhs.BlockIndex, lhs.OffsetBytes, lhs.SizeBytes, lhs.PreviousResourceIndex} <
-                           std::tuple{rhs.BlockIndex, rhs.OffsetBytes, rhs.SizeBytes, rhs.PreviousResourceIndex};
-                });
-            };
-
-            for (const TransientPlacementItem& item : items)
-            {
-                for (std::size_t activeIndex = 0u; activeIndex < activeRanges.size();)
-                {
-                    const ActiveRange& active = activeRanges[activeIndex];
-                    if (active.LastUsePass < item.FirstUsePass)
-                    {
-                        if (aliasingEnabled && active.SizeBytes != 0u)
-                        {
-                            freeRanges.push_back(FreeRange{
-                                .BlockIndex = active.BlockIndex,
-                                .OffsetBytes = active.OffsetBytes,
-                                .SizeBytes = active.SizeBytes,
-                                .PreviousResourceIndex = active.ResourceIndex,
-                            });
-                        }
-                        activeRanges.erase(activeRanges.begin() + static_cast<std::ptrdiff_t>(activeIndex));
-                        continue;
-                    }
-                    ++activeIndex;
-                }
-
-                sortFreeRanges();
-
-                bool placedInFreeRange = false;
-                std::uint32_t blockIndex = 0u;
-                std::uint64_t offsetBytes = 0u;
-
-                if (aliasingEnabled && item.SizeBytes != 0u)
-                {
-                    for (std::size_t rangeIndex = 0u; rangeIndex < freeRanges.size(); ++rangeIndex)
-                    {
-                        const FreeRange range = freeRanges[rangeIndex];
-                        const std::uint64_t alignedOffset = AlignUp(range.OffsetBytes, item.AlignmentBytes);
-                        const std::uint64_t rangeEnd = range.OffsetBytes + range.SizeBytes;
-                        if (alignedOffset > rangeEnd || item.SizeBytes > rangeEnd - alignedOffset)
-                        {
-                            continue;
-                        }
-
-                        blockIndex = range.BlockIndex;
-                        offsetBytes = alignedOffset;
-                        placedInFreeRange = true;
-                        freeRanges.erase(freeRanges.begin() + static_cast<std::ptrdiff_t>(rangeIndex));
-
-                        if (range.OffsetBytes < alignedOffset)
-                        {
-                            freeRanges.push_back(FreeRange{
-                                .BlockIndex = range.BlockIndex,
-                                .OffsetBytes = range.OffsetBytes,
-                                .SizeBytes = alignedOffset - range.OffsetBytes,
-                                .PreviousResourceIndex = range.PreviousResourceIndex,
-                            });
-                        }
-
-                        const std::uint64_t allocationEnd = alignedOffset + item.SizeBytes;
-                        if (allocationEnd < rangeEnd)
-                        {
-                            freeRanges.push_back(FreeRange{
-                                .BlockIndex = range.BlockIndex,
-                                .OffsetBytes = allocationEnd,
-                                .SizeBytes = rangeEnd - allocationEnd,
-                                .PreviousResourceIndex = range.PreviousResourceIndex,
-                            });
-                        }
-
-                        if (range.PreviousResourceIndex != kInvalidTransientPlacementResource)
-                        {
-                            emitAliasReuseHazard(range.PreviousResourceIndex,
-                                                 item.ResourceIndex,
-                                                 item.FirstUsePass,
-                                                 blockIndex,
-                                                 offsetBytes,
-                                                 item.SizeBytes);
-                        }
-                        break;
-                    }
-                }
-
-                if (!placedInFreeRange)
-                {
-                    offsetBytes = AlignUp(blockSize, item.AlignmentBytes);
-                    blockSize = offsetBytes + item.SizeBytes;
-                }
-
-                plan.Placements.push_back(TransientResourcePlacement{
-                    .ResourceIndex = item.ResourceIndex,
-                    .BlockIndex = blockIndex,
-                    .OffsetBytes = offsetBytes,
-                    .SizeBytes = item.SizeBytes,
-                    .AlignmentBytes = item.AlignmentBytes,
-                    .FirstUsePass = item.FirstUsePass,
-                    .LastUsePass = item.LastUsePass,
-                });
-
-                activeRanges.push_back(ActiveRange{
-                    .ResourceIndex = item.ResourceIndex,
-                    .LastUsePass = item.LastUsePass,
-                    .BlockIndex = blockIndex,
-                    .OffsetBytes = offsetBytes,
-                    .SizeBytes = item.SizeBytes,
-                });
-            }
-
-            plan.PeakBytes = blockSize;
-            std::ranges::sort(plan.Placements, [](const TransientResourcePlacement& lhs,
-                                                  const TransientResourcePlacement& rhs) {
-                return lhs.ResourceIndex < rhs.ResourceIndex;
-            });
-            return plan;
-        }
     }
 
     struct RenderGraph::Impl
@@ -817,84 +652,80 @@ namespace Extrinsic::Graphics
             }
         }
 
-        std::vector<TransientPlacementItem> texturePlacementItems{};
-        texturePlacementItems.reserve(texturesToAllocate.size());
-        for (const TextureAllocItem& item : texturesToAllocate)
-        {
-            texturePlacementItems.push_back(TransientPlacementItem{
-                .ResourceIndex = item.ResourceIndex,
-                .FirstUsePass = item.FirstUsePass,
-                .LastUsePass = item.LastUsePass,
-                .SizeBytes = item.SizeBytes,
-                .AlignmentBytes = item.AlignmentBytes,
-            });
-        }
+        auto toHeapRequests = [](const auto& items) {
+            std::vector<TransientHeapRequest> requests{};
+            requests.reserve(items.size());
+            for (const auto& item : items)
+            {
+                requests.push_back(TransientHeapRequest{
+                    .ResourceIndex = item.ResourceIndex,
+                    .FirstUsePass = item.FirstUsePass,
+                    .LastUsePass = item.LastUsePass,
+                    .SizeBytes = item.SizeBytes,
+                    .AlignmentBytes = item.AlignmentBytes,
+                });
+            }
+            return requests;
+        };
+        auto toPlacements = [](const TransientHeapPlan& plan) {
+            std::vector<TransientResourcePlacement> placements{};
+            placements.reserve(plan.Assignments.size());
+            for (const TransientHeapAssignment& assignment : plan.Assignments)
+            {
+                placements.push_back(TransientResourcePlacement{
+                    .ResourceIndex = assignment.ResourceIndex,
+                    .BlockIndex = 0u,
+                    .HeapIndex = assignment.HeapIndex,
+                    .OffsetBytes = assignment.OffsetBytes,
+                    .SizeBytes = assignment.SizeBytes,
+                    .AlignmentBytes = assignment.AlignmentBytes,
+                    .FirstUsePass = assignment.FirstUsePass,
+                    .LastUsePass = assignment.LastUsePass,
+                });
+            }
+            return placements;
+        };
+        // Lifetimes are execution ranks; barrier packets are keyed by pass index.
+        auto passIndexForRank = [&compiled](const std::uint32_t executionRank) {
+            return executionRank < compiled->TopologicalOrder.size()
+                ? compiled->TopologicalOrder[executionRank]
+                : executionRank;
+        };
 
-        std::vector<TransientPlacementItem> bufferPlacementItems{};
-        bufferPlacementItems.reserve(buffersToAllocate.size());
-        for (const BufferAllocItem& item : buffersToAllocate)
-        {
-            bufferPlacementItems.push_back(TransientPlacementItem{
-                .ResourceIndex = item.ResourceIndex,
-                .FirstUsePass = item.FirstUsePass,
-                .LastUsePass = item.LastUsePass,
-                .SizeBytes = item.SizeBytes,
-                .AlignmentBytes = item.AlignmentBytes,
-            });
-        }
+        const TransientHeapPlan texturePlan =
+            PlanTransientHeaps(toHeapRequests(texturesToAllocate), m_Impl->TransientAliasingEnabled);
+        const TransientHeapPlan bufferPlan =
+            PlanTransientHeaps(toHeapRequests(buffersToAllocate), m_Impl->TransientAliasingEnabled);
 
-        auto emitTextureAliasReuseHazard =
-            [&compiled](const std::uint32_t previousResourceIndex,
-                        const std::uint32_t resourceIndex,
-                        const std::uint32_t executionRank,
-                        const std::uint32_t blockIndex,
-                        const std::uint64_t offsetBytes,
-                        const std::uint64_t sizeBytes)
+        for (const TransientHeapAliasHazard& hazard : texturePlan.AliasHazards)
         {
-            const std::uint32_t passIndex =
-                executionRank < compiled->TopologicalOrder.size()
-                    ? compiled->TopologicalOrder[executionRank]
-                    : executionRank;
             BarrierPacket& packet = FindOrCreateBarrierPacket(
-                compiled->BarrierPackets, passIndex, BarrierPacketStage::BeforePass);
+                compiled->BarrierPackets, passIndexForRank(hazard.FirstUsePass), BarrierPacketStage::BeforePass);
             packet.TextureAliasReuseBarriers.push_back(TextureAliasReuseBarrierPacket{
-                .PreviousTextureIndex = previousResourceIndex,
-                .TextureIndex = resourceIndex,
-                .BlockIndex = blockIndex,
-                .OffsetBytes = offsetBytes,
-                .SizeBytes = sizeBytes,
+                .PreviousTextureIndex = hazard.PreviousResourceIndex,
+                .TextureIndex = hazard.ResourceIndex,
+                .BlockIndex = 0u,
+                .OffsetBytes = hazard.OffsetBytes,
+                .SizeBytes = hazard.SizeBytes,
             });
-        };
-
-        auto emitBufferAliasReuseHazard =
-            [&compiled](const std::uint32_t previousResourceIndex,
-                        const std::uint32_t resourceIndex,
-                        const std::uint32_t executionRank,
-                        const std::uint32_t blockIndex,
-                        const std::uint64_t offsetBytes,
-                        const std::uint64_t sizeBytes)
+        }
+        for (const TransientHeapAliasHazard& hazard : bufferPlan.AliasHazards)
         {
-            const std::uint32_t passIndex =
-                executionRank < compiled->TopologicalOrder.size()
-                    ? compiled->TopologicalOrder[executionRank]
-                    : executionRank;
             BarrierPacket& packet = FindOrCreateBarrierPacket(
-                compiled->BarrierPackets, passIndex, BarrierPacketStage::BeforePass);
+                compiled->BarrierPackets, passIndexForRank(hazard.FirstUsePass), BarrierPacketStage::BeforePass);
             packet.BufferAliasReuseBarriers.push_back(BufferAliasReuseBarrierPacket{
-                .PreviousBufferIndex = previousResourceIndex,
-                .BufferIndex = resourceIndex,
-                .BlockIndex = blockIndex,
-                .OffsetBytes = offsetBytes,
-                .SizeBytes = sizeBytes,
+                .PreviousBufferIndex = hazard.PreviousResourceIndex,
+                .BufferIndex = hazard.ResourceIndex,
+                .BlockIndex = 0u,
+                .OffsetBytes = hazard.OffsetBytes,
+                .SizeBytes = hazard.SizeBytes,
             });
-        };
+        }
 
-        TransientPlacementPlan texturePlan =
-            BuildTransientPlacementPlan(texturePlacementItems, m_Impl->TransientAliasingEnabled, emitTextureAliasReuseHazard);
-        TransientPlacementPlan bufferPlan =
-            BuildTransientPlacementPlan(bufferPlacementItems, m_Impl->TransientAliasingEnabled, emitBufferAliasReuseHazard);
-        compiled->TextureTransientPlacements = std::move(texturePlan.Placements);
-        compiled->BufferTransientPlacements = std::move(bufferPlan.Placements);
+        compiled->TextureTransientPlacements = toPlacements(texturePlan);
+        compiled->BufferTransientPlacements = toPlacements(bufferPlan);
+        compiled->TransientTextureHeapCount = static_cast<std::uint32_t>(texturePlan.Heaps.size());
+        compiled->TransientBufferHeapCount = static_cast<std::uint32_t>(bufferPlan.Heaps.size());
         compiled->TransientPlacedPeakMemoryEstimateBytes = texturePlan.PeakBytes + bufferPlan.PeakBytes;
         compiled->TransientMemoryEstimateBytes = compiled->TransientPlacedPeakMemoryEstimateBytes;
         SortBarrierPacketsByPass(compiled->BarrierPackets);
@@ -1,8 +1,10 @@
 module;
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 module Extrinsic.Backends.Null;
@@ -288,6 +290,8 @@ namespace Extrinsic::Backends::Null
             if (desc.SizeBytes == 0u || desc.AlignmentBytes == 0u || selectedBit == 0u)
                 return {};
 
+            m_LiveMemoryBlockBytes += desc.SizeBytes;
+            m_PeakMemoryBlockBytes = std::max(m_PeakMemoryBlockBytes, m_LiveMemoryBlockBytes);
             return m_MemoryBlocks.Add(MemoryBlockEntry{
                 .SizeBytes = desc.SizeBytes,
                 .AlignmentBytes = desc.AlignmentBytes,
@@ -300,6 +304,8 @@ namespace Extrinsic::Backends::Null
         void DestroyMemoryBlock(RHI::MemoryBlockHandle handle) override
         {
             if (!handle.IsValid()) return;
+            if (const MemoryBlockEntry* block = m_MemoryBlocks.GetIfValid(handle))
+                m_LiveMemoryBlockBytes -= block->SizeBytes;
             m_MemoryBlocks.Remove(handle, m_FrameIndex);
         }
 
@@ -403,6 +409,69 @@ namespace Extrinsic::Backends::Null
             return texture != nullptr ? texture->Placement : RHI::PlacedResourceInfo{};
         }
 
+        [[nodiscard]] RHI::PlacedMemoryStats GetPlacedMemoryStats() const override
+        {
+            struct PlacedRange
+            {
+                std::uint32_t BlockIndex = 0;
+                std::uint32_t BlockGeneration = 0;
+                std::uint64_t Begin = 0;
+                std::uint64_t End = 0;
+            };
+
+            RHI::PlacedMemoryStats stats{.PeakMemoryBlockBytes = m_PeakMemoryBlockBytes};
+            m_MemoryBlocks.ForEach([&stats](RHI::MemoryBlockHandle, const MemoryBlockEntry& block)
+            {
+                ++stats.MemoryBlockCount;
+                stats.MemoryBlockBytes += block.SizeBytes;
+            });
+
+            std::vector<PlacedRange> ranges;
+            const auto collect = [&stats, &ranges](const RHI::PlacedResourceInfo& placement)
+            {
+                if (!placement.IsPlaced)
+                    return;
+                ++stats.PlacedResourceCount;
+                stats.PlacedResourceBytes += placement.SizeBytes;
+                ranges.push_back(PlacedRange{
+                    .BlockIndex = placement.Block.Index,
+                    .BlockGeneration = placement.Block.Generation,
+                    .Begin = placement.OffsetBytes,
+                    .End = placement.OffsetBytes + placement.SizeBytes,
+                });
+            };
+            m_Buffers.ForEach([&collect](RHI::BufferHandle, const BufferEntry& buffer) { collect(buffer.Placement); });
+            m_Textures.ForEach([&collect](RHI::TextureHandle, const TextureEntry& texture) { collect(texture.Placement); });
+
+            // Whatever the union of live ranges does not cover was aliased.
+            std::ranges::sort(ranges, [](const PlacedRange& lhs, const PlacedRange& rhs)
+            {
+                return std::tie(lhs.BlockIndex, lhs.BlockGeneration, lhs.Begin) <
+                       std::tie(rhs.BlockIndex, rhs.BlockGeneration, rhs.Begin);
+            });
+            std::uint64_t coveredBytes = 0;
+            for (std::size_t i = 0; i < ranges.size();)
+            {
+                std::uint64_t runBegin = ranges[i].Begin;
+                std::uint64_t runEnd = ranges[i].End;
+                std::size_t j = i + 1;
+                for (; j < ranges.size() && ranges[j].BlockIndex == ranges[i].BlockIndex &&
+                       ranges[j].BlockGeneration == ranges[i].BlockGeneration; ++j)
+                {
+                    if (ranges[j].Begin >= runEnd)
+                    {
+                        coveredBytes += runEnd - runBegin;
+                        runBegin = ranges[j].Begin;
+                    }
+                    runEnd = std::max(runEnd, ranges[j].End);
+                }
+                coveredBytes += runEnd - runBegin;
+                i = j;
+            }
+            stats.AliasedBytes = stats.PlacedResourceBytes - coveredBytes;
+            return stats;
+        }
+
         [[nodiscard]] RHI::SamplerHandle CreateSampler(const RHI::SamplerDesc& desc) override
         {
             return m_Samplers.Add(SamplerEntry{.Desc = desc});
@@ -465,6 +534,8 @@ namespace Extrinsic::Backends::Null
         }
 
         std::uint32_t m_FrameIndex{0};
+        std::uint64_t m_LiveMemoryBlockBytes{0};
+        std::uint64_t m_PeakMemoryBlockBytes{0};
         RHI::PresentMode m_PresentMode{RHI::PresentMode::VSync};
         Core::Extent2D m_BackbufferExtent{};
         NullCommandContext m_CommandContext{};
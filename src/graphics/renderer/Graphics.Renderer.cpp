@@ -1048,9 +1048,6 @@ namespace Extrinsic::Graphics
             return remainder == 0u ? value : value + (alignment - remainder);
         }
 
-        inline constexpr std::uint32_t kInvalidRendererTransientPlacementResource =
-            std::numeric_limits<std::uint32_t>::max();
-
         struct RendererTransientPlacementItem
         {
             std::uint32_t ResourceIndex = 0u;
@@ -1077,6 +1074,7 @@ namespace Extrinsic::Graphics
             std::uint64_t PeakBytes = 0u;
             std::uint64_t BlockAlignmentBytes = 1u;
             std::uint32_t MemoryTypeBits = 0u;
+            std::uint32_t HeapCount = 0u;
             bool IsValid = true;
         };
 
@@ -1084,23 +1082,6 @@ namespace Extrinsic::Graphics
             std::vector<RendererTransientPlacementItem> items,
             const bool aliasingEnabled)
         {
-            struct ActiveRange
-            {
-                std::uint32_t ResourceIndex = 0u;
-                std::uint32_t LastUsePass = 0u;
-                std::uint32_t BlockIndex = 0u;
-                std::uint64_t OffsetBytes = 0u;
-                std::uint64_t SizeBytes = 0u;
-            };
-
-            struct FreeRange
-            {
-                std::uint32_t BlockIndex = 0u;
-                std::uint64_t OffsetBytes = 0u;
-                std::uint64_t SizeBytes = 0u;
-                std::uint32_t PreviousResourceIndex = kInvalidRendererTransientPlacementResource;
-            };
-
             RendererTransientPlacementPlan plan{};
             plan.Placements.reserve(items.size());
 
@@ -1109,13 +1090,6 @@ namespace Extrinsic::Graphics
                 return plan;
             }
 
-            std::ranges::sort(items, [](const RendererTransientPlacementItem& lhs,
-                                        const RendererTransientPlacementItem& rhs)
-            {
-                return std::tie(lhs.FirstUsePass, lhs.ResourceIndex) <
-                       std::tie(rhs.FirstUsePass, rhs.ResourceIndex);
-            });
-
             plan.MemoryTypeBits = items.front().Requirements.MemoryTypeBits;
             for (const RendererTransientPlacementItem& item : items)
             {
@@ -1136,133 +1110,48 @@ namespace Extrinsic::Graphics
                 return plan;
             }
 
-            std::vector<ActiveRange> activeRanges{};
-            std::vector<FreeRange> freeRanges{};
-            std::uint64_t blockSize = 0u;
-
-            auto sortFreeRanges = [&]() {
-                std::ranges::sort(freeRanges, [](const FreeRange& lhs, const FreeRange& rhs) {
-                    return std::tuple{lhs.BlockIndex, lhs.OffsetBytes, lhs.SizeBytes, lhs.PreviousResourceIndex} <
-                           std::tuple{rhs.BlockIndex, rhs.OffsetBytes, rhs.SizeBytes, rhs.PreviousResourceIndex};
-                });
-            };
-
+            std::vector<TransientHeapRequest> requests{};
+            requests.reserve(items.size());
             for (const RendererTransientPlacementItem& item : items)
             {
-                for (std::size_t activeIndex = 0u; activeIndex < activeRanges.size();)
-                {
-                    const ActiveRange& active = activeRanges[activeIndex];
-                    if (active.LastUsePass < item.FirstUsePass)
-                    {
-                        if (aliasingEnabled && active.SizeBytes != 0u)
-                        {
-                            freeRanges.push_back(FreeRange{
-                                .BlockIndex = active.BlockIndex,
-                                .OffsetBytes = active.OffsetBytes,
-                                .SizeBytes = active.SizeBytes,
-                                .PreviousResourceIndex = active.ResourceIndex,
-                            });
-                        }
-                        activeRanges.erase(activeRanges.begin() + static_cast<std::ptrdiff_t>(activeIndex));
-                        continue;
-                    }
-                    ++activeIndex;
-                }
-
-                sortFreeRanges();
-
-                bool placedInFreeRange = false;
-                std::uint32_t blockIndex = 0u;
-                std::uint64_t offsetBytes = 0u;
-
-                if (aliasingEnabled && item.Requirements.SizeBytes != 0u)
-                {
-                    for (std::size_t rangeIndex = 0u; rangeIndex < freeRanges.size(); ++rangeIndex)
-                    {
-                        const FreeRange range = freeRanges[rangeIndex];
-                        const std::uint64_t alignedOffset =
-                            AlignUpForRendererPlacement(range.OffsetBytes, item.Requirements.AlignmentBytes);
-                        const std::uint64_t rangeEnd = range.OffsetBytes + range.SizeBytes;
-                        if (alignedOffset > rangeEnd ||
-                            item.Requirements.SizeBytes > rangeEnd - alignedOffset)
-                        {
-                            continue;
-                        }
-
-                        blockIndex = range.BlockIndex;
-                        offsetBytes = alignedOffset;
-                        placedInFreeRange = true;
-                        freeRanges.erase(freeRanges.begin() + static_cast<std::ptrdiff_t>(rangeIndex));
-
-                        if (range.OffsetBytes < alignedOffset)
-                        {
-                            freeRanges.push_back(FreeRange{
-                                .BlockIndex = range.BlockIndex,
-                                .OffsetBytes = range.OffsetBytes,
-                                .SizeBytes = alignedOffset - range.OffsetBytes,
-                                .PreviousResourceIndex = range.PreviousResourceIndex,
-                            });
-                        }
-
-                        const std::uint64_t allocationEnd =
-                            alignedOffset + item.Requirements.SizeBytes;
-                        if (allocationEnd < rangeEnd)
-                        {
-                            freeRanges.push_back(FreeRange{
-                                .BlockIndex = range.BlockIndex,
-                                .OffsetBytes = allocationEnd,
-                                .SizeBytes = rangeEnd - allocationEnd,
-                                .PreviousResourceIndex = range.PreviousResourceIndex,
-                            });
-                        }
-
-                        if (range.PreviousResourceIndex != kInvalidRendererTransientPlacementResource)
-                        {
-                            plan.AliasReuseHazards.push_back(RendererTransientAliasReuseHazard{
-                                .PreviousResourceIndex = range.PreviousResourceIndex,
-                                .ResourceIndex = item.ResourceIndex,
-                                .PassIndex = item.FirstUsePass,
-                                .BlockIndex = blockIndex,
-                                .OffsetBytes = offsetBytes,
-                                .SizeBytes = item.Requirements.SizeBytes,
-                            });
-                        }
-                        break;
-                    }
-                }
-
-                if (!placedInFreeRange)
-                {
-                    offsetBytes =
-                        AlignUpForRendererPlacement(blockSize, item.Requirements.AlignmentBytes);
-                    blockSize = offsetBytes + item.Requirements.SizeBytes;
-                }
-
-                plan.Placements.push_back(TransientResourcePlacement{
+                requests.push_back(TransientHeapRequest{
                     .ResourceIndex = item.ResourceIndex,
-                    .BlockIndex = blockIndex,
-                    .OffsetBytes = offsetBytes,
-                    .SizeBytes = item.Requirements.SizeBytes,
-                    .AlignmentBytes = item.Requirements.AlignmentBytes,
                     .FirstUsePass = item.FirstUsePass,
                     .LastUsePass = item.LastUsePass,
-                });
-
-                activeRanges.push_back(ActiveRange{
-                    .ResourceIndex = item.ResourceIndex,
-                    .LastUsePass = item.LastUsePass,
-                    .BlockIndex = blockIndex,
-                    .OffsetBytes = offsetBytes,
                     .SizeBytes = item.Requirements.SizeBytes,
+                    .AlignmentBytes = item.Requirements.AlignmentBytes,
                 });
             }
 
-            plan.PeakBytes = AlignUpForRendererPlacement(blockSize, plan.BlockAlignmentBytes);
-            std::ranges::sort(plan.Placements, [](const TransientResourcePlacement& lhs,
-                                                  const TransientResourcePlacement& rhs)
+            // Device requirements can differ from the compiler's estimates, so
+            // the heaps are re-planned here with the backend's sizes.
+            const TransientHeapPlan heapPlan = PlanTransientHeaps(requests, aliasingEnabled);
+            for (const TransientHeapAssignment& assignment : heapPlan.Assignments)
             {
-                return lhs.ResourceIndex < rhs.ResourceIndex;
-            });
+                plan.Placements.push_back(TransientResourcePlacement{
+                    .ResourceIndex = assignment.ResourceIndex,
+                    .BlockIndex = 0u,
+                    .HeapIndex = assignment.HeapIndex,
+                    .OffsetBytes = assignment.OffsetBytes,
+                    .SizeBytes = assignment.SizeBytes,
+                    .AlignmentBytes = assignment.AlignmentBytes,
+                    .FirstUsePass = assignment.FirstUsePass,
+                    .LastUsePass = assignment.LastUsePass,
+                });
+            }
+            for (const TransientHeapAliasHazard& hazard : heapPlan.AliasHazards)
+            {
+                plan.AliasReuseHazards.push_back(RendererTransientAliasReuseHazard{
+                    .PreviousResourceIndex = hazard.PreviousResourceIndex,
+                    .ResourceIndex = hazard.ResourceIndex,
+                    .PassIndex = hazard.FirstUsePass,
+                    .BlockIndex = 0u,
+                    .OffsetBytes = hazard.OffsetBytes,
+                    .SizeBytes = hazard.SizeBytes,
+                });
+            }
+            plan.HeapCount = static_cast<std::uint32_t>(heapPlan.Heaps.size());
+            plan.PeakBytes = AlignUpForRendererPlacement(heapPlan.PeakBytes, plan.BlockAlignmentBytes);
             return plan;
         }
 
@@ -3460,6 +3349,8 @@ namespace Extrinsic::Graphics
                 compiled->TransientNaiveMemoryEstimateBytes;
             m_LastRenderGraphStats.Compile.TransientPlacedPeakMemoryEstimateBytes =
                 compiled->TransientPlacedPeakMemoryEstimateBytes;
+            m_LastRenderGraphStats.Compile.TransientHeapCount =
+                compiled->TransientTextureHeapCount + compiled->TransientBufferHeapCount;
             if (m_RenderGraphDebugDumpEnabled)
             {
                 m_LastRenderGraphStats.DebugDump = BuildRenderGraphDebugDump(*compiled);
@@ -8132,6 +8023,8 @@ namespace Extrinsic::Graphics
                 texturePlan->PeakBytes + bufferPlan->PeakBytes;
             compiled.TransientMemoryEstimateBytes =
                 compiled.TransientPlacedPeakMemoryEstimateBytes;
+            compiled.TransientTextureHeapCount = texturePlan->HeapCount;
+            compiled.TransientBufferHeapCount = bufferPlan->HeapCount;
             ReplaceCompiledAliasReuseBarriers(compiled, *texturePlan, *bufferPlan);
 
             if (!AllocatePlacedFrameTransientTextures(compiled, slot, *texturePlan) ||
@@ -8187,6 +8080,8 @@ namespace Extrinsic::Graphics
                     compiled.TransientNaiveMemoryEstimateBytes;
                 compiled.TransientMemoryEstimateBytes =
                     compiled.TransientNaiveMemoryEstimateBytes;
+                compiled.TransientTextureHeapCount = compiled.TransientTextureCount;
+                compiled.TransientBufferHeapCount = compiled.TransientBufferCount;
                 ClearCompiledAliasReuseBarriers(compiled);
                 Core::Log::Warn(
                     "[Graphics] Placed transient allocation unavailable; using non-aliased transient resource allocation for this frame");
@@ -116,6 +116,7 @@ namespace Extrinsic::Graphics
         std::uint64_t TransientMemoryEstimateBytes = 0;
         std::uint64_t TransientNaiveMemoryEstimateBytes = 0;
         std::uint64_t TransientPlacedPeakMemoryEstimateBytes = 0;
+        std::uint32_t TransientHeapCount = 0;
         std::uint64_t TimeMicros = 0;
     };
 
@@ -146,6 +146,20 @@ namespace Extrinsic::RHI
         bool IsPlaced = false;
     };
 
+    // Device-wide placed-memory accounting. AliasedBytes counts bytes of live
+    // placed resources that overlap another live placed resource in the same
+    // block, i.e. memory the transient heap plan saved versus dedicated
+    // allocations.
+    export struct PlacedMemoryStats
+    {
+        std::uint32_t MemoryBlockCount = 0;
+        std::uint32_t PlacedResourceCount = 0;
+        std::uint64_t MemoryBlockBytes = 0;
+        std::uint64_t PeakMemoryBlockBytes = 0;
+        std::uint64_t PlacedResourceBytes = 0;
+        std::uint64_t AliasedBytes = 0;
+    };
+
     export class IDevice
     {
     public:
@@ -391,5 +405,11 @@ namespace Extrinsic::RHI
             (void)handle;
             return {};
         }
+
+        // Not noexcept: backends may allocate while collecting placed ranges.
+        [[nodiscard]] virtual PlacedMemoryStats GetPlacedMemoryStats() const
+        {
+            return {};
+        }
     };
 }
@@ -1,10 +1,12 @@
 module;
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -12,6 +14,10 @@ module;
 
 module Extrinsic.Physics.World;
 
+import Extrinsic.Core.Memory;
+import Extrinsic.Core.Tasks;
+import Extrinsic.Core.Tasks.CounterEvent;
+import Geometry.AABB;
 import Geometry.Capsule;
 import Geometry.ContactManifold;
 import Geometry.OBB;
@@ -23,6 +29,12 @@ namespace Extrinsic::Physics
     {
         constexpr float kRotationLengthEpsilon = 1.0e-6f;
         constexpr float kScaleUniformEpsilon = 1.0e-4f;
+        // Broadphase AABBs are inflated so touching shapes and OBB bounds
+        // that round inward still reach the narrowphase.
+        constexpr float kBroadphaseMargin = 1.0e-4f;
+        // Per-thread island solver scratch; islands with more contacts than
+        // fit fall back to a heap allocation.
+        constexpr std::size_t kIslandScratchBytes = 256u * 1024u;
 
         struct BuiltCollisionShape
         {
@@ -35,6 +47,48 @@ namespace Extrinsic::Physics
             Geometry::OBB Box{};
         };
 
+        // One island contact with its endpoints and inverse masses resolved
+        // up front; both are invariant across solver iterations. Dynamic
+        // endpoints are hot-store rows; static/kinematic anchors are never
+        // written and are read from their descriptor.
+        struct SolverContact
+        {
+            const ContactRecord* Contact{nullptr};
+            const BodyDescriptor* AnchorA{nullptr};
+            const BodyDescriptor* AnchorB{nullptr};
+            std::uint32_t RowA{0u};
+            std::uint32_t RowB{0u};
+            float InvA{0.0f};
+            float InvB{0.0f};
+        };
+
+        [[nodiscard]] Core::Memory::LinearArena& IslandScratchArena() noexcept
+        {
+            // Constructed on first use so the arena's owner check binds it to
+            // the scheduler worker (or calling thread) that solves with it.
+            thread_local Core::Memory::LinearArena arena{kIslandScratchBytes};
+            return arena;
+        }
+
+        [[nodiscard]] float InverseMass(const BodyDescriptor& body) noexcept
+        {
+            if (body.Motion != MotionType::Dynamic || body.Mass <= 0.0f)
+                return 0.0f;
+            return 1.0f / body.Mass;
+        }
+
+        [[nodiscard]] float SanitizedDamping(float damping) noexcept
+        {
+            return std::isfinite(damping) && damping > 0.0f ? damping : 0.0f;
+        }
+
+        // Shared by the descriptor and hot-store paths so both round alike;
+        // a sanitized zero coefficient yields exactly 1.
+        [[nodiscard]] float ClampedDampingFactor(float damping, float dt) noexcept
+        {
+            return std::max(0.0f, 1.0f - damping * dt);
+        }
+
         [[nodiscard]] float DampingFactor(float damping, float dt) noexcept
         {
             // Matches the canonical METHOD-001 reference
@@ -44,17 +98,42 @@ namespace Extrinsic::Physics
             // reference exactly; the two agree to first order in c*dt.
             if (!std::isfinite(damping) || damping <= 0.0f)
                 return 1.0f;
-            return std::max(0.0f, 1.0f - damping * dt);
+            return ClampedDampingFactor(damping, dt);
         }
 
-        void IntegrateAngular(Transform& pose, const glm::vec3& angularVelocity, float dt)
+        void IntegrateAngular(glm::quat& rotation, const glm::vec3& angularVelocity, float dt)
         {
             const float angularSpeed = glm::length(angularVelocity);
             if (!std::isfinite(angularSpeed) || angularSpeed <= 1.0e-6f)
                 return;
 
             const glm::quat delta = glm::angleAxis(angularSpeed * dt, angularVelocity / angularSpeed);
-            pose.Rotation = glm::normalize(delta * pose.Rotation);
+            rotation = glm::normalize(delta * rotation);
+        }
+
+        // Descriptor (cold) path for bodies outside the hot store: kinematic
+        // bodies, and sleeping dynamic bodies under the raw Step().
+        void IntegrateDynamicBody(BodyDescriptor& body, const StepInput& input)
+        {
+            const float dt = input.DeltaSeconds;
+            body.LinearVelocity += input.Gravity * body.GravityScale * dt;
+            body.LinearVelocity *= DampingFactor(body.LinearDamping, dt);
+            body.AngularVelocity *= DampingFactor(body.AngularDamping, dt);
+            body.Pose.Position += body.LinearVelocity * dt;
+            IntegrateAngular(body.Pose.Rotation, body.AngularVelocity, dt);
+        }
+
+        void IntegrateKinematicBody(BodyDescriptor& body, float dt)
+        {
+            body.Pose.Position += body.LinearVelocity * dt;
+            IntegrateAngular(body.Pose.Rotation, body.AngularVelocity, dt);
+        }
+
+        template <typename T>
+        void SwapRemoveRow(std::vector<T>& column, std::size_t row) noexcept
+        {
+            column[row] = column.back();
+            column.pop_back();
         }
 
         [[nodiscard]] std::uint32_t BumpGeneration(std::uint32_t generation) noexcept
@@ -75,6 +154,50 @@ namespace Extrinsic::Physics
             return std::max(absScale.x, std::max(absScale.y, absScale.z));
         }
 
+        // Diagonal body-space inverse inertia of the first shape as a solid
+        // of the body's mass (capsules as their bounding cylinder).
+        [[nodiscard]] glm::vec3 InverseInertiaDiagonal(const BodyDescriptor& body) noexcept
+        {
+            const float inverseMass = InverseMass(body);
+            if (inverseMass <= 0.0f || body.Shapes.empty())
+                return glm::vec3{0.0f};
+
+            const ShapeDescriptor& shape = body.Shapes.front();
+            const float scale = MaxScaleComponent(body.Pose.Scale * shape.Local.Scale);
+            glm::vec3 inertiaPerMass{0.0f};
+            switch (shape.Kind)
+            {
+            case ShapeKind::Sphere:
+                {
+                    const float r = shape.Radius * scale;
+                    inertiaPerMass = glm::vec3{0.4f * r * r};
+                    break;
+                }
+            case ShapeKind::Capsule:
+                {
+                    const float r = shape.Radius * scale;
+                    const float h = (shape.CapsuleHalfHeight + shape.Radius) * scale;
+                    const float lateral = (3.0f * r * r + 4.0f * h * h) / 12.0f;
+                    inertiaPerMass = glm::vec3{lateral, 0.5f * r * r, lateral};
+                    break;
+                }
+            case ShapeKind::Box:
+                {
+                    const glm::vec3 e = shape.HalfExtents * scale;
+                    inertiaPerMass = glm::vec3{e.y * e.y + e.z * e.z,
+                                               e.x * e.x + e.z * e.z,
+                                               e.x * e.x + e.y * e.y} / 3.0f;
+                    break;
+                }
+            }
+
+            const auto invert = [inverseMass](float value) noexcept
+            {
+                return value > 0.0f ? inverseMass / value : 0.0f;
+            };
+            return glm::vec3{invert(inertiaPerMass.x), invert(inertiaPerMass.y), invert(inertiaPerMass.z)};
+        }
+
         [[nodiscard]] glm::quat ComposeRotation(const Transform& bodyPose, const Transform& local)
         {
             return glm::normalize(bodyPose.Rotation * local.Rotation);
@@ -163,6 +286,33 @@ namespace Extrinsic::Physics
             return glm::vec3{0.0f};
         }
 
+        [[nodiscard]] Geometry::AABB ShapeWorldBounds(const BuiltCollisionShape& shape)
+        {
+            Geometry::AABB bounds{};
+            switch (shape.Kind)
+            {
+            case ShapeKind::Sphere:
+                bounds.Min = shape.Sphere.Center - glm::vec3{shape.Sphere.Radius};
+                bounds.Max = shape.Sphere.Center + glm::vec3{shape.Sphere.Radius};
+                break;
+            case ShapeKind::Capsule:
+                bounds.Min = glm::min(shape.Capsule.PointA, shape.Capsule.PointB) - glm::vec3{shape.Capsule.Radius};
+                bounds.Max = glm::max(shape.Capsule.PointA, shape.Capsule.PointB) + glm::vec3{shape.Capsule.Radius};
+                break;
+            case ShapeKind::Box:
+                bounds = Geometry::ToAABB(shape.Box);
+                break;
+            }
+            bounds.Min -= glm::vec3{kBroadphaseMargin};
+            bounds.Max += glm::vec3{kBroadphaseMargin};
+            return bounds;
+        }
+
+        [[nodiscard]] std::uint64_t ShapeKey(const ShapeReference& reference) noexcept
+        {
+            return (static_cast<std::uint64_t>(reference.Body.Index) << 32u) | reference.ShapeIndex;
+        }
+
         template <typename ShapeA, typename ShapeB>
         void AppendContactIfPresent(const ShapeReference& refA,
                                     const ShapeReference& refB,
@@ -459,7 +609,12 @@ namespace Extrinsic::Physics
             slot.Occupied = true;
             slot.Body = descriptor;
             m_Slots.push_back(slot);
+            // Each slot is queued for reload at most once, so keeping room for
+            // every slot lets the noexcept GetBody() queue without allocating.
+            // Track the slot capacity so this only grows when m_Slots did.
+            m_HotReload.reserve(m_Slots.capacity());
         }
+        SyncHotBody(index);
 
         ++m_Diagnostics.BodyCount;
         ++m_Diagnostics.BodiesCreated;
@@ -475,6 +630,7 @@ namespace Extrinsic::Physics
             return false;
         }
 
+        RemoveHotBody(handle.Index);
         slot->Occupied = false;
         slot->Body = {};
         slot->Sleep = {};
@@ -504,15 +660,26 @@ namespace Extrinsic::Physics
         // PHYSICS-003: a descriptor update is an external mutation; the body
         // must observe it, so it wakes and restarts its low-motion window.
         slot->Sleep = {};
+        SyncHotBody(handle.Index);
         ++m_Diagnostics.DescriptorUpdates;
         return true;
     }
 
     [[nodiscard]] BodyDescriptor* World::GetBody(BodyHandle handle) noexcept
     {
-        if (Slot* slot = ResolveSlot(handle))
-            return &slot->Body;
-        return nullptr;
+        Slot* slot = ResolveSlot(handle);
+        if (slot == nullptr)
+            return nullptr;
+
+        // The caller may write through the pointer; re-sync the hot row from
+        // the descriptor before the next step. AddBody() reserved the slot's
+        // entry, so this push_back cannot throw.
+        if (!slot->ReloadQueued)
+        {
+            slot->ReloadQueued = true;
+            m_HotReload.push_back(handle.Index);
+        }
+        return &slot->Body;
     }
 
     [[nodiscard]] const BodyDescriptor* World::GetBody(BodyHandle handle) const noexcept
@@ -538,14 +705,24 @@ namespace Extrinsic::Physics
             return diagnostics;
         }
 
-        const float dt = input.DeltaSeconds;
+        // Awake dynamic bodies integrate in the hot store; the slot scan
+        // below only counts them and takes the descriptor path for the rest
+        // (this raw integrator also advances sleeping dynamic bodies).
+        RefreshHotStore();
+        IntegrateHotBodies(input);
         for (Slot& slot : m_Slots)
         {
             if (!slot.Occupied)
                 continue;
 
-            BodyDescriptor& body = slot.Body;
             ++diagnostics.BodiesVisited;
+            if (slot.HotIndex != kNoHotIndex)
+            {
+                ++diagnostics.DynamicBodiesIntegrated;
+                continue;
+            }
+
+            BodyDescriptor& body = slot.Body;
             if (!body.Enabled)
             {
                 ++diagnostics.DisabledBodiesSkipped;
@@ -558,20 +735,16 @@ namespace Extrinsic::Physics
                 ++diagnostics.StaticBodiesSkipped;
                 break;
             case MotionType::Kinematic:
-                body.Pose.Position += body.LinearVelocity * dt;
-                IntegrateAngular(body.Pose, body.AngularVelocity, dt);
+                IntegrateKinematicBody(body, input.DeltaSeconds);
                 ++diagnostics.KinematicBodiesIntegrated;
                 break;
             case MotionType::Dynamic:
-                body.LinearVelocity += input.Gravity * body.GravityScale * dt;
-                body.LinearVelocity *= DampingFactor(body.LinearDamping, dt);
-                body.AngularVelocity *= DampingFactor(body.AngularDamping, dt);
-                body.Pose.Position += body.LinearVelocity * dt;
-                IntegrateAngular(body.Pose, body.AngularVelocity, dt);
+                IntegrateDynamicBody(body, input);
                 ++diagnostics.DynamicBodiesIntegrated;
                 break;
             }
         }
+        WriteBackHotStore();
 
         ++m_Diagnostics.StepsExecuted;
         diagnostics.StepIndex = m_Diagnostics.StepsExecuted;
@@ -584,6 +757,8 @@ namespace Extrinsic::Physics
         CollisionResult result{};
         std::vector<BuiltCollisionShape> shapes{};
         shapes.reserve(m_Diagnostics.BodyCount);
+        m_Broadphase.Proxies.clear();
+        m_Broadphase.Proxies.reserve(m_Diagnostics.BodyCount);
 
         for (std::uint32_t bodyIndex = 0u; bodyIndex < m_Slots.size(); ++bodyIndex)
         {
@@ -627,27 +802,141 @@ namespace Extrinsic::Physics
                                             shapeIndex,
                                             result.Diagnostics))
                 {
+                    const Geometry::AABB bounds = ShapeWorldBounds(*shape);
+                    m_Broadphase.Proxies.push_back(BroadphaseProxy{bounds.Min, bounds.Max, ShapeKey(shape->Reference)});
                     shapes.push_back(*shape);
                 }
             }
         }
 
-        for (std::size_t i = 0u; i < shapes.size(); ++i)
+        result.Diagnostics.BroadphaseProxies = static_cast<std::uint32_t>(shapes.size());
+        FindBroadphasePairs();
+        for (const std::uint64_t pair : m_Broadphase.Pairs)
+        {
+            const BuiltCollisionShape& a = shapes[static_cast<std::uint32_t>(pair >> 32u)];
+            const BuiltCollisionShape& b = shapes[static_cast<std::uint32_t>(pair & 0xFFFFFFFFu)];
+            result.Candidates.push_back(CollisionCandidatePair{a.Reference, b.Reference});
+            ++result.Diagnostics.BroadphasePairs;
+            DispatchContact(a, b, result);
+        }
+
+        return result;
+    }
+
+    void World::FindBroadphasePairs() const
+    {
+        BroadphaseCache& cache = m_Broadphase;
+        const std::vector<BroadphaseProxy>& proxies = cache.Proxies;
+        const auto count = static_cast<std::uint32_t>(proxies.size());
+        cache.Pairs.clear();
+        if (count < 2u)
+        {
+            cache.OrderKeys.clear();
+            return;
+        }
+
+        // Sweep along the axis with the largest spread of proxy centers so
+        // the interval overlap test rejects as many pairs as possible.
+        glm::vec3 sum{0.0f};
+        glm::vec3 sumSquares{0.0f};
+        for (const BroadphaseProxy& proxy : proxies)
         {
-            for (std::size_t j = i + 1u; j < shapes.size(); ++j)
+            const glm::vec3 center = (proxy.Min + proxy.Max) * 0.5f;
+            sum += center;
+            sumSquares += center * center;
+        }
+        const glm::vec3 variance = sumSquares - sum * sum / static_cast<float>(count);
+        std::uint32_t axis = 0u;
+        if (variance.y > variance[axis])
+            axis = 1u;
+        if (variance.z > variance[axis])
+            axis = 2u;
+
+        // Seed the order with last call's survivors (proxies ascend by key,
+        // so lookups are binary searches), then append newcomers.
+        cache.Order.clear();
+        cache.Order.reserve(count);
+        cache.Seeded.assign(count, 0u);
+        if (axis == cache.Axis)
+        {
+            for (const std::uint64_t key : cache.OrderKeys)
             {
-                const BuiltCollisionShape& a = shapes[i];
-                const BuiltCollisionShape& b = shapes[j];
-                if (a.Reference.Body.Index == b.Reference.Body.Index)
+                const auto it = std::lower_bound(proxies.begin(), proxies.end(), key,
+                    [](const BroadphaseProxy& proxy, std::uint64_t value) noexcept { return proxy.Key < value; });
+                if (it == proxies.end() || it->Key != key)
                     continue;
+                const auto index = static_cast<std::uint32_t>(it - proxies.begin());
+                cache.Order.push_back(index);
+                cache.Seeded[index] = 1u;
+            }
+        }
+        for (std::uint32_t index = 0u; index < count; ++index)
+        {
+            if (cache.Seeded[index] == 0u)
+                cache.Order.push_back(index);
+        }
 
-                result.Candidates.push_back(CollisionCandidatePair{a.Reference, b.Reference});
-                ++result.Diagnostics.BroadphasePairs;
-                DispatchContact(a, b, result);
+        // Insertion sort is near-linear on the coherent seed; a shift budget
+        // bounds the incoherent case (teleports, axis flips, mass inserts),
+        // which falls back to a full sort. Ties break on proxy index so the
+        // order is a pure function of the current AABBs.
+        const auto sweepLess = [&proxies, axis](std::uint32_t lhs, std::uint32_t rhs) noexcept
+        {
+            const float l = proxies[lhs].Min[axis];
+            const float r = proxies[rhs].Min[axis];
+            return l < r || (l == r && lhs < rhs);
+        };
+        std::vector<std::uint32_t>& order = cache.Order;
+        const std::size_t shiftBudget = static_cast<std::size_t>(count) * 8u;
+        std::size_t shifts = 0u;
+        bool needsFullSort = false;
+        for (std::uint32_t i = 1u; i < count && !needsFullSort; ++i)
+        {
+            const std::uint32_t value = order[i];
+            std::uint32_t j = i;
+            while (j > 0u && sweepLess(value, order[j - 1u]))
+            {
+                order[j] = order[j - 1u];
+                --j;
+                if (++shifts > shiftBudget)
+                {
+                    needsFullSort = true;
+                    break;
+                }
             }
+            order[j] = value;
         }
+        if (needsFullSort)
+            std::sort(order.begin(), order.end(), sweepLess);
 
-        return result;
+        cache.Axis = axis;
+        cache.OrderKeys.resize(count);
+        for (std::uint32_t i = 0u; i < count; ++i)
+            cache.OrderKeys[i] = proxies[order[i]].Key;
+
+        const std::uint32_t axisU = (axis + 1u) % 3u;
+        const std::uint32_t axisV = (axis + 2u) % 3u;
+        for (std::uint32_t i = 0u; i < count; ++i)
+        {
+            const BroadphaseProxy& a = proxies[order[i]];
+            for (std::uint32_t j = i + 1u; j < count; ++j)
+            {
+                const BroadphaseProxy& b = proxies[order[j]];
+                if (b.Min[axis] > a.Max[axis])
+                    break;
+                // Shapes of one body never collide with each other.
+                if ((a.Key >> 32u) == (b.Key >> 32u))
+                    continue;
+                if (a.Max[axisU] < b.Min[axisU] || b.Max[axisU] < a.Min[axisU] ||
+                    a.Max[axisV] < b.Min[axisV] || b.Max[axisV] < a.Min[axisV])
+                    continue;
+
+                const std::uint32_t lo = std::min(order[i], order[j]);
+                const std::uint32_t hi = std::max(order[i], order[j]);
+                cache.Pairs.push_back((static_cast<std::uint64_t>(lo) << 32u) | hi);
+            }
+        }
+        std::sort(cache.Pairs.begin(), cache.Pairs.end());
     }
 
     [[nodiscard]] ValidationStatus Validate(const SolverSettings& settings) noexcept
@@ -781,9 +1070,290 @@ namespace Extrinsic::Physics
         if (slot == nullptr)
             return false;
         slot->Sleep = {};
+        SyncHotBody(handle.Index);
         return true;
     }
 
+    void World::SyncHotBody(std::uint32_t slotIndex)
+    {
+        Slot& slot = m_Slots[slotIndex];
+        const BodyDescriptor& body = slot.Body;
+        if (!slot.Occupied || slot.Sleep.Asleep || !body.Enabled || body.Motion != MotionType::Dynamic)
+        {
+            RemoveHotBody(slotIndex);
+            return;
+        }
+
+        if (slot.HotIndex == kNoHotIndex)
+        {
+            slot.HotIndex = static_cast<std::uint32_t>(m_Hot.SlotIndex.size());
+            m_Hot.SlotIndex.push_back(slotIndex);
+            m_Hot.Position.PushBack(glm::vec3{0.0f});
+            m_Hot.Orientation.emplace_back(1.0f, 0.0f, 0.0f, 0.0f);
+            m_Hot.LinearVelocity.PushBack(glm::vec3{0.0f});
+            m_Hot.AngularVelocity.PushBack(glm::vec3{0.0f});
+            m_Hot.InverseMass.push_back(0.0f);
+            m_Hot.InverseInertia.PushBack(glm::vec3{0.0f});
+            m_Hot.GravityScale.push_back(0.0f);
+            m_Hot.LinearDamping.push_back(0.0f);
+            m_Hot.AngularDamping.push_back(0.0f);
+        }
+
+        const std::uint32_t row = slot.HotIndex;
+        m_Hot.Position.Set(row, body.Pose.Position);
+        m_Hot.Orientation[row] = body.Pose.Rotation;
+        m_Hot.LinearVelocity.Set(row, body.LinearVelocity);
+        m_Hot.AngularVelocity.Set(row, body.AngularVelocity);
+        m_Hot.InverseMass[row] = InverseMass(body);
+        m_Hot.InverseInertia.Set(row, InverseInertiaDiagonal(body));
+        m_Hot.GravityScale[row] = body.GravityScale;
+        m_Hot.LinearDamping[row] = SanitizedDamping(body.LinearDamping);
+        m_Hot.AngularDamping[row] = SanitizedDamping(body.AngularDamping);
+    }
+
+    void World::RemoveHotBody(std::uint32_t slotIndex) noexcept
+    {
+        Slot& slot = m_Slots[slotIndex];
+        const std::uint32_t row = slot.HotIndex;
+        if (row == kNoHotIndex)
+            return;
+
+        // Swap-remove keeps rows dense; the moved row's slot is re-pointed
+        // first so removing the last row still clears `slot`.
+        m_Slots[m_Hot.SlotIndex.back()].HotIndex = row;
+        slot.HotIndex = kNoHotIndex;
+        SwapRemoveRow(m_Hot.SlotIndex, row);
+        m_Hot.Position.SwapRemove(row);
+        SwapRemoveRow(m_Hot.Orientation, row);
+        m_Hot.LinearVelocity.SwapRemove(row);
+        m_Hot.AngularVelocity.SwapRemove(row);
+        SwapRemoveRow(m_Hot.InverseMass, row);
+        m_Hot.InverseInertia.SwapRemove(row);
+        SwapRemoveRow(m_Hot.GravityScale, row);
+        SwapRemoveRow(m_Hot.LinearDamping, row);
+        SwapRemoveRow(m_Hot.AngularDamping, row);
+    }
+
+    void World::RefreshHotStore()
+    {
+        m_Diagnostics.HotStoreReloads += static_cast<std::uint32_t>(m_HotReload.size());
+        for (const std::uint32_t slotIndex : m_HotReload)
+        {
+            m_Slots[slotIndex].ReloadQueued = false;
+            SyncHotBody(slotIndex);
+        }
+        m_HotReload.clear();
+    }
+
+    void World::WriteBackHotStore() noexcept
+    {
+        for (std::size_t row = 0u; row < m_Hot.SlotIndex.size(); ++row)
+        {
+            BodyDescriptor& body = m_Slots[m_Hot.SlotIndex[row]].Body;
+            body.Pose.Position = m_Hot.Position.Get(row);
+            body.Pose.Rotation = m_Hot.Orientation[row];
+            body.LinearVelocity = m_Hot.LinearVelocity.Get(row);
+            body.AngularVelocity = m_Hot.AngularVelocity.Get(row);
+        }
+    }
+
+    void World::IntegrateHotBodies(const StepInput& input) noexcept
+    {
+        const std::size_t count = m_Hot.SlotIndex.size();
+        const float dt = input.DeltaSeconds;
+        const float gx = input.Gravity.x;
+        const float gy = input.Gravity.y;
+        const float gz = input.Gravity.z;
+
+        float* px = m_Hot.Position.X.data();
+        float* py = m_Hot.Position.Y.data();
+        float* pz = m_Hot.Position.Z.data();
+        float* vx = m_Hot.LinearVelocity.X.data();
+        float* vy = m_Hot.LinearVelocity.Y.data();
+        float* vz = m_Hot.LinearVelocity.Z.data();
+        float* wx = m_Hot.AngularVelocity.X.data();
+        float* wy = m_Hot.AngularVelocity.Y.data();
+        float* wz = m_Hot.AngularVelocity.Z.data();
+        const float* gravityScale = m_Hot.GravityScale.data();
+        const float* linearDamping = m_Hot.LinearDamping.data();
+        const float* angularDamping = m_Hot.AngularDamping.data();
+
+        // Linear pass: branch-free over unit-stride columns so it
+        // vectorizes. Each operation is its own statement, in the same order
+        // as IntegrateDynamicBody(), so rounding matches the descriptor path.
+        for (std::size_t i = 0u; i < count; ++i)
+        {
+            const float linearFactor = ClampedDampingFactor(linearDamping[i], dt);
+            const float angularFactor = ClampedDampingFactor(angularDamping[i], dt);
+
+            const float dvx = gx * gravityScale[i] * dt;
+            const float dvy = gy * gravityScale[i] * dt;
+            const float dvz = gz * gravityScale[i] * dt;
+            vx[i] += dvx;
+            vy[i] += dvy;
+            vz[i] += dvz;
+            vx[i] *= linearFactor;
+            vy[i] *= linearFactor;
+            vz[i] *= linearFactor;
+            wx[i] *= angularFactor;
+            wy[i] *= angularFactor;
+            wz[i] *= angularFactor;
+
+            const float dpx = vx[i] * dt;
+            const float dpy = vy[i] * dt;
+            const float dpz = vz[i] * dt;
+            px[i] += dpx;
+            py[i] += dpy;
+            pz[i] += dpz;
+        }
+
+        // Angular pass: axis-angle update needs sqrt/trig; resting bodies
+        // return early inside IntegrateAngular().
+        for (std::size_t i = 0u; i < count; ++i)
+            IntegrateAngular(m_Hot.Orientation[i], glm::vec3{wx[i], wy[i], wz[i]}, dt);
+    }
+
+    bool World::SolveIsland(const IslandRecord& island,
+                            const CollisionResult& collision,
+                            const SolverSettings& settings,
+                            IslandSolveTiming& timing)
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+        timing.BodyCount = static_cast<std::uint32_t>(island.Bodies.size());
+        timing.ContactCount = static_cast<std::uint32_t>(island.ContactIndices.size());
+
+        Core::Memory::LinearArena& arena = IslandScratchArena();
+        const Core::Memory::ArenaMarker marker = arena.Mark();
+        std::vector<SolverContact> overflow{};
+        std::span<SolverContact> contacts{};
+        if (auto scratch = arena.NewArray<SolverContact>(island.ContactIndices.size()); scratch.has_value())
+        {
+            contacts = *scratch;
+        }
+        else
+        {
+            overflow.resize(island.ContactIndices.size());
+            contacts = overflow;
+        }
+
+        // Contacts without a dynamic endpoint would be skipped on every
+        // iteration, so they are dropped while resolving.
+        std::size_t contactCount = 0u;
+        for (const std::uint32_t contactIndex : island.ContactIndices)
+        {
+            const ContactRecord& contact = collision.Contacts[contactIndex];
+            Slot* slotA = ResolveSlot(contact.A.Body);
+            Slot* slotB = ResolveSlot(contact.B.Body);
+            if (slotA == nullptr || slotB == nullptr)
+                continue;
+
+            SolverContact resolved{};
+            resolved.Contact = &contact;
+            if (slotA->HotIndex != kNoHotIndex)
+            {
+                resolved.RowA = slotA->HotIndex;
+                resolved.InvA = m_Hot.InverseMass[resolved.RowA];
+            }
+            else
+            {
+                resolved.AnchorA = &slotA->Body;
+            }
+            if (slotB->HotIndex != kNoHotIndex)
+            {
+                resolved.RowB = slotB->HotIndex;
+                resolved.InvB = m_Hot.InverseMass[resolved.RowB];
+            }
+            else
+            {
+                resolved.AnchorB = &slotB->Body;
+            }
+            if (resolved.InvA + resolved.InvB <= 0.0f)
+                continue;
+            contacts[contactCount++] = resolved;
+        }
+        contacts = contacts.first(contactCount);
+
+        const auto velocityOf = [this](const BodyDescriptor* anchor, std::uint32_t row) noexcept
+        {
+            return anchor != nullptr ? anchor->LinearVelocity : m_Hot.LinearVelocity.Get(row);
+        };
+        const auto positionOf = [this](const BodyDescriptor* anchor, std::uint32_t row) noexcept
+        {
+            return anchor != nullptr ? anchor->Pose.Position : m_Hot.Position.Get(row);
+        };
+
+        bool degraded = false;
+        for (std::uint32_t iteration = 0u; iteration < settings.MaxIterations; ++iteration)
+        {
+            bool anyApplied = false;
+            ++timing.IterationsUsed;
+            for (const SolverContact& solverContact : contacts)
+            {
+                const ContactRecord& contact = *solverContact.Contact;
+                const std::uint32_t rowA = solverContact.RowA;
+                const std::uint32_t rowB = solverContact.RowB;
+                const float invA = solverContact.InvA;
+                const float invB = solverContact.InvB;
+                const float invSum = invA + invB;
+
+                // Contact normal points from A to B (Geometry
+                // ContactManifold convention, same as METHOD-001).
+                const glm::vec3 velocityA = velocityOf(solverContact.AnchorA, rowA);
+                const glm::vec3 velocityB = velocityOf(solverContact.AnchorB, rowB);
+                const glm::vec3 relativeVelocity = velocityB - velocityA;
+                const float normalSpeed = glm::dot(relativeVelocity, contact.Normal);
+                if (normalSpeed < 0.0f)
+                {
+                    const float impulse =
+                        (-(1.0f + settings.Restitution) * normalSpeed) / invSum;
+                    // Static/kinematic endpoints (zero inverse mass) may
+                    // anchor several islands at once; only dynamic endpoints
+                    // are written so concurrent islands never race.
+                    if (invA > 0.0f)
+                        m_Hot.LinearVelocity.Set(rowA, velocityA - contact.Normal * (impulse * invA));
+                    if (invB > 0.0f)
+                        m_Hot.LinearVelocity.Set(rowB, velocityB + contact.Normal * (impulse * invB));
+                    anyApplied = true;
+                }
+
+                const float correctionDepth =
+                    std::max(contact.PenetrationDepth - settings.PenetrationSlop, 0.0f);
+                if (correctionDepth > 0.0f)
+                {
+                    // Positional Baumgarte projection on the captured
+                    // manifold, applied per iteration exactly like the
+                    // METHOD-001 reference ResolveContact so parity
+                    // fixtures match; the residual is recomputed from live
+                    // shapes after all islands are solved.
+                    const glm::vec3 correction = contact.Normal *
+                        ((settings.PositionCorrectionPercent * correctionDepth) / invSum);
+                    if (invA > 0.0f)
+                        m_Hot.Position.Set(rowA, m_Hot.Position.Get(rowA) - correction * invA);
+                    if (invB > 0.0f)
+                        m_Hot.Position.Set(rowB, m_Hot.Position.Get(rowB) + correction * invB);
+                    anyApplied = true;
+                }
+
+                if (!IsFinite(positionOf(solverContact.AnchorA, rowA)) ||
+                    !IsFinite(positionOf(solverContact.AnchorB, rowB)) ||
+                    !IsFinite(velocityOf(solverContact.AnchorA, rowA)) ||
+                    !IsFinite(velocityOf(solverContact.AnchorB, rowB)))
+                {
+                    degraded = true;
+                }
+                ++timing.ContactsSolved;
+            }
+            if (!anyApplied || degraded)
+                break;
+        }
+
+        (void)arena.Rewind(marker);
+        timing.SolveNanoseconds = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - startTime).count());
+        return degraded;
+    }
+
     [[nodiscard]] SolveStepDiagnostics World::SolveStep(const StepInput& input,
                                                         const SolverSettings& settings)
     {
@@ -818,13 +1388,23 @@ namespace Extrinsic::Physics
         diagnostics.KineticEnergyBefore = kineticEnergy();
 
         // ── Integration (sleep-aware Step) ────────────────────────────────
+        // The hot store holds exactly the awake dynamic bodies; descriptors
+        // are refreshed afterwards because collision reads them.
+        RefreshHotStore();
+        IntegrateHotBodies(input);
         for (Slot& slot : m_Slots)
         {
             if (!slot.Occupied)
                 continue;
 
-            BodyDescriptor& body = slot.Body;
             ++diagnostics.Integration.BodiesVisited;
+            if (slot.HotIndex != kNoHotIndex)
+            {
+                ++diagnostics.Integration.DynamicBodiesIntegrated;
+                continue;
+            }
+
+            BodyDescriptor& body = slot.Body;
             if (!body.Enabled)
             {
                 ++diagnostics.Integration.DisabledBodiesSkipped;
@@ -839,20 +1419,17 @@ namespace Extrinsic::Physics
                 ++diagnostics.Integration.StaticBodiesSkipped;
                 break;
             case MotionType::Kinematic:
-                body.Pose.Position += body.LinearVelocity * dt;
-                IntegrateAngular(body.Pose, body.AngularVelocity, dt);
+                IntegrateKinematicBody(body, dt);
                 ++diagnostics.Integration.KinematicBodiesIntegrated;
                 break;
             case MotionType::Dynamic:
-                body.LinearVelocity += input.Gravity * body.GravityScale * dt;
-                body.LinearVelocity *= DampingFactor(body.LinearDamping, dt);
-                body.AngularVelocity *= DampingFactor(body.AngularDamping, dt);
-                body.Pose.Position += body.LinearVelocity * dt;
-                IntegrateAngular(body.Pose, body.AngularVelocity, dt);
+                // Unreachable: awake enabled dynamic bodies are always hot.
+                IntegrateDynamicBody(body, input);
                 ++diagnostics.Integration.DynamicBodiesIntegrated;
                 break;
             }
         }
+        WriteBackHotStore();
 
         // ── Contacts + islands ────────────────────────────────────────────
         const CollisionResult collision = ComputeCollisionContacts();
@@ -887,22 +1464,19 @@ namespace Extrinsic::Physics
                 if (slot != nullptr && slot->Sleep.Asleep)
                 {
                     slot->Sleep = {};
+                    SyncHotBody(handle.Index);
                     ++diagnostics.Sleep.WakeTransitions;
                 }
             }
         }
 
         // ── Iterative linear contact solve per awake island ───────────────
-        const auto inverseMass = [](const BodyDescriptor& body) noexcept
-        {
-            if (body.Motion != MotionType::Dynamic || body.Mass <= 0.0f)
-                return 0.0f;
-            return 1.0f / body.Mass;
-        };
-
-        bool degraded = false;
-        for (const IslandRecord& island : islands.Islands)
+        // Awake, contact-bearing islands in dispatch order: largest first so
+        // the longest solves start early and small islands fill in behind.
+        std::vector<std::uint32_t> solveOrder{};
+        for (std::uint32_t islandIndex = 0u; islandIndex < islands.Islands.size(); ++islandIndex)
         {
+            const IslandRecord& island = islands.Islands[islandIndex];
             if (island.ContactIndices.empty())
                 continue;
 
@@ -916,71 +1490,86 @@ namespace Extrinsic::Physics
                     break;
                 }
             }
-            if (islandAsleep)
-                continue;
-
-            std::uint32_t iterationsUsed = 0u;
-            for (std::uint32_t iteration = 0u; iteration < settings.MaxIterations; ++iteration)
+            if (!islandAsleep)
+                solveOrder.push_back(islandIndex);
+        }
+        std::sort(solveOrder.begin(), solveOrder.end(),
+                  [&islands](const std::uint32_t lhs, const std::uint32_t rhs) noexcept
+                  {
+                      const std::size_t lhsSize = islands.Islands[lhs].ContactIndices.size();
+                      const std::size_t rhsSize = islands.Islands[rhs].ContactIndices.size();
+                      if (lhsSize != rhsSize)
+                          return lhsSize > rhsSize;
+                      return lhs < rhs;
+                  });
+
+        // Each island writes only its own timing/degraded slot, and islands
+        // share no dynamic bodies, so the solve order cannot change results.
+        const std::size_t solveCount = solveOrder.size();
+        diagnostics.IslandTimings.resize(solveCount);
+        std::vector<std::uint8_t> islandDegraded(solveCount, 0u);
+        for (std::size_t k = 0u; k < solveCount; ++k)
+            diagnostics.IslandTimings[k].IslandIndex = solveOrder[k];
+
+        const bool parallel = settings.IslandSolve == IslandSolveMode::Parallel &&
+                              Core::Tasks::Scheduler::IsInitialized() &&
+                              solveCount >= std::max<std::size_t>(settings.ParallelMinIslands, 2u);
+        if (parallel)
+        {
+            Core::Tasks::CounterEvent done{static_cast<std::uint32_t>(solveCount)};
+            for (std::size_t k = 0u; k < solveCount; ++k)
             {
-                bool anyApplied = false;
-                ++iterationsUsed;
-                for (const std::uint32_t contactIndex : island.ContactIndices)
-                {
-                    const ContactRecord& contact = collision.Contacts[contactIndex];
-                    Slot* slotA = ResolveSlot(contact.A.Body);
-                    Slot* slotB = ResolveSlot(contact.B.Body);
-                    if (slotA == nullptr || slotB == nullptr)
-                        continue;
-
-                    BodyDescriptor& a = slotA->Body;
-                    BodyDescriptor& b = slotB->Body;
-                    const float invA = inverseMass(a);
-                    const float invB = inverseMass(b);
-                    const float invSum = invA + invB;
-                    if (invSum <= 0.0f)
-                        continue;
-
-                    // Contact normal points from A to B (Geometry
-                    // ContactManifold convention, same as METHOD-001).
-                    const glm::vec3 relativeVelocity = b.LinearVelocity - a.LinearVelocity;
-                    const float normalSpeed = glm::dot(relativeVelocity, contact.Normal);
-                    if (normalSpeed < 0.0f)
+                Core::Tasks::Scheduler::Dispatch(
+                    [this, k, &islands, &collision, &settings, &diagnostics, &islandDegraded, &done]()
                     {
-                        const float impulse =
-                            (-(1.0f + settings.Restitution) * normalSpeed) / invSum;
-                        a.LinearVelocity -= contact.Normal * (impulse * invA);
-                        b.LinearVelocity += contact.Normal * (impulse * invB);
-                        anyApplied = true;
-                    }
-
-                    const float correctionDepth =
-                        std::max(contact.PenetrationDepth - settings.PenetrationSlop, 0.0f);
-                    if (correctionDepth > 0.0f)
-                    {
-                        // Positional Baumgarte projection on the captured
-                        // manifold, applied per iteration exactly like the
-                        // METHOD-001 reference ResolveContact so parity
-                        // fixtures match; the residual below is recomputed
-                        // from live shapes.
-                        const glm::vec3 correction = contact.Normal *
-                            ((settings.PositionCorrectionPercent * correctionDepth) / invSum);
-                        a.Pose.Position -= correction * invA;
-                        b.Pose.Position += correction * invB;
-                        anyApplied = true;
-                    }
+                        IslandSolveTiming& timing = diagnostics.IslandTimings[k];
+                        islandDegraded[k] = SolveIsland(islands.Islands[timing.IslandIndex],
+                                                        collision, settings, timing)
+                                                ? 1u
+                                                : 0u;
+                        done.Signal();
+                    });
+            }
 
-                    if (!IsFinite(a.Pose.Position) || !IsFinite(b.Pose.Position) ||
-                        !IsFinite(a.LinearVelocity) || !IsFinite(b.LinearVelocity))
-                    {
-                        degraded = true;
-                    }
-                    ++diagnostics.ContactsSolved;
-                }
-                if (!anyApplied || degraded)
+            // Help drain the scheduler instead of blocking: observe progress
+            // before checking for work so a completion between the check and
+            // the wait cannot be missed.
+            while (!done.IsReady())
+            {
+                const auto progress = Core::Tasks::Scheduler::ObserveWorkProgress();
+                const std::uint32_t pending = done.PendingCount();
+                if (pending == 0u)
                     break;
+                if (Core::Tasks::Scheduler::TryRunOne())
+                    continue;
+                if (!Core::Tasks::Scheduler::WaitForWorkProgress(progress))
+                    done.WaitForProgress(pending);
+            }
+        }
+        else
+        {
+            for (std::size_t k = 0u; k < solveCount; ++k)
+            {
+                IslandSolveTiming& timing = diagnostics.IslandTimings[k];
+                islandDegraded[k] =
+                    SolveIsland(islands.Islands[timing.IslandIndex], collision, settings, timing) ? 1u : 0u;
             }
-            diagnostics.IterationsUsed = std::max(diagnostics.IterationsUsed, iterationsUsed);
         }
+        diagnostics.ParallelIslandSolve = parallel;
+
+        bool degraded = false;
+        for (std::size_t k = 0u; k < solveCount; ++k)
+        {
+            const IslandSolveTiming& timing = diagnostics.IslandTimings[k];
+            diagnostics.IterationsUsed = std::max(diagnostics.IterationsUsed, timing.IterationsUsed);
+            diagnostics.ContactsSolved += timing.ContactsSolved;
+            diagnostics.TotalIslandSolveNanoseconds += timing.SolveNanoseconds;
+            diagnostics.MaxIslandSolveNanoseconds =
+                std::max(diagnostics.MaxIslandSolveNanoseconds, timing.SolveNanoseconds);
+            degraded = degraded || islandDegraded[k] != 0u;
+        }
+
+        WriteBackHotStore();
 
         // ── Residuals from live shapes ────────────────────────────────────
         const CollisionResult residual = ComputeCollisionContacts();
@@ -1026,8 +1615,9 @@ namespace Extrinsic::Physics
         }
 
         // ── Sleep policy ──────────────────────────────────────────────────
-        for (Slot& slot : m_Slots)
+        for (std::uint32_t slotIndex = 0u; slotIndex < m_Slots.size(); ++slotIndex)
         {
+            Slot& slot = m_Slots[slotIndex];
             if (!slot.Occupied)
                 continue;
             const BodyDescriptor& body = slot.Body;
@@ -1050,6 +1640,7 @@ namespace Extrinsic::Physics
                     slot.Sleep.Asleep = true;
                     slot.Body.LinearVelocity = glm::vec3{0.0f};
                     slot.Body.AngularVelocity = glm::vec3{0.0f};
+                    RemoveHotBody(slotIndex);
                     ++diagnostics.Sleep.SleepTransitions;
                     ++diagnostics.Sleep.SleepingDynamicBodies;
                     continue;
@@ -1075,6 +1666,9 @@ namespace Extrinsic::Physics
     {
         m_Slots.clear();
         m_FreeList.clear();
+        m_Broadphase = {};
+        m_Hot = {};
+        m_HotReload.clear();
         m_Diagnostics.BodyCount = 0u;
     }
 }
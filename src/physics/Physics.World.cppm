@@ -144,6 +144,9 @@ export namespace Extrinsic::Physics
         std::uint32_t InvalidBodiesRejected{0u};
         std::uint32_t InvalidShapesRejected{0u};
         std::uint32_t DynamicNonUniformScaleRejects{0u};
+        // Built shapes entered into the sweep-and-prune broadphase and the
+        // candidate pairs whose (margin-inflated) world AABBs overlap.
+        std::uint32_t BroadphaseProxies{0u};
         std::uint32_t BroadphasePairs{0u};
         std::uint32_t ContactsGenerated{0u};
         std::uint32_t TriggerContacts{0u};
@@ -163,6 +166,18 @@ export namespace Extrinsic::Physics
     // and sleep timers are world internals; runtime consumes these records
     // through the diagnostics surface and never stores them in ECS.
 
+    // How SolveStep() schedules the per-island contact solve. Islands touch
+    // disjoint dynamic bodies, so both modes produce bit-identical state.
+    enum class IslandSolveMode : std::uint8_t
+    {
+        // Islands are solved one after another on the calling thread.
+        Serial,
+        // Awake islands are dispatched largest first as jobs on the
+        // Core::Tasks scheduler; the calling thread helps until all finish.
+        // Falls back to Serial when the scheduler is not initialized.
+        Parallel,
+    };
+
     // Tuning knobs for the CPU contact solver and the sleep policy. Mirrors
     // the `physics.rigid_body_reference` (`METHOD-001`) StepParams shape so
     // parity fixtures can share values.
@@ -180,6 +195,10 @@ export namespace Extrinsic::Physics
         float SleepLinearVelocityThreshold{0.05f};
         float SleepAngularVelocityThreshold{0.05f};
         float TimeToSleepSeconds{0.5f};
+        IslandSolveMode IslandSolve{IslandSolveMode::Serial};
+        // Parallel mode solves serially below this many awake islands, where
+        // dispatch overhead outweighs the work.
+        std::uint32_t ParallelMinIslands{2u};
     };
 
     // One contact island: dynamic bodies transitively connected through
@@ -233,6 +252,21 @@ export namespace Extrinsic::Physics
         Degraded,
     };
 
+    // Per-island contact solve cost for one SolveStep(), used to spot load
+    // imbalance between scheduler workers.
+    struct IslandSolveTiming
+    {
+        // Index into the IslandBuildResult::Islands the step built.
+        std::uint32_t IslandIndex{0u};
+        std::uint32_t BodyCount{0u};
+        std::uint32_t ContactCount{0u};
+        std::uint32_t IterationsUsed{0u};
+        // Contact resolutions across all iterations; the step-level
+        // ContactsSolved is the sum over islands.
+        std::uint32_t ContactsSolved{0u};
+        std::uint64_t SolveNanoseconds{0u};
+    };
+
     struct SolveStepDiagnostics
     {
         ValidationStatus Status{ValidationStatus::Valid};
@@ -255,6 +289,13 @@ export namespace Extrinsic::Physics
         IslandDiagnostics Islands{};
         SleepDiagnostics Sleep{};
         StepDiagnostics Integration{};
+        // True when the island solve actually ran on the scheduler.
+        bool ParallelIslandSolve{false};
+        // One entry per solved (awake, contact-bearing) island, in dispatch
+        // order: contact count descending, then island index ascending.
+        std::vector<IslandSolveTiming> IslandTimings{};
+        std::uint64_t TotalIslandSolveNanoseconds{0u};
+        std::uint64_t MaxIslandSolveNanoseconds{0u};
     };
 
     struct WorldDiagnostics
@@ -269,6 +310,9 @@ export namespace Extrinsic::Physics
         StepDiagnostics LastStep{};
         std::uint32_t SolveStepsExecuted{0u};
         SolveStepDiagnostics LastSolveStep{};
+        // Hot rows re-synced from descriptors handed out through the mutable
+        // GetBody(); read-only callers should use the const overload.
+        std::uint32_t HotStoreReloads{0u};
     };
 
     [[nodiscard]] ShapeDescriptor MakeSphere(float radius, const Transform& local = {});
@@ -295,11 +339,18 @@ export namespace Extrinsic::Physics
         [[nodiscard]] BodyHandle AddBody(const BodyDescriptor& descriptor);
         [[nodiscard]] bool DestroyBody(BodyHandle handle);
         [[nodiscard]] bool UpdateBody(BodyHandle handle, const BodyDescriptor& descriptor);
+        // Descriptors are authoritative between steps. Writes through the
+        // mutable pointer are picked up by the next Step()/SolveStep();
+        // re-fetch it after a step before writing again.
         [[nodiscard]] BodyDescriptor* GetBody(BodyHandle handle) noexcept;
         [[nodiscard]] const BodyDescriptor* GetBody(BodyHandle handle) const noexcept;
         [[nodiscard]] bool Contains(BodyHandle handle) const noexcept;
 
         [[nodiscard]] StepDiagnostics Step(const StepInput& input = {});
+        // Sweep-and-prune broadphase over per-shape world AABBs, then the
+        // narrowphase on every overlapping pair. Candidates and contacts are
+        // emitted in the same (slot, shape) lexicographic pair order as an
+        // all-pairs enumeration would produce.
         [[nodiscard]] CollisionResult ComputeCollisionContacts() const;
 
         // ── PHYSICS-003 ───────────────────────────────────────────────────
@@ -333,19 +384,134 @@ export namespace Extrinsic::Physics
             float LowMotionSeconds{0.0f};
         };
 
+        static constexpr std::uint32_t kNoHotIndex = ~0u;
+
+        // Hot-path fields sit first so slot scans touch one cache line.
         struct Slot
         {
             std::uint32_t Generation{1u};
+            // Row in m_Hot while the body is an awake, enabled dynamic body.
+            std::uint32_t HotIndex{kNoHotIndex};
             bool Occupied{false};
+            bool ReloadQueued{false};
             BodyDescriptor Body{};
             SleepState Sleep{};
         };
 
+        // Component-split vec3 column: unit-stride float arrays so the
+        // integration loops vectorize.
+        struct Vec3Column
+        {
+            std::vector<float> X{};
+            std::vector<float> Y{};
+            std::vector<float> Z{};
+
+            [[nodiscard]] glm::vec3 Get(std::size_t row) const noexcept { return {X[row], Y[row], Z[row]}; }
+
+            void Set(std::size_t row, const glm::vec3& value) noexcept
+            {
+                X[row] = value.x;
+                Y[row] = value.y;
+                Z[row] = value.z;
+            }
+
+            void PushBack(const glm::vec3& value)
+            {
+                X.push_back(value.x);
+                Y.push_back(value.y);
+                Z.push_back(value.z);
+            }
+
+            void SwapRemove(std::size_t row) noexcept
+            {
+                X[row] = X.back();
+                Y[row] = Y.back();
+                Z[row] = Z.back();
+                X.pop_back();
+                Y.pop_back();
+                Z.pop_back();
+            }
+        };
+
+        // Packed SoA hot store, dense over awake enabled dynamic bodies (row
+        // order is insertion order, not slot order). Integration and the
+        // contact solver run on these rows; descriptors are the cold path
+        // and are written back at the end of every Step()/SolveStep(), so
+        // they are authoritative between steps.
+        struct BodyHotStore
+        {
+            std::vector<std::uint32_t> SlotIndex{};
+            Vec3Column Position{};
+            std::vector<glm::quat> Orientation{};
+            Vec3Column LinearVelocity{};
+            Vec3Column AngularVelocity{};
+            std::vector<float> InverseMass{};
+            // Diagonal body-space inverse inertia of the primary shape. The
+            // solver is linear-only today; kept here for angular response.
+            Vec3Column InverseInertia{};
+            std::vector<float> GravityScale{};
+            // Damping coefficients, sanitized so invalid values read as 0.
+            std::vector<float> LinearDamping{};
+            std::vector<float> AngularDamping{};
+        };
+
+        // Sweep-and-prune broadphase proxy: one per built collision shape,
+        // in build order (slot index, then shape index), so `Key` ascends.
+        struct BroadphaseProxy
+        {
+            glm::vec3 Min{0.0f};
+            glm::vec3 Max{0.0f};
+            std::uint64_t Key{0u};
+        };
+
+        // Persistent broadphase state. Proxies and AABBs are refreshed on
+        // every ComputeCollisionContacts() call; the sweep-axis order of the
+        // previous call seeds the next sort, so temporally coherent scenes
+        // re-sort in near-linear time.
+        struct BroadphaseCache
+        {
+            std::vector<BroadphaseProxy> Proxies{};
+            std::vector<std::uint32_t> Order{};
+            std::vector<std::uint64_t> OrderKeys{};
+            std::vector<std::uint8_t> Seeded{};
+            std::vector<std::uint64_t> Pairs{};
+            std::uint32_t Axis{0u};
+        };
+
         [[nodiscard]] Slot* ResolveSlot(BodyHandle handle) noexcept;
         [[nodiscard]] const Slot* ResolveSlot(BodyHandle handle) const noexcept;
 
+        // Fills m_Broadphase.Pairs with packed (lower << 32 | higher) proxy
+        // index pairs whose AABBs overlap, sorted ascending so candidates
+        // keep the all-pairs enumeration order.
+        void FindBroadphasePairs() const;
+
+        // Hot store maintenance. SyncHotBody() inserts, reloads, or removes
+        // the slot's row so membership matches its descriptor and sleep
+        // state; RefreshHotStore() applies it to slots handed out through
+        // the mutable GetBody() since the last step.
+        void SyncHotBody(std::uint32_t slotIndex);
+        void RemoveHotBody(std::uint32_t slotIndex) noexcept;
+        void RefreshHotStore();
+        void WriteBackHotStore() noexcept;
+        void IntegrateHotBodies(const StepInput& input) noexcept;
+
+        // Runs the iterative contact solver on one island and fills `timing`
+        // (except IslandIndex). Writes only the island's dynamic bodies, so
+        // distinct islands may be solved concurrently. Returns true when the
+        // island degraded to a non-finite state.
+        [[nodiscard]] bool SolveIsland(const IslandRecord& island,
+                                       const CollisionResult& collision,
+                                       const SolverSettings& settings,
+                                       IslandSolveTiming& timing);
+
         std::vector<Slot> m_Slots{};
         std::vector<std::uint32_t> m_FreeList{};
         WorldDiagnostics m_Diagnostics{};
+        BodyHotStore m_Hot{};
+        std::vector<std::uint32_t> m_HotReload{};
+        // Cache only; the world is single-threaded, so the const collision
+        // query may refresh it without changing observable body state.
+        mutable BroadphaseCache m_Broadphase{};
     };
 }
@@ -1001,7 +1001,10 @@ namespace Extrinsic::Runtime
                     meshPayload = Geometry::MeshIO::LoadOFF(request.Path);
                     break;
                 case Assets::AssetFileFormat::STL:
-                    meshPayload = Geometry::MeshIO::LoadSTL(request.Path);
+                    // Welded so the imported soup converts to a connected
+                    // halfedge mesh instead of isolated triangles.
+                    meshPayload = Geometry::MeshIO::LoadSTL(
+                        request.Path, {.WeldSTLVertices = true});
                     break;
                 case Assets::AssetFileFormat::PLY:
                     meshPayload = Geometry::MeshIO::LoadPLY(request.Path);
@@ -1067,13 +1070,48 @@ namespace Extrinsic::Runtime
                 case Assets::AssetFileFormat::XYZ:
                 case Assets::AssetFileFormat::PTS:
                 case Assets::AssetFileFormat::XYZRGB:
-                    cloudPayload = Geometry::PointCloudIO::LoadXYZ(request.Path);
+                    if (request.MemoryMapSource)
+                    {
+                        Core::IO::MmapIOBackend backend;
+                        cloudPayload = Geometry::PointCloudIO::LoadXYZ(request.Path, backend);
+                    }
+                    else
+                    {
+                        cloudPayload = Geometry::PointCloudIO::LoadXYZ(request.Path);
+                    }
                     break;
                 case Assets::AssetFileFormat::PCD:
-                    cloudPayload = Geometry::PointCloudIO::LoadPCD(request.Path);
+                    if (request.MemoryMapSource)
+                    {
+                        Core::IO::MmapIOBackend backend;
+                        cloudPayload = Geometry::PointCloudIO::LoadPCD(request.Path, backend);
+                    }
+                    else
+                    {
+                        cloudPayload = Geometry::PointCloudIO::LoadPCD(request.Path);
+                    }
+                    break;
+                case Assets::AssetFileFormat::LAS:
+                    if (request.MemoryMapSource)
+                    {
+                        Core::IO::MmapIOBackend backend;
+                        cloudPayload = Geometry::PointCloudIO::LoadLAS(request.Path, backend);
+                    }
+                    else
+                    {
+                        cloudPayload = Geometry::PointCloudIO::LoadLAS(request.Path);
+                    }
                     break;
                 case Assets::AssetFileFormat::PLY:
-                    cloudPayload = Geometry::PointCloudIO::LoadPLY(request.Path);
+                    if (request.MemoryMapSource)
+                    {
+                        Core::IO::MmapIOBackend backend;
+                        cloudPayload = Geometry::PointCloudIO::LoadPLY(request.Path, backend);
+                    }
+                    else
+                    {
+                        cloudPayload = Geometry::PointCloudIO::LoadPLY(request.Path);
+                    }
                     break;
                 default:
                     break;
@@ -1598,6 +1636,7 @@ namespace Extrinsic::Runtime
         return QueueAssetImport(AssetImportRecipe{
             .Path = std::move(request.Path),
             .PayloadKind = request.PayloadKind,
+            .MemoryMapSource = request.MemoryMapSource,
         });
     }
 
@@ -1989,6 +2028,7 @@ namespace Extrinsic::Runtime
         RuntimeAssetImportRequest request{
             .Path = recipe.Path,
             .PayloadKind = recipe.PayloadKind,
+            .MemoryMapSource = recipe.MemoryMapSource,
         };
         if (!payloadKinds.empty())
             request.PayloadKind = payloadKinds.front();
@@ -2156,6 +2196,7 @@ namespace Extrinsic::Runtime
                 .Work = [
                     state,
                     path = request.Path,
+                    memoryMapSource = request.MemoryMapSource,
                     beforeDecodeHook = std::move(beforeDecodeHook),
                     payloadKinds = std::move(payloadKinds)](
                         const JobCancellation&) mutable
@@ -2168,6 +2209,7 @@ namespace Extrinsic::Runtime
                         RuntimeAssetImportRequest request{
                             .Path = path,
                             .PayloadKind = payloadKind,
+                            .MemoryMapSource = memoryMapSource,
                         };
                         auto decoded = DecodeGeometryImport(request);
                         state->Request = request;
@@ -3462,6 +3504,7 @@ namespace Extrinsic::Runtime
                 RuntimeAssetImportRequest{
                     .Path = request.Path,
                     .PayloadKind = route->PayloadKind,
+                    .MemoryMapSource = request.MemoryMapSource,
                 });
             if (!decoded.has_value())
             {
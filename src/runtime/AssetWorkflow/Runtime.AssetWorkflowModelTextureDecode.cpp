@@ -84,7 +84,7 @@ namespace Extrinsic::Runtime
             auto read = backend.Read(Core::IO::IORequest{.Path = std::string(path)});
             if (!read.has_value())
                 return std::unexpected(read.error());
-            return std::move(read->Data);
+            return read->TakeBytes();
         }
 
         [[nodiscard]] Core::Expected<ExternalResourceRead>
@@ -65,6 +65,8 @@ namespace Extrinsic::Runtime
         AssetImportPostprocessPolicy Postprocess{
             AssetImportPostprocessPolicy::PrepareRenderableGeometry};
         AssetImportCompletionRecipe Completion{};
+        // See RuntimeAssetImportRequest::MemoryMapSource.
+        bool MemoryMapSource{false};
     };
 
     export struct AssetImportExecutionIdentity
@@ -253,6 +255,9 @@ namespace Extrinsic::Runtime
     {
         std::string Path{};
         Assets::AssetPayloadKind PayloadKind{Assets::AssetPayloadKind::Unknown};
+        // Decode XYZ/PCD/PLY/LAS point clouds straight from a memory-mapped
+        // view of the source instead of reading it into a heap buffer first.
+        bool MemoryMapSource{false};
     };
 
     export struct RuntimeAssetReimportRequest
@@ -909,8 +909,10 @@ namespace Extrinsic::Runtime
 
             for (Binding* const binding : bindings)
             {
+                // Read-only: the mutable overload would queue a hot-store
+                // re-sync for every bound body on the next step.
                 const Physics::BodyDescriptor* const body =
-                    state.World.GetBody(binding->Handle);
+                    std::as_const(state.World).GetBody(binding->Handle);
                 if (body == nullptr || !raw.valid(binding->Entity) ||
                     !raw.all_of<Transform::Component>(binding->Entity))
                 {
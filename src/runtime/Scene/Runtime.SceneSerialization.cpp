@@ -1,6 +1,8 @@
 module;
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -8,6 +10,7 @@ module;
 #include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -442,6 +445,185 @@ namespace Extrinsic::Runtime
             return true;
         }
 
+        // ------------------------------------------------------------------
+        // Binary scene container.
+        //
+        //   [BinaryHeader][BlobEntry x BlobCount][entity table][payload]
+        //
+        // The entity table is the version-2 document encoded as CBOR, except
+        // that geometry channels are `{"blob": index}` references instead of
+        // JSON arrays. Each blob is one raw little-endian channel (uint32,
+        // vec2 or vec3 of float32) starting on a kBlobAlignment boundary of
+        // the payload, so loading a channel is one bounds check and one copy
+        // into its PropertySet vector, and a mapped file can serve the blobs
+        // in place. All offsets are absolute file offsets except
+        // BlobEntry::Offset, which is relative to PayloadOffset.
+        // ------------------------------------------------------------------
+        constexpr std::array<char, 8> kBinarySceneMagic{'I', 'S', 'C', 'N', 'B', 'I', 'N', '\0'};
+        constexpr std::uint32_t kBinarySceneVersion = 1u;
+        constexpr std::size_t kBlobAlignment = 64u;
+
+        struct BinaryHeader
+        {
+            std::array<char, 8> Magic{};
+            std::uint32_t Version{0u};
+            std::uint32_t BlobCount{0u};
+            std::uint64_t BlobTableOffset{0u};
+            std::uint64_t EntityTableOffset{0u};
+            std::uint64_t EntityTableSize{0u};
+            std::uint64_t PayloadOffset{0u};
+            std::uint64_t PayloadSize{0u};
+            std::uint64_t Reserved{0u};
+        };
+
+        enum class BlobKind : std::uint32_t
+        {
+            UInt32 = 1u,
+            Vec2F32 = 2u,
+            Vec3F32 = 3u,
+        };
+
+        struct BlobEntry
+        {
+            std::uint64_t Offset{0u};
+            std::uint64_t ElementCount{0u};
+            std::uint32_t Kind{0u};
+            std::uint32_t ElementSize{0u};
+        };
+
+        static_assert(sizeof(BinaryHeader) == 64u && std::is_trivially_copyable_v<BinaryHeader>);
+        static_assert(sizeof(BlobEntry) == 24u && std::is_trivially_copyable_v<BlobEntry>);
+        static_assert(sizeof(glm::vec2) == 2u * sizeof(float) &&
+                      sizeof(glm::vec3) == 3u * sizeof(float),
+                      "Blob channels are copied as tightly packed float32 tuples.");
+
+        template <typename T>
+        [[nodiscard]] constexpr BlobKind BlobKindOf() noexcept
+        {
+            if constexpr (std::is_same_v<T, glm::vec2>)
+                return BlobKind::Vec2F32;
+            else if constexpr (std::is_same_v<T, glm::vec3>)
+                return BlobKind::Vec3F32;
+            else
+            {
+                static_assert(std::is_same_v<T, std::uint32_t>);
+                return BlobKind::UInt32;
+            }
+        }
+
+        [[nodiscard]] constexpr std::uint64_t AlignBlobOffset(const std::uint64_t offset) noexcept
+        {
+            return (offset + kBlobAlignment - 1u) / kBlobAlignment * kBlobAlignment;
+        }
+
+        class BlobWriter
+        {
+        public:
+            template <typename T>
+            [[nodiscard]] json Append(const std::vector<T>& values)
+            {
+                const std::uint64_t offset = AlignBlobOffset(m_Payload.size());
+                const std::size_t bytes = values.size() * sizeof(T);
+                m_Payload.resize(static_cast<std::size_t>(offset) + bytes);
+                if (bytes != 0u)
+                    std::memcpy(m_Payload.data() + offset, values.data(), bytes);
+
+                m_Blobs.push_back(BlobEntry{
+                    .Offset = offset,
+                    .ElementCount = values.size(),
+                    .Kind = static_cast<std::uint32_t>(BlobKindOf<T>()),
+                    .ElementSize = static_cast<std::uint32_t>(sizeof(T)),
+                });
+                return json{{"blob", m_Blobs.size() - 1u}};
+            }
+
+            [[nodiscard]] const std::vector<BlobEntry>& Blobs() const noexcept { return m_Blobs; }
+            [[nodiscard]] const std::vector<std::byte>& Payload() const noexcept { return m_Payload; }
+
+        private:
+            std::vector<BlobEntry> m_Blobs{};
+            std::vector<std::byte> m_Payload{};
+        };
+
+        class BlobReader
+        {
+        public:
+            BlobReader(std::vector<BlobEntry> blobs, const std::span<const std::byte> payload)
+                : m_Blobs(std::move(blobs)), m_Payload(payload)
+            {
+            }
+
+            template <typename T>
+            [[nodiscard]] bool Read(const json& ref, std::vector<T>& out) const
+            {
+                if (!ref.is_object() || !ref.contains("blob") || !ref["blob"].is_number_unsigned())
+                    return false;
+                const std::uint64_t index = ref["blob"].get<std::uint64_t>();
+                if (index >= m_Blobs.size())
+                    return false;
+
+                const BlobEntry& blob = m_Blobs[static_cast<std::size_t>(index)];
+                if (blob.Kind != static_cast<std::uint32_t>(BlobKindOf<T>()) ||
+                    blob.ElementSize != sizeof(T) ||
+                    blob.Offset > m_Payload.size() ||
+                    blob.ElementCount > (m_Payload.size() - blob.Offset) / sizeof(T))
+                {
+                    return false;
+                }
+
+                std::vector<T> decoded(static_cast<std::size_t>(blob.ElementCount));
+                if (!decoded.empty())
+                {
+                    std::memcpy(decoded.data(),
+                                m_Payload.data() + blob.Offset,
+                                decoded.size() * sizeof(T));
+                }
+                out = std::move(decoded);
+                return true;
+            }
+
+        private:
+            std::vector<BlobEntry> m_Blobs;
+            std::span<const std::byte> m_Payload;
+        };
+
+        [[nodiscard]] bool HasBinarySceneMagic(const std::span<const std::byte> data) noexcept
+        {
+            return data.size() >= kBinarySceneMagic.size() &&
+                   std::memcmp(data.data(), kBinarySceneMagic.data(), kBinarySceneMagic.size()) == 0;
+        }
+
+        // Geometry channels go through these two helpers. A null blob
+        // writer/reader selects the JSON text form; the binary container
+        // passes its blob table and channels become blob references.
+        template <typename T>
+        [[nodiscard]] json ChannelToJson(const std::vector<T>& values, BlobWriter* blobs)
+        {
+            if (blobs != nullptr)
+                return blobs->Append(values);
+            if constexpr (std::is_same_v<T, glm::vec2>)
+                return Vec2ArrayToJson(values);
+            else if constexpr (std::is_same_v<T, glm::vec3>)
+                return Vec3ArrayToJson(values);
+            else
+                return UIntArrayToJson(values);
+        }
+
+        template <typename T>
+        [[nodiscard]] bool TryReadChannel(const json& value,
+                                          const BlobReader* blobs,
+                                          std::vector<T>& out)
+        {
+            if (value.is_object())
+                return blobs != nullptr && blobs->Read(value, out);
+            if constexpr (std::is_same_v<T, glm::vec2>)
+                return TryReadVec2Array(value, out);
+            else if constexpr (std::is_same_v<T, glm::vec3>)
+                return TryReadVec3Array(value, out);
+            else
+                return TryReadUIntArray(value, out);
+        }
+
         [[nodiscard]] bool ReadOptionalDeleted(const json& object,
                                                std::size_t& out) noexcept
         {
@@ -489,12 +671,13 @@ namespace Extrinsic::Runtime
                                            const char* key,
                                            const Geometry::PropertySet& properties,
                                            const std::string_view propertyName,
-                                           const bool required)
+                                           const bool required,
+                                           BlobWriter* blobs)
         {
             const std::vector<glm::vec2>* values = FindVec2Property(properties, propertyName);
             if (values == nullptr)
                 return !required;
-            object[key] = Vec2ArrayToJson(*values);
+            object[key] = ChannelToJson(*values, blobs);
             return true;
         }
 
@@ -502,12 +685,13 @@ namespace Extrinsic::Runtime
                                            const char* key,
                                            const Geometry::PropertySet& properties,
                                            const std::string_view propertyName,
-                                           const bool required)
+                                           const bool required,
+                                           BlobWriter* blobs)
         {
             const std::vector<glm::vec3>* values = FindVec3Property(properties, propertyName);
             if (values == nullptr)
                 return !required;
-            object[key] = Vec3ArrayToJson(*values);
+            object[key] = ChannelToJson(*values, blobs);
             return true;
         }
 
@@ -515,12 +699,13 @@ namespace Extrinsic::Runtime
                                            const char* key,
                                            const Geometry::PropertySet& properties,
                                            const std::string_view propertyName,
-                                           const bool required)
+                                           const bool required,
+                                           BlobWriter* blobs)
         {
             const std::vector<std::uint32_t>* values = FindUIntProperty(properties, propertyName);
             if (values == nullptr)
                 return !required;
-            object[key] = UIntArrayToJson(*values);
+            object[key] = ChannelToJson(*values, blobs);
             return true;
         }
 
@@ -1479,22 +1664,23 @@ namespace Extrinsic::Runtime
 
         [[nodiscard]] bool AddVertices(json& geometry,
                                        const GS::Vertices& vertices,
-                                       const bool requirePositions)
+                                       const bool requirePositions,
+                                       BlobWriter* blobs)
         {
             json out = json::object();
             out["deleted"] = vertices.NumDeleted;
             if (!AddVec3Property(out, "positions", vertices.Properties,
-                                 PN::kPosition, requirePositions))
+                                 PN::kPosition, requirePositions, blobs))
             {
                 return false;
             }
             if (!AddVec3Property(out, "normals", vertices.Properties,
-                                 PN::kNormal, false))
+                                 PN::kNormal, false, blobs))
             {
                 return false;
             }
             if (!AddVec2Property(out, "texcoords", vertices.Properties,
-                                 "v:texcoord", false))
+                                 "v:texcoord", false, blobs))
             {
                 return false;
             }
@@ -1502,17 +1688,17 @@ namespace Extrinsic::Runtime
             return true;
         }
 
-        [[nodiscard]] bool AddNodes(json& geometry, const GS::Vertices& nodes)
+        [[nodiscard]] bool AddNodes(json& geometry, const GS::Vertices& nodes, BlobWriter* blobs)
         {
             json out = json::object();
             out["deleted"] = nodes.NumDeleted;
             if (!AddVec3Property(out, "positions", nodes.Properties,
-                                 PN::kPosition, true))
+                                 PN::kPosition, true, blobs))
             {
                 return false;
             }
             if (!AddVec3Property(out, "normals", nodes.Properties,
-                                 PN::kNormal, false))
+                                 PN::kNormal, false, blobs))
             {
                 return false;
             }
@@ -1520,12 +1706,12 @@ namespace Extrinsic::Runtime
             return true;
         }
 
-        [[nodiscard]] bool AddEdges(json& geometry, const GS::Edges& edges)
+        [[nodiscard]] bool AddEdges(json& geometry, const GS::Edges& edges, BlobWriter* blobs)
         {
             json out = json::object();
             out["deleted"] = edges.NumDeleted;
-            if (!AddUIntProperty(out, "v0", edges.Properties, PN::kEdgeV0, true) ||
-                !AddUIntProperty(out, "v1", edges.Properties, PN::kEdgeV1, true))
+            if (!AddUIntProperty(out, "v0", edges.Properties, PN::kEdgeV0, true, blobs) ||
+                !AddUIntProperty(out, "v1", edges.Properties, PN::kEdgeV1, true, blobs))
             {
                 return false;
             }
@@ -1534,15 +1720,16 @@ namespace Extrinsic::Runtime
         }
 
         [[nodiscard]] bool AddHalfedges(json& geometry,
-                                        const GS::Halfedges& halfedges)
+                                        const GS::Halfedges& halfedges,
+                                        BlobWriter* blobs)
         {
             json out = json::object();
             if (!AddUIntProperty(out, "toVertex", halfedges.Properties,
-                                 PN::kHalfedgeToVertex, true) ||
+                                 PN::kHalfedgeToVertex, true, blobs) ||
                 !AddUIntProperty(out, "next", halfedges.Properties,
-                                 PN::kHalfedgeNext, true) ||
+                                 PN::kHalfedgeNext, true, blobs) ||
                 !AddUIntProperty(out, "face", halfedges.Properties,
-                                 PN::kHalfedgeFace, true))
+                                 PN::kHalfedgeFace, true, blobs))
             {
                 return false;
             }
@@ -1550,12 +1737,12 @@ namespace Extrinsic::Runtime
             // domain and has no `v:texcoord` at all, so saving only the vertex
             // channel silently dropped them on round-trip.
             if (!AddVec2Property(out, "texcoords", halfedges.Properties,
-                                 "h:texcoord", false))
+                                 "h:texcoord", false, blobs))
             {
                 return false;
             }
             if (!AddVec3Property(out, "normals", halfedges.Properties,
-                                 "h:normal", false))
+                                 "h:normal", false, blobs))
             {
                 return false;
             }
@@ -1565,7 +1752,8 @@ namespace Extrinsic::Runtime
 
         [[nodiscard]] bool AddGraphHalfedges(
             json& geometry,
-            const GS::Halfedges& halfedges)
+            const GS::Halfedges& halfedges,
+            BlobWriter* blobs)
         {
             const auto connectivity =
                 halfedges.Properties.Get<
@@ -1593,9 +1781,9 @@ namespace Extrinsic::Runtime
             }
 
             json out = json::object();
-            out["toVertex"] = UIntArrayToJson(toVertex);
-            out["next"] = UIntArrayToJson(next);
-            out["prev"] = UIntArrayToJson(prev);
+            out["toVertex"] = ChannelToJson(toVertex, blobs);
+            out["next"] = ChannelToJson(next, blobs);
+            out["prev"] = ChannelToJson(prev, blobs);
             geometry["halfedges"] = std::move(out);
             return true;
         }
@@ -1685,12 +1873,12 @@ namespace Extrinsic::Runtime
             return true;
         }
 
-        [[nodiscard]] bool AddFaces(json& geometry, const GS::Faces& faces)
+        [[nodiscard]] bool AddFaces(json& geometry, const GS::Faces& faces, BlobWriter* blobs)
         {
             json out = json::object();
             out["deleted"] = faces.NumDeleted;
             if (!AddUIntProperty(out, "halfedge", faces.Properties,
-                                 PN::kFaceHalfedge, true))
+                                 PN::kFaceHalfedge, true, blobs))
             {
                 return false;
             }
@@ -1701,6 +1889,7 @@ namespace Extrinsic::Runtime
         [[nodiscard]] bool AddGeometry(json& entityJson,
                                        const entt::registry& raw,
                                        const ECS::EntityHandle entity,
+                                       BlobWriter* blobs,
                                        SceneSerializationStats& stats)
         {
             const GS::ConstSourceView view = GS::BuildConstView(raw, entity);
@@ -1720,10 +1909,10 @@ namespace Extrinsic::Runtime
                 {
                     return false;
                 }
-                if (!AddVertices(geometry, *view.VertexSource, true) ||
-                    !AddEdges(geometry, *view.EdgeSource) ||
-                    !AddHalfedges(geometry, *view.HalfedgeSource) ||
-                    !AddFaces(geometry, *view.FaceSource))
+                if (!AddVertices(geometry, *view.VertexSource, true, blobs) ||
+                    !AddEdges(geometry, *view.EdgeSource, blobs) ||
+                    !AddHalfedges(geometry, *view.HalfedgeSource, blobs) ||
+                    !AddFaces(geometry, *view.FaceSource, blobs))
                 {
                     return false;
                 }
@@ -1737,9 +1926,9 @@ namespace Extrinsic::Runtime
                 if (!ValidateGraphSources(*view.VertexSource,
                                           *view.HalfedgeSource,
                                           *view.EdgeSource) ||
-                    !AddNodes(geometry, *view.VertexSource) ||
-                    !AddGraphHalfedges(geometry, *view.HalfedgeSource) ||
-                    !AddEdges(geometry, *view.EdgeSource))
+                    !AddNodes(geometry, *view.VertexSource, blobs) ||
+                    !AddGraphHalfedges(geometry, *view.HalfedgeSource, blobs) ||
+                    !AddEdges(geometry, *view.EdgeSource, blobs))
                 {
                     return false;
                 }
@@ -1748,7 +1937,7 @@ namespace Extrinsic::Runtime
             case GS::Domain::PointCloud:
                 if (view.VertexSource == nullptr)
                     return false;
-                if (!AddVertices(geometry, *view.VertexSource, true))
+                if (!AddVertices(geometry, *view.VertexSource, true, blobs))
                     return false;
                 ++stats.PointCloudEntities;
                 break;
@@ -1765,6 +1954,7 @@ namespace Extrinsic::Runtime
                                          const ECS::EntityHandle entity,
                                          const json& value,
                                          const bool requirePositions,
+                                         const BlobReader* blobs,
                                          GS::Vertices*& out)
         {
             if (!value.is_object())
@@ -1777,7 +1967,7 @@ namespace Extrinsic::Runtime
             std::vector<glm::vec3> positions;
             if (value.contains("positions"))
             {
-                if (!TryReadVec3Array(value["positions"], positions))
+                if (!TryReadChannel(value["positions"], blobs, positions))
                     return false;
             }
             else if (requirePositions)
@@ -1792,7 +1982,7 @@ namespace Extrinsic::Runtime
             if (value.contains("normals"))
             {
                 std::vector<glm::vec3> normals;
-                if (!TryReadVec3Array(value["normals"], normals) ||
+                if (!TryReadChannel(value["normals"], blobs, normals) ||
                     normals.size() != vertices.Properties.Size())
                 {
                     return false;
@@ -1802,7 +1992,7 @@ namespace Extrinsic::Runtime
             if (value.contains("texcoords"))
             {
                 std::vector<glm::vec2> texcoords;
-                if (!TryReadVec2Array(value["texcoords"], texcoords) ||
+                if (!TryReadChannel(value["texcoords"], blobs, texcoords) ||
                     texcoords.size() != vertices.Properties.Size())
                 {
                     return false;
@@ -1816,7 +2006,8 @@ namespace Extrinsic::Runtime
 
         [[nodiscard]] bool ApplyGraphVertices(entt::registry& raw,
                                               const ECS::EntityHandle entity,
-                                              const json& value)
+                                              const json& value,
+                                              const BlobReader* blobs)
         {
             if (!value.is_object() || !value.contains("positions"))
                 return false;
@@ -1824,7 +2015,7 @@ namespace Extrinsic::Runtime
             std::size_t deleted = 0u;
             std::vector<glm::vec3> positions;
             if (!ReadOptionalDeleted(value, deleted) ||
-                !TryReadVec3Array(value["positions"], positions))
+                !TryReadChannel(value["positions"], blobs, positions))
             {
                 return false;
             }
@@ -1834,7 +2025,7 @@ namespace Extrinsic::Runtime
             if (value.contains("normals"))
             {
                 std::vector<glm::vec3> normals;
-                if (!TryReadVec3Array(value["normals"], normals) ||
+                if (!TryReadChannel(value["normals"], blobs, normals) ||
                     normals.size() != nodes.Properties.Size())
                 {
                     return false;
@@ -1848,7 +2039,8 @@ namespace Extrinsic::Runtime
 
         [[nodiscard]] bool ApplyEdges(entt::registry& raw,
                                       const ECS::EntityHandle entity,
-                                      const json& value)
+                                      const json& value,
+                                      const BlobReader* blobs)
         {
             if (!value.is_object() ||
                 !value.contains("v0") ||
@@ -1861,8 +2053,8 @@ namespace Extrinsic::Runtime
             std::vector<std::uint32_t> v0;
             std::vector<std::uint32_t> v1;
             if (!ReadOptionalDeleted(value, deleted) ||
-                !TryReadUIntArray(value["v0"], v0) ||
-                !TryReadUIntArray(value["v1"], v1) ||
+                !TryReadChannel(value["v0"], blobs, v0) ||
+                !TryReadChannel(value["v1"], blobs, v1) ||
                 v0.size() != v1.size())
             {
                 return false;
@@ -1878,7 +2070,8 @@ namespace Extrinsic::Runtime
 
         [[nodiscard]] bool ApplyHalfedges(entt::registry& raw,
                                           const ECS::EntityHandle entity,
-                                          const json& value)
+                                          const json& value,
+                                          const BlobReader* blobs)
         {
             if (!value.is_object() ||
                 !value.contains("toVertex") ||
@@ -1891,9 +2084,9 @@ namespace Extrinsic::Runtime
             std::vector<std::uint32_t> toVertex;
             std::vector<std::uint32_t> next;
             std::vector<std::uint32_t> face;
-            if (!TryReadUIntArray(value["toVertex"], toVertex) ||
-                !TryReadUIntArray(value["next"], next) ||
-                !TryReadUIntArray(value["face"], face) ||
+            if (!TryReadChannel(value["toVertex"], blobs, toVertex) ||
+                !TryReadChannel(value["next"], blobs, next) ||
+                !TryReadChannel(value["face"], blobs, face) ||
                 toVertex.size() != next.size() ||
                 toVertex.size() != face.size())
             {
@@ -1908,7 +2101,7 @@ namespace Extrinsic::Runtime
             if (value.contains("texcoords"))
             {
                 std::vector<glm::vec2> texcoords;
-                if (!TryReadVec2Array(value["texcoords"], texcoords) ||
+                if (!TryReadChannel(value["texcoords"], blobs, texcoords) ||
                     texcoords.size() != halfedgeCount)
                 {
                     return false;
@@ -1918,7 +2111,7 @@ namespace Extrinsic::Runtime
             if (value.contains("normals"))
             {
                 std::vector<glm::vec3> normals;
-                if (!TryReadVec3Array(value["normals"], normals) ||
+                if (!TryReadChannel(value["normals"], blobs, normals) ||
                     normals.size() != halfedgeCount)
                 {
                     return false;
@@ -1932,7 +2125,8 @@ namespace Extrinsic::Runtime
         [[nodiscard]] bool ApplyGraphHalfedges(
             entt::registry& raw,
             const ECS::EntityHandle entity,
-            const json& value)
+            const json& value,
+            const BlobReader* blobs)
         {
             if (!value.is_object() ||
                 !value.contains("toVertex") ||
@@ -1945,9 +2139,9 @@ namespace Extrinsic::Runtime
             std::vector<std::uint32_t> toVertex{};
             std::vector<std::uint32_t> next{};
             std::vector<std::uint32_t> prev{};
-            if (!TryReadUIntArray(value["toVertex"], toVertex) ||
-                !TryReadUIntArray(value["next"], next) ||
-                !TryReadUIntArray(value["prev"], prev) ||
+            if (!TryReadChannel(value["toVertex"], blobs, toVertex) ||
+                !TryReadChannel(value["next"], blobs, next) ||
+                !TryReadChannel(value["prev"], blobs, prev) ||
                 toVertex.size() != next.size() ||
                 toVertex.size() != prev.size() ||
                 (toVertex.size() % 2u) != 0u)
@@ -1980,7 +2174,8 @@ namespace Extrinsic::Runtime
 
         [[nodiscard]] bool ApplyFaces(entt::registry& raw,
                                       const ECS::EntityHandle entity,
-                                      const json& value)
+                                      const json& value,
+                                      const BlobReader* blobs)
         {
             if (!value.is_object() || !value.contains("halfedge"))
                 return false;
@@ -1988,7 +2183,7 @@ namespace Extrinsic::Runtime
             std::size_t deleted = 0u;
             std::vector<std::uint32_t> halfedge;
             if (!ReadOptionalDeleted(value, deleted) ||
-                !TryReadUIntArray(value["halfedge"], halfedge))
+                !TryReadChannel(value["halfedge"], blobs, halfedge))
             {
                 return false;
             }
@@ -2003,6 +2198,7 @@ namespace Extrinsic::Runtime
         [[nodiscard]] bool ApplyGeometry(entt::registry& raw,
                                          const ECS::EntityHandle entity,
                                          const json& geometry,
+                                         const BlobReader* blobs,
                                          SceneSerializationStats& stats)
         {
             if (!geometry.is_object() ||
@@ -2028,10 +2224,10 @@ namespace Extrinsic::Runtime
                     return false;
                 }
                 GS::Vertices* vertices = nullptr;
-                if (!ApplyVertices(raw, entity, geometry["vertices"], true, vertices) ||
-                    !ApplyEdges(raw, entity, geometry["edges"]) ||
-                    !ApplyHalfedges(raw, entity, geometry["halfedges"]) ||
-                    !ApplyFaces(raw, entity, geometry["faces"]))
+                if (!ApplyVertices(raw, entity, geometry["vertices"], true, blobs, vertices) ||
+                    !ApplyEdges(raw, entity, geometry["edges"], blobs) ||
+                    !ApplyHalfedges(raw, entity, geometry["halfedges"], blobs) ||
+                    !ApplyFaces(raw, entity, geometry["faces"], blobs))
                 {
                     return false;
                 }
@@ -2044,9 +2240,9 @@ namespace Extrinsic::Runtime
                     !geometry.contains("halfedges") ||
                     !geometry.contains("edges"))
                     return false;
-                if (!ApplyGraphVertices(raw, entity, geometry["nodes"]) ||
-                    !ApplyGraphHalfedges(raw, entity, geometry["halfedges"]) ||
-                    !ApplyEdges(raw, entity, geometry["edges"]))
+                if (!ApplyGraphVertices(raw, entity, geometry["nodes"], blobs) ||
+                    !ApplyGraphHalfedges(raw, entity, geometry["halfedges"], blobs) ||
+                    !ApplyEdges(raw, entity, geometry["edges"], blobs))
                 {
                     return false;
                 }
@@ -2065,7 +2261,7 @@ namespace Extrinsic::Runtime
                 if (!geometry.contains("vertices"))
                     return false;
                 GS::Vertices* vertices = nullptr;
-                if (!ApplyVertices(raw, entity, geometry["vertices"], true, vertices))
+                if (!ApplyVertices(raw, entity, geometry["vertices"], true, blobs, vertices))
                     return false;
                 ++stats.PointCloudEntities;
                 break;
@@ -2200,7 +2396,8 @@ namespace Extrinsic::Runtime
 
         [[nodiscard]] Core::Expected<SceneDeserializationResult> DeserializeSceneRoot(
             ECS::Scene::Registry& scene,
-            const json& root)
+            const json& root,
+            const BlobReader* blobs)
         {
             if (!root.is_object() ||
                 !root.contains("version") ||
@@ -2270,7 +2467,7 @@ namespace Extrinsic::Runtime
                 }
 
                 if (entityJson.contains("geometrySources") &&
-                    !ApplyGeometry(raw, entity, entityJson["geometrySources"], result.Stats))
+                    !ApplyGeometry(raw, entity, entityJson["geometrySources"], blobs, result.Stats))
                 {
                     return Core::Err<SceneDeserializationResult>(Core::ErrorCode::InvalidFormat);
                 }
@@ -2318,109 +2515,168 @@ namespace Extrinsic::Runtime
             scene.Raw() = std::move(loadedScene.Raw());
             return result;
         }
-    }
-
-    Core::Expected<std::string> SerializeSceneDocument(const ECS::Scene::Registry& scene)
-    {
-        const entt::registry& raw = scene.Raw();
-        const std::vector<ECS::EntityHandle> entities = SortedEntities(raw);
-        std::unordered_map<ECS::EntityHandle, std::uint32_t> entityToId;
-        entityToId.reserve(entities.size());
-        for (std::uint32_t index = 0u; index < entities.size(); ++index)
-            entityToId.emplace(entities[index], index);
-
-        SceneSerializationStats stats{};
-        json root = json::object();
-        root["version"] = kSceneDocumentVersion;
-        root["entities"] = json::array();
 
-        for (std::uint32_t index = 0u; index < entities.size(); ++index)
+        [[nodiscard]] Core::Expected<json> SerializeSceneRoot(
+            const ECS::Scene::Registry& scene,
+            BlobWriter* blobs,
+            SceneSerializationStats& stats)
         {
-            const ECS::EntityHandle entity = entities[index];
-            json entityJson = json::object();
-            entityJson["id"] = index;
+            const entt::registry& raw = scene.Raw();
+            const std::vector<ECS::EntityHandle> entities = SortedEntities(raw);
+            std::unordered_map<ECS::EntityHandle, std::uint32_t> entityToId;
+            entityToId.reserve(entities.size());
+            for (std::uint32_t index = 0u; index < entities.size(); ++index)
+                entityToId.emplace(entities[index], index);
 
-            std::string name = "Entity " + std::to_string(EntitySortKey(entity));
-            if (const auto* meta = raw.try_get<ECSC::MetaData>(entity);
-                meta != nullptr && !meta->EntityName.empty())
-            {
-                name = meta->EntityName;
-            }
-            entityJson["name"] = std::move(name);
+            json root = json::object();
+            root["version"] = kSceneDocumentVersion;
+            root["entities"] = json::array();
 
-            if (const auto* stableId = raw.try_get<ECSC::StableId>(entity);
-                stableId != nullptr && ECSC::IsValid(*stableId))
+            for (std::uint32_t index = 0u; index < entities.size(); ++index)
             {
-                entityJson["stableId"] = json{
-                    {"high", stableId->High},
-                    {"low", stableId->Low},
-                };
-            }
+                const ECS::EntityHandle entity = entities[index];
+                json entityJson = json::object();
+                entityJson["id"] = index;
 
-            const bool selectable = raw.all_of<Sel::SelectableTag>(entity);
-            entityJson["selectable"] = selectable;
-            if (selectable)
-                ++stats.SelectableEntities;
+                std::string name = "Entity " + std::to_string(EntitySortKey(entity));
+                if (const auto* meta = raw.try_get<ECSC::MetaData>(entity);
+                    meta != nullptr && !meta->EntityName.empty())
+                {
+                    name = meta->EntityName;
+                }
+                entityJson["name"] = std::move(name);
 
-            if (const auto* transform = raw.try_get<ECSC::Transform::Component>(entity))
-            {
-                entityJson["transform"] = json{
-                    {"position", Vec3ToJson(transform->Position)},
-                    {"rotation", QuatToJson(transform->Rotation)},
-                    {"scale", Vec3ToJson(transform->Scale)},
-                };
-                ++stats.TransformEntities;
-            }
+                if (const auto* stableId = raw.try_get<ECSC::StableId>(entity);
+                    stableId != nullptr && ECSC::IsValid(*stableId))
+                {
+                    entityJson["stableId"] = json{
+                        {"high", stableId->High},
+                        {"low", stableId->Low},
+                    };
+                }
 
-            if (const auto* hierarchy = raw.try_get<ECSC::Hierarchy::Component>(entity);
-                hierarchy != nullptr && hierarchy->Parent != ECS::InvalidEntityHandle)
-            {
-                const auto parent = entityToId.find(hierarchy->Parent);
-                if (parent != entityToId.end())
+                const bool selectable = raw.all_of<Sel::SelectableTag>(entity);
+                entityJson["selectable"] = selectable;
+                if (selectable)
+                    ++stats.SelectableEntities;
+
+                if (const auto* transform = raw.try_get<ECSC::Transform::Component>(entity))
                 {
-                    entityJson["parentId"] = parent->second;
-                    ++stats.HierarchyLinks;
+                    entityJson["transform"] = json{
+                        {"position", Vec3ToJson(transform->Position)},
+                        {"rotation", QuatToJson(transform->Rotation)},
+                        {"scale", Vec3ToJson(transform->Scale)},
+                    };
+                    ++stats.TransformEntities;
+                }
+
+                if (const auto* hierarchy = raw.try_get<ECSC::Hierarchy::Component>(entity);
+                    hierarchy != nullptr && hierarchy->Parent != ECS::InvalidEntityHandle)
+                {
+                    const auto parent = entityToId.find(hierarchy->Parent);
+                    if (parent != entityToId.end())
+                    {
+                        entityJson["parentId"] = parent->second;
+                        ++stats.HierarchyLinks;
+                    }
                 }
-            }
 
-            CountUnsupportedPersistenceDiagnostics(raw, entity, stats);
+                CountUnsupportedPersistenceDiagnostics(raw, entity, stats);
 
-            const json render = RenderHintsToJson(raw, entity, stats);
-            if (!render.empty())
-                entityJson["render"] = render;
+                const json render = RenderHintsToJson(raw, entity, stats);
+                if (!render.empty())
+                    entityJson["render"] = render;
 
-            if (!AddGeometry(entityJson, raw, entity, stats))
-                return Core::Err<std::string>(Core::ErrorCode::InvalidFormat);
+                if (!AddGeometry(entityJson, raw, entity, blobs, stats))
+                    return Core::Err<json>(Core::ErrorCode::InvalidFormat);
 
-            if (const auto* presentation =
-                    raw.try_get<GeometryPresentationRecipe>(entity))
-            {
-                entityJson["geometryPresentation"] =
-                    GeometryPresentationRecipeToJson(*presentation);
-                ++stats.GeometryPresentationEntities;
-            }
+                if (const auto* presentation =
+                        raw.try_get<GeometryPresentationRecipe>(entity))
+                {
+                    entityJson["geometryPresentation"] =
+                        GeometryPresentationRecipeToJson(*presentation);
+                    ++stats.GeometryPresentationEntities;
+                }
 
-            root["entities"].push_back(std::move(entityJson));
-            ++stats.Entities;
+                root["entities"].push_back(std::move(entityJson));
+                ++stats.Entities;
+            }
+
+            root["stats"] = json{
+                {"entities", stats.Entities},
+                {"selectableEntities", stats.SelectableEntities},
+                {"transformEntities", stats.TransformEntities},
+                {"hierarchyLinks", stats.HierarchyLinks},
+                {"meshEntities", stats.MeshEntities},
+                {"graphEntities", stats.GraphEntities},
+                {"pointCloudEntities", stats.PointCloudEntities},
+                {"renderHintEntities", stats.RenderHintEntities},
+                {"geometryPresentationEntities", stats.GeometryPresentationEntities},
+                {"unsupportedPersistenceEntities", stats.UnsupportedPersistenceEntities},
+                {"unsupportedLightEntities", stats.UnsupportedLightEntities},
+                {"unsupportedShadowEntities", stats.UnsupportedShadowEntities},
+                {"unsupportedPhysicsEntities", stats.UnsupportedPhysicsEntities},
+                {"unsupportedAssetInstanceEntities", stats.UnsupportedAssetInstanceEntities},
+            };
+            return root;
         }
 
-        root["stats"] = json{
-            {"entities", stats.Entities},
-            {"selectableEntities", stats.SelectableEntities},
-            {"transformEntities", stats.TransformEntities},
-            {"hierarchyLinks", stats.HierarchyLinks},
-            {"meshEntities", stats.MeshEntities},
-            {"graphEntities", stats.GraphEntities},
-            {"pointCloudEntities", stats.PointCloudEntities},
-            {"renderHintEntities", stats.RenderHintEntities},
-            {"geometryPresentationEntities", stats.GeometryPresentationEntities},
-            {"unsupportedPersistenceEntities", stats.UnsupportedPersistenceEntities},
-            {"unsupportedLightEntities", stats.UnsupportedLightEntities},
-            {"unsupportedShadowEntities", stats.UnsupportedShadowEntities},
-            {"unsupportedPhysicsEntities", stats.UnsupportedPhysicsEntities},
-            {"unsupportedAssetInstanceEntities", stats.UnsupportedAssetInstanceEntities},
-        };
-        return root.dump(2);
+        [[nodiscard]] Core::Expected<std::vector<std::byte>> EncodeSceneBinary(
+            const ECS::Scene::Registry& scene,
+            SceneSerializationStats& stats)
+        {
+            if constexpr (std::endian::native != std::endian::little)
+                return Core::Err<std::vector<std::byte>>(Core::ErrorCode::UnsupportedFormat);
+
+            BlobWriter blobs;
+            auto root = SerializeSceneRoot(scene, &blobs, stats);
+            if (!root.has_value())
+                return Core::Err<std::vector<std::byte>>(root.error());
+            if (blobs.Blobs().size() > UINT32_MAX)
+                return Core::Err<std::vector<std::byte>>(Core::ErrorCode::InvalidFormat);
+
+            const std::vector<std::uint8_t> entityTable = json::to_cbor(*root);
+
+            BinaryHeader header{};
+            header.Magic = kBinarySceneMagic;
+            header.Version = kBinarySceneVersion;
+            header.BlobCount = static_cast<std::uint32_t>(blobs.Blobs().size());
+            header.BlobTableOffset = sizeof(BinaryHeader);
+            header.EntityTableOffset =
+                header.BlobTableOffset + blobs.Blobs().size() * sizeof(BlobEntry);
+            header.EntityTableSize = entityTable.size();
+            header.PayloadOffset =
+                AlignBlobOffset(header.EntityTableOffset + header.EntityTableSize);
+            header.PayloadSize = blobs.Payload().size();
+
+            std::vector<std::byte> out(
+                static_cast<std::size_t>(header.PayloadOffset + header.PayloadSize));
+            std::memcpy(out.data(), &header, sizeof(header));
+            if (!blobs.Blobs().empty())
+            {
+                std::memcpy(out.data() + header.BlobTableOffset,
+                            blobs.Blobs().data(),
+                            blobs.Blobs().size() * sizeof(BlobEntry));
+            }
+            if (!entityTable.empty())
+                std::memcpy(out.data() + header.EntityTableOffset, entityTable.data(), entityTable.size());
+            if (!blobs.Payload().empty())
+            {
+                std::memcpy(out.data() + header.PayloadOffset,
+                            blobs.Payload().data(),
+                            blobs.Payload().size());
+            }
+            return out;
+        }
+    }
+
+    Core::Expected<std::string> SerializeSceneDocument(const ECS::Scene::Registry& scene)
+    {
+        SceneSerializationStats stats{};
+        auto root = SerializeSceneRoot(scene, nullptr, stats);
+        if (!root.has_value())
+            return Core::Err<std::string>(root.error());
+        return root->dump(2);
     }
 
     Core::Expected<SceneSerializationResult> SaveSceneDocument(
@@ -2484,7 +2740,7 @@ namespace Extrinsic::Runtime
         if (root.is_discarded())
             return Core::Err<SceneDeserializationResult>(Core::ErrorCode::InvalidFormat);
 
-        return DeserializeSceneRoot(scene, root);
+        return DeserializeSceneRoot(scene, root, nullptr);
     }
 
     Core::Expected<SceneDeserializationResult> LoadSceneDocument(
@@ -2499,8 +2755,104 @@ namespace Extrinsic::Runtime
         if (!read.has_value())
             return Core::Err<SceneDeserializationResult>(read.error());
 
-        const char* chars = reinterpret_cast<const char*>(read->Data.data());
-        const std::string_view document(chars, read->Data.size());
+        const std::span<const std::byte> bytes = read->Bytes();
+        if (HasBinarySceneMagic(bytes))
+            return DeserializeSceneBinary(scene, bytes);
+
+        const char* chars = reinterpret_cast<const char*>(bytes.data());
+        const std::string_view document(chars, bytes.size());
         return DeserializeSceneDocument(scene, document);
     }
+
+    Core::Expected<std::vector<std::byte>> SerializeSceneBinary(const ECS::Scene::Registry& scene)
+    {
+        SceneSerializationStats stats{};
+        return EncodeSceneBinary(scene, stats);
+    }
+
+    Core::Expected<SceneSerializationResult> SaveSceneBinary(
+        const ECS::Scene::Registry& scene,
+        const std::string_view path,
+        Core::IO::IIOBackend& backend)
+    {
+        if (path.empty())
+            return Core::Err<SceneSerializationResult>(Core::ErrorCode::InvalidPath);
+
+        SceneSerializationStats stats{};
+        auto bytes = EncodeSceneBinary(scene, stats);
+        if (!bytes.has_value())
+            return Core::Err<SceneSerializationResult>(bytes.error());
+
+        const Core::Result written = backend.Write(
+            Core::IO::IORequest{.Path = std::string(path)},
+            *bytes);
+        if (!written.has_value())
+            return Core::Err<SceneSerializationResult>(written.error());
+        return SceneSerializationResult{.Stats = stats};
+    }
+
+    Core::Expected<SceneDeserializationResult> DeserializeSceneBinary(
+        ECS::Scene::Registry& scene,
+        const std::span<const std::byte> data)
+    {
+        if constexpr (std::endian::native != std::endian::little)
+            return Core::Err<SceneDeserializationResult>(Core::ErrorCode::UnsupportedFormat);
+
+        BinaryHeader header{};
+        if (data.size() < sizeof(header))
+            return Core::Err<SceneDeserializationResult>(Core::ErrorCode::InvalidFormat);
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        const auto inBounds = [&](const std::uint64_t offset, const std::uint64_t size)
+        {
+            return offset <= data.size() && size <= data.size() - offset;
+        };
+        if (header.Magic != kBinarySceneMagic ||
+            header.Version != kBinarySceneVersion ||
+            header.PayloadOffset % kBlobAlignment != 0u ||
+            !inBounds(header.BlobTableOffset,
+                      std::uint64_t{header.BlobCount} * sizeof(BlobEntry)) ||
+            !inBounds(header.EntityTableOffset, header.EntityTableSize) ||
+            !inBounds(header.PayloadOffset, header.PayloadSize))
+        {
+            return Core::Err<SceneDeserializationResult>(Core::ErrorCode::InvalidFormat);
+        }
+
+        std::vector<BlobEntry> blobs(header.BlobCount);
+        if (!blobs.empty())
+        {
+            std::memcpy(blobs.data(),
+                        data.data() + header.BlobTableOffset,
+                        blobs.size() * sizeof(BlobEntry));
+        }
+
+        const auto* entityTable =
+            reinterpret_cast<const std::uint8_t*>(data.data() + header.EntityTableOffset);
+        const json root = json::from_cbor(entityTable,
+                                          entityTable + header.EntityTableSize,
+                                          true,
+                                          false);
+        if (root.is_discarded())
+            return Core::Err<SceneDeserializationResult>(Core::ErrorCode::InvalidFormat);
+
+        const BlobReader reader{
+            std::move(blobs),
+            data.subspan(static_cast<std::size_t>(header.PayloadOffset),
+                         static_cast<std::size_t>(header.PayloadSize))};
+        return DeserializeSceneRoot(scene, root, &reader);
+    }
+
+    Core::Expected<SceneDeserializationResult> LoadSceneBinary(
+        ECS::Scene::Registry& scene,
+        const std::string_view path,
+        Core::IO::IIOBackend& backend)
+    {
+        if (path.empty())
+            return Core::Err<SceneDeserializationResult>(Core::ErrorCode::InvalidPath);
+
+        auto read = backend.Read(Core::IO::IORequest{.Path = std::string(path)});
+        if (!read.has_value())
+            return Core::Err<SceneDeserializationResult>(read.error());
+        return DeserializeSceneBinary(scene, read->Bytes());
+    }
 }
@@ -1,8 +1,11 @@
 module;
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 export module Extrinsic.Runtime.SceneSerialization;
 
@@ -52,8 +55,32 @@ export namespace Extrinsic::Runtime
         ECS::Scene::Registry& scene,
         std::string_view document);
 
+    // Accepts both the JSON document and the binary container; the binary
+    // form is recognised by its magic.
     [[nodiscard]] Core::Expected<SceneDeserializationResult> LoadSceneDocument(
         ECS::Scene::Registry& scene,
         std::string_view path,
         Core::IO::IIOBackend& backend);
+
+    // Binary scene container: the same version-2 entity schema as the JSON
+    // document, CBOR-encoded, with every geometry channel stored as a raw
+    // little-endian blob aligned to 64 bytes. Loading copies each channel
+    // straight into its GeometrySources property without per-element
+    // parsing. Big-endian hosts get ErrorCode::UnsupportedFormat.
+    [[nodiscard]] Core::Expected<std::vector<std::byte>> SerializeSceneBinary(
+        const ECS::Scene::Registry& scene);
+
+    [[nodiscard]] Core::Expected<SceneSerializationResult> SaveSceneBinary(
+        const ECS::Scene::Registry& scene,
+        std::string_view path,
+        Core::IO::IIOBackend& backend);
+
+    [[nodiscard]] Core::Expected<SceneDeserializationResult> DeserializeSceneBinary(
+        ECS::Scene::Registry& scene,
+        std::span<const std::byte> data);
+
+    [[nodiscard]] Core::Expected<SceneDeserializationResult> LoadSceneBinary(
+        ECS::Scene::Registry& scene,
+        std::string_view path,
+        Core::IO::IIOBackend& backend);
 }
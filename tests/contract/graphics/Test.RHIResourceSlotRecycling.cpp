@@ -243,6 +243,73 @@ TEST(RHIPlacedMemoryContract, NullDeviceRejectsIncompatibleAndMisalignedPlacedRe
     device->DestroyMemoryBlock(smallBlock);
 }
 
+TEST(RHIPlacedMemoryContract, NullDeviceReportsPeakAndAliasedPlacedBytes)
+{
+    std::unique_ptr<Extrinsic::RHI::IDevice> device =
+        Extrinsic::Backends::Null::CreateNullDevice();
+    ASSERT_NE(device, nullptr);
+
+    const Extrinsic::RHI::BufferDesc bufferDesc{
+        .SizeBytes = 1024u,
+        .Usage = Extrinsic::RHI::BufferUsage::Storage,
+        .HostVisible = false,
+        .DebugName = "PlacedMemory.StatsBuffer",
+    };
+    const Extrinsic::RHI::ResourceMemoryRequirements req =
+        device->GetBufferMemoryRequirements(bufferDesc);
+    ASSERT_TRUE(req.IsValid());
+
+    const Extrinsic::RHI::MemoryBlockHandle block = device->CreateMemoryBlock({
+        .SizeBytes = req.SizeBytes * 2u,
+        .AlignmentBytes = req.AlignmentBytes,
+        .MemoryTypeBits = req.MemoryTypeBits,
+        .DebugName = "PlacedMemory.StatsBlock",
+    });
+    ASSERT_TRUE(block.IsValid());
+
+    // Two buffers alias offset 0, a third sits next to them.
+    const Extrinsic::RHI::BufferHandle first = device->CreatePlacedBuffer({
+        .Desc = bufferDesc,
+        .Placement = {.Block = block, .OffsetBytes = 0u},
+    });
+    const Extrinsic::RHI::BufferHandle aliased = device->CreatePlacedBuffer({
+        .Desc = bufferDesc,
+        .Placement = {.Block = block, .OffsetBytes = 0u},
+    });
+    const Extrinsic::RHI::BufferHandle neighbour = device->CreatePlacedBuffer({
+        .Desc = bufferDesc,
+        .Placement = {.Block = block, .OffsetBytes = req.SizeBytes},
+    });
+    const Extrinsic::RHI::BufferHandle dedicated = device->CreateBuffer(bufferDesc);
+    ASSERT_TRUE(first.IsValid());
+    ASSERT_TRUE(aliased.IsValid());
+    ASSERT_TRUE(neighbour.IsValid());
+    ASSERT_TRUE(dedicated.IsValid());
+
+    Extrinsic::RHI::PlacedMemoryStats stats = device->GetPlacedMemoryStats();
+    EXPECT_EQ(stats.MemoryBlockCount, 1u);
+    EXPECT_EQ(stats.MemoryBlockBytes, req.SizeBytes * 2u);
+    EXPECT_EQ(stats.PeakMemoryBlockBytes, req.SizeBytes * 2u);
+    EXPECT_EQ(stats.PlacedResourceCount, 3u);
+    EXPECT_EQ(stats.PlacedResourceBytes, req.SizeBytes * 3u);
+    EXPECT_EQ(stats.AliasedBytes, req.SizeBytes);
+
+    device->DestroyBuffer(aliased);
+    stats = device->GetPlacedMemoryStats();
+    EXPECT_EQ(stats.PlacedResourceCount, 2u);
+    EXPECT_EQ(stats.AliasedBytes, 0u);
+
+    device->DestroyBuffer(first);
+    device->DestroyBuffer(neighbour);
+    device->DestroyBuffer(dedicated);
+    device->DestroyMemoryBlock(block);
+    stats = device->GetPlacedMemoryStats();
+    EXPECT_EQ(stats.MemoryBlockCount, 0u);
+    EXPECT_EQ(stats.MemoryBlockBytes, 0u);
+    EXPECT_EQ(stats.PeakMemoryBlockBytes, req.SizeBytes * 2u);
+    EXPECT_EQ(stats.PlacedResourceBytes, 0u);
+}
+
 TEST(RHIResourceSlotRecycling, NullDeviceReusesDestroyedMemoryBlockSlotWithNewGeneration)
 {
     std::unique_ptr<Extrinsic::RHI::IDevice> device =
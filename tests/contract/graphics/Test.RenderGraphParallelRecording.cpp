@@ -336,3 +336,108 @@ TEST(RenderGraphParallelRecording, RecordFailureJoinsWorkersAndSkipsSubmit)
     EXPECT_TRUE(stats.UsedScheduler);
     EXPECT_EQ(stats.WorkerTaskCount, compiled.TopologicalOrder.size());
 }
+
+TEST(RenderGraphParallelRecording, DependentPassDoesNotWaitForSlowSiblingLayerBarrier)
+{
+    SchedulerScope scheduler{4u};
+    RenderGraph graph;
+    const auto chainInput = graph.CreateTexture("ChainInput", RHI::TextureDesc{});
+    const auto chainOutput = graph.CreateTexture("ChainOutput", RHI::TextureDesc{});
+    const auto slow = graph.AddPass("Slow", true);
+    const auto chainHead = graph.AddPass("ChainHead", [chainInput](RenderGraphBuilder& builder) {
+        (void)builder.Write(chainInput, TextureUsage::ColorAttachmentWrite);
+    });
+    const auto chainTail = graph.AddPass("ChainTail", [chainInput, chainOutput](RenderGraphBuilder& builder) {
+        (void)builder.Read(chainInput, TextureUsage::ShaderRead);
+        (void)builder.Write(chainOutput, TextureUsage::ColorAttachmentWrite);
+    }, true);
+
+    auto compiled = graph.Compile();
+    ASSERT_TRUE(compiled.has_value());
+    ASSERT_EQ(compiled->TopologicalOrder.size(), 3u);
+    ASSERT_EQ(compiled->PassSuccessorOffsets.size(), compiled->PassDeclarations.size() + 1u);
+    ASSERT_EQ(compiled->PassSuccessors.size(), 1u);
+    EXPECT_EQ(compiled->PassSuccessors[compiled->PassSuccessorOffsets[chainHead.Index]], chainTail.Index);
+    EXPECT_EQ(compiled->PassSuccessorOffsets[slow.Index], compiled->PassSuccessorOffsets[slow.Index + 1u]);
+
+    std::atomic<bool> slowActive{false};
+    std::atomic<bool> tailRecordedWhileSlowActive{false};
+    ParallelRecordStats stats{};
+
+    RenderGraphExecutor executor;
+    const auto result = executor.ExecuteParallelRecordJoin(
+        *compiled,
+        [&](const std::uint32_t passIndex, const std::uint32_t) {
+            if (passIndex == slow.Index)
+            {
+                slowActive.store(true, std::memory_order_release);
+                for (int i = 0; i < 200 && !tailRecordedWhileSlowActive.load(std::memory_order_acquire); ++i)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                }
+                slowActive.store(false, std::memory_order_release);
+            }
+            else if (passIndex == chainTail.Index && slowActive.load(std::memory_order_acquire))
+            {
+                tailRecordedWhileSlowActive.store(true, std::memory_order_release);
+            }
+            return Extrinsic::Core::Ok();
+        },
+        {},
+        {},
+        &stats,
+        ParallelRecordOptions{.UseScheduler = true, .MinWorkerPassCount = 2u});
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(stats.UsedScheduler);
+    EXPECT_EQ(stats.LayerCount, 2u);
+    EXPECT_EQ(stats.RootPassCount, 2u);
+    EXPECT_EQ(stats.WorkerTaskCount, 3u);
+    EXPECT_TRUE(tailRecordedWhileSlowActive.load(std::memory_order_acquire));
+}
+
+TEST(RenderGraphParallelRecording, RecordFailureSkipsDependentsAndRecordsIndependentPasses)
+{
+    SchedulerScope scheduler{4u};
+    RenderGraph graph;
+    const auto chainInput = graph.CreateTexture("ChainInput", RHI::TextureDesc{});
+    const auto chainOutput = graph.CreateTexture("ChainOutput", RHI::TextureDesc{});
+    const auto chainHead = graph.AddPass("ChainHead", [chainInput](RenderGraphBuilder& builder) {
+        (void)builder.Write(chainInput, TextureUsage::ColorAttachmentWrite);
+    });
+    const auto chainTail = graph.AddPass("ChainTail", [chainInput, chainOutput](RenderGraphBuilder& builder) {
+        (void)builder.Read(chainInput, TextureUsage::ShaderRead);
+        (void)builder.Write(chainOutput, TextureUsage::ColorAttachmentWrite);
+    }, true);
+    const auto independent = graph.AddPass("Independent", true);
+
+    auto compiled = graph.Compile();
+    ASSERT_TRUE(compiled.has_value());
+    ASSERT_EQ(compiled->TopologicalOrder.size(), 3u);
+
+    std::mutex recordedMutex;
+    std::set<std::uint32_t> recordedPasses{};
+    RenderGraphExecutor executor;
+    const auto result = executor.ExecuteParallelRecordJoin(
+        *compiled,
+        [&](const std::uint32_t passIndex, const std::uint32_t) {
+            {
+                std::scoped_lock lock(recordedMutex);
+                recordedPasses.insert(passIndex);
+            }
+            if (passIndex == chainHead.Index)
+            {
+                return Extrinsic::Core::Err(Extrinsic::Core::ErrorCode::InvalidState);
+            }
+            return Extrinsic::Core::Ok();
+        },
+        {},
+        {},
+        nullptr,
+        ParallelRecordOptions{.UseScheduler = true, .MinWorkerPassCount = 1u});
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Extrinsic::Core::ErrorCode::InvalidState);
+    EXPECT_EQ(recordedPasses, (std::set<std::uint32_t>{chainHead.Index, independent.Index}));
+    EXPECT_EQ(recordedPasses.count(chainTail.Index), 0u);
+}
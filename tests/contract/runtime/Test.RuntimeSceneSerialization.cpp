@@ -1,6 +1,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -1027,3 +1028,71 @@ TEST(RuntimeSceneSerialization, SaveLoadRoundTripPreservesCornerDomainNormals)
     for (std::size_t i = 0; i < cornerNormals.size(); ++i)
         EXPECT_EQ(reloaded.Vector()[i], cornerNormals[i]) << "corner " << i;
 }
+
+// The binary container carries the same entity schema as the JSON document;
+// only the geometry channels move into raw blobs. A scene loaded from either
+// form must therefore re-serialize to the identical JSON document.
+TEST(RuntimeSceneSerialization, BinaryContainerRoundTripMatchesJsonDocument)
+{
+    ECS::Scene::Registry source;
+    const ECS::EntityHandle mesh = AddMeshEntity(source);
+    const ECS::EntityHandle graph = AddGraphEntity(source);
+    const ECS::EntityHandle cloud = AddPointCloudEntity(source);
+    ECS::Hierarchy::Attach(source.Raw(), graph, mesh);
+    ECS::Hierarchy::Attach(source.Raw(), cloud, mesh);
+    source.Raw()
+        .get<GS::Halfedges>(mesh)
+        .Properties.GetOrAdd<glm::vec3>("h:normal", glm::vec3{0.0f, 0.0f, 1.0f});
+
+    MemoryIOBackend backend;
+    const auto savedJson = Runtime::SaveSceneDocument(source, "scene.json", backend);
+    ASSERT_TRUE(savedJson.has_value()) << static_cast<int>(savedJson.error());
+    const auto savedBinary = Runtime::SaveSceneBinary(source, "scene.iscene", backend);
+    ASSERT_TRUE(savedBinary.has_value()) << static_cast<int>(savedBinary.error());
+    EXPECT_EQ(savedBinary->Stats.Entities, savedJson->Stats.Entities);
+    EXPECT_EQ(savedBinary->Stats.MeshEntities, 1u);
+    EXPECT_EQ(savedBinary->Stats.GraphEntities, 1u);
+    EXPECT_EQ(savedBinary->Stats.PointCloudEntities, 1u);
+    EXPECT_EQ(savedBinary->Stats.HierarchyLinks, 2u);
+
+    ECS::Scene::Registry fromJson;
+    ASSERT_TRUE(Runtime::LoadSceneDocument(fromJson, "scene.json", backend).has_value());
+    ECS::Scene::Registry fromBinary;
+    const auto loaded = Runtime::LoadSceneBinary(fromBinary, "scene.iscene", backend);
+    ASSERT_TRUE(loaded.has_value()) << static_cast<int>(loaded.error());
+    EXPECT_EQ(loaded->Stats.Entities, 3u);
+    EXPECT_EQ(loaded->Stats.HierarchyLinks, 2u);
+
+    const auto jsonDocument = Runtime::SerializeSceneDocument(fromJson);
+    const auto binaryDocument = Runtime::SerializeSceneDocument(fromBinary);
+    ASSERT_TRUE(jsonDocument.has_value());
+    ASSERT_TRUE(binaryDocument.has_value());
+    EXPECT_EQ(*binaryDocument, *jsonDocument);
+
+    const ECS::EntityHandle loadedMesh = FindEntityByName(fromBinary, "Mesh Entity");
+    ASSERT_NE(loadedMesh, ECS::InvalidEntityHandle);
+    const auto& halfedges = fromBinary.Raw().get<GS::Halfedges>(loadedMesh);
+    EXPECT_EQ(halfedges.Properties.Get<std::uint32_t>(PN::kHalfedgeNext).Vector(),
+              (std::vector<std::uint32_t>{1u, 2u, 0u, 5u, 3u, 4u}));
+    const auto normals = halfedges.Properties.Get<glm::vec3>("h:normal");
+    ASSERT_TRUE(normals.IsValid());
+    EXPECT_EQ(normals.Vector().size(), 6u);
+    EXPECT_EQ(normals.Vector()[5], glm::vec3(0.0f, 0.0f, 1.0f));
+
+    // LoadSceneDocument recognises the container by its magic.
+    ECS::Scene::Registry sniffed;
+    ASSERT_TRUE(Runtime::LoadSceneDocument(sniffed, "scene.iscene", backend).has_value());
+    EXPECT_EQ(*Runtime::SerializeSceneDocument(sniffed), *jsonDocument);
+
+    // Truncated containers and JSON text fail closed without touching the scene.
+    const std::vector<std::byte>& bytes = backend.Files.at("scene.iscene");
+    for (const std::size_t size : {std::size_t{0}, std::size_t{63}, bytes.size() / 2u, bytes.size() - 1u})
+    {
+        const auto truncated =
+            Runtime::DeserializeSceneBinary(sniffed, std::span<const std::byte>{bytes.data(), size});
+        ASSERT_FALSE(truncated.has_value()) << size;
+        EXPECT_EQ(truncated.error(), Core::ErrorCode::InvalidFormat);
+    }
+    EXPECT_FALSE(Runtime::LoadSceneBinary(sniffed, "scene.json", backend).has_value());
+    EXPECT_EQ(*Runtime::SerializeSceneDocument(sniffed), *jsonDocument);
+}
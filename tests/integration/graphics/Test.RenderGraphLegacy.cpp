@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <string>
@@ -1472,6 +1473,225 @@ TEST(GraphicsRenderGraph, TransientPlacementIsDeterministicForFixedGraph)
     ExpectAliasHazardsEqual(*first, *second);
 }
 
+TEST(GraphicsRenderGraph, TransientHeapPlanSharesRetiredRangeBetweenConcurrentResources)
+{
+    // Resources 1 and 2 overlap in [1, 2] and both fit in the range retired
+    // by resource 0; resource 3 then spans all three retired pieces.
+    const std::array<TransientHeapRequest, 4u> requests{
+        TransientHeapRequest{.ResourceIndex = 0u, .FirstUsePass = 0u, .LastUsePass = 0u, .SizeBytes = 4096u, .AlignmentBytes = 256u},
+        TransientHeapRequest{.ResourceIndex = 1u, .FirstUsePass = 1u, .LastUsePass = 2u, .SizeBytes = 1024u, .AlignmentBytes = 256u},
+        TransientHeapRequest{.ResourceIndex = 2u, .FirstUsePass = 1u, .LastUsePass = 2u, .SizeBytes = 1024u, .AlignmentBytes = 256u},
+        TransientHeapRequest{.ResourceIndex = 3u, .FirstUsePass = 3u, .LastUsePass = 3u, .SizeBytes = 4096u, .AlignmentBytes = 256u},
+    };
+
+    const TransientHeapPlan plan = PlanTransientHeaps(requests, true);
+    ASSERT_EQ(plan.Heaps.size(), 1u);
+    ASSERT_EQ(plan.Assignments.size(), requests.size());
+    EXPECT_EQ(plan.NaiveBytes, 10240u);
+    EXPECT_EQ(plan.PeakBytes, 4096u);
+    EXPECT_EQ(plan.Heaps[0u].OffsetBytes, 0u);
+    EXPECT_EQ(plan.Heaps[0u].SizeBytes, 4096u);
+    EXPECT_EQ(plan.Heaps[0u].ResourceCount, 4u);
+
+    for (const TransientHeapAssignment& assignment : plan.Assignments)
+    {
+        EXPECT_EQ(assignment.HeapIndex, 0u);
+    }
+    EXPECT_EQ(plan.Assignments[1u].OffsetBytes, 0u);
+    EXPECT_EQ(plan.Assignments[2u].OffsetBytes, 1024u);
+    EXPECT_EQ(plan.Assignments[3u].OffsetBytes, 0u);
+
+    ASSERT_EQ(plan.AliasHazards.size(), 5u);
+    EXPECT_EQ(plan.AliasHazards[0u].PreviousResourceIndex, 0u);
+    EXPECT_EQ(plan.AliasHazards[0u].ResourceIndex, 1u);
+    EXPECT_EQ(plan.AliasHazards[0u].FirstUsePass, 1u);
+    EXPECT_EQ(plan.AliasHazards[1u].PreviousResourceIndex, 0u);
+    EXPECT_EQ(plan.AliasHazards[1u].ResourceIndex, 2u);
+    EXPECT_EQ(plan.AliasHazards[1u].OffsetBytes, 1024u);
+    for (std::size_t index = 2u; index < plan.AliasHazards.size(); ++index)
+    {
+        EXPECT_EQ(plan.AliasHazards[index].ResourceIndex, 3u);
+        EXPECT_EQ(plan.AliasHazards[index].FirstUsePass, 3u);
+    }
+    EXPECT_EQ(plan.AliasHazards[2u].PreviousResourceIndex, 1u);
+    EXPECT_EQ(plan.AliasHazards[3u].PreviousResourceIndex, 2u);
+    EXPECT_EQ(plan.AliasHazards[4u].PreviousResourceIndex, 0u);
+
+    const TransientHeapPlan dedicated = PlanTransientHeaps(requests, false);
+    EXPECT_EQ(dedicated.Heaps.size(), requests.size());
+    EXPECT_EQ(dedicated.PeakBytes, dedicated.NaiveBytes);
+    EXPECT_TRUE(dedicated.AliasHazards.empty());
+}
+
+TEST(GraphicsRenderGraph, TransientHeapPlanOpensHeapWhenNoRetiredRangeFits)
+{
+    const std::array<TransientHeapRequest, 2u> requests{
+        TransientHeapRequest{.ResourceIndex = 0u, .FirstUsePass = 0u, .LastUsePass = 0u, .SizeBytes = 1024u, .AlignmentBytes = 256u},
+        TransientHeapRequest{.ResourceIndex = 1u, .FirstUsePass = 1u, .LastUsePass = 1u, .SizeBytes = 4096u, .AlignmentBytes = 512u},
+    };
+
+    const TransientHeapPlan plan = PlanTransientHeaps(requests, true);
+    ASSERT_EQ(plan.Heaps.size(), 2u);
+    EXPECT_EQ(plan.Heaps[1u].OffsetBytes, 1024u);
+    EXPECT_EQ(plan.Heaps[1u].AlignmentBytes, 512u);
+    EXPECT_EQ(plan.PeakBytes, 5120u);
+    EXPECT_EQ(plan.BlockAlignmentBytes, 512u);
+    EXPECT_TRUE(plan.AliasHazards.empty());
+}
+
+TEST(GraphicsRenderGraph, TransientHeapPlanNeverExceedsSingleRangeFirstFitPeak)
+{
+    // The first-fit range packer RenderGraph and the renderer used before
+    // PlanTransientHeaps: one retired range per placement, no spanning.
+    const auto referencePeakBytes = [](std::vector<TransientHeapRequest> items) {
+        std::ranges::sort(items, [](const TransientHeapRequest& lhs, const TransientHeapRequest& rhs) {
+            return std::pair{lhs.FirstUsePass, lhs.ResourceIndex} < std::pair{rhs.FirstUsePass, rhs.ResourceIndex};
+        });
+        struct Range
+        {
+            std::uint32_t LastUsePass = 0u;
+            std::uint64_t OffsetBytes = 0u;
+            std::uint64_t SizeBytes = 0u;
+        };
+        std::vector<Range> active{};
+        std::vector<Range> retired{};
+        std::uint64_t blockBytes = 0u;
+        for (const TransientHeapRequest& item : items)
+        {
+            std::erase_if(active, [&](const Range& range) {
+                if (range.LastUsePass >= item.FirstUsePass)
+                {
+                    return false;
+                }
+                retired.push_back(range);
+                return true;
+            });
+            std::ranges::sort(retired, [](const Range& lhs, const Range& rhs) {
+                return std::pair{lhs.OffsetBytes, lhs.SizeBytes} < std::pair{rhs.OffsetBytes, rhs.SizeBytes};
+            });
+
+            std::uint64_t offset = AlignUpForPlacementTest(blockBytes, item.AlignmentBytes);
+            bool placed = false;
+            for (std::size_t index = 0u; index < retired.size() && !placed; ++index)
+            {
+                const Range range = retired[index];
+                const std::uint64_t aligned = AlignUpForPlacementTest(range.OffsetBytes, item.AlignmentBytes);
+                const std::uint64_t end = range.OffsetBytes + range.SizeBytes;
+                if (aligned > end || item.SizeBytes > end - aligned)
+                {
+                    continue;
+                }
+                retired.erase(retired.begin() + static_cast<std::ptrdiff_t>(index));
+                if (range.OffsetBytes < aligned)
+                {
+                    retired.push_back(Range{.OffsetBytes = range.OffsetBytes, .SizeBytes = aligned - range.OffsetBytes});
+                }
+                if (aligned + item.SizeBytes < end)
+                {
+                    retired.push_back(Range{.OffsetBytes = aligned + item.SizeBytes, .SizeBytes = end - aligned - item.SizeBytes});
+                }
+                offset = aligned;
+                placed = true;
+            }
+            if (!placed)
+            {
+                blockBytes = offset + item.SizeBytes;
+            }
+            active.push_back(Range{.LastUsePass = item.LastUsePass, .OffsetBytes = offset, .SizeBytes = item.SizeBytes});
+        }
+        return blockBytes;
+    };
+
+    // The concurrent-resources case above, where spanning beats the reference.
+    const std::vector<TransientHeapRequest> shared{
+        TransientHeapRequest{.ResourceIndex = 0u, .FirstUsePass = 0u, .LastUsePass = 0u, .SizeBytes = 4096u, .AlignmentBytes = 256u},
+        TransientHeapRequest{.ResourceIndex = 1u, .FirstUsePass = 1u, .LastUsePass = 2u, .SizeBytes = 1024u, .AlignmentBytes = 256u},
+        TransientHeapRequest{.ResourceIndex = 2u, .FirstUsePass = 1u, .LastUsePass = 2u, .SizeBytes = 1024u, .AlignmentBytes = 256u},
+        TransientHeapRequest{.ResourceIndex = 3u, .FirstUsePass = 3u, .LastUsePass = 3u, .SizeBytes = 4096u, .AlignmentBytes = 256u},
+    };
+    EXPECT_EQ(referencePeakBytes(shared), 8192u);
+    EXPECT_EQ(PlanTransientHeaps(shared, true).PeakBytes, 4096u);
+
+    // Deterministic pseudo-random lifetimes, sizes and alignments.
+    std::uint32_t state = 0x9E3779B9u;
+    const auto next = [&state](const std::uint32_t bound) {
+        state = state * 1664525u + 1013904223u;
+        return (state >> 8u) % bound;
+    };
+    for (std::uint32_t trial = 0u; trial < 2000u; ++trial)
+    {
+        std::vector<TransientHeapRequest> requests{};
+        const std::uint32_t count = 1u + next(12u);
+        for (std::uint32_t index = 0u; index < count; ++index)
+        {
+            const std::uint32_t first = next(8u);
+            requests.push_back(TransientHeapRequest{
+                .ResourceIndex = index,
+                .FirstUsePass = first,
+                .LastUsePass = first + next(4u),
+                .SizeBytes = 256u * (1u + next(5u)) * (1u + next(8u)),
+                .AlignmentBytes = 256u << next(3u),
+            });
+        }
+        EXPECT_LE(PlanTransientHeaps(requests, true).PeakBytes, referencePeakBytes(requests)) << "trial " << trial;
+    }
+}
+
+TEST(GraphicsRenderGraph, TransientPlacementReportsHeapCountAndReusesRetiredHeap)
+{
+    RenderGraph graph;
+    RHI::TextureDesc desc{};
+    desc.Width = 32u;
+    desc.Height = 32u;
+    desc.Fmt = RHI::Format::RGBA8_UNORM;
+    const auto a = graph.CreateTexture("A", desc);
+    const auto b = graph.CreateTexture("B", desc);
+    const auto c = graph.CreateTexture("C", desc);
+
+    (void)graph.AddPass("WriteA",
+                        [a](RenderGraphBuilder& builder) { (void)builder.Write(a, TextureUsage::ColorAttachmentWrite); },
+                        true);
+    (void)graph.AddPass("ReadAWriteB",
+                        [a, b](RenderGraphBuilder& builder) {
+                            (void)builder.Read(a, TextureUsage::ShaderRead);
+                            (void)builder.Write(b, TextureUsage::ColorAttachmentWrite);
+                        },
+                        true);
+    (void)graph.AddPass("ReadBWriteC",
+                        [b, c](RenderGraphBuilder& builder) {
+                            (void)builder.Read(b, TextureUsage::ShaderRead);
+                            (void)builder.Write(c, TextureUsage::ColorAttachmentWrite);
+                        },
+                        true);
+
+    const auto compiled = graph.Compile();
+    ASSERT_TRUE(compiled.has_value());
+    EXPECT_EQ(compiled->TransientTextureHeapCount, 2u);
+    EXPECT_EQ(compiled->TransientBufferHeapCount, 0u);
+    EXPECT_EQ(compiled->TransientPlacedPeakMemoryEstimateBytes, ExpectedTexturePlacementBytes(desc) * 2u);
+
+    const TransientResourcePlacement* aPlacement = FindTexturePlacement(*compiled, a.Index);
+    const TransientResourcePlacement* bPlacement = FindTexturePlacement(*compiled, b.Index);
+    const TransientResourcePlacement* cPlacement = FindTexturePlacement(*compiled, c.Index);
+    ASSERT_NE(aPlacement, nullptr);
+    ASSERT_NE(bPlacement, nullptr);
+    ASSERT_NE(cPlacement, nullptr);
+    EXPECT_NE(aPlacement->HeapIndex, bPlacement->HeapIndex);
+    EXPECT_EQ(aPlacement->HeapIndex, cPlacement->HeapIndex);
+    EXPECT_EQ(aPlacement->OffsetBytes, cPlacement->OffsetBytes);
+
+    ASSERT_EQ(CountTextureAliasReuseHazards(*compiled), 1u);
+    for (const BarrierPacket& packet : compiled->BarrierPackets)
+    {
+        for (const TextureAliasReuseBarrierPacket& barrier : packet.TextureAliasReuseBarriers)
+        {
+            EXPECT_EQ(packet.PassIndex, 2u);
+            EXPECT_EQ(barrier.PreviousTextureIndex, a.Index);
+            EXPECT_EQ(barrier.TextureIndex, c.Index);
+        }
+    }
+}
+
 TEST(GraphicsRenderGraph, TransientAllocatorReusesCompatibleHandlesAcrossFrames)
 {
     RenderGraph graph;
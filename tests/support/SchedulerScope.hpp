@@ -0,0 +1,37 @@
+#pragma once
+
+// RAII scope for tests that run Core::Parallel work on worker threads.
+// It initializes the task scheduler only when nothing else has, and shuts down
+// only a scheduler it started, so a test never tears down one it didn't own.
+
+import Extrinsic.Core.Tasks;
+
+namespace TestSupport
+{
+    class SchedulerScope
+    {
+    public:
+        explicit SchedulerScope(const unsigned threadCount)
+            : m_Owns(!Extrinsic::Core::Tasks::Scheduler::IsInitialized())
+        {
+            if (m_Owns)
+            {
+                Extrinsic::Core::Tasks::Scheduler::Initialize(threadCount);
+            }
+        }
+
+        ~SchedulerScope()
+        {
+            if (m_Owns)
+            {
+                Extrinsic::Core::Tasks::Scheduler::Shutdown();
+            }
+        }
+
+        SchedulerScope(const SchedulerScope&) = delete;
+        SchedulerScope& operator=(const SchedulerScope&) = delete;
+
+    private:
+        bool m_Owns = false;
+    };
+}
@@ -85,6 +85,23 @@ TEST(AssetImportRouter, RoutesModelSceneAndTextureImports)
     EXPECT_EQ(jpeg->CanonicalExtension, "jpg");
 }
 
+TEST(AssetImportRouter, RoutesLasPointCloudImportOnly)
+{
+    const auto route = ResolveAssetImportRoute("flight_07.LAS");
+    ASSERT_TRUE(route.has_value());
+    EXPECT_EQ(route->Format, AssetFileFormat::LAS);
+    EXPECT_EQ(route->PayloadKind, AssetPayloadKind::PointCloud);
+    EXPECT_FALSE(route->PayloadHintRequired);
+    EXPECT_STREQ(DebugNameForAssetFileFormat(AssetFileFormat::LAS), "LAS");
+
+    const AssetRouteDiagnostic lasExport =
+        DiagnoseAssetImportRoute(
+            "flight_07.las",
+            AssetRouteOperation::Export,
+            AssetImportHint{.PayloadKind = AssetPayloadKind::PointCloud});
+    EXPECT_EQ(lasExport.Status, AssetRouteStatus::PayloadKindNotSupported);
+}
+
 TEST(AssetImportRouter, ExportRoutesRespectPromotedGeometrySupport)
 {
     const auto stlExport =
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+import Extrinsic.Core.Error;
+import Extrinsic.Core.IOBackend;
+
+using namespace Extrinsic::Core;
+using namespace Extrinsic::Core::IO;
+
+namespace
+{
+    class ScopedTempDirectory
+    {
+    public:
+        explicit ScopedTempDirectory(const char* name)
+            : m_Path(std::filesystem::temp_directory_path() / name)
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(m_Path, ec);
+            std::filesystem::create_directories(m_Path, ec);
+        }
+
+        ~ScopedTempDirectory()
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(m_Path, ec);
+        }
+
+        ScopedTempDirectory(const ScopedTempDirectory&) = delete;
+        ScopedTempDirectory& operator=(const ScopedTempDirectory&) = delete;
+
+        [[nodiscard]] std::string File(const char* name) const { return (m_Path / name).string(); }
+
+    private:
+        std::filesystem::path m_Path;
+    };
+
+    [[nodiscard]] std::vector<std::byte> PatternBytes(const std::size_t count)
+    {
+        std::vector<std::byte> bytes(count);
+        for (std::size_t i = 0; i < count; ++i)
+            bytes[i] = static_cast<std::byte>((i * 7u) & 0xFFu);
+        return bytes;
+    }
+}
+
+TEST(CoreIOBackend, MmapReadsAreViewsSharingOneMapping)
+{
+    ScopedTempDirectory dir{"intrinsic_core_iobackend_views"};
+    const std::string path = dir.File("pattern.bin");
+    const auto bytes = PatternBytes(10'000u);
+
+    MmapIOBackend backend;
+    ASSERT_TRUE(backend.Write(IORequest{.Path = path}, bytes).has_value());
+
+    auto whole = backend.Read(IORequest{.Path = path});
+    ASSERT_TRUE(whole.has_value());
+    EXPECT_TRUE(whole->IsView());
+    EXPECT_TRUE(whole->Data.empty());
+    ASSERT_EQ(whole->Bytes().size(), bytes.size());
+    EXPECT_EQ(std::memcmp(whole->Bytes().data(), bytes.data(), bytes.size()), 0);
+
+    // Ranged reads with a prefetch priority reuse the same mapping.
+    auto ranged = backend.Read(IORequest{.Path = path, .Offset = 4'097u, .Size = 10u, .Priority = 0u});
+    ASSERT_TRUE(ranged.has_value());
+    ASSERT_EQ(ranged->Bytes().size(), 10u);
+    EXPECT_EQ(ranged->Bytes()[0], bytes[4'097u]);
+    EXPECT_EQ(ranged->Owner, whole->Owner);
+    EXPECT_EQ(backend.LiveMappingCount(), 1u);
+
+    // A copy owns its bytes and outlives the view it came from.
+    const std::vector<std::byte> copied = ranged->TakeBytes();
+    *ranged = IOReadResult{};
+    *whole = IOReadResult{};
+    EXPECT_EQ(backend.LiveMappingCount(), 0u);
+    ASSERT_EQ(copied.size(), 10u);
+    EXPECT_EQ(copied[9], bytes[4'106u]);
+}
+
+TEST(CoreIOBackend, MmapRangeAndMissingFileErrors)
+{
+    ScopedTempDirectory dir{"intrinsic_core_iobackend_errors"};
+    const std::string path = dir.File("small.bin");
+    MmapIOBackend backend;
+    ASSERT_TRUE(backend.Write(IORequest{.Path = path}, PatternBytes(100u)).has_value());
+
+    auto pastEnd = backend.Read(IORequest{.Path = path, .Offset = 99u, .Size = 2u});
+    ASSERT_FALSE(pastEnd.has_value());
+    EXPECT_EQ(pastEnd.error(), ErrorCode::OutOfRange);
+
+    auto atEnd = backend.Read(IORequest{.Path = path, .Offset = 100u});
+    ASSERT_TRUE(atEnd.has_value());
+    EXPECT_TRUE(atEnd->Bytes().empty());
+
+    auto missing = backend.Read(IORequest{.Path = dir.File("missing.bin")});
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error(), ErrorCode::FileNotFound);
+
+    const std::string empty = dir.File("empty.bin");
+    ASSERT_TRUE(backend.Write(IORequest{.Path = empty}, {}).has_value());
+    auto emptyRead = backend.Read(IORequest{.Path = empty});
+    ASSERT_TRUE(emptyRead.has_value());
+    EXPECT_TRUE(emptyRead->Bytes().empty());
+}
+
+TEST(CoreIOBackend, MmapViewSurvivesReplacingTheFile)
+{
+    ScopedTempDirectory dir{"intrinsic_core_iobackend_replace"};
+    const std::string path = dir.File("asset.bin");
+    const auto original = PatternBytes(8'192u);
+
+    MmapIOBackend backend;
+    ASSERT_TRUE(backend.Write(IORequest{.Path = path}, original).has_value());
+    auto before = backend.Read(IORequest{.Path = path});
+    ASSERT_TRUE(before.has_value());
+
+    const std::vector<std::byte> replacement(5u, std::byte{1});
+    ASSERT_TRUE(backend.Write(IORequest{.Path = path}, replacement).has_value());
+
+    // The old view still reads the old contents; a new read maps the new file.
+    ASSERT_EQ(before->Bytes().size(), original.size());
+    EXPECT_EQ(std::memcmp(before->Bytes().data(), original.data(), original.size()), 0);
+
+    auto after = backend.Read(IORequest{.Path = path});
+    ASSERT_TRUE(after.has_value());
+    ASSERT_EQ(after->Bytes().size(), replacement.size());
+    EXPECT_EQ(after->Bytes()[0], std::byte{1});
+    EXPECT_NE(after->Owner, before->Owner);
+    EXPECT_EQ(backend.LiveMappingCount(), 1u);
+}
+
+TEST(CoreIOBackend, MmapConcurrentReadsMatchFileBackend)
+{
+    ScopedTempDirectory dir{"intrinsic_core_iobackend_concurrent"};
+    const std::string path = dir.File("shared.bin");
+    const auto bytes = PatternBytes(65'536u + 17u);
+
+    FileIOBackend files;
+    ASSERT_TRUE(files.Write(IORequest{.Path = path}, bytes).has_value());
+    auto owned = files.Read(IORequest{.Path = path, .Offset = 1u, .Size = 2u});
+    ASSERT_TRUE(owned.has_value());
+    EXPECT_FALSE(owned->IsView());
+    ASSERT_EQ(owned->Bytes().size(), 2u);
+    EXPECT_EQ(owned->Bytes()[1], bytes[2u]);
+
+    MmapIOBackend backend;
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 8; ++t)
+    {
+        readers.emplace_back([&, t]()
+        {
+            for (int i = 0; i < 500; ++i)
+            {
+                const std::size_t offset = static_cast<std::size_t>((t * 997 + i * 131) % 60'000);
+                auto read = backend.Read(IORequest{.Path = path, .Offset = offset, .Size = 64u});
+                if (!read.has_value() || read->Bytes().size() != 64u ||
+                    std::memcmp(read->Bytes().data(), bytes.data() + offset, 64u) != 0)
+                {
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& reader : readers)
+        reader.join();
+
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(backend.LiveMappingCount(), 0u);
+}
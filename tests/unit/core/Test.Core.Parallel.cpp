@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+import Extrinsic.Core.Parallel;
+import Extrinsic.Core.Tasks;
+
+#include "SchedulerScope.hpp"
+
+using namespace Extrinsic::Core::Parallel;
+using Extrinsic::Core::Tasks::Scheduler;
+
+namespace
+{
+    [[nodiscard]] std::vector<double> RandomValues(const std::size_t count, const std::uint32_t seed)
+    {
+        std::mt19937 rng{seed};
+        std::uniform_real_distribution<double> dist{-1.0, 1.0};
+        std::vector<double> values(count);
+        for (double& value : values)
+            value = dist(rng);
+        return values;
+    }
+
+    [[nodiscard]] double SumChunk(const std::vector<double>& values, const IndexRange range, double acc)
+    {
+        for (std::size_t i = range.Begin; i < range.End; ++i)
+            acc += values[i];
+        return acc;
+    }
+}
+
+TEST(CoreParallel, FallsBackToSerialWithoutScheduler)
+{
+    ASSERT_FALSE(Scheduler::IsInitialized());
+
+    std::vector<std::size_t> visitOrder;
+    ParallelFor(IndexRange{3u, 20u}, 4u, [&](const std::size_t i) { visitOrder.push_back(i); });
+    std::vector<std::size_t> expected(17u);
+    std::iota(expected.begin(), expected.end(), 3u);
+    EXPECT_EQ(visitOrder, expected);
+
+    std::vector<IndexRange> chunks;
+    ParallelFor(IndexRange{0u, 10u}, 4u, [&](const IndexRange chunk) { chunks.push_back(chunk); });
+    ASSERT_EQ(chunks.size(), 3u);
+    EXPECT_EQ(chunks[2].Begin, 8u);
+    EXPECT_EQ(chunks[2].End, 10u);
+
+    const auto values = RandomValues(1000u, 7u);
+    const double sum = ParallelReduce(
+        IndexRange{0u, values.size()}, 64u, 0.0,
+        [&](const IndexRange range, const double acc) { return SumChunk(values, range, acc); },
+        std::plus<>{});
+    EXPECT_NEAR(sum, std::accumulate(values.begin(), values.end(), 0.0), 1e-9);
+
+    // Empty ranges do nothing and reduce to the identity.
+    ParallelFor(IndexRange{5u, 5u}, AutoGrain, [](std::size_t) { FAIL(); });
+    EXPECT_EQ(ParallelReduce(IndexRange{}, AutoGrain, 42, [](IndexRange, int acc) { return acc; }, std::plus<>{}),
+              42);
+}
+
+TEST(CoreParallel, ForVisitsEveryIndexExactlyOnceOnScheduler)
+{
+    TestSupport::SchedulerScope scheduler{4u};
+
+    constexpr std::size_t kCount = 100'003u;
+    std::vector<std::atomic<std::uint32_t>> visits(kCount);
+    for (const std::size_t grain : {std::size_t{1'000}, std::size_t{97}, AutoGrain})
+    {
+        for (auto& visit : visits)
+            visit.store(0u, std::memory_order_relaxed);
+
+        ParallelFor(IndexRange{0u, kCount}, grain, [&](const std::size_t i)
+        {
+            visits[i].fetch_add(1u, std::memory_order_relaxed);
+        });
+
+        std::size_t wrong = 0u;
+        for (const auto& visit : visits)
+            wrong += visit.load(std::memory_order_relaxed) != 1u ? 1u : 0u;
+        EXPECT_EQ(wrong, 0u) << "grain " << grain;
+    }
+}
+
+TEST(CoreParallel, NestedForHelpsInsteadOfDeadlocking)
+{
+    TestSupport::SchedulerScope scheduler{2u};
+
+    std::atomic<std::uint64_t> total{0u};
+    ParallelFor(IndexRange{0u, 64u}, 1u, [&](const std::size_t outer)
+    {
+        ParallelFor(IndexRange{0u, 256u}, 16u, [&](const IndexRange inner)
+        {
+            total.fetch_add(outer * inner.Size(), std::memory_order_relaxed);
+        });
+    });
+
+    EXPECT_EQ(total.load(), 256u * (63u * 64u / 2u));
+}
+
+TEST(CoreParallel, ReduceAndScanMatchSerialFallbackBitwise)
+{
+    constexpr std::size_t kGrain = 1'024u;
+    const auto values = RandomValues(200'000u, 11u);
+    const IndexRange range{0u, values.size()};
+    const auto reduce = [&]()
+    {
+        return ParallelReduce(
+            range, kGrain, 0.0,
+            [&](const IndexRange chunk, const double acc) { return SumChunk(values, chunk, acc); },
+            std::plus<>{});
+    };
+    const auto scan = [&](const ScanKind kind)
+    {
+        std::vector<double> out(values.size());
+        ParallelScan(std::span<const double>{values}, std::span<double>{out}, 0.0, std::plus<>{}, kind, kGrain);
+        return out;
+    };
+
+    const double serialSum = reduce();
+    const auto serialInclusive = scan(ScanKind::Inclusive);
+    const auto serialExclusive = scan(ScanKind::Exclusive);
+    EXPECT_EQ(serialExclusive[0], 0.0);
+    EXPECT_NEAR(serialInclusive.back(), serialSum, 1e-9);
+
+    TestSupport::SchedulerScope scheduler{4u};
+    EXPECT_EQ(reduce(), serialSum);
+    EXPECT_EQ(scan(ScanKind::Inclusive), serialInclusive);
+    EXPECT_EQ(scan(ScanKind::Exclusive), serialExclusive);
+
+    // Integer scans are exact, so they must match std::exclusive_scan; the
+    // in-place form reads each input before overwriting it.
+    std::vector<std::int64_t> ints(50'001u);
+    std::iota(ints.begin(), ints.end(), -25'000);
+    std::vector<std::int64_t> expected(ints.size());
+    std::exclusive_scan(ints.begin(), ints.end(), expected.begin(), std::int64_t{0});
+    ParallelScan(std::span<const std::int64_t>{ints}, std::span<std::int64_t>{ints}, 0, std::plus<>{},
+                 ScanKind::Exclusive, 333u);
+    EXPECT_EQ(ints, expected);
+}
+
+TEST(CoreParallel, StableSortMatchesStdStableSort)
+{
+    std::mt19937 rng{3u};
+    std::uniform_int_distribution<int> keys{0, 63};
+    std::vector<std::pair<int, std::size_t>> items(120'000u);
+    for (std::size_t i = 0; i < items.size(); ++i)
+        items[i] = {keys(rng), i};
+
+    const auto byKey = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+    auto expected = items;
+    std::stable_sort(expected.begin(), expected.end(), byKey);
+
+    auto serial = items;
+    ParallelStableSort(std::span{serial}, byKey, 1'000u);
+    EXPECT_EQ(serial, expected);
+
+    TestSupport::SchedulerScope scheduler{4u};
+    for (const std::size_t grain : {std::size_t{2}, std::size_t{777}, AutoGrain})
+    {
+        auto sorted = items;
+        ParallelStableSort(std::span{sorted}, byKey, grain);
+        EXPECT_EQ(sorted, expected) << "grain " << grain;
+    }
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+import Extrinsic.Core.WorkStealingDeque;
+
+using namespace Extrinsic::Core;
+
+TEST(CoreWorkStealingDeque, OwnerPopsLifoThievesStealFifo)
+{
+    WorkStealingDeque<int> q(4);
+
+    int out = 0;
+    EXPECT_FALSE(q.Pop(out));
+    EXPECT_EQ(q.Steal(out), StealResult::Empty);
+
+    q.Push(1);
+    q.Push(2);
+    q.Push(3);
+    EXPECT_EQ(q.SizeApprox(), 3u);
+
+    EXPECT_TRUE(q.Pop(out));
+    EXPECT_EQ(out, 3);
+    EXPECT_EQ(q.Steal(out), StealResult::Success);
+    EXPECT_EQ(out, 1);
+    EXPECT_TRUE(q.Pop(out));
+    EXPECT_EQ(out, 2);
+
+    EXPECT_FALSE(q.Pop(out));
+    EXPECT_EQ(q.Steal(out), StealResult::Empty);
+    EXPECT_EQ(q.SizeApprox(), 0u);
+}
+
+TEST(CoreWorkStealingDeque, GrowsAndPreservesOrderAcrossWrapAround)
+{
+    WorkStealingDeque<int> q(2);
+    EXPECT_EQ(q.Capacity(), 2u);
+
+    // Advance top so the grown ring copies a wrapped range.
+    int out = 0;
+    q.Push(-1);
+    EXPECT_EQ(q.Steal(out), StealResult::Success);
+
+    for (int i = 0; i < 100; ++i)
+        q.Push(i);
+    EXPECT_GE(q.Capacity(), 100u);
+    EXPECT_EQ(q.SizeApprox(), 100u);
+
+    for (int i = 0; i < 50; ++i)
+    {
+        ASSERT_EQ(q.Steal(out), StealResult::Success);
+        EXPECT_EQ(out, i);
+    }
+    for (int i = 99; i >= 50; --i)
+    {
+        ASSERT_TRUE(q.Pop(out));
+        EXPECT_EQ(out, i);
+    }
+    EXPECT_FALSE(q.Pop(out));
+}
+
+TEST(CoreWorkStealingDeque, ConcurrentStealsDeliverEachItemExactlyOnce)
+{
+    constexpr std::uint32_t kItemCount = 200'000u;
+    constexpr unsigned kThiefCount = 3u;
+
+    WorkStealingDeque<std::uint32_t> q(16);
+    std::vector<std::atomic<std::uint8_t>> seen(kItemCount);
+    std::atomic<std::uint32_t> taken{0u};
+    std::atomic<bool> producing{true};
+
+    const auto consume = [&](const std::uint32_t item)
+    {
+        seen[item].fetch_add(1u, std::memory_order_relaxed);
+        taken.fetch_add(1u, std::memory_order_relaxed);
+    };
+
+    std::vector<std::thread> thieves;
+    for (unsigned t = 0; t < kThiefCount; ++t)
+    {
+        thieves.emplace_back([&]()
+        {
+            std::uint32_t item = 0u;
+            while (producing.load(std::memory_order_acquire) ||
+                   taken.load(std::memory_order_relaxed) < kItemCount)
+            {
+                if (q.Steal(item) == StealResult::Success)
+                    consume(item);
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Interleave pushes with owner pops so the last-item race is exercised.
+    std::uint32_t item = 0u;
+    for (std::uint32_t i = 0; i < kItemCount; ++i)
+    {
+        q.Push(i);
+        if ((i & 3u) == 0u && q.Pop(item))
+            consume(item);
+    }
+    while (q.Pop(item))
+        consume(item);
+    producing.store(false, std::memory_order_release);
+
+    for (auto& thief : thieves)
+        thief.join();
+
+    EXPECT_EQ(taken.load(), kItemCount);
+    std::uint32_t duplicatesOrMissing = 0u;
+    for (const auto& count : seen)
+    {
+        if (count.load(std::memory_order_relaxed) != 1u)
+            ++duplicatesOrMissing;
+    }
+    EXPECT_EQ(duplicatesOrMissing, 0u);
+}
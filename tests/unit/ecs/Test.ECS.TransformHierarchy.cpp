@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+
 #include <entt/entity/registry.hpp>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -16,6 +18,7 @@ import Extrinsic.ECS.System.TransformHierarchy;
 
 using Extrinsic::ECS::EntityHandle;
 using Extrinsic::ECS::Hierarchy::Attach;
+using Extrinsic::ECS::Hierarchy::Detach;
 using Extrinsic::ECS::Scene::CreateDefault;
 using Extrinsic::ECS::Scene::Registry;
 namespace Components = Extrinsic::ECS::Components;
@@ -171,3 +174,80 @@ TEST(ECSTransformHierarchy, EntityWithoutTransformIsIgnored)
 
     EXPECT_FALSE(raw.all_of<Components::Transform::WorldUpdatedTag>(bare));
 }
+
+TEST(ECSTransformHierarchy, DirtyLeafUpdatesOnlyItsOwnSubtree)
+{
+    Registry r;
+    auto& raw = r.Raw();
+    const EntityHandle root = CreateDefault(r, "Root");
+    const EntityHandle left = CreateDefault(r, "L");
+    const EntityHandle right = CreateDefault(r, "R");
+    const EntityHandle leftLeaf = CreateDefault(r, "LL");
+    const EntityHandle rightLeaf = CreateDefault(r, "RL");
+    Attach(raw, left, root);
+    Attach(raw, right, root);
+    Attach(raw, leftLeaf, left);
+    Attach(raw, rightLeaf, right);
+    raw.emplace_or_replace<Components::Transform::IsDirtyTag>(root);
+    TransformSystem::OnUpdate(raw);
+    raw.clear<Components::Transform::WorldUpdatedTag>();
+
+    raw.get<Components::Transform::Component>(right).Position = glm::vec3(0.0f, 3.0f, 0.0f);
+    raw.emplace<Components::Transform::IsDirtyTag>(right);
+    TransformSystem::OnUpdate(raw);
+
+    EXPECT_FALSE(raw.all_of<Components::Transform::WorldUpdatedTag>(root));
+    EXPECT_FALSE(raw.all_of<Components::Transform::WorldUpdatedTag>(left));
+    EXPECT_FALSE(raw.all_of<Components::Transform::WorldUpdatedTag>(leftLeaf));
+    EXPECT_TRUE(raw.all_of<Components::Transform::WorldUpdatedTag>(right));
+    EXPECT_TRUE(raw.all_of<Components::Transform::WorldUpdatedTag>(rightLeaf));
+    const glm::vec4 origin = raw.get<Components::Transform::WorldMatrix>(rightLeaf).Matrix *
+                             glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    EXPECT_NEAR(origin.y, 3.0f, 1e-5f);
+}
+
+TEST(ECSTransformHierarchy, FlatOrderIsRebuiltOnlyAfterStructuralEdits)
+{
+    Registry r;
+    auto& raw = r.Raw();
+    const EntityHandle root = CreateDefault(r, "Root");
+    const EntityHandle child = CreateDefault(r, "C");
+    const EntityHandle grandchild = CreateDefault(r, "G");
+    Attach(raw, child, root);
+    Attach(raw, grandchild, child);
+
+    const auto order = TransformSystem::GetFlatOrder(raw);
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[0].Entity, root);
+    EXPECT_EQ(order[0].Parent, TransformSystem::InvalidFlatIndex);
+    EXPECT_EQ(order[1].Entity, child);
+    EXPECT_EQ(order[1].Parent, 0u);
+    EXPECT_EQ(order[2].Entity, grandchild);
+    EXPECT_EQ(order[2].Parent, 1u);
+    const std::uint64_t builds = TransformSystem::GetFlatOrderRebuildCount(raw);
+
+    // Dirty tags and local edits reuse the cached order.
+    raw.get<Components::Transform::Component>(child).Position = glm::vec3(1.0f, 0.0f, 0.0f);
+    raw.emplace_or_replace<Components::Transform::IsDirtyTag>(child);
+    TransformSystem::OnUpdate(raw);
+    EXPECT_EQ(TransformSystem::GetFlatOrderRebuildCount(raw), builds);
+
+    // Re-parenting invalidates it.
+    Detach(raw, grandchild);
+    raw.emplace_or_replace<Components::Transform::IsDirtyTag>(grandchild);
+    TransformSystem::OnUpdate(raw);
+    EXPECT_EQ(TransformSystem::GetFlatOrderRebuildCount(raw), builds + 1u);
+    EXPECT_EQ(TransformSystem::GetFlatOrder(raw).size(), 3u);
+
+    // So does a traversal component appearing or disappearing: without a
+    // world matrix the child's subtree drops out of the order.
+    Attach(raw, grandchild, child);
+    raw.remove<Components::Transform::WorldMatrix>(child);
+    const auto pruned = TransformSystem::GetFlatOrder(raw);
+    ASSERT_EQ(pruned.size(), 1u);
+    EXPECT_EQ(pruned[0].Entity, root);
+
+    raw.emplace_or_replace<Components::Transform::IsDirtyTag>(grandchild);
+    TransformSystem::OnUpdate(raw);
+    EXPECT_TRUE(raw.all_of<Components::Transform::IsDirtyTag>(grandchild));
+}
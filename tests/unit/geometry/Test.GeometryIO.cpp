@@ -20,8 +20,11 @@
 #include <glm/glm.hpp>
 
 import Extrinsic.Core.Error;
+import Extrinsic.Core.IOBackend;
 import Geometry;
 
+#include "SchedulerScope.hpp"
+
 #ifndef INTRINSIC_TEST_SUPPORT_DIR
 #define INTRINSIC_TEST_SUPPORT_DIR "tests/support"
 #endif
@@ -94,6 +97,94 @@ namespace
         return std::string(INTRINSIC_TEST_SUPPORT_DIR) + "/geometry/geometry_io/" + filename;
     }
 
+    struct LasFixturePoint
+    {
+        std::int32_t X = 0;
+        std::int32_t Y = 0;
+        std::int32_t Z = 0;
+        std::uint16_t Intensity = 0;
+        std::uint8_t ReturnNumber = 1;
+        std::uint8_t ReturnCount = 1;
+        // Raw class byte; legacy formats keep flags in the top three bits.
+        std::uint8_t Classification = 0;
+        double GpsTime = 0.0;
+        std::array<std::uint16_t, 3> Rgb{};
+    };
+
+    template <typename T>
+    void PutPod(std::string& bytes, const std::size_t offset, const T& value)
+    {
+        std::memcpy(bytes.data() + offset, &value, sizeof(T));
+    }
+
+    // A LAS 1.<minor> file with no VLRs; records carry extraBytes zero
+    // bytes past the core layout of the point format.
+    [[nodiscard]] std::string MakeLasFile(const std::uint8_t minor,
+                                          const std::uint8_t format,
+                                          const std::vector<LasFixturePoint>& points,
+                                          const glm::dvec3 scale,
+                                          const glm::dvec3 offset,
+                                          const std::uint16_t extraBytes = 0)
+    {
+        constexpr std::array<std::uint16_t, 11> kRecordLength{20, 28, 26, 34, 57, 63, 30, 36, 38, 59, 67};
+        const std::uint16_t headerSize = minor >= 4 ? 375 : minor == 3 ? 235 : 227;
+        const std::uint16_t recordLength = static_cast<std::uint16_t>(kRecordLength[format] + extraBytes);
+        const bool extended = format >= 6;
+
+        std::string bytes(headerSize, '\0');
+        bytes.replace(0, 4, "LASF");
+        PutPod(bytes, 24, std::uint8_t{1});
+        PutPod(bytes, 25, minor);
+        PutPod(bytes, 94, headerSize);
+        PutPod(bytes, 96, static_cast<std::uint32_t>(headerSize));
+        PutPod(bytes, 104, format);
+        PutPod(bytes, 105, recordLength);
+        PutPod(bytes, 107, static_cast<std::uint32_t>(extended ? 0u : points.size()));
+        PutPod(bytes, 131, scale.x);
+        PutPod(bytes, 139, scale.y);
+        PutPod(bytes, 147, scale.z);
+        PutPod(bytes, 155, offset.x);
+        PutPod(bytes, 163, offset.y);
+        PutPod(bytes, 171, offset.z);
+        if (minor >= 4)
+        {
+            PutPod(bytes, 247, static_cast<std::uint64_t>(points.size()));
+        }
+
+        const bool hasGpsTime = format == 1 || format >= 3;
+        const bool hasRgb = format == 2 || format == 3 || format == 5 || format == 7 || format == 8 || format == 10;
+        const std::size_t gpsOffset = extended ? 22 : 20;
+        const std::size_t rgbOffset = format == 2 ? 20 : extended ? 30 : 28;
+        for (const LasFixturePoint& point : points)
+        {
+            std::string record(recordLength, '\0');
+            PutPod(record, 0, point.X);
+            PutPod(record, 4, point.Y);
+            PutPod(record, 8, point.Z);
+            PutPod(record, 12, point.Intensity);
+            if (extended)
+            {
+                PutPod(record, 14, static_cast<std::uint8_t>(point.ReturnNumber | (point.ReturnCount << 4)));
+                PutPod(record, 16, point.Classification);
+            }
+            else
+            {
+                PutPod(record, 14, static_cast<std::uint8_t>(point.ReturnNumber | (point.ReturnCount << 3)));
+                PutPod(record, 15, point.Classification);
+            }
+            if (hasGpsTime)
+            {
+                PutPod(record, gpsOffset, point.GpsTime);
+            }
+            if (hasRgb)
+            {
+                PutPod(record, rgbOffset, point.Rgb);
+            }
+            bytes += record;
+        }
+        return bytes;
+    }
+
     void ExpectPointCloudPositionsEqual(const Geometry::PointCloud::Cloud& lhs,
                                         const Geometry::PointCloud::Cloud& rhs)
     {
@@ -129,7 +220,7 @@ TEST(GeometryIO_Metadata, ReportsSupportedImportAndExportDomains)
     using Geometry::IO::SupportsExportDomain;
     using Geometry::IO::SupportsImportDomain;
 
-    EXPECT_EQ(SupportedGeometryIOFormats().size(), 14u);
+    EXPECT_EQ(SupportedGeometryIOFormats().size(), 15u);
 
     const auto* ply = FindGeometryIOFormat(".PLY");
     ASSERT_NE(ply, nullptr);
@@ -170,6 +261,8 @@ TEST(GeometryIO_Metadata, ReportsSupportedImportAndExportDomains)
     EXPECT_FALSE(SupportsExportDomain("txt", GeometryIODomain::PointCloud));
     EXPECT_FALSE(SupportsExportDomain("xyzrgb", GeometryIODomain::PointCloud));
     EXPECT_TRUE(SupportsExportDomain("pcd", GeometryIODomain::PointCloud));
+    EXPECT_TRUE(SupportsImportDomain("las", GeometryIODomain::PointCloud));
+    EXPECT_FALSE(SupportsExportDomain("las", GeometryIODomain::PointCloud));
 
     EXPECT_TRUE(SupportsImportDomain("tgf", GeometryIODomain::Graph));
     EXPECT_TRUE(SupportsExportDomain("edges", GeometryIODomain::Graph));
@@ -205,7 +298,7 @@ TEST(GeometryIO_Metadata, ReportsAssetRoutingReadinessForAllPromotedFormats)
         bool AmbiguousExport = false;
     };
 
-    const std::array<ExpectedFormat, 14> expected{{
+    const std::array<ExpectedFormat, 15> expected{{
         {"obj", GeometryIOFormatKind::OBJ, true, false, false, true, false, false, false, false, false, false},
         {"off", GeometryIOFormatKind::OFF, true, false, false, true, false, false, false, false, false, false},
         {"stl", GeometryIOFormatKind::STL, true, false, false, true, false, false, true, true, false, false},
@@ -218,6 +311,7 @@ TEST(GeometryIO_Metadata, ReportsAssetRoutingReadinessForAllPromotedFormats)
         {"txt", GeometryIOFormatKind::TXT, false, true, false, false, false, false, false, false, false, false},
         {"xyzrgb", GeometryIOFormatKind::XYZRGB, false, true, false, false, false, false, false, false, false, false},
         {"pcd", GeometryIOFormatKind::PCD, false, true, false, false, true, false, true, true, false, false},
+        {"las", GeometryIOFormatKind::LAS, false, true, false, false, false, false, true, false, false, false},
         {"tgf", GeometryIOFormatKind::TGF, false, false, true, false, false, true, false, false, false, false},
         {"edges", GeometryIOFormatKind::EdgeList, false, false, true, false, false, true, false, false, false, false},
     }};
@@ -1875,6 +1969,383 @@ TEST(GeometryIO_PointCloudIO, LoadsASCIIPCDWithSignedPackedRgba)
     EXPECT_NEAR(result->Cloud.Color(Geometry::VertexHandle{0}).a, 128.0f / 255.0f, 1.0e-6f);
 }
 
+TEST(GeometryIO_PointCloudIO, ChunkedAsciiReadersMatchSingleChunkParse)
+{
+    // Mixed column counts so normals and colors first appear mid-chunk.
+    std::string txt = "1500\n";
+    std::string csv;
+    for (int i = 0; i < 1500; ++i)
+    {
+        const std::string xyz = std::to_string(i) + " " + std::to_string(i % 7) + " -" + std::to_string(i % 11);
+        if (i % 3 == 0)
+        {
+            txt += xyz + "\n";
+        }
+        else if (i % 3 == 1)
+        {
+            txt += xyz + " 0 0 1\n";
+        }
+        else
+        {
+            txt += xyz + " " + std::to_string(i % 256) + " 128 0 1\n";
+        }
+        csv += std::to_string(i) + ",1.5," + std::to_string(-i) + (i % 2 == 0 ? ",0,1,0\n" : "\n");
+    }
+    TempFile txtFile(".txt", txt);
+    TempFile csvFile(".csv", csv);
+
+    const auto txtReference = Geometry::PointCloudIO::LoadTXT(txtFile.Path);
+    const auto csvReference = Geometry::PointCloudIO::LoadCSV(csvFile.Path);
+    ASSERT_TRUE(txtReference.has_value());
+    ASSERT_TRUE(csvReference.has_value());
+    EXPECT_EQ(txtReference->Cloud.VerticesSize(), 1500u);
+    EXPECT_TRUE(txtReference->Cloud.HasNormals());
+    EXPECT_TRUE(txtReference->Cloud.HasColors());
+
+    TestSupport::SchedulerScope scheduler(4);
+    Extrinsic::Core::IO::FileIOBackend backend;
+    const Geometry::PointCloudIO::AsciiLoadOptions options{.ChunkBytes = 256};
+    Geometry::PointCloudIO::AsciiLoadDiagnostics diagnostics;
+
+    const auto txtChunked = Geometry::PointCloudIO::LoadTXT(txtFile.Path, backend, options, &diagnostics);
+    ASSERT_TRUE(txtChunked.has_value());
+    EXPECT_GT(diagnostics.ChunkCount, 100u);
+    EXPECT_EQ(diagnostics.FailedLine, 0u);
+    ExpectPointCloudPositionsEqual(txtChunked->Cloud, txtReference->Cloud);
+
+    const auto csvChunked = Geometry::PointCloudIO::LoadCSV(csvFile.Path, backend, options, &diagnostics);
+    ASSERT_TRUE(csvChunked.has_value());
+    EXPECT_GT(diagnostics.ChunkCount, 100u);
+    ExpectPointCloudPositionsEqual(csvChunked->Cloud, csvReference->Cloud);
+}
+
+TEST(GeometryIO_PointCloudIO, ChunkedAsciiReadersReportFailedLine)
+{
+    TestSupport::SchedulerScope scheduler(4);
+    Extrinsic::Core::IO::FileIOBackend backend;
+    const Geometry::PointCloudIO::AsciiLoadOptions options{.ChunkBytes = 16};
+    Geometry::PointCloudIO::AsciiLoadDiagnostics diagnostics;
+
+    std::string rows;
+    for (int i = 0; i < 200; ++i)
+    {
+        rows += "1 2 3\n";
+    }
+
+    // Line 1 is a comment, so the malformed row on line 152 is row 150.
+    std::string threeD = "# scan\n" + rows;
+    threeD.replace(150u * 6u + 7u, 5u, "1 x 3");
+    TempFile threeDFile(".3d", threeD);
+    const auto threeDResult = Geometry::PointCloudIO::Load3D(threeDFile.Path, backend, options, &diagnostics);
+    ASSERT_FALSE(threeDResult.has_value());
+    EXPECT_EQ(threeDResult.error(), Extrinsic::Core::ErrorCode::InvalidFormat);
+    EXPECT_EQ(diagnostics.FailedLine, 152u);
+
+    // Declares 120 points; the first surplus row (line 122) is rejected even
+    // though a later chunk also holds a malformed row.
+    TempFile ptsFile(".pts", "120\n" + rows + "nope\n");
+    const auto ptsResult = Geometry::PointCloudIO::LoadPTS(ptsFile.Path, backend, options, &diagnostics);
+    ASSERT_FALSE(ptsResult.has_value());
+    EXPECT_EQ(diagnostics.FailedLine, 122u);
+
+    // XYZ stops at its declared count, so the non-finite row after it is
+    // never read; without a count it rejects the load at its line.
+    TempFile xyzCounted(".xyz", "LH1\n200\n" + rows + "nan 0 0\n");
+    const auto countedResult = Geometry::PointCloudIO::LoadXYZ(xyzCounted.Path, backend, options, &diagnostics);
+    ASSERT_TRUE(countedResult.has_value());
+    EXPECT_EQ(countedResult->Cloud.VerticesSize(), 200u);
+    EXPECT_EQ(diagnostics.FailedLine, 0u);
+
+    TempFile xyzOpen(".xyz", "LH1\n" + rows + "nan 0 0\n");
+    const auto openResult = Geometry::PointCloudIO::LoadXYZ(xyzOpen.Path, backend, options, &diagnostics);
+    ASSERT_FALSE(openResult.has_value());
+    EXPECT_EQ(diagnostics.FailedLine, 202u);
+
+    // Nine header lines precede the body.
+    TempFile pcd(".pcd",
+                 "# .PCD v0.7\n"
+                 "FIELDS x y z\n"
+                 "SIZE 4 4 4\n"
+                 "TYPE F F F\n"
+                 "COUNT 1 1 1\n"
+                 "WIDTH 201\n"
+                 "HEIGHT 1\n"
+                 "POINTS 201\n"
+                 "DATA ascii\n" +
+                     rows + "1 2\n");
+    const auto pcdResult = Geometry::PointCloudIO::LoadPCD(pcd.Path, backend, options, &diagnostics);
+    ASSERT_FALSE(pcdResult.has_value());
+    EXPECT_EQ(diagnostics.FailedLine, 210u);
+
+    // Failures not tied to a row leave FailedLine at zero.
+    TempFile shortPts(".pts", "300\n" + rows);
+    const auto shortResult = Geometry::PointCloudIO::LoadPTS(shortPts.Path, backend, options, &diagnostics);
+    ASSERT_FALSE(shortResult.has_value());
+    EXPECT_EQ(diagnostics.FailedLine, 0u);
+}
+
+TEST(GeometryIO_PointCloudIO, LoadsLas12PointFormat3WithAttributes)
+{
+    using namespace Geometry::PointCloudIO;
+
+    std::vector<LasFixturePoint> points(3);
+    points[0] = {.X = 150, .Y = -250, .Z = 25, .Intensity = 1200, .ReturnNumber = 1, .ReturnCount = 2,
+                 .Classification = 2, .GpsTime = 1.5, .Rgb = {65535, 0, 32768}};
+    // Synthetic flag set on top of class 6.
+    points[1] = {.X = 0, .Y = 0, .Z = 0, .Intensity = 7, .ReturnNumber = 2, .ReturnCount = 2,
+                 .Classification = 0x20 | 6, .GpsTime = 2.25, .Rgb = {0, 65535, 0}};
+    points[2] = {.X = -100, .Y = 400, .Z = -8, .Intensity = 65535, .ReturnNumber = 1, .ReturnCount = 1,
+                 .Classification = 9, .GpsTime = 3.0, .Rgb = {0, 0, 65535}};
+    TempFile file(".las", MakeLasFile(2, 3, points, glm::dvec3(0.01), glm::dvec3(1000.0, 2000.0, 0.0)));
+
+    const auto loaded = LoadLAS(file.Path);
+    ASSERT_TRUE(loaded.has_value());
+    const auto& cloud = loaded->Cloud;
+    ASSERT_EQ(cloud.VerticesSize(), 3u);
+    EXPECT_EQ(cloud.Positions()[0], glm::vec3(1001.5f, 1997.5f, 0.25f));
+    EXPECT_EQ(cloud.Positions()[1], glm::vec3(1000.0f, 2000.0f, 0.0f));
+    EXPECT_EQ(cloud.Positions()[2], glm::vec3(999.0f, 2004.0f, -0.08f));
+    ASSERT_TRUE(cloud.HasColors());
+    EXPECT_EQ(cloud.Colors()[0], glm::vec4(1.0f, 0.0f, static_cast<float>(32768.0 / 65535.0), 1.0f));
+    EXPECT_EQ(cloud.Colors()[1], glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
+    EXPECT_FALSE(cloud.HasNormals());
+
+    const auto intensity = cloud.GetVertexProperty<std::uint16_t>(kLasIntensityProperty);
+    const auto classification = cloud.GetVertexProperty<std::uint8_t>(kLasClassificationProperty);
+    const auto returnNumber = cloud.GetVertexProperty<std::uint8_t>(kLasReturnNumberProperty);
+    const auto returnCount = cloud.GetVertexProperty<std::uint8_t>(kLasReturnCountProperty);
+    const auto gpsTime = cloud.GetVertexProperty<double>(kLasGpsTimeProperty);
+    ASSERT_TRUE(intensity.IsValid());
+    ASSERT_TRUE(classification.IsValid());
+    ASSERT_TRUE(returnNumber.IsValid());
+    ASSERT_TRUE(returnCount.IsValid());
+    ASSERT_TRUE(gpsTime.IsValid());
+    EXPECT_EQ(intensity[0], 1200u);
+    EXPECT_EQ(intensity[2], 65535u);
+    EXPECT_EQ(classification[0], 2u);
+    EXPECT_EQ(classification[1], 6u);
+    EXPECT_EQ(classification[2], 9u);
+    EXPECT_EQ(returnNumber[1], 2u);
+    EXPECT_EQ(returnCount[0], 2u);
+    EXPECT_EQ(returnCount[2], 1u);
+    EXPECT_EQ(gpsTime[1], 2.25);
+}
+
+TEST(GeometryIO_PointCloudIO, LoadsLas14PointFormat7WithExtraBytesAndOrigin)
+{
+    using namespace Geometry::PointCloudIO;
+
+    std::vector<LasFixturePoint> points(2);
+    points[0] = {.X = 1234567, .Y = 7654321, .Z = 4500, .Intensity = 10, .ReturnNumber = 3, .ReturnCount = 5,
+                 .Classification = 40, .GpsTime = 1.0e8, .Rgb = {256, 512, 1024}};
+    points[1] = {.X = 1234000, .Y = 7654000, .Z = 4000, .Intensity = 20, .ReturnNumber = 15, .ReturnCount = 15,
+                 .Classification = 255, .GpsTime = 1.0e8 + 0.5, .Rgb = {65535, 65535, 65535}};
+    TempFile file(".las", MakeLasFile(4, 7, points, glm::dvec3(0.001), glm::dvec3(500000.0, 4000000.0, 0.0), 5));
+
+    Extrinsic::Core::IO::MmapIOBackend backend;
+    const auto header = ReadLASHeader(file.Path, backend);
+    ASSERT_TRUE(header.has_value());
+    EXPECT_EQ(header->VersionMinor, 4u);
+    EXPECT_EQ(header->PointFormat, 7u);
+    EXPECT_EQ(header->PointRecordLength, 41u);
+    EXPECT_EQ(header->PointCount, 2u);
+    EXPECT_TRUE(header->HasGpsTime());
+    EXPECT_TRUE(header->HasColors());
+
+    // Without an origin these coordinates would round to float spacing
+    // (0.5 m at 4e6).
+    LasLoadOptions options;
+    options.Origin = glm::dvec3(501234.0, 4007654.0, 4.0);
+    const auto loaded = LoadLAS(file.Path, backend, options);
+    ASSERT_TRUE(loaded.has_value());
+    const auto& cloud = loaded->Cloud;
+    ASSERT_EQ(cloud.VerticesSize(), 2u);
+    EXPECT_NEAR(cloud.Positions()[0].x, 0.567f, 1e-6f);
+    EXPECT_NEAR(cloud.Positions()[0].y, 0.321f, 1e-6f);
+    EXPECT_NEAR(cloud.Positions()[0].z, 0.5f, 1e-6f);
+    EXPECT_NEAR(cloud.Positions()[1].x, 0.0f, 1e-6f);
+    EXPECT_NEAR(cloud.Positions()[1].y, 0.0f, 1e-6f);
+
+    const auto classification = cloud.GetVertexProperty<std::uint8_t>(kLasClassificationProperty);
+    const auto returnNumber = cloud.GetVertexProperty<std::uint8_t>(kLasReturnNumberProperty);
+    const auto returnCount = cloud.GetVertexProperty<std::uint8_t>(kLasReturnCountProperty);
+    const auto gpsTime = cloud.GetVertexProperty<double>(kLasGpsTimeProperty);
+    ASSERT_TRUE(classification.IsValid());
+    EXPECT_EQ(classification[0], 40u);
+    EXPECT_EQ(classification[1], 255u);
+    EXPECT_EQ(returnNumber[0], 3u);
+    EXPECT_EQ(returnCount[0], 5u);
+    EXPECT_EQ(returnNumber[1], 15u);
+    EXPECT_EQ(returnCount[1], 15u);
+    EXPECT_EQ(gpsTime[1], 1.0e8 + 0.5);
+    EXPECT_EQ(cloud.Colors()[1], glm::vec4(1.0f));
+}
+
+TEST(GeometryIO_PointCloudIO, StreamsLasInFixedSizeBatches)
+{
+    using namespace Geometry::PointCloudIO;
+
+    std::vector<LasFixturePoint> points(10);
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        points[i].X = static_cast<std::int32_t>(i);
+        points[i].Y = static_cast<std::int32_t>(2 * i);
+        points[i].Intensity = static_cast<std::uint16_t>(100 + i);
+        points[i].Classification = static_cast<std::uint8_t>(i % 3);
+        points[i].GpsTime = static_cast<double>(i);
+    }
+    TempFile file(".las", MakeLasFile(2, 1, points, glm::dvec3(1.0), glm::dvec3(0.0)));
+    Extrinsic::Core::IO::FileIOBackend backend;
+
+    LasLoadOptions options;
+    options.BatchPoints = 4;
+    std::vector<std::uint64_t> firstRecords;
+    std::vector<glm::vec3> streamed;
+    std::vector<std::uint16_t> intensities;
+    const auto header = StreamLAS(file.Path, backend, options, [&](const LasPointBatch& batch)
+    {
+        firstRecords.push_back(batch.FirstRecord);
+        EXPECT_EQ(batch.Intensities.size(), batch.Positions.size());
+        EXPECT_EQ(batch.GpsTimes.size(), batch.Positions.size());
+        EXPECT_TRUE(batch.Colors.empty());
+        streamed.insert(streamed.end(), batch.Positions.begin(), batch.Positions.end());
+        intensities.insert(intensities.end(), batch.Intensities.begin(), batch.Intensities.end());
+        return true;
+    });
+    ASSERT_TRUE(header.has_value());
+    EXPECT_EQ(header->PointCount, 10u);
+    EXPECT_EQ(firstRecords, (std::vector<std::uint64_t>{0u, 4u, 8u}));
+    ASSERT_EQ(streamed.size(), 10u);
+    EXPECT_EQ(streamed[9], glm::vec3(9.0f, 18.0f, 0.0f));
+    EXPECT_EQ(intensities[5], 105u);
+
+    // The whole-cloud load matches the stream for any batch size.
+    {
+        TestSupport::SchedulerScope scheduler(4);
+        options.BatchPoints = 3;
+        const auto loaded = LoadLAS(file.Path, backend, options);
+        ASSERT_TRUE(loaded.has_value());
+        ASSERT_EQ(loaded->Cloud.VerticesSize(), streamed.size());
+        for (std::size_t i = 0; i < streamed.size(); ++i)
+        {
+            EXPECT_EQ(loaded->Cloud.Positions()[i], streamed[i]);
+        }
+        const auto intensity = loaded->Cloud.GetVertexProperty<std::uint16_t>(kLasIntensityProperty);
+        ASSERT_TRUE(intensity.IsValid());
+        EXPECT_EQ(intensity.Vector(), intensities);
+    }
+
+    std::size_t batches = 0;
+    ASSERT_TRUE(StreamLAS(file.Path, backend, options, [&](const LasPointBatch&)
+    {
+        ++batches;
+        return false;
+    }).has_value());
+    EXPECT_EQ(batches, 1u);
+
+    // Crop keeps x in [2, 6]; disabled channels stay empty.
+    options.BatchPoints = 4;
+    options.Crop = true;
+    options.CropMin = glm::dvec3(2.0, -1.0, -1.0);
+    options.CropMax = glm::dvec3(6.0, 100.0, 1.0);
+    options.Intensity = false;
+    options.GpsTime = false;
+    std::vector<glm::vec3> cropped;
+    ASSERT_TRUE(StreamLAS(file.Path, backend, options, [&](const LasPointBatch& batch)
+    {
+        EXPECT_TRUE(batch.Intensities.empty());
+        EXPECT_TRUE(batch.GpsTimes.empty());
+        EXPECT_EQ(batch.Classifications.size(), batch.Positions.size());
+        cropped.insert(cropped.end(), batch.Positions.begin(), batch.Positions.end());
+        return true;
+    }).has_value());
+    ASSERT_EQ(cropped.size(), 5u);
+    EXPECT_EQ(cropped.front(), glm::vec3(2.0f, 4.0f, 0.0f));
+    EXPECT_EQ(cropped.back(), glm::vec3(6.0f, 12.0f, 0.0f));
+
+    const auto croppedCloud = LoadLAS(file.Path, backend, options);
+    ASSERT_TRUE(croppedCloud.has_value());
+    EXPECT_EQ(croppedCloud->Cloud.VerticesSize(), 5u);
+    EXPECT_FALSE(croppedCloud->Cloud.GetVertexProperty<std::uint16_t>(kLasIntensityProperty).IsValid());
+}
+
+TEST(GeometryIO_PointCloudIO, LoadLasRejectsMalformedFiles)
+{
+    using namespace Geometry::PointCloudIO;
+    using Extrinsic::Core::ErrorCode;
+
+    const std::vector<LasFixturePoint> points(4);
+    const std::string valid = MakeLasFile(2, 0, points, glm::dvec3(0.01), glm::dvec3(0.0));
+    Extrinsic::Core::IO::FileIOBackend backend;
+
+    const auto expectError = [&](std::string bytes, const ErrorCode expected)
+    {
+        TempFile file(".las", std::move(bytes));
+        const auto loaded = LoadLAS(file.Path, backend);
+        ASSERT_FALSE(loaded.has_value());
+        EXPECT_EQ(loaded.error(), expected);
+    };
+
+    {
+        SCOPED_TRACE("signature");
+        std::string bytes = valid;
+        bytes[0] = 'X';
+        expectError(bytes, ErrorCode::InvalidFormat);
+    }
+    {
+        SCOPED_TRACE("truncated records");
+        expectError(valid.substr(0, valid.size() - 3), ErrorCode::InvalidFormat);
+    }
+    {
+        SCOPED_TRACE("truncated header");
+        expectError(valid.substr(0, 100), ErrorCode::InvalidFormat);
+    }
+    {
+        SCOPED_TRACE("LAZ-compressed point format");
+        std::string bytes = valid;
+        PutPod(bytes, 104, std::uint8_t{0x80});
+        expectError(bytes, ErrorCode::UnsupportedFormat);
+    }
+    {
+        SCOPED_TRACE("unknown point format");
+        std::string bytes = valid;
+        PutPod(bytes, 104, std::uint8_t{11});
+        expectError(bytes, ErrorCode::UnsupportedFormat);
+    }
+    {
+        SCOPED_TRACE("major version");
+        std::string bytes = valid;
+        PutPod(bytes, 24, std::uint8_t{2});
+        expectError(bytes, ErrorCode::UnsupportedFormat);
+    }
+    {
+        SCOPED_TRACE("record shorter than its format");
+        std::string bytes = valid;
+        PutPod(bytes, 105, std::uint16_t{19});
+        expectError(bytes, ErrorCode::InvalidFormat);
+    }
+    {
+        SCOPED_TRACE("zero scale");
+        std::string bytes = valid;
+        PutPod(bytes, 139, 0.0);
+        expectError(bytes, ErrorCode::InvalidFormat);
+    }
+    {
+        SCOPED_TRACE("no points");
+        expectError(MakeLasFile(2, 0, {}, glm::dvec3(0.01), glm::dvec3(0.0)), ErrorCode::InvalidFormat);
+    }
+
+    TempFile file(".las", valid);
+    LasLoadOptions options;
+    options.BatchPoints = 0;
+    const auto zeroBatch = LoadLAS(file.Path, backend, options);
+    ASSERT_FALSE(zeroBatch.has_value());
+    EXPECT_EQ(zeroBatch.error(), ErrorCode::InvalidArgument);
+    const auto noCallback = StreamLAS(file.Path, backend, LasLoadOptions{}, LasBatchCallback{});
+    ASSERT_FALSE(noCallback.has_value());
+    EXPECT_EQ(noCallback.error(), ErrorCode::InvalidArgument);
+}
+
 TEST(GeometryIO_PointCloudIO, LoadsVertexOnlyASCIIPLY)
 {
     TempFile file(".ply",
@@ -3579,6 +4050,175 @@ TEST(GeometryIO_MeshIO, LoadSTLRejectsTruncatedBinaryPayload)
     EXPECT_EQ(result.error(), Extrinsic::Core::ErrorCode::InvalidFormat);
 }
 
+TEST(GeometryIO_MeshIO, WeldsBinarySTLVerticesByFirstUse)
+{
+    const std::array<std::array<glm::vec3, 3>, 2> triangles{{
+        {glm::vec3{0.0f, 0.0f, 0.0f},
+         glm::vec3{1.0f, 0.0f, 0.0f},
+         glm::vec3{0.0f, 1.0f, 0.0f}},
+        {glm::vec3{1.0f, 0.0f, 0.0f},
+         glm::vec3{1.0f, 1.0f, -0.0f},
+         glm::vec3{0.0f, 1.0f, 0.0f}},
+    }};
+    TempBinarySTL file(triangles, 2u);
+
+    TestSupport::SchedulerScope scheduler(4);
+    const auto result = Geometry::MeshIO::LoadSTL(file.Path, {.WeldSTLVertices = true});
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->Vertices.Size(), 4u);
+    EXPECT_EQ(result->Faces.Size(), 2u);
+
+    auto positions = result->Vertices.Get<glm::vec3>("v:point");
+    ASSERT_TRUE(positions.IsValid());
+    EXPECT_EQ(positions[3], glm::vec3(1.0f, 1.0f, 0.0f));
+
+    auto faceVertices = result->Faces.Get<std::vector<std::uint32_t>>("f:vertices");
+    ASSERT_TRUE(faceVertices.IsValid());
+    EXPECT_EQ(faceVertices[0], (std::vector<std::uint32_t>{0u, 1u, 2u}));
+    EXPECT_EQ(faceVertices[1], (std::vector<std::uint32_t>{1u, 3u, 2u}));
+}
+
+namespace
+{
+    template <typename T>
+    void ExpectSamePropertyValues(const Geometry::PropertySet& expected,
+                                  const Geometry::PropertySet& actual,
+                                  const std::string& name)
+    {
+        auto lhs = expected.Get<T>(name);
+        auto rhs = actual.Get<T>(name);
+        ASSERT_EQ(lhs.IsValid(), rhs.IsValid()) << name;
+        if (lhs.IsValid())
+        {
+            EXPECT_EQ(lhs.Vector(), rhs.Vector()) << name;
+        }
+    }
+
+    void ExpectSameMeshLoad(const Geometry::MeshIO::MeshIOResult& expected,
+                            const Geometry::MeshIO::MeshIOResult& actual)
+    {
+        EXPECT_EQ(expected.Vertices.Size(), actual.Vertices.Size());
+        EXPECT_EQ(expected.Halfedges.Size(), actual.Halfedges.Size());
+        EXPECT_EQ(expected.Faces.Size(), actual.Faces.Size());
+        ExpectSamePropertyValues<glm::vec3>(expected.Vertices, actual.Vertices, "v:point");
+        ExpectSamePropertyValues<glm::vec3>(expected.Vertices, actual.Vertices, "v:normal");
+        ExpectSamePropertyValues<glm::vec4>(expected.Vertices, actual.Vertices, "v:color");
+        ExpectSamePropertyValues<glm::vec2>(expected.Vertices, actual.Vertices, "v:texcoord");
+        ExpectSamePropertyValues<glm::vec2>(expected.Halfedges, actual.Halfedges, "h:texcoord");
+        ExpectSamePropertyValues<glm::vec3>(expected.Halfedges, actual.Halfedges, "h:normal");
+        ExpectSamePropertyValues<std::vector<std::uint32_t>>(expected.Faces, actual.Faces, "f:vertices");
+    }
+}
+
+TEST(GeometryIO_MeshIO, ChunkedMeshLoadsMatchSingleChunkLoads)
+{
+    // A 6x6 grid of quads, written so that chunk seams split vertex, face and
+    // comment rows; OBJ faces use relative indices and per-corner texcoords.
+    constexpr int kSide = 7;
+    std::ostringstream obj;
+    std::ostringstream off;
+    std::ostringstream ply;
+    off << "OFF\n# grid\n" << kSide * kSide << ' ' << (kSide - 1) * (kSide - 1) << " 0\n";
+    ply << "ply\nformat ascii 1.0\nelement vertex " << kSide * kSide
+        << "\nproperty float x\nproperty float y\nproperty float z\n"
+        << "element face " << (kSide - 1) * (kSide - 1)
+        << "\nproperty list uchar int vertex_indices\nend_header\n";
+    std::string binaryPly = "ply\nformat binary_little_endian 1.0\nelement vertex " +
+                            std::to_string(kSide * kSide) +
+                            "\nproperty float x\nproperty float y\nproperty float z\n"
+                            "element face " + std::to_string((kSide - 1) * (kSide - 1)) +
+                            "\nproperty list uchar int vertex_indices\nend_header\n";
+    for (int y = 0; y < kSide; ++y)
+    {
+        for (int x = 0; x < kSide; ++x)
+        {
+            obj << "v " << x << ' ' << y << " 0.5\nvt " << x * 0.125 << ' ' << y * 0.25 << '\n';
+            off << x << ' ' << y << " 0.5\n# row " << y << '\n';
+            ply << x << ' ' << y << " 0.5\n";
+            AppendPod(binaryPly, static_cast<float>(x));
+            AppendPod(binaryPly, static_cast<float>(y));
+            AppendPod(binaryPly, 0.5f);
+        }
+    }
+    obj << "vn 0 0 1\n";
+    for (int y = 0; y + 1 < kSide; ++y)
+    {
+        for (int x = 0; x + 1 < kSide; ++x)
+        {
+            const std::array<int, 4> corners{
+                y * kSide + x, y * kSide + x + 1, (y + 1) * kSide + x + 1, (y + 1) * kSide + x};
+            obj << 'f';
+            off << '4';
+            ply << '4';
+            AppendPod(binaryPly, std::uint8_t{4});
+            for (const int corner : corners)
+            {
+                const int relative = corner - kSide * kSide;
+                obj << ' ' << relative << '/' << relative << "/-1";
+                off << ' ' << corner;
+                ply << ' ' << corner;
+                AppendPod(binaryPly, static_cast<std::int32_t>(corner));
+            }
+            obj << " # quad\n";
+            off << '\n';
+            ply << '\n';
+        }
+    }
+
+    TempFile objFile(".obj", obj.str());
+    TempFile offFile(".off", off.str());
+    TempFile plyFile(".ply", ply.str());
+    TempFile binaryPlyFile(".ply", binaryPly);
+
+    const auto objReference = Geometry::MeshIO::LoadOBJ(objFile.Path);
+    const auto offReference = Geometry::MeshIO::LoadOFF(offFile.Path);
+    const auto plyReference = Geometry::MeshIO::LoadPLY(plyFile.Path);
+    const auto binaryPlyReference = Geometry::MeshIO::LoadPLY(binaryPlyFile.Path);
+    ASSERT_TRUE(objReference.has_value());
+    ASSERT_TRUE(offReference.has_value());
+    ASSERT_TRUE(plyReference.has_value());
+    ASSERT_TRUE(binaryPlyReference.has_value());
+    EXPECT_EQ(objReference->Faces.Size(), 36u);
+    EXPECT_EQ(objReference->Halfedges.Size(), 144u);
+    ExpectSameMeshLoad(*offReference, *plyReference);
+    ExpectSameMeshLoad(*offReference, *binaryPlyReference);
+
+    TestSupport::SchedulerScope scheduler(4);
+    for (const std::size_t chunkBytes : {std::size_t{1}, std::size_t{7}, std::size_t{64}})
+    {
+        SCOPED_TRACE(chunkBytes);
+        const Geometry::MeshIO::MeshLoadOptions options{.ChunkBytes = chunkBytes};
+
+        const auto objChunked = Geometry::MeshIO::LoadOBJ(objFile.Path, options);
+        ASSERT_TRUE(objChunked.has_value());
+        ExpectSameMeshLoad(*objReference, *objChunked);
+
+        const auto offChunked = Geometry::MeshIO::LoadOFF(offFile.Path, options);
+        ASSERT_TRUE(offChunked.has_value());
+        ExpectSameMeshLoad(*offReference, *offChunked);
+
+        const auto plyChunked = Geometry::MeshIO::LoadPLY(plyFile.Path, options);
+        ASSERT_TRUE(plyChunked.has_value());
+        ExpectSameMeshLoad(*plyReference, *plyChunked);
+
+        const auto binaryPlyChunked = Geometry::MeshIO::LoadPLY(binaryPlyFile.Path, options);
+        ASSERT_TRUE(binaryPlyChunked.has_value());
+        ExpectSameMeshLoad(*binaryPlyReference, *binaryPlyChunked);
+    }
+}
+
+TEST(GeometryIO_MeshIO, ChunkedOBJRejectsOutOfRangeRelativeIndex)
+{
+    // With 8-byte chunks every row lands in its own chunk, so the face
+    // resolves -4 against the three vertices counted by earlier chunks.
+    TempFile file(".obj", "v 0 0 0\nv 1 0 0\nv 0 1 0\nf -1 -2 -4\n");
+
+    TestSupport::SchedulerScope scheduler(4);
+    const auto result = Geometry::MeshIO::LoadOBJ(file.Path, {.ChunkBytes = 8});
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Extrinsic::Core::ErrorCode::InvalidFormat);
+}
+
 TEST(GeometryIO_MeshIO, LoadsASCIISTLAfterBinaryDispatch)
 {
     // Regression: the ASCII fallback inside IsBinarySTL must classify a
@@ -4669,6 +5309,51 @@ TEST(GeometryIO_PointCloudIO, LoadsBinaryLittleEndianPLYPointCloud)
     EXPECT_EQ(result->Cloud.Position(Geometry::VertexHandle{2}), glm::vec3(0.0f, 1.0f, 2.0f));
 }
 
+TEST(GeometryIO_PointCloudIO, MappedBackendLoadsMatchFileLoads)
+{
+    const std::array<BinaryPlyPointCloudVertex, 2> vertices{{
+        {glm::vec3{0.0f, 1.0f, 2.0f}, true, glm::vec3{0.0f, 0.0f, 1.0f}, false, 0, 0, 0, false, 0.0f},
+        {glm::vec3{3.0f, 4.0f, 5.0f}, true, glm::vec3{1.0f, 0.0f, 0.0f}, false, 0, 0, 0, false, 0.0f},
+    }};
+    TempBinaryPLYPointCloud ply(vertices, BinaryPlyEndian::Little);
+    TempFile pcd(".pcd",
+                 "# .PCD v0.7\n"
+                 "FIELDS x y z\n"
+                 "SIZE 4 4 4\n"
+                 "TYPE F F F\n"
+                 "COUNT 1 1 1\n"
+                 "WIDTH 2\n"
+                 "HEIGHT 1\n"
+                 "POINTS 2\n"
+                 "DATA ascii\n"
+                 "0 1 2\n"
+                 "3 4 5\n");
+
+    Extrinsic::Core::IO::MmapIOBackend backend;
+    const auto mappedPly = Geometry::PointCloudIO::LoadPLY(ply.Path, backend);
+    const auto filePly = Geometry::PointCloudIO::LoadPLY(ply.Path);
+    ASSERT_TRUE(mappedPly.has_value());
+    ASSERT_TRUE(filePly.has_value());
+    ASSERT_EQ(mappedPly->Cloud.VerticesSize(), filePly->Cloud.VerticesSize());
+    EXPECT_TRUE(mappedPly->Cloud.HasNormals());
+    for (std::size_t i = 0; i < filePly->Cloud.VerticesSize(); ++i)
+    {
+        const Geometry::VertexHandle v{static_cast<std::uint32_t>(i)};
+        EXPECT_EQ(mappedPly->Cloud.Position(v), filePly->Cloud.Position(v));
+        EXPECT_EQ(mappedPly->Cloud.Normal(v), filePly->Cloud.Normal(v));
+    }
+
+    const auto mappedPcd = Geometry::PointCloudIO::LoadPCD(pcd.Path, backend);
+    ASSERT_TRUE(mappedPcd.has_value());
+    ASSERT_EQ(mappedPcd->Cloud.VerticesSize(), 2u);
+    EXPECT_EQ(mappedPcd->Cloud.Position(Geometry::VertexHandle{1}), glm::vec3(3.0f, 4.0f, 5.0f));
+
+    // Mapping backends report their read errors unchanged.
+    const auto missing = Geometry::PointCloudIO::LoadPLY(ply.Path + ".missing", backend);
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error(), Extrinsic::Core::ErrorCode::FileNotFound);
+}
+
 TEST(GeometryIO_PointCloudIO, LoadsBinaryBigEndianPLYPointCloud)
 {
     const std::array<BinaryPlyPointCloudVertex, 3> vertices{{
@@ -104,3 +104,25 @@ TEST(MeshConversion, ConvertedHalfedgeMeshOutlivesSourceViaMoveOwnershipTransfer
     EXPECT_EQ(converted.Position(Geometry::VertexHandle{0u}), (glm::vec3{0.0f, 0.0f, 0.0f}));
     EXPECT_EQ(converted.Position(Geometry::VertexHandle{1u}), (glm::vec3{1.0f, 0.0f, 0.0f}));
 }
+
+TEST(MeshConversion, BowtieSoupFallsBackToIncrementalConstruction)
+{
+    // Two triangles touching at vertex 0 pass validation but are not a single
+    // fan, so the bulk builder refuses them and AddFace takes over.
+    IndexedMesh soup;
+    AddVertex(soup, {0.0f, 0.0f, 0.0f});
+    AddVertex(soup, {1.0f, 0.0f, 0.0f});
+    AddVertex(soup, {0.0f, 1.0f, 0.0f});
+    AddVertex(soup, {-1.0f, 0.0f, 0.0f});
+    AddVertex(soup, {0.0f, -1.0f, 0.0f});
+    AddTriangle(soup, 0u, 1u, 2u);
+    AddTriangle(soup, 0u, 3u, 4u);
+
+    const auto converted = Geometry::Mesh::Conversion::ToHalfedgeMesh(soup);
+
+    ASSERT_TRUE(converted.Succeeded());
+    EXPECT_EQ(converted.Mesh.VertexCount(), 5u);
+    EXPECT_EQ(converted.Mesh.FaceCount(), 2u);
+    EXPECT_EQ(converted.Mesh.EdgeCount(), 6u);
+    EXPECT_FALSE(converted.Mesh.IsManifold(Geometry::VertexHandle{0u}));
+}
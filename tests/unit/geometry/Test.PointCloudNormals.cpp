@@ -3,7 +3,9 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <random>
 #include <span>
 #include <vector>
 
@@ -16,6 +18,8 @@ import Geometry.PointCloud;
 import Geometry.PointCloud.Normals;
 import Geometry.Properties;
 
+#include "SchedulerScope.hpp"
+
 namespace
 {
     namespace PointNormals = Geometry::PointCloud::Normals;
@@ -55,6 +59,24 @@ namespace
         return points;
     }
 
+    // Jittered points on a sphere, large enough to span several orientation
+    // cells.
+    [[nodiscard]] std::vector<glm::vec3> MakeRandomSpherePoints(const std::size_t count, const glm::vec3 center,
+                                                                const std::uint32_t seed)
+    {
+        std::mt19937 rng{seed};
+        std::normal_distribution<float> dist{0.0f, 1.0f};
+        std::vector<glm::vec3> points(count);
+        for (glm::vec3& p : points)
+        {
+            glm::vec3 d{dist(rng), dist(rng), dist(rng)};
+            while (glm::dot(d, d) < 1.0e-6f)
+                d = glm::vec3{dist(rng), dist(rng), dist(rng)};
+            p = center + glm::normalize(d);
+        }
+        return points;
+    }
+
     [[nodiscard]] Geometry::PointCloud::Cloud MakeCloud(std::span<const glm::vec3> points)
     {
         Geometry::PointCloud::Cloud cloud;
@@ -271,3 +293,54 @@ TEST(PointCloudNormals, WrongOutputPropertyTypeFailsClosed)
     EXPECT_FALSE(result.Normals.IsValid());
     EXPECT_TRUE(cloud.PointProperties().Get<float>("v:normal").IsValid());
 }
+
+TEST(PointCloudNormals, ParallelEstimateMatchesSerialAndOrientsEachComponent)
+{
+    auto points = MakeRandomSpherePoints(12'000u, glm::vec3{0.0f}, 5u);
+    const auto second = MakeRandomSpherePoints(8'000u, glm::vec3{6.0f, 0.0f, 0.0f}, 7u);
+    points.insert(points.end(), second.begin(), second.end());
+
+    PointNormals::Params params;
+    params.KNeighbors = 12;
+    const auto serial = PointNormals::Estimate(points, params);
+    ASSERT_TRUE(serial.has_value());
+    EXPECT_EQ(serial->Diagnostics.OrientationComponentCount, 2u);
+    EXPECT_GT(serial->Diagnostics.OrientationCellCount, 1u);
+    EXPECT_GT(serial->Diagnostics.OrientationMergeRoundCount, 0u);
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        const glm::vec3 center = i < 12'000u ? glm::vec3{0.0f} : glm::vec3{6.0f, 0.0f, 0.0f};
+        ASSERT_GT(glm::dot(points[i] - center, serial->Normals[i]), 0.0f) << "point " << i;
+    }
+
+    TestSupport::SchedulerScope scheduler{4u};
+    const auto parallel = PointNormals::Estimate(points, params);
+    ASSERT_TRUE(parallel.has_value());
+    EXPECT_EQ(parallel->Normals, serial->Normals);
+    EXPECT_EQ(parallel->Diagnostics.FlippedOrientationCount, serial->Diagnostics.FlippedOrientationCount);
+    EXPECT_EQ(parallel->Diagnostics.KNNDistanceEvaluationCount, serial->Diagnostics.KNNDistanceEvaluationCount);
+    EXPECT_EQ(parallel->Diagnostics.OrientationMergeRoundCount, serial->Diagnostics.OrientationMergeRoundCount);
+
+    Geometry::KDTree tree;
+    ASSERT_TRUE(tree.BuildFromPoints(points).has_value());
+    const auto supplied = PointNormals::Estimate(points, tree, params);
+    ASSERT_TRUE(supplied.has_value());
+    EXPECT_EQ(supplied->Diagnostics.OrientationComponentCount, 2u);
+    EXPECT_EQ(supplied->Diagnostics.ValidNormalPointCount, serial->Diagnostics.ValidNormalPointCount);
+}
+
+TEST(PointCloudNormals, OrientationSeedFollowsFallbackNormal)
+{
+    const auto points = MakeFlatGrid(120, 0.01f);
+
+    PointNormals::Params params;
+    params.FallbackNormal = glm::vec3{0.0f, 0.0f, -1.0f};
+    const auto result = PointNormals::Estimate(points, params);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->Diagnostics.OrientationComponentCount, 1u);
+    for (const glm::vec3 normal : result->Normals)
+    {
+        EXPECT_LT(normal.z, -0.99f);
+    }
+}
@@ -1,11 +1,53 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cmath>
+#include <cstddef>
 #include <limits>
+#include <thread>
 #include <vector>
 
 import Geometry.Sparse;
 
+#include "SchedulerScope.hpp"
+
+namespace
+{
+    // Triangulated m x m grid graph Laplacian plus shift * I: the stiffness
+    // pattern of a regular mesh with a lumped mass term.
+    Geometry::Sparse::SparseMatrix MakeGridOperator(std::size_t m, double shift)
+    {
+        Geometry::Sparse::SparseBuilder builder(m * m, m * m);
+        constexpr std::array<std::array<int, 2>, 6> kNeighbours{{{1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {-1, -1}}};
+        for (std::size_t i = 0; i < m; ++i)
+        {
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                const std::size_t row = i * m + j;
+                builder.Add(row, row, shift);
+                for (const auto& [di, dj] : kNeighbours)
+                {
+                    const auto ni = static_cast<std::ptrdiff_t>(i) + di;
+                    const auto nj = static_cast<std::ptrdiff_t>(j) + dj;
+                    if (ni < 0 || nj < 0 || ni >= static_cast<std::ptrdiff_t>(m) || nj >= static_cast<std::ptrdiff_t>(m))
+                        continue;
+                    builder.Add(row, static_cast<std::size_t>(ni) * m + static_cast<std::size_t>(nj), -1.0);
+                    builder.Add(row, row, 1.0);
+                }
+            }
+        }
+        return builder.Build().Matrix;
+    }
+
+    std::vector<double> MakeRhs(std::size_t n)
+    {
+        std::vector<double> b(n);
+        for (std::size_t i = 0; i < n; ++i)
+            b[i] = std::sin(0.37 * static_cast<double>(i)) + 0.25;
+        return b;
+    }
+}
+
 TEST(Sparse, BuilderSortsMergesDropsAndMultiplies)
 {
     Geometry::Sparse::SparseBuilder builder(3, 3);
@@ -219,3 +261,309 @@ TEST(Sparse, ShiftedFixedConjugateGradientRejectsMalformedConstraints)
         }
     }
 }
+
+TEST(Sparse, AMGPreconditionedCGNeedsFarFewerIterations)
+{
+    const Geometry::Sparse::SparseMatrix A = MakeGridOperator(64, 1.0e-3);
+    const std::vector<double> b = MakeRhs(A.Rows);
+
+    Geometry::Sparse::CGParams params;
+    params.MaxIterations = 2000;
+    std::vector<double> xJacobi(A.Rows, 0.0);
+    const Geometry::Sparse::CGResult jacobi = Geometry::Sparse::SolveCG(A, b, xJacobi, params);
+
+    params.Preconditioner = Geometry::Sparse::SparsePreconditioner::AMG;
+    std::vector<double> xAmg(A.Rows, 0.0);
+    const Geometry::Sparse::CGResult amg = Geometry::Sparse::SolveCG(A, b, xAmg, params);
+
+    ASSERT_TRUE(jacobi.Converged);
+    ASSERT_TRUE(amg.Converged);
+    EXPECT_EQ(amg.Preconditioner, Geometry::Sparse::SparsePreconditioner::AMG);
+    EXPECT_LT(amg.Iterations * 5u, jacobi.Iterations);
+    for (std::size_t i = 0; i < A.Rows; ++i)
+        EXPECT_NEAR(xAmg[i], xJacobi[i], 1.0e-4) << "i=" << i;
+}
+
+TEST(Sparse, AMGHierarchyIsReusableAcrossSolves)
+{
+    const Geometry::Sparse::SparseMatrix A = MakeGridOperator(48, 1.0e-2);
+
+    Geometry::Sparse::AMGHierarchy hierarchy;
+    const Geometry::Sparse::AMGDiagnostics diagnostics = hierarchy.build(A);
+    ASSERT_TRUE(diagnostics.Succeeded());
+    EXPECT_GT(diagnostics.LevelCount, 1u);
+    EXPECT_LE(diagnostics.CoarsestRows, Geometry::Sparse::AMGParams{}.CoarsestRows);
+    EXPECT_GT(diagnostics.OperatorComplexity, 1.0);
+    EXPECT_LT(diagnostics.OperatorComplexity, 2.0);
+    EXPECT_EQ(hierarchy.rows(), A.Rows);
+
+    Geometry::Sparse::CGParams params;
+    params.Preconditioner = Geometry::Sparse::SparsePreconditioner::AMG;
+    params.Hierarchy = &hierarchy;
+    for (const double scale : {1.0, -3.0})
+    {
+        std::vector<double> b = MakeRhs(A.Rows);
+        for (double& value : b)
+            value *= scale;
+        std::vector<double> x(A.Rows, 0.0);
+        const Geometry::Sparse::CGResult result = Geometry::Sparse::SolveCG(A, b, x, params);
+        EXPECT_TRUE(result.Converged) << "scale=" << scale;
+        EXPECT_LT(result.Iterations, 40u) << "scale=" << scale;
+    }
+
+    // A hierarchy for a different system size is rejected up front.
+    const Geometry::Sparse::SparseMatrix smaller = MakeGridOperator(8, 1.0e-2);
+    std::vector<double> b = MakeRhs(smaller.Rows);
+    std::vector<double> x(smaller.Rows, 0.0);
+    EXPECT_EQ(Geometry::Sparse::SolveCG(smaller, b, x, params).Reason,
+              Geometry::Sparse::CGConvergenceReason::InvalidInput);
+}
+
+TEST(Sparse, AMGHierarchyIsSharedByConcurrentSolves)
+{
+    const Geometry::Sparse::SparseMatrix A = MakeGridOperator(32, 1.0e-2);
+    Geometry::Sparse::AMGHierarchy hierarchy;
+    ASSERT_TRUE(hierarchy.build(A).Succeeded());
+
+    Geometry::Sparse::CGParams params;
+    params.Preconditioner = Geometry::Sparse::SparsePreconditioner::AMG;
+    params.Hierarchy = &hierarchy;
+
+    std::array<std::vector<double>, 2> b{MakeRhs(A.Rows), MakeRhs(A.Rows)};
+    for (double& value : b[1])
+        value *= -2.0;
+
+    std::array<std::vector<double>, 2> serial;
+    for (std::size_t axis = 0; axis < 2; ++axis)
+    {
+        serial[axis].assign(A.Rows, 0.0);
+        ASSERT_TRUE(Geometry::Sparse::SolveCG(A, b[axis], serial[axis], params).Converged);
+    }
+
+    // The hierarchy is read-only during apply(), so solves on separate
+    // threads must reproduce the serial results exactly.
+    std::array<std::vector<double>, 2> concurrent;
+    std::array<bool, 2> converged{false, false};
+    {
+        std::array<std::thread, 2> workers;
+        for (std::size_t axis = 0; axis < 2; ++axis)
+        {
+            concurrent[axis].assign(A.Rows, 0.0);
+            workers[axis] = std::thread([&, axis]
+            {
+                converged[axis] = Geometry::Sparse::SolveCG(A, b[axis], concurrent[axis], params).Converged;
+            });
+        }
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    for (std::size_t axis = 0; axis < 2; ++axis)
+    {
+        EXPECT_TRUE(converged[axis]) << "axis=" << axis;
+        for (std::size_t i = 0; i < A.Rows; ++i)
+            EXPECT_EQ(concurrent[axis][i], serial[axis][i]) << "axis=" << axis << " i=" << i;
+    }
+}
+
+TEST(Sparse, AMGRejectsUnsupportedInput)
+{
+    Geometry::Sparse::SparseBuilder builder(2, 2);
+    builder.Add(0, 0, -1.0);
+    builder.Add(1, 1, 1.0);
+    const Geometry::Sparse::SparseMatrix indefinite = builder.Build().Matrix;
+
+    Geometry::Sparse::AMGHierarchy hierarchy;
+    EXPECT_EQ(hierarchy.build(indefinite).Status, Geometry::Sparse::SparseFactorizationStatus::NonSPD);
+    EXPECT_EQ(hierarchy.rows(), 0u);
+
+    const std::array<double, 2> b{1.0, 1.0};
+    std::array<double, 2> x{0.0, 0.0};
+    Geometry::Sparse::CGParams params;
+    params.Preconditioner = Geometry::Sparse::SparsePreconditioner::AMG;
+    EXPECT_EQ(Geometry::Sparse::SolveCG(indefinite, b, x, params).Reason,
+              Geometry::Sparse::CGConvergenceReason::InvalidInput);
+
+    // Incomplete LU is not symmetric, so CG does not accept it.
+    params.Preconditioner = Geometry::Sparse::SparsePreconditioner::IncompleteLUT;
+    const Geometry::Sparse::SparseMatrix spd = MakeGridOperator(4, 1.0);
+    const std::vector<double> rhs = MakeRhs(spd.Rows);
+    std::vector<double> solution(spd.Rows, 0.0);
+    EXPECT_EQ(Geometry::Sparse::SolveCG(spd, rhs, solution, params).Reason,
+              Geometry::Sparse::CGConvergenceReason::InvalidInput);
+}
+
+TEST(Sparse, ParallelMultiplyMatchesSerial)
+{
+    const Geometry::Sparse::SparseMatrix A = MakeGridOperator(96, 0.5);
+    const std::vector<double> x = MakeRhs(A.Rows);
+
+    std::vector<double> serial(A.Rows);
+    A.Multiply(x, serial);
+
+    std::vector<double> parallel(A.Rows);
+    {
+        TestSupport::SchedulerScope scheduler{4u};
+        A.Multiply(x, parallel);
+    }
+    EXPECT_EQ(serial, parallel);
+}
+
+TEST(Sparse, CompactMatrixMultipliesLikeSparseMatrix)
+{
+    // Non-square with an empty row, so MultiplyTranspose is exercised on a
+    // different shape.
+    Geometry::Sparse::SparseBuilder builder(4, 3);
+    builder.Add(0, 0, 2.0);
+    builder.Add(0, 2, -1.0);
+    builder.Add(2, 1, 3.0);
+    builder.Add(3, 0, 0.5);
+    builder.Add(3, 2, 4.0);
+    const Geometry::Sparse::SparseMatrix A = builder.Build().Matrix;
+
+    const auto compact = Geometry::Sparse::MakeCompact<double>(A);
+    ASSERT_TRUE(compact.Valid);
+    EXPECT_EQ(compact.Matrix.Rows(), A.Rows);
+    EXPECT_EQ(compact.Matrix.Cols(), A.Cols);
+    EXPECT_EQ(compact.Matrix.NonZeros(), A.NonZeros());
+    EXPECT_LT(compact.Matrix.StorageBytes(),
+              A.RowOffsets.size() * sizeof(std::size_t) + A.NonZeros() * (sizeof(std::size_t) + sizeof(double)));
+
+    const std::vector<double> x{1.0, -2.0, 0.5};
+    std::vector<double> expected(4);
+    std::vector<double> y(4);
+    A.Multiply(x, expected);
+    compact.Matrix.Multiply(x, y);
+    EXPECT_EQ(y, expected);
+
+    const std::vector<double> r{1.0, 2.0, -1.0, 3.0};
+    std::vector<double> expectedT(3);
+    A.MultiplyTranspose(r, expectedT);
+    std::vector<double> scatter(3);
+    compact.Matrix.MultiplyTranspose(r, scatter);
+    EXPECT_EQ(scatter, expectedT);
+
+    Geometry::Sparse::CompactSparseMatrix<double> withTranspose = compact.Matrix;
+    withTranspose.BuildTranspose();
+    ASSERT_TRUE(withTranspose.HasTranspose());
+    EXPECT_FALSE(compact.Matrix.HasTranspose());
+    std::vector<double> gather(3);
+    withTranspose.MultiplyTranspose(r, gather);
+    EXPECT_EQ(gather, expectedT);
+
+    const auto single = Geometry::Sparse::MakeCompact<float>(A);
+    ASSERT_TRUE(single.Valid);
+    const std::vector<float> xf{1.0f, -2.0f, 0.5f};
+    std::vector<float> yf(4);
+    single.Matrix.Multiply(xf, yf);
+    for (std::size_t i = 0; i < yf.size(); ++i)
+        EXPECT_FLOAT_EQ(yf[i], static_cast<float>(expected[i]));
+}
+
+TEST(Sparse, CompactParallelMultiplyMatchesSerial)
+{
+    const Geometry::Sparse::SparseMatrix A = MakeGridOperator(128, 0.5);
+    auto compact = Geometry::Sparse::MakeCompact<double>(A).Matrix;
+    compact.BuildTranspose();
+    const std::vector<double> x = MakeRhs(A.Rows);
+
+    std::vector<double> serial(A.Rows);
+    std::vector<double> serialT(A.Rows);
+    compact.Multiply(x, serial);
+    compact.MultiplyTranspose(x, serialT);
+
+    std::vector<double> parallel(A.Rows);
+    std::vector<double> parallelT(A.Rows);
+    {
+        TestSupport::SchedulerScope scheduler{4u};
+        compact.Multiply(x, parallel);
+        compact.MultiplyTranspose(x, parallelT);
+    }
+    EXPECT_EQ(serial, parallel);
+    EXPECT_EQ(serialT, parallelT);
+
+    std::vector<double> reference(A.Rows);
+    A.Multiply(x, reference);
+    EXPECT_EQ(parallel, reference);
+}
+
+TEST(Sparse, CompactRejectsInvalidInput)
+{
+    Geometry::Sparse::SparseMatrix broken = MakeGridOperator(4, 1.0);
+    broken.ColIndices.back() = broken.Cols;
+    EXPECT_FALSE(Geometry::Sparse::MakeCompact<double>(broken).Valid);
+
+    Geometry::Sparse::SparseBuilder builder(1, 1);
+    builder.Add(0, 0, 1.0e300);
+    const Geometry::Sparse::SparseMatrix large = builder.Build().Matrix;
+    EXPECT_TRUE(Geometry::Sparse::MakeCompact<double>(large).Valid);
+    const auto narrowed = Geometry::Sparse::MakeCompact<float>(large);
+    EXPECT_FALSE(narrowed.Valid);
+    EXPECT_TRUE(narrowed.Matrix.IsEmpty());
+}
+
+TEST(Sparse, ReverseCuthillMcKeeRestoresScrambledGridBandwidth)
+{
+    constexpr std::size_t m = 40;
+    const Geometry::Sparse::SparseMatrix grid = MakeGridOperator(m, 0.5);
+
+    // Deterministic scramble of the grid numbering.
+    std::vector<std::size_t> scramble(grid.Rows);
+    for (std::size_t i = 0; i < grid.Rows; ++i)
+        scramble[i] = (i * 733u) % grid.Rows;
+    const auto scrambled = Geometry::Sparse::PermuteSymmetric(grid, scramble);
+    ASSERT_TRUE(scrambled.Valid);
+    ASSERT_GT(Geometry::Sparse::ComputeBandwidth(scrambled.Matrix), grid.Rows / 2);
+
+    const std::vector<std::size_t> rcm = Geometry::Sparse::ComputeReverseCuthillMcKee(scrambled.Matrix);
+    ASSERT_EQ(rcm.size(), grid.Rows);
+    const auto reordered = Geometry::Sparse::PermuteSymmetric(scrambled.Matrix, rcm);
+    ASSERT_TRUE(reordered.Valid);
+    EXPECT_LE(Geometry::Sparse::ComputeBandwidth(reordered.Matrix), 2u * m);
+    EXPECT_EQ(rcm, Geometry::Sparse::ComputeReverseCuthillMcKee(scrambled.Matrix));
+
+    // Solving in the reordered numbering and mapping back gives the same
+    // product as the original numbering.
+    const std::vector<double> x = MakeRhs(grid.Rows);
+    std::vector<double> expected(grid.Rows);
+    scrambled.Matrix.Multiply(x, expected);
+
+    std::vector<double> xr(grid.Rows);
+    std::vector<double> yr(grid.Rows);
+    std::vector<double> y(grid.Rows);
+    Geometry::Sparse::PermuteVector(rcm, x, xr);
+    reordered.Matrix.Multiply(xr, yr);
+    Geometry::Sparse::InversePermuteVector(rcm, yr, y);
+    for (std::size_t i = 0; i < y.size(); ++i)
+        EXPECT_NEAR(y[i], expected[i], 1e-12);
+}
+
+TEST(Sparse, ReorderingHandlesComponentsAndRejectsBadPermutations)
+{
+    // Two disconnected paths plus an isolated row.
+    Geometry::Sparse::SparseBuilder builder(5, 5);
+    for (std::size_t i = 0; i < 5; ++i)
+        builder.Add(i, i, 2.0);
+    builder.Add(0, 3, -1.0);
+    builder.Add(3, 0, -1.0);
+    builder.Add(1, 4, -1.0);
+    builder.Add(4, 1, -1.0);
+    const Geometry::Sparse::SparseMatrix A = builder.Build().Matrix;
+
+    const std::vector<std::size_t> rcm = Geometry::Sparse::ComputeReverseCuthillMcKee(A);
+    ASSERT_EQ(rcm.size(), 5u);
+    const auto reordered = Geometry::Sparse::PermuteSymmetric(A, rcm);
+    ASSERT_TRUE(reordered.Valid);
+    EXPECT_EQ(Geometry::Sparse::ComputeBandwidth(reordered.Matrix), 1u);
+
+    const std::vector<std::size_t> repeated{0u, 1u, 1u, 3u, 4u};
+    EXPECT_FALSE(Geometry::Sparse::PermuteSymmetric(A, repeated).Valid);
+    const std::vector<std::size_t> outOfRange{0u, 1u, 2u, 3u, 5u};
+    EXPECT_FALSE(Geometry::Sparse::PermuteSymmetric(A, outOfRange).Valid);
+    const std::vector<std::size_t> shortPermutation{0u, 1u};
+    EXPECT_FALSE(Geometry::Sparse::PermuteSymmetric(A, shortPermutation).Valid);
+
+    Geometry::Sparse::SparseBuilder rectangular(2, 3);
+    rectangular.Add(0, 2, 1.0);
+    EXPECT_TRUE(Geometry::Sparse::ComputeReverseCuthillMcKee(rectangular.Build().Matrix).empty());
+}
@@ -1,11 +1,12 @@
 // tests/Test_Geodesic.cpp — Heat method geodesic distance tests.
 // Covers: convergence, source vertex distance, symmetry, degenerate input,
-// and multi-source support.
+// multi-source support, and the prefactored GeodesicSolver.
 
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -141,3 +142,132 @@ TEST(Geodesic, CustomTimeStep)
     ASSERT_TRUE(result.has_value());
     EXPECT_TRUE(result->Converged);
 }
+
+TEST(GeodesicSolver, MatchesComputeDistance)
+{
+    auto mesh = MakeSphereMesh();
+    std::vector<std::size_t> sources = {0, 7};
+
+    auto reference = Geometry::Geodesic::ComputeDistance(mesh, sources);
+    ASSERT_TRUE(reference.has_value());
+    std::vector<double> expected(mesh.VerticesSize());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        expected[i] = reference->DistanceProperty[Geometry::VertexHandle{static_cast<Geometry::PropertyIndex>(i)}];
+
+    Geometry::Geodesic::GeodesicSolver solver;
+    auto result = solver.ComputeDistance(mesh, sources);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->Converged);
+    EXPECT_EQ(result->HeatSolveIterations, 0u);
+
+    const double scale = *std::max_element(expected.begin(), expected.end());
+    ASSERT_GT(scale, 0.0);
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        Geometry::VertexHandle v{static_cast<Geometry::PropertyIndex>(i)};
+        EXPECT_NEAR(result->DistanceProperty[v], expected[i], 1e-4 * scale);
+    }
+    EXPECT_TRUE(result->IsSourceProperty[Geometry::VertexHandle{7}]);
+    EXPECT_FALSE(result->IsSourceProperty[Geometry::VertexHandle{1}]);
+}
+
+TEST(GeodesicSolver, ReusesFactorizationAcrossQueries)
+{
+    auto mesh = MakeSphereMesh();
+    Geometry::Geodesic::GeodesicSolver solver;
+    ASSERT_TRUE(solver.Prepare(mesh));
+    EXPECT_TRUE(solver.IsPreparedFor(mesh));
+    EXPECT_GT(solver.TimeStep(), 0.0);
+
+    for (std::size_t source = 0; source < 4; ++source)
+    {
+        std::vector<std::size_t> sources = {source};
+        auto result = solver.ComputeDistance(mesh, sources);
+        ASSERT_TRUE(result.has_value());
+        EXPECT_NEAR(result->DistanceProperty[Geometry::VertexHandle{static_cast<Geometry::PropertyIndex>(source)}],
+                    0.0, 1e-6);
+    }
+
+    std::vector<std::size_t> batchSources = {5, 9};
+    ASSERT_TRUE(solver.ComputeDistances(mesh, batchSources).has_value());
+
+    // Publishing v:geodesic_distance does not touch the keyed properties.
+    EXPECT_TRUE(solver.IsPreparedFor(mesh));
+    EXPECT_EQ(solver.FactorizationCount(), 1u);
+
+    auto other = MakeSphereMesh();
+    EXPECT_FALSE(solver.IsPreparedFor(other));
+}
+
+TEST(GeodesicSolver, RefactorsAfterPositionEdit)
+{
+    auto mesh = MakeSphereMesh();
+    std::vector<std::size_t> sources = {3};
+
+    Geometry::Geodesic::GeodesicSolver solver;
+    auto before = solver.ComputeDistances(mesh, sources);
+    ASSERT_TRUE(before.has_value());
+    EXPECT_EQ(solver.FactorizationCount(), 1u);
+
+    for (std::size_t i = 0; i < mesh.VerticesSize(); ++i)
+        mesh.Position(Geometry::VertexHandle{static_cast<Geometry::PropertyIndex>(i)}) *= 2.0f;
+    EXPECT_FALSE(solver.IsPreparedFor(mesh));
+
+    auto after = solver.ComputeDistances(mesh, sources);
+    ASSERT_TRUE(after.has_value());
+    EXPECT_EQ(solver.FactorizationCount(), 2u);
+    const double h = Geometry::MeshUtils::MeanEdgeLength(mesh);
+    EXPECT_NEAR(solver.TimeStep(), h * h, 1e-9);
+
+    // With the default t = h^2 the heat method is scale-covariant.
+    for (std::size_t i = 0; i < before->Distances.size(); ++i)
+        EXPECT_NEAR(after->Distances[i], 2.0 * before->Distances[i], 1e-5);
+}
+
+TEST(GeodesicSolver, BatchColumnsMatchSingleQueries)
+{
+    auto mesh = MakeSphereMesh();
+    const std::size_t invalid = mesh.VerticesSize() + 10;
+    std::vector<std::size_t> sources = {0, 11, invalid, 25};
+
+    Geometry::Geodesic::GeodesicSolver solver;
+    auto batch = solver.ComputeDistances(mesh, sources);
+    ASSERT_TRUE(batch.has_value());
+    EXPECT_EQ(batch->VertexCount, mesh.VerticesSize());
+    EXPECT_EQ(batch->SourceCount, sources.size());
+    ASSERT_EQ(batch->Distances.size(), batch->VertexCount * batch->SourceCount);
+
+    for (std::size_t s = 0; s < sources.size(); ++s)
+    {
+        const std::span<const double> column{batch->Distances.data() + s * batch->VertexCount, batch->VertexCount};
+        if (sources[s] == invalid)
+        {
+            EXPECT_TRUE(std::all_of(column.begin(), column.end(), [](double d) { return d == 0.0; }));
+            continue;
+        }
+
+        std::vector<std::size_t> single = {sources[s]};
+        auto result = solver.ComputeDistance(mesh, single);
+        ASSERT_TRUE(result.has_value());
+        EXPECT_DOUBLE_EQ(column[sources[s]], 0.0);
+        for (std::size_t i = 0; i < column.size(); ++i)
+        {
+            Geometry::VertexHandle v{static_cast<Geometry::PropertyIndex>(i)};
+            EXPECT_DOUBLE_EQ(column[i], result->DistanceProperty[v]);
+        }
+    }
+    EXPECT_EQ(solver.FactorizationCount(), 1u);
+}
+
+TEST(GeodesicSolver, RejectsEmptyInput)
+{
+    Geometry::HalfedgeMesh::Mesh empty;
+    Geometry::Geodesic::GeodesicSolver solver;
+    EXPECT_FALSE(solver.Prepare(empty));
+    EXPECT_FALSE(solver.IsPreparedFor(empty));
+
+    auto mesh = MakeTetrahedron();
+    std::vector<std::size_t> none;
+    EXPECT_FALSE(solver.ComputeDistance(mesh, none).has_value());
+    EXPECT_FALSE(solver.ComputeDistances(mesh, none).has_value());
+}
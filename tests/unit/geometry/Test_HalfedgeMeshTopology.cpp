@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <cmath>
+#include <cstdint>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -372,3 +373,94 @@ TEST(HalfedgeMesh_Topology, MakeTwoTriangles_SameAsTwoTriangleSquare)
     EXPECT_EQ(a.FaceCount(), b.FaceCount());
     EXPECT_EQ(a.EdgeCount(), b.EdgeCount());
 }
+
+// =============================================================================
+// Bulk Construction — BuildFromPolygons
+// =============================================================================
+
+TEST(HalfedgeMesh_Topology, BuildFromPolygons_MatchesAddFaceIndexing)
+{
+    // 3x3 quad grid with one quad split into two triangles.
+    std::vector<glm::vec3> positions;
+    for (int y = 0; y < 4; ++y)
+        for (int x = 0; x < 4; ++x)
+            positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+
+    std::vector<std::size_t> offsets{0};
+    std::vector<std::uint32_t> indices;
+    for (std::uint32_t y = 0; y < 3; ++y)
+    {
+        for (std::uint32_t x = 0; x < 3; ++x)
+        {
+            const std::uint32_t v0 = y * 4 + x;
+            if (x == 1 && y == 1)
+            {
+                indices.insert(indices.end(), {v0, v0 + 1, v0 + 5});
+                offsets.push_back(indices.size());
+                indices.insert(indices.end(), {v0, v0 + 5, v0 + 4});
+            }
+            else
+            {
+                indices.insert(indices.end(), {v0, v0 + 1, v0 + 5, v0 + 4});
+            }
+            offsets.push_back(indices.size());
+        }
+    }
+
+    Geometry::HalfedgeMesh::Mesh reference;
+    for (const glm::vec3& p : positions)
+        (void)reference.AddVertex(p);
+    for (std::size_t f = 0; f + 1 < offsets.size(); ++f)
+    {
+        std::vector<Geometry::VertexHandle> face;
+        for (std::size_t c = offsets[f]; c < offsets[f + 1]; ++c)
+            face.push_back(Geometry::VertexHandle{indices[c]});
+        ASSERT_TRUE(reference.AddFace(face).has_value());
+    }
+
+    Geometry::HalfedgeMesh::Mesh bulk;
+    ASSERT_TRUE(bulk.BuildFromPolygons(positions, offsets, indices));
+
+    ASSERT_EQ(bulk.VertexCount(), reference.VertexCount());
+    ASSERT_EQ(bulk.EdgeCount(), reference.EdgeCount());
+    ASSERT_EQ(bulk.FaceCount(), reference.FaceCount());
+    for (std::uint32_t f = 0; f < bulk.FacesSize(); ++f)
+        EXPECT_EQ(bulk.Halfedge(Geometry::FaceHandle{f}), reference.Halfedge(Geometry::FaceHandle{f}));
+    for (std::uint32_t h = 0; h < bulk.HalfedgesSize(); ++h)
+    {
+        const Geometry::HalfedgeHandle he{h};
+        EXPECT_EQ(bulk.ToVertex(he), reference.ToVertex(he));
+        EXPECT_EQ(bulk.Face(he), reference.Face(he));
+        EXPECT_EQ(bulk.NextHalfedge(bulk.PrevHalfedge(he)), he);
+        if (!bulk.IsBoundary(he))
+            EXPECT_EQ(bulk.NextHalfedge(he), reference.NextHalfedge(he));
+        else
+            EXPECT_TRUE(bulk.IsBoundary(bulk.NextHalfedge(he)));
+    }
+    for (std::uint32_t v = 0; v < bulk.VerticesSize(); ++v)
+    {
+        const Geometry::VertexHandle vh{v};
+        EXPECT_EQ(bulk.Position(vh), reference.Position(vh));
+        EXPECT_EQ(bulk.Valence(vh), reference.Valence(vh));
+        EXPECT_EQ(bulk.IsBoundary(vh), reference.IsBoundary(vh));
+    }
+}
+
+TEST(HalfedgeMesh_Topology, BuildFromPolygons_RejectsNonManifoldInputAndStaysEmpty)
+{
+    const std::vector<glm::vec3> positions{
+        {0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}};
+    const std::vector<std::size_t> offsets{0, 3, 6, 9};
+
+    // Three faces on edge (0,1).
+    Geometry::HalfedgeMesh::Mesh mesh;
+    const std::vector<std::uint32_t> fin{0, 1, 2, 1, 0, 3, 0, 1, 4};
+    EXPECT_FALSE(mesh.BuildFromPolygons(positions, offsets, fin));
+    EXPECT_TRUE(mesh.IsEmpty());
+
+    // Two faces running the same way along edge (0,1).
+    const std::vector<std::size_t> pairOffsets{0, 3, 6};
+    const std::vector<std::uint32_t> flipped{0, 1, 2, 0, 1, 3};
+    EXPECT_FALSE(mesh.BuildFromPolygons(positions, pairOffsets, flipped));
+    EXPECT_TRUE(mesh.IsEmpty());
+}
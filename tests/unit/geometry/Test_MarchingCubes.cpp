@@ -1,11 +1,21 @@
 // tests/Test_MarchingCubes.cpp — Isosurface extraction tests.
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
+#include <map>
 #include <optional>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
 #include <glm/glm.hpp>
 
 import Geometry;
 
+#include "SchedulerScope.hpp"
+
 using namespace Geometry::MarchingCubes;
 using namespace Geometry::Grid;
 
@@ -183,3 +193,177 @@ TEST(MarchingCubes, NonZeroIsovalue)
     ASSERT_TRUE(result.has_value());
     EXPECT_GT(result->TriangleCount, 0u);
 }
+
+// ============================================================================
+// Parallel and sub-box extraction
+// ============================================================================
+
+TEST(MarchingCubes, ExtractionIsIdenticalAcrossThreadCounts)
+{
+    const auto grid = MakeSphereGrid(40, 2.0f, glm::vec3(0.3f, -0.2f, 0.1f));
+    const auto serial = Extract(grid);
+    ASSERT_TRUE(serial.has_value());
+
+    for (const unsigned threads : {2u, 4u})
+    {
+        TestSupport::SchedulerScope scheduler{threads};
+        const auto parallel = Extract(grid);
+        ASSERT_TRUE(parallel.has_value());
+        EXPECT_EQ(parallel->Vertices, serial->Vertices);
+        EXPECT_EQ(parallel->Normals, serial->Normals);
+        EXPECT_EQ(parallel->Triangles, serial->Triangles);
+    }
+}
+
+TEST(MarchingCubes, EveryVertexIsReferencedByATriangle)
+{
+    const auto grid = MakeSphereGrid(24, 2.0f);
+    const auto result = Extract(grid);
+    ASSERT_TRUE(result.has_value());
+
+    std::vector<bool> used(result->VertexCount, false);
+    for (const auto& tri : result->Triangles)
+        for (const std::size_t v : tri)
+            used[v] = true;
+    EXPECT_TRUE(std::all_of(used.begin(), used.end(), [](const bool u) { return u; }));
+}
+
+TEST(MarchingCubes, SubBoxesTileTheWholeGrid)
+{
+    const auto grid = MakeSphereGrid(30, 2.0f);
+    const auto whole = Extract(grid);
+    ASSERT_TRUE(whole.has_value());
+
+    std::set<std::tuple<float, float, float>> wholeVertices;
+    for (const glm::vec3& p : whole->Vertices)
+        wholeVertices.insert({p.x, p.y, p.z});
+
+    // Boxes share faces, so their vertices are compared as a set.
+    std::size_t triangles = 0;
+    std::set<std::tuple<float, float, float>> boxVertices;
+    constexpr std::size_t kStep = 11;
+    for (std::size_t z = 0; z < 30; z += kStep)
+        for (std::size_t y = 0; y < 30; y += kStep)
+            for (std::size_t x = 0; x < 30; x += kStep)
+            {
+                const CellBox box{x, y, z, std::min<std::size_t>(x + kStep, 30),
+                                  std::min<std::size_t>(y + kStep, 30), std::min<std::size_t>(z + kStep, 30)};
+                const auto part = Extract(grid, box);
+                if (!part.has_value())
+                    continue;
+                triangles += part->TriangleCount;
+                for (const glm::vec3& p : part->Vertices)
+                    boxVertices.insert({p.x, p.y, p.z});
+            }
+
+    EXPECT_EQ(triangles, whole->TriangleCount);
+    EXPECT_EQ(boxVertices, wholeVertices);
+}
+
+TEST(MarchingCubes, InvalidCellBoxReturnsNullopt)
+{
+    const auto grid = MakeSphereGrid(10, 2.0f);
+    EXPECT_FALSE(Extract(grid, CellBox{0, 0, 0, 0, 10, 10}).has_value());
+    EXPECT_FALSE(Extract(grid, CellBox{0, 0, 0, 11, 10, 10}).has_value());
+    EXPECT_FALSE(Extract(grid, CellBox{5, 5, 5, 4, 10, 10}).has_value());
+    EXPECT_TRUE(Extract(grid, CellBox{0, 0, 0, 10, 10, 10}).has_value());
+}
+
+// ============================================================================
+// SparseGrid extraction
+// ============================================================================
+
+// Copy of a dense sphere grid into a sparse grid. Vertices with |f| >= band
+// are left NaN (or their blocks unallocated) when a band is given.
+static SparseGrid MakeSparseSphereGrid(const DenseGrid& dense, float band = std::numeric_limits<float>::infinity())
+{
+    const auto& dims = dense.Dimensions();
+    SparseGrid grid(dims);
+    const auto src = dense.GetProperty<float>("scalar");
+
+    for (std::size_t z = 0; z <= dims.NZ; ++z)
+        for (std::size_t y = 0; y <= dims.NY; ++y)
+            for (std::size_t x = 0; x <= dims.NX; ++x)
+                if (std::abs(src[dims.LinearIndex(x, y, z)]) < band)
+                    (void)grid.TouchVertex(x, y, z);
+
+    auto scalar = grid.AddProperty<float>("scalar", std::numeric_limits<float>::quiet_NaN());
+    for (std::size_t z = 0; z <= dims.NZ; ++z)
+        for (std::size_t y = 0; y <= dims.NY; ++y)
+            for (std::size_t x = 0; x <= dims.NX; ++x)
+            {
+                const float value = src[dims.LinearIndex(x, y, z)];
+                const auto index = grid.VertexIndex(x, y, z);
+                if (index.has_value() && std::abs(value) < band)
+                    scalar[*index] = value;
+            }
+    return grid;
+}
+
+TEST(MarchingCubes, FullyAllocatedSparseGridMatchesDense)
+{
+    // 21 cells per axis: blocks straddle the grid end on every axis.
+    const auto dense = MakeSphereGrid(21, 2.0f);
+    const auto sparse = MakeSparseSphereGrid(dense);
+
+    const auto expected = Extract(dense);
+    const auto actual = Extract(sparse);
+    ASSERT_TRUE(expected.has_value());
+    ASSERT_TRUE(actual.has_value());
+    ASSERT_EQ(actual->VertexCount, expected->VertexCount);
+    EXPECT_EQ(actual->TriangleCount, expected->TriangleCount);
+
+    // Same welded vertices and normals, visited in a different order.
+    std::map<std::array<float, 3>, glm::vec3> expectedNormals;
+    for (std::size_t i = 0; i < expected->Vertices.size(); ++i)
+    {
+        const glm::vec3& p = expected->Vertices[i];
+        expectedNormals[{p.x, p.y, p.z}] = expected->Normals[i];
+    }
+    for (std::size_t i = 0; i < actual->Vertices.size(); ++i)
+    {
+        const glm::vec3& p = actual->Vertices[i];
+        const auto it = expectedNormals.find({p.x, p.y, p.z});
+        ASSERT_NE(it, expectedNormals.end());
+        EXPECT_LT(glm::length(it->second - actual->Normals[i]), 1e-5f);
+    }
+}
+
+TEST(MarchingCubes, NarrowBandSparseGridIsWatertight)
+{
+    const auto dense = MakeSphereGrid(37, 2.0f);
+    const float cellSize = dense.Dimensions().Spacing.x;
+    const auto sparse = MakeSparseSphereGrid(dense, 2.0f * cellSize);
+    const auto full = MakeSparseSphereGrid(dense);
+    EXPECT_LT(sparse.AllocatedBlockCount(), full.AllocatedBlockCount());
+
+    const auto result = Extract(sparse);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->TriangleCount, Extract(dense)->TriangleCount);
+
+    // Every edge is shared by exactly two triangles, including edges on
+    // block boundaries.
+    std::map<std::pair<std::size_t, std::size_t>, int> edgeUses;
+    for (const auto& tri : result->Triangles)
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            const std::size_t a = tri[k];
+            const std::size_t b = tri[(k + 1) % 3];
+            ++edgeUses[{std::min(a, b), std::max(a, b)}];
+        }
+    for (const auto& [edge, uses] : edgeUses)
+        EXPECT_EQ(uses, 2) << edge.first << "-" << edge.second;
+}
+
+TEST(MarchingCubes, SparseGridWithoutScalarReturnsNullopt)
+{
+    GridDimensions dims;
+    dims.NX = dims.NY = dims.NZ = 8;
+    SparseGrid grid(dims);
+    (void)grid.TouchBlock(0, 0, 0);
+    EXPECT_FALSE(Extract(grid).has_value());
+
+    // All-NaN field: no complete cells.
+    (void)grid.AddProperty<float>("scalar", std::numeric_limits<float>::quiet_NaN());
+    EXPECT_FALSE(Extract(grid).has_value());
+}
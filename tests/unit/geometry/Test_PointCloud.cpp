@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <limits>
 #include <numbers>
+#include <random>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -12,6 +13,8 @@
 
 import Geometry;
 
+#include "SchedulerScope.hpp"
+
 // =============================================================================
 // Helper: generate unit sphere point cloud (Fibonacci sampling)
 // =============================================================================
@@ -861,6 +864,145 @@ TEST(PointCloud_KMeans, ClassifyPointToCentroidUsesCentroidVoronoiCells)
     EXPECT_EQ(*right, 1u);
 }
 
+namespace
+{
+    // Gaussian blobs around uniformly drawn centres, interleaved by index.
+    std::vector<glm::vec3> MakeGaussianBlobs(std::size_t count, std::size_t blobs, float sigma, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> centre(-10.0f, 10.0f);
+        std::normal_distribution<float> noise(0.0f, sigma);
+
+        std::vector<glm::vec3> centres(blobs);
+        for (glm::vec3& c : centres)
+            c = glm::vec3(centre(rng), centre(rng), centre(rng));
+
+        std::vector<glm::vec3> points(count);
+        for (std::size_t i = 0; i < count; ++i)
+            points[i] = centres[i % blobs] + glm::vec3(noise(rng), noise(rng), noise(rng));
+        return points;
+    }
+
+    // The original serial Lloyd loop: brute-force assignment (first minimum
+    // wins), float sums in index order, empty clusters moved to the farthest
+    // point (first maximum wins).
+    std::vector<uint32_t> ReferenceLloydLabels(const std::vector<glm::vec3>& points,
+                                               std::vector<glm::vec3> centroids,
+                                               uint32_t iterations)
+    {
+        std::vector<uint32_t> labels(points.size(), 0u);
+        for (uint32_t iter = 0; iter < iterations; ++iter)
+        {
+            std::vector<glm::vec3> sums(centroids.size(), glm::vec3(0.0f));
+            std::vector<uint32_t> counts(centroids.size(), 0u);
+            float maxDistance = -1.0f;
+            std::size_t maxDistanceIndex = 0;
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                float best = std::numeric_limits<float>::infinity();
+                for (uint32_t c = 0; c < centroids.size(); ++c)
+                {
+                    const glm::vec3 d = points[i] - centroids[c];
+                    if (const float d2 = glm::dot(d, d); d2 < best)
+                    {
+                        best = d2;
+                        labels[i] = c;
+                    }
+                }
+                sums[labels[i]] += points[i];
+                ++counts[labels[i]];
+                if (best > maxDistance)
+                {
+                    maxDistance = best;
+                    maxDistanceIndex = i;
+                }
+            }
+            if (iter + 1u == iterations)
+                break;
+            for (std::size_t c = 0; c < centroids.size(); ++c)
+                centroids[c] = counts[c] > 0u ? sums[c] / static_cast<float>(counts[c]) : points[maxDistanceIndex];
+        }
+        return labels;
+    }
+}
+
+TEST(PointCloud_KMeans, CpuBackendMatchesBruteForceLloydAndSkipsScans)
+{
+    const auto points = MakeGaussianBlobs(20'000u, 12u, 0.8f, 7u);
+
+    Geometry::KMeans::KMeansParams params{};
+    params.ClusterCount = 16;
+    params.MaxIterations = 12;
+    params.ConvergenceTolerance = 0.0f;
+    params.Init = Geometry::KMeans::Initialization::KMeansPlusPlus;
+
+    const auto result = Geometry::KMeans::Cluster(points, params);
+    ASSERT_TRUE(result.has_value());
+
+    const auto seeds = Geometry::KMeans::BuildInitialCentroids(points, {}, params, params.ClusterCount);
+    EXPECT_EQ(result->Labels, ReferenceLloydLabels(points, seeds, result->Iterations));
+
+    // After the first full pass the bounds resolve most points with one distance.
+    const uint64_t bruteForce = static_cast<uint64_t>(points.size()) * params.ClusterCount * result->Iterations;
+    EXPECT_LT(result->DistanceEvaluations, bruteForce / 2u);
+}
+
+TEST(PointCloud_KMeans, CpuBackendIsIndependentOfThreadCount)
+{
+    const auto points = MakeGaussianBlobs(50'000u, 9u, 1.5f, 11u);
+
+    Geometry::KMeans::KMeansParams params{};
+    params.ClusterCount = 12;
+    params.MaxIterations = 20;
+
+    const auto serial = Geometry::KMeans::Cluster(points, params);
+    ASSERT_TRUE(serial.has_value());
+
+    TestSupport::SchedulerScope scheduler{4u};
+    const auto parallel = Geometry::KMeans::Cluster(points, params);
+    ASSERT_TRUE(parallel.has_value());
+    EXPECT_EQ(parallel->Labels, serial->Labels);
+    EXPECT_EQ(parallel->Centroids, serial->Centroids);
+    EXPECT_EQ(parallel->SquaredDistances, serial->SquaredDistances);
+    EXPECT_EQ(parallel->Inertia, serial->Inertia);
+    EXPECT_EQ(parallel->Iterations, serial->Iterations);
+
+    Geometry::KMeans::CpuScratch scratch{};
+    const auto withTree = Geometry::KMeans::Cluster(points, {}, params, &scratch);
+    ASSERT_TRUE(withTree.has_value());
+    EXPECT_EQ(withTree->Labels, serial->Labels);
+}
+
+TEST(PointCloud_KMeans, MiniBatchRecoversSeparatedBlobs)
+{
+    const auto points = MakeGaussianBlobs(40'000u, 2u, 0.3f, 3u);
+
+    Geometry::KMeans::KMeansParams params{};
+    params.ClusterCount = 2;
+    params.MaxIterations = 50;
+    params.Update = Geometry::KMeans::UpdateMode::MiniBatch;
+    params.MiniBatchSize = 256;
+
+    const auto result = Geometry::KMeans::Cluster(points, params);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->Labels.size(), points.size());
+    EXPECT_GT(result->Iterations, 0u);
+
+    // Blobs are interleaved by index, so labels must alternate.
+    EXPECT_NE(result->Labels[0], result->Labels[1]);
+    for (std::size_t i = 2; i < points.size(); ++i)
+        ASSERT_EQ(result->Labels[i], result->Labels[i % 2u]) << "point " << i;
+
+    params.Update = Geometry::KMeans::UpdateMode::Exact;
+    const auto exact = Geometry::KMeans::Cluster(points, params);
+    ASSERT_TRUE(exact.has_value());
+    EXPECT_LT(result->Inertia, exact->Inertia * 1.01f);
+
+    params.Update = Geometry::KMeans::UpdateMode::MiniBatch;
+    params.MiniBatchSize = 0;
+    EXPECT_FALSE(Geometry::KMeans::Cluster(points, params).has_value());
+}
+
 TEST(PointCloud_GaussianNoise, ZeroScaleIsIdentity)
 {
     auto cloud = MakeSphereCloud(64, 1.0F, false, false);
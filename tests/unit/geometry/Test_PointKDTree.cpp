@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+import Geometry;
+
+#include "SchedulerScope.hpp"
+
+namespace
+{
+    // Uniform points with a block of exact duplicates so distance ties and
+    // zero-extent leaves are exercised.
+    [[nodiscard]] std::vector<glm::vec3> RandomPoints(const std::size_t count, const std::uint32_t seed)
+    {
+        std::mt19937 rng{seed};
+        std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+        std::vector<glm::vec3> points(count);
+        for (glm::vec3& p : points)
+            p = glm::vec3{dist(rng), dist(rng), dist(rng)};
+        for (std::size_t i = 0; i < count / 20u; ++i)
+            points[i] = points[count - 1u - i];
+        return points;
+    }
+
+    [[nodiscard]] std::vector<std::uint32_t> BruteForceKnn(const std::vector<glm::vec3>& points,
+                                                           const glm::vec3& query,
+                                                           const std::uint32_t k)
+    {
+        std::vector<std::pair<float, std::uint32_t>> ranked;
+        ranked.reserve(points.size());
+        for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(points.size()); ++i)
+        {
+            const glm::vec3 d = points[i] - query;
+            ranked.emplace_back(glm::dot(d, d), i);
+        }
+        std::sort(ranked.begin(), ranked.end());
+
+        std::vector<std::uint32_t> indices;
+        for (std::uint32_t i = 0; i < std::min<std::uint32_t>(k, static_cast<std::uint32_t>(ranked.size())); ++i)
+            indices.push_back(ranked[i].second);
+        return indices;
+    }
+}
+
+TEST(PointKDTree, RejectsDegenerateBuildInputs)
+{
+    Geometry::PointKDTree tree;
+    EXPECT_FALSE(tree.Build(std::span<const glm::vec3>{}).has_value());
+
+    const std::vector<glm::vec3> points{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}};
+    Geometry::PointKDTreeBuildParams params{};
+    params.LeafSize = 0;
+    EXPECT_FALSE(tree.Build(points, params).has_value());
+
+    const std::vector<glm::vec3> nonFinite{{0.0f, 0.0f, 0.0f}, {std::numeric_limits<float>::infinity(), 0.0f, 0.0f}};
+    EXPECT_FALSE(tree.Build(nonFinite).has_value());
+
+    std::vector<Geometry::PointKDTree::ElementIndex> indices;
+    EXPECT_FALSE(tree.QueryKNN(glm::vec3{0.0f}, 1, indices).has_value());
+}
+
+TEST(PointKDTree, StoresCompactNodesAndLeafOrderedPoints)
+{
+    static_assert(sizeof(Geometry::PointKDTree::Node) <= 16u);
+
+    const auto points = RandomPoints(1'000u, 3u);
+    Geometry::PointKDTree tree;
+    const auto build = tree.Build(points, Geometry::PointKDTreeBuildParams{.LeafSize = 4u});
+    ASSERT_TRUE(build.has_value());
+    EXPECT_EQ(build->ElementCount, points.size());
+    EXPECT_EQ(tree.Size(), points.size());
+
+    // Leaves tile the leaf-order permutation exactly once.
+    std::vector<std::uint32_t> covered(points.size(), 0u);
+    for (const auto& node : tree.Nodes())
+    {
+        if (!node.IsLeaf())
+            continue;
+        for (std::uint32_t i = node.Offset; i < node.Offset + node.Count(); ++i)
+            ++covered[i];
+    }
+    EXPECT_TRUE(std::all_of(covered.begin(), covered.end(), [](const std::uint32_t c) { return c == 1u; }));
+
+    auto sorted = tree.ElementIndices();
+    std::sort(sorted.begin(), sorted.end());
+    for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(sorted.size()); ++i)
+        ASSERT_EQ(sorted[i], i);
+}
+
+TEST(PointKDTree, KnnMatchesBruteForceAndKDTreeOrdering)
+{
+    const auto points = RandomPoints(4'000u, 7u);
+    Geometry::PointKDTree tree;
+    ASSERT_TRUE(tree.Build(points).has_value());
+    Geometry::KDTree reference;
+    ASSERT_TRUE(reference.BuildFromPoints(points).has_value());
+
+    std::mt19937 rng{11u};
+    std::uniform_real_distribution<float> dist{-1.5f, 1.5f};
+    for (int i = 0; i < 64; ++i)
+    {
+        const glm::vec3 query = i < 8 ? points[static_cast<std::size_t>(i)] : glm::vec3{dist(rng), dist(rng), dist(rng)};
+        for (const std::uint32_t k : {1u, 8u, 32u})
+        {
+            std::vector<Geometry::PointKDTree::ElementIndex> indices;
+            const auto knn = tree.QueryKNN(query, k, indices);
+            ASSERT_TRUE(knn.has_value());
+            EXPECT_EQ(knn->ReturnedCount, k);
+            EXPECT_EQ(indices, BruteForceKnn(points, query, k)) << "query " << i << " k " << k;
+
+            std::vector<Geometry::KDTree::ElementIndex> referenceIndices;
+            ASSERT_TRUE(reference.QueryKNN(query, k, referenceIndices).has_value());
+            EXPECT_EQ(indices, referenceIndices);
+        }
+    }
+}
+
+TEST(PointKDTree, BatchedKnnPadsRowsAndMatchesSingleQueries)
+{
+    const auto points = RandomPoints(20'000u, 5u);
+    Geometry::PointKDTree tree;
+    ASSERT_TRUE(tree.Build(points).has_value());
+
+    constexpr std::uint32_t k = 16u;
+    const auto queries = RandomPoints(3'000u, 9u);
+    std::vector<Geometry::PointKDTree::ElementIndex> serial;
+    std::vector<float> serialDistances;
+    const auto serialResult = tree.QueryKNNBatch(queries, k, serial, serialDistances);
+    ASSERT_TRUE(serialResult.has_value());
+    ASSERT_EQ(serial.size(), queries.size() * k);
+    EXPECT_EQ(serialResult->ReturnedCount, queries.size() * k);
+
+    for (std::size_t q = 0; q < queries.size(); q += 97u)
+    {
+        std::vector<Geometry::PointKDTree::ElementIndex> single;
+        ASSERT_TRUE(tree.QueryKNN(queries[q], k, single).has_value());
+        EXPECT_TRUE(std::equal(single.begin(), single.end(), serial.begin() + static_cast<std::ptrdiff_t>(q * k)));
+        EXPECT_TRUE(std::is_sorted(serialDistances.begin() + static_cast<std::ptrdiff_t>(q * k),
+                                   serialDistances.begin() + static_cast<std::ptrdiff_t>((q + 1u) * k)));
+    }
+
+    {
+        TestSupport::SchedulerScope scheduler{4u};
+        std::vector<Geometry::PointKDTree::ElementIndex> parallel;
+        const auto parallelResult = tree.QueryKNNBatch(queries, k, parallel);
+        ASSERT_TRUE(parallelResult.has_value());
+        EXPECT_EQ(parallel, serial);
+        EXPECT_EQ(parallelResult->DistanceEvaluations, serialResult->DistanceEvaluations);
+        EXPECT_EQ(parallelResult->MaxDistanceSquared, serialResult->MaxDistanceSquared);
+    }
+
+    // A tree smaller than k pads every row.
+    const std::vector<glm::vec3> few{{0.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}};
+    Geometry::PointKDTree small;
+    ASSERT_TRUE(small.Build(few).has_value());
+    std::vector<Geometry::PointKDTree::ElementIndex> padded;
+    std::vector<float> paddedDistances;
+    const auto smallResult = small.QueryKNNBatch(std::span<const glm::vec3>{few.data(), 1u}, 5u, padded,
+                                                 paddedDistances);
+    ASSERT_TRUE(smallResult.has_value());
+    EXPECT_EQ(smallResult->ReturnedCount, 3u);
+    const std::vector<Geometry::PointKDTree::ElementIndex> expected{
+        0u, 2u, 1u, Geometry::PointKDTree::kInvalidIndex, Geometry::PointKDTree::kInvalidIndex};
+    EXPECT_EQ(padded, expected);
+    EXPECT_EQ(paddedDistances[3], std::numeric_limits<float>::infinity());
+}
+
+TEST(PointKDTree, RadiusQueriesMatchKDTreeSets)
+{
+    const auto points = RandomPoints(10'000u, 13u);
+    Geometry::PointKDTree tree;
+    ASSERT_TRUE(tree.Build(points).has_value());
+    Geometry::KDTree reference;
+    ASSERT_TRUE(reference.BuildFromPoints(points).has_value());
+
+    const auto queries = RandomPoints(1'500u, 17u);
+    constexpr float radius = 0.12f;
+    std::vector<std::size_t> offsets;
+    std::vector<Geometry::PointKDTree::ElementIndex> hits;
+    {
+        TestSupport::SchedulerScope scheduler{3u};
+        const auto batch = tree.QueryRadiusBatch(queries, radius, offsets, hits);
+        ASSERT_TRUE(batch.has_value());
+        EXPECT_EQ(batch->ReturnedCount, hits.size());
+    }
+    ASSERT_EQ(offsets.size(), queries.size() + 1u);
+
+    for (std::size_t q = 0; q < queries.size(); ++q)
+    {
+        std::vector<Geometry::KDTree::ElementIndex> expected;
+        ASSERT_TRUE(reference.QueryRadius(queries[q], radius, expected).has_value());
+        const std::vector<Geometry::PointKDTree::ElementIndex> row(
+            hits.begin() + static_cast<std::ptrdiff_t>(offsets[q]),
+            hits.begin() + static_cast<std::ptrdiff_t>(offsets[q + 1u]));
+        ASSERT_EQ(row, expected) << "query " << q;
+
+        std::vector<Geometry::PointKDTree::ElementIndex> single;
+        ASSERT_TRUE(tree.QueryRadius(queries[q], radius, single).has_value());
+        ASSERT_EQ(single, expected);
+    }
+
+    EXPECT_FALSE(tree.QueryRadiusBatch(queries, -1.0f, offsets, hits).has_value());
+    EXPECT_FALSE(tree.QueryRadius(glm::vec3{0.0f}, std::numeric_limits<float>::quiet_NaN(), hits).has_value());
+}
@@ -1,20 +1,33 @@
 // tests/Test_Simplification.cpp — QEM mesh simplification tests.
 // Covers: target face count, error threshold, boundary preservation,
-// degenerate input handling, and quality guard correctness.
+// degenerate input handling, quality guard correctness, the
+// independent-set collapse schedule, locked vertices, and out-of-core
+// streaming simplification.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <map>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
 #include <vector>
 
 #include <glm/glm.hpp>
 
 import Geometry;
 import Geometry.HalfedgeMesh.Features;
+import Extrinsic.Core.Error;
+import Extrinsic.Core.IOBackend;
 
 #include "Test_MeshBuilders.h"
+#include "SchedulerScope.hpp"
 
 namespace
 {
@@ -809,3 +822,314 @@ TEST(Simplification, DiagnosticsCountersPopulated)
         result->CollapsesRejectedTopology + result->CollapsesRejectedQuality,
         0u);
 }
+
+// --- Independent-set schedule ---
+
+TEST(Simplification, IndependentSetsReachesTargetOnSmoothMesh)
+{
+    auto mesh = MakeDenseMesh();
+
+    Geometry::Simplification::Params params;
+    params.Schedule = Geometry::Simplification::CollapseSchedule::IndependentSets;
+    params.TargetFaces = 40;
+
+    auto result = Geometry::Simplification::Simplify(mesh, params);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_GT(result->CollapseCount, 0u);
+    EXPECT_GT(result->IndependentSetRounds, 0u);
+    EXPECT_LT(result->IndependentSetRounds, result->CollapseCount);
+
+    mesh.GarbageCollection();
+    EXPECT_LE(mesh.FaceCount(), 40u);
+    EXPECT_EQ(result->FinalFaceCount, mesh.FaceCount());
+    std::size_t boundaryEdges = 0;
+    for (std::size_t i = 0; i < mesh.EdgesSize(); ++i)
+    {
+        Geometry::EdgeHandle e{static_cast<Geometry::PropertyIndex>(i)};
+        if (!mesh.IsDeleted(e) && mesh.IsBoundary(e))
+            ++boundaryEdges;
+    }
+    EXPECT_EQ(boundaryEdges, 0u);
+}
+
+// Batched rounds revalidate every pick, so FA_QEM corner pins hold exactly as
+// under the greedy schedule.
+TEST(Simplification, IndependentSetsKeepsFeaturePins)
+{
+    auto mesh = MakeTessellatedCube(4);
+
+    Geometry::Simplification::Params params;
+    params.Schedule = Geometry::Simplification::CollapseSchedule::IndependentSets;
+    params.TargetFaces = 24;
+    params.PreserveBoundary = true;
+
+    auto result = Geometry::Simplification::Simplify(mesh, params);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_GT(result->CollapseCount, 0u);
+    EXPECT_EQ(result->SharpFeatureVerticesPinned, 8u);
+
+    mesh.GarbageCollection();
+    for (const glm::vec3& corner : kCubeCorners)
+        EXPECT_TRUE(HasLiveVertexNear(mesh, corner)) << "corner removed: " << corner.x;
+}
+
+// Evaluation and revalidation run on Core::Parallel; the output must match the
+// serial fallback bit for bit.
+TEST(Simplification, IndependentSetsIsIndependentOfThreadCount)
+{
+    Geometry::Simplification::Params params;
+    params.Schedule = Geometry::Simplification::CollapseSchedule::IndependentSets;
+    params.TargetFaces = 30;
+
+    auto serial = MakeTessellatedCube(6);
+    auto parallel = MakeTessellatedCube(6);
+    const auto rs = Geometry::Simplification::Simplify(serial, params);
+    std::optional<Geometry::Simplification::Result> rp;
+    {
+        TestSupport::SchedulerScope scheduler{4u};
+        rp = Geometry::Simplification::Simplify(parallel, params);
+    }
+    ASSERT_TRUE(rs.has_value());
+    ASSERT_TRUE(rp.has_value());
+
+    EXPECT_EQ(rs->CollapseCount, rp->CollapseCount);
+    EXPECT_EQ(rs->FinalFaceCount, rp->FinalFaceCount);
+    EXPECT_EQ(rs->IndependentSetRounds, rp->IndependentSetRounds);
+    EXPECT_EQ(rs->CollapsesRejectedTopology, rp->CollapsesRejectedTopology);
+    EXPECT_EQ(rs->CollapsesRejectedQuality, rp->CollapsesRejectedQuality);
+    EXPECT_DOUBLE_EQ(rs->MaxCollapseError, rp->MaxCollapseError);
+
+    ASSERT_EQ(serial.VerticesSize(), parallel.VerticesSize());
+    for (std::size_t i = 0; i < serial.VerticesSize(); ++i)
+    {
+        const Geometry::VertexHandle v{static_cast<Geometry::PropertyIndex>(i)};
+        ASSERT_EQ(serial.IsDeleted(v), parallel.IsDeleted(v));
+        if (!serial.IsDeleted(v))
+            EXPECT_EQ(serial.Position(v), parallel.Position(v));
+    }
+}
+
+// The parallel initial evaluation must not change the greedy schedule: the
+// pinned diagnostics of FeatureAwarePreservesCubeCorners hold with workers.
+TEST(Simplification, GreedyDiagnosticsUnchangedWithScheduler)
+{
+    auto mesh = MakeTessellatedCube(4);
+
+    Geometry::Simplification::Params params;
+    params.TargetFaces = 24;
+    params.PreserveBoundary = true;
+
+    std::optional<Geometry::Simplification::Result> result;
+    {
+        TestSupport::SchedulerScope scheduler{4u};
+        result = Geometry::Simplification::Simplify(mesh, params);
+    }
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->CollapseCount, 84u);
+    EXPECT_EQ(result->FinalFaceCount, 24u);
+    EXPECT_EQ(result->CollapsesRejectedTopology, 266u);
+    EXPECT_EQ(result->CollapsesRejectedQuality, 1256u);
+    EXPECT_EQ(result->IndependentSetRounds, 0u);
+}
+
+// Candidate evaluation runs on scheduler workers and must only read the mesh:
+// with every vertex locked no collapse is applied, so the vertex property
+// revision observed before Simplify() must survive both schedules.
+TEST(Simplification, ParallelEvaluationLeavesVertexRevisionUnchanged)
+{
+    for (const auto schedule : {Geometry::Simplification::CollapseSchedule::Greedy,
+                                Geometry::Simplification::CollapseSchedule::IndependentSets})
+    {
+        auto mesh = MakeTessellatedCube(6);
+        auto locked = mesh.VertexProperties().GetOrAdd<std::uint8_t>("v:simplification_locked", 1u);
+        ASSERT_TRUE(locked.IsValid());
+        const auto revision = mesh.VertexProperties().Revision();
+
+        Geometry::Simplification::Params params;
+        params.Schedule = schedule;
+        params.TargetFaces = 24;
+
+        std::optional<Geometry::Simplification::Result> result;
+        {
+            TestSupport::SchedulerScope scheduler{4u};
+            result = Geometry::Simplification::Simplify(mesh, params);
+        }
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result->CollapseCount, 0u);
+        EXPECT_GT(result->CollapsesRejectedQuality, 0u);
+        EXPECT_EQ(mesh.VertexProperties().Revision(), revision);
+    }
+}
+
+TEST(Simplification, LockedVerticesKeepIndexAndPosition)
+{
+    auto mesh = MakeTessellatedCube(6);
+    auto locked = mesh.VertexProperties().GetOrAdd<std::uint8_t>("v:simplification_locked", 0u);
+    std::vector<glm::vec3> lockedPositions(mesh.VerticesSize());
+    std::size_t lockedCount = 0;
+    for (std::size_t i = 0; i < mesh.VerticesSize(); ++i)
+    {
+        const Geometry::VertexHandle v{static_cast<Geometry::PropertyIndex>(i)};
+        lockedPositions[i] = mesh.Position(v);
+        if (mesh.Position(v).x > 0.0f)
+        {
+            locked[i] = 1u;
+            ++lockedCount;
+        }
+    }
+
+    Geometry::Simplification::Params params;
+    params.TargetFaces = 60;
+
+    const auto result = Geometry::Simplification::Simplify(mesh, params);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_GT(result->CollapseCount, 0u);
+    EXPECT_EQ(result->LockedVerticesPinned, lockedCount);
+
+    for (std::size_t i = 0; i < mesh.VerticesSize(); ++i)
+    {
+        if (locked[i] == 0u)
+            continue;
+        const Geometry::VertexHandle v{static_cast<Geometry::PropertyIndex>(i)};
+        ASSERT_FALSE(mesh.IsDeleted(v));
+        EXPECT_EQ(mesh.Position(v), lockedPositions[i]);
+    }
+}
+
+namespace
+{
+    class ScopedTempDirectory
+    {
+    public:
+        explicit ScopedTempDirectory(const char* name)
+            : m_Path(std::filesystem::temp_directory_path() / name)
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(m_Path, ec);
+            std::filesystem::create_directories(m_Path, ec);
+        }
+
+        ~ScopedTempDirectory()
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(m_Path, ec);
+        }
+
+        ScopedTempDirectory(const ScopedTempDirectory&) = delete;
+        ScopedTempDirectory& operator=(const ScopedTempDirectory&) = delete;
+
+        [[nodiscard]] std::string Path() const { return m_Path.string(); }
+        [[nodiscard]] std::string File(const char* name) const { return (m_Path / name).string(); }
+
+    private:
+        std::filesystem::path m_Path;
+    };
+
+    // Writes the live part of a mesh (no deleted elements) as binary PLY
+    // through the incremental writer.
+    void WriteMeshPLY(const Geometry::HalfedgeMesh::Mesh& mesh, const std::string& path)
+    {
+        std::vector<glm::vec3> positions;
+        for (std::size_t i = 0; i < mesh.VerticesSize(); ++i)
+            positions.push_back(mesh.Position(Geometry::VertexHandle{static_cast<Geometry::PropertyIndex>(i)}));
+        std::vector<std::array<std::uint32_t, 3>> triangles;
+        for (std::size_t fi = 0; fi < mesh.FacesSize(); ++fi)
+        {
+            std::array<std::uint32_t, 3> triangle{};
+            std::size_t k = 0;
+            for (const Geometry::VertexHandle v :
+                 mesh.VerticesAroundFace(Geometry::FaceHandle{static_cast<Geometry::PropertyIndex>(fi)}))
+                triangle[k++] = v.Index;
+            triangles.push_back(triangle);
+        }
+
+        Geometry::MeshIO::PLYBinaryStreamWriter writer;
+        ASSERT_EQ(writer.Open(path, positions.size(), triangles.size()), Geometry::MeshIO::MeshIOWriteStatus::Success);
+        ASSERT_EQ(writer.WriteVertices(positions), Geometry::MeshIO::MeshIOWriteStatus::Success);
+        ASSERT_EQ(writer.WriteTriangles(triangles), Geometry::MeshIO::MeshIOWriteStatus::Success);
+        ASSERT_EQ(writer.Close(), Geometry::MeshIO::MeshIOWriteStatus::Success);
+    }
+}
+
+// A 1 MiB budget forces the 6912-triangle cube into many chunks; the stitched
+// output must still be closed (every edge shared by exactly two triangles).
+TEST(Simplification, StreamingKeepsChunkSeamsClosed)
+{
+    ScopedTempDirectory dir{"intrinsic_streaming_simplification"};
+    const std::string input = dir.File("input.ply");
+    const std::string output = dir.File("output.ply");
+    const auto cube = MakeTessellatedCube(24);
+    WriteMeshPLY(cube, input);
+
+    Geometry::Simplification::StreamingParams params;
+    params.TargetRatio = 0.25;
+    params.MemoryBudgetBytes = Geometry::Simplification::kMinimumStreamingBudgetBytes;
+    params.SpillDirectory = dir.Path();
+
+    Extrinsic::Core::IO::FileIOBackend backend;
+    const auto result = Geometry::Simplification::SimplifyStreaming(input, output, backend, params);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->InputTriangleCount, 6912u);
+    EXPECT_GT(result->ChunkCount, 1u);
+    EXPECT_GT(result->SeamVertexCount, 0u);
+    EXPECT_LT(result->OutputTriangleCount, result->InputTriangleCount);
+    EXPECT_LE(result->PeakResidentBytesEstimate, params.MemoryBudgetBytes);
+
+    const auto reloaded = Geometry::MeshIO::LoadPLY(output);
+    ASSERT_TRUE(reloaded.has_value());
+    EXPECT_EQ(reloaded->Vertices.Size(), result->OutputVertexCount);
+    ASSERT_EQ(reloaded->Faces.Size(), result->OutputTriangleCount);
+
+    const auto faces = reloaded->Faces.Get<std::vector<std::uint32_t>>("f:vertices");
+    ASSERT_TRUE(faces.IsValid());
+    std::map<std::pair<std::uint32_t, std::uint32_t>, int> edgeUses;
+    for (std::size_t f = 0; f < reloaded->Faces.Size(); ++f)
+    {
+        const auto& face = faces[f];
+        ASSERT_EQ(face.size(), 3u);
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            const std::uint32_t a = face[k];
+            const std::uint32_t b = face[(k + 1) % 3];
+            ++edgeUses[{std::min(a, b), std::max(a, b)}];
+        }
+    }
+    for (const auto& [edge, uses] : edgeUses)
+        EXPECT_EQ(uses, 2) << "open edge " << edge.first << "-" << edge.second;
+
+    // Spills are removed on success.
+    EXPECT_FALSE(std::filesystem::exists(dir.File("chunk_0.bin")));
+}
+
+TEST(Simplification, StreamingRejectsInvalidParamsAndFormats)
+{
+    ScopedTempDirectory dir{"intrinsic_streaming_simplification_errors"};
+    const std::string input = dir.File("input.ply");
+    WriteMeshPLY(MakeTessellatedCube(2), input);
+    Extrinsic::Core::IO::FileIOBackend backend;
+
+    Geometry::Simplification::StreamingParams params;
+    params.SpillDirectory = dir.Path();
+    params.MemoryBudgetBytes = Geometry::Simplification::kMinimumStreamingBudgetBytes - 1u;
+    auto result = Geometry::Simplification::SimplifyStreaming(input, dir.File("out.ply"), backend, params);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Extrinsic::Core::ErrorCode::InvalidArgument);
+
+    params.MemoryBudgetBytes = Geometry::Simplification::kMinimumStreamingBudgetBytes;
+    params.SpillDirectory.clear();
+    result = Geometry::Simplification::SimplifyStreaming(input, dir.File("out.ply"), backend, params);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Extrinsic::Core::ErrorCode::InvalidArgument);
+
+    const std::string ascii = dir.File("ascii.ply");
+    {
+        std::ofstream file(ascii);
+        file << "ply\nformat ascii 1.0\nelement vertex 3\nproperty float x\nproperty float y\n"
+                "property float z\nelement face 1\nproperty list uchar int vertex_indices\nend_header\n"
+                "0 0 0\n1 0 0\n0 1 0\n3 0 1 2\n";
+    }
+    params.SpillDirectory = dir.Path();
+    result = Geometry::Simplification::SimplifyStreaming(ascii, dir.File("out.ply"), backend, params);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Extrinsic::Core::ErrorCode::UnsupportedFormat);
+}
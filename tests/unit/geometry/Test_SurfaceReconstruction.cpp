@@ -357,3 +357,84 @@ TEST(SurfaceReconstruction, AcceptsBorrowedSpanInput)
     EXPECT_GT(result->OutputFaceCount, 0u);
 }
 
+
+// =============================================================================
+// Sparse narrow-band grid
+// =============================================================================
+
+TEST(SurfaceReconstruction, NarrowBandRequiresPositiveBand)
+{
+    auto points = MakeSpherePoints(100);
+    auto normals = MakeSphereNormals(points);
+
+    Geometry::SurfaceReconstruction::ReconstructionParams params;
+    params.Resolution = 16;
+    params.EstimateNormals = false;
+    params.Grid = Geometry::SurfaceReconstruction::GridMode::SparseNarrowBand;
+    params.NarrowBandCells = 0;
+
+    EXPECT_FALSE(Geometry::SurfaceReconstruction::Reconstruct(points, normals, params).has_value());
+}
+
+TEST(SurfaceReconstruction, NarrowBandMatchesDenseWhenBandCoversSurface)
+{
+    // About 0.16 point spacing against 0.11 cells: a two-cell band reaches
+    // every cell the surface crosses, so both modes mesh the same cells.
+    const float radius = 2.0f;
+    auto points = MakeSpherePoints(2000, radius);
+    auto normals = MakeSphereNormals(points);
+
+    Geometry::SurfaceReconstruction::ReconstructionParams params;
+    params.Resolution = 48;
+    params.EstimateNormals = false;
+
+    auto dense = Geometry::SurfaceReconstruction::Reconstruct(points, normals, params);
+    params.Grid = Geometry::SurfaceReconstruction::GridMode::SparseNarrowBand;
+    params.NarrowBandCells = 2;
+    auto sparse = Geometry::SurfaceReconstruction::Reconstruct(points, normals, params);
+    ASSERT_TRUE(dense.has_value());
+    ASSERT_TRUE(sparse.has_value());
+
+    EXPECT_EQ(sparse->OutputVertexCount, dense->OutputVertexCount);
+    EXPECT_EQ(sparse->OutputFaceCount, dense->OutputFaceCount);
+
+    double avgRadius = 0.0;
+    std::size_t count = 0;
+    const auto& mesh = sparse->OutputMesh;
+    for (std::size_t vi = 0; vi < mesh.VerticesSize(); ++vi)
+    {
+        Geometry::VertexHandle vh{static_cast<Geometry::PropertyIndex>(vi)};
+        if (mesh.IsDeleted(vh)) continue;
+        avgRadius += static_cast<double>(glm::length(mesh.Position(vh)));
+        ++count;
+    }
+    avgRadius /= static_cast<double>(count);
+    EXPECT_NEAR(avgRadius, static_cast<double>(radius), 0.05);
+}
+
+TEST(SurfaceReconstruction, NarrowBandAllocatesLessThanDense)
+{
+    auto points = MakeSpherePoints(2000, 2.0f);
+    auto normals = MakeSphereNormals(points);
+
+    Geometry::SurfaceReconstruction::ReconstructionParams params;
+    params.Resolution = 64;
+    params.EstimateNormals = false;
+
+    auto dense = Geometry::SurfaceReconstruction::Reconstruct(points, normals, params);
+    params.Grid = Geometry::SurfaceReconstruction::GridMode::SparseNarrowBand;
+    auto sparse = Geometry::SurfaceReconstruction::Reconstruct(points, normals, params);
+    ASSERT_TRUE(dense.has_value());
+    ASSERT_TRUE(sparse.has_value());
+
+    const std::size_t denseVertices = (dense->GridNX + 1) * (dense->GridNY + 1) * (dense->GridNZ + 1);
+    EXPECT_EQ(dense->AllocatedVertexCount, denseVertices);
+    EXPECT_EQ(dense->EvaluatedVertexCount, denseVertices);
+
+    EXPECT_EQ(sparse->GridNX, dense->GridNX);
+    EXPECT_EQ(sparse->AllocatedVertexCount,
+              sparse->AllocatedBlockCount * Geometry::Grid::SparseGrid::BlockVolume);
+    EXPECT_LT(sparse->AllocatedVertexCount, denseVertices);
+    EXPECT_LE(sparse->EvaluatedVertexCount, sparse->AllocatedVertexCount);
+    EXPECT_GT(sparse->EvaluatedVertexCount, 0u);
+}
@@ -73,7 +73,7 @@ TEST(RenderGraphDebugDump, GoldenSmallRenderPassGraphIncludesAttachmentsAndResou
 
     const std::string expected =
         "RenderGraph\n"
-        "  pass_count=3 culled_pass_count=0 resource_count=3 edge_count=2 queue_handoff_edges=0 cross_queue_timeline_edges=0 cross_queue_ownership_transfers=0 barrier_packet_count=4 transient_naive_memory_bytes=512 transient_placed_peak_memory_bytes=512\n"
+        "  pass_count=3 culled_pass_count=0 resource_count=3 edge_count=2 queue_handoff_edges=0 cross_queue_timeline_edges=0 cross_queue_ownership_transfers=0 barrier_packet_count=4 transient_naive_memory_bytes=512 transient_placed_peak_memory_bytes=512 transient_texture_heaps=2 transient_buffer_heaps=0\n"
         "  passes:\n"
         "    [0] pass=0 name=\"DepthPrepass\" layer=0 queue=graphics side_effect=false\n"
         "      explicit_dependencies: none\n"
@@ -95,8 +95,8 @@ TEST(RenderGraphDebugDump, GoldenSmallRenderPassGraphIncludesAttachmentsAndResou
         "    texture[2] name=\"Backbuffer\" used=true imported=true sharing=exclusive final_state=Present first_write_pass=2 last_read_pass=none producer_count=1 consumer_count=0 first_use_pass=2 last_use_pass=2\n"
         "  buffers:\n"
         "  texture_transient_placements:\n"
-        "    texture=0 name=\"SceneDepth\" block=0 offset_bytes=0 size_bytes=256 alignment_bytes=256 first_use_pass=0 last_use_pass=1\n"
-        "    texture=1 name=\"SceneColorHDR\" block=0 offset_bytes=256 size_bytes=256 alignment_bytes=256 first_use_pass=1 last_use_pass=2\n"
+        "    texture=0 name=\"SceneDepth\" block=0 heap=0 offset_bytes=0 size_bytes=256 alignment_bytes=256 first_use_pass=0 last_use_pass=1\n"
+        "    texture=1 name=\"SceneColorHDR\" block=0 heap=1 offset_bytes=256 size_bytes=256 alignment_bytes=256 first_use_pass=1 last_use_pass=2\n"
         "  buffer_transient_placements:\n"
         "    none\n"
         "  alias_reuse_barriers:\n"
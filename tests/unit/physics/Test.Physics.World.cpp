@@ -1,11 +1,18 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 #include <glm/glm.hpp>
 
+import Extrinsic.Core.Tasks;
 import Extrinsic.Physics.World;
 
+#include "SchedulerScope.hpp"
+
 namespace Physics = Extrinsic::Physics;
 
 namespace
@@ -178,7 +185,7 @@ TEST(PhysicsWorld, CollisionGeneratesSphereSphereContactAndCandidate)
     EXPECT_TRUE(Near(contact.PenetrationDepth, 0.25f));
 }
 
-TEST(PhysicsWorld, CollisionKeepsSeparatedPairsAsBroadphaseCandidates)
+TEST(PhysicsWorld, CollisionBroadphaseCullsSeparatedPairs)
 {
     Physics::World world;
     Physics::BodyDescriptor a = DynamicSphere();
@@ -189,12 +196,30 @@ TEST(PhysicsWorld, CollisionKeepsSeparatedPairsAsBroadphaseCandidates)
     ASSERT_TRUE(world.AddBody(b).IsValid());
 
     const Physics::CollisionResult collisions = world.ComputeCollisionContacts();
-    EXPECT_EQ(collisions.Candidates.size(), 1u);
+    EXPECT_TRUE(collisions.Candidates.empty());
     EXPECT_TRUE(collisions.Contacts.empty());
-    EXPECT_EQ(collisions.Diagnostics.BroadphasePairs, 1u);
+    EXPECT_EQ(collisions.Diagnostics.BroadphaseProxies, 2u);
+    EXPECT_EQ(collisions.Diagnostics.BroadphasePairs, 0u);
     EXPECT_EQ(collisions.Diagnostics.ContactsGenerated, 0u);
 }
 
+TEST(PhysicsWorld, CollisionBroadphaseKeepsTouchingBoundsAsCandidates)
+{
+    Physics::World world;
+    Physics::BodyDescriptor a = DynamicSphere();
+    Physics::BodyDescriptor b = DynamicSphere();
+    // Exactly touching along x: the inflated bounds keep the pair so the
+    // narrowphase, not the broadphase, decides the touching case.
+    b.Pose.Position = glm::vec3(1.0f, 0.0f, 0.0f);
+
+    ASSERT_TRUE(world.AddBody(a).IsValid());
+    ASSERT_TRUE(world.AddBody(b).IsValid());
+
+    const Physics::CollisionResult collisions = world.ComputeCollisionContacts();
+    EXPECT_EQ(collisions.Candidates.size(), 1u);
+    EXPECT_EQ(collisions.Diagnostics.BroadphasePairs, 1u);
+}
+
 TEST(PhysicsWorld, CollisionCandidateOrderingIsDeterministic)
 {
     Physics::World world;
@@ -239,8 +264,10 @@ TEST(PhysicsWorld, CollisionSupportsFirstPhasePrimitivePairs)
     ASSERT_TRUE(world.AddBody(boxA).IsValid());
     ASSERT_TRUE(world.AddBody(boxB).IsValid());
 
+    // Sphere/box pairs are vertically separated and culled by the
+    // broadphase; the remaining four bound pairs overlap or touch.
     const Physics::CollisionResult collisions = world.ComputeCollisionContacts();
-    EXPECT_EQ(collisions.Diagnostics.BroadphasePairs, 6u);
+    EXPECT_EQ(collisions.Diagnostics.BroadphasePairs, 4u);
     EXPECT_GE(collisions.Diagnostics.ContactsGenerated, 2u);
     EXPECT_EQ(collisions.Diagnostics.UnsupportedPairs, 0u);
 }
@@ -565,3 +592,243 @@ TEST(PhysicsWorld, SolveStepEnergyDriftIsReportedAndBoundedForRestingContact)
     EXPECT_EQ(world.GetDiagnostics().SolveStepsExecuted, 60u);
     EXPECT_EQ(world.GetDiagnostics().LastSolveStep.Solve, diagnostics.Solve);
 }
+
+TEST(PhysicsWorld, CollisionBroadphaseMatchesFreshWorldAcrossCoherentMotion)
+{
+    // The persistent sweep order is only a seed: after bodies move (and some
+    // are destroyed and re-added), candidates must equal a fresh world's
+    // candidates for the same descriptors, in the same ascending order.
+    Physics::World world;
+    std::vector<Physics::BodyHandle> handles{};
+    for (int z = 0; z < 4; ++z)
+    {
+        for (int x = 0; x < 6; ++x)
+        {
+            Physics::BodyDescriptor body = DynamicSphereAt(
+                {0.9f * static_cast<float>(x), 0.0f, 0.9f * static_cast<float>(z)});
+            body.LinearVelocity = glm::vec3(static_cast<float>((x + z) % 3) - 1.0f, 0.0f,
+                                            static_cast<float>(x % 2) - 0.5f);
+            handles.push_back(world.AddBody(body));
+            ASSERT_TRUE(handles.back().IsValid());
+        }
+    }
+
+    for (int step = 0; step < 12; ++step)
+    {
+        if (step == 6)
+        {
+            ASSERT_TRUE(world.DestroyBody(handles[3]));
+            handles[3] = world.AddBody(DynamicSphereAt({2.0f, 0.0f, 1.0f}));
+            ASSERT_TRUE(handles[3].IsValid());
+        }
+        ASSERT_EQ(world.Step({1.0f / 30.0f, glm::vec3(0.0f)}).Status, Physics::ValidationStatus::Valid);
+        const Physics::CollisionResult incremental = world.ComputeCollisionContacts();
+
+        Physics::World fresh;
+        for (const Physics::BodyHandle handle : handles)
+        {
+            const Physics::BodyDescriptor* body = world.GetBody(handle);
+            ASSERT_NE(body, nullptr);
+            ASSERT_TRUE(fresh.AddBody(*body).IsValid());
+        }
+        const Physics::CollisionResult reference = fresh.ComputeCollisionContacts();
+
+        ASSERT_EQ(incremental.Candidates.size(), reference.Candidates.size());
+        ASSERT_EQ(incremental.Contacts.size(), reference.Contacts.size());
+        // The destroyed slot is reused by the re-add, so both worlds share
+        // one slot layout and candidates compare by slot index.
+        for (std::size_t i = 0u; i < incremental.Candidates.size(); ++i)
+        {
+            EXPECT_EQ(incremental.Candidates[i].A.Body.Index, reference.Candidates[i].A.Body.Index);
+            EXPECT_EQ(incremental.Candidates[i].B.Body.Index, reference.Candidates[i].B.Body.Index);
+            EXPECT_EQ(incremental.Candidates[i].A.ShapeIndex, reference.Candidates[i].A.ShapeIndex);
+            EXPECT_EQ(incremental.Candidates[i].B.ShapeIndex, reference.Candidates[i].B.ShapeIndex);
+        }
+    }
+}
+
+TEST(PhysicsWorld, SolveStepParallelIslandsMatchSerialBitwise)
+{
+    // Piles of 1..5 overlapping spheres on one shared static ground: every
+    // pile is its own island, all anchored by the same static body.
+    const auto buildWorld = [](Physics::World& world)
+    {
+        ASSERT_TRUE(world
+                        .AddBody(StaticBoxAt({0.0f, -0.5f, 0.0f}, {50.0f, 0.5f, 50.0f}))
+                        .IsValid());
+        for (int pile = 0; pile < 12; ++pile)
+        {
+            const int height = 1 + pile % 5;
+            for (int level = 0; level < height; ++level)
+            {
+                const glm::vec3 position{static_cast<float>(pile) * 3.0f,
+                                         0.45f + static_cast<float>(level) * 0.9f,
+                                         0.0f};
+                ASSERT_TRUE(world.AddBody(DynamicSphereAt(position)).IsValid());
+            }
+        }
+    };
+
+    Physics::World serialWorld;
+    Physics::World parallelWorld;
+    buildWorld(serialWorld);
+    buildWorld(parallelWorld);
+
+    Physics::SolverSettings serialSettings{};
+    serialSettings.IslandSolve = Physics::IslandSolveMode::Serial;
+    Physics::SolverSettings parallelSettings{};
+    parallelSettings.IslandSolve = Physics::IslandSolveMode::Parallel;
+
+    {
+        TestSupport::SchedulerScope scheduler{4u};
+        for (int step = 0; step < 20; ++step)
+        {
+            const Physics::SolveStepDiagnostics serial = serialWorld.SolveStep({}, serialSettings);
+            const Physics::SolveStepDiagnostics parallel = parallelWorld.SolveStep({}, parallelSettings);
+            EXPECT_FALSE(serial.ParallelIslandSolve);
+            EXPECT_EQ(serial.Solve, parallel.Solve);
+            EXPECT_EQ(serial.IterationsUsed, parallel.IterationsUsed);
+            EXPECT_EQ(serial.ContactsSolved, parallel.ContactsSolved);
+            EXPECT_EQ(serial.MaxPenetrationAfter, parallel.MaxPenetrationAfter);
+            ASSERT_EQ(serial.IslandTimings.size(), parallel.IslandTimings.size());
+            if (step == 0)
+            {
+                EXPECT_TRUE(parallel.ParallelIslandSolve);
+                EXPECT_EQ(parallel.IslandTimings.size(), 12u);
+            }
+
+            for (std::size_t k = 0u; k < parallel.IslandTimings.size(); ++k)
+            {
+                const Physics::IslandSolveTiming& timing = parallel.IslandTimings[k];
+                EXPECT_EQ(serial.IslandTimings[k].IslandIndex, timing.IslandIndex);
+                EXPECT_EQ(serial.IslandTimings[k].IterationsUsed, timing.IterationsUsed);
+                EXPECT_LE(timing.SolveNanoseconds, parallel.MaxIslandSolveNanoseconds);
+                if (k > 0u)
+                {
+                    // Largest islands are dispatched first.
+                    EXPECT_GE(parallel.IslandTimings[k - 1u].ContactCount, timing.ContactCount);
+                }
+            }
+        }
+    }
+
+    for (std::uint32_t index = 0u; index < serialWorld.BodyCount(); ++index)
+    {
+        const Physics::BodyHandle handle{index, 1u};
+        const Physics::BodyDescriptor* serialBody = serialWorld.GetBody(handle);
+        const Physics::BodyDescriptor* parallelBody = parallelWorld.GetBody(handle);
+        ASSERT_NE(serialBody, nullptr);
+        ASSERT_NE(parallelBody, nullptr);
+        EXPECT_EQ(serialBody->Pose.Position.x, parallelBody->Pose.Position.x);
+        EXPECT_EQ(serialBody->Pose.Position.y, parallelBody->Pose.Position.y);
+        EXPECT_EQ(serialBody->Pose.Position.z, parallelBody->Pose.Position.z);
+        EXPECT_EQ(serialBody->LinearVelocity.x, parallelBody->LinearVelocity.x);
+        EXPECT_EQ(serialBody->LinearVelocity.y, parallelBody->LinearVelocity.y);
+        EXPECT_EQ(serialBody->LinearVelocity.z, parallelBody->LinearVelocity.z);
+    }
+}
+
+TEST(PhysicsWorld, SolveStepParallelIslandsFallBackToSerialWithoutScheduler)
+{
+    Physics::World world;
+    ASSERT_TRUE(world.AddBody(DynamicSphereAt({0.0f, 0.5f, 0.0f})).IsValid());
+    ASSERT_TRUE(world.AddBody(DynamicSphereAt({0.6f, 0.5f, 0.0f})).IsValid());
+    ASSERT_TRUE(world.AddBody(DynamicSphereAt({10.0f, 0.5f, 0.0f})).IsValid());
+    ASSERT_TRUE(world.AddBody(DynamicSphereAt({10.6f, 0.5f, 0.0f})).IsValid());
+    ASSERT_FALSE(Extrinsic::Core::Tasks::Scheduler::IsInitialized());
+
+    Physics::SolverSettings settings{};
+    settings.IslandSolve = Physics::IslandSolveMode::Parallel;
+    const Physics::SolveStepDiagnostics diagnostics = world.SolveStep({}, settings);
+    EXPECT_FALSE(diagnostics.ParallelIslandSolve);
+    ASSERT_EQ(diagnostics.IslandTimings.size(), 2u);
+    EXPECT_EQ(diagnostics.IslandTimings[0].IslandIndex, 0u);
+    EXPECT_EQ(diagnostics.IslandTimings[1].IslandIndex, 1u);
+    EXPECT_EQ(diagnostics.IslandTimings[0].BodyCount, 2u);
+    EXPECT_GT(diagnostics.ContactsSolved, 0u);
+    EXPECT_GE(diagnostics.TotalIslandSolveNanoseconds, diagnostics.MaxIslandSolveNanoseconds);
+}
+
+TEST(PhysicsWorld, StepObservesWritesThroughMutableGetBody)
+{
+    Physics::World world;
+    const Physics::BodyHandle handle = world.AddBody(DynamicSphereAt({0.0f, 0.0f, 0.0f}));
+    ASSERT_TRUE(handle.IsValid());
+    ASSERT_EQ(world.Step(ZeroGravityStep()).Status, Physics::ValidationStatus::Valid);
+
+    world.GetBody(handle)->LinearVelocity = glm::vec3{2.0f, 0.0f, 0.0f};
+    ASSERT_EQ(world.Step({0.5f, glm::vec3{0.0f}}).Status, Physics::ValidationStatus::Valid);
+    EXPECT_TRUE(NearVec(world.GetBody(handle)->Pose.Position, {1.0f, 0.0f, 0.0f}));
+
+    // Disabling through the pointer drops the body from integration.
+    world.GetBody(handle)->Enabled = false;
+    const Physics::StepDiagnostics diagnostics = world.Step({0.5f, glm::vec3{0.0f}});
+    EXPECT_EQ(diagnostics.DisabledBodiesSkipped, 1u);
+    EXPECT_EQ(diagnostics.DynamicBodiesIntegrated, 0u);
+    EXPECT_TRUE(NearVec(world.GetBody(handle)->Pose.Position, {1.0f, 0.0f, 0.0f}));
+}
+
+TEST(PhysicsWorld, ConstGetBodyDoesNotQueueHotStoreReload)
+{
+    Physics::World world;
+    const Physics::BodyHandle handle = world.AddBody(DynamicSphereAt({0.0f, 0.0f, 0.0f}));
+    ASSERT_TRUE(handle.IsValid());
+    ASSERT_EQ(world.Step(ZeroGravityStep()).Status, Physics::ValidationStatus::Valid);
+    const std::uint32_t reloadsBefore = world.GetDiagnostics().HotStoreReloads;
+
+    const Physics::BodyDescriptor* const body = std::as_const(world).GetBody(handle);
+    ASSERT_NE(body, nullptr);
+    EXPECT_EQ(body->Motion, Physics::MotionType::Dynamic);
+    ASSERT_EQ(world.Step(ZeroGravityStep()).Status, Physics::ValidationStatus::Valid);
+    EXPECT_EQ(world.GetDiagnostics().HotStoreReloads, reloadsBefore);
+
+    // Only the mutable overload hands out a writable descriptor and queues
+    // its row for re-sync.
+    ASSERT_NE(world.GetBody(handle), nullptr);
+    ASSERT_EQ(world.Step(ZeroGravityStep()).Status, Physics::ValidationStatus::Valid);
+    EXPECT_EQ(world.GetDiagnostics().HotStoreReloads, reloadsBefore + 1u);
+}
+
+TEST(PhysicsWorld, StepIntegratesHotAndSleepingBodiesIdentically)
+{
+    // Two coincident non-colliding bodies: one awake (hot store), one
+    // asleep (descriptor path under the raw Step()).
+    Physics::World world;
+    Physics::BodyDescriptor descriptor = DynamicSphereAt({1.0f, 2.0f, 3.0f});
+    descriptor.ParticipatesInContacts = false;
+    descriptor.LinearDamping = 0.3f;
+    descriptor.AngularDamping = 0.2f;
+    descriptor.GravityScale = 0.7f;
+    const Physics::BodyHandle sleeping = world.AddBody(descriptor);
+    const Physics::BodyHandle awake = world.AddBody(descriptor);
+    ASSERT_TRUE(sleeping.IsValid());
+    ASSERT_TRUE(awake.IsValid());
+
+    Physics::SolverSettings settings{};
+    settings.TimeToSleepSeconds = 0.0f;
+    (void)world.SolveStep(ZeroGravityStep(), settings);
+    ASSERT_TRUE(world.IsBodyAsleep(sleeping));
+    ASSERT_TRUE(world.WakeBody(awake));
+
+    for (const Physics::BodyHandle handle : {sleeping, awake})
+    {
+        Physics::BodyDescriptor* body = world.GetBody(handle);
+        body->Pose.Position = glm::vec3{1.0f, 2.0f, 3.0f};
+        body->LinearVelocity = glm::vec3{0.3f, 1.5f, -0.2f};
+        body->AngularVelocity = glm::vec3{0.0f, 2.0f, 0.5f};
+    }
+
+    for (int step = 0; step < 10; ++step)
+        ASSERT_EQ(world.Step({1.0f / 60.0f, glm::vec3{0.0f, -9.8f, 0.0f}}).Status, Physics::ValidationStatus::Valid);
+
+    EXPECT_TRUE(world.IsBodyAsleep(sleeping));
+    const Physics::BodyDescriptor* cold = world.GetBody(sleeping);
+    const Physics::BodyDescriptor* hot = world.GetBody(awake);
+    EXPECT_EQ(cold->Pose.Position.x, hot->Pose.Position.x);
+    EXPECT_EQ(cold->Pose.Position.y, hot->Pose.Position.y);
+    EXPECT_EQ(cold->Pose.Position.z, hot->Pose.Position.z);
+    EXPECT_EQ(cold->Pose.Rotation.w, hot->Pose.Rotation.w);
+    EXPECT_EQ(cold->Pose.Rotation.y, hot->Pose.Rotation.y);
+    EXPECT_EQ(cold->LinearVelocity.y, hot->LinearVelocity.y);
+    EXPECT_EQ(cold->AngularVelocity.z, hot->AngularVelocity.z);
+}
@@ -4,11 +4,14 @@
 // density recovery, exact symmetric-pair momentum conservation, viscosity
 // smoothing, the toy fluid-column drop with boundary planes, neighbor
 // overflow reporting, invalid-input validation, instability fail-closed
-// fallback, and repeated-step determinism.
+// fallback, repeated-step determinism, uniform-grid neighbor search
+// against the brute-force oracle, and executor-independent chunked stepping.
 #include "SphFluidReference.hpp"
 
 #include <cmath>
+#include <functional>
 #include <limits>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -363,6 +366,124 @@ TEST(SphFluidReference, RepeatedStepsAreDeterministic)
     ExpectParticlesEqual(first, second);
 }
 
+TEST(SphFluidReference, UniformGridNeighborListMatchesBruteForceOracle)
+{
+    // Jittered lattice plus a far outlier: exercises cell boundaries,
+    // particles exactly at distance h, and hash buckets shared by distant
+    // cells.
+    constexpr double kSpacing = 0.05;
+    auto             particles = UniformGrid(6, kSpacing);
+    for (std::size_t i = 0; i < particles.size(); ++i)
+    {
+        const double jitter = static_cast<double>((i * 7919u) % 13u) * 0.001 - 0.006;
+        particles[i].Position.X += jitter;
+        particles[i].Position.Z -= 0.5 * jitter;
+    }
+    Sph::ParticleState outlier{};
+    outlier.Position = Sph::Vec3{1000.0, -250.0, 3.0};
+    particles.push_back(outlier);
+
+    Sph::StepParams gridParams = GridParams(kSpacing);
+    Sph::StepParams bruteParams = gridParams;
+    bruteParams.Neighbors = Sph::NeighborSearch::BruteForce;
+
+    const Sph::NeighborList grid = Sph::BuildNeighborList(particles, gridParams);
+    const Sph::NeighborList brute = Sph::BuildNeighborList(particles, bruteParams);
+    ASSERT_EQ(grid.Offsets.size(), particles.size() + 1);
+    EXPECT_EQ(grid.Offsets, brute.Offsets);
+    EXPECT_EQ(grid.Indices, brute.Indices);
+
+    // The outlier only sees itself.
+    const std::size_t last = particles.size() - 1;
+    ASSERT_EQ(grid.Offsets[last + 1] - grid.Offsets[last], 1u);
+    EXPECT_EQ(grid.Indices[grid.Offsets[last]], last);
+}
+
+TEST(SphFluidReference, UniformGridStepIsBitwiseIdenticalToBruteForce)
+{
+    constexpr double kSpacing = 0.05;
+    auto             initial = UniformGrid(4, kSpacing);
+    for (Sph::ParticleState& particle : initial)
+    {
+        particle.Position.Y += 0.1;
+    }
+
+    Sph::StepParams gridParams = GridParams(kSpacing);
+    gridParams.Gravity = Sph::Vec3{0.0, -9.80665, 0.0};
+    gridParams.Viscosity = 0.2;
+    gridParams.MaxNeighborLimit = 8;
+    gridParams.Boundaries = {Sph::MakeBoundaryPlane(Sph::Vec3{0.0, 1.0, 0.0}, 0.0)};
+    Sph::StepParams bruteParams = gridParams;
+    bruteParams.Neighbors = Sph::NeighborSearch::BruteForce;
+
+    std::vector<Sph::ParticleState> grid = initial;
+    std::vector<Sph::ParticleState> brute = initial;
+    for (int i = 0; i < 40; ++i)
+    {
+        const Sph::StepResult gridResult = Sph::Step(grid, gridParams);
+        const Sph::StepResult bruteResult = Sph::Step(brute, bruteParams);
+        ASSERT_EQ(gridResult.Diagnostics.Code, Sph::ValidationCode::Valid);
+        ASSERT_EQ(bruteResult.Diagnostics.Code, Sph::ValidationCode::Valid);
+        EXPECT_EQ(gridResult.Diagnostics.MaxNeighborCount, bruteResult.Diagnostics.MaxNeighborCount);
+        EXPECT_EQ(gridResult.Diagnostics.NeighborOverflowCount, bruteResult.Diagnostics.NeighborOverflowCount);
+        EXPECT_EQ(gridResult.Diagnostics.AverageDensity, bruteResult.Diagnostics.AverageDensity);
+        grid = gridResult.Particles;
+        brute = bruteResult.Particles;
+    }
+    ExpectParticlesEqual(grid, brute);
+}
+
+TEST(SphFluidReference, ChunkedStepOnWorkerThreadsIsBitwiseIdenticalToInline)
+{
+    // 14^3 particles span several executor chunks.
+    constexpr double kSpacing = 0.05;
+    auto             initial = UniformGrid(14, kSpacing);
+    for (Sph::ParticleState& particle : initial)
+    {
+        particle.Position.Y += 0.05;
+    }
+
+    Sph::StepParams params = GridParams(kSpacing);
+    params.Gravity = Sph::Vec3{0.0, -9.80665, 0.0};
+    params.Viscosity = 0.2;
+    params.Boundaries = {Sph::MakeBoundaryPlane(Sph::Vec3{0.0, 1.0, 0.0}, 0.0)};
+
+    // One plain thread per chunk, launched in reverse order.
+    Sph::StepParams threadedParams = params;
+    threadedParams.Executor = [](std::size_t chunkCount, const std::function<void(std::size_t)>& body)
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(chunkCount);
+        for (std::size_t chunk = chunkCount; chunk-- > 0;)
+        {
+            workers.emplace_back([&body, chunk]() { body(chunk); });
+        }
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+    };
+
+    const Sph::NeighborList inlineNeighbors = Sph::BuildNeighborList(initial, params);
+    const Sph::NeighborList threadedNeighbors = Sph::BuildNeighborList(initial, threadedParams);
+    EXPECT_EQ(threadedNeighbors.Offsets, inlineNeighbors.Offsets);
+    EXPECT_EQ(threadedNeighbors.Indices, inlineNeighbors.Indices);
+
+    std::vector<Sph::ParticleState> inlineState = initial;
+    std::vector<Sph::ParticleState> threadedState = initial;
+    for (int i = 0; i < 5; ++i)
+    {
+        const Sph::StepResult inlineResult = Sph::Step(inlineState, params);
+        const Sph::StepResult threadedResult = Sph::Step(threadedState, threadedParams);
+        ASSERT_EQ(threadedResult.Diagnostics.Code, Sph::ValidationCode::Valid);
+        EXPECT_EQ(threadedResult.Diagnostics.AverageDensity, inlineResult.Diagnostics.AverageDensity);
+        EXPECT_EQ(threadedResult.Diagnostics.KineticEnergyAfter, inlineResult.Diagnostics.KineticEnergyAfter);
+        inlineState = inlineResult.Particles;
+        threadedState = threadedResult.Particles;
+    }
+    ExpectParticlesEqual(threadedState, inlineState);
+}
+
 TEST(SphFluidReference, NonFiniteExplosionFailsClosedToInputState)
 {
     // Compressed pair with an overflow-inducing (but finite) gas constant: